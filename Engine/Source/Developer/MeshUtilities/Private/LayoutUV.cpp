@@ -3,6 +3,7 @@
 #include "MeshUtilitiesPrivate.h"
 #include "LayoutUV.h"
 #include "DisjointSet.h"
+#include "OverlappingCorners.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogLayoutUV, Warning, All);
 
@@ -19,7 +20,7 @@ FLayoutUV::FLayoutUV( FRawMesh* InMesh, uint32 InSrcChannel, uint32 InDstChannel
 	, ChartShader( &ChartRaster )
 {}
 
-void FLayoutUV::FindCharts( const TMultiMap<int32,int32>& OverlappingCorners )
+void FLayoutUV::FindCharts( const FOverlappingCorners& OverlappingCorners )
 {
 	double Begin = FPlatformTime::Seconds();
 
@@ -35,13 +36,35 @@ void FLayoutUV::FindCharts( const TMultiMap<int32,int32>& OverlappingCorners )
 		TexCoords[i] = RawMesh->WedgeTexCoords[ SrcChannel ][i];
 	}
 
+	// Matches are visited in the order they were found in by the Z sorted sweep, the first translated match of an edge wins
+	struct FCompareSweepRanks
+	{
+		const TArray< int32 >& SweepRanks;
+
+		FCompareSweepRanks( const TArray< int32 >& InSweepRanks )
+		: SweepRanks( InSweepRanks )
+		{}
+
+		FORCEINLINE bool operator()( int32 A, int32 B ) const
+		{
+			return SweepRanks[A] > SweepRanks[B];
+		}
+	};
+	TArray< int32 > SweepRanks;
+	FOverlappingCorners::ComputeSweepRanks( *RawMesh, SweepRanks );
+	TArray< int32 > Matches;
+
 	// Build disjoint set
 	FDisjointSet DisjointSet( NumTris );
 	for( uint32 i = 0; i < NumIndexes; i++ )
 	{
-		for( auto It = OverlappingCorners.CreateConstKeyIterator(i); It; ++It )
+		Matches.Reset();
+		OverlappingCorners.MultiFind( i, Matches );
+		Matches.Sort( FCompareSweepRanks( SweepRanks ) );
+
+		for( int32 MatchIndex = 0; MatchIndex < Matches.Num(); MatchIndex++ )
 		{
-			uint32 j = It.Value();
+			uint32 j = Matches[ MatchIndex ];
 
 			if( j > i )
 			{
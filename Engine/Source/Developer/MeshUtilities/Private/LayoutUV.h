@@ -4,6 +4,8 @@
 
 #include "Allocator2D.h"
 
+class FOverlappingCorners;
+
 struct FMeshChart
 {
 	uint32		FirstTri;
@@ -42,7 +44,7 @@ class FLayoutUV
 public:
 				FLayoutUV( FRawMesh* InMesh, uint32 InSrcChannel, uint32 InDstChannel, uint32 InTextureResolution );
 
-	void		FindCharts( const TMultiMap<int32,int32>& OverlappingCorners );
+	void		FindCharts( const FOverlappingCorners& OverlappingCorners );
 	bool		FindBestPacking();
 	void		CommitPackedUVs();
 
@@ -15,6 +15,7 @@
 #include "MaterialExportUtils.h"
 #include "Textures/TextureAtlas.h"
 #include "LayoutUV.h"
+#include "OverlappingCorners.h"
 #include "mikktspace.h"
 #include "DistanceFieldAtlas.h"
 #include "FbxErrors.h"
@@ -49,6 +50,13 @@ static TAutoConsoleVariable<int32> CVarTriangleOrderOptimization(
 	TEXT("2: No triangle order optimization. (least efficient, debugging purposes only)"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarMeshBuildElementsPerTask(
+	TEXT("r.MeshBuild.ElementsPerTask"),
+	4096,
+	TEXT("Minimum number of vertices, faces or corners processed by each task when static mesh overlapping corners, normals, tangents and vertex buffers are built on task graph workers.\n")
+	TEXT("0: build them on the calling thread."),
+	ECVF_Default);
+
 class FMeshUtilities : public IMeshUtilities
 {
 public:
@@ -1229,27 +1237,95 @@ void FMeshUtilities::BuildSkeletalModelFromChunks(FStaticLODModel& LODModel,cons
 	Common functionality.
 ------------------------------------------------------------------------------*/
 
-/** Helper struct for building acceleration structures. */
-struct FIndexAndZ
+/** Task processing a range of the vertices, faces or corners of a mesh on a task graph worker. */
+class FMeshBuildRangeTask
 {
-	float Z;
-	int32 Index;
+	const TFunctionRef<void(int32, int32, int32)>& Function;
+	int32 RangeIndex;
+	int32 First;
+	int32 Num;
 
-	/** Default constructor. */
-	FIndexAndZ() {}
+public:
+	FMeshBuildRangeTask(const TFunctionRef<void(int32, int32, int32)>& InFunction, int32 InRangeIndex, int32 InFirst, int32 InNum)
+		: Function(InFunction)
+		, RangeIndex(InRangeIndex)
+		, First(InFirst)
+		, Num(InNum)
+	{
+	}
 
-	/** Initialization constructor. */
-	FIndexAndZ(int32 InIndex, FVector V)
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FMeshBuildRangeTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
-		Z = 0.30f * V.X + 0.33f * V.Y + 0.37f * V.Z;
-		Index = InIndex;
+		Function(RangeIndex, First, Num);
 	}
 };
 
-/** Sorting function for vertex Z/index pairs. */
-struct FCompareIndexAndZ
+/**
+ * Splits the vertices, faces or corners of a mesh in ranges processed in parallel, see r.MeshBuild.ElementsPerTask.
+ * The ranges only write the data of their own elements, so the results don't depend on the number of ranges.
+ */
+class FMeshBuildRanges
 {
-	FORCEINLINE bool operator()(FIndexAndZ const& A, FIndexAndZ const& B) const { return A.Z < B.Z; }
+public:
+	explicit FMeshBuildRanges(int32 InNumElements)
+		: NumElements(InNumElements)
+		, NumRanges(1)
+	{
+		const int32 ElementsPerTask = CVarMeshBuildElementsPerTask.GetValueOnAnyThread();
+		if (ElementsPerTask > 0 && NumElements > ElementsPerTask && FApp::ShouldUseThreadingForPerformance())
+		{
+			NumRanges = FMath::Min(FMath::DivideAndRoundUp(NumElements, ElementsPerTask), FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+		}
+		ElementsPerRange = FMath::Max(FMath::DivideAndRoundUp(NumElements, NumRanges), 1);
+		NumRanges = FMath::Max(FMath::DivideAndRoundUp(NumElements, ElementsPerRange), 1);
+	}
+
+	/** @return the number of ranges */
+	int32 Num() const
+	{
+		return NumRanges;
+	}
+
+	/**
+	 * Calls a function for each range, on task graph workers and on the calling thread, which processes the first range.
+	 * Returns once every range was processed.
+	 *
+	 * @param Function		called with the index of the range, its first element and its number of elements
+	 */
+	void ProcessRanges(TFunctionRef<void(int32, int32, int32)> Function) const
+	{
+		FGraphEventArray Tasks;
+		for (int32 RangeIndex = 1; RangeIndex < NumRanges; RangeIndex++)
+		{
+			const int32 First = RangeIndex * ElementsPerRange;
+			Tasks.Add(TGraphTask<FMeshBuildRangeTask>::CreateTask().ConstructAndDispatchWhenReady(Function, RangeIndex, First, FMath::Min(ElementsPerRange, NumElements - First)));
+		}
+		Function(0, 0, FMath::Min(ElementsPerRange, NumElements));
+		if (Tasks.Num() > 0)
+		{
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks);
+		}
+	}
+
+private:
+	int32 NumElements;
+	int32 NumRanges;
+	int32 ElementsPerRange;
 };
 
 static int32 ComputeNumTexCoords(FRawMesh const& RawMesh, int32 MaxSupportedTexCoords)
@@ -1495,96 +1571,340 @@ static void ComputeTriangleTangents(
 	TriangleTangentX.Empty(NumTriangles);
 	TriangleTangentY.Empty(NumTriangles);
 	TriangleTangentZ.Empty(NumTriangles);
+	TriangleTangentX.AddUninitialized(NumTriangles);
+	TriangleTangentY.AddUninitialized(NumTriangles);
+	TriangleTangentZ.AddUninitialized(NumTriangles);
 
-	for (int32 TriangleIndex = 0;TriangleIndex < NumTriangles; TriangleIndex++)
+	FMeshBuildRanges(NumTriangles).ProcessRanges([&](int32 RangeIndex, int32 FirstTriangle, int32 NumRangeTriangles)
 	{
-		int32 UVIndex = 0;
-
-		FVector P[3];
-		for (int32 i = 0; i < 3; ++i)
+		for (int32 TriangleIndex = FirstTriangle; TriangleIndex < FirstTriangle + NumRangeTriangles; TriangleIndex++)
 		{
-			P[i] = GetPositionForWedge(RawMesh, TriangleIndex * 3 + i);
-		}
+			int32 UVIndex = 0;
 
-		const FVector Normal = ((P[1] - P[2])^(P[0] - P[2])).GetSafeNormal(ComparisonThreshold);
-		FMatrix	ParameterToLocal(
-			FPlane(P[1].X - P[0].X, P[1].Y - P[0].Y, P[1].Z - P[0].Z, 0),
-			FPlane(P[2].X - P[0].X, P[2].Y - P[0].Y, P[2].Z - P[0].Z, 0),
-			FPlane(P[0].X,          P[0].Y,          P[0].Z,          0),
-			FPlane(0,               0,               0,				  1)
-			);
+			FVector P[3];
+			for (int32 i = 0; i < 3; ++i)
+			{
+				P[i] = GetPositionForWedge(RawMesh, TriangleIndex * 3 + i);
+			}
 
-		FVector2D T1 = RawMesh.WedgeTexCoords[UVIndex][TriangleIndex * 3 + 0];
-		FVector2D T2 = RawMesh.WedgeTexCoords[UVIndex][TriangleIndex * 3 + 1];
-		FVector2D T3 = RawMesh.WedgeTexCoords[UVIndex][TriangleIndex * 3 + 2];
-		FMatrix ParameterToTexture(
-			FPlane(	T2.X - T1.X,	T2.Y - T1.Y,	0,	0	),
-			FPlane(	T3.X - T1.X,	T3.Y - T1.Y,	0,	0	),
-			FPlane(	T1.X,			T1.Y,			1,	0	),
-			FPlane(	0,				0,				0,	1	)
-			);
+			const FVector Normal = ((P[1] - P[2])^(P[0] - P[2])).GetSafeNormal(ComparisonThreshold);
+			FMatrix	ParameterToLocal(
+				FPlane(P[1].X - P[0].X, P[1].Y - P[0].Y, P[1].Z - P[0].Z, 0),
+				FPlane(P[2].X - P[0].X, P[2].Y - P[0].Y, P[2].Z - P[0].Z, 0),
+				FPlane(P[0].X,          P[0].Y,          P[0].Z,          0),
+				FPlane(0,               0,               0,				  1)
+				);
+
+			FVector2D T1 = RawMesh.WedgeTexCoords[UVIndex][TriangleIndex * 3 + 0];
+			FVector2D T2 = RawMesh.WedgeTexCoords[UVIndex][TriangleIndex * 3 + 1];
+			FVector2D T3 = RawMesh.WedgeTexCoords[UVIndex][TriangleIndex * 3 + 2];
+			FMatrix ParameterToTexture(
+				FPlane(	T2.X - T1.X,	T2.Y - T1.Y,	0,	0	),
+				FPlane(	T3.X - T1.X,	T3.Y - T1.Y,	0,	0	),
+				FPlane(	T1.X,			T1.Y,			1,	0	),
+				FPlane(	0,				0,				0,	1	)
+				);
 
-		// Use InverseSlow to catch singular matrices.  Inverse can miss this sometimes.
-		const FMatrix TextureToLocal = ParameterToTexture.Inverse() * ParameterToLocal;
+			// Use InverseSlow to catch singular matrices.  Inverse can miss this sometimes.
+			const FMatrix TextureToLocal = ParameterToTexture.Inverse() * ParameterToLocal;
 
-		TriangleTangentX.Add(TextureToLocal.TransformVector(FVector(1,0,0)).GetSafeNormal());
-		TriangleTangentY.Add(TextureToLocal.TransformVector(FVector(0,1,0)).GetSafeNormal());
-		TriangleTangentZ.Add(Normal);
+			TriangleTangentX[TriangleIndex] = TextureToLocal.TransformVector(FVector(1,0,0)).GetSafeNormal();
+			TriangleTangentY[TriangleIndex] = TextureToLocal.TransformVector(FVector(0,1,0)).GetSafeNormal();
+			TriangleTangentZ[TriangleIndex] = Normal;
 
-		FVector::CreateOrthonormalBasis(
-			TriangleTangentX[TriangleIndex],
-			TriangleTangentY[TriangleIndex],
-			TriangleTangentZ[TriangleIndex]
-			);
-	}
+			FVector::CreateOrthonormalBasis(
+				TriangleTangentX[TriangleIndex],
+				TriangleTangentY[TriangleIndex],
+				TriangleTangentZ[TriangleIndex]
+				);
+		}
+	});
 
 	check(TriangleTangentX.Num() == NumTriangles);
 	check(TriangleTangentY.Num() == NumTriangles);
 	check(TriangleTangentZ.Num() == NumTriangles);
 }
 
+/** Cell of the spatial hash of the vertices of a mesh. */
+struct FOverlapHashCell
+{
+	int64 X;
+	int64 Y;
+	int64 Z;
+
+	bool operator==(const FOverlapHashCell& Other) const
+	{
+		return X == Other.X && Y == Other.Y && Z == Other.Z;
+	}
+
+	friend uint32 GetTypeHash(const FOverlapHashCell& Cell)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Cell.X), GetTypeHash(Cell.Y)), GetTypeHash(Cell.Z));
+	}
+};
+
+/**
+ * Spatial hash of the vertices of a mesh, finding the vertices that overlap within a comparison threshold. With a
+ * threshold the cells are four thresholds wide, so the vertices overlapping a vertex are in the 8 cells around the
+ * corner of its cell it is closest to. Without one, each cell is an exact position. The vertices of the cells sharing
+ * a bucket are linked in a list.
+ */
+class FOverlapSpatialHash
+{
+public:
+	FOverlapSpatialHash(const TArray<FVector>& InPositions, float InComparisonThreshold)
+		: Positions(InPositions)
+		, ComparisonThreshold(InComparisonThreshold)
+		, CellsPerUnit(InComparisonThreshold > 0.0f ? 0.25 / InComparisonThreshold : 0.0)
+	{
+		const int32 NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(Positions.Num(), 1));
+		BucketMask = NumBuckets - 1;
+		FirstVertexInBucket.Init(INDEX_NONE, NumBuckets);
+		NextVertexInBucket.AddUninitialized(Positions.Num());
+		VertexCells.AddUninitialized(Positions.Num());
+		VertexZ.AddUninitialized(Positions.Num());
+	}
+
+	/** Adds a vertex to the hash. */
+	void Add(int32 VertexIndex)
+	{
+		// The Z the overlapping corners were sorted by, vertices only overlap if they are within the threshold along it too
+		VertexZ[VertexIndex] = FIndexAndZ(VertexIndex, Positions[VertexIndex]).Z;
+
+		int32 Side[3];
+		VertexCells[VertexIndex] = GetCell(Positions[VertexIndex], Side);
+
+		int32& FirstVertex = FirstVertexInBucket[GetTypeHash(VertexCells[VertexIndex]) & BucketMask];
+		NextVertexInBucket[VertexIndex] = FirstVertex;
+		FirstVertex = VertexIndex;
+	}
+
+	/** Appends the vertices added to the hash that overlap a vertex added to the hash, excluding itself. Thread safe. */
+	void FindOverlappingVertices(int32 VertexIndex, TArray<int32>& OutVertices) const
+	{
+		const FVector& Position = Positions[VertexIndex];
+		int32 Side[3];
+		const FOverlapHashCell Cell = GetCell(Position, Side);
+		const int32 NumCells = CellsPerUnit > 0.0 ? 8 : 1;
+		for (int32 CellIndex = 0; CellIndex < NumCells; CellIndex++)
+		{
+			FOverlapHashCell NeighborCell;
+			NeighborCell.X = Cell.X + ((CellIndex & 1) ? Side[0] : 0);
+			NeighborCell.Y = Cell.Y + ((CellIndex & 2) ? Side[1] : 0);
+			NeighborCell.Z = Cell.Z + ((CellIndex & 4) ? Side[2] : 0);
+
+			for (int32 OtherVertexIndex = FirstVertexInBucket[GetTypeHash(NeighborCell) & BucketMask]; OtherVertexIndex != INDEX_NONE; OtherVertexIndex = NextVertexInBucket[OtherVertexIndex])
+			{
+				// Same tests as the Z sorted sweep this replaced, so the same corners overlap
+				if (OtherVertexIndex != VertexIndex
+					&& VertexCells[OtherVertexIndex] == NeighborCell
+					&& !(FMath::Abs(VertexZ[OtherVertexIndex] - VertexZ[VertexIndex]) > ComparisonThreshold)
+					&& PointsEqual(Positions[OtherVertexIndex], Position, ComparisonThreshold))
+				{
+					OutVertices.Add(OtherVertexIndex);
+				}
+			}
+		}
+	}
+
+private:
+
+	/**
+	 * @param Position		position to find the cell of
+	 * @param OutSide		receives the direction of the closest neighbor cell along each axis
+	 * @return the cell containing a position
+	 */
+	FOverlapHashCell GetCell(const FVector& Position, int32 OutSide[3]) const
+	{
+		int64 Coordinates[3];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const float& Coordinate = (&Position.X)[Axis];
+			if (CellsPerUnit > 0.0)
+			{
+				const double CellCoordinate = FMath::Clamp((double)Coordinate * CellsPerUnit, -4.0e18, 4.0e18);
+				const double CellMin = FMath::FloorToDouble(CellCoordinate);
+				Coordinates[Axis] = (int64)CellMin;
+				OutSide[Axis] = (CellCoordinate - CellMin < 0.5) ? -1 : 1;
+			}
+			else
+			{
+				// Exact positions, +0 and -0 are equal
+				const uint32 Bits = *(const uint32*)&Coordinate;
+				Coordinates[Axis] = (Bits & 0x7fffffff) ? Bits : 0;
+				OutSide[Axis] = 0;
+			}
+		}
+
+		FOverlapHashCell Cell;
+		Cell.X = Coordinates[0];
+		Cell.Y = Coordinates[1];
+		Cell.Z = Coordinates[2];
+		return Cell;
+	}
+
+	const TArray<FVector>& Positions;
+	float ComparisonThreshold;
+	/** Inverse of the width of the cells, 0 to hash exact positions */
+	double CellsPerUnit;
+	uint32 BucketMask;
+	TArray<int32> FirstVertexInBucket;
+	TArray<int32> NextVertexInBucket;
+	TArray<FOverlapHashCell> VertexCells;
+	TArray<float> VertexZ;
+};
+
 /**
- * Create a table that maps the corner of each face to its overlapping corners.
+ * Create a table that maps the corner of each face to its overlapping corners. Corners overlap if their positions are
+ * within the threshold, the same corners as found by the Z sorted sweep this replaced.
  * @param OutOverlappingCorners - Maps a corner index to the indices of all overlapping corners.
  * @param RawMesh - The mesh for which to compute overlapping corners.
  */
-static void FindOverlappingCorners(
-	TMultiMap<int32,int32>& OutOverlappingCorners,
+void FindOverlappingCorners(
+	FOverlappingCorners& OutOverlappingCorners,
 	FRawMesh const& RawMesh,
 	float ComparisonThreshold
 	)
 {
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
+	int32 NumVertices = RawMesh.VertexPositions.Num();
 
-	// Create a list of vertex Z/index pairs
-	TArray<FIndexAndZ> VertIndexAndZ;
-	VertIndexAndZ.Empty(NumWedges);
-	for(int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
+	// Gather the corners of each vertex, in ascending order.
+	TArray<int32> VertexCornerOffsets;
+	VertexCornerOffsets.AddZeroed(NumVertices + 1);
+	for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
 	{
-		new(VertIndexAndZ) FIndexAndZ(WedgeIndex, GetPositionForWedge(RawMesh, WedgeIndex));
+		VertexCornerOffsets[RawMesh.WedgeIndices[WedgeIndex] + 1]++;
+	}
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		VertexCornerOffsets[VertexIndex + 1] += VertexCornerOffsets[VertexIndex];
 	}
 
-	// Sort the vertices by z value
-	VertIndexAndZ.Sort(FCompareIndexAndZ());
+	TArray<int32> VertexCorners;
+	VertexCorners.AddUninitialized(NumWedges);
+	{
+		TArray<int32> NextVertexCorner = VertexCornerOffsets;
+		for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
+		{
+			VertexCorners[NextVertexCorner[RawMesh.WedgeIndices[WedgeIndex]]++] = WedgeIndex;
+		}
+	}
 
-	// Search for duplicates, quickly!
-	for (int32 i = 0; i < VertIndexAndZ.Num(); i++)
+	// Hash the vertices used by the corners.
+	FOverlapSpatialHash SpatialHash(RawMesh.VertexPositions, ComparisonThreshold);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
 	{
-		// only need to search forward, since we add pairs both ways
-		for (int32 j = i + 1; j < VertIndexAndZ.Num(); j++)
+		if (VertexCornerOffsets[VertexIndex + 1] > VertexCornerOffsets[VertexIndex])
 		{
-			if (FMath::Abs(VertIndexAndZ[j].Z - VertIndexAndZ[i].Z) > ComparisonThreshold)
-				break; // can't be any more dups
+			SpatialHash.Add(VertexIndex);
+		}
+	}
+
+	// Find the vertices overlapping each vertex. The corners of a vertex overlap the other corners of the vertex and the
+	// corners of the overlapping vertices.
+	FMeshBuildRanges VertexRanges(NumVertices);
+	TArray<TArray<int32> > RangeOverlappingVertices;
+	RangeOverlappingVertices.SetNum(VertexRanges.Num());
+	TArray<int32> NumOverlappingVertices;
+	NumOverlappingVertices.AddZeroed(NumVertices);
+	TArray<int32> NumVertexOverlappingCorners;
+	NumVertexOverlappingCorners.AddZeroed(NumVertices);
+
+	VertexRanges.ProcessRanges([&](int32 RangeIndex, int32 FirstVertex, int32 NumRangeVertices)
+	{
+		TArray<int32>& OverlappingVertices = RangeOverlappingVertices[RangeIndex];
+		for (int32 VertexIndex = FirstVertex; VertexIndex < FirstVertex + NumRangeVertices; VertexIndex++)
+		{
+			const int32 NumCorners = VertexCornerOffsets[VertexIndex + 1] - VertexCornerOffsets[VertexIndex];
+			if (NumCorners > 0)
+			{
+				const int32 FirstOverlappingVertex = OverlappingVertices.Num();
+				SpatialHash.FindOverlappingVertices(VertexIndex, OverlappingVertices);
+				NumOverlappingVertices[VertexIndex] = OverlappingVertices.Num() - FirstOverlappingVertex;
+
+				int32 NumOverlappingCorners = NumCorners - 1;
+				for (int32 Index = FirstOverlappingVertex; Index < OverlappingVertices.Num(); Index++)
+				{
+					const int32 OtherVertexIndex = OverlappingVertices[Index];
+					NumOverlappingCorners += VertexCornerOffsets[OtherVertexIndex + 1] - VertexCornerOffsets[OtherVertexIndex];
+				}
+				NumVertexOverlappingCorners[VertexIndex] = NumOverlappingCorners;
+			}
+		}
+	});
+
+	TArray<int32>& CornerOffsets = OutOverlappingCorners.CornerOffsets;
+	CornerOffsets.Empty(NumWedges + 1);
+	CornerOffsets.AddUninitialized(NumWedges + 1);
+	CornerOffsets[0] = 0;
+	for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
+	{
+		CornerOffsets[WedgeIndex + 1] = CornerOffsets[WedgeIndex] + NumVertexOverlappingCorners[RawMesh.WedgeIndices[WedgeIndex]];
+	}
+
+	TArray<int32>& OverlappingCorners = OutOverlappingCorners.OverlappingCorners;
+	OverlappingCorners.Empty(CornerOffsets[NumWedges]);
+	OverlappingCorners.AddUninitialized(CornerOffsets[NumWedges]);
+
+	// Write the sorted corners overlapping each corner, each range writes the corners of its vertices.
+	VertexRanges.ProcessRanges([&](int32 RangeIndex, int32 FirstVertex, int32 NumRangeVertices)
+	{
+		const int32* OverlappingVertices = RangeOverlappingVertices[RangeIndex].GetData();
+		TArray<int32> Corners;
+		for (int32 VertexIndex = FirstVertex; VertexIndex < FirstVertex + NumRangeVertices; VertexIndex++)
+		{
+			const int32 FirstCorner = VertexCornerOffsets[VertexIndex];
+			const int32 NumCorners = VertexCornerOffsets[VertexIndex + 1] - FirstCorner;
+			if (NumCorners == 0)
+			{
+				continue;
+			}
 
-			FVector PositionA = GetPositionForWedge(RawMesh, VertIndexAndZ[i].Index);
-			FVector PositionB = GetPositionForWedge(RawMesh, VertIndexAndZ[j].Index);
+			Corners.Reset();
+			Corners.Append(VertexCorners.GetData() + FirstCorner, NumCorners);
+			for (int32 Index = 0; Index < NumOverlappingVertices[VertexIndex]; Index++)
+			{
+				const int32 OtherVertexIndex = *OverlappingVertices++;
+				const int32 OtherFirstCorner = VertexCornerOffsets[OtherVertexIndex];
+				Corners.Append(VertexCorners.GetData() + OtherFirstCorner, VertexCornerOffsets[OtherVertexIndex + 1] - OtherFirstCorner);
+			}
+			Corners.Sort();
 
-			if (PointsEqual(PositionA, PositionB, ComparisonThreshold))					
+			for (int32 CornerIndex = FirstCorner; CornerIndex < FirstCorner + NumCorners; CornerIndex++)
 			{
-				OutOverlappingCorners.Add(VertIndexAndZ[i].Index,VertIndexAndZ[j].Index);
-				OutOverlappingCorners.Add(VertIndexAndZ[j].Index,VertIndexAndZ[i].Index);
+				const int32 WedgeIndex = VertexCorners[CornerIndex];
+				int32* Dest = OverlappingCorners.GetData() + CornerOffsets[WedgeIndex];
+				for (int32 Index = 0; Index < Corners.Num(); Index++)
+				{
+					if (Corners[Index] != WedgeIndex)
+					{
+						*Dest++ = Corners[Index];
+					}
+				}
 			}
 		}
+	});
+}
+
+void FOverlappingCorners::ComputeSweepRanks(const FRawMesh& RawMesh, TArray<int32>& OutRanks)
+{
+	int32 NumWedges = RawMesh.WedgeIndices.Num();
+
+	// The corners in the order of the sweep, see FindOverlappingCorners before the spatial hash
+	TArray<FIndexAndZ> VertIndexAndZ;
+	VertIndexAndZ.Empty(NumWedges);
+	for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
+	{
+		new(VertIndexAndZ) FIndexAndZ(WedgeIndex, GetPositionForWedge(RawMesh, WedgeIndex));
+	}
+	VertIndexAndZ.Sort(FCompareIndexAndZ());
+
+	OutRanks.Empty(NumWedges);
+	OutRanks.AddUninitialized(NumWedges);
+	for (int32 Rank = 0; Rank < NumWedges; Rank++)
+	{
+		OutRanks[VertIndexAndZ[Rank].Index] = Rank;
 	}
 }
 
@@ -1610,9 +1930,47 @@ struct FFanFace
 	bool bBlendNormals;
 };
 
+/**
+ * Gathers the faces sharing a corner position with a face, including the face itself.
+ * @param OutAdjacentFaces - Receives the adjacent faces in ascending order.
+ */
+static void GatherAdjacentFaces(
+	FOverlappingCorners const& OverlappingCorners,
+	int32 FaceIndex,
+	TArray<int32>& OutAdjacentFaces
+	)
+{
+	OutAdjacentFaces.Reset();
+	OutAdjacentFaces.Add(FaceIndex); // I am a "dup" of myself
+	for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+	{
+		int32 ThisCornerIndex = FaceIndex * 3 + CornerIndex;
+		const int32* DupVerts = OverlappingCorners.GetData(ThisCornerIndex);
+		for (int32 k = 0; k < OverlappingCorners.Num(ThisCornerIndex); k++)
+		{
+			OutAdjacentFaces.Add(DupVerts[k] / 3);
+		}
+	}
+
+	// We need to sort these here because the criteria for point equality is
+	// exact, so we must ensure the exact same order for all dups.
+	OutAdjacentFaces.Sort();
+
+	// Remove the faces adjacent through several corners.
+	int32 NumUniqueFaces = 0;
+	for (int32 Index = 0; Index < OutAdjacentFaces.Num(); Index++)
+	{
+		if (NumUniqueFaces == 0 || OutAdjacentFaces[Index] != OutAdjacentFaces[NumUniqueFaces - 1])
+		{
+			OutAdjacentFaces[NumUniqueFaces++] = OutAdjacentFaces[Index];
+		}
+	}
+	OutAdjacentFaces.RemoveAt(NumUniqueFaces, OutAdjacentFaces.Num() - NumUniqueFaces, false);
+}
+
 static void ComputeTangents(
 	FRawMesh& RawMesh,
-	TMultiMap<int32,int32> const& OverlappingCorners,
+	FOverlappingCorners const& OverlappingCorners,
 	uint32 TangentOptions
 	)
 {
@@ -1633,11 +1991,6 @@ static void ComputeTangents(
 		bIgnoreDegenerateTriangles ? SMALL_NUMBER : 0.0f
 		);
 
-	// Declare these out here to avoid reallocations.
-	TArray<FFanFace> RelevantFacesForCorner[3];
-	TArray<int32> AdjacentFaces;
-	TArray<int32> DupVerts;
-
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
 	int32 NumFaces = NumWedges / 3;
 
@@ -1658,268 +2011,260 @@ static void ComputeTangents(
 		RawMesh.WedgeTangentZ.AddZeroed(NumWedges);
 	}
 
-	for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+	FMeshBuildRanges(NumFaces).ProcessRanges([&](int32 RangeIndex, int32 FirstFace, int32 NumRangeFaces)
 	{
-		int32 WedgeOffset = FaceIndex * 3;
-		FVector CornerPositions[3];
-		FVector CornerTangentX[3];
-		FVector CornerTangentY[3];
-		FVector CornerTangentZ[3];
-
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			CornerTangentX[CornerIndex] = FVector::ZeroVector;
-			CornerTangentY[CornerIndex] = FVector::ZeroVector;
-			CornerTangentZ[CornerIndex] = FVector::ZeroVector;
-			CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
-			RelevantFacesForCorner[CornerIndex].Reset();
-		}
+		// Declare these out here to avoid reallocations.
+		TArray<FFanFace> RelevantFacesForCorner[3];
+		TArray<int32> AdjacentFaces;
 
-		// Don't process degenerate triangles.
-		if (PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold)
-			|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
-			|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
+		for (int32 FaceIndex = FirstFace; FaceIndex < FirstFace + NumRangeFaces; FaceIndex++)
 		{
-			continue;
-		}
+			int32 WedgeOffset = FaceIndex * 3;
+			FVector CornerPositions[3];
+			FVector CornerTangentX[3];
+			FVector CornerTangentY[3];
+			FVector CornerTangentZ[3];
 
-		// No need to process triangles if tangents already exist.
-		bool bCornerHasTangents[3] = {0};
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			bCornerHasTangents[CornerIndex] = !RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero()
-				&& !RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero()
-				&& !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
-		}
-		if (bCornerHasTangents[0] && bCornerHasTangents[1] && bCornerHasTangents[2])
-		{
-			continue;
-		}
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				CornerTangentX[CornerIndex] = FVector::ZeroVector;
+				CornerTangentY[CornerIndex] = FVector::ZeroVector;
+				CornerTangentZ[CornerIndex] = FVector::ZeroVector;
+				CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
+				RelevantFacesForCorner[CornerIndex].Reset();
+			}
 
-		// Calculate smooth vertex normals.
-		float Determinant = FVector::Triple(
-			TriangleTangentX[FaceIndex],
-			TriangleTangentY[FaceIndex],
-			TriangleTangentZ[FaceIndex]
-			);
+			// Don't process degenerate triangles.
+			if (PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold)
+				|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
+				|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
+			{
+				continue;
+			}
 
-		// Start building a list of faces adjacent to this face.
-		AdjacentFaces.Reset();
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			int32 ThisCornerIndex = WedgeOffset + CornerIndex;
-			DupVerts.Reset();
-			OverlappingCorners.MultiFind(ThisCornerIndex,DupVerts);
-			DupVerts.Add(ThisCornerIndex); // I am a "dup" of myself
-			for (int32 k = 0; k < DupVerts.Num(); k++)
+			// No need to process triangles if tangents already exist.
+			bool bCornerHasTangents[3] = {0};
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				AdjacentFaces.AddUnique(DupVerts[k] / 3);
+				bCornerHasTangents[CornerIndex] = !RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero()
+					&& !RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero()
+					&& !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
+			}
+			if (bCornerHasTangents[0] && bCornerHasTangents[1] && bCornerHasTangents[2])
+			{
+				continue;
 			}
-		}
 
-		// We need to sort these here because the criteria for point equality is
-		// exact, so we must ensure the exact same order for all dups.
-		AdjacentFaces.Sort();
+			// Calculate smooth vertex normals.
+			float Determinant = FVector::Triple(
+				TriangleTangentX[FaceIndex],
+				TriangleTangentY[FaceIndex],
+				TriangleTangentZ[FaceIndex]
+				);
 
-		// Process adjacent faces
-		for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
-		{
-			int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
-			for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
+			// Start building a list of faces adjacent to this face.
+			GatherAdjacentFaces(OverlappingCorners, FaceIndex, AdjacentFaces);
+
+			// Process adjacent faces
+			for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
 			{
-				if (bCornerHasTangents[OurCornerIndex])
-					continue;
+				int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
+				for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
+				{
+					if (bCornerHasTangents[OurCornerIndex])
+						continue;
 
-				FFanFace NewFanFace;
-				int32 CommonIndexCount = 0;
+					FFanFace NewFanFace;
+					int32 CommonIndexCount = 0;
 
-				// Check for vertices in common.
-				if (FaceIndex == OtherFaceIndex)
-				{
-					CommonIndexCount = 3;		
-					NewFanFace.LinkedVertexIndex = OurCornerIndex;
-				}
-				else
-				{
-					// Check matching vertices against main vertex .
-					for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+					// Check for vertices in common.
+					if (FaceIndex == OtherFaceIndex)
+					{
+						CommonIndexCount = 3;		
+						NewFanFace.LinkedVertexIndex = OurCornerIndex;
+					}
+					else
 					{
-						if (PointsEqual(
-								CornerPositions[OurCornerIndex],
-								GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
-								ComparisonThreshold
-								))
+						// Check matching vertices against main vertex .
+						for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
 						{
-							CommonIndexCount++;
-							NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+							if (PointsEqual(
+									CornerPositions[OurCornerIndex],
+									GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
+									ComparisonThreshold
+									))
+							{
+								CommonIndexCount++;
+								NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+							}
 						}
 					}
-				}
 
-				// Add if connected by at least one point. Smoothing matches are considered later.
-				if (CommonIndexCount > 0)
-				{ 					
-					NewFanFace.FaceIndex = OtherFaceIndex;
-					NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
-					NewFanFace.bBlendTangents = NewFanFace.bFilled;
-					NewFanFace.bBlendNormals = NewFanFace.bFilled;
-					RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+					// Add if connected by at least one point. Smoothing matches are considered later.
+					if (CommonIndexCount > 0)
+					{ 					
+						NewFanFace.FaceIndex = OtherFaceIndex;
+						NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
+						NewFanFace.bBlendTangents = NewFanFace.bFilled;
+						NewFanFace.bBlendNormals = NewFanFace.bFilled;
+						RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+					}
 				}
 			}
-		}
-
-		// Find true relevance of faces for a vertex normal by traversing
-		// smoothing-group-compatible connected triangle fans around common vertices.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			if (bCornerHasTangents[CornerIndex])
-				continue;
 
-			int32 NewConnections;
-			do
+			// Find true relevance of faces for a vertex normal by traversing
+			// smoothing-group-compatible connected triangle fans around common vertices.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				NewConnections = 0;
-				for (int32 OtherFaceIdx=0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
+				if (bCornerHasTangents[CornerIndex])
+					continue;
+
+				int32 NewConnections;
+				do
 				{
-					FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
-					// The vertex' own face is initially the only face with bFilled == true.
-					if (OtherFace.bFilled)
-					{				
-						for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
-						{
-							FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
-							if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
-							{
-								if ((NextFaceIndex != OtherFaceIdx)
-									&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
-								{				
-									int32 CommonVertices = 0;
-									int32 CommonTangentVertices = 0;
-									int32 CommonNormalVertices = 0;
-									for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
-									{											
-										for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
-										{
-											int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
-											int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
-											if (PointsEqual(
-													RawMesh.VertexPositions[NextVertexIndex],
-													RawMesh.VertexPositions[OtherVertexIndex],
-													ComparisonThreshold))
-											{
-												CommonVertices++;
-												if (UVsEqual(
-														RawMesh.WedgeTexCoords[0][NextFace.FaceIndex * 3 + NextCornerIndex],
-														RawMesh.WedgeTexCoords[0][OtherFace.FaceIndex * 3 + OtherCornerIndex]))
-												{
-													CommonTangentVertices++;
-												}
-												if (bBlendOverlappingNormals
-													|| NextVertexIndex == OtherVertexIndex)
+					NewConnections = 0;
+					for (int32 OtherFaceIdx=0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
+					{
+						FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
+						// The vertex' own face is initially the only face with bFilled == true.
+						if (OtherFace.bFilled)
+						{				
+							for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
+							{
+								FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
+								if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
+								{
+									if ((NextFaceIndex != OtherFaceIdx)
+										&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
+									{				
+										int32 CommonVertices = 0;
+										int32 CommonTangentVertices = 0;
+										int32 CommonNormalVertices = 0;
+										for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+										{											
+											for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
+											{
+												int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
+												int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
+												if (PointsEqual(
+														RawMesh.VertexPositions[NextVertexIndex],
+														RawMesh.VertexPositions[OtherVertexIndex],
+														ComparisonThreshold))
 												{
-													CommonNormalVertices++;
+													CommonVertices++;
+													if (UVsEqual(
+															RawMesh.WedgeTexCoords[0][NextFace.FaceIndex * 3 + NextCornerIndex],
+															RawMesh.WedgeTexCoords[0][OtherFace.FaceIndex * 3 + OtherCornerIndex]))
+													{
+														CommonTangentVertices++;
+													}
+													if (bBlendOverlappingNormals
+														|| NextVertexIndex == OtherVertexIndex)
+													{
+														CommonNormalVertices++;
+													}
 												}
-											}
-										}										
-									}
-									// Flood fill faces with more than one common vertices which must be touching edges.
-									if (CommonVertices > 1)
-									{
-										NextFace.bFilled = true;
-										NextFace.bBlendNormals = (CommonNormalVertices > 1);
-										NewConnections++;
-
-										// Only blend tangents if there is no UV seam along the edge with this face.
-										if (OtherFace.bBlendTangents && CommonTangentVertices > 1)
+											}										
+										}
+										// Flood fill faces with more than one common vertices which must be touching edges.
+										if (CommonVertices > 1)
 										{
-											float OtherDeterminant = FVector::Triple(
-												TriangleTangentX[NextFace.FaceIndex],
-												TriangleTangentY[NextFace.FaceIndex],
-												TriangleTangentZ[NextFace.FaceIndex]
-												);
-											if ((Determinant * OtherDeterminant) > 0.0f)
+											NextFace.bFilled = true;
+											NextFace.bBlendNormals = (CommonNormalVertices > 1);
+											NewConnections++;
+
+											// Only blend tangents if there is no UV seam along the edge with this face.
+											if (OtherFace.bBlendTangents && CommonTangentVertices > 1)
 											{
-												NextFace.bBlendTangents = true;
+												float OtherDeterminant = FVector::Triple(
+													TriangleTangentX[NextFace.FaceIndex],
+													TriangleTangentY[NextFace.FaceIndex],
+													TriangleTangentZ[NextFace.FaceIndex]
+													);
+												if ((Determinant * OtherDeterminant) > 0.0f)
+												{
+													NextFace.bBlendTangents = true;
+												}
 											}
-										}
-									}								
+										}								
+									}
 								}
 							}
 						}
 					}
 				}
+				while (NewConnections > 0);
 			}
-			while (NewConnections > 0);
-		}
 
-		// Vertex normal construction.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			if (bCornerHasTangents[CornerIndex])
-			{
-				CornerTangentX[CornerIndex] = RawMesh.WedgeTangentX[WedgeOffset + CornerIndex];
-				CornerTangentY[CornerIndex] = RawMesh.WedgeTangentY[WedgeOffset + CornerIndex];
-				CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
-			}
-			else
+			// Vertex normal construction.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
-				{
-					FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
-					if (RelevantFace.bFilled)
-					{
-						int32 OtherFaceIndex = RelevantFace.FaceIndex;
-						if (RelevantFace.bBlendTangents)
-						{
-							CornerTangentX[CornerIndex] += TriangleTangentX[OtherFaceIndex];
-							CornerTangentY[CornerIndex] += TriangleTangentY[OtherFaceIndex];
-						}
-						if (RelevantFace.bBlendNormals)
-						{
-							CornerTangentZ[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
-						}
-					}
-				}
-				if (!RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero())
+				if (bCornerHasTangents[CornerIndex])
 				{
 					CornerTangentX[CornerIndex] = RawMesh.WedgeTangentX[WedgeOffset + CornerIndex];
-				}
-				if (!RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero())
-				{
 					CornerTangentY[CornerIndex] = RawMesh.WedgeTangentY[WedgeOffset + CornerIndex];
+					CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
 				}
-				if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
+				else
 				{
-					CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+					for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
+					{
+						FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
+						if (RelevantFace.bFilled)
+						{
+							int32 OtherFaceIndex = RelevantFace.FaceIndex;
+							if (RelevantFace.bBlendTangents)
+							{
+								CornerTangentX[CornerIndex] += TriangleTangentX[OtherFaceIndex];
+								CornerTangentY[CornerIndex] += TriangleTangentY[OtherFaceIndex];
+							}
+							if (RelevantFace.bBlendNormals)
+							{
+								CornerTangentZ[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
+							}
+						}
+					}
+					if (!RawMesh.WedgeTangentX[WedgeOffset + CornerIndex].IsZero())
+					{
+						CornerTangentX[CornerIndex] = RawMesh.WedgeTangentX[WedgeOffset + CornerIndex];
+					}
+					if (!RawMesh.WedgeTangentY[WedgeOffset + CornerIndex].IsZero())
+					{
+						CornerTangentY[CornerIndex] = RawMesh.WedgeTangentY[WedgeOffset + CornerIndex];
+					}
+					if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
+					{
+						CornerTangentZ[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+					}
 				}
 			}
-		}
 
-		// Normalization.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			CornerTangentX[CornerIndex].Normalize();
-			CornerTangentY[CornerIndex].Normalize();
-			CornerTangentZ[CornerIndex].Normalize();
-
-			// Gram-Schmidt orthogonalization
-			CornerTangentY[CornerIndex] -= CornerTangentX[CornerIndex] * (CornerTangentX[CornerIndex] | CornerTangentY[CornerIndex]);
-			CornerTangentY[CornerIndex].Normalize();
-
-			CornerTangentX[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentX[CornerIndex]);
-			CornerTangentX[CornerIndex].Normalize();
-			CornerTangentY[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentY[CornerIndex]);
-			CornerTangentY[CornerIndex].Normalize();
-		}
+			// Normalization.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				CornerTangentX[CornerIndex].Normalize();
+				CornerTangentY[CornerIndex].Normalize();
+				CornerTangentZ[CornerIndex].Normalize();
+
+				// Gram-Schmidt orthogonalization
+				CornerTangentY[CornerIndex] -= CornerTangentX[CornerIndex] * (CornerTangentX[CornerIndex] | CornerTangentY[CornerIndex]);
+				CornerTangentY[CornerIndex].Normalize();
+
+				CornerTangentX[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentX[CornerIndex]);
+				CornerTangentX[CornerIndex].Normalize();
+				CornerTangentY[CornerIndex] -= CornerTangentZ[CornerIndex] * (CornerTangentZ[CornerIndex] | CornerTangentY[CornerIndex]);
+				CornerTangentY[CornerIndex].Normalize();
+			}
 
-		// Copy back to the mesh.
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			RawMesh.WedgeTangentX[WedgeOffset + CornerIndex] = CornerTangentX[CornerIndex];
-			RawMesh.WedgeTangentY[WedgeOffset + CornerIndex] = CornerTangentY[CornerIndex];
-			RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerTangentZ[CornerIndex];
+			// Copy back to the mesh.
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				RawMesh.WedgeTangentX[WedgeOffset + CornerIndex] = CornerTangentX[CornerIndex];
+				RawMesh.WedgeTangentY[WedgeOffset + CornerIndex] = CornerTangentY[CornerIndex];
+				RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerTangentZ[CornerIndex];
+			}
 		}
-	}
+	});
 
 	check(RawMesh.WedgeTangentX.Num() == NumWedges);
 	check(RawMesh.WedgeTangentY.Num() == NumWedges);
@@ -2097,7 +2442,7 @@ static void MikkGetTexCoord_Skeletal(const SMikkTSpaceContext* Context, float UV
 
 static void ComputeTangents_MikkTSpace(
 	FRawMesh& RawMesh,
-	TMultiMap<int32,int32> const& OverlappingCorners,
+	FOverlappingCorners const& OverlappingCorners,
 	uint32 TangentOptions
 	)
 {
@@ -2118,11 +2463,6 @@ static void ComputeTangents_MikkTSpace(
 		bIgnoreDegenerateTriangles ? SMALL_NUMBER : 0.0f
 		);
 
-	// Declare these out here to avoid reallocations.
-	TArray<FFanFace> RelevantFacesForCorner[3];
-	TArray<int32> AdjacentFaces;
-	TArray<int32> DupVerts;
-
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
 	int32 NumFaces = NumWedges / 3;
 
@@ -2151,207 +2491,199 @@ static void ComputeTangents_MikkTSpace(
 		RawMesh.WedgeTangentZ.AddZeroed(NumWedges);
 		// we need to calculate normals for MikkTSpace
 
-		for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+		FMeshBuildRanges(NumFaces).ProcessRanges([&](int32 RangeIndex, int32 FirstFace, int32 NumRangeFaces)
 		{
-			int32 WedgeOffset = FaceIndex * 3;
-			FVector CornerPositions[3];
-			FVector CornerNormal[3];
+			// Declare these out here to avoid reallocations.
+			TArray<FFanFace> RelevantFacesForCorner[3];
+			TArray<int32> AdjacentFaces;
 
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			for (int32 FaceIndex = FirstFace; FaceIndex < FirstFace + NumRangeFaces; FaceIndex++)
 			{
-				CornerNormal[CornerIndex] = FVector::ZeroVector;
-				CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
-				RelevantFacesForCorner[CornerIndex].Reset();
-			}
+				int32 WedgeOffset = FaceIndex * 3;
+				FVector CornerPositions[3];
+				FVector CornerNormal[3];
 
-			// Don't process degenerate triangles.
-			if (PointsEqual(CornerPositions[0], CornerPositions[1], ComparisonThreshold)
-				|| PointsEqual(CornerPositions[0], CornerPositions[2], ComparisonThreshold)
-				|| PointsEqual(CornerPositions[1], CornerPositions[2], ComparisonThreshold))
-			{
-				continue;
-			}
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					CornerNormal[CornerIndex] = FVector::ZeroVector;
+					CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, WedgeOffset + CornerIndex);
+					RelevantFacesForCorner[CornerIndex].Reset();
+				}
 
-			// No need to process triangles if tangents already exist.
-			bool bCornerHasNormal[3] = { 0 };
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				bCornerHasNormal[CornerIndex] = !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
-			}
-			if (bCornerHasNormal[0] && bCornerHasNormal[1] && bCornerHasNormal[2])
-			{
-				continue;
-			}
+				// Don't process degenerate triangles.
+				if (PointsEqual(CornerPositions[0], CornerPositions[1], ComparisonThreshold)
+					|| PointsEqual(CornerPositions[0], CornerPositions[2], ComparisonThreshold)
+					|| PointsEqual(CornerPositions[1], CornerPositions[2], ComparisonThreshold))
+				{
+					continue;
+				}
 
-			// Start building a list of faces adjacent to this face.
-			AdjacentFaces.Reset();
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				int32 ThisCornerIndex = WedgeOffset + CornerIndex;
-				DupVerts.Reset();
-				OverlappingCorners.MultiFind(ThisCornerIndex,DupVerts);
-				DupVerts.Add(ThisCornerIndex); // I am a "dup" of myself
-				for (int32 k = 0; k < DupVerts.Num(); k++)
+				// No need to process triangles if tangents already exist.
+				bool bCornerHasNormal[3] = { 0 };
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					AdjacentFaces.AddUnique(DupVerts[k] / 3);
+					bCornerHasNormal[CornerIndex] = !RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero();
+				}
+				if (bCornerHasNormal[0] && bCornerHasNormal[1] && bCornerHasNormal[2])
+				{
+					continue;
 				}
-			}
 
-			// We need to sort these here because the criteria for point equality is
-			// exact, so we must ensure the exact same order for all dups.
-			AdjacentFaces.Sort();
+				// Start building a list of faces adjacent to this face.
+				GatherAdjacentFaces(OverlappingCorners, FaceIndex, AdjacentFaces);
 
-			// Process adjacent faces
-			for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
-			{
-				int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
-				for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
+				// Process adjacent faces
+				for (int32 AdjacentFaceIndex = 0; AdjacentFaceIndex < AdjacentFaces.Num(); AdjacentFaceIndex++)
 				{
-					if (bCornerHasNormal[OurCornerIndex])
-						continue;
+					int32 OtherFaceIndex = AdjacentFaces[AdjacentFaceIndex];
+					for (int32 OurCornerIndex = 0; OurCornerIndex < 3; OurCornerIndex++)
+					{
+						if (bCornerHasNormal[OurCornerIndex])
+							continue;
 
-					FFanFace NewFanFace;
-					int32 CommonIndexCount = 0;
+						FFanFace NewFanFace;
+						int32 CommonIndexCount = 0;
 
-					// Check for vertices in common.
-					if (FaceIndex == OtherFaceIndex)
-					{
-						CommonIndexCount = 3;
-						NewFanFace.LinkedVertexIndex = OurCornerIndex;
-					}
-					else
-					{
-						// Check matching vertices against main vertex .
-						for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+						// Check for vertices in common.
+						if (FaceIndex == OtherFaceIndex)
 						{
-							if (PointsEqual(
-								CornerPositions[OurCornerIndex],
-								GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
-								ComparisonThreshold
-								))
+							CommonIndexCount = 3;
+							NewFanFace.LinkedVertexIndex = OurCornerIndex;
+						}
+						else
+						{
+							// Check matching vertices against main vertex .
+							for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
 							{
-								CommonIndexCount++;
-								NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+								if (PointsEqual(
+									CornerPositions[OurCornerIndex],
+									GetPositionForWedge(RawMesh, OtherFaceIndex * 3 + OtherCornerIndex),
+									ComparisonThreshold
+									))
+								{
+									CommonIndexCount++;
+									NewFanFace.LinkedVertexIndex = OtherCornerIndex;
+								}
 							}
 						}
-					}
 
-					// Add if connected by at least one point. Smoothing matches are considered later.
-					if (CommonIndexCount > 0)
-					{
-						NewFanFace.FaceIndex = OtherFaceIndex;
-						NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
-						NewFanFace.bBlendTangents = NewFanFace.bFilled;
-						NewFanFace.bBlendNormals = NewFanFace.bFilled;
-						RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+						// Add if connected by at least one point. Smoothing matches are considered later.
+						if (CommonIndexCount > 0)
+						{
+							NewFanFace.FaceIndex = OtherFaceIndex;
+							NewFanFace.bFilled = (OtherFaceIndex == FaceIndex); // Starter face for smoothing floodfill.
+							NewFanFace.bBlendTangents = NewFanFace.bFilled;
+							NewFanFace.bBlendNormals = NewFanFace.bFilled;
+							RelevantFacesForCorner[OurCornerIndex].Add(NewFanFace);
+						}
 					}
 				}
-			}
-
-			// Find true relevance of faces for a vertex normal by traversing
-			// smoothing-group-compatible connected triangle fans around common vertices.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				if (bCornerHasNormal[CornerIndex])
-					continue;
 
-				int32 NewConnections;
-				do
+				// Find true relevance of faces for a vertex normal by traversing
+				// smoothing-group-compatible connected triangle fans around common vertices.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					NewConnections = 0;
-					for (int32 OtherFaceIdx = 0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
+					if (bCornerHasNormal[CornerIndex])
+						continue;
+
+					int32 NewConnections;
+					do
 					{
-						FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
-						// The vertex' own face is initially the only face with bFilled == true.
-						if (OtherFace.bFilled)
+						NewConnections = 0;
+						for (int32 OtherFaceIdx = 0; OtherFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); OtherFaceIdx++)
 						{
-							for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
+							FFanFace& OtherFace = RelevantFacesForCorner[CornerIndex][OtherFaceIdx];
+							// The vertex' own face is initially the only face with bFilled == true.
+							if (OtherFace.bFilled)
 							{
-								FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
-								if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
+								for (int32 NextFaceIndex = 0; NextFaceIndex < RelevantFacesForCorner[CornerIndex].Num(); NextFaceIndex++)
 								{
-									if ((NextFaceIndex != OtherFaceIdx)
-										&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
+									FFanFace& NextFace = RelevantFacesForCorner[CornerIndex][NextFaceIndex];
+									if (!NextFace.bFilled) // && !NextFace.bBlendTangents)
 									{
-										int32 CommonVertices = 0;
-										int32 CommonNormalVertices = 0;
-										for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
+										if ((NextFaceIndex != OtherFaceIdx)
+											&& (RawMesh.FaceSmoothingMasks[NextFace.FaceIndex] & RawMesh.FaceSmoothingMasks[OtherFace.FaceIndex]))
 										{
-											for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
+											int32 CommonVertices = 0;
+											int32 CommonNormalVertices = 0;
+											for (int32 OtherCornerIndex = 0; OtherCornerIndex < 3; OtherCornerIndex++)
 											{
-												int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
-												int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
-												if (PointsEqual(
-													RawMesh.VertexPositions[NextVertexIndex],
-													RawMesh.VertexPositions[OtherVertexIndex],
-													ComparisonThreshold))
+												for (int32 NextCornerIndex = 0; NextCornerIndex < 3; NextCornerIndex++)
 												{
-													CommonVertices++;
-													if (bBlendOverlappingNormals
-														|| NextVertexIndex == OtherVertexIndex)
+													int32 NextVertexIndex = RawMesh.WedgeIndices[NextFace.FaceIndex * 3 + NextCornerIndex];
+													int32 OtherVertexIndex = RawMesh.WedgeIndices[OtherFace.FaceIndex * 3 + OtherCornerIndex];
+													if (PointsEqual(
+														RawMesh.VertexPositions[NextVertexIndex],
+														RawMesh.VertexPositions[OtherVertexIndex],
+														ComparisonThreshold))
 													{
-														CommonNormalVertices++;
+														CommonVertices++;
+														if (bBlendOverlappingNormals
+															|| NextVertexIndex == OtherVertexIndex)
+														{
+															CommonNormalVertices++;
+														}
 													}
 												}
 											}
-										}
-										// Flood fill faces with more than one common vertices which must be touching edges.
-										if (CommonVertices > 1)
-										{
-											NextFace.bFilled = true;
-											NextFace.bBlendNormals = (CommonNormalVertices > 1);
-											NewConnections++;
+											// Flood fill faces with more than one common vertices which must be touching edges.
+											if (CommonVertices > 1)
+											{
+												NextFace.bFilled = true;
+												NextFace.bBlendNormals = (CommonNormalVertices > 1);
+												NewConnections++;
+											}
 										}
 									}
 								}
 							}
 						}
 					}
+					while (NewConnections > 0);
 				}
-				while (NewConnections > 0);
-			}
 
 
-			// Vertex normal construction.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				if (bCornerHasNormal[CornerIndex])
-				{
-					CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
-				}
-				else
+				// Vertex normal construction.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
+					if (bCornerHasNormal[CornerIndex])
 					{
-						FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
-						if (RelevantFace.bFilled)
+						CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+					}
+					else
+					{
+						for (int32 RelevantFaceIdx = 0; RelevantFaceIdx < RelevantFacesForCorner[CornerIndex].Num(); RelevantFaceIdx++)
 						{
-							int32 OtherFaceIndex = RelevantFace.FaceIndex;
-							if (RelevantFace.bBlendNormals)
+							FFanFace const& RelevantFace = RelevantFacesForCorner[CornerIndex][RelevantFaceIdx];
+							if (RelevantFace.bFilled)
 							{
-								CornerNormal[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
+								int32 OtherFaceIndex = RelevantFace.FaceIndex;
+								if (RelevantFace.bBlendNormals)
+								{
+									CornerNormal[CornerIndex] += TriangleTangentZ[OtherFaceIndex];
+								}
 							}
 						}
-					}
-					if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
-					{
-						CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+						if (!RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex].IsZero())
+						{
+							CornerNormal[CornerIndex] = RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex];
+						}
 					}
 				}
-			}
 
-			// Normalization.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				CornerNormal[CornerIndex].Normalize();
-			}
+				// Normalization.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					CornerNormal[CornerIndex].Normalize();
+				}
 
-			// Copy back to the mesh.
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerNormal[CornerIndex];
+				// Copy back to the mesh.
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					RawMesh.WedgeTangentZ[WedgeOffset + CornerIndex] = CornerNormal[CornerIndex];
+				}
 			}
-		}
+		});
 	}
 
 	if (RawMesh.WedgeTangentX.Num() != NumWedges)
@@ -2524,12 +2856,11 @@ static float GetComparisonThreshold(FMeshBuildSettings const& BuildSettings)
 	Static mesh building.
 ------------------------------------------------------------------------------*/
 
-static FStaticMeshBuildVertex BuildStaticMeshVertex(FRawMesh const& RawMesh, int32 WedgeIndex, FVector BuildScale)
+static FStaticMeshBuildVertex BuildStaticMeshVertex(FRawMesh const& RawMesh, int32 WedgeIndex, FVector BuildScale, const FMatrix& ScaleMatrix)
 {
 	FStaticMeshBuildVertex Vertex;
 	Vertex.Position = GetPositionForWedge(RawMesh, WedgeIndex) * BuildScale;
 
-	const FMatrix ScaleMatrix = FScaleMatrix( BuildScale ).Inverse().GetTransposed();	
 	Vertex.TangentX = ScaleMatrix.TransformVector(RawMesh.WedgeTangentX[WedgeIndex]).GetSafeNormal();
 	Vertex.TangentY = ScaleMatrix.TransformVector(RawMesh.WedgeTangentY[WedgeIndex]).GetSafeNormal();
 	Vertex.TangentZ = ScaleMatrix.TransformVector(RawMesh.WedgeTangentZ[WedgeIndex]).GetSafeNormal();
@@ -2590,91 +2921,116 @@ static void BuildStaticMeshVertexAndIndexBuffers(
 	TArray<TArray<uint32> >& OutPerSectionIndices,
 	TArray<int32>& OutWedgeMap,
 	const FRawMesh& RawMesh,
-	const TMultiMap<int32,int32>& OverlappingCorners,
+	const FOverlappingCorners& OverlappingCorners,
 	float ComparisonThreshold,
 	FVector BuildScale
 	)
 {
-	TMap<int32,int32> FinalVerts;
-	TArray<int32> DupVerts;
-	int32 NumFaces = RawMesh.WedgeIndices.Num() / 3;
+	int32 NumWedges = RawMesh.WedgeIndices.Num();
+	int32 NumFaces = NumWedges / 3;
 
-	// Process each face, build vertex buffer and per-section index buffers.
-	for(int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
-	{
-		int32 VertexIndices[3];
-		FVector CornerPositions[3];
+	// Index of the vertex added for each wedge, INDEX_NONE if the wedge reused the vertex of an overlapping wedge.
+	TArray<int32> FinalVerts;
+	FinalVerts.Init(INDEX_NONE, NumWedges);
 
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, FaceIndex * 3 + CornerIndex);
-		}
+	const FMatrix ScaleMatrix = FScaleMatrix( BuildScale ).Inverse().GetTransposed();
 
-		// Don't process degenerate triangles.
-		if (PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold)
-			|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
-			|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
+	// The vertices of a batch of faces are built in parallel, then matched against the vertices already added in order.
+	const int32 FacesPerBatch = 16384;
+	TArray<FStaticMeshBuildVertex> BatchVertices;
+
+	for (int32 FirstBatchFace = 0; FirstBatchFace < NumFaces; FirstBatchFace += FacesPerBatch)
+	{
+		const int32 FirstBatchWedge = FirstBatchFace * 3;
+		const int32 NumBatchWedges = FMath::Min(FacesPerBatch, NumFaces - FirstBatchFace) * 3;
+		BatchVertices.Reset(NumBatchWedges);
+		BatchVertices.AddUninitialized(NumBatchWedges);
+
+		FMeshBuildRanges(NumBatchWedges).ProcessRanges([&](int32 RangeIndex, int32 FirstRangeWedge, int32 NumRangeWedges)
 		{
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			for (int32 Index = FirstRangeWedge; Index < FirstRangeWedge + NumRangeWedges; Index++)
 			{
-				OutWedgeMap.Add(INDEX_NONE);
+				BatchVertices[Index] = BuildStaticMeshVertex(RawMesh, FirstBatchWedge + Index, BuildScale, ScaleMatrix);
 			}
-			continue;
-		}
+		});
 
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+		// Process each face, build vertex buffer and per-section index buffers.
+		for (int32 FaceIndex = FirstBatchFace; FaceIndex < FirstBatchFace + NumBatchWedges / 3; FaceIndex++)
 		{
-			int32 WedgeIndex = FaceIndex * 3 + CornerIndex;
-			FStaticMeshBuildVertex ThisVertex = BuildStaticMeshVertex(RawMesh, WedgeIndex, BuildScale);
+			int32 VertexIndices[3];
+			FVector CornerPositions[3];
 
-			DupVerts.Reset();
-			OverlappingCorners.MultiFind(WedgeIndex,DupVerts);
-			DupVerts.Sort();
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				CornerPositions[CornerIndex] = GetPositionForWedge(RawMesh, FaceIndex * 3 + CornerIndex);
+			}
 
-			int32 Index = INDEX_NONE;
-			for (int32 k = 0; k < DupVerts.Num(); k++)
+			// Don't process degenerate triangles.
+			if (PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold)
+				|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
+				|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
 			{
-				if (DupVerts[k] >= WedgeIndex)
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 				{
-					// the verts beyond me haven't been placed yet, so these duplicates are not relevant
-					break;
+					OutWedgeMap.Add(INDEX_NONE);
 				}
+				continue;
+			}
 
-				int32 *Location = FinalVerts.Find(DupVerts[k]);
-				if (Location != NULL
-					&& AreVerticesEqual(ThisVertex, OutVertices[*Location], ComparisonThreshold))
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				int32 WedgeIndex = FaceIndex * 3 + CornerIndex;
+				const FStaticMeshBuildVertex& ThisVertex = BatchVertices[WedgeIndex - FirstBatchWedge];
+
+				// The overlapping corners are sorted.
+				const int32* DupVerts = OverlappingCorners.GetData(WedgeIndex);
+				const int32 NumDupVerts = OverlappingCorners.Num(WedgeIndex);
+
+				int32 Index = INDEX_NONE;
+				for (int32 k = 0; k < NumDupVerts; k++)
 				{
-					Index = *Location;
-					break;
+					if (DupVerts[k] >= WedgeIndex)
+					{
+						// the verts beyond me haven't been placed yet, so these duplicates are not relevant
+						break;
+					}
+
+					int32 Location = FinalVerts[DupVerts[k]];
+					if (Location != INDEX_NONE
+						&& AreVerticesEqual(ThisVertex, OutVertices[Location], ComparisonThreshold))
+					{
+						Index = Location;
+						break;
+					}
+				}
+				if (Index == INDEX_NONE)
+				{
+					Index = OutVertices.Add(ThisVertex);
+					FinalVerts[WedgeIndex] = Index;
 				}
+				VertexIndices[CornerIndex] = Index;
 			}
-			if (Index == INDEX_NONE)
+
+			// Reject degenerate triangles.
+			if (VertexIndices[0] == VertexIndices[1]
+				|| VertexIndices[1] == VertexIndices[2]
+				|| VertexIndices[0] == VertexIndices[2])
 			{
-				Index = OutVertices.Add(ThisVertex);
-				FinalVerts.Add(WedgeIndex,Index);
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					OutWedgeMap.Add(INDEX_NONE);
+				}
+				continue;
 			}
-			VertexIndices[CornerIndex] = Index;
-		}
 
-		// Reject degenerate triangles.
-		if (VertexIndices[0] == VertexIndices[1]
-			|| VertexIndices[1] == VertexIndices[2]
-			|| VertexIndices[0] == VertexIndices[2])
-		{
+			// Put the indices in the material index buffer.
+			int32 SectionIndex = FMath::Clamp(RawMesh.FaceMaterialIndices[FaceIndex], 0, OutPerSectionIndices.Num()-1);
+			TArray<uint32>& SectionIndices = OutPerSectionIndices[SectionIndex];
 			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
 			{
-				OutWedgeMap.Add(INDEX_NONE);
+				SectionIndices.Add(VertexIndices[CornerIndex]);
+				OutWedgeMap.Add(VertexIndices[CornerIndex]);
 			}
-			continue;
-		}
-
-		// Put the indices in the material index buffer.
-		int32 SectionIndex = FMath::Clamp(RawMesh.FaceMaterialIndices[FaceIndex], 0, OutPerSectionIndices.Num()-1);
-		TArray<uint32>& SectionIndices = OutPerSectionIndices[SectionIndex];
-		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-		{
-			SectionIndices.Add(VertexIndices[CornerIndex]);
-			OutWedgeMap.Add(VertexIndices[CornerIndex]);
 		}
 	}
 }
@@ -2757,7 +3113,7 @@ public:
 		{
 			FStaticMeshSourceModel& SrcModel = SourceModels[LODIndex];
 			FRawMesh& RawMesh = *new(LODMeshes)FRawMesh;
-			TMultiMap<int32, int32>& OverlappingCorners = *new(LODOverlappingCorners)TMultiMap<int32, int32>;
+			FOverlappingCorners& OverlappingCorners = *new(LODOverlappingCorners)FOverlappingCorners;
 
 			if (!SrcModel.RawMeshBulkData->IsEmpty())
 			{
@@ -2880,7 +3236,7 @@ public:
 			{
 				FRawMesh InMesh = LODMeshes[ReductionSettings.BaseLODModel];
 				FRawMesh& DestMesh = LODMeshes[NumValidLODs];
-				TMultiMap<int32, int32>& DestOverlappingCorners = LODOverlappingCorners[NumValidLODs];
+				FOverlappingCorners& DestOverlappingCorners = LODOverlappingCorners[NumValidLODs];
 
 				MeshReduction->Reduce(DestMesh, LODMaxDeviation[NumValidLODs], InMesh, ReductionSettings);
 				if (DestMesh.WedgeIndices.Num() > 0 && !DestMesh.IsValid())
@@ -3122,7 +3478,7 @@ private:
 	int32 NumValidLODs;
 
 	TIndirectArray<FRawMesh> LODMeshes;
-	TIndirectArray<TMultiMap<int32, int32> > LODOverlappingCorners;
+	TIndirectArray<FOverlappingCorners> LODOverlappingCorners;
 	float LODMaxDeviation[MAX_STATIC_MESH_LODS];
 	FMeshBuildSettings LODBuildSettings[MAX_STATIC_MESH_LODS];
 	bool HasRawMesh[MAX_STATIC_MESH_LODS];
@@ -3921,7 +4277,7 @@ bool FMeshUtilities::ConstructRawMesh(
 	OutRawMesh.WedgeTangentY.Empty(NumWedges);
 	OutRawMesh.WedgeTangentY.AddZeroed(NumWedges);
 
-	TMultiMap<int32,int32> OverlappingCorners;
+	FOverlappingCorners OverlappingCorners;
 	FindOverlappingCorners(OverlappingCorners, OutRawMesh, 0.1f);
 	ComputeTangents(OutRawMesh, OverlappingCorners, ETangentOptions::BlendOverlappingNormals);
 
@@ -0,0 +1,100 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/** Helper struct for building acceleration structures. */
+struct FIndexAndZ
+{
+	float Z;
+	int32 Index;
+
+	/** Default constructor. */
+	FIndexAndZ() {}
+
+	/** Initialization constructor. */
+	FIndexAndZ(int32 InIndex, FVector V)
+	{
+		Z = 0.30f * V.X + 0.33f * V.Y + 0.37f * V.Z;
+		Index = InIndex;
+	}
+};
+
+/** Sorting function for vertex Z/index pairs. */
+struct FCompareIndexAndZ
+{
+	FORCEINLINE bool operator()(FIndexAndZ const& A, FIndexAndZ const& B) const { return A.Z < B.Z; }
+};
+
+/**
+ * Maps each corner of a raw mesh to the corners at the same position, within a comparison threshold. The corners
+ * overlapping each corner are stored contiguously and in ascending order in a flat array, indexed by per corner offsets.
+ */
+class FOverlappingCorners
+{
+public:
+
+	FOverlappingCorners()
+	{
+		Reset();
+	}
+
+	/** Removes every corner. */
+	void Reset()
+	{
+		CornerOffsets.Reset();
+		CornerOffsets.Add(0);
+		OverlappingCorners.Reset();
+	}
+
+	/** @return the number of corners of the mesh */
+	int32 GetNumCorners() const
+	{
+		return CornerOffsets.Num() - 1;
+	}
+
+	/** @return the number of corners overlapping a corner, excluding itself */
+	int32 Num(int32 CornerIndex) const
+	{
+		return CornerOffsets[CornerIndex + 1] - CornerOffsets[CornerIndex];
+	}
+
+	/** @return the Num() corners overlapping a corner, in ascending order */
+	const int32* GetData(int32 CornerIndex) const
+	{
+		return OverlappingCorners.GetData() + CornerOffsets[CornerIndex];
+	}
+
+	/** Appends the corners overlapping a corner to an array, in ascending order. */
+	void MultiFind(int32 CornerIndex, TArray<int32>& OutCorners) const
+	{
+		OutCorners.Append(GetData(CornerIndex), Num(CornerIndex));
+	}
+
+	/**
+	 * Computes the order in which the Z sorted sweep the spatial hash replaced visited the corners. Code whose results
+	 * depend on the order overlapping corners are visited in, e.g. FLayoutUV::FindCharts, visits them by descending
+	 * rank to produce the same results as before.
+	 *
+	 * @param RawMesh		mesh the overlapping corners were found for
+	 * @param OutRanks		receives the rank of each corner
+	 */
+	static void ComputeSweepRanks(const FRawMesh& RawMesh, TArray<int32>& OutRanks);
+
+private:
+
+	friend void FindOverlappingCorners(FOverlappingCorners& OutOverlappingCorners, const FRawMesh& RawMesh, float ComparisonThreshold);
+
+	/** Offset of the overlapping corners of each corner, plus the total number at the end */
+	TArray<int32> CornerOffsets;
+	/** Overlapping corners of every corner */
+	TArray<int32> OverlappingCorners;
+};
+
+/**
+ * Finds the overlapping corners of a mesh with a spatial hash of its vertices.
+ *
+ * @param OutOverlappingCorners		receives the corners overlapping each corner of the mesh
+ * @param RawMesh					mesh to find the overlapping corners of
+ * @param ComparisonThreshold		corners closer than this on each axis overlap
+ */
+void FindOverlappingCorners(FOverlappingCorners& OutOverlappingCorners, const FRawMesh& RawMesh, float ComparisonThreshold);
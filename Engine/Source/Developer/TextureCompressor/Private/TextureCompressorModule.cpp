@@ -111,12 +111,14 @@ public:
 			// blur only
 			BuildGaussian1D(Table1D, TableSize1D, 1.0f, -SharpenFactor);
 			BuildFilterTable2DFrom1D(KernelWeights, Table1D, TableSize1D);
+			FMemory::Memcpy(KernelWeights1D, Table1D, TableSize1D * sizeof(float));
 			return;
 		}
 		else if(TableSize1D == 2)
 		{
 			// 2x2 kernel: simple average
 			KernelWeights[0] = KernelWeights[1] = KernelWeights[2] = KernelWeights[3] = 0.25f;
+			KernelWeights1D[0] = KernelWeights1D[1] = 0.5f;
 			return;
 		}
 		else if(TableSize1D == 4)
@@ -154,6 +156,7 @@ public:
 
 		AddFilterTable1D(Table1D, NegativeTable1D, TableSize1D);
 		BuildFilterTable2DFrom1D(KernelWeights, Table1D, TableSize1D);
+		FMemory::Memcpy(KernelWeights1D, Table1D, TableSize1D * sizeof(float));
 	}
 
 	inline uint32 GetFilterTableSize() const
@@ -175,6 +178,16 @@ public:
 		return KernelWeights[X + Y * FilterTableSize];
 	}
 
+	// the kernel is separable: GetAt(X, Y) == GetAt1D(X) * GetAt1D(Y)
+	inline float GetAt1D(uint32 X) const
+	{
+		checkSlow(X < FilterTableSize);
+		return KernelWeights1D[X];
+	}
+
+	// at max we support MaxKernelExtend x MaxKernelExtend kernels
+	const static uint32 MaxKernelExtend = 12;
+
 private:
 
 	inline static float NormalDistribution(float X, float Variance)
@@ -280,12 +293,12 @@ private:
 		}
 	}
 
-	// at max we support MaxKernelExtend x MaxKernelExtend kernels
-	const static uint32 MaxKernelExtend = 12;
 	// 0 if no kernel was setup yet
 	uint32 FilterTableSize;
 	// normalized, means the sum of it should be 1.0f
 	float KernelWeights[MaxKernelExtend * MaxKernelExtend];
+	// 1D table KernelWeights was built from, normalized as well
+	float KernelWeights1D[MaxKernelExtend];
 };
 
 
@@ -392,6 +405,381 @@ static void GenerateSharpenedMipB8G8R8A8Templ(
 	}
 }
 
+static TAutoConsoleVariable<int32> CVarMipGenSeparable(
+	TEXT("r.MipGen.Separable"),
+	1,
+	TEXT("0: generate mips with the reference filter, one texel at a time on the calling thread\n")
+	TEXT("1: generate mips with separable vectorized passes over rows, split across worker threads (default)"));
+
+static TAutoConsoleVariable<int32> CVarMipGenRowsPerTask(
+	TEXT("r.MipGen.RowsPerTask"),
+	16,
+	TEXT("Minimum number of mip rows filtered by one worker thread task, 0 to filter every row on the calling thread."));
+
+// source coordinate read by LookupSourceMip, INDEX_NONE if the lookup returns the black border
+static int32 ResolveSourceMipCoordinate(EMipGenAddressMode AddressMode, int32 X, int32 Size)
+{
+	if(AddressMode == MGTAM_Wrap)
+	{
+		return (int32)((uint32)X) & (Size - 1);
+	}
+	else if(AddressMode == MGTAM_Clamp)
+	{
+		return FMath::Clamp(X, 0, Size - 1);
+	}
+	return (uint32)X < (uint32)Size ? X : INDEX_NONE;
+}
+
+/**
+ * One axis of a separable kernel: the 1D weights and the source coordinates each destination coordinate applies them to.
+ */
+struct FMipFilterAxis
+{
+	/** Weights of the taps. */
+	float Weights[FImageKernel2D::MaxKernelExtend];
+	/** Number of taps. */
+	int32 NumTaps;
+	/** Offset of the first tap from DestCoordinate * ScaleFactor. */
+	int32 FirstTap;
+	/** 1 or 2, the source size over the destination size. */
+	int32 ScaleFactor;
+	/** NumTaps source coordinates per destination coordinate, with the address mode applied. */
+	TArray<int32> SourceCoordinates;
+
+	FMipFilterAxis()
+		: NumTaps(0)
+		, FirstTap(0)
+		, ScaleFactor(1)
+	{
+	}
+
+	void Init(const float* InWeights, int32 InNumTaps, int32 InFirstTap, int32 InScaleFactor, int32 DestSize, int32 SourceSize, EMipGenAddressMode AddressMode)
+	{
+		check(InNumTaps <= FImageKernel2D::MaxKernelExtend);
+
+		FMemory::Memcpy(Weights, InWeights, InNumTaps * sizeof(float));
+		NumTaps = InNumTaps;
+		FirstTap = InFirstTap;
+		ScaleFactor = InScaleFactor;
+
+		SourceCoordinates.Empty(DestSize * NumTaps);
+		for ( int32 DestCoordinate = 0; DestCoordinate < DestSize; ++DestCoordinate )
+		{
+			for ( int32 Tap = 0; Tap < NumTaps; ++Tap )
+			{
+				SourceCoordinates.Add(ResolveSourceMipCoordinate(AddressMode, DestCoordinate * ScaleFactor + FirstTap + Tap, SourceSize));
+			}
+		}
+	}
+};
+
+/**
+ * Source rows of a slice filtered horizontally, kept while the vertical taps of the next destination rows read them.
+ * The source row of Slot is the unresolved coordinate modulo the number of taps, so the taps of one destination row
+ * never evict each other.
+ */
+class FMipFilterRowCache
+{
+public:
+	FMipFilterRowCache(const FImageView2D& InSourceImageData, const FMipFilterAxis& InAxisX, const FMipFilterAxis& InAxisY, int32 InDestSizeX)
+		: SourceImageData(InSourceImageData)
+		, AxisX(InAxisX)
+		, AxisY(InAxisY)
+		, DestSizeX(InDestSizeX)
+	{
+		for ( int32 Slot = 0; Slot < AxisY.NumTaps; ++Slot )
+		{
+			CachedRows[Slot] = MIN_int32;
+		}
+	}
+
+	/** @return the source row read by a vertical tap of a destination row filtered horizontally, nullptr for the black border */
+	const FLinearColor* GetRow(int32 DestY, int32 Tap)
+	{
+		const int32 NumTaps = AxisY.NumTaps;
+		const int32 SourceY = AxisY.SourceCoordinates[DestY * NumTaps + Tap];
+		if ( SourceY == INDEX_NONE )
+		{
+			return nullptr;
+		}
+
+		const int32 UnresolvedY = DestY * AxisY.ScaleFactor + AxisY.FirstTap + Tap;
+		const int32 Slot = ((UnresolvedY % NumTaps) + NumTaps) % NumTaps;
+		TArray<FLinearColor>& Row = Rows[Slot];
+		if ( CachedRows[Slot] != UnresolvedY )
+		{
+			Row.SetNumUninitialized(DestSizeX);
+			FilterRow(&SourceImageData.Access(0, SourceY), Row.GetData());
+			CachedRows[Slot] = UnresolvedY;
+		}
+		return Row.GetData();
+	}
+
+private:
+
+	// horizontal pass, one texel per vector register
+	void FilterRow(const FLinearColor* SourceRow, FLinearColor* OutRow) const
+	{
+		const int32 NumTaps = AxisX.NumTaps;
+
+		VectorRegister Weights[FImageKernel2D::MaxKernelExtend];
+		for ( int32 Tap = 0; Tap < NumTaps; ++Tap )
+		{
+			Weights[Tap] = VectorSetFloat1(AxisX.Weights[Tap]);
+		}
+
+		const int32* SourceX = AxisX.SourceCoordinates.GetData();
+		for ( int32 DestX = 0; DestX < DestSizeX; ++DestX, SourceX += NumTaps )
+		{
+			VectorRegister Sum = VectorZero();
+			for ( int32 Tap = 0; Tap < NumTaps; ++Tap )
+			{
+				if ( SourceX[Tap] != INDEX_NONE )
+				{
+					Sum = VectorMultiplyAdd(VectorLoad(&SourceRow[SourceX[Tap]]), Weights[Tap], Sum);
+				}
+			}
+			VectorStore(Sum, &OutRow[DestX]);
+		}
+	}
+
+	const FImageView2D& SourceImageData;
+	const FMipFilterAxis& AxisX;
+	const FMipFilterAxis& AxisY;
+	int32 DestSizeX;
+	/** Unresolved source row held by each slot, MIN_int32 if none */
+	int32 CachedRows[FImageKernel2D::MaxKernelExtend];
+	TArray<FLinearColor> Rows[FImageKernel2D::MaxKernelExtend];
+};
+
+/**
+ * Generates a mip the same way as GenerateSharpenedMipB8G8R8A8Templ, applying the kernel as a horizontal pass over
+ * source rows followed by a vertical pass over destination rows. Ranges of destination rows are filtered independently,
+ * by the calling thread and by task graph workers.
+ */
+class FSeparableMipFilter
+{
+public:
+	FSeparableMipFilter(
+		const FImageView2D& InSourceImageData,
+		FImageView2D& InDestImageData,
+		EMipGenAddressMode AddressMode,
+		const FImageKernel2D& Kernel,
+		uint32 ScaleFactor,
+		bool bInSharpenWithoutColorShift )
+		: SourceImageData(InSourceImageData)
+		, DestImageData(InDestImageData)
+		, bSharpenWithoutColorShift(bInSharpenWithoutColorShift)
+	{
+		float KernelWeights[FImageKernel2D::MaxKernelExtend];
+		const int32 NumTaps = (int32)Kernel.GetFilterTableSize();
+		for ( int32 Tap = 0; Tap < NumTaps; ++Tap )
+		{
+			KernelWeights[Tap] = Kernel.GetAt1D(Tap);
+		}
+
+		const int32 KernelCenter = NumTaps / 2 - 1;
+		KernelX.Init(KernelWeights, NumTaps, -KernelCenter, ScaleFactor, DestImageData.SizeX, SourceImageData.SizeX, AddressMode);
+		KernelY.Init(KernelWeights, NumTaps, -KernelCenter, ScaleFactor, DestImageData.SizeY, SourceImageData.SizeY, AddressMode);
+
+		if ( bSharpenWithoutColorShift )
+		{
+			// simple 2x2 kernel to compute the color
+			const float AverageWeights[2] = { 0.5f, 0.5f };
+			AverageX.Init(AverageWeights, 2, 0, ScaleFactor, DestImageData.SizeX, SourceImageData.SizeX, AddressMode);
+			AverageY.Init(AverageWeights, 2, 0, ScaleFactor, DestImageData.SizeY, SourceImageData.SizeY, AddressMode);
+		}
+	}
+
+	void FilterRows(int32 FirstDestY, int32 NumDestY)
+	{
+		const int32 DestSizeX = DestImageData.SizeX;
+
+		FMipFilterRowCache KernelRows(SourceImageData, KernelX, KernelY, DestSizeX);
+		FMipFilterRowCache AverageRows(SourceImageData, AverageX, AverageY, DestSizeX);
+		TArray<FLinearColor> AverageColors;
+
+		for ( int32 DestY = FirstDestY; DestY < FirstDestY + NumDestY; ++DestY )
+		{
+			FLinearColor* DestRow = &DestImageData.Access(0, DestY);
+			FilterColumns(KernelRows, KernelY, DestY, DestRow);
+
+			if ( bSharpenWithoutColorShift )
+			{
+				AverageColors.SetNumUninitialized(DestSizeX);
+				FilterColumns(AverageRows, AverageY, DestY, AverageColors.GetData());
+
+				// the luminance is linear, the luminance of the filtered color is the filtered luminance
+				for ( int32 DestX = 0; DestX < DestSizeX; ++DestX )
+				{
+					const float NewLuminance = DestRow[DestX].ComputeLuminance();
+					FLinearColor FilteredColor = AverageColors[DestX];
+
+					float OldLuminance = FilteredColor.ComputeLuminance();
+
+					if ( OldLuminance > 0.001f )
+					{
+						float Factor = NewLuminance / OldLuminance;
+						FilteredColor.R *= Factor;
+						FilteredColor.G *= Factor;
+						FilteredColor.B *= Factor;
+					}
+
+					DestRow[DestX] = FilteredColor;
+				}
+			}
+		}
+	}
+
+private:
+
+	// vertical pass, one texel per vector register
+	void FilterColumns(FMipFilterRowCache& RowCache, const FMipFilterAxis& AxisY, int32 DestY, FLinearColor* OutRow)
+	{
+		const FLinearColor* Rows[FImageKernel2D::MaxKernelExtend];
+		VectorRegister Weights[FImageKernel2D::MaxKernelExtend];
+		int32 NumRows = 0;
+		for ( int32 Tap = 0; Tap < AxisY.NumTaps; ++Tap )
+		{
+			if ( const FLinearColor* Row = RowCache.GetRow(DestY, Tap) )
+			{
+				Rows[NumRows] = Row;
+				Weights[NumRows] = VectorSetFloat1(AxisY.Weights[Tap]);
+				++NumRows;
+			}
+		}
+
+		const int32 DestSizeX = DestImageData.SizeX;
+		for ( int32 DestX = 0; DestX < DestSizeX; ++DestX )
+		{
+			VectorRegister Sum = VectorZero();
+			for ( int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex )
+			{
+				Sum = VectorMultiplyAdd(VectorLoad(&Rows[RowIndex][DestX]), Weights[RowIndex], Sum);
+			}
+			VectorStore(Sum, &OutRow[DestX]);
+		}
+	}
+
+	const FImageView2D& SourceImageData;
+	FImageView2D& DestImageData;
+	bool bSharpenWithoutColorShift;
+	FMipFilterAxis KernelX;
+	FMipFilterAxis KernelY;
+	FMipFilterAxis AverageX;
+	FMipFilterAxis AverageY;
+};
+
+/**
+ * Task filtering a range of mip rows on a worker thread.
+ */
+class FSeparableMipFilterTask
+{
+	FSeparableMipFilter& Filter;
+	int32 FirstDestY;
+	int32 NumDestY;
+
+public:
+	FSeparableMipFilterTask(FSeparableMipFilter& InFilter, int32 InFirstDestY, int32 InNumDestY)
+		: Filter(InFilter)
+		, FirstDestY(InFirstDestY)
+		, NumDestY(InNumDestY)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSeparableMipFilterTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Filter.FilterRows(FirstDestY, NumDestY);
+	}
+};
+
+// Dithers the alpha of a mip after it was filtered, in the order GenerateSharpenedMipB8G8R8A8Templ draws the random numbers
+static void DitherMipAlpha(FImageView2D& DestImageData)
+{
+	// Set up a random number stream for dithering.
+	FRandomStream RandomStream(0);
+
+	// Dither the alpha of any pixel which passes an alpha threshold test, the threshold is truncated to 0 as in the reference filter.
+	const int32 AlphaThreshold = 5.0f / 255.0f;
+	const float MinRandomAlpha = 85.0f;
+	const float MaxRandomAlpha = 255.0f;
+
+	for ( int32 DestY = 0; DestY < DestImageData.SizeY; DestY++ )
+	{
+		for ( int32 DestX = 0; DestX < DestImageData.SizeX; DestX++ )
+		{
+			FLinearColor& DestColor = DestImageData.Access(DestX, DestY);
+			if ( DestColor.A > AlphaThreshold )
+			{
+				DestColor.A = FMath::TruncToInt( FMath::Lerp( MinRandomAlpha, MaxRandomAlpha, RandomStream.GetFraction() ) );
+			}
+		}
+	}
+}
+
+static void GenerateSeparableMip(
+	const FImageView2D& SourceImageData, 
+	FImageView2D& DestImageData, 
+	EMipGenAddressMode AddressMode, 
+	bool bDitherMipMapAlpha,
+	const FImageKernel2D &Kernel,
+	uint32 ScaleFactor,
+	bool bSharpenWithoutColorShift
+	)
+{
+	check( SourceImageData.SizeX == ScaleFactor * DestImageData.SizeX || DestImageData.SizeX == 1 );
+	check( SourceImageData.SizeY == ScaleFactor * DestImageData.SizeY || DestImageData.SizeY == 1 );
+	check( Kernel.GetFilterTableSize() >= 2 );
+
+	FSeparableMipFilter Filter(SourceImageData, DestImageData, AddressMode, Kernel, ScaleFactor, bSharpenWithoutColorShift);
+
+	const int32 NumDestY = DestImageData.SizeY;
+	const int32 RowsPerTask = CVarMipGenRowsPerTask.GetValueOnAnyThread();
+
+	int32 NumTasks = 1;
+	if ( RowsPerTask > 0 && NumDestY > RowsPerTask && FApp::ShouldUseThreadingForPerformance() )
+	{
+		NumTasks = FMath::Min(FMath::DivideAndRoundUp(NumDestY, RowsPerTask), FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	}
+
+	if ( NumTasks > 1 )
+	{
+		// The calling thread filters the first range
+		const int32 RowsPerRange = FMath::DivideAndRoundUp(NumDestY, NumTasks);
+		FGraphEventArray Tasks;
+		for ( int32 FirstDestY = RowsPerRange; FirstDestY < NumDestY; FirstDestY += RowsPerRange )
+		{
+			Tasks.Add(TGraphTask<FSeparableMipFilterTask>::CreateTask().ConstructAndDispatchWhenReady(Filter, FirstDestY, FMath::Min(RowsPerRange, NumDestY - FirstDestY)));
+		}
+		Filter.FilterRows(0, FMath::Min(RowsPerRange, NumDestY));
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks);
+	}
+	else
+	{
+		Filter.FilterRows(0, NumDestY);
+	}
+
+	if ( bDitherMipMapAlpha )
+	{
+		DitherMipAlpha(DestImageData);
+	}
+}
+
 // to switch conveniently between different texture wrapping modes for the mip map generation
 // the template can optimize the inner loop using a constant AddressMode
 static void GenerateSharpenedMipB8G8R8A8(
@@ -404,6 +792,12 @@ static void GenerateSharpenedMipB8G8R8A8(
 	bool bSharpenWithoutColorShift
 	)
 {
+	if ( CVarMipGenSeparable.GetValueOnAnyThread() != 0 )
+	{
+		GenerateSeparableMip(SourceImageData, DestImageData, AddressMode, bDitherMipMapAlpha, Kernel, ScaleFactor, bSharpenWithoutColorShift);
+		return;
+	}
+
 	switch(AddressMode)
 	{
 	case MGTAM_Wrap:
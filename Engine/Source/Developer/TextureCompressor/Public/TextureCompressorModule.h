@@ -125,6 +125,8 @@ struct FTextureBuildSettings
 	FColor ChromaKeyColor;
 	/** The threshold that components have to match for the texel to be considered equal to the ChromaKeyColor when chroma keying (<=, set to 0 to require a perfect exact match) */
 	float ChromaKeyThreshold;
+	/** Whether the texture is only built to be displayed in the editor, never for a cook or another target platform. Texture formats may then trade quality for build speed. */
+	uint32 bFastEditorPreview : 1;
 
 	/** Default settings. */
 	FTextureBuildSettings()
@@ -157,6 +159,7 @@ struct FTextureBuildSettings
 		, PaddingColor(FColor::Black)
 		, ChromaKeyColor(FColorList::Magenta)
 		, ChromaKeyThreshold(1.0f / 255.0f)
+		, bFastEditorPreview(false)
 	{
 	}
 };
@@ -0,0 +1,561 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	FastDXTEncoder.cpp: Built-in BC1/BC3/BC4/BC5 encoder for iteration builds.
+=============================================================================*/
+
+#include "Core.h"
+#include "PixelFormat.h"
+#include "FastDXTEncoder.h"
+
+namespace FastDXT
+{
+	/** Texels of a block, planar with four texels per vector register, in 0-255 units */
+	struct FColorBlock
+	{
+		VectorRegister R[4];
+		VectorRegister G[4];
+		VectorRegister B[4];
+		float Colors[16][3];
+	};
+
+	/** Weight of the first endpoint for each index of a four color BC1 block */
+	static const float ColorIndexWeights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+	static uint16 QuantizeTo565(const float Color[3])
+	{
+		const int32 R = FMath::Clamp(FMath::RoundToInt(Color[0] * (31.0f / 255.0f)), 0, 31);
+		const int32 G = FMath::Clamp(FMath::RoundToInt(Color[1] * (63.0f / 255.0f)), 0, 63);
+		const int32 B = FMath::Clamp(FMath::RoundToInt(Color[2] * (31.0f / 255.0f)), 0, 31);
+		return (uint16)((R << 11) | (G << 5) | B);
+	}
+
+	static void Expand565(uint16 Color, int32 OutColor[3])
+	{
+		const int32 R = (Color >> 11) & 31;
+		const int32 G = (Color >> 5) & 63;
+		const int32 B = Color & 31;
+		OutColor[0] = (R << 3) | (R >> 2);
+		OutColor[1] = (G << 2) | (G >> 4);
+		OutColor[2] = (B << 3) | (B >> 2);
+	}
+
+	/** Builds the palette of a four color block */
+	static void BuildColorPalette(uint16 Color0, uint16 Color1, float OutPalette[4][3])
+	{
+		int32 Endpoint0[3];
+		int32 Endpoint1[3];
+		Expand565(Color0, Endpoint0);
+		Expand565(Color1, Endpoint1);
+		for (int32 Channel = 0; Channel < 3; ++Channel)
+		{
+			for (int32 Entry = 0; Entry < 4; ++Entry)
+			{
+				const float Weight = ColorIndexWeights[Entry];
+				OutPalette[Entry][Channel] = Weight * Endpoint0[Channel] + (1.0f - Weight) * Endpoint1[Channel];
+			}
+		}
+	}
+
+	/**
+	 * Matches each texel to the closest entry of a palette.
+	 *
+	 * @return the sum of the squared errors
+	 */
+	static float MatchColorPalette(const FColorBlock& Block, const float Palette[4][3], uint8 OutIndices[16])
+	{
+		VectorRegister PaletteR[4];
+		VectorRegister PaletteG[4];
+		VectorRegister PaletteB[4];
+		VectorRegister Entries[4];
+		for (int32 Entry = 0; Entry < 4; ++Entry)
+		{
+			PaletteR[Entry] = VectorSetFloat1(Palette[Entry][0]);
+			PaletteG[Entry] = VectorSetFloat1(Palette[Entry][1]);
+			PaletteB[Entry] = VectorSetFloat1(Palette[Entry][2]);
+			Entries[Entry] = VectorSetFloat1((float)Entry);
+		}
+
+		VectorRegister TotalError = VectorZero();
+		for (int32 Quad = 0; Quad < 4; ++Quad)
+		{
+			VectorRegister BestError = VectorSetFloat1(MAX_flt);
+			VectorRegister BestEntry = VectorZero();
+			for (int32 Entry = 0; Entry < 4; ++Entry)
+			{
+				const VectorRegister DeltaR = VectorSubtract(Block.R[Quad], PaletteR[Entry]);
+				const VectorRegister DeltaG = VectorSubtract(Block.G[Quad], PaletteG[Entry]);
+				const VectorRegister DeltaB = VectorSubtract(Block.B[Quad], PaletteB[Entry]);
+				const VectorRegister Error = VectorMultiplyAdd(DeltaB, DeltaB, VectorMultiplyAdd(DeltaG, DeltaG, VectorMultiply(DeltaR, DeltaR)));
+				const VectorRegister Closer = VectorCompareGT(BestError, Error);
+				BestError = VectorSelect(Closer, Error, BestError);
+				BestEntry = VectorSelect(Closer, Entries[Entry], BestEntry);
+			}
+			TotalError = VectorAdd(TotalError, BestError);
+
+			float QuadEntries[4];
+			VectorStore(BestEntry, QuadEntries);
+			for (int32 Texel = 0; Texel < 4; ++Texel)
+			{
+				OutIndices[Quad * 4 + Texel] = (uint8)QuadEntries[Texel];
+			}
+		}
+
+		float Errors[4];
+		VectorStore(TotalError, Errors);
+		return Errors[0] + Errors[1] + Errors[2] + Errors[3];
+	}
+
+	/** Finds the texels at the extents of the principal axis of the block */
+	static void FitPrincipalAxis(const FColorBlock& Block, float OutEndpoint0[3], float OutEndpoint1[3])
+	{
+		float Mean[3] = { 0.0f, 0.0f, 0.0f };
+		float Min[3] = { 255.0f, 255.0f, 255.0f };
+		float Max[3] = { 0.0f, 0.0f, 0.0f };
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			for (int32 Channel = 0; Channel < 3; ++Channel)
+			{
+				const float Value = Block.Colors[Texel][Channel];
+				Mean[Channel] += Value;
+				Min[Channel] = FMath::Min(Min[Channel], Value);
+				Max[Channel] = FMath::Max(Max[Channel], Value);
+			}
+		}
+		for (int32 Channel = 0; Channel < 3; ++Channel)
+		{
+			Mean[Channel] /= 16.0f;
+		}
+
+		// Covariance XX, XY, XZ, YY, YZ, ZZ
+		float Covariance[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			const float X = Block.Colors[Texel][0] - Mean[0];
+			const float Y = Block.Colors[Texel][1] - Mean[1];
+			const float Z = Block.Colors[Texel][2] - Mean[2];
+			Covariance[0] += X * X;
+			Covariance[1] += X * Y;
+			Covariance[2] += X * Z;
+			Covariance[3] += Y * Y;
+			Covariance[4] += Y * Z;
+			Covariance[5] += Z * Z;
+		}
+
+		// Power iteration, starting from the diagonal of the bounding box
+		float Axis[3] = { Max[0] - Min[0], Max[1] - Min[1], Max[2] - Min[2] };
+		for (int32 Iteration = 0; Iteration < 4; ++Iteration)
+		{
+			const float X = Axis[0] * Covariance[0] + Axis[1] * Covariance[1] + Axis[2] * Covariance[2];
+			const float Y = Axis[0] * Covariance[1] + Axis[1] * Covariance[3] + Axis[2] * Covariance[4];
+			const float Z = Axis[0] * Covariance[2] + Axis[1] * Covariance[4] + Axis[2] * Covariance[5];
+			const float Largest = FMath::Max3(FMath::Abs(X), FMath::Abs(Y), FMath::Abs(Z));
+			if (Largest < KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+			Axis[0] = X / Largest;
+			Axis[1] = Y / Largest;
+			Axis[2] = Z / Largest;
+		}
+
+		int32 MinTexel = 0;
+		int32 MaxTexel = 0;
+		float MinProjection = MAX_flt;
+		float MaxProjection = -MAX_flt;
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			const float Projection = Block.Colors[Texel][0] * Axis[0] + Block.Colors[Texel][1] * Axis[1] + Block.Colors[Texel][2] * Axis[2];
+			if (Projection < MinProjection)
+			{
+				MinProjection = Projection;
+				MinTexel = Texel;
+			}
+			if (Projection > MaxProjection)
+			{
+				MaxProjection = Projection;
+				MaxTexel = Texel;
+			}
+		}
+
+		FMemory::Memcpy(OutEndpoint0, Block.Colors[MaxTexel], sizeof(float) * 3);
+		FMemory::Memcpy(OutEndpoint1, Block.Colors[MinTexel], sizeof(float) * 3);
+	}
+
+	/**
+	 * Solves for the endpoints minimizing the squared error of the texels with their indices.
+	 *
+	 * @return false if the indices don't determine the endpoints, e.g. when they all select the same endpoint
+	 */
+	static bool RefineEndpoints(const FColorBlock& Block, const uint8 Indices[16], float OutEndpoint0[3], float OutEndpoint1[3])
+	{
+		float AlphaAlpha = 0.0f;
+		float AlphaBeta = 0.0f;
+		float BetaBeta = 0.0f;
+		float AlphaColor[3] = { 0.0f, 0.0f, 0.0f };
+		float BetaColor[3] = { 0.0f, 0.0f, 0.0f };
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			const float Alpha = ColorIndexWeights[Indices[Texel]];
+			const float Beta = 1.0f - Alpha;
+			AlphaAlpha += Alpha * Alpha;
+			AlphaBeta += Alpha * Beta;
+			BetaBeta += Beta * Beta;
+			for (int32 Channel = 0; Channel < 3; ++Channel)
+			{
+				AlphaColor[Channel] += Alpha * Block.Colors[Texel][Channel];
+				BetaColor[Channel] += Beta * Block.Colors[Texel][Channel];
+			}
+		}
+
+		const float Determinant = AlphaAlpha * BetaBeta - AlphaBeta * AlphaBeta;
+		if (FMath::Abs(Determinant) < KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+
+		const float InvDeterminant = 1.0f / Determinant;
+		for (int32 Channel = 0; Channel < 3; ++Channel)
+		{
+			OutEndpoint0[Channel] = FMath::Clamp((AlphaColor[Channel] * BetaBeta - BetaColor[Channel] * AlphaBeta) * InvDeterminant, 0.0f, 255.0f);
+			OutEndpoint1[Channel] = FMath::Clamp((BetaColor[Channel] * AlphaAlpha - AlphaColor[Channel] * AlphaBeta) * InvDeterminant, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	static void WriteColorBlock(uint16 Color0, uint16 Color1, const uint8 Indices[16], uint8* OutBlock)
+	{
+		uint32 IndexBits = 0;
+		if (Color0 != Color1)
+		{
+			// Color0 > Color1 selects the four color mode, swapping the endpoints swaps the indices 0/1 and 2/3
+			const uint8 IndexFlip = Color0 < Color1 ? 1 : 0;
+			if (IndexFlip)
+			{
+				Swap(Color0, Color1);
+			}
+			for (int32 Texel = 0; Texel < 16; ++Texel)
+			{
+				IndexBits |= (uint32)(Indices[Texel] ^ IndexFlip) << (Texel * 2);
+			}
+		}
+
+		OutBlock[0] = (uint8)Color0;
+		OutBlock[1] = (uint8)(Color0 >> 8);
+		OutBlock[2] = (uint8)Color1;
+		OutBlock[3] = (uint8)(Color1 >> 8);
+		OutBlock[4] = (uint8)IndexBits;
+		OutBlock[5] = (uint8)(IndexBits >> 8);
+		OutBlock[6] = (uint8)(IndexBits >> 16);
+		OutBlock[7] = (uint8)(IndexBits >> 24);
+	}
+
+	/** Compresses the RGB of a block to a four color BC1 block */
+	static void CompressColorBlock(const FColor Texels[16], uint8* OutBlock)
+	{
+		FColorBlock Block;
+		bool bSolid = true;
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			Block.Colors[Texel][0] = Texels[Texel].R;
+			Block.Colors[Texel][1] = Texels[Texel].G;
+			Block.Colors[Texel][2] = Texels[Texel].B;
+			bSolid = bSolid && Texels[Texel].R == Texels[0].R && Texels[Texel].G == Texels[0].G && Texels[Texel].B == Texels[0].B;
+		}
+
+		uint8 Indices[16] = { 0 };
+		if (bSolid)
+		{
+			const uint16 Color = QuantizeTo565(Block.Colors[0]);
+			WriteColorBlock(Color, Color, Indices, OutBlock);
+			return;
+		}
+
+		for (int32 Quad = 0; Quad < 4; ++Quad)
+		{
+			const float* Colors = Block.Colors[Quad * 4];
+			Block.R[Quad] = VectorSet(Colors[0], Colors[3], Colors[6], Colors[9]);
+			Block.G[Quad] = VectorSet(Colors[1], Colors[4], Colors[7], Colors[10]);
+			Block.B[Quad] = VectorSet(Colors[2], Colors[5], Colors[8], Colors[11]);
+		}
+
+		float Endpoint0[3];
+		float Endpoint1[3];
+		FitPrincipalAxis(Block, Endpoint0, Endpoint1);
+
+		uint16 Color0 = QuantizeTo565(Endpoint0);
+		uint16 Color1 = QuantizeTo565(Endpoint1);
+		float Palette[4][3];
+		BuildColorPalette(Color0, Color1, Palette);
+		float Error = MatchColorPalette(Block, Palette, Indices);
+
+		if (RefineEndpoints(Block, Indices, Endpoint0, Endpoint1))
+		{
+			const uint16 RefinedColor0 = QuantizeTo565(Endpoint0);
+			const uint16 RefinedColor1 = QuantizeTo565(Endpoint1);
+			if (RefinedColor0 != Color0 || RefinedColor1 != Color1)
+			{
+				uint8 RefinedIndices[16];
+				BuildColorPalette(RefinedColor0, RefinedColor1, Palette);
+				const float RefinedError = MatchColorPalette(Block, Palette, RefinedIndices);
+				if (RefinedError < Error)
+				{
+					Color0 = RefinedColor0;
+					Color1 = RefinedColor1;
+					FMemory::Memcpy(Indices, RefinedIndices, sizeof(Indices));
+				}
+			}
+		}
+
+		WriteColorBlock(Color0, Color1, Indices, OutBlock);
+	}
+
+	/** Compresses one channel of a block to an eight value BC4 block */
+	static void CompressChannelBlock(const uint8 Values[16], uint8* OutBlock)
+	{
+		uint8 Min = Values[0];
+		uint8 Max = Values[0];
+		for (int32 Texel = 1; Texel < 16; ++Texel)
+		{
+			Min = FMath::Min(Min, Values[Texel]);
+			Max = FMath::Max(Max, Values[Texel]);
+		}
+
+		uint64 IndexBits = 0;
+		if (Max > Min)
+		{
+			// Index 0 is Max, 1 is Min and 2-7 step from Max to Min in sevenths
+			const float Scale = 7.0f / (Max - Min);
+			for (int32 Texel = 0; Texel < 16; ++Texel)
+			{
+				const int32 Step = FMath::RoundToInt((Values[Texel] - Min) * Scale);
+				const uint64 Index = Step == 7 ? 0 : (Step == 0 ? 1 : 8 - Step);
+				IndexBits |= Index << (Texel * 3);
+			}
+		}
+
+		OutBlock[0] = Max;
+		OutBlock[1] = Min;
+		for (int32 Byte = 0; Byte < 6; ++Byte)
+		{
+			OutBlock[2 + Byte] = (uint8)(IndexBits >> (Byte * 8));
+		}
+	}
+
+	static FColor MakeColor(int32 R, int32 G, int32 B)
+	{
+		return FColor((uint8)R, (uint8)G, (uint8)B);
+	}
+
+	static void DecompressColorBlock(const uint8* Block, FColor OutTexels[16])
+	{
+		const uint16 Color0 = Block[0] | (Block[1] << 8);
+		const uint16 Color1 = Block[2] | (Block[3] << 8);
+		int32 Endpoint0[3];
+		int32 Endpoint1[3];
+		Expand565(Color0, Endpoint0);
+		Expand565(Color1, Endpoint1);
+
+		FColor Palette[4];
+		Palette[0] = MakeColor(Endpoint0[0], Endpoint0[1], Endpoint0[2]);
+		Palette[1] = MakeColor(Endpoint1[0], Endpoint1[1], Endpoint1[2]);
+		if (Color0 > Color1)
+		{
+			Palette[2] = MakeColor((2 * Endpoint0[0] + Endpoint1[0]) / 3, (2 * Endpoint0[1] + Endpoint1[1]) / 3, (2 * Endpoint0[2] + Endpoint1[2]) / 3);
+			Palette[3] = MakeColor((Endpoint0[0] + 2 * Endpoint1[0]) / 3, (Endpoint0[1] + 2 * Endpoint1[1]) / 3, (Endpoint0[2] + 2 * Endpoint1[2]) / 3);
+		}
+		else
+		{
+			Palette[2] = MakeColor((Endpoint0[0] + Endpoint1[0]) / 2, (Endpoint0[1] + Endpoint1[1]) / 2, (Endpoint0[2] + Endpoint1[2]) / 2);
+			Palette[3] = MakeColor(0, 0, 0);
+		}
+
+		const uint32 IndexBits = Block[4] | (Block[5] << 8) | (Block[6] << 16) | ((uint32)Block[7] << 24);
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			OutTexels[Texel] = Palette[(IndexBits >> (Texel * 2)) & 3];
+		}
+	}
+
+	static void DecompressChannelBlock(const uint8* Block, uint8 OutValues[16])
+	{
+		const int32 Value0 = Block[0];
+		const int32 Value1 = Block[1];
+		uint8 Palette[8];
+		Palette[0] = Block[0];
+		Palette[1] = Block[1];
+		if (Value0 > Value1)
+		{
+			for (int32 Index = 2; Index < 8; ++Index)
+			{
+				Palette[Index] = (uint8)(((8 - Index) * Value0 + (Index - 1) * Value1 + 3) / 7);
+			}
+		}
+		else
+		{
+			for (int32 Index = 2; Index < 6; ++Index)
+			{
+				Palette[Index] = (uint8)(((6 - Index) * Value0 + (Index - 1) * Value1 + 2) / 5);
+			}
+			Palette[6] = 0;
+			Palette[7] = 255;
+		}
+
+		uint64 IndexBits = 0;
+		for (int32 Byte = 0; Byte < 6; ++Byte)
+		{
+			IndexBits |= (uint64)Block[2 + Byte] << (Byte * 8);
+		}
+		for (int32 Texel = 0; Texel < 16; ++Texel)
+		{
+			OutValues[Texel] = Palette[(IndexBits >> (Texel * 3)) & 7];
+		}
+	}
+}
+
+bool FFastDXTEncoder::SupportsFormat(EPixelFormat PixelFormat)
+{
+	return PixelFormat == PF_DXT1 || PixelFormat == PF_DXT5 || PixelFormat == PF_BC4 || PixelFormat == PF_BC5;
+}
+
+int32 FFastDXTEncoder::GetBlockBytes(EPixelFormat PixelFormat)
+{
+	return (PixelFormat == PF_DXT1 || PixelFormat == PF_BC4) ? 8 : 16;
+}
+
+void FFastDXTEncoder::CompressBlockRows(const FColor* SourceData, int32 SizeX, int32 SizeY, EPixelFormat PixelFormat, int32 FirstBlockRow, int32 NumBlockRows, uint8* OutBlocks)
+{
+	check(SupportsFormat(PixelFormat));
+
+	const int32 ImageBlocksX = FMath::Max(SizeX / 4, 1);
+	const int32 BlockBytes = GetBlockBytes(PixelFormat);
+
+	FColor Texels[16];
+	uint8 Values[16];
+	uint8* Block = OutBlocks;
+	for (int32 BlockY = FirstBlockRow; BlockY < FirstBlockRow + NumBlockRows; ++BlockY)
+	{
+		for (int32 BlockX = 0; BlockX < ImageBlocksX; ++BlockX)
+		{
+			for (int32 Y = 0; Y < 4; ++Y)
+			{
+				const FColor* SourceRow = SourceData + FMath::Min(BlockY * 4 + Y, SizeY - 1) * SizeX;
+				for (int32 X = 0; X < 4; ++X)
+				{
+					Texels[Y * 4 + X] = SourceRow[FMath::Min(BlockX * 4 + X, SizeX - 1)];
+				}
+			}
+
+			switch (PixelFormat)
+			{
+			case PF_DXT1:
+				FastDXT::CompressColorBlock(Texels, Block);
+				break;
+
+			case PF_DXT5:
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Values[Texel] = Texels[Texel].A;
+				}
+				FastDXT::CompressChannelBlock(Values, Block);
+				FastDXT::CompressColorBlock(Texels, Block + 8);
+				break;
+
+			case PF_BC4:
+				// Like NVTT, BC4 stores the alpha channel. TC_Alpha textures replicate red to every channel before compression.
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Values[Texel] = Texels[Texel].A;
+				}
+				FastDXT::CompressChannelBlock(Values, Block);
+				break;
+
+			case PF_BC5:
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Values[Texel] = Texels[Texel].R;
+				}
+				FastDXT::CompressChannelBlock(Values, Block);
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Values[Texel] = Texels[Texel].G;
+				}
+				FastDXT::CompressChannelBlock(Values, Block + 8);
+				break;
+
+			default:
+				break;
+			}
+
+			Block += BlockBytes;
+		}
+	}
+}
+
+void FFastDXTEncoder::Decompress(const uint8* Blocks, EPixelFormat PixelFormat, int32 SizeX, int32 SizeY, FColor* OutColors)
+{
+	check(SupportsFormat(PixelFormat));
+
+	const int32 ImageBlocksX = FMath::Max(SizeX / 4, 1);
+	const int32 ImageBlocksY = FMath::Max(SizeY / 4, 1);
+	const int32 BlockBytes = GetBlockBytes(PixelFormat);
+
+	FColor Texels[16];
+	uint8 Values[16];
+	const uint8* Block = Blocks;
+	for (int32 BlockY = 0; BlockY < ImageBlocksY; ++BlockY)
+	{
+		for (int32 BlockX = 0; BlockX < ImageBlocksX; ++BlockX)
+		{
+			switch (PixelFormat)
+			{
+			case PF_DXT1:
+				FastDXT::DecompressColorBlock(Block, Texels);
+				break;
+
+			case PF_DXT5:
+				FastDXT::DecompressColorBlock(Block + 8, Texels);
+				FastDXT::DecompressChannelBlock(Block, Values);
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Texels[Texel].A = Values[Texel];
+				}
+				break;
+
+			case PF_BC4:
+				FastDXT::DecompressChannelBlock(Block, Values);
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Texels[Texel] = FColor(Values[Texel], 0, 0);
+				}
+				break;
+
+			case PF_BC5:
+				FastDXT::DecompressChannelBlock(Block, Values);
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Texels[Texel] = FColor(Values[Texel], 0, 0);
+				}
+				FastDXT::DecompressChannelBlock(Block + 8, Values);
+				for (int32 Texel = 0; Texel < 16; ++Texel)
+				{
+					Texels[Texel].G = Values[Texel];
+				}
+				break;
+
+			default:
+				break;
+			}
+
+			for (int32 Y = 0; Y < 4 && BlockY * 4 + Y < SizeY; ++Y)
+			{
+				for (int32 X = 0; X < 4 && BlockX * 4 + X < SizeX; ++X)
+				{
+					OutColors[(BlockY * 4 + Y) * SizeX + BlockX * 4 + X] = Texels[Y * 4 + X];
+				}
+			}
+
+			Block += BlockBytes;
+		}
+	}
+}
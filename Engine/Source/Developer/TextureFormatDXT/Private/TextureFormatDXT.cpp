@@ -9,6 +9,8 @@
 #include "PixelFormat.h"
 #include "nvtt/nvtt.h"
 #include "IConsoleManager.h"
+#include "ImageWrapper.h"
+#include "FastDXTEncoder.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTextureFormatDXT, Log, All);
 
@@ -270,6 +272,98 @@ namespace CompressionSettings
 		);
 }
 
+/**
+ * Asynchronous fast encoder worker, compressing a batch of block rows.
+ */
+class FAsyncFastDXTWorker : public FNonAbandonableTask
+{
+public:
+	/**
+	 * Initializes the data and creates the async compression task.
+	 */
+	FAsyncFastDXTWorker(const FColor* InSourceData, EPixelFormat InPixelFormat, int32 InSizeX, int32 InSizeY, int32 InFirstBlockRow, int32 InNumBlockRows, uint8* InOutBlocks)
+		: SourceData(InSourceData)
+		, PixelFormat(InPixelFormat)
+		, SizeX(InSizeX)
+		, SizeY(InSizeY)
+		, FirstBlockRow(InFirstBlockRow)
+		, NumBlockRows(InNumBlockRows)
+		, OutBlocks(InOutBlocks)
+	{
+	}
+
+	/** Compresses the block rows. */
+	void DoWork()
+	{
+		FFastDXTEncoder::CompressBlockRows(SourceData, SizeX, SizeY, PixelFormat, FirstBlockRow, NumBlockRows, OutBlocks);
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FAsyncFastDXTWorker, STATGROUP_ThreadPoolAsyncTasks);
+	}
+
+private:
+	const FColor* SourceData;
+	EPixelFormat PixelFormat;
+	int32 SizeX;
+	int32 SizeY;
+	int32 FirstBlockRow;
+	int32 NumBlockRows;
+	uint8* OutBlocks;
+};
+typedef FAsyncTask<FAsyncFastDXTWorker> FAsyncFastDXTTask;
+
+/**
+ * Compresses an image using the built-in fast encoder, in batches of block rows.
+ * @param SourceData			Source texture data to DXT compress, in BGRA 8bit per channel unsigned format.
+ * @param PixelFormat			Texture format, PF_DXT1, PF_DXT5, PF_BC4 or PF_BC5
+ * @param SizeX					Number of texels along the X-axis
+ * @param SizeY					Number of texels along the Y-axis
+ * @param OutCompressedData		Compressed image data.
+ */
+static bool CompressImageUsingFastEncoder(
+	const void* SourceData,
+	EPixelFormat PixelFormat,
+	int32 SizeX,
+	int32 SizeY,
+	TArray<uint8>& OutCompressedData
+	)
+{
+	check(FFastDXTEncoder::SupportsFormat(PixelFormat));
+
+	const int32 BlockBytes = FFastDXTEncoder::GetBlockBytes(PixelFormat);
+	const int32 ImageBlocksX = FMath::Max(SizeX / 4, 1);
+	const int32 ImageBlocksY = FMath::Max(SizeY / 4, 1);
+	const int32 RowsPerBatch = FMath::Max(CompressionSettings::BlocksPerBatch / ImageBlocksX, 1);
+
+	// Allocate space to store compressed data.
+	OutCompressedData.Empty(ImageBlocksX * ImageBlocksY * BlockBytes);
+	OutCompressedData.AddUninitialized(ImageBlocksX * ImageBlocksY * BlockBytes);
+
+	const FColor* SourceColors = (const FColor*)SourceData;
+	uint8* Dest = OutCompressedData.GetData();
+	const int32 CompressedRowSize = ImageBlocksX * BlockBytes;
+
+	// Asynchronously compress each batch but the first, which is compressed on this thread.
+	TIndirectArray<FAsyncFastDXTTask> AsyncTasks;
+	for (int32 FirstBlockRow = RowsPerBatch; FirstBlockRow < ImageBlocksY; FirstBlockRow += RowsPerBatch)
+	{
+		const int32 NumBlockRows = FMath::Min(RowsPerBatch, ImageBlocksY - FirstBlockRow);
+		FAsyncFastDXTTask* AsyncTask = new(AsyncTasks) FAsyncFastDXTTask(SourceColors, PixelFormat, SizeX, SizeY, FirstBlockRow, NumBlockRows, Dest + FirstBlockRow * CompressedRowSize);
+		AsyncTask->StartBackgroundTask();
+	}
+
+	FFastDXTEncoder::CompressBlockRows(SourceColors, SizeX, SizeY, PixelFormat, 0, FMath::Min(RowsPerBatch, ImageBlocksY), Dest);
+
+	for (int32 TaskIndex = 0; TaskIndex < AsyncTasks.Num(); ++TaskIndex)
+	{
+		AsyncTasks[TaskIndex].EnsureCompletion();
+	}
+
+	return true;
+}
+
 /**
  * Compresses an image using NVTT.
  * @param SourceData			Source texture data to DXT compress, in BGRA 8bit per channel unsigned format.
@@ -386,6 +480,139 @@ static bool CompressImageUsingNVTT(
 	return bSuccess;
 }
 
+/** @return the PSNR of the channels a pixel format stores, in dB */
+static double ComputeDXTPSNR(const TArray<FColor>& SourceColors, const TArray<FColor>& DecompressedColors, EPixelFormat PixelFormat)
+{
+	const int32 NumChannels = (PixelFormat == PF_BC4) ? 1 : (PixelFormat == PF_BC5) ? 2 : (PixelFormat == PF_DXT1) ? 3 : 4;
+
+	double SquaredError = 0.0;
+	for (int32 TexelIndex = 0; TexelIndex < SourceColors.Num(); ++TexelIndex)
+	{
+		const FColor& Source = SourceColors[TexelIndex];
+		const FColor& Decompressed = DecompressedColors[TexelIndex];
+		// BC4 stores the alpha channel and decodes to red
+		const int32 Deltas[4] = { (PixelFormat == PF_BC4 ? Source.A : Source.R) - Decompressed.R, Source.G - Decompressed.G, Source.B - Decompressed.B, Source.A - Decompressed.A };
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			SquaredError += Deltas[Channel] * Deltas[Channel];
+		}
+	}
+
+	const double MeanSquaredError = SquaredError / ((double)SourceColors.Num() * NumChannels);
+	return MeanSquaredError > 0.0 ? 10.0 * FMath::LogX(10.0f, (float)(255.0 * 255.0 / MeanSquaredError)) : 99.0;
+}
+
+/**
+ * Compares the fast encoder with NVTT on a synthetic image of the given size or on a png file, and logs the MPixel/s and
+ * PSNR of both encoders for each format the fast encoder writes.
+ */
+static void BenchmarkDXTEncoders(const TArray<FString>& Args)
+{
+	int32 SizeX = 1024;
+	int32 SizeY = 1024;
+	TArray<FColor> SourceColors;
+
+	if (Args.Num() > 0 && Args[0].EndsWith(TEXT(".png")))
+	{
+		TArray<uint8> FileData;
+		const TArray<uint8>* RawData = nullptr;
+		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+		IImageWrapperPtr ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+		if (!FFileHelper::LoadFileToArray(FileData, *Args[0]) || !ImageWrapper.IsValid()
+			|| !ImageWrapper->SetCompressed(FileData.GetData(), FileData.Num())
+			|| !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+		{
+			UE_LOG(LogTextureFormatDXT, Warning, TEXT("Failed to load '%s'."), *Args[0]);
+			return;
+		}
+
+		// NVTT compresses whole blocks only, crop to them
+		const int32 ImageSizeX = ImageWrapper->GetWidth();
+		SizeX = ImageSizeX & ~3;
+		SizeY = ImageWrapper->GetHeight() & ~3;
+		if (SizeX == 0 || SizeY == 0)
+		{
+			UE_LOG(LogTextureFormatDXT, Warning, TEXT("'%s' is smaller than a block."), *Args[0]);
+			return;
+		}
+
+		const FColor* ImageColors = (const FColor*)RawData->GetData();
+		SourceColors.Empty(SizeX * SizeY);
+		for (int32 Y = 0; Y < SizeY; ++Y)
+		{
+			SourceColors.Append(ImageColors + Y * ImageSizeX, SizeX);
+		}
+	}
+	else
+	{
+		if (Args.Num() > 0)
+		{
+			SizeX = SizeY = FMath::Max(FCString::Atoi(*Args[0]) & ~3, 4);
+		}
+
+		// Smooth gradients, hard edges and noise
+		FRandomStream RandomStream(0);
+		SourceColors.Empty(SizeX * SizeY);
+		for (int32 Y = 0; Y < SizeY; ++Y)
+		{
+			for (int32 X = 0; X < SizeX; ++X)
+			{
+				const int32 Noise = RandomStream.RandRange(0, 23);
+				const float Wave = 0.5f + 0.5f * FMath::Sin(X * 0.05f) * FMath::Cos(Y * 0.03f);
+				SourceColors.Add(FColor(
+					(uint8)FMath::Min(X * 200 / SizeX + Noise, 255),
+					(uint8)FMath::Min(FMath::TruncToInt(Wave * 200.0f) + Noise, 255),
+					(uint8)FMath::Min(((X / 64 + Y / 64) & 1) * 150 + Noise, 255),
+					(uint8)FMath::Min(Y * 200 / SizeY + Noise, 255)));
+			}
+		}
+	}
+
+	const EPixelFormat PixelFormats[] = { PF_DXT1, PF_DXT5, PF_BC4, PF_BC5 };
+	const TCHAR* FormatNames[] = { TEXT("DXT1"), TEXT("DXT5"), TEXT("BC4"), TEXT("BC5") };
+	const double MegaPixels = (double)SizeX * SizeY / 1000000.0;
+
+	TArray<uint8> CompressedData;
+	TArray<FColor> DecompressedColors;
+	DecompressedColors.AddUninitialized(SizeX * SizeY);
+
+	for (int32 FormatIndex = 0; FormatIndex < ARRAY_COUNT(PixelFormats); ++FormatIndex)
+	{
+		const EPixelFormat PixelFormat = PixelFormats[FormatIndex];
+		double Seconds[2];
+		double PSNR[2];
+		for (int32 EncoderIndex = 0; EncoderIndex < 2; ++EncoderIndex)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const bool bSucceeded = EncoderIndex == 0
+				? CompressImageUsingNVTT(SourceColors.GetData(), PixelFormat, SizeX, SizeY, false, PixelFormat == PF_BC5, CompressedData)
+				: CompressImageUsingFastEncoder(SourceColors.GetData(), PixelFormat, SizeX, SizeY, CompressedData);
+			Seconds[EncoderIndex] = FPlatformTime::Seconds() - StartTime;
+
+			if (!bSucceeded)
+			{
+				UE_LOG(LogTextureFormatDXT, Warning, TEXT("Failed to compress %s."), FormatNames[FormatIndex]);
+				return;
+			}
+
+			FFastDXTEncoder::Decompress(CompressedData.GetData(), PixelFormat, SizeX, SizeY, DecompressedColors.GetData());
+			PSNR[EncoderIndex] = ComputeDXTPSNR(SourceColors, DecompressedColors, PixelFormat);
+		}
+
+		UE_LOG(LogTextureFormatDXT, Display, TEXT("%s %dx%d: NVTT %.2f MPixel/s %.2f dB, fast encoder %.2f MPixel/s %.2f dB (%.1fx faster)"),
+			FormatNames[FormatIndex], SizeX, SizeY,
+			MegaPixels / Seconds[0], PSNR[0],
+			MegaPixels / Seconds[1], PSNR[1],
+			Seconds[0] / Seconds[1]);
+	}
+}
+
+static FAutoConsoleCommand BenchmarkDXTEncodersCommand(
+	TEXT("Tex.DXTEncoderBenchmark"),
+	TEXT("Compares the fast DXT encoder with NVTT. Tex.DXTEncoderBenchmark [Size|File.png]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkDXTEncoders)
+	);
+
 /**
  * DXT texture format handler.
  */
@@ -457,20 +684,39 @@ class FTextureFormatDXT : public ITextureFormat
 			CompressedPixelFormat = PF_BC4;
 		}
 
+		// Only textures displayed in the editor trade quality for build speed, cooks always get NVTT. DXT5n swizzles the
+		// normal, which only NVTT does.
+		const bool bUseFastEncoder = BuildSettings.bFastEditorPreview
+			&& FFastDXTEncoder::SupportsFormat(CompressedPixelFormat)
+			&& !(CompressedPixelFormat == PF_DXT5 && bIsNormalMap);
+
 		bool bCompressionSucceeded = true;
 		int32 SliceSize = Image.SizeX * Image.SizeY;
 		for (int32 SliceIndex = 0; SliceIndex < Image.NumSlices && bCompressionSucceeded; ++SliceIndex)
 		{
 			TArray<uint8> CompressedSliceData;
-			bCompressionSucceeded = CompressImageUsingNVTT(
-				Image.AsBGRA8() + SliceIndex * SliceSize,
-				CompressedPixelFormat,
-				Image.SizeX,
-				Image.SizeY,
-				Image.bSRGB,
-				bIsNormalMap,
-				CompressedSliceData
-				);
+			if (bUseFastEncoder)
+			{
+				bCompressionSucceeded = CompressImageUsingFastEncoder(
+					Image.AsBGRA8() + SliceIndex * SliceSize,
+					CompressedPixelFormat,
+					Image.SizeX,
+					Image.SizeY,
+					CompressedSliceData
+					);
+			}
+			else
+			{
+				bCompressionSucceeded = CompressImageUsingNVTT(
+					Image.AsBGRA8() + SliceIndex * SliceSize,
+					CompressedPixelFormat,
+					Image.SizeX,
+					Image.SizeY,
+					Image.bSRGB,
+					bIsNormalMap,
+					CompressedSliceData
+					);
+			}
 			OutCompressedImage.RawData.Append(CompressedSliceData);
 		}
 
@@ -1353,6 +1353,9 @@ void FKismetCompilerVMBackend::GenerateCodeFromClass(UClass* SourceClass, TIndir
 			ConstructFunction(Function, bIsUbergraph, bGenerateStubsOnly);
 		}
 	}
+
+	// functions may be reused with new bytecode of the same size
+	UFunction::InvalidateDecodedScripts();
 }
 
 void FKismetCompilerVMBackend::ConstructFunction(FKismetFunctionContext& FunctionContext, bool bIsUbergraph, bool bGenerateStubOnly)
@@ -0,0 +1,32 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	TextureBuildBenchmarkCommandlet.h: Commandlet measuring texture build throughput
+=============================================================================*/
+
+#pragma once
+#include "Commandlets/Commandlet.h"
+#include "TextureBuildBenchmarkCommandlet.generated.h"
+
+/**
+ * Builds a synthetic texture with the texture compressor and reports the source MPixel/s.
+ *
+ * Options:
+ *	-Size=4096			width and height of the source image
+ *	-Slices=1			number of slices of the source image
+ *	-Iterations=3		number of timed builds
+ *	-Format=BGRA8		texture format the mips are compressed to, an uncompressed format mostly measures mip generation
+ *	-KernelSize=8		size of the mip sharpening kernel, 2 for a simple average
+ *	-Sharpen=0.5		mip sharpening, negative to blur
+ *	-FastEditorPreview	builds like the editor does for display, e.g. DXT formats with the fast encoder instead of NVTT
+ *	-Verify				also builds with the reference mip filter (r.MipGen.Separable 0) and reports both rates and the largest byte difference
+ */
+UCLASS()
+class UTextureBuildBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	// Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet Interface
+};
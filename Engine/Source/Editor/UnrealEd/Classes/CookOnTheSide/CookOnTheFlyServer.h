@@ -585,7 +585,8 @@ private:
 		FCookByTheBookOptions() : bGenerateStreamingInstallManifests(false),
 			bRunning(false),
 			CookTime( 0.0 ),
-			CookStartTime( 0.0 )
+			CookStartTime( 0.0 ),
+			bCookWorker(false)
 		{ }
 
 		/** Should we test for UObject leaks */
@@ -608,6 +609,16 @@ private:
 		TArray<FFilePlatformRequest> PreviousCookRequests; 
 		double CookTime;
 		double CookStartTime;
+		/** Platforms the current cook by the book cooks for */
+		TArray<FName> TargetPlatformNames;
+		/** Is this process a worker of a multi-process cook, only saving the packages in CookWorkerPackages */
+		bool bCookWorker;
+		/** Cook worker: standard filenames of the packages handed to this worker by the coordinator */
+		TSet<FName> CookWorkerPackages;
+		/** Cook worker: packages loaded by this worker and left to the coordinator */
+		TSet<FName> CookWorkerSkippedPackages;
+		/** Coordinator: worker processes cooking the packages of this cook by the book */
+		TAutoPtr<class FCookWorkerCoordinator> CookWorkerCoordinator;
 	};
 	FCookByTheBookOptions* CookByTheBookOptions;
 	
@@ -623,6 +634,7 @@ private:
 
 	ECookInitializationFlags CookFlags;
 	TAutoPtr<class FSandboxPlatformFile> SandboxFile;
+	TAutoPtr<class FCookedPackageHashes> CookedPackageHashes; // hashes of the inputs of the cooked packages, used by iterative cooks
 	bool bIsSavingPackage; // used to stop recursive mark package dirty functions
 
 	// data about the current package being processed
@@ -729,10 +741,17 @@ public:
 		FString DLCName;
 		FString CreateReleaseVersion;
 		FString BasedOnReleaseVersion;
+		/** Number of local worker cook processes to split the packages between, the packages are cooked in this process when less than 2 */
+		int32 NumCookWorkers;
+		/** Cook commandlet parameters of the worker processes */
+		FString CookWorkerParams;
+		/** File listing the packages to cook, when this process is a worker of a multi-process cook */
+		FString CookWorkerList;
 
 		FCookByTheBookStartupOptions() :
 			CookOptions(ECookByTheBookOptions::None),
-			DLCName(FString())
+			DLCName(FString()),
+			NumCookWorkers(0)
 		{ }
 	};
 
@@ -868,6 +887,21 @@ private:
 	 */
 	void CookByTheBookFinished();
 
+	/**
+	 * Hands the cook requests out to worker cook processes, see FCookByTheBookStartupOptions::NumCookWorkers
+	 *
+	 * @param NumCookWorkers number of worker processes to launch
+	 * @param CookWorkerParams cook commandlet parameters of the workers
+	 */
+	void StartCookWorkers( int32 NumCookWorkers, const FString& CookWorkerParams );
+
+	/**
+	 * Waits for the cook workers, then marks what they cooked as cooked and requests what they left
+	 *
+	 * @return true once every worker has exited
+	 */
+	bool TickCookWorkers();
+
 	/**
 	 * Get all the packages which are listed in asset registry passed in.  
 	 *
@@ -977,6 +1011,11 @@ private:
 		return false;
 	}
 
+	inline bool IsCookWorker() const
+	{
+		return CookByTheBookOptions && CookByTheBookOptions->bCookWorker;
+	}
+
 	inline bool IsCreatingReleaseVersion()
 	{
 		if ( CookByTheBookOptions )
@@ -1008,6 +1047,26 @@ private:
 	 */
 	bool SaveCurrentIniSettings( const ITargetPlatform* TargetPlatform ) const;
 
+	/**
+	 * Loads the hashes of the packages the previous cook cooked for a target platform from its sandbox, if they aren't loaded yet
+	 *
+	 * @param TargetPlatform to load the hashes of
+	 */
+	void LoadCookedPackageHashes( const ITargetPlatform* TargetPlatform );
+
+	/**
+	 * Records the hash of the inputs of a package cooked for a target platform
+	 *
+	 * @param TargetPlatform the package was cooked for
+	 * @param PackageName long name of the cooked package
+	 */
+	void AddCookedPackageHash( const ITargetPlatform* TargetPlatform, const FName& PackageName );
+
+	/**
+	 * Saves the hashes of the cooked packages next to the cooked output of each target platform
+	 */
+	void SaveCookedPackageHashes();
+
 
 	/**
 	 * IsCookFlagSet
@@ -1073,7 +1132,7 @@ private:
 	/** Cleans sandbox folders for all target platforms */
 	void CleanSandbox( const bool bIterative );
 
-	/** Populate the cooked packages list from the on disk content using time stamps and dependencies to figure out if they are ok */
+	/** Populate the cooked packages list from the on disk content using the hashes of their inputs to figure out if they are ok */
 	void PopulateCookedPackagesFromDisk( const TArray<ITargetPlatform*>& Platforms );
 
 	/** Generates asset registry */
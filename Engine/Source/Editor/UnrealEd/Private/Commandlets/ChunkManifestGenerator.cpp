@@ -708,6 +708,14 @@ void FChunkManifestGenerator::AddUnassignedPackageToManifest(UPackage* Package,
 	NotifyPackageWasNotAssigned(PackageSandboxPath, Package->GetFName() );
 }
 
+void FChunkManifestGenerator::AddCookedPackageToManifest(FName PackageName, const FString& SandboxFilename)
+{
+	// same as AddPackageToChunkManifest without chunk generation, every package goes to the first chunk
+	check(!bGenerateChunks);
+	NotifyPackageWasCooked(SandboxFilename, PackageName);
+	AddPackageToManifest(SandboxFilename, PackageName, 0);
+}
+
 void FChunkManifestGenerator::RemovePackageFromManifest(FName PackageName, int32 ChunkId)
 {
 	if (ChunkManifests[ChunkId])
@@ -231,6 +231,14 @@ public:
 	 */
 	void AddUnassignedPackageToManifest(UPackage* Package, const FString& PackageSandboxPath );
 
+	/**
+	 * Adds a package cooked by another process to the manifest, only valid when chunks aren't generated as the package isn't loaded
+	 *
+	 * @param PackageName Long package name of the cooked package
+	 * @param SandboxFilename Cooked sandbox path of the package
+	 */
+	void AddCookedPackageToManifest(FName PackageName, const FString& SandboxFilename);
+
 	/**
 	 * Collects all the packages loaded 
 	 *
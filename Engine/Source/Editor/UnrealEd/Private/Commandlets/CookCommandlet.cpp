@@ -1184,6 +1184,16 @@ bool UCookCommandlet::NewCook( const TArray<ITargetPlatform*>& Platforms, TArray
 	Swap( StartupOptions.CreateReleaseVersion, CreateReleaseVersion );
 	StartupOptions.CookOptions = CookOptions;
 
+	// -CookProcessCount=N splits the packages between N worker cook processes launched with the same parameters
+	// -CookWorkerList=<file> is given to each worker by the coordinator
+	FParse::Value( *Params, TEXT("CookProcessCount="), StartupOptions.NumCookWorkers );
+	FParse::Value( *Params, TEXT("CookWorkerList="), StartupOptions.CookWorkerList );
+	if ( StartupOptions.NumCookWorkers > 1 )
+	{
+		const FString CookProcessCountSwitch = FString::Printf( TEXT("-CookProcessCount=%d"), StartupOptions.NumCookWorkers );
+		StartupOptions.CookWorkerParams = Params.Replace( *CookProcessCountSwitch, TEXT(""), ESearchCase::IgnoreCase );
+	}
+
 	CookOnTheFlyServer->StartCookByTheBook( StartupOptions );
 
 	// Garbage collection should happen when either
@@ -6,6 +6,8 @@
 #include "UnrealEd.h"
 
 #include "Animation/AnimCompress_BitwiseCompressOnly.h"
+#include "Animation/AnimCompress_Automatic.h"
+#include "Animation/AnimCompress_SegmentedVariableBitRate.h"
 
 #include "ISourceControlModule.h"
 
@@ -2100,6 +2102,70 @@ struct CompressAnimationsFunctor
 	}
 };
 
+/** Totals gathered by BenchmarkCompressionFunctor, for the automatic and the segmented variable bit rate compressors */
+static int32 BenchmarkNumAnimations = 0;
+static int32 BenchmarkTotalSize[2] = { 0, 0 };
+static double BenchmarkTotalPoseTime[2] = { 0.0, 0.0 };
+static float BenchmarkMaxError[2] = { 0.f, 0.f };
+
+/**
+ * Compresses every animation with UAnimCompress_Automatic and UAnimCompress_SegmentedVariableBitRate and logs
+ * memory, decompression time per pose and end effector error of both. Packages are not saved.
+ */
+struct BenchmarkCompressionFunctor
+{
+	template< typename OBJECTYPE >
+	void DoIt( UCommandlet* Commandlet, UPackage* Package, TArray<FString>& Tokens, TArray<FString>& Switches )
+	{
+		const int32 NumSampledPoses = 200;
+		UAnimCompress* Compressors[2] = { NewObject<UAnimCompress_Automatic>(), NewObject<UAnimCompress_SegmentedVariableBitRate>() };
+
+		for (TObjectIterator<OBJECTYPE> It; It; ++It)
+		{
+			OBJECTYPE* AnimSeq = *It;
+			USkeleton* Skeleton = AnimSeq->GetSkeleton();
+			if (!AnimSeq->IsIn(Package) || Skeleton == NULL || AnimSeq->NumFrames < 2)
+			{
+				continue;
+			}
+
+			TArray<FBoneData> BoneData;
+			FAnimationUtils::BuildSkeletonMetaData(Skeleton, BoneData);
+			const int32 NumTracks = AnimSeq->TrackToSkeletonMapTable.Num();
+			++BenchmarkNumAnimations;
+
+			FString Results;
+			for (int32 CompressorIndex = 0; CompressorIndex < ARRAY_COUNT(Compressors); ++CompressorIndex)
+			{
+				Compressors[CompressorIndex]->Reduce(AnimSeq, false);
+				const int32 Size = AnimSeq->GetApproxCompressedSize();
+
+				AnimationErrorStats ErrorStats;
+				FAnimationUtils::ComputeCompressionError(AnimSeq, BoneData, ErrorStats);
+
+				FTransform Atom;
+				double PoseTime = -FPlatformTime::Seconds();
+				for (int32 PoseIndex = 0; PoseIndex < NumSampledPoses; ++PoseIndex)
+				{
+					const float Time = AnimSeq->SequenceLength * PoseIndex / (NumSampledPoses - 1);
+					for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+					{
+						AnimSeq->GetBoneTransform(Atom, TrackIndex, Time, false);
+					}
+				}
+				PoseTime = (PoseTime + FPlatformTime::Seconds()) / NumSampledPoses;
+
+				BenchmarkTotalSize[CompressorIndex] += Size;
+				BenchmarkTotalPoseTime[CompressorIndex] += PoseTime;
+				BenchmarkMaxError[CompressorIndex] = FMath::Max(BenchmarkMaxError[CompressorIndex], ErrorStats.MaxError);
+				Results += FString::Printf(TEXT(" | %s: %i bytes, %.2f us/pose, max error %f"), *Compressors[CompressorIndex]->Description, Size, PoseTime * 1.e6, ErrorStats.MaxError);
+			}
+
+			UE_LOG(LogPackageUtilities, Display, TEXT("%s (%i frames, %i tracks)%s"), *AnimSeq->GetName(), AnimSeq->NumFrames, NumTracks, *Results);
+		}
+	}
+};
+
 UCompressAnimationsCommandlet::UCompressAnimationsCommandlet(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -2120,8 +2186,20 @@ int32 UCompressAnimationsCommandlet::Main( const FString& Params )
 
 	/** If we're analyzing, we're not actually going to recompress, so we can skip some significant work. */
 	bool bAnalyze = Switches.Contains(TEXT("ANALYZE"));
+	/** Compare the automatic compressor with the segmented variable bit rate one, without saving anything. */
+	bool bBenchmark = Switches.Contains(TEXT("BENCHMARKCODECS"));
+
+	if (bBenchmark)
+	{
+		UE_LOG(LogPackageUtilities, Warning, TEXT("Benchmarking animation compressors..."));
+		DoActionToAllPackages<UAnimSequence, BenchmarkCompressionFunctor>(this, ParamsUpperCase);
 
-	if (bAnalyze)
+		const int32 NumAnimations = FMath::Max(BenchmarkNumAnimations, 1);
+		UE_LOG(LogPackageUtilities, Warning, TEXT("Done benchmarking %i animations."), BenchmarkNumAnimations);
+		UE_LOG(LogPackageUtilities, Warning, TEXT("Automatic: %i bytes, %.2f us/pose on average, max error %f"), BenchmarkTotalSize[0], BenchmarkTotalPoseTime[0] * 1.e6 / NumAnimations, BenchmarkMaxError[0]);
+		UE_LOG(LogPackageUtilities, Warning, TEXT("Segmented Variable Bit Rate: %i bytes, %.2f us/pose on average, max error %f"), BenchmarkTotalSize[1], BenchmarkTotalPoseTime[1] * 1.e6 / NumAnimations, BenchmarkMaxError[1]);
+	}
+	else if (bAnalyze)
 	{
 		UE_LOG(LogPackageUtilities, Warning, TEXT("Analyzing content for uncompressed animations..."));
 		DoActionToAllPackages<UAnimSequence, CompressAnimationsFunctor>(this, ParamsUpperCase);
@@ -0,0 +1,159 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	TextureBuildBenchmarkCommandlet.cpp: Commandlet measuring texture build throughput
+=============================================================================*/
+
+#include "UnrealEd.h"
+#include "Commandlets/TextureBuildBenchmarkCommandlet.h"
+#include "ImageCore.h"
+#include "TextureCompressorModule.h"
+#include "IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTextureBuildBenchmarkCommandlet, Log, All);
+
+UTextureBuildBenchmarkCommandlet::UTextureBuildBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	LogToConsole = true;
+}
+
+/**
+ * Builds a texture a number of times.
+ *
+ * @return the seconds of the fastest build, or a negative value if the build failed
+ */
+static double BuildTextureTimed(ITextureCompressorModule& Compressor, const TArray<FImage>& SourceMips, const FTextureBuildSettings& BuildSettings, int32 Iterations, TArray<FCompressedImage2D>& OutMips)
+{
+	TArray<FImage> EmptyNormalMips;
+	double BestSeconds = MAX_dbl;
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		OutMips.Empty();
+
+		const double StartTime = FPlatformTime::Seconds();
+		if (!Compressor.BuildTexture(SourceMips, EmptyNormalMips, BuildSettings, OutMips))
+		{
+			return -1.0;
+		}
+		BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+	}
+	return BestSeconds;
+}
+
+int32 UTextureBuildBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 Size = 4096;
+	int32 NumSlices = 1;
+	int32 Iterations = 3;
+	int32 KernelSize = 8;
+	float Sharpen = 0.5f;
+	FString FormatName = TEXT("BGRA8");
+
+	const TCHAR* Parms = *Params;
+	FParse::Value(Parms, TEXT("Size="), Size);
+	FParse::Value(Parms, TEXT("Slices="), NumSlices);
+	FParse::Value(Parms, TEXT("Iterations="), Iterations);
+	FParse::Value(Parms, TEXT("KernelSize="), KernelSize);
+	FParse::Value(Parms, TEXT("Sharpen="), Sharpen);
+	FParse::Value(Parms, TEXT("Format="), FormatName);
+	const bool bVerify = FParse::Param(Parms, TEXT("Verify"));
+
+	Size = FMath::RoundUpToPowerOfTwo(FMath::Max(Size, 1));
+	NumSlices = FMath::Max(NumSlices, 1);
+	Iterations = FMath::Max(Iterations, 1);
+
+	ITextureCompressorModule& Compressor = FModuleManager::LoadModuleChecked<ITextureCompressorModule>(TEXTURE_COMPRESSOR_MODULENAME);
+
+	// Noise over a gradient, so sharpening and compression have some detail to work with
+	TArray<FImage> SourceMips;
+	FImage& SourceImage = *new(SourceMips) FImage(Size, Size, NumSlices, ERawImageFormat::BGRA8, true);
+	FColor* SourceColors = SourceImage.AsBGRA8();
+	FRandomStream RandomStream(0);
+	for (int32 SliceIndex = 0; SliceIndex < NumSlices; ++SliceIndex)
+	{
+		for (int32 Y = 0; Y < Size; ++Y)
+		{
+			for (int32 X = 0; X < Size; ++X)
+			{
+				const int32 Noise = RandomStream.RandRange(0, 63);
+				*SourceColors++ = FColor(
+					(uint8)FMath::Min(X * 192 / Size + Noise, 255),
+					(uint8)FMath::Min(Y * 192 / Size + Noise, 255),
+					(uint8)FMath::Min(SliceIndex * 32 + Noise, 255),
+					(uint8)(255 - Noise));
+			}
+		}
+	}
+
+	FTextureBuildSettings BuildSettings;
+	BuildSettings.MipGenSettings = TMGS_Sharpen5;
+	BuildSettings.SharpenMipKernelSize = KernelSize;
+	BuildSettings.MipSharpening = Sharpen;
+	BuildSettings.TextureFormatName = *FormatName;
+	BuildSettings.bSRGB = true;
+	BuildSettings.bFastEditorPreview = FParse::Param(Parms, TEXT("FastEditorPreview"));
+
+	const double MegaPixels = (double)Size * Size * NumSlices / 1000000.0;
+
+	TArray<FCompressedImage2D> Mips;
+	const double Seconds = BuildTextureTimed(Compressor, SourceMips, BuildSettings, Iterations, Mips);
+	if (Seconds < 0.0)
+	{
+		UE_LOG(LogTextureBuildBenchmarkCommandlet, Error, TEXT("Failed to build a %dx%dx%d %s texture."), Size, Size, NumSlices, *FormatName);
+		return 1;
+	}
+
+	UE_LOG(LogTextureBuildBenchmarkCommandlet, Display, TEXT("Built %dx%dx%d %s with a %dx%d kernel in %.2fms (best of %d): %.2f MPixel/s"),
+		Size, Size, NumSlices, *FormatName, KernelSize, KernelSize, Seconds * 1000.0, Iterations, MegaPixels / Seconds);
+
+	if (bVerify)
+	{
+		IConsoleVariable* SeparableVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.MipGen.Separable"));
+		if (!SeparableVar)
+		{
+			UE_LOG(LogTextureBuildBenchmarkCommandlet, Error, TEXT("r.MipGen.Separable is not registered, can't build with the reference mip filter."));
+			return 1;
+		}
+
+		const int32 PreviousSeparable = SeparableVar->GetInt();
+		SeparableVar->Set(TEXT("0"));
+
+		TArray<FCompressedImage2D> ReferenceMips;
+		const double ReferenceSeconds = BuildTextureTimed(Compressor, SourceMips, BuildSettings, Iterations, ReferenceMips);
+
+		SeparableVar->Set(*FString::FromInt(PreviousSeparable));
+
+		if (ReferenceSeconds < 0.0 || ReferenceMips.Num() != Mips.Num())
+		{
+			UE_LOG(LogTextureBuildBenchmarkCommandlet, Error, TEXT("Failed to build the texture with the reference mip filter."));
+			return 1;
+		}
+
+		// Byte differences are channel differences for 8 bit uncompressed formats
+		int32 MaxDifference = 0;
+		int32 NumDifferentBytes = 0;
+		for (int32 MipIndex = 0; MipIndex < Mips.Num(); ++MipIndex)
+		{
+			const TArray<uint8>& Data = Mips[MipIndex].RawData;
+			const TArray<uint8>& ReferenceData = ReferenceMips[MipIndex].RawData;
+			if (Data.Num() != ReferenceData.Num())
+			{
+				UE_LOG(LogTextureBuildBenchmarkCommandlet, Error, TEXT("Mip %d differs in size from the reference mip."), MipIndex);
+				return 1;
+			}
+
+			for (int32 ByteIndex = 0; ByteIndex < Data.Num(); ++ByteIndex)
+			{
+				const int32 Difference = FMath::Abs((int32)Data[ByteIndex] - (int32)ReferenceData[ByteIndex]);
+				MaxDifference = FMath::Max(MaxDifference, Difference);
+				NumDifferentBytes += Difference != 0 ? 1 : 0;
+			}
+		}
+
+		UE_LOG(LogTextureBuildBenchmarkCommandlet, Display, TEXT("Reference mip filter: %.2fms, %.2f MPixel/s (%.2fx). %d bytes differ, by at most %d."),
+			ReferenceSeconds * 1000.0, MegaPixels / ReferenceSeconds, ReferenceSeconds / Seconds, NumDifferentBytes, MaxDifference);
+	}
+
+	return 0;
+}
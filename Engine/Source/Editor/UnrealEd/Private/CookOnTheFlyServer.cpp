@@ -25,6 +25,8 @@
 // cook by the book requirements
 #include "Commandlets/ChunkManifestGenerator.h"
 #include "Engine/WorldComposition.h"
+#include "CookWorkerCoordinator.h"
+#include "CookedPackageHashes.h"
 
 // error message log
 #include "TokenizedMessage.h"
@@ -891,6 +893,16 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 		return Result;
 	}
 
+	if ( IsCookByTheBookMode() && CookByTheBookOptions->CookWorkerCoordinator.IsValid() )
+	{
+		// nothing is cooked in this process while the workers are saving packages
+		if ( !TickCookWorkers() )
+		{
+			FPlatformProcess::Sleep( 0.1f );
+			return Result;
+		}
+	}
+
 	// This is all the target platforms which we needed to process requests for this iteration
 	// we use this in the unsolicited packages processing below
 	TArray<FName> AllTargetPlatformNames;
@@ -1345,6 +1357,21 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 					}
 				}
 
+				if ( IsCookWorker() )
+				{
+					// a worker only saves the packages it was handed, the coordinator cooks the others once the workers are done
+					FName WorkerPackageFName = GetCachedStandardPackageFileFName( PackagesToSave[I] );
+					if ( !CookByTheBookOptions->CookWorkerPackages.Contains( WorkerPackageFName ) )
+					{
+						if ( WorkerPackageFName != NAME_None && !CookByTheBookOptions->CookWorkerSkippedPackages.Contains( WorkerPackageFName ) )
+						{
+							CookByTheBookOptions->CookWorkerSkippedPackages.Add( WorkerPackageFName );
+							UE_LOG(LogCook, Display, TEXT("%s%s"), FCookWorkerCoordinator::SkippedPackageTag, *WorkerPackageFName.ToString());
+						}
+						continue;
+					}
+				}
+
 				{
 					SCOPE_TIMER(GenerateManifestInfo);
 					// update manifest with cooked package info
@@ -1426,6 +1453,12 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 					FFilePlatformRequest FileRequest( StandardFilename, AllTargetPlatformNames);
 					CookedPackages.Add( FileRequest );
 
+					if ( IsCookWorker() )
+					{
+						// let the coordinator know this package is done
+						UE_LOG(LogCook, Display, TEXT("%s%s"), FCookWorkerCoordinator::CookedPackageTag, *StandardFilename.ToString());
+					}
+
 					if ( (CurrentCookMode == ECookMode::CookOnTheFly) && (I >= FirstUnsolicitedPackage) ) 
 					{
 						// this is an unsolicited package
@@ -1553,12 +1586,20 @@ void UCookOnTheFlyServer::MarkPackageDirtyForCooker( UPackage *Package )
 			}
 		}
 		CookedPackages.RemoveFile( PackageFFileName );
+
+		// the package and the packages depending on it have new inputs
+		if ( CookedPackageHashes.IsValid() )
+		{
+			CookedPackageHashes->ResetPackageInputs();
+		}
 	}
 }
 
 
 void UCookOnTheFlyServer::EndNetworkFileServer()
 {
+	SaveCookedPackageHashes();
+
 	for ( int i = 0; i < NetworkFileServers.Num(); ++i )
 	{
 		INetworkFileServer *NetworkFileServer = NetworkFileServers[i];
@@ -1858,7 +1899,14 @@ bool UCookOnTheFlyServer::SaveCookedPackage( UPackage* Package, uint32 SaveFlags
 				else
 				{
 					SCOPE_TIMER(GEditorSavePackage);
-					bSavedCorrectly &= GEditor->SavePackage( Package, World, Flags, *PlatFilename, GError, NULL, bSwap, false, SaveFlags, Target, FDateTime::MinValue(), false );
+					const bool bSaved = GEditor->SavePackage( Package, World, Flags, *PlatFilename, GError, NULL, bSwap, false, SaveFlags, Target, FDateTime::MinValue(), false );
+					bSavedCorrectly &= bSaved;
+
+					// the coordinator of a multi-process cook records the packages its workers cooked
+					if ( bSaved && !IsCookWorker() )
+					{
+						AddCookedPackageHash( Target, Package->GetFName() );
+					}
 				}
 
 				// if we initialized the world we are responsible for cleaning it up.
@@ -2180,11 +2228,67 @@ bool UCookOnTheFlyServer::SaveCurrentIniSettings( const ITargetPlatform* TargetP
 	return true;
 }
 
-void UCookOnTheFlyServer::PopulateCookedPackagesFromDisk( const TArray<ITargetPlatform*>& Platforms )
+void UCookOnTheFlyServer::LoadCookedPackageHashes( const ITargetPlatform* TargetPlatform )
 {
-	// check each package to see if it's out of date
-	FPackageDependencyInfoModule& PDInfoModule = FModuleManager::LoadModuleChecked<FPackageDependencyInfoModule>("PackageDependencyInfo");
+	if ( !CookedPackageHashes.IsValid() )
+	{
+		CookedPackageHashes = new FCookedPackageHashes();
+	}
+
+	const FName TargetPlatformName = FName(*TargetPlatform->PlatformName());
+	if ( !CookedPackageHashes->IsPlatformLoaded( TargetPlatformName ) )
+	{
+		TArray<FString> IniVersionStrings;
+		GetCurrentIniVersionStrings( TargetPlatform, IniVersionStrings );
+
+		const FString CookedPackageHashesFilename = FPaths::GameDir() / TEXT("CookedPackageHashes.bin");
+		CookedPackageHashes->LoadPlatform( TargetPlatformName, ConvertToFullSandboxPath( CookedPackageHashesFilename, true, TargetPlatform->PlatformName() ), IniVersionStrings );
+	}
+}
+
+void UCookOnTheFlyServer::AddCookedPackageHash( const ITargetPlatform* TargetPlatform, const FName& PackageName )
+{
+	LoadCookedPackageHashes( TargetPlatform );
+	CookedPackageHashes->AddCookedPackage( FName(*TargetPlatform->PlatformName()), PackageName );
+}
+
+void UCookOnTheFlyServer::SaveCookedPackageHashes()
+{
+	if ( CookedPackageHashes.IsValid() )
+	{
+		// the hashes must not claim a package which is still being written
+		UPackage::WaitForAsyncFileWrites();
 
+		CookedPackageHashes->SavePlatforms();
+	}
+}
+
+/**
+ * Gets the long name of the source package of a file in a sandbox
+ *
+ * @param StandardCookedFilename	the standard filename the file in the sandbox was cooked from
+ * @param OutPackageName			receives the long name of the source package
+ * @return false if the file is not a package, or if its source package doesn't exist anymore
+ */
+static bool GetSourcePackageName( const FString& StandardCookedFilename, FName& OutPackageName )
+{
+	if ( !FPackageName::IsPackageExtension( *FPaths::GetExtension( StandardCookedFilename, true ) ) )
+	{
+		return false;
+	}
+
+	FString LongPackageName;
+	if ( !FPackageName::TryConvertFilenameToLongPackageName( StandardCookedFilename, LongPackageName ) || !FPackageName::DoesPackageExist( LongPackageName ) )
+	{
+		return false;
+	}
+
+	OutPackageName = FName(*LongPackageName);
+	return true;
+}
+
+void UCookOnTheFlyServer::PopulateCookedPackagesFromDisk( const TArray<ITargetPlatform*>& Platforms )
+{
 	// list of directories to skip
 	TArray<FString> DirectoriesToSkip;
 	TArray<FString> DirectoriesToNotRecurse;
@@ -2201,19 +2305,18 @@ void UCookOnTheFlyServer::PopulateCookedPackagesFromDisk( const TArray<ITargetPl
 
 		PlatformFile.IterateDirectory(*SandboxDirectory, Visitor);
 
+		LoadCookedPackageHashes( Target );
+
 		for (TMap<FString, FDateTime>::TIterator TimestampIt(Visitor.FileTimes); TimestampIt; ++TimestampIt)
 		{
 			FString CookedFilename = TimestampIt.Key();
-			FDateTime CookedTimestamp = TimestampIt.Value();
 			CookedFilename = FPaths::ConvertRelativePathToFull(CookedFilename);
 			FString StandardCookedFilename = CookedFilename.Replace(*SandboxDirectory, *(FPaths::GetRelativePathToRoot()));
-			FDateTime DependentTimestamp;
+			FName PackageName;
 
-			if (PDInfoModule.DeterminePackageDependentTimeStamp(*(FPaths::GetBaseFilename(StandardCookedFilename, false)), DependentTimestamp) == true)
+			if (GetSourcePackageName(StandardCookedFilename, PackageName))
 			{
-				double Diff = (CookedTimestamp - DependentTimestamp).GetTotalSeconds();
-
-				if (Diff >= 0.0)
+				if (CookedPackageHashes->GetRecookReason(PlatformFName, PackageName) == ECookedPackageRecookReason::None)
 				{
 					CookedPackages.Add(FFilePlatformRequest( FName(*StandardCookedFilename), PlatformFName) );
 				}
@@ -2266,6 +2369,8 @@ void UCookOnTheFlyServer::CleanSandbox( const bool bIterative )
 			{
 				if ( IniSettingsOutOfDate(Target) )
 				{
+					UE_LOG(LogCook, Display, TEXT("Ini settings of %s changed since the previous cook, recooking every package."), *Target->PlatformName());
+
 					ClearPlatformCookedData( FName( *Target->PlatformName() ) );
 
 					FString SandboxDirectory = GetSandboxDirectory(Target->PlatformName());
@@ -2276,9 +2381,6 @@ void UCookOnTheFlyServer::CleanSandbox( const bool bIterative )
 				}
 			}
 
-			// check each package to see if it's out of date
-			FPackageDependencyInfoModule& PDInfoModule = FModuleManager::LoadModuleChecked<FPackageDependencyInfoModule>("PackageDependencyInfo");
-			
 			// list of directories to skip
 			TArray<FString> DirectoriesToSkip;
 			TArray<FString> DirectoriesToNotRecurse;
@@ -2295,32 +2397,42 @@ void UCookOnTheFlyServer::CleanSandbox( const bool bIterative )
 			
 				PlatformFile.IterateDirectory(*SandboxDirectory, Visitor);
 
+				LoadCookedPackageHashes( Target );
+
+				// a package is recooked when the hash of its source, of its dependencies or of the platform settings changed
+				int32 RecookReasonCounts[ECookedPackageRecookReason::Max] = { 0 };
+
 				for (TMap<FString, FDateTime>::TIterator TimestampIt(Visitor.FileTimes); TimestampIt; ++TimestampIt)
 				{
 					FString CookedFilename = TimestampIt.Key();
-					FDateTime CookedTimestamp = TimestampIt.Value();
 					FString StandardCookedFilename = CookedFilename.Replace(*SandboxDirectory, *(FPaths::GetRelativePathToRoot()));
-					FDateTime DependentTimestamp;
+					FName PackageName;
 
-					if (PDInfoModule.DeterminePackageDependentTimeStamp(*(FPaths::GetBaseFilename(StandardCookedFilename, false)), DependentTimestamp) == true)
+					if (GetSourcePackageName(StandardCookedFilename, PackageName))
 					{
-						double Diff = (CookedTimestamp - DependentTimestamp).GetTotalSeconds();
+						const ECookedPackageRecookReason::Type RecookReason = CookedPackageHashes->GetRecookReason(PlatformFName, PackageName);
+						++RecookReasonCounts[RecookReason];
 
-						if (Diff < 0.0)
+						if (RecookReason != ECookedPackageRecookReason::None)
 						{
-#if DEBUG_COOKONTHEFLY
-							UE_LOG(LogCook, Display, TEXT("Deleting out of date cooked file: %s"), *CookedFilename);
-#endif
+							UE_LOG(LogCook, Display, TEXT("Recooking %s for %s: %s"), *PackageName.ToString(), *Target->PlatformName(), FCookedPackageHashes::GetRecookReasonString(RecookReason));
+
 							IFileManager::Get().Delete(*CookedFilename);
 
 							CookedPackages.RemoveFileForPlatform(FName(*StandardCookedFilename), PlatformFName);
 						}
 					}
 				}
-			}
 
-			// Collect garbage to ensure we don't have any packages hanging around from dependent time stamp determination
-			CollectGarbage(RF_Native);
+				int32 NumRecookedPackages = 0;
+				FString RecookReasons;
+				for (int32 RecookReason = ECookedPackageRecookReason::None + 1; RecookReason < ECookedPackageRecookReason::Max; ++RecookReason)
+				{
+					NumRecookedPackages += RecookReasonCounts[RecookReason];
+					RecookReasons += FString::Printf(TEXT(", %d %s"), RecookReasonCounts[RecookReason], FCookedPackageHashes::GetRecookReasonString((ECookedPackageRecookReason::Type)RecookReason));
+				}
+				UE_LOG(LogCook, Display, TEXT("Iterative cook for %s: %d cooked packages up to date, %d out of date%s."), *Target->PlatformName(), RecookReasonCounts[ECookedPackageRecookReason::None], NumRecookedPackages, *RecookReasons);
+			}
 		}
 	}
 #if OUTPUT_TIMING
@@ -2715,6 +2827,8 @@ void UCookOnTheFlyServer::CookByTheBookFinished()
 
 	GetDerivedDataCacheRef().WaitForQuiescence(true);
 
+	// the coordinator of a multi-process cook saves the registry and manifests for every package its workers cooked
+	if ( !IsCookWorker() )
 	{
 		// Save modified asset registry with all streaming chunk info generated during cook
 		const FString RegistryFilename = FPaths::GameDir() / TEXT("AssetRegistry.bin");
@@ -2746,6 +2860,8 @@ void UCookOnTheFlyServer::CookByTheBookFinished()
 				// Manifest.Value->SaveManifests( VersionedRegistryFilename );
 			}
 		}
+
+		SaveCookedPackageHashes();
 	}
 
 	CookByTheBookOptions->LastGCItems.Empty();
@@ -2775,6 +2891,11 @@ void UCookOnTheFlyServer::CancelCookByTheBook()
 		CookRequests.DequeueAllRequests(CookByTheBookOptions->PreviousCookRequests);
 		CookByTheBookOptions->bRunning = false;
 
+		if ( !IsCookWorker() )
+		{
+			SaveCookedPackageHashes();
+		}
+
 		SandboxFile = NULL;
 	}	
 }
@@ -2814,6 +2935,11 @@ void UCookOnTheFlyServer::ClearPlatformCookedData( const FName& PlatformName )
 	CookedPackages.RemoveAllFilesForPlatform( PlatformName );
 	TArray<FName> PackageNames;
 	UnsolicitedCookedPackages.GetPackagesForPlatformAndRemove(PlatformName, PackageNames);
+
+	if ( CookedPackageHashes.IsValid() )
+	{
+		CookedPackageHashes->ClearPlatform( PlatformName );
+	}
 }
 
 void UCookOnTheFlyServer::CreateSandboxFile()
@@ -2843,12 +2969,16 @@ void UCookOnTheFlyServer::InitializeSandbox()
 
 		CreateSandboxFile();
 
-		if ( IsCookFlagSet(ECookInitializationFlags::Iterative) )
+		// cook workers share the sandbox of their coordinator, which cleaned it before launching them
+		if ( !IsCookWorker() )
 		{
-			PopulateCookedPackagesFromDisk(TargetPlatforms);
-		}
+			if ( IsCookFlagSet(ECookInitializationFlags::Iterative) )
+			{
+				PopulateCookedPackagesFromDisk(TargetPlatforms);
+			}
 
-		CleanSandbox(IsCookFlagSet(ECookInitializationFlags::Iterative));
+			CleanSandbox(IsCookFlagSet(ECookInitializationFlags::Iterative));
+		}
 	}
 }
 
@@ -2856,6 +2986,11 @@ void UCookOnTheFlyServer::TermSandbox()
 {
 	ClearAllCookedData();
 	ClearPackageFilenameCache();
+
+	// the hashes are saved in the sandbox
+	SaveCookedPackageHashes();
+	CookedPackageHashes.Reset();
+
 	SandboxFile = NULL;
 }
 
@@ -2885,10 +3020,23 @@ void UCookOnTheFlyServer::StartCookByTheBook( const FCookByTheBookStartupOptions
 		TermSandbox();
 	}
 
+	CookByTheBookOptions->bCookWorker = !CookByTheBookStartupOptions.CookWorkerList.IsEmpty();
+	CookByTheBookOptions->CookWorkerPackages.Empty();
+	CookByTheBookOptions->CookWorkerSkippedPackages.Empty();
+
+	// source packages may have changed since the last cook
+	if ( CookedPackageHashes.IsValid() )
+	{
+		CookedPackageHashes->ResetPackageInputs();
+	}
+
 	InitializeSandbox();
 
-	// iteratively clean any old files out of the sandbox (check if ini settings are out of date and clean out any stale files)
-	CleanSandbox(true);
+	if ( !IsCookWorker() )
+	{
+		// iteratively clean any old files out of the sandbox (check if ini settings are out of date and clean out any stale files)
+		CleanSandbox(true);
+	}
 
 	CookByTheBookOptions->bRunning = true;
 	CookByTheBookOptions->bCancel = false;
@@ -2927,12 +3075,16 @@ void UCookOnTheFlyServer::StartCookByTheBook( const FCookByTheBookStartupOptions
 			TArray<ITargetPlatform*> Platforms;
 			Platforms.Add( Platform );
 			ManifestGenerator = new FChunkManifestGenerator(Platforms);
-			ManifestGenerator->CleanManifestDirectories();
+			if ( !IsCookWorker() )
+			{
+				ManifestGenerator->CleanManifestDirectories();
+			}
 			ManifestGenerator->Initialize( CookByTheBookOptions->bGenerateStreamingInstallManifests);
 
 			CookByTheBookOptions->ManifestGenerators.Add(PlatformName, ManifestGenerator);
 		}
 	}
+	CookByTheBookOptions->TargetPlatformNames = TargetPlatformNames;
 
 
 	if ( IsCookingDLC() )
@@ -2966,10 +3118,31 @@ void UCookOnTheFlyServer::StartCookByTheBook( const FCookByTheBookStartupOptions
 	FGameDelegates::Get().GetCookModificationDelegate().ExecuteIfBound(FilesInPath);
 
 	// don't resave the global shader map files in dlc
-	if ( !IsCookingDLC() )
+	if ( !IsCookingDLC() && !IsCookWorker() )
 	{
 		SaveGlobalShaderMapFiles(TargetPlatforms);
 	}
+
+	if ( IsCookWorker() )
+	{
+		// the coordinator collected the files to cook, a worker only cooks the share it was handed
+		FString PackageList;
+		if ( !FFileHelper::LoadFileToString( PackageList, *CookByTheBookStartupOptions.CookWorkerList ) )
+		{
+			LogCookerMessage( FString::Printf(TEXT("Unable to read the cook worker package list %s"), *CookByTheBookStartupOptions.CookWorkerList), EMessageSeverity::Error );
+			UE_LOG(LogCook, Error, TEXT("Unable to read the cook worker package list %s"), *CookByTheBookStartupOptions.CookWorkerList);
+		}
+
+		TArray<FString> PackageFilenames;
+		PackageList.ParseIntoArrayLines( PackageFilenames );
+		for ( const auto& PackageFilename : PackageFilenames )
+		{
+			FName PackageFileFName = FName(*PackageFilename);
+			CookByTheBookOptions->CookWorkerPackages.Add( PackageFileFName );
+			CookRequests.EnqueueUnique( MoveTemp( FFilePlatformRequest( PackageFileFName, TargetPlatformNames ) ) );
+		}
+		return;
+	}
 	
 
 	CollectFilesToCook(FilesInPath, CookMaps, CookDirectories, CookCultures, IniMapSections, bCookAll, bMapsOnly, bNoDev );
@@ -3039,6 +3212,111 @@ void UCookOnTheFlyServer::StartCookByTheBook( const FCookByTheBookStartupOptions
 	}
 	CookByTheBookOptions->PreviousCookRequests.Empty();
 
+	if ( CookByTheBookStartupOptions.NumCookWorkers > 1 )
+	{
+		StartCookWorkers( CookByTheBookStartupOptions.NumCookWorkers, CookByTheBookStartupOptions.CookWorkerParams );
+	}
+}
+
+void UCookOnTheFlyServer::StartCookWorkers( int32 NumCookWorkers, const FString& CookWorkerParams )
+{
+	check( IsCookByTheBookMode() && !IsCookWorker() );
+
+	if ( CookByTheBookOptions->bGenerateStreamingInstallManifests )
+	{
+		// chunk assignments depend on the packages loaded together, which only a single process knows
+		UE_LOG(LogCook, Warning, TEXT("Streaming install manifests can't be generated with cook workers, cooking in a single process."));
+		return;
+	}
+
+	const TArray<FName>& TargetPlatformNames = CookByTheBookOptions->TargetPlatformNames;
+
+	// the workers cook for every target platform, requests for some of the platforms are left to this process
+	TArray<FName> WorkerPackages;
+	TArray<FFilePlatformRequest> RemainingRequests;
+	FFilePlatformRequest Request;
+	while ( CookRequests.Dequeue( &Request ) )
+	{
+		if ( CookedPackages.Exists( Request ) )
+		{
+			continue;
+		}
+
+		bool bHasAllPlatforms = true;
+		for ( const auto& PlatformName : TargetPlatformNames )
+		{
+			bHasAllPlatforms &= Request.HasPlatform( PlatformName );
+		}
+
+		if ( bHasAllPlatforms )
+		{
+			WorkerPackages.Add( Request.GetFilename() );
+		}
+		else
+		{
+			RemainingRequests.Add( Request );
+		}
+	}
+
+	TArray<TArray<FName>> Shares;
+	FCookWorkerCoordinator::PartitionPackages( WorkerPackages, NumCookWorkers, Shares );
+
+	CookByTheBookOptions->CookWorkerCoordinator = new FCookWorkerCoordinator();
+	const int32 NumLaunched = CookByTheBookOptions->CookWorkerCoordinator->LaunchWorkers( Shares, CookWorkerParams );
+	UE_LOG(LogCook, Display, TEXT("Cooking %d packages in %d worker processes."), WorkerPackages.Num(), NumLaunched);
+
+	// this process cooks the remaining requests once the workers have exited, so that it never saves a package a worker is saving
+	for ( const auto& RemainingRequest : RemainingRequests )
+	{
+		CookRequests.EnqueueUnique( RemainingRequest );
+	}
+}
+
+bool UCookOnTheFlyServer::TickCookWorkers()
+{
+	FCookWorkerCoordinator* CookWorkerCoordinator = CookByTheBookOptions->CookWorkerCoordinator.GetOwnedPointer();
+	if ( CookWorkerCoordinator->Tick() )
+	{
+		return false;
+	}
+
+	const TArray<FName>& TargetPlatformNames = CookByTheBookOptions->TargetPlatformNames;
+
+	TArray<FName> WorkerCookedPackages;
+	CookWorkerCoordinator->GetCookedPackages( WorkerCookedPackages );
+	for ( const auto& StandardFilename : WorkerCookedPackages )
+	{
+		CookedPackages.Add( FFilePlatformRequest( StandardFilename, TargetPlatformNames ) );
+
+		// the manifests are saved by this process, add the package the same way GenerateManifestInfo would have
+		FString LongPackageName;
+		if ( FPackageName::TryConvertFilenameToLongPackageName( StandardFilename.ToString(), LongPackageName ) )
+		{
+			const FName PackageFName = FName(*LongPackageName);
+			const FString Filename = GetCachedPackageFilename( PackageFName );
+			if ( !Filename.IsEmpty() )
+			{
+				const FString SandboxFilename = ConvertToFullSandboxPath( *Filename, true );
+				for ( const auto& PlatformName : TargetPlatformNames )
+				{
+					CookByTheBookOptions->ManifestGenerators.FindChecked( PlatformName )->AddCookedPackageToManifest( PackageFName, SandboxFilename );
+					AddCookedPackageHash( GetTargetPlatformManagerRef().FindTargetPlatform( PlatformName.ToString() ), PackageFName );
+				}
+			}
+		}
+	}
+
+	TArray<FName> PackagesToRecook;
+	CookWorkerCoordinator->GetPackagesToRecook( PackagesToRecook );
+	for ( const auto& StandardFilename : PackagesToRecook )
+	{
+		CookRequests.EnqueueUnique( FFilePlatformRequest( StandardFilename, TargetPlatformNames ) );
+	}
+
+	UE_LOG(LogCook, Display, TEXT("Cook workers cooked %d packages, cooking %d remaining packages in this process."), WorkerCookedPackages.Num(), CookRequests.Num());
+
+	CookByTheBookOptions->CookWorkerCoordinator.Reset();
+	return true;
 }
 
 
@@ -0,0 +1,423 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	CookWorkerCoordinator.cpp: Hands the packages of a cook by the book to local worker cook processes.
+=============================================================================*/
+
+#include "UnrealEd.h"
+#include "CookWorkerCoordinator.h"
+#include "AssetRegistryModule.h"
+#include "Commandlets/CommandletHelpers.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCookWorkers, Log, All);
+
+const TCHAR* FCookWorkerCoordinator::CookedPackageTag = TEXT("CookWorkerCooked: ");
+const TCHAR* FCookWorkerCoordinator::SkippedPackageTag = TEXT("CookWorkerSkipped: ");
+
+FCookWorkerCoordinator::FCookWorkerCoordinator()
+{
+}
+
+FCookWorkerCoordinator::~FCookWorkerCoordinator()
+{
+	for ( auto& Worker : Workers )
+	{
+		if ( Worker.bRunning )
+		{
+			FPlatformProcess::TerminateProc( Worker.ProcessHandle, true );
+			CloseWorker( Worker );
+		}
+	}
+}
+
+void FCookWorkerCoordinator::PartitionPackages(const TArray<FName>& PackageFilenames, int32 NumShares, TArray<TArray<FName>>& OutShares)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	const int32 NumPackages = PackageFilenames.Num();
+
+	// the source size of a package is a rough estimate of the time it takes to cook it
+	TMap<FName, int32> PackageIndices;
+	TArray<FName> PackageNames;
+	TArray<int64> Costs;
+	PackageNames.AddZeroed( NumPackages );
+	Costs.AddUninitialized( NumPackages );
+	int64 TotalCost = 0;
+	for ( int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex )
+	{
+		const FString Filename = PackageFilenames[PackageIndex].ToString();
+		FString LongPackageName;
+		if ( FPackageName::TryConvertFilenameToLongPackageName( Filename, LongPackageName ) )
+		{
+			PackageNames[PackageIndex] = FName( *LongPackageName );
+			PackageIndices.Add( PackageNames[PackageIndex], PackageIndex );
+		}
+		Costs[PackageIndex] = FMath::Max<int64>( IFileManager::Get().FileSize( *Filename ), 1 );
+		TotalCost += Costs[PackageIndex];
+	}
+
+	// dependencies between the packages to cook, and the clusters of packages connected by them
+	TArray<TArray<int32>> Dependencies;
+	Dependencies.AddDefaulted( NumPackages );
+	TArray<int32> ClusterParents;
+	ClusterParents.AddUninitialized( NumPackages );
+	for ( int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex )
+	{
+		ClusterParents[PackageIndex] = PackageIndex;
+	}
+
+	auto FindCluster = [&ClusterParents]( int32 PackageIndex )
+	{
+		while ( ClusterParents[PackageIndex] != PackageIndex )
+		{
+			ClusterParents[PackageIndex] = ClusterParents[ClusterParents[PackageIndex]];
+			PackageIndex = ClusterParents[PackageIndex];
+		}
+		return PackageIndex;
+	};
+
+	TArray<FName> PackageDependencies;
+	for ( int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex )
+	{
+		if ( PackageNames[PackageIndex] == NAME_None )
+		{
+			continue;
+		}
+
+		PackageDependencies.Reset();
+		AssetRegistry.GetDependencies( PackageNames[PackageIndex], PackageDependencies );
+		for ( const auto& Dependency : PackageDependencies )
+		{
+			const int32* DependencyIndex = PackageIndices.Find( Dependency );
+			if ( DependencyIndex && *DependencyIndex != PackageIndex )
+			{
+				Dependencies[PackageIndex].Add( *DependencyIndex );
+				ClusterParents[FindCluster( PackageIndex )] = FindCluster( *DependencyIndex );
+			}
+		}
+	}
+
+	// visit the packages dependencies first, so that cutting a cluster keeps packages next to what they depend on
+	TArray<int32> DependencyOrder;
+	DependencyOrder.Reserve( NumPackages );
+	{
+		struct FVisit
+		{
+			int32 PackageIndex;
+			int32 NextDependency;
+
+			FVisit( int32 InPackageIndex ) : PackageIndex( InPackageIndex ), NextDependency( 0 ) { }
+		};
+		TArray<FVisit> Stack;
+		TBitArray<> Visited( false, NumPackages );
+		for ( int32 RootIndex = 0; RootIndex < NumPackages; ++RootIndex )
+		{
+			if ( Visited[RootIndex] )
+			{
+				continue;
+			}
+			Visited[RootIndex] = true;
+			Stack.Add( FVisit( RootIndex ) );
+			while ( Stack.Num() )
+			{
+				FVisit& Visit = Stack.Last();
+				const TArray<int32>& PackageDependencyIndices = Dependencies[Visit.PackageIndex];
+				if ( Visit.NextDependency < PackageDependencyIndices.Num() )
+				{
+					const int32 DependencyIndex = PackageDependencyIndices[Visit.NextDependency++];
+					if ( !Visited[DependencyIndex] )
+					{
+						Visited[DependencyIndex] = true;
+						Stack.Add( FVisit( DependencyIndex ) );
+					}
+				}
+				else
+				{
+					DependencyOrder.Add( Visit.PackageIndex );
+					Stack.Pop( false );
+				}
+			}
+		}
+	}
+
+	// gather the clusters, cutting the ones which would not fit in a share
+	const int64 ShareCost = FMath::Max<int64>( TotalCost / FMath::Max( NumShares, 1 ), 1 );
+	TArray<TArray<int32>> Clusters;
+	TArray<int64> ClusterCosts;
+	{
+		TMap<int32, int32> RootClusters;
+		for ( const int32 PackageIndex : DependencyOrder )
+		{
+			const int32 Root = FindCluster( PackageIndex );
+			int32* ClusterIndex = RootClusters.Find( Root );
+			if ( ClusterIndex == nullptr || ClusterCosts[*ClusterIndex] >= ShareCost )
+			{
+				ClusterIndex = &RootClusters.Add( Root, Clusters.Num() );
+				Clusters.AddDefaulted();
+				ClusterCosts.Add( 0 );
+			}
+			Clusters[*ClusterIndex].Add( PackageIndex );
+			ClusterCosts[*ClusterIndex] += Costs[PackageIndex];
+		}
+	}
+
+	// hand out the largest clusters first, each to the share with the least work so far
+	TArray<int32> ClusterOrder;
+	ClusterOrder.AddUninitialized( Clusters.Num() );
+	for ( int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex )
+	{
+		ClusterOrder[ClusterIndex] = ClusterIndex;
+	}
+	ClusterOrder.Sort( [&ClusterCosts]( int32 A, int32 B )
+	{
+		return ClusterCosts[A] != ClusterCosts[B] ? ClusterCosts[A] > ClusterCosts[B] : A < B;
+	} );
+
+	TArray<TArray<int32>> ShareIndices;
+	TArray<int64> ShareCosts;
+	ShareIndices.AddDefaulted( FMath::Max( NumShares, 1 ) );
+	ShareCosts.AddZeroed( ShareIndices.Num() );
+	for ( const int32 ClusterIndex : ClusterOrder )
+	{
+		int32 LightestShare = 0;
+		for ( int32 ShareIndex = 1; ShareIndex < ShareCosts.Num(); ++ShareIndex )
+		{
+			if ( ShareCosts[ShareIndex] < ShareCosts[LightestShare] )
+			{
+				LightestShare = ShareIndex;
+			}
+		}
+		ShareIndices[LightestShare].Append( Clusters[ClusterIndex] );
+		ShareCosts[LightestShare] += ClusterCosts[ClusterIndex];
+	}
+
+	OutShares.Empty( ShareIndices.Num() );
+	for ( auto& Indices : ShareIndices )
+	{
+		// cook the share in the order the packages were requested in
+		Indices.Sort();
+
+		TArray<FName>& Share = *new(OutShares) TArray<FName>();
+		Share.Reserve( Indices.Num() );
+		for ( const int32 PackageIndex : Indices )
+		{
+			Share.Add( PackageFilenames[PackageIndex] );
+		}
+	}
+}
+
+int32 FCookWorkerCoordinator::LaunchWorkers(const TArray<TArray<FName>>& Shares, const FString& WorkerParams)
+{
+	const FString WorkerDirectory = FPaths::ConvertRelativePathToFull( FPaths::GameIntermediateDir() / TEXT("CookWorkers") );
+	IFileManager::Get().MakeDirectory( *WorkerDirectory, true );
+
+	const FString ProjectPath = FPaths::IsProjectFilePathSet() ? FString::Printf( TEXT("\"%s\""), *FPaths::ConvertRelativePathToFull( FPaths::GetProjectFilePath() ) ) : FString( FApp::GetGameName() );
+
+	int32 NumLaunched = 0;
+	for ( const auto& Share : Shares )
+	{
+		if ( Share.Num() == 0 )
+		{
+			continue;
+		}
+
+		const int32 WorkerIndex = Workers.Num();
+		FWorker& Worker = Workers[Workers.AddDefaulted()];
+		Worker.Packages = Share;
+
+		FString PackageList;
+		for ( const auto& PackageFilename : Share )
+		{
+			PackageList += PackageFilename.ToString();
+			PackageList += LINE_TERMINATOR;
+		}
+
+		const FString PackageListFilename = WorkerDirectory / FString::Printf( TEXT("Worker%d.txt"), WorkerIndex );
+		const FString LogFilename = WorkerDirectory / FString::Printf( TEXT("Worker%d.log"), WorkerIndex );
+		if ( !FFileHelper::SaveStringToFile( PackageList, *PackageListFilename ) )
+		{
+			UE_LOG( LogCookWorkers, Warning, TEXT("Unable to write the package list of cook worker %d to %s"), WorkerIndex, *PackageListFilename );
+			continue;
+		}
+
+		// the worker options go first so that they win over anything the coordinator was given
+		const FString Params = FString::Printf( TEXT("-CookWorkerList=\"%s\" -abslog=\"%s\" -stdout -unattended -NoLogTimes -UTF8Output %s"), *PackageListFilename, *LogFilename, *WorkerParams );
+
+		if ( !FPlatformProcess::CreatePipe( Worker.ReadPipe, Worker.WritePipe ) )
+		{
+			UE_LOG( LogCookWorkers, Warning, TEXT("Unable to create the output pipe of cook worker %d"), WorkerIndex );
+			continue;
+		}
+
+		Worker.ProcessHandle = CommandletHelpers::CreateCommandletProcess( TEXT("cook"), *ProjectPath, *Params, false, true, true, nullptr, 0, nullptr, Worker.WritePipe );
+		if ( !Worker.ProcessHandle.IsValid() )
+		{
+			UE_LOG( LogCookWorkers, Warning, TEXT("Unable to launch cook worker %d"), WorkerIndex );
+			FPlatformProcess::ClosePipe( Worker.ReadPipe, Worker.WritePipe );
+			Worker.ReadPipe = Worker.WritePipe = nullptr;
+			continue;
+		}
+
+		UE_LOG( LogCookWorkers, Display, TEXT("Launched cook worker %d with %d packages, log %s"), WorkerIndex, Share.Num(), *LogFilename );
+		Worker.bRunning = true;
+		++NumLaunched;
+	}
+
+	return NumLaunched;
+}
+
+bool FCookWorkerCoordinator::Tick()
+{
+	bool bAnyRunning = false;
+	for ( int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); ++WorkerIndex )
+	{
+		FWorker& Worker = Workers[WorkerIndex];
+		if ( !Worker.bRunning )
+		{
+			continue;
+		}
+
+		// check before reading so that nothing written before the worker exited is missed
+		const bool bExited = !FPlatformProcess::IsProcRunning( Worker.ProcessHandle );
+		ReadOutput( WorkerIndex );
+
+		if ( !bExited )
+		{
+			bAnyRunning = true;
+			continue;
+		}
+
+		if ( Worker.PendingOutput.Len() )
+		{
+			ProcessOutputLine( WorkerIndex, Worker.PendingOutput );
+			Worker.PendingOutput.Empty();
+		}
+
+		int32 ReturnCode = -1;
+		if ( !FPlatformProcess::GetProcReturnCode( Worker.ProcessHandle, &ReturnCode ) )
+		{
+			ReturnCode = -1;
+		}
+		CloseWorker( Worker );
+		Worker.bRunning = false;
+		Worker.bSucceeded = ( ReturnCode == 0 );
+
+		if ( Worker.bSucceeded )
+		{
+			UE_LOG( LogCookWorkers, Display, TEXT("Cook worker %d finished, cooked %d packages and left %d to the coordinator"), WorkerIndex, Worker.CookedPackages.Num(), Worker.SkippedPackages.Num() );
+		}
+		else
+		{
+			UE_LOG( LogCookWorkers, Warning, TEXT("Cook worker %d failed with return code %d, its %d packages will be cooked by the coordinator"), WorkerIndex, ReturnCode, Worker.Packages.Num() );
+		}
+	}
+	return bAnyRunning;
+}
+
+void FCookWorkerCoordinator::GetCookedPackages(TArray<FName>& OutPackages) const
+{
+	for ( const auto& Worker : Workers )
+	{
+		if ( Worker.bSucceeded )
+		{
+			OutPackages.Append( Worker.CookedPackages );
+		}
+	}
+}
+
+void FCookWorkerCoordinator::GetPackagesToRecook(TArray<FName>& OutPackages) const
+{
+	TSet<FName> CookedPackages;
+	for ( const auto& Worker : Workers )
+	{
+		if ( Worker.bSucceeded )
+		{
+			CookedPackages.Append( Worker.CookedPackages );
+		}
+	}
+
+	TSet<FName> PackagesToRecook;
+	for ( const auto& Worker : Workers )
+	{
+		for ( const auto& Package : Worker.Packages )
+		{
+			if ( !CookedPackages.Contains( Package ) && !PackagesToRecook.Contains( Package ) )
+			{
+				PackagesToRecook.Add( Package );
+				OutPackages.Add( Package );
+			}
+		}
+		for ( const auto& Package : Worker.SkippedPackages )
+		{
+			if ( !CookedPackages.Contains( Package ) && !PackagesToRecook.Contains( Package ) )
+			{
+				PackagesToRecook.Add( Package );
+				OutPackages.Add( Package );
+			}
+		}
+	}
+}
+
+void FCookWorkerCoordinator::ReadOutput(int32 WorkerIndex)
+{
+	FWorker& Worker = Workers[WorkerIndex];
+	for ( FString Output = FPlatformProcess::ReadPipe( Worker.ReadPipe ); Output.Len(); Output = FPlatformProcess::ReadPipe( Worker.ReadPipe ) )
+	{
+		Worker.PendingOutput += Output;
+	}
+
+	// a read can end in the middle of a line, keep the partial line for the next read
+	int32 LineStart = 0;
+	int32 LineEnd = INDEX_NONE;
+	while ( ( LineEnd = Worker.PendingOutput.Find( TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, LineStart ) ) != INDEX_NONE )
+	{
+		ProcessOutputLine( WorkerIndex, Worker.PendingOutput.Mid( LineStart, LineEnd - LineStart ) );
+		LineStart = LineEnd + 1;
+	}
+	if ( LineStart > 0 )
+	{
+		Worker.PendingOutput = Worker.PendingOutput.Mid( LineStart );
+	}
+}
+
+void FCookWorkerCoordinator::ProcessOutputLine(int32 WorkerIndex, const FString& Line)
+{
+	FWorker& Worker = Workers[WorkerIndex];
+
+	auto ParsePackage = [&Line]( const TCHAR* Tag, TArray<FName>& OutPackages )
+	{
+		const int32 TagIndex = Line.Find( Tag, ESearchCase::CaseSensitive );
+		if ( TagIndex == INDEX_NONE )
+		{
+			return false;
+		}
+		FString PackageFilename = Line.Mid( TagIndex + FCString::Strlen( Tag ) );
+		PackageFilename.Trim();
+		PackageFilename.TrimTrailing();
+		if ( PackageFilename.Len() )
+		{
+			OutPackages.Add( FName( *PackageFilename ) );
+		}
+		return true;
+	};
+
+	if ( ParsePackage( CookedPackageTag, Worker.CookedPackages ) || ParsePackage( SkippedPackageTag, Worker.SkippedPackages ) )
+	{
+		return;
+	}
+
+	// forward the problems of the workers to the coordinator log, the full output is in the log of each worker
+	if ( Line.Contains( TEXT("Error:") ) || Line.Contains( TEXT("Warning:") ) )
+	{
+		FString TrimmedLine = Line;
+		TrimmedLine.TrimTrailing();
+		UE_LOG( LogCookWorkers, Display, TEXT("Worker %d: %s"), WorkerIndex, *TrimmedLine );
+	}
+}
+
+void FCookWorkerCoordinator::CloseWorker(FWorker& Worker)
+{
+	FPlatformProcess::ClosePipe( Worker.ReadPipe, Worker.WritePipe );
+	Worker.ReadPipe = Worker.WritePipe = nullptr;
+	FPlatformProcess::CloseProc( Worker.ProcessHandle );
+}
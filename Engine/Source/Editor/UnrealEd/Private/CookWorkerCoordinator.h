@@ -0,0 +1,96 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	CookWorkerCoordinator.h: Hands the packages of a cook by the book to local worker cook processes.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Splits the packages of a cook by the book into dependency clusters and cooks each share in a worker cook commandlet
+ * launched on this machine. The workers write to the sandbox and derived data cache of the coordinator, report every
+ * package they cooked on their standard output and only save the packages they were handed. The coordinator cooks the
+ * packages the workers loaded without owning them, and every package of a worker that failed.
+ */
+class FCookWorkerCoordinator
+{
+public:
+
+	/** Prefix of the output line a worker writes for each package it cooked */
+	static const TCHAR* CookedPackageTag;
+	/** Prefix of the output line a worker writes for each package it loaded but left to the coordinator */
+	static const TCHAR* SkippedPackageTag;
+
+	FCookWorkerCoordinator();
+	~FCookWorkerCoordinator();
+
+	/**
+	 * Splits packages into shares of similar source size. Packages depending on each other go to the same share unless
+	 * their cluster is larger than a share, in which case the cluster is cut in dependency order.
+	 *
+	 * @param PackageFilenames	standard filenames of the packages to split
+	 * @param NumShares			number of shares to split the packages into
+	 * @param OutShares			receives the standard filenames of each share, in the order of PackageFilenames
+	 */
+	static void PartitionPackages(const TArray<FName>& PackageFilenames, int32 NumShares, TArray<TArray<FName>>& OutShares);
+
+	/**
+	 * Writes the package list of each share and launches a worker cook commandlet for it.
+	 *
+	 * @param Shares			standard filenames of the packages of each worker
+	 * @param WorkerParams		cook commandlet parameters of the workers, the package list is added to them
+	 * @return the number of workers launched, the packages of workers which failed to launch are returned by GetPackagesToRecook
+	 */
+	int32 LaunchWorkers(const TArray<TArray<FName>>& Shares, const FString& WorkerParams);
+
+	/**
+	 * Reads the output of the workers and waits for them to exit.
+	 *
+	 * @return true while any worker is running
+	 */
+	bool Tick();
+
+	/** Gets the packages cooked by the workers which exited successfully */
+	void GetCookedPackages(TArray<FName>& OutPackages) const;
+
+	/** Gets the packages the coordinator has to cook itself: the packages the workers skipped or did not cook, and every package of a failed worker */
+	void GetPackagesToRecook(TArray<FName>& OutPackages) const;
+
+private:
+
+	/** A worker cook process */
+	struct FWorker
+	{
+		FProcHandle ProcessHandle;
+		void* ReadPipe;
+		void* WritePipe;
+		/** Output read from the pipe after the last complete line */
+		FString PendingOutput;
+		/** Packages handed to the worker */
+		TArray<FName> Packages;
+		/** Packages the worker reported as cooked */
+		TArray<FName> CookedPackages;
+		/** Packages the worker reported as skipped */
+		TArray<FName> SkippedPackages;
+		bool bRunning;
+		bool bSucceeded;
+
+		FWorker()
+			: ReadPipe(nullptr)
+			, WritePipe(nullptr)
+			, bRunning(false)
+			, bSucceeded(false)
+		{ }
+	};
+
+	/** Reads the complete lines a worker has written so far */
+	void ReadOutput(int32 WorkerIndex);
+
+	/** Parses a line of the output of a worker */
+	void ProcessOutputLine(int32 WorkerIndex, const FString& Line);
+
+	/** Closes the pipes and the process handle of a worker */
+	void CloseWorker(FWorker& Worker);
+
+	TArray<FWorker> Workers;
+};
@@ -0,0 +1,498 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	CookedPackageHashes.cpp: Hashes of the inputs of cooked packages, used by iterative cooks.
+=============================================================================*/
+
+#include "UnrealEd.h"
+#include "CookedPackageHashes.h"
+#include "AssetRegistryModule.h"
+#include "IPluginManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCookedPackageHashes, Log, All);
+
+namespace CookedPackageHashes
+{
+	/** Identifies a manifest file */
+	static const uint32 ManifestTag = 0x43504B48;
+	/** Version of the manifest file, manifests saved with another version are ignored */
+	static const int32 ManifestVersion = 1;
+
+	/** Adds a string to a hash */
+	static void UpdateWithString(FSHA1& Sha, const FString& String)
+	{
+		Sha.UpdateWithString(*String, String.Len());
+	}
+
+	/** Adds a hash to a hash */
+	static void UpdateWithHash(FSHA1& Sha, const FSHAHash& Hash)
+	{
+		Sha.Update(Hash.Hash, sizeof(Hash.Hash));
+	}
+
+	/** @return the hash accumulated by Sha */
+	static FSHAHash GetHash(FSHA1& Sha)
+	{
+		FSHAHash Hash;
+		Sha.Final();
+		Sha.GetHash(Hash.Hash);
+		return Hash;
+	}
+}
+
+FCookedPackageHashes::FCookedPackageHashes()
+	: bHasShaderSourceHash(false)
+	, bHasScriptSourceHash(false)
+{
+}
+
+void FCookedPackageHashes::LoadPlatform(FName PlatformName, const FString& ManifestFilename, const TArray<FString>& IniVersionStrings)
+{
+	FPlatformManifest& Manifest = Platforms.Add(PlatformName, FPlatformManifest());
+	Manifest.Filename = ManifestFilename;
+
+	// the settings are sorted so that their order in the ini files does not matter
+	TArray<FString> SettingsStrings = IniVersionStrings;
+	SettingsStrings.Add(FString::Printf(TEXT("PackageFileUE4Version:%d"), GPackageFileUE4Version));
+	SettingsStrings.Add(FString::Printf(TEXT("PackageFileLicenseeUE4Version:%d"), GPackageFileLicenseeUE4Version));
+	for (const auto& CustomVersion : FCustomVersionContainer::GetRegistered().GetAllVersions())
+	{
+		SettingsStrings.Add(FString::Printf(TEXT("CustomVersion:%s:%d"), *CustomVersion.Key.ToString(), CustomVersion.Version));
+	}
+	SettingsStrings.Sort();
+
+	FSHA1 Sha;
+	for (const auto& SettingsString : SettingsStrings)
+	{
+		CookedPackageHashes::UpdateWithString(Sha, SettingsString);
+	}
+	Manifest.SettingsHash = CookedPackageHashes::GetHash(Sha);
+
+	TArray<uint8> ManifestData;
+	if (!FFileHelper::LoadFileToArray(ManifestData, *ManifestFilename, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Ar(ManifestData);
+	uint32 Tag = 0;
+	int32 Version = 0;
+	Ar << Tag << Version;
+	if (Tag != CookedPackageHashes::ManifestTag || Version != CookedPackageHashes::ManifestVersion)
+	{
+		UE_LOG(LogCookedPackageHashes, Display, TEXT("Ignoring cooked package hashes %s saved with another version."), *ManifestFilename);
+		return;
+	}
+
+	Ar << Manifest.Packages;
+	if (Ar.IsError())
+	{
+		UE_LOG(LogCookedPackageHashes, Warning, TEXT("Failed to read cooked package hashes %s, every package of %s will be recooked."), *ManifestFilename, *PlatformName.ToString());
+		Manifest.Packages.Empty();
+	}
+}
+
+void FCookedPackageHashes::SavePlatforms()
+{
+	for (auto& Platform : Platforms)
+	{
+		FPlatformManifest& Manifest = Platform.Value;
+		if (!Manifest.bDirty)
+		{
+			continue;
+		}
+
+		TArray<uint8> ManifestData;
+		FMemoryWriter Ar(ManifestData);
+		uint32 Tag = CookedPackageHashes::ManifestTag;
+		int32 Version = CookedPackageHashes::ManifestVersion;
+		Ar << Tag << Version;
+		Ar << Manifest.Packages;
+
+		if (FFileHelper::SaveArrayToFile(ManifestData, *Manifest.Filename))
+		{
+			Manifest.bDirty = false;
+		}
+		else
+		{
+			UE_LOG(LogCookedPackageHashes, Warning, TEXT("Failed to save cooked package hashes %s, the next iterative cook will recook every package of %s."), *Manifest.Filename, *Platform.Key.ToString());
+		}
+	}
+}
+
+void FCookedPackageHashes::ClearPlatform(FName PlatformName)
+{
+	FPlatformManifest* Manifest = Platforms.Find(PlatformName);
+	if (Manifest && Manifest->Packages.Num())
+	{
+		Manifest->Packages.Empty();
+		Manifest->bDirty = true;
+	}
+}
+
+void FCookedPackageHashes::ResetPackageInputs()
+{
+	PackageInputs.Empty();
+	bHasShaderSourceHash = false;
+	bHasScriptSourceHash = false;
+}
+
+ECookedPackageRecookReason::Type FCookedPackageHashes::GetRecookReason(FName PlatformName, FName PackageName)
+{
+	const FPlatformManifest& Manifest = Platforms.FindChecked(PlatformName);
+
+	const FCookedPackageHash* CookedHash = Manifest.Packages.Find(PackageName.ToString());
+	if (CookedHash == nullptr)
+	{
+		return ECookedPackageRecookReason::NotInManifest;
+	}
+
+	if (CookedHash->SettingsHash != Manifest.SettingsHash)
+	{
+		return ECookedPackageRecookReason::SettingsChanged;
+	}
+
+	const FCookedPackageHash& CurrentHash = GetPackageInputs(PackageName).Hash;
+	if (CookedHash->SourceHash != CurrentHash.SourceHash)
+	{
+		return ECookedPackageRecookReason::SourceChanged;
+	}
+
+	if (CookedHash->DependencyHash != CurrentHash.DependencyHash)
+	{
+		return ECookedPackageRecookReason::DependenciesChanged;
+	}
+
+	return ECookedPackageRecookReason::None;
+}
+
+void FCookedPackageHashes::AddCookedPackage(FName PlatformName, FName PackageName)
+{
+	FPlatformManifest& Manifest = Platforms.FindChecked(PlatformName);
+
+	FCookedPackageHash CookedHash = GetPackageInputs(PackageName).Hash;
+	CookedHash.SettingsHash = Manifest.SettingsHash;
+	Manifest.Packages.Add(PackageName.ToString(), CookedHash);
+	Manifest.bDirty = true;
+}
+
+const TCHAR* FCookedPackageHashes::GetRecookReasonString(ECookedPackageRecookReason::Type Reason)
+{
+	switch (Reason)
+	{
+	case ECookedPackageRecookReason::None:
+		return TEXT("up to date");
+	case ECookedPackageRecookReason::NotInManifest:
+		return TEXT("not in the hashes of the previous cook");
+	case ECookedPackageRecookReason::SettingsChanged:
+		return TEXT("platform settings or engine versions changed");
+	case ECookedPackageRecookReason::SourceChanged:
+		return TEXT("source package changed");
+	case ECookedPackageRecookReason::DependenciesChanged:
+		return TEXT("dependencies changed");
+	default:
+		check(0);
+		return TEXT("");
+	}
+}
+
+const FCookedPackageHashes::FPackageInputs& FCookedPackageHashes::GetPackageInputs(FName PackageName)
+{
+	const FPackageInputs* Inputs = PackageInputs.Find(PackageName);
+	if (Inputs == nullptr)
+	{
+		VisitPackage(PackageName);
+		check(VisitStack.Num() == 0);
+		Visits.Reset();
+		VisitIndices.Reset();
+
+		Inputs = &PackageInputs.FindChecked(PackageName);
+	}
+	return *Inputs;
+}
+
+void FCookedPackageHashes::VisitPackage(FName PackageName)
+{
+	// Tarjan's algorithm: packages depending on each other are hashed together, once every package they depend on is hashed
+	TArray<int32> WalkStack;
+	WalkStack.Push(BeginVisit(PackageName));
+
+	while (WalkStack.Num())
+	{
+		const int32 VisitIndex = WalkStack.Top();
+
+		// look at the dependencies until one needs visiting first
+		bool bVisitedDependency = false;
+		while (!bVisitedDependency && Visits[VisitIndex].NextDependency < Visits[VisitIndex].Dependencies.Num())
+		{
+			const FName Dependency = Visits[VisitIndex].Dependencies[Visits[VisitIndex].NextDependency++];
+			if (Dependency == Visits[VisitIndex].PackageName || PackageInputs.Contains(Dependency))
+			{
+				continue;
+			}
+
+			const int32* DependencyVisitIndex = VisitIndices.Find(Dependency);
+			if (DependencyVisitIndex == nullptr)
+			{
+				WalkStack.Push(BeginVisit(Dependency));
+				bVisitedDependency = true;
+			}
+			else if (Visits[*DependencyVisitIndex].bOnStack)
+			{
+				Visits[VisitIndex].LowLink = FMath::Min(Visits[VisitIndex].LowLink, *DependencyVisitIndex);
+			}
+		}
+		if (bVisitedDependency)
+		{
+			continue;
+		}
+
+		WalkStack.Pop();
+
+		if (Visits[VisitIndex].LowLink == VisitIndex)
+		{
+			TArray<int32> ComponentVisits;
+			int32 ComponentVisit;
+			do
+			{
+				ComponentVisit = VisitStack.Pop();
+				Visits[ComponentVisit].bOnStack = false;
+				ComponentVisits.Add(ComponentVisit);
+			}
+			while (ComponentVisit != VisitIndex);
+
+			AddComponentInputs(ComponentVisits);
+		}
+
+		// the package that depends on this one takes its low link, as a return from the recursive algorithm would
+		if (WalkStack.Num())
+		{
+			FVisit& ParentVisit = Visits[WalkStack.Top()];
+			ParentVisit.LowLink = FMath::Min(ParentVisit.LowLink, Visits[VisitIndex].LowLink);
+		}
+	}
+}
+
+int32 FCookedPackageHashes::BeginVisit(FName PackageName)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	const int32 VisitIndex = Visits.Add(FVisit(PackageName, Visits.Num()));
+	VisitIndices.Add(PackageName, VisitIndex);
+	VisitStack.Push(VisitIndex);
+
+	AssetRegistry.GetDependencies(PackageName, Visits[VisitIndex].Dependencies);
+	return VisitIndex;
+}
+
+void FCookedPackageHashes::AddComponentInputs(const TArray<int32>& ComponentVisits)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	static const FName ShaderClassNames[] = { FName(TEXT("Material")), FName(TEXT("MaterialInstanceConstant")), FName(TEXT("MaterialInstanceDynamic")), FName(TEXT("LandscapeMaterialInstanceConstant")) };
+	static const FName ScriptClassNames[] = { FName(TEXT("Blueprint")), FName(TEXT("AnimBlueprint")) };
+
+	TArray<FName> ComponentPackages;
+	TArray<FName> ExternalDependencies;
+	TMap<FName, FCookedPackageHash> SourceHashes;
+	bool bUsesShaderSource = false;
+	bool bUsesScriptSource = false;
+
+	for (const int32 VisitIndex : ComponentVisits)
+	{
+		ComponentPackages.Add(Visits[VisitIndex].PackageName);
+	}
+
+	for (const int32 VisitIndex : ComponentVisits)
+	{
+		const FVisit& Visit = Visits[VisitIndex];
+
+		HashPackageSource(Visit.PackageName, SourceHashes.Add(Visit.PackageName, FCookedPackageHash()));
+
+		for (const FName Dependency : Visit.Dependencies)
+		{
+			if (Dependency != Visit.PackageName && !ComponentPackages.Contains(Dependency))
+			{
+				ExternalDependencies.AddUnique(Dependency);
+			}
+		}
+
+		// cooked materials contain their shader maps, and blueprints are compiled against native classes
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPackageName(Visit.PackageName, Assets);
+		for (const auto& Asset : Assets)
+		{
+			for (const FName ShaderClassName : ShaderClassNames)
+			{
+				bUsesShaderSource |= Asset.AssetClass == ShaderClassName;
+			}
+			for (const FName ScriptClassName : ScriptClassNames)
+			{
+				bUsesScriptSource |= Asset.AssetClass == ScriptClassName;
+			}
+		}
+	}
+
+	// every package of the component depends on the dependencies of the others
+	ExternalDependencies.Sort();
+	FSHA1 ExternalSha;
+	for (const FName Dependency : ExternalDependencies)
+	{
+		CookedPackageHashes::UpdateWithString(ExternalSha, Dependency.ToString());
+		CookedPackageHashes::UpdateWithHash(ExternalSha, PackageInputs.FindChecked(Dependency).InputHash);
+	}
+	if (bUsesShaderSource)
+	{
+		CookedPackageHashes::UpdateWithHash(ExternalSha, GetShaderSourceHash());
+	}
+	if (bUsesScriptSource)
+	{
+		CookedPackageHashes::UpdateWithHash(ExternalSha, GetScriptSourceHash());
+	}
+	const FSHAHash ExternalHash = CookedPackageHashes::GetHash(ExternalSha);
+
+	ComponentPackages.Sort();
+	for (const FName PackageName : ComponentPackages)
+	{
+		FPackageInputs Inputs;
+		Inputs.Hash = SourceHashes.FindChecked(PackageName);
+
+		FSHA1 DependencySha;
+		CookedPackageHashes::UpdateWithHash(DependencySha, ExternalHash);
+		for (const FName OtherPackageName : ComponentPackages)
+		{
+			if (OtherPackageName != PackageName)
+			{
+				CookedPackageHashes::UpdateWithString(DependencySha, OtherPackageName.ToString());
+				CookedPackageHashes::UpdateWithHash(DependencySha, SourceHashes.FindChecked(OtherPackageName).SourceHash);
+			}
+		}
+		Inputs.Hash.DependencyHash = CookedPackageHashes::GetHash(DependencySha);
+
+		FSHA1 InputSha;
+		CookedPackageHashes::UpdateWithString(InputSha, PackageName.ToString());
+		CookedPackageHashes::UpdateWithHash(InputSha, Inputs.Hash.SourceHash);
+		CookedPackageHashes::UpdateWithHash(InputSha, Inputs.Hash.DependencyHash);
+		Inputs.InputHash = CookedPackageHashes::GetHash(InputSha);
+
+		PackageInputs.Add(PackageName, Inputs);
+	}
+}
+
+void FCookedPackageHashes::HashPackageSource(FName PackageName, FCookedPackageHash& OutHash) const
+{
+	const FString LongPackageName = PackageName.ToString();
+
+	// script packages have no source file, native code changes are covered by the engine versions and the script source hash
+	FString Filename;
+	if (!FPackageName::DoesPackageExist(LongPackageName, NULL, &Filename))
+	{
+		FSHA1 Sha;
+		CookedPackageHashes::UpdateWithString(Sha, LongPackageName);
+		OutHash.SourceHash = CookedPackageHashes::GetHash(Sha);
+		return;
+	}
+
+	OutHash.SourceTimeStamp = IFileManager::Get().GetTimeStamp(*Filename);
+	OutHash.SourceSize = IFileManager::Get().FileSize(*Filename);
+
+	for (const auto& Platform : Platforms)
+	{
+		const FCookedPackageHash* CookedHash = Platform.Value.Packages.Find(LongPackageName);
+		if (CookedHash && CookedHash->SourceTimeStamp == OutHash.SourceTimeStamp && CookedHash->SourceSize == OutHash.SourceSize)
+		{
+			OutHash.SourceHash = CookedHash->SourceHash;
+			return;
+		}
+	}
+
+	FSHA1 Sha;
+	if (!UpdateWithFile(Sha, Filename))
+	{
+		UE_LOG(LogCookedPackageHashes, Warning, TEXT("Failed to read %s to hash it."), *Filename);
+		CookedPackageHashes::UpdateWithString(Sha, LongPackageName);
+		OutHash.SourceTimeStamp = FDateTime::MinValue();
+	}
+	OutHash.SourceHash = CookedPackageHashes::GetHash(Sha);
+}
+
+const FSHAHash& FCookedPackageHashes::GetShaderSourceHash()
+{
+	if (!bHasShaderSourceHash)
+	{
+		TArray<FString> Directories;
+		Directories.Add(FPlatformProcess::ShaderDir());
+		ShaderSourceHash = HashSourceFiles(Directories, TEXT("usf"));
+		bHasShaderSourceHash = true;
+	}
+	return ShaderSourceHash;
+}
+
+const FSHAHash& FCookedPackageHashes::GetScriptSourceHash()
+{
+	if (!bHasScriptSourceHash)
+	{
+		TArray<FString> Directories;
+		Directories.Add(FPaths::EngineDir() / TEXT("Source") / TEXT("Runtime"));
+		Directories.Add(FPaths::GameDir() / TEXT("Source"));
+
+		// blueprints compile against plugin classes too, plugins are added by name so that the order does not depend on the plugin directories
+		TArray<FPluginStatus> Plugins = IPluginManager::Get().QueryStatusForAllPlugins();
+		Plugins.Sort([](const FPluginStatus& A, const FPluginStatus& B) { return A.Name < B.Name; });
+		for (const auto& Plugin : Plugins)
+		{
+			if (Plugin.bIsEnabled)
+			{
+				Directories.Add(Plugin.PluginDirectory / TEXT("Source"));
+			}
+		}
+
+		ScriptSourceHash = HashSourceFiles(Directories, TEXT("h"));
+		bHasScriptSourceHash = true;
+	}
+	return ScriptSourceHash;
+}
+
+FSHAHash FCookedPackageHashes::HashSourceFiles(const TArray<FString>& Directories, const TCHAR* Extension)
+{
+	FSHA1 Sha;
+	for (const auto& Directory : Directories)
+	{
+		TArray<FString> Filenames;
+		IFileManager::Get().FindFilesRecursive(Filenames, *Directory, *FString::Printf(TEXT("*.%s"), Extension), true, false);
+		Filenames.Sort();
+
+		for (const auto& Filename : Filenames)
+		{
+			FString RelativeFilename = Filename;
+			FPaths::MakePathRelativeTo(RelativeFilename, *(Directory / TEXT("")));
+			CookedPackageHashes::UpdateWithString(Sha, RelativeFilename);
+			UpdateWithFile(Sha, Filename);
+		}
+	}
+	return CookedPackageHashes::GetHash(Sha);
+}
+
+bool FCookedPackageHashes::UpdateWithFile(FSHA1& Sha, const FString& Filename)
+{
+	TAutoPtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	const int64 BufferSize = 1024 * 1024;
+	TArray<uint8> Buffer;
+	Buffer.AddUninitialized(BufferSize);
+
+	int64 Remaining = Reader->TotalSize();
+	while (Remaining > 0)
+	{
+		const int64 ReadSize = FMath::Min(Remaining, BufferSize);
+		Reader->Serialize(Buffer.GetData(), ReadSize);
+		Sha.Update(Buffer.GetData(), (uint32)ReadSize);
+		Remaining -= ReadSize;
+	}
+
+	return !Reader->IsError();
+}
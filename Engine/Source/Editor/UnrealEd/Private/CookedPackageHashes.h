@@ -0,0 +1,192 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	CookedPackageHashes.h: Hashes of the inputs of cooked packages, used by iterative cooks.
+=============================================================================*/
+
+#pragma once
+
+#include "SecureHash.h"
+
+/** Why an iterative cook has to recook a package */
+namespace ECookedPackageRecookReason
+{
+	enum Type
+	{
+		/** The cooked package is up to date */
+		None,
+		/** The previous cook did not record the inputs of the package */
+		NotInManifest,
+		/** The target platform settings or the engine versions changed */
+		SettingsChanged,
+		/** The source package changed */
+		SourceChanged,
+		/** A package the package depends on, or the shader or script source it uses, changed */
+		DependenciesChanged,
+
+		Max
+	};
+}
+
+/** The hashes of the inputs of a cooked package */
+struct FCookedPackageHash
+{
+	/** Timestamp of the source package when SourceHash was computed */
+	FDateTime SourceTimeStamp;
+	/** Size of the source package when SourceHash was computed */
+	int64 SourceSize;
+	/** Hash of the bytes of the source package */
+	FSHAHash SourceHash;
+	/** Hash of the input hashes of the packages the package depends on, and of the shader or script source it uses */
+	FSHAHash DependencyHash;
+	/** Hash of the target platform settings and the engine versions */
+	FSHAHash SettingsHash;
+
+	FCookedPackageHash()
+		: SourceTimeStamp(FDateTime::MinValue())
+		, SourceSize(-1)
+	{ }
+
+	friend FArchive& operator<<(FArchive& Ar, FCookedPackageHash& Hash)
+	{
+		return Ar << Hash.SourceTimeStamp << Hash.SourceSize << Hash.SourceHash << Hash.DependencyHash << Hash.SettingsHash;
+	}
+};
+
+/**
+ * Keys each cooked package of each target platform on a hash of its source bytes, of the hashes of the packages it
+ * depends on, of the target platform settings and of the engine versions. The hashes of the packages cooked for a
+ * platform are persisted in a manifest next to its cooked output, so that the next iterative cook only recooks the
+ * packages whose inputs changed. Touching or re-syncing a package without changing its bytes does not recook anything.
+ */
+class FCookedPackageHashes
+{
+public:
+
+	FCookedPackageHashes();
+
+	/**
+	 * Loads the manifest a previous cook saved for a platform and hashes the current settings of the platform.
+	 *
+	 * @param PlatformName			name of the target platform
+	 * @param ManifestFilename		file the manifest of the platform is loaded from and saved to
+	 * @param IniVersionStrings		the versioned ini settings of the platform
+	 */
+	void LoadPlatform(FName PlatformName, const FString& ManifestFilename, const TArray<FString>& IniVersionStrings);
+
+	/** @return true if LoadPlatform was called for a platform */
+	bool IsPlatformLoaded(FName PlatformName) const
+	{
+		return Platforms.Contains(PlatformName);
+	}
+
+	/** Saves the manifests of the platforms which recorded or forgot packages since they were loaded */
+	void SavePlatforms();
+
+	/** Forgets the packages recorded for a platform, when its cooked output is deleted */
+	void ClearPlatform(FName PlatformName);
+
+	/**
+	 * Forgets the hashes computed for the source packages. They are computed again, reusing the source hash of the
+	 * packages whose timestamp and size did not change, the next time they are needed.
+	 */
+	void ResetPackageInputs();
+
+	/**
+	 * Compares the current inputs of a package with the ones recorded when it was cooked for a platform.
+	 *
+	 * @param PlatformName		name of a loaded target platform
+	 * @param PackageName		long name of the package
+	 * @return why the package has to be recooked, or ECookedPackageRecookReason::None if its cooked package is up to date
+	 */
+	ECookedPackageRecookReason::Type GetRecookReason(FName PlatformName, FName PackageName);
+
+	/** Records the current inputs of a package which was cooked for a loaded platform */
+	void AddCookedPackage(FName PlatformName, FName PackageName);
+
+	/** @return the description of a recook reason used in the log */
+	static const TCHAR* GetRecookReasonString(ECookedPackageRecookReason::Type Reason);
+
+private:
+
+	/** The manifest of a target platform */
+	struct FPlatformManifest
+	{
+		FString Filename;
+		/** Hash of the current settings of the platform */
+		FSHAHash SettingsHash;
+		/** Inputs of the cooked packages, by long package name */
+		TMap<FString, FCookedPackageHash> Packages;
+		/** True if packages were recorded or forgotten since the manifest was loaded */
+		bool bDirty;
+
+		FPlatformManifest()
+			: bDirty(false)
+		{ }
+	};
+
+	/** The current inputs of a source package */
+	struct FPackageInputs
+	{
+		FCookedPackageHash Hash;
+		/** Hash of the name, source hash and dependency hash of the package, which the packages depending on it hash */
+		FSHAHash InputHash;
+	};
+
+	/** State of a package while the strongly connected components of the dependency graph are searched */
+	struct FVisit
+	{
+		FName PackageName;
+		int32 LowLink;
+		bool bOnStack;
+		TArray<FName> Dependencies;
+		/** Index of the next dependency to look at while the package is on the walk stack */
+		int32 NextDependency;
+
+		FVisit(FName InPackageName, int32 InLowLink)
+			: PackageName(InPackageName)
+			, LowLink(InLowLink)
+			, bOnStack(true)
+			, NextDependency(0)
+		{ }
+	};
+
+	/** Computes the inputs of a package and of every package it depends on */
+	const FPackageInputs& GetPackageInputs(FName PackageName);
+
+	/** Visits a package and the packages it depends on, and computes the inputs of each strongly connected component found. Walks with an explicit stack, long dependency chains can't overflow the call stack */
+	void VisitPackage(FName PackageName);
+
+	/** Starts visiting a package: adds its visit, pushes it on the component stack and queries its dependencies. @return the index of the visit */
+	int32 BeginVisit(FName PackageName);
+
+	/** Computes the inputs of the packages of a strongly connected component, whose dependencies outside the component are computed */
+	void AddComponentInputs(const TArray<int32>& ComponentVisits);
+
+	/** Hashes the bytes of the source file of a package, or reuses the hash a manifest recorded for the same timestamp and size */
+	void HashPackageSource(FName PackageName, FCookedPackageHash& OutHash) const;
+
+	/** @return the hash of every shader source file, computed once */
+	const FSHAHash& GetShaderSourceHash();
+
+	/** @return the hash of every engine runtime, game and enabled plugin header, computed once */
+	const FSHAHash& GetScriptSourceHash();
+
+	/** Hashes the relative names and the bytes of the files with an extension below some directories */
+	static FSHAHash HashSourceFiles(const TArray<FString>& Directories, const TCHAR* Extension);
+
+	/** Adds the bytes of a file to a hash */
+	static bool UpdateWithFile(FSHA1& Sha, const FString& Filename);
+
+	TMap<FName, FPlatformManifest> Platforms;
+	TMap<FName, FPackageInputs> PackageInputs;
+
+	TArray<FVisit> Visits;
+	TMap<FName, int32> VisitIndices;
+	TArray<int32> VisitStack;
+
+	FSHAHash ShaderSourceHash;
+	bool bHasShaderSourceHash;
+	FSHAHash ScriptSourceHash;
+	bool bHasScriptSourceHash;
+};
@@ -53,6 +53,7 @@ public class UnrealEd : ModuleRules
                 "SuperSearch",
 				"OutputLog",
 				"Landscape",
+				"TextureCompressor",
 			}
 		);
 
@@ -102,6 +103,7 @@ public class UnrealEd : ModuleRules
 				"PropertyEditor",
 				"Projects",
 				"RawMesh",
+				"ImageCore",
 				"RenderCore", 
 				"RHI", 
 				"ShaderCore", 
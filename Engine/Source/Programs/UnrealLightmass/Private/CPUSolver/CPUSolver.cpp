@@ -26,6 +26,9 @@ bool GDebugMode = false;
 /** How many tasks to prefetch per worker thread. */
 float GNumTasksPerThreadPrefetch = 1.0f;
 
+/** Whether the aggregate mesh is ray traced with the BVH (-bvh) instead of the kDOP. */
+bool GUseBVH = false;
+
 /** Report statistics back to Unreal. */
 void ReportStatistics()
 {
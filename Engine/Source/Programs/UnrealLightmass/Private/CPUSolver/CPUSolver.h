@@ -107,6 +107,9 @@ extern bool GReportDetailedStats;
  */
 extern bool GDebugMode;
 
+/** Whether the aggregate mesh is ray traced with the BVH (-bvh) instead of the kDOP. */
+extern bool GUseBVH;
+
 } //namespace Lightmass
 
 #endif
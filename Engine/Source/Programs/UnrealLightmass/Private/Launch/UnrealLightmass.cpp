@@ -119,12 +119,13 @@ int LightmassMain(int argc, ANSICHAR* argv[])
 	{
 		if ((FCStringAnsi::Stricmp(argv[ArgIndex], "-help") == 0) || (FCStringAnsi::Stricmp(argv[ArgIndex], "-?") == 0))
 		{
-			UE_LOG(LogLightmass, Display, TEXT("Usage:\n  UnrealLightmass\n\t[SceneGuid]\n\t[-debug]\n\t[-unittest]\n\t[-dumptex]\n\t[-numthreads N]\n\t[-compare Dir1 Dir2 [-error N]]"));
+			UE_LOG(LogLightmass, Display, TEXT("Usage:\n  UnrealLightmass\n\t[SceneGuid]\n\t[-debug]\n\t[-unittest]\n\t[-dumptex]\n\t[-numthreads N]\n\t[-bvh]\n\t[-compare Dir1 Dir2 [-error N]]"));
 			UE_LOG(LogLightmass, Display, TEXT(""));
 			UE_LOG(LogLightmass, Display, TEXT("  SceneGuid : Guid of a scene file. 0x0000012300004567000089AB0000CDEF is the default"));
 			UE_LOG(LogLightmass, Display, TEXT("  -debug : Processes all mappings in the scene, instead of getting tasks from Swarm Coordinator"));
 			UE_LOG(LogLightmass, Display, TEXT("  -unittest : Runs a series of validations, then quits"));
 			UE_LOG(LogLightmass, Display, TEXT("  -dumptex : Outputs .bmp files to the current directory of 2D lightmap/shadowmap results"));
+			UE_LOG(LogLightmass, Display, TEXT("  -bvh : Ray traces the scene with a 4-wide BVH instead of the kDOP"));
 			UE_LOG(LogLightmass, Display, TEXT("  -compare : Compares the binary dumps created by UnrealEd to compare Unreal vs LM lighting runs"));
 			UE_LOG(LogLightmass, Display, TEXT("  -error : Controls the threshold that an error is counted when comparing with -compare"));
 			return 0;
@@ -146,6 +147,10 @@ int LightmassMain(int argc, ANSICHAR* argv[])
 		{
 			GReportDetailedStats = true;
 		}
+		else if (FCStringAnsi::Stricmp(argv[ArgIndex], "-bvh") == 0)
+		{
+			GUseBVH = true;
+		}
 		else if (FCStringAnsi::Stricmp(argv[ArgIndex], "-numthreads") == 0)
 		{
 			// use the next parameter as the number of threads (it must exist, or we fail)
@@ -152,12 +152,24 @@ void FStaticLightingAggregateMesh::ReserveMemory( int32 NumMeshes, int32 NumVert
 
 void FStaticLightingAggregateMesh::PrepareForRaytracing()
 {
-	// Build the kDOP for simple meshes.
-	kDopTree.Build(kDOPTriangles);
+	if (GUseBVH)
+	{
+		// Build the BVH instead of the kDOP, both use the same triangles and payloads.
+		BVHTree.Build(kDOPTriangles);
+
+		// Log information about the aggregate mesh.
+		UE_LOG(LogLightmass, Log, TEXT("Static lighting BVH: %u nodes, %u leaves, %u triangles, %u vertices"), GBVHNodes, GBVHNumLeaves, GBVHTriangles, Vertices.Num());
+		UE_LOG(LogLightmass, Log, TEXT("Static lighting BVH: %.3f%% wasted space in leaves"), ((GBVHTriangles - kDOPTriangles.Num()) / (float)GBVHTriangles) * 100.0f);
+	}
+	else
+	{
+		// Build the kDOP for simple meshes.
+		kDopTree.Build(kDOPTriangles);
 
-	// Log information about the aggregate mesh.
-	UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %u nodes, %u leaves, %u triangles, %u vertices"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num());
-	UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %.3f%% wasted space in leaves"), ((GKDOPTriangles - kDOPTriangles.Num()) / (float)GKDOPTriangles) * 100.0f);
+		// Log information about the aggregate mesh.
+		UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %u nodes, %u leaves, %u triangles, %u vertices"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num());
+		UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %.3f%% wasted space in leaves"), ((GKDOPTriangles - kDOPTriangles.Num()) / (float)GKDOPTriangles) * 100.0f);
+	}
 
 	kDOPTriangles.Empty();
 	TrianglePayloads.Shrink();
@@ -167,6 +179,8 @@ void FStaticLightingAggregateMesh::DumpStats() const
 {
 	const uint64 kDOPTreeBytes = kDopTree.Nodes.GetAllocatedSize() 
 		+ kDopTree.SOATriangles.GetAllocatedSize()
+		+ BVHTree.Nodes.GetAllocatedSize()
+		+ BVHTree.SOATriangles.GetAllocatedSize()
 		+ kDOPTriangles.GetAllocatedSize()
 		+ TrianglePayloads.GetAllocatedSize()
 		+ MeshInfos.GetAllocatedSize()
@@ -176,13 +190,27 @@ void FStaticLightingAggregateMesh::DumpStats() const
 
 	UE_LOG(LogLightmass, Log, TEXT("kDopTree.Nodes        : %7.1fMb"), kDopTree.Nodes.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("kDopTree.SOATriangles : %7.1fMb"), kDopTree.SOATriangles.GetAllocatedSize() / 1048576.0f);
+	UE_LOG(LogLightmass, Log, TEXT("BVHTree.Nodes         : %7.1fMb"), BVHTree.Nodes.GetAllocatedSize() / 1048576.0f);
+	UE_LOG(LogLightmass, Log, TEXT("BVHTree.SOATriangles  : %7.1fMb"), BVHTree.SOATriangles.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("kDOPTriangles         : %7.1fMb"), kDOPTriangles.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("TrianglePayloads      : %7.1fMb"), TrianglePayloads.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("MeshInfos             : %7.1fMb"), MeshInfos.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("Vertices              : %7.1fMb"), Vertices.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("UVs                   : %7.1fMb"), UVs.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("LightmapUVs           : %7.1fMb"), LightmapUVs.GetAllocatedSize() / 1048576.0f);
-	UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %u nodes, %u leaves, %u triangles, %u vertices, %.1f Mb"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num(), kDOPTreeBytes / 1048576.0f);
+	if (GUseBVH)
+	{
+		UE_LOG(LogLightmass, Log, TEXT("Static lighting BVH: %u nodes, %u leaves, %u triangles, %u vertices, %.1f Mb"), GBVHNodes, GBVHNumLeaves, GBVHTriangles, Vertices.Num(), kDOPTreeBytes / 1048576.0f);
+	}
+	else
+	{
+		UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %u nodes, %u leaves, %u triangles, %u vertices, %.1f Mb"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num(), kDOPTreeBytes / 1048576.0f);
+	}
+}
+
+const TCHAR* FStaticLightingAggregateMesh::GetAccelerationStructureName() const
+{
+	return GUseBVH ? TEXT("BVH") : TEXT("kDOP");
 }
 
 FBox FStaticLightingAggregateMesh::GetBounds() const
@@ -341,97 +369,17 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 			ClosestIntersection.bIntersects = false;
 		}
 
-		// Check the kDOP containing low polygon meshes first.
 		FHitResult Result;
-		FStaticLightingAggregateMeshDataProvider kDOPDataProvider(this, ClippedLightRay);
-		TkDOPLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32> kDOPCheck(
-			ClippedLightRay.Start,
-			ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length,
-			bFindClosestIntersection,
-			(LightRay.TraceFlags & LIGHTRAY_STATIC_AND_OPAQUEONLY) != 0,
-			!bDirectShadowingRay,
-			(LightRay.TraceFlags & LIGHTRAY_FLIP_SIDEDNESS) != 0,
-			kDOPDataProvider,
-			LightRay.Mapping ? LightRay.Mapping->Mesh->MeshIndex : INDEX_NONE,
-			LightRay.Mapping ? LightRay.Mapping->Mesh->GetLODIndex() : INDEX_NONE,
-			&Result);
-
-		bool bHit = false; 
-		if (!bFindClosestIntersection && CoherentRayCache.kDOPNodeIndex != 0xFFFFFFFF)
-		{
-			TTraversalHistory<uint32> History;
-			// Trace against the last hit node if we're doing a boolean visibility check before traversing the whole tree
-			// Provides a small speedup with coherent boolean visibility rays (1.1x faster for precomputed visibility)
-			bHit = kDopTree.Nodes[CoherentRayCache.kDOPNodeIndex].LineCheck(kDOPCheck, History.AddNode(CoherentRayCache.kDOPNodeIndex));
-		}
-
-		if (!bHit)
+		FVector4 HitNormal;
+		if (LineCheck(LightRay, ClippedLightRay, bFindClosestIntersection, bDirectShadowingRay, CoherentRayCache, Result, HitNormal))
 		{
-			bHit = kDopTree.LineCheck(kDOPCheck);
-		}
-
-		if (bHit)
-		{
-			// Setup a vertex to represent the intersection.
-			FStaticLightingVertex IntersectionVertex;
-			IntersectionVertex.WorldPosition = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length * Result.Time;
-			IntersectionVertex.WorldTangentZ = kDOPCheck.LocalHitNormal;
-			const FTriangleSOAPayload& Payload = TrianglePayloads[ Result.Item ];
-			const FVector4& v1 = kDOPDataProvider.GetVertex(Payload.VertexIndex[0]);
-			const FVector4& v2 = kDOPDataProvider.GetVertex(Payload.VertexIndex[1]);
-			const FVector4& v3 = kDOPDataProvider.GetVertex(Payload.VertexIndex[2]);
-			const FVector4 LocalHitPosition = kDOPCheck.LocalStart + kDOPCheck.LocalDir * Result.Time;
-			FVector4 BaryCentricWeights;
-			//@todo - why is such a huge tolerance needed?  Reuse the barycentric coords calculated by the ray-triangle intersection instead of deriving them from the hit position.
-			//@todo - why does this sometimes fail if there was an intersection?
-			if (bFindClosestIntersection && GetBarycentricWeights(v1, v2, v3, LocalHitPosition, KINDA_SMALL_NUMBER * 100.0f, BaryCentricWeights))
-			{
-				const FVector2D& UV1 = kDOPDataProvider.GetUV(Payload.VertexIndex[0]);
-				const FVector2D& UV2 = kDOPDataProvider.GetUV(Payload.VertexIndex[1]);
-				const FVector2D& UV3 = kDOPDataProvider.GetUV(Payload.VertexIndex[2]);
-				// Interpolate the material texture coordinates to the intersection point
-				//@todo - only lookup and interpolate UV's if needed
-				IntersectionVertex.TextureCoordinates[0] = UV1 * BaryCentricWeights.X + UV2 * BaryCentricWeights.Y + UV3 * BaryCentricWeights.Z;
-				const FVector2D& LightmapUV1 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[0]);
-				const FVector2D& LightmapUV2 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[1]);
-				const FVector2D& LightmapUV3 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[2]);
-				// Interpolate the lightmap texture coordinates to the intersection point
-				IntersectionVertex.TextureCoordinates[1] = LightmapUV1 * BaryCentricWeights.X + LightmapUV2 * BaryCentricWeights.Y + LightmapUV3 * BaryCentricWeights.Z;
-			}
-			else
-			{
-				IntersectionVertex.TextureCoordinates[0] = FVector2D(0,0);
-				IntersectionVertex.TextureCoordinates[1] = FVector2D(0,0);
-			}
-			// Return the index of the vertex closest to the hit point
-			int32 AbsoluteVertexIndex = Payload.VertexIndex[0];
-			if (BaryCentricWeights.Y > BaryCentricWeights.X)
-			{
-				if (BaryCentricWeights.Z > BaryCentricWeights.Y)
-				{
-					AbsoluteVertexIndex = Payload.VertexIndex[2];
-				}
-				else
-				{
-					AbsoluteVertexIndex = Payload.VertexIndex[1];
-				}
-			}
-			else if (BaryCentricWeights.Z > BaryCentricWeights.X)
-			{
-				AbsoluteVertexIndex = Payload.VertexIndex[2];
-			}
-			// Convert the index into the kDOP tree's vertices into an index into the hit mesh's vertices
-			const int32 RelativeVertexIndex = AbsoluteVertexIndex - Payload.MeshInfo->BaseIndex;
-			checkSlow(RelativeVertexIndex >= 0 && RelativeVertexIndex < Payload.MeshInfo->Mesh->NumVertices);
-			ClosestIntersection = FLightRayIntersection(true, IntersectionVertex, Payload.MeshInfo->Mesh, Payload.Mapping, RelativeVertexIndex, Payload.ElementIndex);
+			GetIntersection(ClippedLightRay, Result, HitNormal, bFindClosestIntersection, ClosestIntersection);
 			if (bFindClosestIntersection)
 			{
 				ClippedLightRay.ClipAgainstIntersectionFromStart(ClosestIntersection.IntersectionVertex.WorldPosition);
 			}
 			else
 			{
-				// Store off the hit node so future boolean visibility rays can test against that first
-				CoherentRayCache.kDOPNodeIndex = kDOPCheck.HitNodeIndex;
 				//@todo - handle masked materials correctly with !bFindClosestIntersection
 				return true;
 			}
@@ -439,12 +387,7 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 	} 
 	// Continue tracing as long as we are intersecting meshes that might need to restart the ray
 	while (ClosestIntersection.bIntersects 
-		&& (ClosestIntersection.Mesh->IsTranslucent(ClosestIntersection.ElementIndex) ||
-			ClosestIntersection.Mesh->IsMasked(ClosestIntersection.ElementIndex) ||
-			(ClosestIntersection.Mesh == LightRay.Mesh && ((ClosestIntersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWDISABLE) || (LightRay.TraceFlags & LIGHTRAY_SELFSHADOWDISABLE))) ||
-			// Continue tracing if we are only allowed to self shadow and intersected a different mesh
-			(ClosestIntersection.Mesh != LightRay.Mesh && (ClosestIntersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWONLY)) ||
-			(bDirectShadowingRay && ClosestIntersection.Mesh->IsIndirectlyShadowedOnly(ClosestIntersection.ElementIndex)))
+		&& ShouldContinueTracing(LightRay, ClosestIntersection, bDirectShadowingRay)
 		&& NumIterativeIntersections < MaxNumIterativeIntersections);
 
 	if (NumIterativeIntersections >= MaxNumIterativeIntersections)
@@ -460,4 +403,244 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 }
 
 
+/** Returns the octant of a direction, rays in the same octant visit the children of a BVH node in a similar order. */
+static FORCEINLINE int32 GetDirectionOctant(const FVector4& Direction)
+{
+	return (Direction.X < 0 ? 1 : 0) | (Direction.Y < 0 ? 2 : 0) | (Direction.Z < 0 ? 4 : 0);
+}
+
+void FStaticLightingAggregateMesh::IntersectLightRays(
+	const FLightRay* LightRays,
+	int32 NumLightRays,
+	bool bFindClosestIntersection,
+	bool bCalculateTransmission,
+	bool bDirectShadowingRay,
+	FCoherentRayCache& CoherentRayCache,
+	FLightRayIntersection* Intersections) const
+{
+	if (!GUseBVH)
+	{
+		// The kDOP can only trace one ray at a time
+		for (int32 RayIndex = 0; RayIndex < NumLightRays; RayIndex++)
+		{
+			IntersectLightRay(LightRays[RayIndex], bFindClosestIntersection, bCalculateTransmission, bDirectShadowingRay, CoherentRayCache, Intersections[RayIndex]);
+		}
+		return;
+	}
+
+	checkSlow(!bCalculateTransmission || bFindClosestIntersection);
+
+	// Rays whose first hit doesn't end the trace, they are handed over to IntersectLightRay
+	TArray<int32, TInlineAllocator<BVH_MAX_PACKET_SIZE> > ContinuedRays;
+	{
+		LIGHTINGSTAT(FScopedRDTSCTimer RayTraceTimer(bFindClosestIntersection ? CoherentRayCache.FirstHitRayTraceTime : CoherentRayCache.BooleanRayTraceTime);)
+
+		// Group the rays by direction octant so that the rays of a packet traverse the tree in a similar order
+		TArray<int32, TInlineAllocator<BVH_MAX_PACKET_SIZE> > SortedRays;
+		SortedRays.Empty(NumLightRays);
+		for (int32 Octant = 0; Octant < 8; Octant++)
+		{
+			for (int32 RayIndex = 0; RayIndex < NumLightRays; RayIndex++)
+			{
+				if (GetDirectionOctant(LightRays[RayIndex].Direction) == Octant)
+				{
+					SortedRays.Add(RayIndex);
+				}
+			}
+		}
+
+		FBVHLineCheck Checks[BVH_MAX_PACKET_SIZE];
+		for (int32 PacketStart = 0; PacketStart < NumLightRays; PacketStart += BVH_MAX_PACKET_SIZE)
+		{
+			const int32 PacketSize = FMath::Min(NumLightRays - PacketStart, BVH_MAX_PACKET_SIZE);
+			for (int32 PacketIndex = 0; PacketIndex < PacketSize; PacketIndex++)
+			{
+				const FLightRay& LightRay = LightRays[SortedRays[PacketStart + PacketIndex]];
+				Checks[PacketIndex] = FBVHLineCheck(
+					LightRay.Start,
+					LightRay.Start + LightRay.Direction * LightRay.Length,
+					bFindClosestIntersection,
+					(LightRay.TraceFlags & LIGHTRAY_STATIC_AND_OPAQUEONLY) != 0,
+					!bDirectShadowingRay,
+					(LightRay.TraceFlags & LIGHTRAY_FLIP_SIDEDNESS) != 0,
+					LightRay.Mapping ? LightRay.Mapping->Mesh->MeshIndex : INDEX_NONE,
+					LightRay.Mapping ? LightRay.Mapping->Mesh->GetLODIndex() : INDEX_NONE);
+			}
+
+			BVHTree.LineCheckPacket(Checks, PacketSize);
+
+			// Set up the intersections the same way as the first iteration of IntersectLightRay
+			for (int32 PacketIndex = 0; PacketIndex < PacketSize; PacketIndex++)
+			{
+				const int32 RayIndex = SortedRays[PacketStart + PacketIndex];
+				const FLightRay& LightRay = LightRays[RayIndex];
+				FLightRayIntersection& Intersection = Intersections[RayIndex];
+				Intersection.bIntersects = false;
+				if (Checks[PacketIndex].Result.Item != INDEX_NONE)
+				{
+					GetIntersection(LightRay, Checks[PacketIndex].Result, Checks[PacketIndex].HitNormal, bFindClosestIntersection, Intersection);
+					if (!bFindClosestIntersection)
+					{
+						continue;
+					}
+					else if (ShouldContinueTracing(LightRay, Intersection, bDirectShadowingRay))
+					{
+						ContinuedRays.Add(RayIndex);
+						continue;
+					}
+				}
+				Intersection.Transmission = FLinearColor::White;
+			}
+		}
+
+		const int32 NumPacketRays = NumLightRays - ContinuedRays.Num();
+		bFindClosestIntersection ? CoherentRayCache.NumFirstHitRaysTraced += NumPacketRays : CoherentRayCache.NumBooleanRaysTraced += NumPacketRays;
+		CoherentRayCache.NumPacketRaysTraced += NumPacketRays;
+	}
+
+	for (int32 ContinuedIndex = 0; ContinuedIndex < ContinuedRays.Num(); ContinuedIndex++)
+	{
+		const int32 RayIndex = ContinuedRays[ContinuedIndex];
+		IntersectLightRay(LightRays[RayIndex], bFindClosestIntersection, bCalculateTransmission, bDirectShadowingRay, CoherentRayCache, Intersections[RayIndex]);
+	}
+}
+
+bool FStaticLightingAggregateMesh::LineCheck(
+	const FLightRay& LightRay,
+	const FLightRay& ClippedLightRay,
+	bool bFindClosestIntersection,
+	bool bDirectShadowingRay,
+	FCoherentRayCache& CoherentRayCache,
+	FHitResult& Result,
+	FVector4& HitNormal) const
+{
+	const FVector4 End = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length;
+	const bool bStaticAndOpaqueOnly = (LightRay.TraceFlags & LIGHTRAY_STATIC_AND_OPAQUEONLY) != 0;
+	const bool bFlipSidedness = (LightRay.TraceFlags & LIGHTRAY_FLIP_SIDEDNESS) != 0;
+	const int32 MeshIndex = LightRay.Mapping ? LightRay.Mapping->Mesh->MeshIndex : INDEX_NONE;
+	const int32 LODIndex = LightRay.Mapping ? LightRay.Mapping->Mesh->GetLODIndex() : INDEX_NONE;
+
+	if (GUseBVH)
+	{
+		FBVHLineCheck BVHCheck(ClippedLightRay.Start, End, bFindClosestIntersection, bStaticAndOpaqueOnly, !bDirectShadowingRay, bFlipSidedness, MeshIndex, LODIndex);
+		const bool bHit = BVHTree.LineCheck(BVHCheck);
+		Result = BVHCheck.Result;
+		HitNormal = BVHCheck.HitNormal;
+		return bHit;
+	}
+
+	// Check the kDOP containing low polygon meshes first.
+	FStaticLightingAggregateMeshDataProvider kDOPDataProvider(this, ClippedLightRay);
+	TkDOPLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32> kDOPCheck(
+		ClippedLightRay.Start,
+		End,
+		bFindClosestIntersection,
+		bStaticAndOpaqueOnly,
+		!bDirectShadowingRay,
+		bFlipSidedness,
+		kDOPDataProvider,
+		MeshIndex,
+		LODIndex,
+		&Result);
+
+	bool bHit = false; 
+	if (!bFindClosestIntersection && CoherentRayCache.kDOPNodeIndex != 0xFFFFFFFF)
+	{
+		TTraversalHistory<uint32> History;
+		// Trace against the last hit node if we're doing a boolean visibility check before traversing the whole tree
+		// Provides a small speedup with coherent boolean visibility rays (1.1x faster for precomputed visibility)
+		bHit = kDopTree.Nodes[CoherentRayCache.kDOPNodeIndex].LineCheck(kDOPCheck, History.AddNode(CoherentRayCache.kDOPNodeIndex));
+	}
+
+	if (!bHit)
+	{
+		bHit = kDopTree.LineCheck(kDOPCheck);
+	}
+
+	if (bHit)
+	{
+		HitNormal = kDOPCheck.LocalHitNormal;
+		if (!bFindClosestIntersection)
+		{
+			// Store off the hit node so future boolean visibility rays can test against that first
+			CoherentRayCache.kDOPNodeIndex = kDOPCheck.HitNodeIndex;
+		}
+	}
+	return bHit;
+}
+
+void FStaticLightingAggregateMesh::GetIntersection(
+	const FLightRay& ClippedLightRay,
+	const FHitResult& Result,
+	const FVector4& HitNormal,
+	bool bFindClosestIntersection,
+	FLightRayIntersection& Intersection) const
+{
+	// Setup a vertex to represent the intersection.
+	FStaticLightingVertex IntersectionVertex;
+	IntersectionVertex.WorldPosition = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length * Result.Time;
+	IntersectionVertex.WorldTangentZ = HitNormal;
+	const FTriangleSOAPayload& Payload = TrianglePayloads[ Result.Item ];
+	const FVector4& v1 = Vertices[Payload.VertexIndex[0]];
+	const FVector4& v2 = Vertices[Payload.VertexIndex[1]];
+	const FVector4& v3 = Vertices[Payload.VertexIndex[2]];
+	// The aggregate mesh is in world space, so this matches the local hit position of the kDOP check
+	const FVector4 End = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length;
+	const FVector4 LocalHitPosition = ClippedLightRay.Start + (End - ClippedLightRay.Start) * Result.Time;
+	FVector4 BaryCentricWeights;
+	//@todo - why is such a huge tolerance needed?  Reuse the barycentric coords calculated by the ray-triangle intersection instead of deriving them from the hit position.
+	//@todo - why does this sometimes fail if there was an intersection?
+	if (bFindClosestIntersection && GetBarycentricWeights(v1, v2, v3, LocalHitPosition, KINDA_SMALL_NUMBER * 100.0f, BaryCentricWeights))
+	{
+		const FVector2D& UV1 = UVs[Payload.VertexIndex[0]];
+		const FVector2D& UV2 = UVs[Payload.VertexIndex[1]];
+		const FVector2D& UV3 = UVs[Payload.VertexIndex[2]];
+		// Interpolate the material texture coordinates to the intersection point
+		//@todo - only lookup and interpolate UV's if needed
+		IntersectionVertex.TextureCoordinates[0] = UV1 * BaryCentricWeights.X + UV2 * BaryCentricWeights.Y + UV3 * BaryCentricWeights.Z;
+		const FVector2D& LightmapUV1 = LightmapUVs[Payload.VertexIndex[0]];
+		const FVector2D& LightmapUV2 = LightmapUVs[Payload.VertexIndex[1]];
+		const FVector2D& LightmapUV3 = LightmapUVs[Payload.VertexIndex[2]];
+		// Interpolate the lightmap texture coordinates to the intersection point
+		IntersectionVertex.TextureCoordinates[1] = LightmapUV1 * BaryCentricWeights.X + LightmapUV2 * BaryCentricWeights.Y + LightmapUV3 * BaryCentricWeights.Z;
+	}
+	else
+	{
+		IntersectionVertex.TextureCoordinates[0] = FVector2D(0,0);
+		IntersectionVertex.TextureCoordinates[1] = FVector2D(0,0);
+	}
+	// Return the index of the vertex closest to the hit point
+	int32 AbsoluteVertexIndex = Payload.VertexIndex[0];
+	if (BaryCentricWeights.Y > BaryCentricWeights.X)
+	{
+		if (BaryCentricWeights.Z > BaryCentricWeights.Y)
+		{
+			AbsoluteVertexIndex = Payload.VertexIndex[2];
+		}
+		else
+		{
+			AbsoluteVertexIndex = Payload.VertexIndex[1];
+		}
+	}
+	else if (BaryCentricWeights.Z > BaryCentricWeights.X)
+	{
+		AbsoluteVertexIndex = Payload.VertexIndex[2];
+	}
+	// Convert the index into the kDOP tree's vertices into an index into the hit mesh's vertices
+	const int32 RelativeVertexIndex = AbsoluteVertexIndex - Payload.MeshInfo->BaseIndex;
+	checkSlow(RelativeVertexIndex >= 0 && RelativeVertexIndex < Payload.MeshInfo->Mesh->NumVertices);
+	Intersection = FLightRayIntersection(true, IntersectionVertex, Payload.MeshInfo->Mesh, Payload.Mapping, RelativeVertexIndex, Payload.ElementIndex);
+}
+
+bool FStaticLightingAggregateMesh::ShouldContinueTracing(const FLightRay& LightRay, const FLightRayIntersection& Intersection, bool bDirectShadowingRay) const
+{
+	return Intersection.Mesh->IsTranslucent(Intersection.ElementIndex) ||
+		Intersection.Mesh->IsMasked(Intersection.ElementIndex) ||
+		(Intersection.Mesh == LightRay.Mesh && ((Intersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWDISABLE) || (LightRay.TraceFlags & LIGHTRAY_SELFSHADOWDISABLE))) ||
+		// Continue tracing if we are only allowed to self shadow and intersected a different mesh
+		(Intersection.Mesh != LightRay.Mesh && (Intersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWONLY)) ||
+		(bDirectShadowingRay && Intersection.Mesh->IsIndirectlyShadowedOnly(Intersection.ElementIndex));
+}
+
+
 } //namespace Lightmass
@@ -167,8 +167,56 @@ public:
 		class FCoherentRayCache& CoherentRayCache,
 		FLightRayIntersection& Intersection) const;
 
+	/**
+	 * Checks a group of light rays for intersection with the shadow mesh, with the same results as calling IntersectLightRay on each of them.
+	 * When the BVH is used the rays are traced together in packets, which is faster when they are coherent, eg shadow rays from a point to an area light.
+	 * @param LightRays - The line segments to check for intersection.
+	 * @param NumLightRays - Number of entries in LightRays and Intersections.
+	 * @param [out] Intersections - The intersection of each light ray with the mesh.
+	 * See IntersectLightRay for the other parameters.
+	 */
+	void IntersectLightRays(
+		const FLightRay* LightRays,
+		int32 NumLightRays,
+		bool bFindClosestIntersection,
+		bool bCalculateTransmission,
+		bool bDirectShadowingRay,
+		class FCoherentRayCache& CoherentRayCache,
+		FLightRayIntersection* Intersections) const;
+
+	/** @return The name of the acceleration structure used for ray tracing, for logging. */
+	const TCHAR* GetAccelerationStructureName() const;
+
 private:
 
+	/**
+	 * Traces a segment of a light ray through the kDOP or the BVH.
+	 * @param LightRay - The original light ray, which provides the trace flags and the mesh that is tracing.
+	 * @param ClippedLightRay - The segment of the light ray to trace.
+	 * @param [out] Result - The closest or any hit, depending on bFindClosestIntersection.
+	 * @param [out] HitNormal - Normal of the hit triangle.
+	 * @return true if a triangle was hit
+	 */
+	bool LineCheck(
+		const FLightRay& LightRay,
+		const FLightRay& ClippedLightRay,
+		bool bFindClosestIntersection,
+		bool bDirectShadowingRay,
+		class FCoherentRayCache& CoherentRayCache,
+		FHitResult& Result,
+		FVector4& HitNormal) const;
+
+	/** Sets up the intersection for a hit returned by LineCheck. */
+	void GetIntersection(
+		const FLightRay& ClippedLightRay,
+		const FHitResult& Result,
+		const FVector4& HitNormal,
+		bool bFindClosestIntersection,
+		FLightRayIntersection& Intersection) const;
+
+	/** @return true if the ray has to be traced further after hitting Intersection, because the hit doesn't shadow the ray or may be partially transparent. */
+	bool ShouldContinueTracing(const FLightRay& LightRay, const FLightRayIntersection& Intersection, bool bDirectShadowingRay) const;
+
 	const FScene& Scene;
 
 	friend class FStaticLightingAggregateMeshDataProvider;
@@ -176,6 +224,9 @@ private:
 	/** The world-space kDOP which is used by the simple meshes in the world. */
 	TkDOPTree<const FStaticLightingAggregateMeshDataProvider,uint32> kDopTree;
 
+	/** The world-space BVH, used instead of the kDOP with -bvh. */
+	FBVHTree BVHTree;
+
 	/** The triangles used to build the kDOP, valid until PrepareForRaytracing is called. */
 	TArray<FkDOPBuildCollisionTriangle<uint32> > kDOPTriangles;
  
@@ -212,6 +263,8 @@ class FCoherentRayCache
 public:
 	uint64 NumFirstHitRaysTraced;
 	uint64 NumBooleanRaysTraced;
+	/** Number of rays that were traced in packets by IntersectLightRays, these are also counted as first hit or boolean rays. */
+	uint64 NumPacketRaysTraced;
 	float FirstHitRayTraceTime;
 	float BooleanRayTraceTime;
 
@@ -225,6 +278,7 @@ public:
 	FCoherentRayCache() :
 		NumFirstHitRaysTraced(0),
 		NumBooleanRaysTraced(0),
+		NumPacketRaysTraced(0),
 		FirstHitRayTraceTime(0),
 		BooleanRayTraceTime(0),
 		kDOPNodeIndex(0xFFFFFFFF)
@@ -172,6 +172,7 @@ FStaticLightingMappingContext::~FStaticLightingMappingContext()
 		System.Stats += Stats;
 		System.Stats.NumFirstHitRaysTraced += RayCache.NumFirstHitRaysTraced;
 		System.Stats.NumBooleanRaysTraced += RayCache.NumBooleanRaysTraced;
+		System.Stats.NumPacketRaysTraced += RayCache.NumPacketRaysTraced;
 		System.Stats.FirstHitRayTraceThreadTime += RayCache.FirstHitRayTraceTime;
 		System.Stats.BooleanRayTraceThreadTime += RayCache.BooleanRayTraceTime;
 	}
@@ -1046,6 +1047,7 @@ void FStaticLightingSystem::DumpStats(float TotalStaticLightingTime) const
 	SolverStats += FString::Printf( TEXT("\n") );
 	SolverStats += FString::Printf( TEXT("Traced %.3f million first hit visibility rays for a total of %.1f thread seconds (%.3f million per thread second)\n"), Stats.NumFirstHitRaysTraced / 1000000.0f, Stats.FirstHitRayTraceThreadTime, Stats.NumFirstHitRaysTraced / 1000000.0f / Stats.FirstHitRayTraceThreadTime);
 	SolverStats += FString::Printf( TEXT("Traced %.3f million boolean visibility rays for a total of %.1f thread seconds (%.3f million per thread second)\n"), Stats.NumBooleanRaysTraced / 1000000.0f, Stats.BooleanRayTraceThreadTime, Stats.NumBooleanRaysTraced / 1000000.0f / Stats.BooleanRayTraceThreadTime);
+	SolverStats += FString::Printf( TEXT("Traced %.3f million rays with the %s (%.3f million per thread second), %.3f million of them in packets\n"), (Stats.NumFirstHitRaysTraced + Stats.NumBooleanRaysTraced) / 1000000.0f, AggregateMesh.GetAccelerationStructureName(), (Stats.NumFirstHitRaysTraced + Stats.NumBooleanRaysTraced) / 1000000.0f / (Stats.FirstHitRayTraceThreadTime + Stats.BooleanRayTraceThreadTime), Stats.NumPacketRaysTraced / 1000000.0f);
 	const FBoxSphereBounds SceneBounds = FBoxSphereBounds(AggregateMesh.GetBounds());
 	const FBoxSphereBounds ImportanceBounds = GetImportanceBounds();
 	SolverStats += FString::Printf( TEXT("Scene radius %.1f, Importance bounds radius %.1f\n"), SceneBounds.SphereRadius, ImportanceBounds.SphereRadius);
@@ -2424,8 +2426,9 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 		const bool bIsTwoSided = Mapping->Mesh->IsTwoSided(ElementIndex);
 		int32 UnShadowedRays = 0;
 
-		// Integrate over the surface of the light using monte carlo integration
-		// Note that we are making the approximation that the BRDF and the Light's emission are equal in all of these directions and therefore are not in the integrand
+		// Construct all the shadow rays first so they can be traced together, they share an origin and are coherent
+		TArray<FLightRay> LightRays;
+		LightRays.Empty(LightPositionSamples.Num());
 		for(int32 RayIndex = 0; RayIndex < LightPositionSamples.Num(); RayIndex++)
 		{
 			FLightSurfaceSample CurrentSample = LightPositionSamples[RayIndex];
@@ -2453,7 +2456,7 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 				NormalForOffset = -NormalForOffset;
 			}
 			
-			const FLightRay LightRay(
+			new(LightRays) FLightRay(
 				// Offset the start of the ray by some fraction along the direction of the ray and some fraction along the vertex normal.
 				Vertex.WorldPosition 
 					+ LightVector.GetSafeNormal() * SceneConstants.VisibilityRayOffsetDistance 
@@ -2463,11 +2466,20 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 				Mapping,
 				Light
 				);
+		}
 
-			// Check the line segment for intersection with the static lighting meshes.
-			FLightRayIntersection Intersection;
-			//@todo - change this back to request boolean visibility once transmission is supported with boolean visibility ray intersections
-			AggregateMesh.IntersectLightRay(LightRay, true, true, true, MappingContext.RayCache, Intersection);
+		// Check the line segments for intersection with the static lighting meshes.
+		TArray<FLightRayIntersection> Intersections;
+		Intersections.Init(FLightRayIntersection(), LightRays.Num());
+		//@todo - change this back to request boolean visibility once transmission is supported with boolean visibility ray intersections
+		AggregateMesh.IntersectLightRays(LightRays.GetData(), LightRays.Num(), true, true, true, MappingContext.RayCache, Intersections.GetData());
+
+		// Integrate over the surface of the light using monte carlo integration
+		// Note that we are making the approximation that the BRDF and the Light's emission are equal in all of these directions and therefore are not in the integrand
+		for(int32 RayIndex = 0; RayIndex < LightRays.Num(); RayIndex++)
+		{
+			const FLightRay& LightRay = LightRays[RayIndex];
+			const FLightRayIntersection& Intersection = Intersections[RayIndex];
 
 			if (!Intersection.bIntersects)
 			{
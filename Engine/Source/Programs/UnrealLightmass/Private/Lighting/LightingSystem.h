@@ -1168,6 +1168,9 @@ public:
 	/** Total number of boolean visibility rays traced */
 	uint64 NumBooleanRaysTraced;
 
+	/** Total number of rays traced in packets, which are also counted as first hit or boolean visibility rays */
+	uint64 NumPacketRaysTraced;
+
 	/** Thread seconds spent tracing first hit rays */
 	float FirstHitRayTraceThreadTime;
 
@@ -1236,6 +1239,7 @@ public:
 		NumSecondPassPhotonsRequested(0),
 		NumFirstHitRaysTraced(0),
 		NumBooleanRaysTraced(0),
+		NumPacketRaysTraced(0),
 		FirstHitRayTraceThreadTime(0),
 		BooleanRayTraceThreadTime(0),
 		VolumeSampleThreadTime(0)
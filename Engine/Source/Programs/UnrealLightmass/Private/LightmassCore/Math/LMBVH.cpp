@@ -0,0 +1,559 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "stdafx.h"
+#include "LMCore.h"
+
+namespace Lightmass
+{
+
+/** Number of internal nodes in the aggregate mesh BVH. */
+int32 GBVHNodes = 0;
+/** Number of leaves in the aggregate mesh BVH. */
+int32 GBVHNumLeaves = 0;
+/** Number of triangles in the aggregate mesh BVH, including the padding of partially filled FTriangleSOA's. */
+int32 GBVHTriangles = 0;
+
+/** Number of bins the triangle centroids are sorted into along each axis when evaluating split planes. */
+#define BVH_NUM_BINS 16
+/** Ranges with more triangles than this are always split, even if the surface area heuristic prefers a leaf. */
+#define BVH_MAX_TRIS_PER_LEAF 16
+/** Position of the bounds of unused children. No segment in the scene can reach it, regardless of its direction. */
+#define BVH_UNUSED_CHILD_POSITION 1.0e30f
+
+/** Half of the surface area of a box, the factor doesn't matter when comparing costs. */
+static FORCEINLINE float GetHalfSurfaceArea(const FBox& Box)
+{
+	const FVector Size = Box.Max - Box.Min;
+	return Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X;
+}
+
+/** Cost of testing a range of triangles, which are tested 4 at a time. */
+static FORCEINLINE float GetTriangleCost(int32 NumTris)
+{
+	return (float)((NumTris + 3) / 4);
+}
+
+/** Returns the index of the lowest set bit of a non-zero mask. */
+static FORCEINLINE int32 CountTrailingZeros64(uint64 Mask)
+{
+	const uint32 LowMask = (uint32)Mask;
+	return LowMask ? appCountTrailingZeros(LowMask) : 32 + appCountTrailingZeros((uint32)(Mask >> 32));
+}
+
+/**
+ * Tests a line against the 4 children of a node, see TkDOPNode::LineCheckBounds.
+ *
+ * @param Bounds	The bounds of the 4 children
+ * @param Check		The line to test
+ * @param HitTime	[out] Entry time of the line into each of the children
+ * @return			Bit N is set if child N was hit before the current hit time of the line
+ */
+static FORCEINLINE int32 LineCheckBounds(const FMultiBox& Bounds, const FBVHLineCheck& Check, float* HitTime)
+{
+	const VectorRegister CurrentHitTime	= VectorSetFloat1( Check.Result.Time );
+	const VectorRegister BoxMinX		= VectorLoadAligned( &Bounds.Min[0] );
+	const VectorRegister BoxMinY		= VectorLoadAligned( &Bounds.Min[1] );
+	const VectorRegister BoxMinZ		= VectorLoadAligned( &Bounds.Min[2] );
+	const VectorRegister BoxMaxX		= VectorLoadAligned( &Bounds.Max[0] );
+	const VectorRegister BoxMaxY		= VectorLoadAligned( &Bounds.Max[1] );
+	const VectorRegister BoxMaxZ		= VectorLoadAligned( &Bounds.Max[2] );
+
+	// Calculate slabs.
+	const VectorRegister BoxMinSlabX	= VectorMultiply( VectorSubtract( BoxMinX, Check.StartSOA.X ), Check.OneOverDirSOA.X );
+	const VectorRegister BoxMinSlabY	= VectorMultiply( VectorSubtract( BoxMinY, Check.StartSOA.Y ), Check.OneOverDirSOA.Y );
+	const VectorRegister BoxMinSlabZ	= VectorMultiply( VectorSubtract( BoxMinZ, Check.StartSOA.Z ), Check.OneOverDirSOA.Z );
+	const VectorRegister BoxMaxSlabX	= VectorMultiply( VectorSubtract( BoxMaxX, Check.StartSOA.X ), Check.OneOverDirSOA.X );
+	const VectorRegister BoxMaxSlabY	= VectorMultiply( VectorSubtract( BoxMaxY, Check.StartSOA.Y ), Check.OneOverDirSOA.Y );
+	const VectorRegister BoxMaxSlabZ	= VectorMultiply( VectorSubtract( BoxMaxZ, Check.StartSOA.Z ), Check.OneOverDirSOA.Z );
+
+	// Figure out global min/ max
+	const VectorRegister MinTime		= VectorMax( VectorMax( VectorMin( BoxMinSlabX, BoxMaxSlabX ), VectorMin( BoxMinSlabY, BoxMaxSlabY ) ), VectorMin( BoxMinSlabZ, BoxMaxSlabZ ) );
+	const VectorRegister MaxTime		= VectorMin( VectorMin( VectorMax( BoxMinSlabX, BoxMaxSlabX ), VectorMax( BoxMinSlabY, BoxMaxSlabY ) ), VectorMax( BoxMinSlabZ, BoxMaxSlabZ ) );
+
+	// Calculate hit time and determine whether there was a hit.
+	VectorStoreAligned( MinTime, HitTime );
+	const VectorRegister NodeHit		= VectorBitwiseAND( VectorCompareGE( MaxTime, VectorZero() ), VectorCompareGE( MaxTime, MinTime ) );
+	return VectorMaskBits( VectorBitwiseAND( NodeHit, VectorCompareGT( CurrentHitTime, MinTime ) ) );
+}
+
+/**
+ * Sorts the hit children of a node from far to near, so that pushing them in order onto a stack traverses the nearest first.
+ *
+ * @param HitMask	Bit N is set if child N was hit
+ * @param HitTime	Entry time into each child
+ * @param Order		[out] Indices of the hit children, farthest first
+ * @return			Number of hit children
+ */
+static FORCEINLINE int32 SortChildrenFarToNear(int32 HitMask, const float* HitTime, int32* Order)
+{
+	int32 NumHit = 0;
+	for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+	{
+		if (HitMask & (1 << ChildIndex))
+		{
+			int32 InsertIndex = NumHit++;
+			for (; InsertIndex > 0 && HitTime[Order[InsertIndex - 1]] < HitTime[ChildIndex]; InsertIndex--)
+			{
+				Order[InsertIndex] = Order[InsertIndex - 1];
+			}
+			Order[InsertIndex] = ChildIndex;
+		}
+	}
+	return NumHit;
+}
+
+FBVHLineCheck::FBVHLineCheck(
+	const FVector4& Start,
+	const FVector4& End,
+	bool bInFindClosestIntersection,
+	bool bInStaticAndOpaqueOnly,
+	bool bInTwoSidedCollision,
+	bool bInFlipSidedness,
+	int32 MeshIndex,
+	int32 LODIndex) :
+	bFindClosestIntersection(bInFindClosestIntersection),
+	bStaticAndOpaqueOnly(bInStaticAndOpaqueOnly),
+	bTwoSidedCollision(bInTwoSidedCollision),
+	bFlipSidedness(bInFlipSidedness)
+{
+	const FVector4 Dir = End - Start;
+	StartSOA.X = VectorSetFloat1( Start.X );
+	StartSOA.Y = VectorSetFloat1( Start.Y );
+	StartSOA.Z = VectorSetFloat1( Start.Z );
+	EndSOA.X = VectorSetFloat1( End.X );
+	EndSOA.Y = VectorSetFloat1( End.Y );
+	EndSOA.Z = VectorSetFloat1( End.Z );
+	DirSOA.X = VectorSetFloat1( Dir.X );
+	DirSOA.Y = VectorSetFloat1( Dir.Y );
+	DirSOA.Z = VectorSetFloat1( Dir.Z );
+	OneOverDirSOA.X = VectorSetFloat1( Dir.X ? 1.f / Dir.X : MAX_FLT );
+	OneOverDirSOA.Y = VectorSetFloat1( Dir.Y ? 1.f / Dir.Y : MAX_FLT );
+	OneOverDirSOA.Z = VectorSetFloat1( Dir.Z ? 1.f / Dir.Z : MAX_FLT );
+	MeshIndexRegister = VectorLoadFloat1( &MeshIndex );
+	LODIndexRegister = VectorLoadFloat1( &LODIndex );
+}
+
+void FBVHTree::Build(const TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles)
+{
+	float BVHBuildTime = 0;
+	{
+		FScopedRDTSCTimer BVHBuildTimer(BVHBuildTime);
+
+		FBuildContext Context(BuildTriangles);
+		Context.Indices.Empty(BuildTriangles.Num());
+		Context.Bounds.Empty(BuildTriangles.Num());
+		Context.Centroids.Empty(BuildTriangles.Num());
+		for (int32 TriangleIndex = 0; TriangleIndex < BuildTriangles.Num(); TriangleIndex++)
+		{
+			const FkDOPBuildCollisionTriangle<uint32>& Triangle = BuildTriangles[TriangleIndex];
+			FBox TriangleBounds(0);
+			TriangleBounds += Triangle.V0;
+			TriangleBounds += Triangle.V1;
+			TriangleBounds += Triangle.V2;
+			Context.Indices.Add(TriangleIndex);
+			Context.Bounds.Add(TriangleBounds);
+			Context.Centroids.Add(TriangleBounds.GetCenter());
+		}
+
+		// Each node references 4 children, so there are roughly a third as many nodes as leaves
+		Nodes.Empty(BuildTriangles.Num() / 8);
+		SOATriangles.Empty(BuildTriangles.Num() / 3);
+
+		// The root is always a node, even if all the triangles fit in a single leaf
+		Nodes.AddZeroed();
+		GBVHNodes++;
+		BuildNode(Context, 0, 0, BuildTriangles.Num(), SplitTriangleList(Context, 0, BuildTriangles.Num()));
+
+		// Don't waste memory.
+		Nodes.Shrink();
+		SOATriangles.Shrink();
+	}
+	UE_LOG(LogLightmass, Log, TEXT("Building BVH took %5.2f seconds."), BVHBuildTime);
+}
+
+int32 FBVHTree::SplitTriangleList(FBuildContext& Context, int32 Start, int32 NumTris) const
+{
+	if (NumTris <= GKDOPMaxTrisPerLeaf)
+	{
+		return 0;
+	}
+
+	FBox CentroidBounds(0);
+	for (int32 Index = Start; Index < Start + NumTris; Index++)
+	{
+		CentroidBounds += Context.Centroids[Context.Indices[Index]];
+	}
+	const FVector CentroidExtent = CentroidBounds.Max - CentroidBounds.Min;
+
+	int32 BestAxis = -1;
+	int32 BestBin = -1;
+	float BestCost = MAX_FLT;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (CentroidExtent[Axis] <= 0.0f)
+		{
+			continue;
+		}
+
+		// Sort the triangles into bins along the axis
+		FBox BinBounds[BVH_NUM_BINS];
+		int32 BinCounts[BVH_NUM_BINS];
+		for (int32 BinIndex = 0; BinIndex < BVH_NUM_BINS; BinIndex++)
+		{
+			BinBounds[BinIndex] = FBox(0);
+			BinCounts[BinIndex] = 0;
+		}
+
+		const float BinScale = BVH_NUM_BINS / CentroidExtent[Axis];
+		for (int32 Index = Start; Index < Start + NumTris; Index++)
+		{
+			const int32 TriangleIndex = Context.Indices[Index];
+			const int32 BinIndex = FMath::Min(FMath::TruncToInt((Context.Centroids[TriangleIndex][Axis] - CentroidBounds.Min[Axis]) * BinScale), BVH_NUM_BINS - 1);
+			BinCounts[BinIndex]++;
+			BinBounds[BinIndex] += Context.Bounds[TriangleIndex];
+		}
+
+		// Sweep from the right to get the cost of everything after each split plane
+		float RightCosts[BVH_NUM_BINS];
+		FBox RightBounds(0);
+		int32 RightCount = 0;
+		for (int32 BinIndex = BVH_NUM_BINS - 1; BinIndex > 0; BinIndex--)
+		{
+			RightBounds += BinBounds[BinIndex];
+			RightCount += BinCounts[BinIndex];
+			RightCosts[BinIndex] = RightCount > 0 ? GetHalfSurfaceArea(RightBounds) * GetTriangleCost(RightCount) : 0.0f;
+		}
+
+		// Sweep from the left, the split plane is after BinIndex
+		FBox LeftBounds(0);
+		int32 LeftCount = 0;
+		for (int32 BinIndex = 0; BinIndex < BVH_NUM_BINS - 1; BinIndex++)
+		{
+			LeftBounds += BinBounds[BinIndex];
+			LeftCount += BinCounts[BinIndex];
+			if (LeftCount > 0 && LeftCount < NumTris)
+			{
+				const float Cost = GetHalfSurfaceArea(LeftBounds) * GetTriangleCost(LeftCount) + RightCosts[BinIndex + 1];
+				if (Cost < BestCost)
+				{
+					BestAxis = Axis;
+					BestBin = BinIndex;
+					BestCost = Cost;
+				}
+			}
+		}
+	}
+
+	if (BestAxis == -1)
+	{
+		// All the centroids are in the same spot, there's nothing to gain by sorting them
+		return NumTris > BVH_MAX_TRIS_PER_LEAF ? NumTris / 2 : 0;
+	}
+
+	// Compare against the cost of a leaf, where testing a child's bounds costs about as much as testing 4 triangles
+	const float NodeArea = GetHalfSurfaceArea(GetBounds(Context, Start, NumTris));
+	if (NumTris <= BVH_MAX_TRIS_PER_LEAF && BestCost + NodeArea >= NodeArea * GetTriangleCost(NumTris))
+	{
+		return 0;
+	}
+
+	// Partition the triangles around the split plane
+	const float BinScale = BVH_NUM_BINS / CentroidExtent[BestAxis];
+	int32 Left = Start;
+	int32 Right = Start + NumTris - 1;
+	while (Left <= Right)
+	{
+		const int32 BinIndex = FMath::Min(FMath::TruncToInt((Context.Centroids[Context.Indices[Left]][BestAxis] - CentroidBounds.Min[BestAxis]) * BinScale), BVH_NUM_BINS - 1);
+		if (BinIndex <= BestBin)
+		{
+			Left++;
+		}
+		else
+		{
+			Exchange(Context.Indices[Left], Context.Indices[Right]);
+			Right--;
+		}
+	}
+	return Left - Start;
+}
+
+void FBVHTree::BuildNode(FBuildContext& Context, uint32 NodeIndex, int32 Start, int32 NumTris, int32 NumFirstHalf)
+{
+	// The node's triangles have already been split in two, split each half again to get up to 4 children
+	int32 ChildStarts[4];
+	int32 ChildNumTris[4];
+	bool bChildIsLeaf[4];
+	int32 NumChildren = 0;
+	if (NumFirstHalf > 0)
+	{
+		const int32 HalfStarts[2] = { Start, Start + NumFirstHalf };
+		const int32 HalfNumTris[2] = { NumFirstHalf, NumTris - NumFirstHalf };
+		for (int32 HalfIndex = 0; HalfIndex < 2; HalfIndex++)
+		{
+			const int32 NumFirstQuarter = SplitTriangleList(Context, HalfStarts[HalfIndex], HalfNumTris[HalfIndex]);
+			if (NumFirstQuarter > 0)
+			{
+				ChildStarts[NumChildren] = HalfStarts[HalfIndex];
+				ChildNumTris[NumChildren] = NumFirstQuarter;
+				bChildIsLeaf[NumChildren++] = false;
+				ChildStarts[NumChildren] = HalfStarts[HalfIndex] + NumFirstQuarter;
+				ChildNumTris[NumChildren] = HalfNumTris[HalfIndex] - NumFirstQuarter;
+				bChildIsLeaf[NumChildren++] = false;
+			}
+			else
+			{
+				// The half is cheaper as a leaf than split
+				ChildStarts[NumChildren] = HalfStarts[HalfIndex];
+				ChildNumTris[NumChildren] = HalfNumTris[HalfIndex];
+				bChildIsLeaf[NumChildren++] = true;
+			}
+		}
+	}
+	else if (NumTris > 0)
+	{
+		// Only happens for a root with few triangles
+		ChildStarts[NumChildren] = Start;
+		ChildNumTris[NumChildren] = NumTris;
+		bChildIsLeaf[NumChildren++] = true;
+	}
+
+	for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+	{
+		if (ChildIndex >= NumChildren)
+		{
+			Nodes[NodeIndex].Bounds.SetBox(ChildIndex, FBox(FVector(BVH_UNUSED_CHILD_POSITION), FVector(BVH_UNUSED_CHILD_POSITION)));
+			Nodes[NodeIndex].Children[ChildIndex] = 0xFFFFFFFF;
+			Nodes[NodeIndex].NumTriangles[ChildIndex] = 0;
+			continue;
+		}
+
+		const FBox ChildBounds = GetBounds(Context, ChildStarts[ChildIndex], ChildNumTris[ChildIndex]);
+		const int32 NumChildFirstHalf = bChildIsLeaf[ChildIndex] ? 0 : SplitTriangleList(Context, ChildStarts[ChildIndex], ChildNumTris[ChildIndex]);
+		if (NumChildFirstHalf == 0)
+		{
+			const uint32 FirstSOATriangle = BuildLeaf(Context, ChildStarts[ChildIndex], ChildNumTris[ChildIndex]);
+			Nodes[NodeIndex].Children[ChildIndex] = FirstSOATriangle;
+			Nodes[NodeIndex].NumTriangles[ChildIndex] = SOATriangles.Num() - FirstSOATriangle;
+		}
+		else
+		{
+			const uint32 ChildNodeIndex = Nodes.AddZeroed();
+			GBVHNodes++;
+			Nodes[NodeIndex].Children[ChildIndex] = ChildNodeIndex;
+			Nodes[NodeIndex].NumTriangles[ChildIndex] = 0;
+			BuildNode(Context, ChildNodeIndex, ChildStarts[ChildIndex], ChildNumTris[ChildIndex], NumChildFirstHalf);
+		}
+		// Nodes may have resized, so only access the node by index
+		Nodes[NodeIndex].Bounds.SetBox(ChildIndex, ChildBounds);
+	}
+}
+
+uint32 FBVHTree::BuildLeaf(FBuildContext& Context, int32 Start, int32 NumTris)
+{
+	// "NULL triangle", used when a leaf can't fill all 4 triangles in a FTriangleSOA.
+	// No line should ever hit these triangles, set the values so that it can never happen.
+	const FkDOPBuildCollisionTriangle<uint32> EmptyTriangle(0,FVector4(0,0,0,0),FVector4(0,0,0,0),FVector4(0,0,0,0),INDEX_NONE,INDEX_NONE, false, true);
+
+	const uint32 StartIndex = SOATriangles.Num();
+	const int32 NumSOATriangles = Align<int32>(NumTris, 4) / 4;
+	SOATriangles.AddZeroed(NumSOATriangles);
+
+	int32 BuildTriIndex = Start;
+	for (int32 SOAIndex = 0; SOAIndex < NumSOATriangles; SOAIndex++)
+	{
+		const FkDOPBuildCollisionTriangle<uint32>* Tris[4] = { &EmptyTriangle, &EmptyTriangle, &EmptyTriangle, &EmptyTriangle };
+		FTriangleSOA& SOA = SOATriangles[StartIndex + SOAIndex];
+		int32 SubIndex = 0;
+		for ( ; SubIndex < 4 && BuildTriIndex < (Start + NumTris); ++SubIndex, ++BuildTriIndex)
+		{
+			Tris[SubIndex] = &Context.Triangles[Context.Indices[BuildTriIndex]];
+			SOA.Payload[SubIndex] = Tris[SubIndex]->MaterialIndex;
+		}
+		for ( ; SubIndex < 4; ++SubIndex)
+		{
+			SOA.Payload[SubIndex] = 0xffffffff;
+		}
+
+		SetupTriangleSOA(SOA, Tris);
+	}
+
+	GBVHTriangles += NumSOATriangles * 4;
+	GBVHNumLeaves++;
+	return StartIndex;
+}
+
+FBox FBVHTree::GetBounds(const FBuildContext& Context, int32 Start, int32 NumTris) const
+{
+	FBox Bounds(0);
+	for (int32 Index = Start; Index < Start + NumTris; Index++)
+	{
+		Bounds += Context.Bounds[Context.Indices[Index]];
+	}
+	return Bounds;
+}
+
+FORCEINLINE bool FBVHTree::LineCheckTriangles(FBVHLineCheck& Check, uint32 StartIndex, uint32 NumTriangles) const
+{
+	bool bHit = false;
+	for (uint32 SOAIndex = StartIndex; SOAIndex < StartIndex + NumTriangles; SOAIndex++)
+	{
+		const FTriangleSOA& TriangleSOA = SOATriangles[SOAIndex];
+		const int32 SubIndex = appLineCheckTriangleSOA(Check.StartSOA, Check.EndSOA, Check.DirSOA, Check.MeshIndexRegister, Check.LODIndexRegister, TriangleSOA, Check.bStaticAndOpaqueOnly, Check.bTwoSidedCollision, Check.bFlipSidedness, Check.Result.Time);
+		if (SubIndex >= 0)
+		{
+			bHit = true;
+			Check.HitNormal.X = VectorGetComponent(TriangleSOA.Normals.X, SubIndex);
+			Check.HitNormal.Y = VectorGetComponent(TriangleSOA.Normals.Y, SubIndex);
+			Check.HitNormal.Z = VectorGetComponent(TriangleSOA.Normals.Z, SubIndex);
+			Check.Result.Item = TriangleSOA.Payload[SubIndex];
+
+			// Early out if we don't care about the closest intersection.
+			if (!Check.bFindClosestIntersection)
+			{
+				break;
+			}
+		}
+	}
+	return bHit;
+}
+
+bool FBVHTree::LineCheck(FBVHLineCheck& Check) const
+{
+	struct FStackEntry
+	{
+		float HitTime;
+		uint32 Index;
+		uint32 NumTriangles;
+	};
+
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	TArray<FStackEntry, TInlineAllocator<64> > Stack;
+	const FStackEntry RootEntry = { -MAX_FLT, 0, 0 };
+	Stack.Add(RootEntry);
+
+	bool bHit = false;
+	while (Stack.Num() > 0)
+	{
+		const FStackEntry Entry = Stack.Pop(false);
+
+		// Skip children that were entered after the closest hit found since they were pushed
+		if (Entry.HitTime >= Check.Result.Time)
+		{
+			continue;
+		}
+
+		if (Entry.NumTriangles > 0)
+		{
+			if (LineCheckTriangles(Check, Entry.Index, Entry.NumTriangles))
+			{
+				bHit = true;
+				if (!Check.bFindClosestIntersection)
+				{
+					return true;
+				}
+			}
+			continue;
+		}
+
+		const FBVHNode& Node = Nodes[Entry.Index];
+		MS_ALIGN(16) float HitTime[4] GCC_ALIGN(16);
+		const int32 HitMask = LineCheckBounds(Node.Bounds, Check, HitTime);
+		if (HitMask)
+		{
+			int32 Order[4];
+			const int32 NumHit = SortChildrenFarToNear(HitMask, HitTime, Order);
+			for (int32 OrderIndex = 0; OrderIndex < NumHit; OrderIndex++)
+			{
+				const int32 ChildIndex = Order[OrderIndex];
+				const FStackEntry ChildEntry = { HitTime[ChildIndex], Node.Children[ChildIndex], Node.NumTriangles[ChildIndex] };
+				Stack.Add(ChildEntry);
+			}
+		}
+	}
+	return bHit;
+}
+
+void FBVHTree::LineCheckPacket(FBVHLineCheck* Checks, int32 NumChecks) const
+{
+	struct FPacketStackEntry
+	{
+		/** Lines that hit the child. */
+		uint64 ActiveMask;
+		uint32 Index;
+		uint32 NumTriangles;
+	};
+
+	check(NumChecks <= BVH_MAX_PACKET_SIZE);
+	if (NumChecks == 0 || Nodes.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FPacketStackEntry, TInlineAllocator<64> > Stack;
+	const FPacketStackEntry RootEntry = { NumChecks == 64 ? ~(uint64)0 : ((uint64)1 << NumChecks) - 1, 0, 0 };
+	Stack.Add(RootEntry);
+
+	// Lines that already have a hit and don't need the closest one
+	uint64 FinishedMask = 0;
+	while (Stack.Num() > 0)
+	{
+		const FPacketStackEntry Entry = Stack.Pop(false);
+		uint64 ActiveMask = Entry.ActiveMask & ~FinishedMask;
+
+		if (Entry.NumTriangles > 0)
+		{
+			while (ActiveMask)
+			{
+				const int32 CheckIndex = CountTrailingZeros64(ActiveMask);
+				ActiveMask &= ActiveMask - 1;
+				FBVHLineCheck& Check = Checks[CheckIndex];
+				if (LineCheckTriangles(Check, Entry.Index, Entry.NumTriangles) && !Check.bFindClosestIntersection)
+				{
+					FinishedMask |= (uint64)1 << CheckIndex;
+				}
+			}
+			continue;
+		}
+
+		// Test every active line against the node's children, the node data is shared by all of them
+		const FBVHNode& Node = Nodes[Entry.Index];
+		uint64 ChildMasks[4] = { 0, 0, 0, 0 };
+		float ChildHitTimes[4] = { MAX_FLT, MAX_FLT, MAX_FLT, MAX_FLT };
+		int32 PacketHitMask = 0;
+		while (ActiveMask)
+		{
+			const int32 CheckIndex = CountTrailingZeros64(ActiveMask);
+			ActiveMask &= ActiveMask - 1;
+			MS_ALIGN(16) float HitTime[4] GCC_ALIGN(16);
+			const int32 HitMask = LineCheckBounds(Node.Bounds, Checks[CheckIndex], HitTime);
+			for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+			{
+				if (HitMask & (1 << ChildIndex))
+				{
+					ChildMasks[ChildIndex] |= (uint64)1 << CheckIndex;
+					ChildHitTimes[ChildIndex] = FMath::Min(ChildHitTimes[ChildIndex], HitTime[ChildIndex]);
+				}
+			}
+			PacketHitMask |= HitMask;
+		}
+
+		if (PacketHitMask)
+		{
+			// Order the children by the earliest entry of any line in the packet
+			int32 Order[4];
+			const int32 NumHit = SortChildrenFarToNear(PacketHitMask, ChildHitTimes, Order);
+			for (int32 OrderIndex = 0; OrderIndex < NumHit; OrderIndex++)
+			{
+				const int32 ChildIndex = Order[OrderIndex];
+				const FPacketStackEntry ChildEntry = { ChildMasks[ChildIndex], Node.Children[ChildIndex], Node.NumTriangles[ChildIndex] };
+				Stack.Add(ChildEntry);
+			}
+		}
+	}
+}
+
+} // namespace
@@ -0,0 +1,171 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+namespace Lightmass
+{
+
+/** Number of internal nodes in the aggregate mesh BVH. */
+extern int32 GBVHNodes;
+/** Number of leaves in the aggregate mesh BVH. */
+extern int32 GBVHNumLeaves;
+/** Number of triangles in the aggregate mesh BVH, including the padding of partially filled FTriangleSOA's. */
+extern int32 GBVHTriangles;
+
+/** Maximum number of rays that FBVHTree::LineCheckPacket can trace together. */
+#define BVH_MAX_PACKET_SIZE 64
+
+/**
+ * A node of the 4-wide BVH. Each node stores the bounds of its 4 children so they can be tested against a ray in one go,
+ * the children are either other nodes or leaves, which are a range of FTriangleSOA's.
+ */
+struct FBVHNode
+{
+	/** Bounds of the 4 children. Unused children get a point far outside of the scene which no segment can reach. */
+	FMultiBox Bounds;
+
+	/** Index of the child node, or of the first FTriangleSOA if the child is a leaf. */
+	uint32 Children[4];
+
+	/** Number of FTriangleSOA's in the child if it is a leaf, 0 for child nodes and unused children. */
+	uint32 NumTriangles[4];
+};
+
+/** Holds the information used to trace a line through the BVH, see TkDOPLineCollisionCheck for the kDOP equivalent. */
+struct FBVHLineCheck
+{
+	/** Start of the line, where each component is replicated into their own vector registers. */
+	FVector3SOA	StartSOA;
+	/** End of the line, where each component is replicated into their own vector registers. */
+	FVector3SOA	EndSOA;
+	/** Direction of the line (not normalized, just EndSOA-StartSOA), where each component is replicated into their own vector registers. */
+	FVector3SOA	DirSOA;
+	/** One over the direction of the line, used by the slab tests. */
+	FVector3SOA	OneOverDirSOA;
+	/** Mesh index of the instigating mesh in every channel. */
+	VectorRegister MeshIndexRegister;
+	/** LOD index of the instigating mesh in every channel. */
+	VectorRegister LODIndexRegister;
+
+	/** Normal of the hit triangle. */
+	FVector4 HitNormal;
+
+	/** Where the collision results get stored. */
+	FHitResult Result;
+
+	/** Flags for optimizing a trace */
+	bool bFindClosestIntersection;
+	bool bStaticAndOpaqueOnly;
+	bool bTwoSidedCollision;
+	bool bFlipSidedness;
+
+	FBVHLineCheck() {}
+
+	/**
+	 * Sets up the line check, the arguments match TkDOPLineCollisionCheck.
+	 *
+	 * @param Start -- The starting point of the trace
+	 * @param End -- The ending point of the trace
+	 * @param bInFindClosestIntersection -- Whether to stop at the first hit or not
+	 */
+	FBVHLineCheck(
+		const FVector4& Start,
+		const FVector4& End,
+		bool bInFindClosestIntersection,
+		bool bInStaticAndOpaqueOnly,
+		bool bInTwoSidedCollision,
+		bool bInFlipSidedness,
+		int32 MeshIndex,
+		int32 LODIndex);
+};
+
+/**
+ * Bounding volume hierarchy with 4 children per node, built with a binned surface area heuristic.
+ * Uses the same triangle data and intersection code as the kDOP, so the two can be compared on the same scene.
+ */
+class FBVHTree
+{
+public:
+
+	/** The list of nodes contained within this tree. Node 0 is always the root node. */
+	kDOPArray<FBVHNode, FRangeChecklessHeapAllocator> Nodes;
+
+	/** The list of collision triangles in this tree. */
+	kDOPArray<FTriangleSOA, FRangeChecklessHeapAllocator> SOATriangles;
+
+	/**
+	 * Builds the tree.
+	 *
+	 * @param BuildTriangles -- The list of triangles to use for the build process
+	 */
+	void Build(const TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles);
+
+	/**
+	 * Traces a single line through the tree, nearest children first.
+	 *
+	 * @param Check -- The line to trace, receives the hit
+	 * @return true if the line hit a triangle
+	 */
+	bool LineCheck(FBVHLineCheck& Check) const;
+
+	/**
+	 * Traces a group of lines through the tree together, each node is only fetched once for all the lines that reach it.
+	 * This works best when the lines are coherent, eg they share an origin or a direction.
+	 *
+	 * @param Checks -- The lines to trace, receive their hits
+	 * @param NumChecks -- Number of lines, must not be larger than BVH_MAX_PACKET_SIZE
+	 */
+	void LineCheckPacket(FBVHLineCheck* Checks, int32 NumChecks) const;
+
+private:
+
+	/** Temporary data used during the build. */
+	struct FBuildContext
+	{
+		const TArray<FkDOPBuildCollisionTriangle<uint32> >& Triangles;
+		/** Triangle indices, partitioned in place as the tree is built. */
+		TArray<int32> Indices;
+		/** Bounds of each triangle. */
+		TArray<FBox> Bounds;
+		/** Center of each triangle's bounds, used to bin the triangles. */
+		TArray<FVector> Centroids;
+
+		FBuildContext(const TArray<FkDOPBuildCollisionTriangle<uint32> >& InTriangles) :
+			Triangles(InTriangles)
+		{}
+	};
+
+	/**
+	 * Splits a range of triangles in two with the surface area heuristic.
+	 *
+	 * @param Start -- First triangle index in Context.Indices
+	 * @param NumTris -- Number of triangles in the range
+	 * @return Number of triangles in the first half, or 0 if a leaf is cheaper than splitting
+	 */
+	int32 SplitTriangleList(FBuildContext& Context, int32 Start, int32 NumTris) const;
+
+	/**
+	 * Fills in a node's children, creating leaves or recursing into new nodes.
+	 *
+	 * @param NodeIndex -- The node to fill in
+	 * @param Start -- First triangle index in Context.Indices
+	 * @param NumTris -- Number of triangles under the node
+	 * @param NumFirstHalf -- Result of SplitTriangleList for the node's triangles, which have already been partitioned
+	 */
+	void BuildNode(FBuildContext& Context, uint32 NodeIndex, int32 Start, int32 NumTris, int32 NumFirstHalf);
+
+	/**
+	 * Creates the FTriangleSOA's of a leaf.
+	 *
+	 * @return Index of the first FTriangleSOA of the leaf
+	 */
+	uint32 BuildLeaf(FBuildContext& Context, int32 Start, int32 NumTris);
+
+	/** @return The bounds of a range of triangles. */
+	FBox GetBounds(const FBuildContext& Context, int32 Start, int32 NumTris) const;
+
+	/** Tests a line against the triangles of a leaf. */
+	bool LineCheckTriangles(FBVHLineCheck& Check, uint32 StartIndex, uint32 NumTriangles) const;
+};
+
+} // namespace
@@ -436,6 +436,49 @@ public:
 	}
 };
 
+/**
+ * Fills the geometry, flags and mesh/LOD indices of a FTriangleSOA from 4 build triangles.
+ * The payload is left to the caller since unused slots need an invalid payload.
+ *
+ * @param SOA -- The SOA triangle to fill
+ * @param Tris -- The 4 triangles to pack, unused slots should reference a triangle that can never be hit
+ */
+template<typename KDOP_IDX_TYPE>
+void SetupTriangleSOA(FTriangleSOA& SOA, const FkDOPBuildCollisionTriangle<KDOP_IDX_TYPE>* const Tris[4])
+{
+	SOA.Positions[0].X = VectorSet( Tris[0]->V0.X, Tris[1]->V0.X, Tris[2]->V0.X, Tris[3]->V0.X );
+	SOA.Positions[0].Y = VectorSet( Tris[0]->V0.Y, Tris[1]->V0.Y, Tris[2]->V0.Y, Tris[3]->V0.Y );
+	SOA.Positions[0].Z = VectorSet( Tris[0]->V0.Z, Tris[1]->V0.Z, Tris[2]->V0.Z, Tris[3]->V0.Z );
+	SOA.Positions[1].X = VectorSet( Tris[0]->V1.X, Tris[1]->V1.X, Tris[2]->V1.X, Tris[3]->V1.X );
+	SOA.Positions[1].Y = VectorSet( Tris[0]->V1.Y, Tris[1]->V1.Y, Tris[2]->V1.Y, Tris[3]->V1.Y );
+	SOA.Positions[1].Z = VectorSet( Tris[0]->V1.Z, Tris[1]->V1.Z, Tris[2]->V1.Z, Tris[3]->V1.Z );
+	SOA.Positions[2].X = VectorSet( Tris[0]->V2.X, Tris[1]->V2.X, Tris[2]->V2.X, Tris[3]->V2.X );
+	SOA.Positions[2].Y = VectorSet( Tris[0]->V2.Y, Tris[1]->V2.Y, Tris[2]->V2.Y, Tris[3]->V2.Y );
+	SOA.Positions[2].Z = VectorSet( Tris[0]->V2.Z, Tris[1]->V2.Z, Tris[2]->V2.Z, Tris[3]->V2.Z );
+
+	const FVector4& Tris0LocalNormal = Tris[0]->GetLocalNormal();
+	const FVector4& Tris1LocalNormal = Tris[1]->GetLocalNormal();
+	const FVector4& Tris2LocalNormal = Tris[2]->GetLocalNormal();
+	const FVector4& Tris3LocalNormal = Tris[3]->GetLocalNormal();
+
+	SOA.Normals.X = VectorSet( Tris0LocalNormal.X, Tris1LocalNormal.X, Tris2LocalNormal.X, Tris3LocalNormal.X );
+	SOA.Normals.Y = VectorSet( Tris0LocalNormal.Y, Tris1LocalNormal.Y, Tris2LocalNormal.Y, Tris3LocalNormal.Y );
+	SOA.Normals.Z = VectorSet( Tris0LocalNormal.Z, Tris1LocalNormal.Z, Tris2LocalNormal.Z, Tris3LocalNormal.Z );
+	SOA.Normals.W = VectorSet( -Tris0LocalNormal.W, -Tris1LocalNormal.W, -Tris2LocalNormal.W, -Tris3LocalNormal.W );
+	SOA.TwoSidedMask = MakeVectorRegister(
+		(uint32)(Tris[0]->bTwoSided ? 0xFFFFFFFF : 0), 
+		(uint32)(Tris[1]->bTwoSided ? 0xFFFFFFFF : 0),
+		(uint32)(Tris[2]->bTwoSided ? 0xFFFFFFFF : 0),
+		(uint32)(Tris[3]->bTwoSided ? 0xFFFFFFFF : 0));
+	SOA.StaticAndOpaqueMask = MakeVectorRegister(
+		(uint32)(Tris[0]->bStaticAndOpaque ? 0xFFFFFFFF : 0), 
+		(uint32)(Tris[1]->bStaticAndOpaque ? 0xFFFFFFFF : 0),
+		(uint32)(Tris[2]->bStaticAndOpaque ? 0xFFFFFFFF : 0),
+		(uint32)(Tris[3]->bStaticAndOpaque ? 0xFFFFFFFF : 0));
+	SOA.MeshIndices = VectorSet(*(float*)&Tris[0]->MeshIndex, *(float*)&Tris[1]->MeshIndex, *(float*)&Tris[2]->MeshIndex, *(float*)&Tris[3]->MeshIndex);
+	SOA.LODIndices = VectorSet(*(float*)&Tris[0]->LODIndex, *(float*)&Tris[1]->LODIndex, *(float*)&Tris[2]->LODIndex, *(float*)&Tris[3]->LODIndex);
+}
+
 // Forward declarations
 template <typename COLL_DATA_PROVIDER,typename KDOP_IDX_TYPE> struct TkDOPNode;
 template <typename COLL_DATA_PROVIDER,typename KDOP_IDX_TYPE> struct TkDOPTree;
@@ -1036,37 +1079,7 @@ struct TkDOPTree
 					SOA.Payload[SubIndex] = 0xffffffff;
 				}
 
-				SOA.Positions[0].X = VectorSet( Tris[0]->V0.X, Tris[1]->V0.X, Tris[2]->V0.X, Tris[3]->V0.X );
-				SOA.Positions[0].Y = VectorSet( Tris[0]->V0.Y, Tris[1]->V0.Y, Tris[2]->V0.Y, Tris[3]->V0.Y );
-				SOA.Positions[0].Z = VectorSet( Tris[0]->V0.Z, Tris[1]->V0.Z, Tris[2]->V0.Z, Tris[3]->V0.Z );
-				SOA.Positions[1].X = VectorSet( Tris[0]->V1.X, Tris[1]->V1.X, Tris[2]->V1.X, Tris[3]->V1.X );
-				SOA.Positions[1].Y = VectorSet( Tris[0]->V1.Y, Tris[1]->V1.Y, Tris[2]->V1.Y, Tris[3]->V1.Y );
-				SOA.Positions[1].Z = VectorSet( Tris[0]->V1.Z, Tris[1]->V1.Z, Tris[2]->V1.Z, Tris[3]->V1.Z );
-				SOA.Positions[2].X = VectorSet( Tris[0]->V2.X, Tris[1]->V2.X, Tris[2]->V2.X, Tris[3]->V2.X );
-				SOA.Positions[2].Y = VectorSet( Tris[0]->V2.Y, Tris[1]->V2.Y, Tris[2]->V2.Y, Tris[3]->V2.Y );
-				SOA.Positions[2].Z = VectorSet( Tris[0]->V2.Z, Tris[1]->V2.Z, Tris[2]->V2.Z, Tris[3]->V2.Z );
-
-				const FVector4& Tris0LocalNormal = Tris[0]->GetLocalNormal();
-				const FVector4& Tris1LocalNormal = Tris[1]->GetLocalNormal();
-				const FVector4& Tris2LocalNormal = Tris[2]->GetLocalNormal();
-				const FVector4& Tris3LocalNormal = Tris[3]->GetLocalNormal();
-
-				SOA.Normals.X = VectorSet( Tris0LocalNormal.X, Tris1LocalNormal.X, Tris2LocalNormal.X, Tris3LocalNormal.X );
-				SOA.Normals.Y = VectorSet( Tris0LocalNormal.Y, Tris1LocalNormal.Y, Tris2LocalNormal.Y, Tris3LocalNormal.Y );
-				SOA.Normals.Z = VectorSet( Tris0LocalNormal.Z, Tris1LocalNormal.Z, Tris2LocalNormal.Z, Tris3LocalNormal.Z );
-				SOA.Normals.W = VectorSet( -Tris0LocalNormal.W, -Tris1LocalNormal.W, -Tris2LocalNormal.W, -Tris3LocalNormal.W );
-				SOA.TwoSidedMask = MakeVectorRegister(
-					(uint32)(Tris[0]->bTwoSided ? 0xFFFFFFFF : 0), 
-					(uint32)(Tris[1]->bTwoSided ? 0xFFFFFFFF : 0),
-					(uint32)(Tris[2]->bTwoSided ? 0xFFFFFFFF : 0),
-					(uint32)(Tris[3]->bTwoSided ? 0xFFFFFFFF : 0));
-				SOA.StaticAndOpaqueMask = MakeVectorRegister(
-					(uint32)(Tris[0]->bStaticAndOpaque ? 0xFFFFFFFF : 0), 
-					(uint32)(Tris[1]->bStaticAndOpaque ? 0xFFFFFFFF : 0),
-					(uint32)(Tris[2]->bStaticAndOpaque ? 0xFFFFFFFF : 0),
-					(uint32)(Tris[3]->bStaticAndOpaque ? 0xFFFFFFFF : 0));
-				SOA.MeshIndices = VectorSet(*(float*)&Tris[0]->MeshIndex, *(float*)&Tris[1]->MeshIndex, *(float*)&Tris[2]->MeshIndex, *(float*)&Tris[3]->MeshIndex);
-				SOA.LODIndices = VectorSet(*(float*)&Tris[0]->LODIndex, *(float*)&Tris[1]->LODIndex, *(float*)&Tris[2]->LODIndex, *(float*)&Tris[3]->LODIndex);
+				SetupTriangleSOA(SOA, Tris);
 			}
 
 			// No need to subdivide further so make this a leaf node
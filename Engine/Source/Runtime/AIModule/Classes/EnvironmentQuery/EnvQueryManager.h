@@ -106,11 +106,23 @@ FORCEINLINE bool operator== (const FEQSDebugger::FEnvQueryInfo & Left, const FEQ
 }
 #endif // USE_EQS_DEBUGGER
 
-UCLASS()
+UCLASS(config=Game)
 class AIMODULE_API UEnvQueryManager : public UObject, public FTickableGameObject
 {
 	GENERATED_UCLASS_BODY()
 
+	/** if set, tests computing values of all items at once (e.g. distance, dot) can split them between worker threads */
+	UPROPERTY(config)
+	bool bAllowParallelItemValues;
+
+	/** minimal number of items computed by each worker task, tests with fewer items are computed on game thread */
+	UPROPERTY(config)
+	int32 MinItemsPerParallelTask;
+
+	/** minimal number of items computed by each worker task for high cost tests (e.g. traces, pathfinding) */
+	UPROPERTY(config)
+	int32 MinExpensiveItemsPerParallelTask;
+
 	// We need to implement GetWorld() so that any EQS-related blueprints (such as blueprint contexts) can implement
 	// GetWorld() and so provide access to blueprint nodes using hidden WorldContextObject parameters.
 	virtual UWorld* GetWorld() const;
@@ -187,6 +199,21 @@ protected:
 	/** next ID for running query */
 	int32 NextQueryID;
 
+	/** number of queries finished since stats were last updated */
+	int32 NumFinishedQueries;
+
+	/** summed latency of queries finished since stats were last updated */
+	double FinishedQueriesLatency;
+
+	/** time when stats were last updated */
+	double QueriesStatsTime;
+
+	/** gather latency of finished query for stats */
+	void OnQueryFinished(const FEnvQueryInstance& QueryInstance);
+
+	/** update queries per second and average latency stats, once per second */
+	void UpdateQueriesStats();
+
 	/** create new instance, using cached data is possible */
 	TSharedPtr<FEnvQueryInstance> CreateQueryInstance(const UEnvQuery* Template, EEnvQueryRunMode::Type RunMode);
 
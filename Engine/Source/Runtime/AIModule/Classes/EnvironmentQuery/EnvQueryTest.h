@@ -52,6 +52,10 @@ class AIMODULE_API UEnvQueryTest : public UEnvQueryNode
 	/** Cost of test */
 	TEnumAsByte<EEnvTestCost::Type> Cost;
 
+	/** When set, test can compute raw values of all items at once with PrepareItemValues and CalcItemValues,
+	 *  allowing query to split them between worker threads */
+	uint32 bWorksOnItemValues : 1;
+
 	/** How should the lower bound for normalization of the raw test value before applying the scoring formula be determined?
 	    Should it use the lowest value found (tested), the lower threshold for filtering, or a separate specified normalization minimum? */
 	UPROPERTY(EditDefaultsOnly, Category=Score)
@@ -122,6 +126,14 @@ public:
 	/** Function that does the actual work */
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const { checkNoEntry(); }
 
+	/** Gathers everything CalcItemValues needs (contexts, item data) on game thread, for tests with bWorksOnItemValues set
+	 *  @return values container initialized for all items or nothing when test can't run */
+	virtual TSharedPtr<FEnvQueryItemValues> PrepareItemValues(FEnvQueryInstance& QueryInstance) const { return nullptr; }
+
+	/** Computes raw values of items in [FirstItem, LastItem) range. Called from worker threads and in batches
+	 *  spread over several steps of time sliced queries, it must use only data stored by PrepareItemValues */
+	virtual void CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const {}
+
 	/** check if test supports item type */
 	bool IsSupportedItem(TSubclassOf<UEnvQueryItemType> ItemType) const;
 
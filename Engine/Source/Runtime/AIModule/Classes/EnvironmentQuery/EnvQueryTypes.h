@@ -528,6 +528,46 @@ struct AIMODULE_API FEnvQueryOptionInstance
 	FORCEINLINE uint32 GetAllocatedSize() const { return sizeof(*this) + Tests.GetAllocatedSize(); }
 };
 
+/** Raw values of a test computed for all items at once, see UEnvQueryTest::PrepareItemValues.
+ *  Tests derive from it to keep the data gathered on game thread for computing values on worker threads */
+struct AIMODULE_API FEnvQueryItemValues
+{
+	/** number of items */
+	int32 NumItems;
+
+	/** number of raw values of each item, e.g. one for each context location */
+	int32 NumValuesPerItem;
+
+	/** raw values, stored as NumValuesPerItem streams of NumItems values */
+	TArray<float> Values;
+
+	/** number of items with values already computed, time sliced queries compute them in batches over several steps */
+	int32 NumCalculatedItems;
+
+	/** if set, values are 0 or 1 and items are scored like boolean tests, expecting bExpectedBoolValue */
+	uint32 bBoolValues : 1;
+
+	/** expected value of boolean tests */
+	uint32 bExpectedBoolValue : 1;
+
+	/** if set, items with any value of BIG_NUMBER or more (e.g. unreachable) are discarded */
+	uint32 bDiscardBigValues : 1;
+
+	FEnvQueryItemValues() : NumItems(0), NumValuesPerItem(0), NumCalculatedItems(0), bBoolValues(false), bExpectedBoolValue(false), bDiscardBigValues(false) {}
+	virtual ~FEnvQueryItemValues() {}
+
+	void Init(int32 InNumItems, int32 InNumValuesPerItem)
+	{
+		NumItems = InNumItems;
+		NumValuesPerItem = InNumValuesPerItem;
+		Values.Reset();
+		Values.AddUninitialized(NumItems * NumValuesPerItem);
+	}
+
+	FORCEINLINE float* GetStream(int32 ValueIndex) { return Values.GetData() + ValueIndex * NumItems; }
+	FORCEINLINE const float* GetStream(int32 ValueIndex) const { return Values.GetData() + ValueIndex * NumItems; }
+};
+
 #if NO_LOGGING
 #define EQSHEADERLOG(...)
 #else
@@ -617,10 +657,17 @@ public:
 	/** if > 0 then it's how much time query has for performing current step */
 	double TimeLimit;
 
+	/** time when query was started, used for latency stats */
+	double StartTime;
+
+	/** values of current test computed so far, kept between time sliced steps */
+	TSharedPtr<FEnvQueryItemValues> CurrentItemValues;
+
 	FEnvQueryInstance() : World(NULL), CurrentTest(-1), NumValidItems(0), bFoundSingleResult(false), bPassOnSingleResult(false)
 #if USE_EQS_DEBUGGER
-		, bStoreDebugInfo(bDebuggingInfoEnabled) 
+		, bStoreDebugInfo(bDebuggingInfoEnabled)
 #endif // USE_EQS_DEBUGGER
+		, StartTime(0.0)
 	{ IncStats(); }
 	FEnvQueryInstance(const FEnvQueryInstance& Other) { *this = Other; IncStats(); }
 	~FEnvQueryInstance() { DecStats(); }
@@ -662,6 +709,13 @@ protected:
 	/** prepare item data after generator has finished */
 	void FinalizeGeneration();
 
+	/** run test on all items at once, computing raw values on worker threads if there are enough items.
+	 *  With a time limit, values are computed in batches until it runs out and the test continues in next step */
+	void RunTestOnItemValues(const UEnvQueryTest* TestObject);
+
+	/** filter and score items with raw values computed by test */
+	void StoreItemValues(const UEnvQueryTest* TestObject, const FEnvQueryItemValues& ItemValues);
+
 	/** update costs and flags after test has finished */
 	void FinalizeTest();
 	
@@ -31,6 +31,8 @@ class UEnvQueryTest_Distance : public UEnvQueryTest
 	TSubclassOf<UEnvQueryContext> DistanceTo;
 
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+	virtual TSharedPtr<FEnvQueryItemValues> PrepareItemValues(FEnvQueryInstance& QueryInstance) const override;
+	virtual void CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const override;
 
 	virtual FText GetDescriptionTitle() const override;
 	virtual FText GetDescriptionDetails() const override;
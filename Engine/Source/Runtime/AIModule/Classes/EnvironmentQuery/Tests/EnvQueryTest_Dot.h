@@ -40,6 +40,8 @@ protected:
 	bool bAbsoluteValue;
 
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+	virtual TSharedPtr<FEnvQueryItemValues> PrepareItemValues(FEnvQueryInstance& QueryInstance) const override;
+	virtual void CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const override;
 
 	virtual FText GetDescriptionTitle() const override;
 	virtual FText GetDescriptionDetails() const override;
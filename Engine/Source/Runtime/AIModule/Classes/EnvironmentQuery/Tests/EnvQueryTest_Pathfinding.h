@@ -54,6 +54,8 @@ class UEnvQueryTest_Pathfinding : public UEnvQueryTest
 	// END: deprecated properties
 
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+	virtual TSharedPtr<FEnvQueryItemValues> PrepareItemValues(FEnvQueryInstance& QueryInstance) const override;
+	virtual void CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const override;
 
 	virtual FText GetDescriptionTitle() const override;
 	virtual FText GetDescriptionDetails() const override;
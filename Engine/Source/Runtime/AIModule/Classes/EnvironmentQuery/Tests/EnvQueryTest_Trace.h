@@ -43,6 +43,8 @@ class UEnvQueryTest_Trace : public UEnvQueryTest
 	// END: deprecated properties
 
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+	virtual TSharedPtr<FEnvQueryItemValues> PrepareItemValues(FEnvQueryInstance& QueryInstance) const override;
+	virtual void CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const override;
 	virtual void PostLoad() override;
 
 	virtual FText GetDescriptionTitle() const override;
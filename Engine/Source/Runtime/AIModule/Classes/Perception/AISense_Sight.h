@@ -69,22 +69,31 @@ struct FAISightQuery
 	FPerceptionListenerID ObserverId;
 	FAISightTarget::FTargetId TargetId;
 
-	float Age;
-	float Score;
+	/** sight sense update the query was last processed in. Queries age by one with every update they wait, 
+	 *	so storing this instead of the age keeps the order of waiting queries from changing */
+	int32 LastProcessedUpdate;
+	/** world time the query was last processed at */
+	float LastProcessedTime;
 	float Importance;
 
 	uint32 bLastResult : 1;
 
 	FAISightQuery(FPerceptionListenerID ListenerId = FPerceptionListenerID::InvalidID(), FAISightTarget::FTargetId Target = FAISightTarget::InvalidTargetId)
-		: ObserverId(ListenerId), TargetId(Target), Age(0), Score(0), Importance(0), bLastResult(false)
+		: ObserverId(ListenerId), TargetId(Target), LastProcessedUpdate(0), LastProcessedTime(0), Importance(0), bLastResult(false)
+	{
+	}
+
+	float GetAge(int32 CurrentUpdate) const
 	{
+		return float(CurrentUpdate - LastProcessedUpdate);
 	}
 
-	void RecalcScore()
+	float GetScore(int32 CurrentUpdate) const
 	{
-		Score = Age + Importance;
+		return GetAge(CurrentUpdate) + Importance;
 	}
 
+	/** orders queries by score, the best first */
 	class FSortPredicate
 	{
 	public:
@@ -93,7 +102,8 @@ struct FAISightQuery
 
 		bool operator()(const FAISightQuery& A, const FAISightQuery& B) const
 		{
-			return A.Score > B.Score;
+			// same as comparing scores, without depending on the current update
+			return A.Importance - B.Importance > float(A.LastProcessedUpdate - B.LastProcessedUpdate);
 		}
 	};
 };
@@ -120,12 +130,46 @@ public:
 	TMap<FAISightTarget::FTargetId, FAISightTarget> ObservedTargets;
 	TMap<FPerceptionListenerID, FDigestedSightProperties> DigestedProperties;
 
+	/** sight queries waiting to be processed, kept as a heap with the best score on top */
 	TArray<FAISightQuery> SightQueryQueue;
 
 protected:
+	struct FPendingSightTrace
+	{
+		FAISightQuery Query;
+		FTraceHandle TraceHandle;
+		FVector TargetLocation;
+		float SightRadiusSq;
+	};
+
+	/** queries whose line of sight is being traced asynchronously, results are available in the next frame */
+	TArray<FPendingSightTrace> PendingSightTraces;
+
+	/** number of the current Update, see FAISightQuery::LastProcessedUpdate */
+	int32 SightQueryUpdateCounter;
+
+	/** world time of the current Update */
+	float SightUpdateTime;
+
+	/** stats accumulated since they were last published */
+	int32 NumTracesSinceStatsUpdate;
+	int32 NumQueriesSinceStatsUpdate;
+	float StalenessSinceStatsUpdate;
+	double StatsUpdateTime;
+
+	/** Max number of synchronous line of sight checks per tick, used for targets implementing IAISightTargetInterface
+	 *	and when async traces are disabled */
 	UPROPERTY(config)
 	int32 MaxTracesPerTick;
 
+	/** Max number of async line of sight traces issued per tick */
+	UPROPERTY(config)
+	int32 MaxAsyncTracesPerTick;
+
+	/** If set line of sight is traced with async traces, their results are consumed in the next frame */
+	UPROPERTY(config)
+	uint32 bUseAsyncTraces : 1;
+
 	UPROPERTY(config)
 	float HighImportanceQueryDistanceThreshold;
 
@@ -152,23 +196,33 @@ protected:
 	void OnListenerUpdateImpl(const FPerceptionListener& UpdatedListener);
 	void OnListenerRemovedImpl(const FPerceptionListener& UpdatedListener);	
 
-	void GenerateQueriesForListener(const FPerceptionListener& Listener, const FDigestedSightProperties& PropertyDigest);
-
 	enum FQueriesOperationPostProcess
 	{
 		DontSort,
 		Sort
 	};
+
+	void GenerateQueriesForListener(const FPerceptionListener& Listener, const FDigestedSightProperties& PropertyDigest, FQueriesOperationPostProcess PostProcess = Sort);
 	void RemoveAllQueriesByListener(const FPerceptionListener& Listener, FQueriesOperationPostProcess PostProcess);
 	void RemoveAllQueriesToTarget(const FName& TargetId, FQueriesOperationPostProcess PostProcess);
 
 	/** returns information whether new LoS queries have been added */
 	bool RegisterTarget(AActor& TargetActor, FQueriesOperationPostProcess PostProcess);
 
-	FORCEINLINE void SortQueries() { SightQueryQueue.Sort(FAISightQuery::FSortPredicate()); }
+	/** restores the heap order of SightQueryQueue after queries got added or removed in bulk */
+	FORCEINLINE void SortQueries() { SightQueryQueue.Heapify(FAISightQuery::FSortPredicate()); }
 
 	float CalcQueryImportance(const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq) const;
 
+	/** registers the stimulus resulting from a line of sight check and resets the query */
+	void ProcessSightResult(FPerceptionListener& Listener, AActor& TargetActor, FAISightQuery& SightQuery, bool bCanSee, float SightStrength, const FVector& SeenLocation, const FVector& TargetLocation, float SightRadiusSq);
+
+	/** consumes the results of async traces issued in previous frames, their queries are moved to OutQueries */
+	void ProcessPendingSightTraces(UWorld& World, TArray<FAISightQuery>& OutQueries, TArray<FAISightTarget::FTargetId>& InvalidTargets);
+
+	/** publishes traces per second and average perception staleness */
+	void UpdateSightStats();
+
 public:
 #if !UE_BUILD_SHIPPING
 	//----------------------------------------------------------------------//
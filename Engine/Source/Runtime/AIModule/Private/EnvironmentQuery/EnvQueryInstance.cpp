@@ -243,7 +243,14 @@ void FEnvQueryInstance::ExecuteOneStep(double InTimeLimit)
 		}
 
 		const int32 ItemsAlreadyProcessed = CurrentTestStartingItem;
-		TestObject->RunTest(*this);
+		if (TestObject->bWorksOnItemValues && (CurrentTestStartingItem == 0 || CurrentItemValues.IsValid()) && CanBatchTest())
+		{
+			RunTestOnItemValues(TestObject);
+		}
+		else
+		{
+			TestObject->RunTest(*this);
+		}
 		bStepDone = CurrentTestStartingItem >= Items.Num() || bFoundSingleResult
 			// or no items processed ==> this means error
 			|| (ItemsAlreadyProcessed == CurrentTestStartingItem);
@@ -270,6 +277,7 @@ void FEnvQueryInstance::ExecuteOneStep(double InTimeLimit)
 
 		CurrentTest++;
 		CurrentTestStartingItem = 0;
+		CurrentItemValues.Reset();
 	}
 
 	// sort results or switch to next option when all tests are performed
@@ -299,6 +307,229 @@ void FEnvQueryInstance::ExecuteOneStep(double InTimeLimit)
 	}
 }
 
+/** Computes raw values of a range of items on worker thread */
+class FEnvQueryItemValuesTask
+{
+	const UEnvQueryTest* TestObject;
+	FEnvQueryItemValues* ItemValues;
+	int32 FirstItem;
+	int32 LastItem;
+
+public:
+	FEnvQueryItemValuesTask(const UEnvQueryTest* InTestObject, FEnvQueryItemValues* InItemValues, int32 InFirstItem, int32 InLastItem)
+		: TestObject(InTestObject)
+		, ItemValues(InItemValues)
+		, FirstItem(InFirstItem)
+		, LastItem(InLastItem)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FEnvQueryItemValuesTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		TestObject->CalcItemValues(*ItemValues, FirstItem, LastItem);
+	}
+};
+
+void FEnvQueryInstance::RunTestOnItemValues(const UEnvQueryTest* TestObject)
+{
+	const double Deadline = TimeLimit > 0.0 ? (FPlatformTime::Seconds() + TimeLimit) : -1.0;
+	if (!CurrentItemValues.IsValid())
+	{
+		CurrentItemValues = TestObject->PrepareItemValues(*this);
+		if (!CurrentItemValues.IsValid())
+		{
+			return;
+		}
+	}
+
+	FEnvQueryItemValues& ItemValues = *CurrentItemValues;
+	const UEnvQueryManager* DefaultManager = GetDefault<UEnvQueryManager>();
+	const int32 NumItems = ItemValues.NumItems;
+	const int32 MinItemsPerTask = FMath::Max(TestObject->Cost == EEnvTestCost::High ? DefaultManager->MinExpensiveItemsPerParallelTask : DefaultManager->MinItemsPerParallelTask, 1);
+
+	// only split from game thread, queries executed on worker threads would block them waiting for their own tasks
+	int32 MaxTasks = 1;
+	if (DefaultManager->bAllowParallelItemValues && IsInGameThread() && FApp::ShouldUseThreadingForPerformance())
+	{
+		MaxTasks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	}
+
+	// without time limit all items are computed at once, otherwise in batches of one range per task until time runs out
+	do
+	{
+		const int32 FirstItem = ItemValues.NumCalculatedItems;
+		const int32 NumTasks = FMath::Clamp((NumItems - FirstItem) / MinItemsPerTask, 1, MaxTasks);
+		const int32 LastItem = (Deadline < 0) ? NumItems : FMath::Min(FirstItem + NumTasks * MinItemsPerTask, NumItems);
+		const int32 ItemsPerTask = FMath::DivideAndRoundUp(LastItem - FirstItem, NumTasks);
+
+		// current thread computes the first range
+		FGraphEventArray Tasks;
+		for (int32 TaskFirstItem = FirstItem + ItemsPerTask; TaskFirstItem < LastItem; TaskFirstItem += ItemsPerTask)
+		{
+			Tasks.Add(TGraphTask<FEnvQueryItemValuesTask>::CreateTask().ConstructAndDispatchWhenReady(TestObject, &ItemValues, TaskFirstItem, FMath::Min(TaskFirstItem + ItemsPerTask, LastItem)));
+		}
+		TestObject->CalcItemValues(ItemValues, FirstItem, FMath::Min(FirstItem + ItemsPerTask, LastItem));
+		if (Tasks.Num() > 0)
+		{
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks, ENamedThreads::GameThread);
+		}
+
+		ItemValues.NumCalculatedItems = LastItem;
+	}
+	while (ItemValues.NumCalculatedItems < NumItems && FPlatformTime::Seconds() < Deadline);
+
+	if (ItemValues.NumCalculatedItems < NumItems)
+	{
+		// report progress, remaining items will be computed in next step
+		CurrentTestStartingItem = ItemValues.NumCalculatedItems;
+		return;
+	}
+
+	StoreItemValues(TestObject, ItemValues);
+	CurrentItemValues.Reset();
+}
+
+void FEnvQueryInstance::StoreItemValues(const UEnvQueryTest* TestObject, const FEnvQueryItemValues& ItemValues)
+{
+	check(ItemValues.NumItems == Items.Num());
+
+	TestObject->FloatValueMin.BindData(Owner.Get(), QueryID);
+	const float MinThresholdValue = TestObject->FloatValueMin.GetValue();
+
+	TestObject->FloatValueMax.BindData(Owner.Get(), QueryID);
+	const float MaxThresholdValue = TestObject->FloatValueMax.GetValue();
+
+	// same filtering as ItemIterator::SetScore, turned into a range check
+	float FilterMin = -MAX_FLT;
+	float FilterMax = MAX_FLT;
+	bool bFailAllItems = false;
+	if (ItemValues.bBoolValues)
+	{
+		// values not matching the expected one fail the item, or only skip it when scoring
+		if (TestObject->FilterType == EEnvTestFilterType::Match)
+		{
+			FilterMin = FilterMax = ItemValues.bExpectedBoolValue ? 1.f : 0.f;
+		}
+		else
+		{
+			UE_LOG(LogEQS, Error, TEXT("Filtering Type set to other value than 'Match' for boolean test.  Will consider test as failed in all cases."));
+			bFailAllItems = true;
+		}
+	}
+	else if (TestObject->TestPurpose != EEnvTestPurpose::Score)
+	{
+		switch (TestObject->FilterType)
+		{
+			case EEnvTestFilterType::Maximum:
+				FilterMax = MaxThresholdValue;
+				break;
+
+			case EEnvTestFilterType::Minimum:
+				FilterMin = MinThresholdValue;
+				break;
+
+			case EEnvTestFilterType::Range:
+				FilterMin = MinThresholdValue;
+				FilterMax = MaxThresholdValue;
+				break;
+
+			case EEnvTestFilterType::Match:
+				UE_LOG(LogEQS, Error, TEXT("Filtering Type set to 'Match' for floating point test.  Will consider test as failed in all cases."));
+				bFailAllItems = true;
+				break;
+
+			default:
+				UE_LOG(LogEQS, Error, TEXT("Filtering Type set to invalid value for floating point test.  Will consider test as failed in all cases."));
+				bFailAllItems = true;
+				break;
+		}
+	}
+	const bool bSkipFailedItems = ItemValues.bBoolValues && TestObject->TestPurpose == EEnvTestPurpose::Score;
+	const float DiscardValue = ItemValues.bDiscardBigValues ? BIG_NUMBER : MAX_FLT;
+
+	// accumulate scores and filter results stream by stream
+	const int32 NumItems = ItemValues.NumItems;
+	const int32 NumValuesPerItem = ItemValues.NumValuesPerItem;
+	TArray<float> ItemScores;
+	TArray<uint8> ItemFailed;
+	TArray<uint8> ItemDiscarded;
+	ItemScores.AddZeroed(NumItems);
+	ItemFailed.AddZeroed(NumItems);
+	ItemDiscarded.AddZeroed(NumItems);
+	float* ItemScoresData = ItemScores.GetData();
+	uint8* ItemFailedData = ItemFailed.GetData();
+	uint8* ItemDiscardedData = ItemDiscarded.GetData();
+
+	for (int32 ValueIndex = 0; ValueIndex < NumValuesPerItem; ValueIndex++)
+	{
+		const float* ValueStream = ItemValues.GetStream(ValueIndex);
+		for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+		{
+			const float Value = ValueStream[ItemIndex];
+			ItemScoresData[ItemIndex] += Value;
+			ItemFailedData[ItemIndex] |= (Value < FilterMin) | (Value > FilterMax);
+			ItemDiscardedData[ItemIndex] |= (Value >= DiscardValue);
+		}
+	}
+
+	for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+	{
+		if (!Items[ItemIndex].IsValid())
+		{
+			continue;
+		}
+
+		float ItemScore = 0.0f;
+		const bool bFailed = bFailAllItems || ItemFailedData[ItemIndex];
+		if (bFailed && bSkipFailedItems && !ItemDiscardedData[ItemIndex])
+		{
+			ItemScore = UEnvQueryTypes::SkippedItemValue;
+		}
+		else if (bFailed || ItemDiscardedData[ItemIndex] || NumValuesPerItem == 0)
+		{
+			ItemScore = -1.f;
+			Items[ItemIndex].Discard();
+#if USE_EQS_DEBUGGER
+			ItemDetails[ItemIndex].FailedTestIndex = CurrentTest;
+			for (int32 ValueIndex = 0; ValueIndex < NumValuesPerItem && !bFailAllItems && !ItemValues.bBoolValues; ValueIndex++)
+			{
+				const float Value = ItemValues.GetStream(ValueIndex)[ItemIndex];
+				if (Value < FilterMin || Value > FilterMax)
+				{
+					ItemDetails[ItemIndex].FailedDescription = FString::Printf(TEXT("Value %f is out of range set to (%f, %f)"), Value, MinThresholdValue, MaxThresholdValue);
+					break;
+				}
+			}
+#endif
+			NumValidItems--;
+		}
+		else
+		{
+			// boolean tests score 1 for each matching value
+			ItemScore = ItemValues.bBoolValues ? 1.f : (ItemScoresData[ItemIndex] / NumValuesPerItem);
+		}
+
+		ItemDetails[ItemIndex].TestResults[CurrentTest] = ItemScore;
+	}
+
+	CurrentTestStartingItem = NumItems;
+}
+
 #if !NO_LOGGING
 void FEnvQueryInstance::Log(const FString Msg) const
 {
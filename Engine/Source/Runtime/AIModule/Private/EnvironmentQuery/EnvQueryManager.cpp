@@ -29,6 +29,9 @@ DEFINE_STAT(STAT_AI_EQS_NumInstances);
 DEFINE_STAT(STAT_AI_EQS_NumItems);
 DEFINE_STAT(STAT_AI_EQS_InstanceMemory);
 
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Queries per second"), STAT_AI_EQS_QueriesPerSecond, STATGROUP_AI_EQS);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Average query latency (ms)"), STAT_AI_EQS_QueryLatency, STATGROUP_AI_EQS);
+
 //////////////////////////////////////////////////////////////////////////
 // FEnvQueryRequest
 
@@ -83,6 +86,12 @@ TArray<TSubclassOf<UEnvQueryItemType> > UEnvQueryManager::RegisteredItemTypes;
 UEnvQueryManager::UEnvQueryManager(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	NextQueryID = 0;
+	bAllowParallelItemValues = true;
+	MinItemsPerParallelTask = 128;
+	MinExpensiveItemsPerParallelTask = 8;
+	NumFinishedQueries = 0;
+	FinishedQueriesLatency = 0;
+	QueriesStatsTime = 0;
 }
 
 UWorld* UEnvQueryManager::GetWorld() const
@@ -166,6 +175,7 @@ int32 UEnvQueryManager::RunQuery(TSharedPtr<FEnvQueryInstance> QueryInstance, FQ
 	}
 
 	QueryInstance->FinishDelegate = FinishDelegate;
+	QueryInstance->StartTime = FPlatformTime::Seconds();
 	RunningQueries.Add(QueryInstance);
 
 	return QueryInstance->QueryID;
@@ -179,10 +189,12 @@ TSharedPtr<FEnvQueryResult> UEnvQueryManager::RunInstantQuery(const FEnvQueryReq
 		return NULL;
 	}
 
+	QueryInstance->StartTime = FPlatformTime::Seconds();
 	while (QueryInstance->IsFinished() == false)
 	{
 		QueryInstance->ExecuteOneStep((double)FLT_MAX);
 	}
+	OnQueryFinished(*QueryInstance);
 
 	UE_VLOG_EQS(*QueryInstance.Get(), LogEQS, All);
 
@@ -239,7 +251,6 @@ void UEnvQueryManager::Tick(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_EQS_Tick);
 	SET_DWORD_STAT(STAT_AI_EQS_NumInstances, RunningQueries.Num());
-	// @TODO: threads?
 
 	const double MaxAllowedSeconds = 0.010;
 	double TimeLeft = MaxAllowedSeconds;
@@ -286,6 +297,7 @@ void UEnvQueryManager::Tick(float DeltaTime)
 				EQSDebugger.StoreQuery(QueryInstance);
 #endif // USE_EQS_DEBUGGER
 
+				OnQueryFinished(*QueryInstance);
 				QueryInstance->FinishDelegate.ExecuteIfBound(QueryInstance);
 				RunningQueries.RemoveAtSwap(Index, 1, /*bAllowShrinking=*/false);
 
@@ -293,6 +305,37 @@ void UEnvQueryManager::Tick(float DeltaTime)
 			}
 		}
 	}
+
+	UpdateQueriesStats();
+}
+
+void UEnvQueryManager::OnQueryFinished(const FEnvQueryInstance& QueryInstance)
+{
+	++NumFinishedQueries;
+	FinishedQueriesLatency += FPlatformTime::Seconds() - QueryInstance.StartTime;
+}
+
+void UEnvQueryManager::UpdateQueriesStats()
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (QueriesStatsTime == 0)
+	{
+		QueriesStatsTime = CurrentTime;
+		return;
+	}
+
+	const double StatsInterval = CurrentTime - QueriesStatsTime;
+	if (StatsInterval < 1.0)
+	{
+		return;
+	}
+
+	SET_FLOAT_STAT(STAT_AI_EQS_QueriesPerSecond, float(NumFinishedQueries / StatsInterval));
+	SET_FLOAT_STAT(STAT_AI_EQS_QueryLatency, NumFinishedQueries > 0 ? float(FinishedQueriesLatency * 1000.0 / NumFinishedQueries) : 0.0f);
+
+	NumFinishedQueries = 0;
+	FinishedQueriesLatency = 0;
+	QueriesStatsTime = CurrentTime;
 }
 
 void UEnvQueryManager::OnWorldCleanup()
@@ -23,6 +23,7 @@ UEnvQueryTest::UEnvQueryTest(const FObjectInitializer& ObjectInitializer) : Supe
 	ScoringFactor.DefaultValue = 1.0f;
 
 	bWorkOnFloatValues = true;
+	bWorksOnItemValues = false;
 
 	// keep deprecated properties initialized
 	BoolFilter.Value = true;
@@ -64,19 +65,30 @@ void UEnvQueryTest::NormalizeItemScores(FEnvQueryInstance& QueryInstance)
 		MaxScore = ScoreClampMax.GetValue();
 	}
 
-	FEnvQueryItemDetails* DetailInfo = QueryInstance.ItemDetails.GetData();
+	// gather results of current test in a contiguous array, scoring passes run over packed values of valid items
+	TArray<int32> ValidItemIndices;
+	TArray<float> TestValues;
+	ValidItemIndices.Reserve(QueryInstance.NumValidItems);
+	TestValues.Reserve(QueryInstance.NumValidItems);
+	for (int32 ItemIndex = 0; ItemIndex < QueryInstance.Items.Num(); ItemIndex++)
+	{
+		if (QueryInstance.Items[ItemIndex].IsValid())
+		{
+			ValidItemIndices.Add(ItemIndex);
+			TestValues.Add(QueryInstance.ItemDetails[ItemIndex].TestResults[QueryInstance.CurrentTest]);
+		}
+	}
+
+	const int32 NumValues = TestValues.Num();
+	const float* TestValuesData = TestValues.GetData();
+
 	if ((ClampMinType == EEnvQueryTestClamping::None) ||
 		(ClampMaxType == EEnvQueryTestClamping::None)
 	   )
 	{
-		for (int32 ItemIndex = 0; ItemIndex < QueryInstance.Items.Num(); ItemIndex++, DetailInfo++)
+		for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
 		{
-			if (!QueryInstance.Items[ItemIndex].IsValid())
-			{
-				continue;
-			}
-
-			float TestValue = DetailInfo->TestResults[QueryInstance.CurrentTest];
+			const float TestValue = TestValuesData[ValueIndex];
 			if (TestValue != UEnvQueryTypes::SkippedItemValue)
 			{
 				if (ClampMinType == EEnvQueryTestClamping::None)
@@ -92,64 +104,73 @@ void UEnvQueryTest::NormalizeItemScores(FEnvQueryInstance& QueryInstance)
 		}
 	}
 
-	DetailInfo = QueryInstance.ItemDetails.GetData();
-
 	if (MinScore != MaxScore)
 	{
-		for (int32 ItemIndex = 0; ItemIndex < QueryInstance.ItemDetails.Num(); ItemIndex++, DetailInfo++)
+		TArray<float> WeightedScores;
+		WeightedScores.AddUninitialized(NumValues);
+		float* WeightedScoresData = WeightedScores.GetData();
+
+		const float ScoreRange = MaxScore - MinScore;
+		for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
 		{
-			if (QueryInstance.Items[ItemIndex].IsValid() == false)
-			{
-				continue;
-			}
+			const float ClampedScore = FMath::Clamp(TestValuesData[ValueIndex], MinScore, MaxScore);
+			WeightedScoresData[ValueIndex] = (ClampedScore - MinScore) / ScoreRange;
+		}
+
+		// TODO? Add an option to invert the normalized score before applying an equation.
+		switch (ScoringEquation)
+		{
+			case EEnvTestScoreEquation::Linear:
+				for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
+				{
+					WeightedScoresData[ValueIndex] = ScoringFactorValue * WeightedScoresData[ValueIndex];
+				}
+				break;
+
+			case EEnvTestScoreEquation::InverseLinear:
+				// For now, we're avoiding having a separate flag for flipping the direction of the curve
+				// because we don't have usage cases yet and want to avoid too complex UI.  If we decide
+				// to add that flag later, we'll need to remove this option, since it should just be "mirror
+				// curve" plus "Linear".
+				for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
+				{
+					WeightedScoresData[ValueIndex] = ScoringFactorValue * (1.0f - WeightedScoresData[ValueIndex]);
+				}
+				break;
 
-			float WeightedScore = 0.0f;
+			case EEnvTestScoreEquation::Square:
+				for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
+				{
+					WeightedScoresData[ValueIndex] = ScoringFactorValue * (WeightedScoresData[ValueIndex] * WeightedScoresData[ValueIndex]);
+				}
+				break;
 
-			float& TestValue = DetailInfo->TestResults[QueryInstance.CurrentTest];
-			if (TestValue != UEnvQueryTypes::SkippedItemValue)
-			{
-				const float ClampedScore = FMath::Clamp(TestValue, MinScore, MaxScore);
-				const float NormalizedScore = (ClampedScore - MinScore) / (MaxScore - MinScore);
-				// TODO? Add an option to invert the normalized score before applying an equation.
- 				const float NormalizedScoreForEquation = /*bMirrorNormalizedScore ? (1.0f - NormalizedScore) :*/ NormalizedScore;
-				switch (ScoringEquation)
+			case EEnvTestScoreEquation::Constant:
+				// I know, it's not "constant".  It's "Constant, or zero".  The tooltip should explain that.
+				for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
 				{
-					case EEnvTestScoreEquation::Linear:
-						WeightedScore = ScoringFactorValue * NormalizedScoreForEquation;
-						break;
-
-					case EEnvTestScoreEquation::InverseLinear:
-					{
-						// For now, we're avoiding having a separate flag for flipping the direction of the curve
-						// because we don't have usage cases yet and want to avoid too complex UI.  If we decide
-						// to add that flag later, we'll need to remove this option, since it should just be "mirror
-						// curve" plus "Linear".
-						float InverseNormalizedScore = (1.0f - NormalizedScoreForEquation);
-						WeightedScore = ScoringFactorValue * InverseNormalizedScore;
-						break;
-					}
-
-					case EEnvTestScoreEquation::Square:
-						WeightedScore = ScoringFactorValue * (NormalizedScoreForEquation * NormalizedScoreForEquation);
-						break;
-
-					case EEnvTestScoreEquation::Constant:
-						// I know, it's not "constant".  It's "Constant, or zero".  The tooltip should explain that.
-						WeightedScore = (NormalizedScoreForEquation > 0) ? ScoringFactorValue : 0.0f;
-						break;
-						
-					default:
-						break;
+					WeightedScoresData[ValueIndex] = (WeightedScoresData[ValueIndex] > 0) ? ScoringFactorValue : 0.0f;
 				}
-			}
-			else
+				break;
+
+			default:
+				FMemory::Memzero(WeightedScoresData, NumValues * sizeof(float));
+				break;
+		}
+
+		for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
+		{
+			const int32 ItemIndex = ValidItemIndices[ValueIndex];
+			float WeightedScore = WeightedScoresData[ValueIndex];
+
+			if (TestValuesData[ValueIndex] == UEnvQueryTypes::SkippedItemValue)
 			{
-				TestValue = 0.0f;
+				QueryInstance.ItemDetails[ItemIndex].TestResults[QueryInstance.CurrentTest] = 0.0f;
 				WeightedScore = 0.0f;
 			}
 
 #if USE_EQS_DEBUGGER
-			DetailInfo->TestWeightedScores[QueryInstance.CurrentTest] = WeightedScore;
+			QueryInstance.ItemDetails[ItemIndex].TestWeightedScores[QueryInstance.CurrentTest] = WeightedScore;
 #endif
 			QueryInstance.Items[ItemIndex].Score += WeightedScore;
 		}
@@ -21,6 +21,16 @@ namespace
 	{
 		return PosB.Z - PosA.Z;
 	}
+
+	/** item locations split in component streams, distances are computed against each context location */
+	struct FEnvQueryDistanceItemValues : public FEnvQueryItemValues
+	{
+		TArray<float> ItemX;
+		TArray<float> ItemY;
+		TArray<float> ItemZ;
+		TArray<FVector> ContextLocations;
+		EEnvTestDistance::Type TestMode;
+	};
 }
 
 UEnvQueryTest_Distance::UEnvQueryTest_Distance(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -28,6 +38,7 @@ UEnvQueryTest_Distance::UEnvQueryTest_Distance(const FObjectInitializer& ObjectI
 	DistanceTo = UEnvQueryContext_Querier::StaticClass();
 	Cost = EEnvTestCost::Low;
 	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	bWorksOnItemValues = true;
 }
 
 void UEnvQueryTest_Distance::RunTest(FEnvQueryInstance& QueryInstance) const
@@ -88,6 +99,78 @@ void UEnvQueryTest_Distance::RunTest(FEnvQueryInstance& QueryInstance) const
 	}
 }
 
+TSharedPtr<FEnvQueryItemValues> UEnvQueryTest_Distance::PrepareItemValues(FEnvQueryInstance& QueryInstance) const
+{
+	TSharedPtr<FEnvQueryDistanceItemValues> ItemValues = MakeShareable(new FEnvQueryDistanceItemValues);
+	if (!QueryInstance.PrepareContext(DistanceTo, ItemValues->ContextLocations))
+	{
+		return nullptr;
+	}
+
+	const int32 NumItems = QueryInstance.Items.Num();
+	ItemValues->Init(NumItems, ItemValues->ContextLocations.Num());
+	ItemValues->TestMode = TestMode;
+	ItemValues->ItemX.AddUninitialized(NumItems);
+	ItemValues->ItemY.AddUninitialized(NumItems);
+	ItemValues->ItemZ.AddUninitialized(NumItems);
+	for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+	{
+		const FVector ItemLocation = QueryInstance.Items[ItemIndex].IsValid() ? GetItemLocation(QueryInstance, ItemIndex) : FVector::ZeroVector;
+		ItemValues->ItemX[ItemIndex] = ItemLocation.X;
+		ItemValues->ItemY[ItemIndex] = ItemLocation.Y;
+		ItemValues->ItemZ[ItemIndex] = ItemLocation.Z;
+	}
+
+	return ItemValues;
+}
+
+void UEnvQueryTest_Distance::CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const
+{
+	const FEnvQueryDistanceItemValues& DistanceValues = (const FEnvQueryDistanceItemValues&)ItemValues;
+	const float* ItemX = DistanceValues.ItemX.GetData();
+	const float* ItemY = DistanceValues.ItemY.GetData();
+	const float* ItemZ = DistanceValues.ItemZ.GetData();
+
+	for (int32 ContextIndex = 0; ContextIndex < DistanceValues.ContextLocations.Num(); ContextIndex++)
+	{
+		const FVector& ContextLocation = DistanceValues.ContextLocations[ContextIndex];
+		float* Distances = ItemValues.GetStream(ContextIndex);
+
+		switch (DistanceValues.TestMode)
+		{
+			case EEnvTestDistance::Distance3D:
+				for (int32 ItemIndex = FirstItem; ItemIndex < LastItem; ItemIndex++)
+				{
+					const float DeltaX = ContextLocation.X - ItemX[ItemIndex];
+					const float DeltaY = ContextLocation.Y - ItemY[ItemIndex];
+					const float DeltaZ = ContextLocation.Z - ItemZ[ItemIndex];
+					Distances[ItemIndex] = FMath::Sqrt(DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ);
+				}
+				break;
+
+			case EEnvTestDistance::Distance2D:
+				for (int32 ItemIndex = FirstItem; ItemIndex < LastItem; ItemIndex++)
+				{
+					const float DeltaX = ContextLocation.X - ItemX[ItemIndex];
+					const float DeltaY = ContextLocation.Y - ItemY[ItemIndex];
+					Distances[ItemIndex] = FMath::Sqrt(DeltaX * DeltaX + DeltaY * DeltaY);
+				}
+				break;
+
+			case EEnvTestDistance::DistanceZ:
+				for (int32 ItemIndex = FirstItem; ItemIndex < LastItem; ItemIndex++)
+				{
+					Distances[ItemIndex] = ContextLocation.Z - ItemZ[ItemIndex];
+				}
+				break;
+
+			default:
+				FMemory::Memzero(Distances + FirstItem, (LastItem - FirstItem) * sizeof(float));
+				break;
+		}
+	}
+}
+
 FText UEnvQueryTest_Distance::GetDescriptionTitle() const
 {
 	FString ModeDesc;
@@ -6,6 +6,58 @@
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Item.h"
 #include "EnvironmentQuery/Tests/EnvQueryTest_Dot.h"
 
+namespace
+{
+	/** directions of a line: gathered from contexts once, or built from item data when line uses Item context */
+	struct FEnvQueryDotLineValues
+	{
+		/** directions of line not depending on item */
+		TArray<FVector> Directions;
+
+		/** context locations of line built per item, item location replaces the one using Item context */
+		TArray<FVector> FromLocations;
+		TArray<FVector> ToLocations;
+
+		int32 NumDirections;
+		uint32 bPerItem : 1;
+		uint32 bUseItemRotation : 1;
+		uint32 bFromItem : 1;
+		uint32 bToItem : 1;
+
+		FORCEINLINE FVector GetDirection(int32 DirIndex, const FVector& ItemLocation, const FVector& ItemDirection) const
+		{
+			if (!bPerItem)
+			{
+				return Directions[DirIndex];
+			}
+
+			if (bUseItemRotation)
+			{
+				return ItemDirection;
+			}
+
+			// same order as GatherLineDirections: all "to" locations for each "from" location
+			const int32 NumTo = bToItem ? 1 : ToLocations.Num();
+			const FVector FromLocation = bFromItem ? ItemLocation : FromLocations[DirIndex / NumTo];
+			const FVector ToLocation = bToItem ? ItemLocation : ToLocations[DirIndex % NumTo];
+			return (ToLocation - FromLocation).GetSafeNormal();
+		}
+	};
+
+	struct FEnvQueryDotItemValues : public FEnvQueryItemValues
+	{
+		FEnvQueryDotLineValues LineA;
+		FEnvQueryDotLineValues LineB;
+
+		/** item data, gathered only when used by lines */
+		TArray<FVector> ItemLocations;
+		TArray<FVector> ItemDirections;
+
+		EEnvTestDot TestMode;
+		bool bAbsoluteValue;
+	};
+}
+
 UEnvQueryTest_Dot::UEnvQueryTest_Dot(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	Cost = EEnvTestCost::Low;
@@ -18,6 +70,7 @@ UEnvQueryTest_Dot::UEnvQueryTest_Dot(const FObjectInitializer& ObjectInitializer
 
 	TestMode = EEnvTestDot::Dot3D;
 	bAbsoluteValue = false;
+	bWorksOnItemValues = true;
 }
 
 void UEnvQueryTest_Dot::RunTest(FEnvQueryInstance& QueryInstance) const
@@ -104,6 +157,131 @@ void UEnvQueryTest_Dot::RunTest(FEnvQueryInstance& QueryInstance) const
 	}
 }
 
+TSharedPtr<FEnvQueryItemValues> UEnvQueryTest_Dot::PrepareItemValues(FEnvQueryInstance& QueryInstance) const
+{
+	TSharedPtr<FEnvQueryDotItemValues> ItemValues = MakeShareable(new FEnvQueryDotItemValues);
+
+	auto PrepareLine = [this, &QueryInstance](const FEnvDirection& Line, FEnvQueryDotLineValues& LineValues)
+	{
+		const bool bUseDirectionContext = (Line.DirMode == EEnvDirection::Rotation);
+		LineValues.bPerItem = RequiresPerItemUpdates(Line.LineFrom, Line.LineTo, Line.Rotation, bUseDirectionContext);
+		LineValues.bUseItemRotation = LineValues.bPerItem && bUseDirectionContext;
+		LineValues.bFromItem = LineValues.bPerItem && !bUseDirectionContext && IsContextPerItem(Line.LineFrom);
+		LineValues.bToItem = LineValues.bPerItem && !bUseDirectionContext && IsContextPerItem(Line.LineTo);
+
+		if (!LineValues.bPerItem)
+		{
+			GatherLineDirections(LineValues.Directions, QueryInstance, Line.LineFrom, Line.LineTo, Line.Rotation, bUseDirectionContext);
+			LineValues.NumDirections = LineValues.Directions.Num();
+		}
+		else if (LineValues.bUseItemRotation)
+		{
+			LineValues.NumDirections = 1;
+		}
+		else
+		{
+			if (!LineValues.bFromItem)
+			{
+				QueryInstance.PrepareContext(Line.LineFrom, LineValues.FromLocations);
+			}
+			if (!LineValues.bToItem)
+			{
+				QueryInstance.PrepareContext(Line.LineTo, LineValues.ToLocations);
+			}
+
+			LineValues.NumDirections = (LineValues.bFromItem ? 1 : LineValues.FromLocations.Num()) * (LineValues.bToItem ? 1 : LineValues.ToLocations.Num());
+		}
+	};
+
+	PrepareLine(LineA, ItemValues->LineA);
+	PrepareLine(LineB, ItemValues->LineB);
+
+	// lines not using items need at least one direction
+	if ((!ItemValues->LineA.bPerItem && ItemValues->LineA.NumDirections == 0) ||
+		(!ItemValues->LineB.bPerItem && ItemValues->LineB.NumDirections == 0))
+	{
+		return nullptr;
+	}
+
+	if (TestMode != EEnvTestDot::Dot3D && TestMode != EEnvTestDot::Dot2D)
+	{
+		UE_LOG(LogEQS, Error, TEXT("Invalid TestMode in EnvQueryTest_Dot in query %s!"), *QueryInstance.QueryName);
+	}
+
+	const int32 NumItems = QueryInstance.Items.Num();
+	ItemValues->Init(NumItems, ItemValues->LineA.NumDirections * ItemValues->LineB.NumDirections);
+	ItemValues->TestMode = TestMode;
+	ItemValues->bAbsoluteValue = bAbsoluteValue;
+
+	const bool bNeedsItemLocations = (ItemValues->LineA.bFromItem || ItemValues->LineA.bToItem || ItemValues->LineB.bFromItem || ItemValues->LineB.bToItem);
+	const bool bNeedsItemDirections = (ItemValues->LineA.bUseItemRotation || ItemValues->LineB.bUseItemRotation);
+	if (bNeedsItemLocations)
+	{
+		ItemValues->ItemLocations.AddZeroed(NumItems);
+	}
+	if (bNeedsItemDirections)
+	{
+		ItemValues->ItemDirections.AddZeroed(NumItems);
+	}
+
+	for (int32 ItemIndex = 0; ItemIndex < NumItems && (bNeedsItemLocations || bNeedsItemDirections); ItemIndex++)
+	{
+		if (QueryInstance.Items[ItemIndex].IsValid())
+		{
+			if (bNeedsItemLocations)
+			{
+				ItemValues->ItemLocations[ItemIndex] = GetItemLocation(QueryInstance, ItemIndex);
+			}
+			if (bNeedsItemDirections)
+			{
+				ItemValues->ItemDirections[ItemIndex] = GetItemRotation(QueryInstance, ItemIndex).Vector();
+			}
+		}
+	}
+
+	return ItemValues;
+}
+
+void UEnvQueryTest_Dot::CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const
+{
+	const FEnvQueryDotItemValues& DotValues = (const FEnvQueryDotItemValues&)ItemValues;
+	const bool bHasItemLocations = DotValues.ItemLocations.Num() > 0;
+	const bool bHasItemDirections = DotValues.ItemDirections.Num() > 0;
+
+	for (int32 ItemIndex = FirstItem; ItemIndex < LastItem; ItemIndex++)
+	{
+		const FVector ItemLocation = bHasItemLocations ? DotValues.ItemLocations[ItemIndex] : FVector::ZeroVector;
+		const FVector ItemDirection = bHasItemDirections ? DotValues.ItemDirections[ItemIndex] : FVector::ZeroVector;
+
+		int32 ValueIndex = 0;
+		for (int32 LineAIndex = 0; LineAIndex < DotValues.LineA.NumDirections; LineAIndex++)
+		{
+			const FVector LineADir = DotValues.LineA.GetDirection(LineAIndex, ItemLocation, ItemDirection);
+			for (int32 LineBIndex = 0; LineBIndex < DotValues.LineB.NumDirections; LineBIndex++, ValueIndex++)
+			{
+				const FVector LineBDir = DotValues.LineB.GetDirection(LineBIndex, ItemLocation, ItemDirection);
+
+				float DotValue = 0.f;
+				switch (DotValues.TestMode)
+				{
+					case EEnvTestDot::Dot3D:
+						DotValue = FVector::DotProduct(LineADir, LineBDir);
+						break;
+
+					case EEnvTestDot::Dot2D:
+						DotValue = LineADir.CosineAngle2D(LineBDir);
+						break;
+
+					default:
+						break;
+				}
+
+				ItemValues.GetStream(ValueIndex)[ItemIndex] = DotValues.bAbsoluteValue ? FMath::Abs(DotValue) : DotValue;
+			}
+		}
+	}
+}
+
 void UEnvQueryTest_Dot::GatherLineDirections(TArray<FVector>& Directions, FEnvQueryInstance& QueryInstance, const FVector& ItemLocation,
 	TSubclassOf<UEnvQueryContext> LineFrom, TSubclassOf<UEnvQueryContext> LineTo) const
 {
@@ -9,11 +9,29 @@
 
 #define LOCTEXT_NAMESPACE "EnvQueryGenerator"
 
+namespace
+{
+	/** path finding queries of all items, searched from worker threads with navigation data's pooled queries */
+	struct FEnvQueryPathfindingItemValues : public FEnvQueryItemValues
+	{
+		const ANavigationData* NavData;
+		/** one query for each context location and item, stored in streams like the values.
+		 *  Queries share the navigation data's filter, so they are only created and destroyed on game thread */
+		TArray<FPathFindingQuery> Queries;
+		TArray<bool> ValidItems;
+		EEnvTestPathfinding::Type TestMode;
+		EPathFindingMode::Type PathfindingMode;
+
+		FEnvQueryPathfindingItemValues() : NavData(NULL) {}
+	};
+}
+
 UEnvQueryTest_Pathfinding::UEnvQueryTest_Pathfinding(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	Context = UEnvQueryContext_Querier::StaticClass();
 	Cost = EEnvTestCost::High;
 	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	bWorksOnItemValues = true;
 	TestMode = EEnvTestPathfinding::PathExist;
 	PathFromContext.DefaultValue = true;
 	SkipUnreachable.DefaultValue = true;
@@ -116,6 +134,99 @@ void UEnvQueryTest_Pathfinding::RunTest(FEnvQueryInstance& QueryInstance) const
 	}
 }
 
+TSharedPtr<FEnvQueryItemValues> UEnvQueryTest_Pathfinding::PrepareItemValues(FEnvQueryInstance& QueryInstance) const
+{
+	UObject* DataOwner = QueryInstance.Owner.Get();
+	BoolValue.BindData(DataOwner, QueryInstance.QueryID);
+	PathFromContext.BindData(DataOwner, QueryInstance.QueryID);
+	SkipUnreachable.BindData(DataOwner, QueryInstance.QueryID);
+	UseHierarchicalPathfinding.BindData(DataOwner, QueryInstance.QueryID);
+
+	UNavigationSystem* NavSys = QueryInstance.World->GetNavigationSystem();
+	ANavigationData* NavData = NavSys ? FindNavigationData(NavSys, DataOwner) : NULL;
+	if (!NavData)
+	{
+		return nullptr;
+	}
+
+	TArray<FVector> ContextLocations;
+	if (!QueryInstance.PrepareContext(Context, ContextLocations))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FEnvQueryPathfindingItemValues> ItemValues = MakeShareable(new FEnvQueryPathfindingItemValues);
+	const int32 NumItems = QueryInstance.Items.Num();
+	const bool bPathToItem = PathFromContext.GetValue();
+	ItemValues->Init(NumItems, ContextLocations.Num());
+	ItemValues->NavData = NavData;
+	ItemValues->TestMode = TestMode;
+	ItemValues->PathfindingMode = UseHierarchicalPathfinding.GetValue() ? EPathFindingMode::Hierarchical : EPathFindingMode::Regular;
+	ItemValues->bBoolValues = !GetWorkOnFloatValues();
+	ItemValues->bExpectedBoolValue = BoolValue.GetValue();
+	ItemValues->bDiscardBigValues = GetWorkOnFloatValues() && SkipUnreachable.GetValue();
+
+	ItemValues->ValidItems.AddZeroed(NumItems);
+	TArray<FVector> ItemLocations;
+	ItemLocations.AddZeroed(NumItems);
+	for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+	{
+		if (QueryInstance.Items[ItemIndex].IsValid())
+		{
+			ItemValues->ValidItems[ItemIndex] = true;
+			ItemLocations[ItemIndex] = GetItemLocation(QueryInstance, ItemIndex);
+		}
+	}
+
+	ItemValues->Queries.Reserve(ContextLocations.Num() * NumItems);
+	for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
+	{
+		for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+		{
+			const FVector& ItemLocation = ItemLocations[ItemIndex];
+			const FVector& ContextLocation = ContextLocations[ContextIndex];
+			ItemValues->Queries.Add(FPathFindingQuery(DataOwner, NavData, bPathToItem ? ContextLocation : ItemLocation, bPathToItem ? ItemLocation : ContextLocation).SetAllowPartialPaths(false));
+		}
+	}
+
+	return ItemValues;
+}
+
+void UEnvQueryTest_Pathfinding::CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const
+{
+	const FEnvQueryPathfindingItemValues& PathValues = (const FEnvQueryPathfindingItemValues&)ItemValues;
+	const ANavigationData* NavData = PathValues.NavData;
+	const bool bHierarchical = (PathValues.PathfindingMode == EPathFindingMode::Hierarchical);
+
+	for (int32 ContextIndex = 0; ContextIndex < PathValues.NumValuesPerItem; ContextIndex++)
+	{
+		const FPathFindingQuery* Queries = PathValues.Queries.GetData() + ContextIndex * PathValues.NumItems;
+		float* Values = ItemValues.GetStream(ContextIndex);
+
+		for (int32 ItemIndex = FirstItem; ItemIndex < LastItem; ItemIndex++)
+		{
+			if (!PathValues.ValidItems[ItemIndex])
+			{
+				Values[ItemIndex] = 0.f;
+				continue;
+			}
+
+			const FPathFindingQuery& Query = Queries[ItemIndex];
+			if (PathValues.TestMode == EEnvTestPathfinding::PathExist)
+			{
+				const bool bPathExists = bHierarchical ? NavData->TestHierarchicalPath(FNavAgentProperties(), Query, NULL) : NavData->TestPath(FNavAgentProperties(), Query, NULL);
+				Values[ItemIndex] = bPathExists ? 1.f : 0.f;
+			}
+			else
+			{
+				FPathFindingResult Result = bHierarchical ? NavData->FindHierarchicalPath(FNavAgentProperties(), Query) : NavData->FindPath(FNavAgentProperties(), Query);
+				Values[ItemIndex] = !Result.IsSuccessful() ? BIG_NUMBER :
+					(PathValues.TestMode == EEnvTestPathfinding::PathLength) ? Result.Path->GetLength() : Result.Path->GetCost();
+			}
+		}
+	}
+}
+
 FText UEnvQueryTest_Pathfinding::GetDescriptionTitle() const
 {
 	FString ModeDesc[] = { TEXT("PathExist"), TEXT("PathCost"), TEXT("PathLength") };
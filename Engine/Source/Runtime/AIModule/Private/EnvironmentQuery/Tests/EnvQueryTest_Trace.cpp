@@ -7,11 +7,55 @@
 
 #define LOCTEXT_NAMESPACE "EnvQueryGenerator"
 
+namespace
+{
+	/** everything needed for tracing from worker threads, item actors are resolved into ignored components on game thread */
+	struct FEnvQueryTraceItemValues : public FEnvQueryItemValues
+	{
+		UWorld* World;
+		TArray<FVector> ItemLocations;
+		TArray<bool> ValidItems;
+		/** index in ItemTraceParams for items with actors, INDEX_NONE to use TraceParams */
+		TArray<int32> ItemTraceParamsIndex;
+		TArray<FCollisionQueryParams> ItemTraceParams;
+		TArray<FVector> ContextLocations;
+		FCollisionQueryParams TraceParams;
+		FVector TraceExtent;
+		ECollisionChannel TraceChannel;
+		EEnvTraceShape::Type TraceShape;
+		bool bTraceToItem;
+
+		FEnvQueryTraceItemValues() : World(NULL) {}
+	};
+
+	bool RunTrace(const FEnvQueryTraceItemValues& TraceValues, const FVector& Start, const FVector& End, const FCollisionQueryParams& TraceParams)
+	{
+		switch (TraceValues.TraceShape)
+		{
+			case EEnvTraceShape::Line:
+				return TraceValues.World->LineTraceTestByChannel(Start, End, TraceValues.TraceChannel, TraceParams);
+
+			case EEnvTraceShape::Box:
+				return TraceValues.World->SweepTestByChannel(Start, End, FQuat((End - Start).Rotation()), TraceValues.TraceChannel, FCollisionShape::MakeBox(TraceValues.TraceExtent), TraceParams);
+
+			case EEnvTraceShape::Sphere:
+				return TraceValues.World->SweepTestByChannel(Start, End, FQuat::Identity, TraceValues.TraceChannel, FCollisionShape::MakeSphere(TraceValues.TraceExtent.X), TraceParams);
+
+			case EEnvTraceShape::Capsule:
+				return TraceValues.World->SweepTestByChannel(Start, End, FQuat::Identity, TraceValues.TraceChannel, FCollisionShape::MakeCapsule(TraceValues.TraceExtent.X, TraceValues.TraceExtent.Z), TraceParams);
+
+			default:
+				return false;
+		}
+	}
+}
+
 UEnvQueryTest_Trace::UEnvQueryTest_Trace(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	Cost = EEnvTestCost::High;
 	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
 	SetWorkOnFloatValues(false);
+	bWorksOnItemValues = true;
 	
 	Context = UEnvQueryContext_Querier::StaticClass();
 	TraceData.SetGeometryOnly();
@@ -88,6 +132,96 @@ void UEnvQueryTest_Trace::RunTest(FEnvQueryInstance& QueryInstance) const
 	}
 }
 
+TSharedPtr<FEnvQueryItemValues> UEnvQueryTest_Trace::PrepareItemValues(FEnvQueryInstance& QueryInstance) const
+{
+	if (TraceData.TraceShape > EEnvTraceShape::Capsule)
+	{
+		return nullptr;
+	}
+
+	UObject* DataOwner = QueryInstance.Owner.Get();
+	BoolValue.BindData(DataOwner, QueryInstance.QueryID);
+	TraceFromContext.BindData(DataOwner, QueryInstance.QueryID);
+	ItemHeightOffset.BindData(DataOwner, QueryInstance.QueryID);
+	ContextHeightOffset.BindData(DataOwner, QueryInstance.QueryID);
+
+	TSharedPtr<FEnvQueryTraceItemValues> ItemValues = MakeShareable(new FEnvQueryTraceItemValues);
+	if (!QueryInstance.PrepareContext(Context, ItemValues->ContextLocations))
+	{
+		return nullptr;
+	}
+
+	const float ContextZ = ContextHeightOffset.GetValue();
+	for (FVector& ContextLocation : ItemValues->ContextLocations)
+	{
+		ContextLocation.Z += ContextZ;
+	}
+
+	ItemValues->TraceParams = FCollisionQueryParams(TEXT("EnvQueryTrace"), TraceData.bTraceComplex);
+	ItemValues->TraceParams.bTraceAsyncScene = true;
+
+	TArray<AActor*> IgnoredActors;
+	if (QueryInstance.PrepareContext(Context, IgnoredActors))
+	{
+		ItemValues->TraceParams.AddIgnoredActors(IgnoredActors);
+	}
+
+	ItemValues->World = QueryInstance.World;
+	ItemValues->TraceChannel = UEngineTypes::ConvertToCollisionChannel(TraceData.TraceChannel);
+	ItemValues->TraceExtent = FVector(TraceData.ExtentX, TraceData.ExtentY, TraceData.ExtentZ);
+	ItemValues->TraceShape = TraceData.TraceShape;
+	ItemValues->bTraceToItem = TraceFromContext.GetValue();
+	ItemValues->bBoolValues = true;
+	ItemValues->bExpectedBoolValue = BoolValue.GetValue();
+
+	const int32 NumItems = QueryInstance.Items.Num();
+	const float ItemZ = ItemHeightOffset.GetValue();
+	ItemValues->Init(NumItems, ItemValues->ContextLocations.Num());
+	ItemValues->ItemLocations.AddZeroed(NumItems);
+	ItemValues->ValidItems.AddZeroed(NumItems);
+	ItemValues->ItemTraceParamsIndex.Init(INDEX_NONE, NumItems);
+	for (int32 ItemIndex = 0; ItemIndex < NumItems; ItemIndex++)
+	{
+		if (!QueryInstance.Items[ItemIndex].IsValid())
+		{
+			continue;
+		}
+
+		ItemValues->ValidItems[ItemIndex] = true;
+		ItemValues->ItemLocations[ItemIndex] = GetItemLocation(QueryInstance, ItemIndex) + FVector(0, 0, ItemZ);
+
+		// collecting components to ignore reads the actor, which is not safe from worker threads
+		const AActor* ItemActor = GetItemActor(QueryInstance, ItemIndex);
+		if (ItemActor)
+		{
+			ItemValues->ItemTraceParamsIndex[ItemIndex] = ItemValues->ItemTraceParams.Add(ItemValues->TraceParams);
+			ItemValues->ItemTraceParams.Last().AddIgnoredActor(ItemActor);
+		}
+	}
+
+	return ItemValues;
+}
+
+void UEnvQueryTest_Trace::CalcItemValues(FEnvQueryItemValues& ItemValues, int32 FirstItem, int32 LastItem) const
+{
+	const FEnvQueryTraceItemValues& TraceValues = (const FEnvQueryTraceItemValues&)ItemValues;
+	for (int32 ItemIndex = FirstItem; ItemIndex < LastItem; ItemIndex++)
+	{
+		const FVector& ItemLocation = TraceValues.ItemLocations[ItemIndex];
+		const int32 TraceParamsIndex = TraceValues.ItemTraceParamsIndex[ItemIndex];
+		const FCollisionQueryParams& TraceParams = (TraceParamsIndex != INDEX_NONE) ? TraceValues.ItemTraceParams[TraceParamsIndex] : TraceValues.TraceParams;
+
+		for (int32 ContextIndex = 0; ContextIndex < TraceValues.ContextLocations.Num(); ContextIndex++)
+		{
+			const FVector& ContextLocation = TraceValues.ContextLocations[ContextIndex];
+			const bool bHit = TraceValues.ValidItems[ItemIndex] &&
+				(TraceValues.bTraceToItem ? RunTrace(TraceValues, ContextLocation, ItemLocation, TraceParams) : RunTrace(TraceValues, ItemLocation, ContextLocation, TraceParams));
+
+			ItemValues.GetStream(ContextIndex)[ItemIndex] = bHit ? 1.f : 0.f;
+		}
+	}
+}
+
 FText UEnvQueryTest_Trace::GetDescriptionTitle() const
 {
 	UEnum* ChannelEnum = FindObject<UEnum>(ANY_PACKAGE, TEXT("ETraceTypeQuery"), true);
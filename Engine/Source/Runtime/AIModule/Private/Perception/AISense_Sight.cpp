@@ -17,8 +17,11 @@
 
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight"),STAT_AI_Sense_Sight,STATGROUP_AI);
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Listener Update"), STAT_AI_Sense_Sight_ListenerUpdate, STATGROUP_AI);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Perception Sense: Sight, Traces per second"), STAT_AI_Sense_Sight_TracesPerSecond, STATGROUP_AI);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Perception Sense: Sight, Average staleness (s)"), STAT_AI_Sense_Sight_Staleness, STATGROUP_AI);
 
 static const int32 DefaultMaxTracesPerTick = 6;
+static const int32 DefaultMaxAsyncTracesPerTick = 64;
 
 //----------------------------------------------------------------------//
 // helpers
@@ -72,7 +75,15 @@ UAISense_Sight::FDigestedSightProperties::FDigestedSightProperties()
 //----------------------------------------------------------------------//
 UAISense_Sight::UAISense_Sight(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, SightQueryUpdateCounter(0)
+	, SightUpdateTime(0.f)
+	, NumTracesSinceStatsUpdate(0)
+	, NumQueriesSinceStatsUpdate(0)
+	, StalenessSinceStatsUpdate(0.f)
+	, StatsUpdateTime(0)
 	, MaxTracesPerTick(DefaultMaxTracesPerTick)
+	, MaxAsyncTracesPerTick(DefaultMaxAsyncTracesPerTick)
+	, bUseAsyncTraces(true)
 	, HighImportanceQueryDistanceThreshold(300.f)
 	, MaxQueryImportance(60.f)
 	, SightLimitQueryImportance(10.f)
@@ -107,149 +118,242 @@ float UAISense_Sight::Update()
 
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
-	const UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter());
+	UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter());
 
 	if (World == NULL)
 	{
 		return SuspendNextUpdate;
 	}
 
-	int32 TracesCount = 0;
+	++SightQueryUpdateCounter;
+	SightUpdateTime = World->GetTimeSeconds();
+
 	static const int32 InitialInvalidItemsSize = 16;
-	TArray<int32> InvalidQueries;
 	TArray<FAISightTarget::FTargetId> InvalidTargets;
-	InvalidQueries.Reserve(InitialInvalidItemsSize);
 	InvalidTargets.Reserve(InitialInvalidItemsSize);
 
+	// queries processed in this update are put back in the queue once it's done, so that they don't get picked again
+	TArray<FAISightQuery> ProcessedQueries;
+	ProcessedQueries.Reserve(MaxTracesPerTick + MaxAsyncTracesPerTick);
+
+	ProcessPendingSightTraces(*World, ProcessedQueries, InvalidTargets);
+
 	AIPerception::FListenerMap& ListenersMap = *GetListeners();
 
-	FAISightQuery* SightQuery = SightQueryQueue.GetData();
-	for (int32 QueryIndex = 0; QueryIndex < SightQueryQueue.Num(); ++QueryIndex, ++SightQuery)
+	int32 TracesCount = 0;
+	int32 AsyncTracesCount = 0;
+	const int32 MaxAsyncTraces = bUseAsyncTraces ? MaxAsyncTracesPerTick : 0;
+
+	FAISightQuery SightQuery;
+	while (SightQueryQueue.Num() > 0 && (TracesCount < MaxTracesPerTick || AsyncTracesCount < MaxAsyncTraces))
 	{
-		if (TracesCount < MaxTracesPerTick)
-		{
-			FPerceptionListener& Listener = ListenersMap[SightQuery->ObserverId];
-			ensure(Listener.Listener.IsValid());
-			FAISightTarget& Target = ObservedTargets[SightQuery->TargetId];
+		SightQueryQueue.HeapPop(SightQuery, FAISightQuery::FSortPredicate());
+
+		FPerceptionListener& Listener = ListenersMap[SightQuery.ObserverId];
+		ensure(Listener.Listener.IsValid());
+		FAISightTarget& Target = ObservedTargets[SightQuery.TargetId];
 					
-			const bool bTargetValid = Target.Target.IsValid();
-			const bool bListenerValid = Listener.Listener.IsValid();
+		const bool bTargetValid = Target.Target.IsValid();
+		const bool bListenerValid = Listener.Listener.IsValid();
 
-			// @todo figure out what should we do if not valid
-			if (bTargetValid && bListenerValid)
+		// @todo figure out what should we do if not valid
+		if (bTargetValid == false || bListenerValid == false)
+		{
+			// drop the query
+			if (bTargetValid == false)
 			{
-				AActor* TargetActor = Target.Target.Get();
-				const FVector TargetLocation = TargetActor->GetActorLocation();
-				const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery->ObserverId];
-				const float SightRadiusSq = SightQuery->bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq;
-
-				if (CheckIsTargetInSightPie(Listener, PropDigest, TargetLocation, SightRadiusSq))
-				{
-					SIGHT_LOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Green, TEXT("%s"), *(Target.TargetId.ToString()));
-
-					FVector OutSeenLocation(0.f);
-					// do line checks
-					if (Target.SightTargetInterface != NULL)
-					{
-						int32 NumberOfLoSChecksPerformed = 0;
-						// defaulting to 1 to have "full strength" by default instead of "no strength"
-						float SightStrength = 1.f;
-						if (Target.SightTargetInterface->CanBeSeenFrom(Listener.CachedLocation, OutSeenLocation, NumberOfLoSChecksPerformed, SightStrength, Listener.Listener->GetBodyActor()) == true)
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, SightStrength, OutSeenLocation, Listener.CachedLocation));
-							SightQuery->bLastResult = true;
-						}
-						else
-						{
-							SIGHT_LOG_LOCATION(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-							SightQuery->bLastResult = false;
-						}
-
-						TracesCount += NumberOfLoSChecksPerformed;
-					}
-					else
-					{
-						// we need to do tests ourselves
-						FHitResult HitResult;
-						const bool bHit = World->LineTraceSingleByObjectType(HitResult, Listener.CachedLocation, TargetLocation
-							, FCollisionObjectQueryParams(ECC_WorldStatic)
-							, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor()));
-
-						++TracesCount;
-
-						if (bHit == false || (HitResult.Actor.IsValid() && HitResult.Actor->IsOwnedBy(TargetActor)))
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation));
-							SightQuery->bLastResult = true;
-						}
-						else
-						{
-							SIGHT_LOG_LOCATION(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-							SightQuery->bLastResult = false;
-						}
-					}
-				}
-				else
-				{
-					SIGHT_LOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Red, TEXT("%s"), *(Target.TargetId.ToString()));
-					Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-					SightQuery->bLastResult = false;
-				}
-
-				SightQuery->Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
-
-				// restart query
-				SightQuery->Age = 0.f;
+				InvalidTargets.AddUnique(SightQuery.TargetId);
+			}
+			continue;
+		}
+
+		AActor* TargetActor = Target.Target.Get();
+		const FVector TargetLocation = TargetActor->GetActorLocation();
+		const FDigestedSightProperties& PropDigest = DigestedProperties[SightQuery.ObserverId];
+		const float SightRadiusSq = SightQuery.bLastResult ? PropDigest.LoseSightRadiusSq : PropDigest.SightRadiusSq;
+
+		if (CheckIsTargetInSightPie(Listener, PropDigest, TargetLocation, SightRadiusSq) == false)
+		{
+			SIGHT_LOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Red, TEXT("%s"), *(Target.TargetId.ToString()));
+			ProcessSightResult(Listener, *TargetActor, SightQuery, false, 0.f, TargetLocation, TargetLocation, SightRadiusSq);
+		}
+		else if (Target.SightTargetInterface != NULL || MaxAsyncTraces == 0)
+		{
+			if (TracesCount >= MaxTracesPerTick)
+			{
+				// out of budget, the query keeps its age
+				ProcessedQueries.Add(SightQuery);
+				continue;
+			}
+
+			SIGHT_LOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Green, TEXT("%s"), *(Target.TargetId.ToString()));
+
+			// do line checks
+			if (Target.SightTargetInterface != NULL)
+			{
+				FVector OutSeenLocation(0.f);
+				int32 NumberOfLoSChecksPerformed = 0;
+				// defaulting to 1 to have "full strength" by default instead of "no strength"
+				float SightStrength = 1.f;
+				const bool bCanSee = Target.SightTargetInterface->CanBeSeenFrom(Listener.CachedLocation, OutSeenLocation, NumberOfLoSChecksPerformed, SightStrength, Listener.Listener->GetBodyActor());
+				ProcessSightResult(Listener, *TargetActor, SightQuery, bCanSee, SightStrength, OutSeenLocation, TargetLocation, SightRadiusSq);
+
+				TracesCount += NumberOfLoSChecksPerformed;
 			}
 			else
 			{
-				// put this index to "to be removed" array
-				InvalidQueries.Add(QueryIndex);
-				if (bTargetValid == false)
-				{
-					InvalidTargets.AddUnique(SightQuery->TargetId);
-				}
+				// we need to do tests ourselves
+				FHitResult HitResult;
+				const bool bHit = World->LineTraceSingleByObjectType(HitResult, Listener.CachedLocation, TargetLocation
+					, FCollisionObjectQueryParams(ECC_WorldStatic)
+					, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor()));
+
+				++TracesCount;
+
+				const bool bCanSee = bHit == false || (HitResult.Actor.IsValid() && HitResult.Actor->IsOwnedBy(TargetActor));
+				ProcessSightResult(Listener, *TargetActor, SightQuery, bCanSee, 1.f, TargetLocation, TargetLocation, SightRadiusSq);
 			}
 		}
 		else
 		{
-			// age unprocessed queries so that they can advance in the queue during next sort
-			SightQuery->Age += 1.f;
+			if (AsyncTracesCount >= MaxAsyncTraces)
+			{
+				// out of budget, the query keeps its age
+				ProcessedQueries.Add(SightQuery);
+				continue;
+			}
+
+			SIGHT_LOG_SEGMENT(Listener.Listener.Get()->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Green, TEXT("%s"), *(Target.TargetId.ToString()));
+
+			// the query waits for the trace result out of the queue
+			FPendingSightTrace PendingTrace;
+			PendingTrace.Query = SightQuery;
+			PendingTrace.TargetLocation = TargetLocation;
+			PendingTrace.SightRadiusSq = SightRadiusSq;
+			PendingTrace.TraceHandle = World->AsyncLineTraceByObjectType(Listener.CachedLocation, TargetLocation
+				, FCollisionObjectQueryParams(ECC_WorldStatic)
+				, FCollisionQueryParams(NAME_AILineOfSight, true, Listener.Listener->GetBodyActor()));
+			PendingSightTraces.Add(PendingTrace);
+
+			++AsyncTracesCount;
+			continue;
 		}
 
-		SightQuery->RecalcScore();
+		ProcessedQueries.Add(SightQuery);
 	}
 
-	if (InvalidQueries.Num() > 0)
+	for (const FAISightQuery& ProcessedQuery : ProcessedQueries)
 	{
-		for (int32 Index = InvalidQueries.Num() - 1; Index >= 0; --Index)
+		SightQueryQueue.HeapPush(ProcessedQuery, FAISightQuery::FSortPredicate());
+	}
+
+	if (InvalidTargets.Num() > 0)
+	{
+		for (const auto& TargetId : InvalidTargets)
 		{
-			// removing with swapping here, since queue is going to be sorted anyway
-			SightQueryQueue.RemoveAtSwap(InvalidQueries[Index], 1, /*bAllowShrinking*/false);
+			// remove affected queries
+			RemoveAllQueriesToTarget(TargetId, DontSort);
+			// remove target itself
+			ObservedTargets.Remove(TargetId);
+		}
+
+		// remove holes
+		ObservedTargets.Compact();
+
+		SortQueries();
+	}
+
+	NumTracesSinceStatsUpdate += TracesCount + AsyncTracesCount;
+	UpdateSightStats();
+
+	//return SightQueryQueue.Num() > 0 ? 1.f/6 : FLT_MAX;
+	return 0.f;
+}
+
+void UAISense_Sight::ProcessPendingSightTraces(UWorld& World, TArray<FAISightQuery>& OutQueries, TArray<FAISightTarget::FTargetId>& InvalidTargets)
+{
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+	FTraceDatum TraceDatum;
+
+	for (int32 Index = PendingSightTraces.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingSightTrace& PendingTrace = PendingSightTraces[Index];
+		const bool bHasResult = World.QueryTraceData(PendingTrace.TraceHandle, TraceDatum);
+		if (bHasResult == false && World.IsTraceHandleValid(PendingTrace.TraceHandle, /*bOverlapTrace=*/false))
+		{
+			// not traced yet
+			continue;
 		}
 
-		if (InvalidTargets.Num() > 0)
+		FAISightQuery& SightQuery = PendingTrace.Query;
+		FPerceptionListener& Listener = ListenersMap[SightQuery.ObserverId];
+		FAISightTarget& Target = ObservedTargets[SightQuery.TargetId];
+
+		const bool bTargetValid = Target.Target.IsValid();
+		const bool bListenerValid = Listener.Listener.IsValid();
+		if (bTargetValid && bListenerValid)
 		{
-			for (const auto& TargetId : InvalidTargets)
+			// without a result the trace got dropped, e.g. when perception didn't update for a frame, and the query is simply put back in the queue
+			if (bHasResult)
 			{
-				// remove affected queries
-				RemoveAllQueriesToTarget(TargetId, DontSort);
-				// remove target itself
-				ObservedTargets.Remove(TargetId);
+				AActor* TargetActor = Target.Target.Get();
+				const FHitResult* HitResult = TraceDatum.OutHits.Num() > 0 ? &TraceDatum.OutHits[0] : NULL;
+				const bool bCanSee = HitResult == NULL || (HitResult->Actor.IsValid() && HitResult->Actor->IsOwnedBy(TargetActor));
+				ProcessSightResult(Listener, *TargetActor, SightQuery, bCanSee, 1.f, PendingTrace.TargetLocation, PendingTrace.TargetLocation, PendingTrace.SightRadiusSq);
 			}
-
-			// remove holes
-			ObservedTargets.Compact();
+			OutQueries.Add(SightQuery);
 		}
+		else if (bTargetValid == false)
+		{
+			InvalidTargets.AddUnique(SightQuery.TargetId);
+		}
+
+		PendingSightTraces.RemoveAtSwap(Index, 1, /*bAllowShrinking=*/false);
 	}
+}
 
-	// sort Sight Queries
-	SortQueries();
+void UAISense_Sight::ProcessSightResult(FPerceptionListener& Listener, AActor& TargetActor, FAISightQuery& SightQuery, bool bCanSee, float SightStrength, const FVector& SeenLocation, const FVector& TargetLocation, float SightRadiusSq)
+{
+	if (bCanSee)
+	{
+		Listener.RegisterStimulus(&TargetActor, FAIStimulus(*this, SightStrength, SeenLocation, Listener.CachedLocation));
+	}
+	else
+	{
+		SIGHT_LOG_LOCATION(Listener.Listener.Get()->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
+		Listener.RegisterStimulus(&TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+	}
+	SightQuery.bLastResult = bCanSee;
 
-	//return SightQueryQueue.Num() > 0 ? 1.f/6 : FLT_MAX;
-	return 0.f;
+	SightQuery.Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
+
+	++NumQueriesSinceStatsUpdate;
+	StalenessSinceStatsUpdate += SightUpdateTime - SightQuery.LastProcessedTime;
+
+	// restart query
+	SightQuery.LastProcessedUpdate = SightQueryUpdateCounter;
+	SightQuery.LastProcessedTime = SightUpdateTime;
+}
+
+void UAISense_Sight::UpdateSightStats()
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double StatsInterval = CurrentTime - StatsUpdateTime;
+	if (StatsInterval < 1.0)
+	{
+		return;
+	}
+
+	if (StatsUpdateTime > 0)
+	{
+		SET_FLOAT_STAT(STAT_AI_Sense_Sight_TracesPerSecond, float(NumTracesSinceStatsUpdate / StatsInterval));
+		SET_FLOAT_STAT(STAT_AI_Sense_Sight_Staleness, NumQueriesSinceStatsUpdate > 0 ? StalenessSinceStatsUpdate / NumQueriesSinceStatsUpdate : 0.f);
+	}
+
+	NumTracesSinceStatsUpdate = 0;
+	NumQueriesSinceStatsUpdate = 0;
+	StalenessSinceStatsUpdate = 0.f;
+	StatsUpdateTime = CurrentTime;
 }
 
 void UAISense_Sight::RegisterEvent(const FAISightEvent& Event)
@@ -296,6 +400,8 @@ bool UAISense_Sight::RegisterTarget(AActor& TargetActor, FQueriesOperationPostPr
 			FAISightQuery SightQuery(ItListener->Key, SightTarget->TargetId);
 			const FDigestedSightProperties& PropDigest = DigestedProperties[Listener.GetListenerID()];
 			SightQuery.Importance = CalcQueryImportance(ItListener->Value, TargetLocation, PropDigest.SightRadiusSq);
+			SightQuery.LastProcessedUpdate = SightQueryUpdateCounter;
+			SightQuery.LastProcessedTime = SightUpdateTime;
 
 			SightQueryQueue.Add(SightQuery);
 			bNewQueriesAdded = true;
@@ -323,7 +429,7 @@ void UAISense_Sight::OnNewListenerImpl(const FPerceptionListener& NewListener)
 	GenerateQueriesForListener(NewListener, PropertyDigest);
 }
 
-void UAISense_Sight::GenerateQueriesForListener(const FPerceptionListener& Listener, const FDigestedSightProperties& PropertyDigest)
+void UAISense_Sight::GenerateQueriesForListener(const FPerceptionListener& Listener, const FDigestedSightProperties& PropertyDigest, FQueriesOperationPostProcess PostProcess)
 {
 	bool bNewQueriesAdded = false;
 	const IGenericTeamAgentInterface* ListenersTeamAgent = Listener.GetTeamAgent();
@@ -343,6 +449,8 @@ void UAISense_Sight::GenerateQueriesForListener(const FPerceptionListener& Liste
 			// create a sight query		
 			FAISightQuery SightQuery(Listener.GetListenerID(), ItTarget->Key);
 			SightQuery.Importance = CalcQueryImportance(Listener, ItTarget->Value.GetLocationSimple(), PropertyDigest.SightRadiusSq);
+			SightQuery.LastProcessedUpdate = SightQueryUpdateCounter;
+			SightQuery.LastProcessedTime = SightUpdateTime;
 
 			SightQueryQueue.Add(SightQuery);
 			bNewQueriesAdded = true;
@@ -352,7 +460,10 @@ void UAISense_Sight::GenerateQueriesForListener(const FPerceptionListener& Liste
 	// sort Sight Queries
 	if (bNewQueriesAdded)
 	{
-		SortQueries();
+		if (PostProcess == Sort)
+		{
+			SortQueries();
+		}
 		RequestImmediateUpdate();
 	}
 }
@@ -389,12 +500,15 @@ void UAISense_Sight::OnListenerUpdateImpl(const FPerceptionListener& UpdatedList
 		FDigestedSightProperties& PropertiesDigest = DigestedProperties.FindOrAdd(ListenerID);
 		PropertiesDigest = FDigestedSightProperties(*SenseConfig);
 
-		GenerateQueriesForListener(UpdatedListener, PropertiesDigest);
+		GenerateQueriesForListener(UpdatedListener, PropertiesDigest, DontSort);
 	}
 	else
 	{
 		DigestedProperties.FindAndRemoveChecked(ListenerID);
 	}
+
+	// queries got removed and added in bulk
+	SortQueries();
 }
 
 void UAISense_Sight::OnListenerRemovedImpl(const FPerceptionListener& UpdatedListener)
@@ -410,36 +524,33 @@ void UAISense_Sight::OnListenerRemovedImpl(const FPerceptionListener& UpdatedLis
 		FAISightTarget* AsTarget = ObservedTargets.Find(AsTargetId);
 		if (AsTarget != NULL)
 		{
-			RemoveAllQueriesToTarget(AsTargetId, Sort);			
+			RemoveAllQueriesToTarget(AsTargetId, DontSort);
 		}
 	}
 	else
 	{
 		//@todo quite possible there are left over sight queries with this listener as target
 	}
+
+	SortQueries();
 }
 
 void UAISense_Sight::RemoveAllQueriesByListener(const FPerceptionListener& Listener, FQueriesOperationPostProcess PostProcess)
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
+	const uint32 ListenerId = Listener.GetListenerID();
+
+	// queries waiting for their trace are not in the queue
+	PendingSightTraces.RemoveAll([ListenerId](const FPendingSightTrace& PendingTrace) { return PendingTrace.Query.ObserverId == ListenerId; });
+
 	if (SightQueryQueue.Num() == 0)
 	{
 		return;
 	}
 
-	const uint32 ListenerId = Listener.GetListenerID();
-	bool bQueriesRemoved = false;
-	
-	const FAISightQuery* SightQuery = &SightQueryQueue[SightQueryQueue.Num() - 1];
-	for (int32 QueryIndex = SightQueryQueue.Num() - 1; QueryIndex >= 0 ; --QueryIndex, --SightQuery)
-	{
-		if (SightQuery->ObserverId == ListenerId)
-		{
-			SightQueryQueue.RemoveAt(QueryIndex, 1, /*bAllowShrinking=*/false);
-			bQueriesRemoved = true;
-		}
-	}
+	const int32 NumRemoved = SightQueryQueue.RemoveAll([ListenerId](const FAISightQuery& SightQuery) { return SightQuery.ObserverId == ListenerId; });
+	const bool bQueriesRemoved = NumRemoved > 0;
 
 	if (PostProcess == Sort && bQueriesRemoved)
 	{
@@ -451,22 +562,16 @@ void UAISense_Sight::RemoveAllQueriesToTarget(const FName& TargetId, FQueriesOpe
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
+	// queries waiting for their trace are not in the queue
+	PendingSightTraces.RemoveAll([&TargetId](const FPendingSightTrace& PendingTrace) { return PendingTrace.Query.TargetId == TargetId; });
+
 	if (SightQueryQueue.Num() == 0)
 	{
 		return;
 	}
 
-	bool bQueriesRemoved = false;
-
-	const FAISightQuery* SightQuery = &SightQueryQueue[SightQueryQueue.Num() - 1];
-	for (int32 QueryIndex = SightQueryQueue.Num() - 1; QueryIndex >= 0 ; --QueryIndex, --SightQuery)
-	{
-		if (SightQuery->TargetId == TargetId)
-		{
-			SightQueryQueue.RemoveAt(QueryIndex, 1, /*bAllowShrinking=*/false);
-			bQueriesRemoved = true;
-		}
-	}
+	const int32 NumRemoved = SightQueryQueue.RemoveAll([&TargetId](const FAISightQuery& SightQuery) { return SightQuery.TargetId == TargetId; });
+	const bool bQueriesRemoved = NumRemoved > 0;
 
 	if (PostProcess == Sort && bQueriesRemoved)
 	{
@@ -37,4 +37,6 @@
 #include "StringClassReference.h"
 #include "Blueprint/BlueprintSupport.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogScriptSerialization, Log, All);
+
 #endif // COREUOBJECT_PRIVATE_H
\ No newline at end of file
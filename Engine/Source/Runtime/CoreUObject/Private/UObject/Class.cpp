@@ -11,7 +11,6 @@
 #include "LinkerPlaceholderFunction.h"
 #include "StructScriptLoader.h"
 
-DECLARE_LOG_CATEGORY_EXTERN(LogScriptSerialization, Log, All);
 DEFINE_LOG_CATEGORY(LogScriptSerialization);
 DEFINE_LOG_CATEGORY(LogClass);
 
@@ -3723,6 +3722,7 @@ UFunction::UFunction(const FObjectInitializer& ObjectInitializer, UFunction* InS
 , EventGraphFunction(nullptr)
 , EventGraphCallOffset(0)
 #endif
+, DecodedScript(nullptr)
 {
 }
 
@@ -3848,6 +3848,16 @@ void UFunction::Link(FArchive& Ar, bool bRelinkExistingProperties)
 	Super::Link(Ar, bRelinkExistingProperties);
 
 	InitializeDerivedMembers();
+
+	// the script and the parameters may have changed
+	ResetDecodedScript();
+}
+
+void UFunction::FinishDestroy()
+{
+	ResetDecodedScript();
+
+	Super::FinishDestroy();
 }
 
 bool UFunction::IsSignatureCompatibleWith(const UFunction* OtherFunction) const
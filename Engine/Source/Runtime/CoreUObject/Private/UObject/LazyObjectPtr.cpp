@@ -88,7 +88,8 @@ void FLazyObjectPtr::PossiblySerializeObjectGuid(UObject *Object, FArchive& Ar)
 {
 	if (Ar.IsSaving() || Ar.IsCountingMemory())
 	{
-		FUniqueObjectGuid Guid = GuidAnnotation.GetAnnotation(Object);
+		// Exports can be saved on worker threads, which must not touch the lookup cache of the annotation
+		FUniqueObjectGuid Guid = IsInGameThread() ? GuidAnnotation.GetAnnotation(Object) : GuidAnnotation.GetAnnotationUncached(Object);
 		bool HasGuid = Guid.IsValid();
 		Ar << HasGuid;
 		if (HasGuid)
@@ -8,6 +8,8 @@
 #include "UObject/UTextProperty.h"
 #include "Interface.h"
 #include "TargetPlatform.h"
+#include "IConsoleManager.h"
+#include "TaskGraphInterfaces.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSavePackage, Log, All);
 
@@ -2336,6 +2338,187 @@ EObjectMark UPackage::GetObjectMarksForTargetPlatform( const class ITargetPlatfo
 	return ObjectMarks;
 }
 
+// Allow serializing exports on worker threads while saving packages to be overridden to single threaded via console command.
+static const auto CVarAllowParallelExportSerialization =
+	IConsoleManager::Get().RegisterConsoleVariable( TEXT("AllowParallelExportSerialization"), 1, TEXT("Used to control serializing the exports which allow it on worker threads while saving a package.") )->AsVariableInt();
+
+/**
+ * Archive an export is serialized into, on any thread, when it allows it. It writes the bytes ULinkerSave would write for the
+ * export to a buffer starting at 0, mapping names and objects with the tables of the linker, which do not change while
+ * exports are serialized. Anything needing the linker itself, like bulk data and script code, or the absolute position in
+ * the file, makes the buffer unusable: the export is then serialized by the linker like any other one.
+ */
+class FArchiveSaveExportBuffer : public FArchiveUObject
+{
+public:
+	FArchiveSaveExportBuffer( ULinkerSave* InLinker, TArray<uint8>& InBytes )
+	:	FArchiveUObject( *InLinker )
+	,	Linker( InLinker )
+	,	Bytes( InBytes )
+	,	Offset( 0 )
+	,	bNeedsLinker( false )
+	{
+		// copying an archive does not keep this one
+		ArIsFilterEditorOnly = InLinker->IsFilterEditorOnly();
+
+		// only report what this export contains
+		ArContainsCode = false;
+		ArContainsMap = false;
+		ArRequiresLocalizationGather = false;
+	}
+
+	/** @return true if the export tried to use the linker, so its buffer cannot be used */
+	bool NeedsLinker() const
+	{
+		return bNeedsLinker;
+	}
+
+	// FArchive interface.
+	virtual void Serialize( void* Data, int64 Num ) override
+	{
+		if( Num )
+		{
+			const int64 NumBytesToAdd = Offset + Num - Bytes.Num();
+			if( NumBytesToAdd > 0 )
+			{
+				Bytes.AddUninitialized( (int32)NumBytesToAdd );
+			}
+			FMemory::Memcpy( Bytes.GetData() + Offset, Data, Num );
+			Offset += Num;
+		}
+	}
+	virtual void Seek( int64 InPos ) override
+	{
+		check( InPos <= Bytes.Num() );
+		Offset = InPos;
+	}
+	virtual int64 Tell() override
+	{
+		return Offset;
+	}
+	virtual int64 TotalSize() override
+	{
+		return Bytes.Num();
+	}
+	virtual FArchive& operator<<( FName& InName ) override
+	{
+		int32 Save = Linker->MapName(InName);
+		int32 Number = InName.GetNumber();
+		FArchive& Ar = *this;
+		return Ar << Save << Number;
+	}
+	virtual FArchive& operator<<( UObject*& Obj ) override
+	{
+		FPackageIndex Save;
+		if (Obj)
+		{
+			Save = Linker->MapObject(Obj);
+		}
+		return *this << Save;
+	}
+	virtual FArchive& operator<<( FLazyObjectPtr& LazyObjectPtr ) override
+	{
+		FUniqueObjectGuid ID;
+		ID = LazyObjectPtr.GetUniqueID();
+		return *this << ID;
+	}
+	virtual FArchive& operator<<( FAssetPtr& AssetPtr ) override
+	{
+		// string asset references are fixed up by the editor when they are saved
+		bNeedsLinker = true;
+		return *this;
+	}
+	virtual ULinker* GetLinker() override
+	{
+		bNeedsLinker = true;
+		return NULL;
+	}
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FArchiveSaveExportBuffer");
+	}
+
+private:
+	ULinkerSave* Linker;
+	TArray<uint8>& Bytes;
+	int64 Offset;
+	bool bNeedsLinker;
+};
+
+/** An export serialized into its own buffer */
+struct FSavedExportBuffer
+{
+	/** Index of the export in the export map */
+	int32 ExportIndex;
+	/** Bytes of the export, if it did not need the linker */
+	TArray<uint8> Bytes;
+	bool bNeedsLinker;
+	bool bContainsCode;
+	bool bContainsMap;
+	bool bRequiresLocalizationGather;
+
+	explicit FSavedExportBuffer( int32 InExportIndex )
+	:	ExportIndex( InExportIndex )
+	,	bNeedsLinker( false )
+	,	bContainsCode( false )
+	,	bContainsMap( false )
+	,	bRequiresLocalizationGather( false )
+	{}
+
+	/** Serializes the export into the buffer */
+	void Serialize( ULinkerSave* Linker )
+	{
+		FArchiveSaveExportBuffer Ar( Linker, Bytes );
+		Linker->ExportMap[ExportIndex].Object->Serialize( Ar );
+
+		bNeedsLinker = Ar.NeedsLinker();
+		bContainsCode = Ar.ContainsCode();
+		bContainsMap = Ar.ContainsMap();
+		bRequiresLocalizationGather = Ar.RequiresLocalizationGather();
+		if( bNeedsLinker )
+		{
+			Bytes.Empty();
+		}
+	}
+};
+
+/** Serializes every NumTasks-th export buffer, starting with the FirstBuffer-th one, on a worker thread */
+class FSerializeExportBuffersTask
+{
+	ULinkerSave* Linker;
+	TArray<FSavedExportBuffer>& Buffers;
+	int32 FirstBuffer;
+	int32 NumTasks;
+
+public:
+	FSerializeExportBuffersTask( ULinkerSave* InLinker, TArray<FSavedExportBuffer>& InBuffers, int32 InFirstBuffer, int32 InNumTasks )
+	:	Linker( InLinker )
+	,	Buffers( InBuffers )
+	,	FirstBuffer( InFirstBuffer )
+	,	NumTasks( InNumTasks )
+	{}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSerializeExportBuffersTask, STATGROUP_TaskGraphTasks);
+	}
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+	void DoTask( ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent )
+	{
+		for( int32 BufferIndex = FirstBuffer; BufferIndex < Buffers.Num(); BufferIndex += NumTasks )
+		{
+			Buffers[BufferIndex].Serialize( Linker );
+		}
+	}
+};
+
 /**
  * Save one specific object (along with any objects it references contained within the same Outer) into an Unreal package.
  * 
@@ -3336,15 +3519,11 @@ bool UPackage::SavePackage( UPackage* InOuter, UObject* Base, EObjectFlags TopLe
 				UE_LOG_COOK_TIME(TEXT("SaveThumbNails Save AssetRegistryData SaveWorldLevelInfo"));
 				
 				{
-					FScopedSlowTask ExportScope(Linker->ExportMap.Num());
+					const double ExportIndicesStartTime = FPlatformTime::Seconds();
 
-					// Save exports.
-					int32 LastExportSaveStep = 0;
+					// Set the indices of every export first, so that exports can be serialized out of order.
 					for( int32 i=0; i<Linker->ExportMap.Num(); i++ )
 					{
-						if ( EndSavingIfCancelled( Linker, TempFilename ) ) { return false; }
-						ExportScope.EnterProgressFrame();
-
 						FObjectExport& Export = Linker->ExportMap[i];
 						if( Export.Object )
 						{
@@ -3398,11 +3577,88 @@ bool UPackage::SavePackage( UPackage* InOuter, UObject* Base, EObjectFlags TopLe
 								// this export's Outer is the LinkerRoot for this package
 								Export.OuterIndex = FPackageIndex();
 							}
+						}
+					}
+
+					const double ExportBuffersStartTime = FPlatformTime::Seconds();
+
+					// Serialize the top level exports which allow it into their own buffers on worker threads. Subobjects are
+					// left to the linker, finding their archetype searches the object hash.
+					TArray<FSavedExportBuffer> ExportBuffers;
+					const bool bParallelExportSerialization = FApp::ShouldUseThreadingForPerformance() && FPlatformProcess::SupportsMultithreading() &&
+						CVarAllowParallelExportSerialization->GetValueOnGameThread() != 0;
+					if( bParallelExportSerialization )
+					{
+						for( int32 i=0; i<Linker->ExportMap.Num(); i++ )
+						{
+							const FObjectExport& Export = Linker->ExportMap[i];
+							if( Export.Object && Export.OuterIndex.IsNull() && !Export.Object->HasAnyFlags(RF_ClassDefaultObject) && Export.Object->IsSerializationThreadSafe() )
+							{
+								new(ExportBuffers) FSavedExportBuffer(i);
+							}
+						}
+
+						// a single export is not worth copying
+						if( ExportBuffers.Num() > 1 )
+						{
+							const int32 NumTasks = FMath::Min<int32>(FTaskGraphInterface::Get().GetNumWorkerThreads(), ExportBuffers.Num());
+							FGraphEventArray Tasks;
+							Tasks.Empty(NumTasks);
+							for( int32 TaskIndex=0; TaskIndex<NumTasks; TaskIndex++ )
+							{
+								Tasks.Add(TGraphTask<FSerializeExportBuffersTask>::CreateTask().ConstructAndDispatchWhenReady(Linker, ExportBuffers, TaskIndex, NumTasks));
+							}
+							FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks, ENamedThreads::GameThread_Local);
+						}
+						else
+						{
+							ExportBuffers.Empty();
+						}
+					}
+
+					const double ExportWriteStartTime = FPlatformTime::Seconds();
+
+					FScopedSlowTask ExportScope(Linker->ExportMap.Num());
+
+					// Save exports, in order. The buffers serialized on worker threads are written where the linker would have serialized them.
+					FArchive& LinkerArchive = *Linker;
+					int32 NextExportBuffer = 0;
+					int32 NumBufferedExports = 0;
+					for( int32 i=0; i<Linker->ExportMap.Num(); i++ )
+					{
+						if ( EndSavingIfCancelled( Linker, TempFilename ) ) { return false; }
+						ExportScope.EnterProgressFrame();
+
+						FObjectExport& Export = Linker->ExportMap[i];
+						if( Export.Object )
+						{
+							const FSavedExportBuffer* ExportBuffer = NULL;
+							if( NextExportBuffer < ExportBuffers.Num() && ExportBuffers[NextExportBuffer].ExportIndex == i )
+							{
+								ExportBuffer = &ExportBuffers[NextExportBuffer++];
+							}
 
 							// Save the object data.
 							Export.SerialOffset = Linker->Tell();
 							// UE_LOG(LogSavePackage, Log, TEXT("export %s for %s"), *Export.Object->GetFullName(), *Linker->CookingTarget()->PlatformName());
-							if ( Export.Object->HasAnyFlags(RF_ClassDefaultObject) )
+							if ( ExportBuffer && !ExportBuffer->bNeedsLinker )
+							{
+								LinkerArchive.Serialize( (void*)ExportBuffer->Bytes.GetData(), ExportBuffer->Bytes.Num() );
+								if ( ExportBuffer->bContainsCode )
+								{
+									LinkerArchive.ThisContainsCode();
+								}
+								if ( ExportBuffer->bContainsMap )
+								{
+									LinkerArchive.ThisContainsMap();
+								}
+								if ( ExportBuffer->bRequiresLocalizationGather )
+								{
+									LinkerArchive.ThisRequiresLocalizationGather();
+								}
+								NumBufferedExports++;
+							}
+							else if ( Export.Object->HasAnyFlags(RF_ClassDefaultObject) )
 							{
 								Export.Object->GetClass()->SerializeDefaultObject(Export.Object, *Linker);
 							}
@@ -3416,6 +3672,11 @@ bool UPackage::SavePackage( UPackage* InOuter, UObject* Base, EObjectFlags TopLe
 							Export.Object->Mark(OBJECTMARK_Saved);
 						}
 					}
+
+					const double ExportEndTime = FPlatformTime::Seconds();
+					UE_LOG(LogSavePackage, Verbose, TEXT("Serialized %i exports of %s, %i of them on worker threads: indices %.2fms, worker threads %.2fms, writing %.2fms"),
+						Linker->ExportMap.Num(), *InOuter->GetName(), NumBufferedExports,
+						(ExportBuffersStartTime - ExportIndicesStartTime) * 1000.0, (ExportWriteStartTime - ExportBuffersStartTime) * 1000.0, (ExportEndTime - ExportWriteStartTime) * 1000.0);
 				}
 
 				UE_LOG_COOK_TIME(TEXT("Serialize Exports"));
@@ -323,6 +323,340 @@ COREUOBJECT_API uint8 GRegisterCast( int32 CastCode, const Native& Func )
 	return 0;
 }
 
+/*-----------------------------------------------------------------------------
+	Decoded script.
+-----------------------------------------------------------------------------*/
+
+static int32 GUseDecodedScript = 1;
+static FAutoConsoleVariableRef CVarUseDecodedScript(
+	TEXT("bp.UseDecodedScript"),
+	GUseDecodedScript,
+	TEXT("When non zero, script functions run from a form of their bytecode decoded on their first call, and CallFunction only zeroes the parameters which need it.")
+	);
+
+/** How a decoded statement is executed. */
+namespace EDecodedStatementType
+{
+	enum Type
+	{
+		/** Calls the handler of the opcode, which reads its operands from the bytecode. */
+		Dispatch,
+		/** Dispatches on the opcode currently in the bytecode, for the debug sites the editor patches into breakpoints. */
+		DispatchCurrentOpcode,
+		/** EX_Jump to a resolved statement. */
+		Jump,
+		/** EX_JumpIfNot to a resolved statement, only the condition is evaluated from the bytecode. */
+		JumpIfNot,
+		/** EX_Let to a local or instance variable, only the value is evaluated from the bytecode. */
+		LetVariable,
+		/** EX_Return, ends the statements. */
+		Return,
+	};
+}
+
+/** Bumped whenever bytecode is generated or patched in place, decoded scripts from an older generation are decoded again. */
+static FThreadSafeCounter GDecodedScriptGeneration;
+
+/** Range of a function's frame which CallFunction zeroes. */
+struct FFrameZeroRange
+{
+	int32 Offset;
+	int32 Size;
+};
+
+/** A top level statement of a script. */
+struct FDecodedStatement
+{
+	/** Handler of the opcode of the statement. */
+	Native Handler;
+	/** Offset of the opcode in the script. */
+	int32 CodeOffset;
+	/** Offset of the statement following this one. */
+	int32 NextOffset;
+	/** Offset of the expression evaluated by JumpIfNot and LetVariable. */
+	int32 OperandOffset;
+	/** Statement jumped to by Jump and JumpIfNot. */
+	int32 JumpTarget;
+	/** Variable assigned by LetVariable. */
+	UProperty* Property;
+	/** EDecodedStatementType of the statement. */
+	uint8 Type;
+	/** Whether Property is a local variable or a member of the context object. */
+	bool bLocalProperty;
+};
+
+/**
+ * Script of a function split in statements, with their handlers, jump targets and assigned variables resolved,
+ * along with the parameters CallFunction needs to zero. Built on the first call of the function.
+ */
+struct FDecodedScript
+{
+	/** Function and bytecode which were decoded, the decoded form is only used while they and the compile generation are the same. */
+	const UFunction* Function;
+	const uint8* ScriptData;
+	int32 ScriptSize;
+	int32 Generation;
+
+	/** Statements of the script, in bytecode order. Empty if the script couldn't be decoded. */
+	TArray<FDecodedStatement> Statements;
+
+	/**
+	 * Parts of the frame CallFunction must zero: everything but the parameters which are fully written when they are evaluated, which are
+	 * the numbers, bools and object pointers passed by value. Padding, locals and all the other parameters are zeroed.
+	 */
+	TArray<FFrameZeroRange> ZeroRanges;
+
+	/** Whether CallFunction zeroes the whole frame instead, which is the case for functions with out parameters. */
+	bool bZeroWholeFrame;
+
+	/** @return true if this was decoded from the current script of the function. */
+	bool IsUpToDate(const UFunction* InFunction) const
+	{
+		return Function == InFunction && ScriptData == InFunction->Script.GetData() && ScriptSize == InFunction->Script.Num() && Generation == GDecodedScriptGeneration.GetValue();
+	}
+
+	/** Zeroes a new frame of the function. */
+	void ZeroFrame(uint8* Frame, int32 PropertiesSize) const
+	{
+		if (bZeroWholeFrame)
+		{
+			FMemory::Memzero(Frame, PropertiesSize);
+			return;
+		}
+		for (int32 RangeIndex = 0; RangeIndex < ZeroRanges.Num(); RangeIndex++)
+		{
+			FMemory::Memzero(Frame + ZeroRanges[RangeIndex].Offset, ZeroRanges[RangeIndex].Size);
+		}
+	}
+
+	/** @return The index of the statement starting at the offset, or INDEX_NONE. */
+	int32 FindStatement(int32 CodeOffset) const
+	{
+		int32 Min = 0;
+		int32 Max = Statements.Num() - 1;
+		while (Min <= Max)
+		{
+			const int32 Mid = (Min + Max) / 2;
+			const int32 MidOffset = Statements[Mid].CodeOffset;
+			if (MidOffset == CodeOffset)
+			{
+				return Mid;
+			}
+			else if (MidOffset < CodeOffset)
+			{
+				Min = Mid + 1;
+			}
+			else
+			{
+				Max = Mid - 1;
+			}
+		}
+		return INDEX_NONE;
+	}
+};
+
+/** Finds the size of the expressions of a script, reusing the serialization code without touching the bytecode. */
+struct FScriptExpressionWalker
+{
+	TArray<uint8>& Script;
+	FArchive Archive;
+
+	FScriptExpressionWalker(TArray<uint8>& InScript)
+		: Script(InScript)
+	{}
+
+	/** The bytecode is always in the current format. */
+	const void* GetLinker() const
+	{
+		return NULL;
+	}
+
+	EExprToken SerializeExpr(int32& iCode, FArchive& Ar)
+	{
+#define XFER(T) { iCode += sizeof(T); }
+#define XFERNAME() { iCode += sizeof(FScriptName); }
+#define XFERPTR(T) { iCode += sizeof(ScriptPointerType); }
+#define SERIALIZEEXPR_INC
+#include "ScriptSerialization.h"
+		return Expr;
+#undef SERIALIZEEXPR_INC
+#undef XFER
+#undef XFERPTR
+#undef XFERNAME
+#undef XFER_FUNC_POINTER
+#undef XFER_FUNC_NAME
+#undef XFER_PROP_POINTER
+#undef XFER_OBJECT_POINTER
+#undef FIXUP_EXPR_OBJECT_POINTER
+	}
+};
+
+static FDecodedScript* DecodeScript(UFunction* Function)
+{
+	FDecodedScript* DecodedScript = new FDecodedScript();
+	DecodedScript->Function = Function;
+	DecodedScript->ScriptData = Function->Script.GetData();
+	DecodedScript->ScriptSize = Function->Script.Num();
+	DecodedScript->Generation = GDecodedScriptGeneration.GetValue();
+	DecodedScript->bZeroWholeFrame = Function->HasAnyFunctionFlags(FUNC_HasOutParms);
+
+	if (!DecodedScript->bZeroWholeFrame)
+	{
+		TArray<FFrameZeroRange>& ZeroRanges = DecodedScript->ZeroRanges;
+		int32 ZeroedUpTo = 0;
+		for (UProperty* Property = dynamic_cast<UProperty*>(Function->Children); Property && (Property->PropertyFlags & CPF_Parm); Property = dynamic_cast<UProperty*>(Property->Next))
+		{
+			const bool bFullyWrittenByValue = Property->ArrayDim == 1 && !Property->HasAnyPropertyFlags(CPF_OutParm | CPF_ReturnParm) && Property->HasAnyPropertyFlags(CPF_IsPlainOldData)
+				&& (Property->IsA(UNumericProperty::StaticClass()) || Property->IsA(UBoolProperty::StaticClass()) || Property->IsA(UObjectProperty::StaticClass()));
+			if (bFullyWrittenByValue)
+			{
+				const int32 Offset = Property->GetOffset_ForUFunction();
+				if (Offset > ZeroedUpTo)
+				{
+					FFrameZeroRange Range = { ZeroedUpTo, Offset - ZeroedUpTo };
+					ZeroRanges.Add(Range);
+				}
+				ZeroedUpTo = FMath::Max(ZeroedUpTo, Offset + Property->ElementSize);
+			}
+		}
+		// the rest of the parameters and the locals
+		if (Function->PropertiesSize > ZeroedUpTo)
+		{
+			FFrameZeroRange Range = { ZeroedUpTo, Function->PropertiesSize - ZeroedUpTo };
+			ZeroRanges.Add(Range);
+		}
+	}
+
+	TArray<uint8>& Script = Function->Script;
+	FScriptExpressionWalker Walker(Script);
+	TArray<FDecodedStatement>& Statements = DecodedScript->Statements;
+	int32 iCode = 0;
+	while (iCode < Script.Num())
+	{
+		FDecodedStatement Statement;
+		FMemory::Memzero(Statement);
+		Statement.CodeOffset = iCode;
+		Statement.JumpTarget = INDEX_NONE;
+		Walker.SerializeExpr(iCode, Walker.Archive);
+		Statement.NextOffset = iCode;
+
+		const uint8 Opcode = Script[Statement.CodeOffset];
+		Statement.Handler = GNatives[Opcode];
+		if (Statement.NextOffset > Script.Num() || (Statement.Handler == &UObject::execUndefined && Opcode != EX_Return))
+		{
+			// not bytecode we know, leave it to the interpreter
+			UE_LOG(LogScriptCore, Warning, TEXT("Couldn't decode the script of %s at %04X"), *Function->GetFullName(), Statement.CodeOffset);
+			Statements.Empty();
+			break;
+		}
+
+		Statement.Type = EDecodedStatementType::Dispatch;
+		const uint8* Operands = &Script[Statement.CodeOffset + 1];
+		switch (Opcode)
+		{
+			case EX_Return:
+			{
+				Statement.Type = EDecodedStatementType::Return;
+				break;
+			}
+			case EX_Tracepoint:
+			case EX_WireTracepoint:
+			case EX_Breakpoint:
+			{
+				Statement.Type = EDecodedStatementType::DispatchCurrentOpcode;
+				break;
+			}
+			case EX_Jump:
+			case EX_JumpIfNot:
+			{
+				// resolved to a statement index once all the statements are known
+				CodeSkipSizeType Offset;
+				FMemory::Memcpy(&Offset, Operands, sizeof(CodeSkipSizeType));
+				Statement.JumpTarget = Offset;
+				Statement.OperandOffset = Statement.CodeOffset + 1 + sizeof(CodeSkipSizeType);
+				break;
+			}
+			case EX_Let:
+			{
+				if (Operands[0] == EX_LocalVariable || Operands[0] == EX_InstanceVariable)
+				{
+					ScriptPointerType PropertyPointer;
+					FMemory::Memcpy(&PropertyPointer, Operands + 1, sizeof(ScriptPointerType));
+					Statement.Property = (UProperty*)PropertyPointer;
+					Statement.bLocalProperty = (Operands[0] == EX_LocalVariable);
+					Statement.OperandOffset = Statement.CodeOffset + 2 + sizeof(ScriptPointerType);
+					if (Statement.Property)
+					{
+						Statement.Type = EDecodedStatementType::LetVariable;
+					}
+				}
+				break;
+			}
+		}
+		Statements.Add(Statement);
+	}
+
+	for (int32 Index = 0; Index < Statements.Num(); Index++)
+	{
+		FDecodedStatement& Statement = Statements[Index];
+		if (Statement.JumpTarget != INDEX_NONE)
+		{
+			Statement.JumpTarget = DecodedScript->FindStatement(Statement.JumpTarget);
+			if (Statement.JumpTarget != INDEX_NONE)
+			{
+				Statement.Type = (Script[Statement.CodeOffset] == EX_Jump) ? EDecodedStatementType::Jump : EDecodedStatementType::JumpIfNot;
+			}
+		}
+	}
+
+	return DecodedScript;
+}
+
+/** @return The decoded form of the script of a function, decoding it on the first call, or NULL if the function must be interpreted. */
+static FDecodedScript* GetDecodedScript(UFunction* Function)
+{
+	if (!GUseDecodedScript)
+	{
+		return NULL;
+	}
+
+	FDecodedScript* DecodedScript = Function->DecodedScript;
+	if (DecodedScript && !DecodedScript->IsUpToDate(Function) && IsInGameThread())
+	{
+		// recompiled or patched since it was decoded, scripts are only recompiled while none of them runs
+		Function->ResetDecodedScript();
+		DecodedScript = NULL;
+	}
+	if (!DecodedScript)
+	{
+		DecodedScript = DecodeScript(Function);
+		FDecodedScript* OtherDecodedScript = (FDecodedScript*)FPlatformAtomics::InterlockedCompareExchangePointer((void**)&Function->DecodedScript, DecodedScript, NULL);
+		if (OtherDecodedScript)
+		{
+			// another thread decoded it first
+			delete DecodedScript;
+			DecodedScript = OtherDecodedScript;
+		}
+	}
+
+	if (!DecodedScript->IsUpToDate(Function))
+	{
+		return NULL;
+	}
+	return DecodedScript;
+}
+
+void UFunction::ResetDecodedScript()
+{
+	delete DecodedScript;
+	DecodedScript = NULL;
+}
+
+void UFunction::InvalidateDecodedScripts()
+{
+	GDecodedScriptGeneration.Increment();
+}
+
 void UObject::SkipFunction(FFrame& Stack, RESULT_DECL, UFunction* Function)
 {
 	// allocate temporary memory on the stack for evaluating parameters
@@ -407,10 +741,19 @@ void UObject::CallFunction( FFrame& Stack, RESULT_DECL, UFunction* Function )
 		Frame = GetClass()->GetPersistentUberGraphFrame(this, Function);
 #endif
 		const bool bUsePersistentFrame = (NULL != Frame);
+		const FDecodedScript* DecodedScript = bUsePersistentFrame ? NULL : GetDecodedScript(Function);
 		if (!bUsePersistentFrame)
 		{
 			Frame = (uint8*)FMemory_Alloca(Function->PropertiesSize);
-			FMemory::Memzero(Frame, Function->PropertiesSize);
+			if (DecodedScript)
+			{
+				// skips the parameters which are fully written when they are evaluated below
+				DecodedScript->ZeroFrame(Frame, Function->PropertiesSize);
+			}
+			else
+			{
+				FMemory::Memzero(Frame, Function->PropertiesSize);
+			}
 		}
 		FFrame NewStack( this, Function, Frame, &Stack, Function->Children );
 		FOutParmRec** LastOut = &NewStack.OutParms;
@@ -488,6 +831,15 @@ void UObject::CallFunction( FFrame& Stack, RESULT_DECL, UFunction* Function )
 			}
 		}
 		Stack.Code++;
+
+		if (DecodedScript)
+		{
+			// zero the parameters which weren't passed
+			for (; Property && (Property->PropertyFlags & CPF_Parm); Property = (UProperty*)Property->Next)
+			{
+				FMemory::Memzero(Property->ContainerPtrToValuePtr<uint8>(NewStack.Locals), Property->ArrayDim * Property->ElementSize);
+			}
+		}
 #if UE_BUILD_DEBUG
 		// set the next pointer of the last item to NULL so we'll properly assert if something goes wrong
 		if (*LastOut)
@@ -542,6 +894,112 @@ void ClearReturnValue(UProperty* ReturnProp, RESULT_DECL)
 	}
 }
 
+#if DO_GUARD
+/**
+ * Aborts the execution of a script stuck in a loop.
+ *
+ * @return true if the loop iteration limit was hit
+ */
+static bool HandleRunawayLoop(UObject* Object, FFrame& Stack, RESULT_DECL)
+{
+	if (Runaway > GMaximumScriptLoopIterations)
+	{
+		// We've hit the recursion limit, so print out the stack, warn, and then continue with a zeroed return value.
+		UE_LOG(LogScriptCore, Log, TEXT("%s"), *Stack.GetStackTrace());
+
+		// If we have a return property, return a zeroed value in it, to try and save execution as much as possible
+		UProperty* ReturnProp = ((UFunction*)Stack.Node)->GetReturnProperty();
+		ClearReturnValue(ReturnProp, Result);
+
+		// Notify anyone who cares that we've had a fatal error, so we can shut down PIE, etc
+		const FString Desc = FString::Printf(TEXT("Runaway loop detected (over %i iterations)"), GMaximumScriptLoopIterations );
+		FBlueprintExceptionInfo RunawayLoopExceptionInfo(EBlueprintExceptionType::InfiniteLoop, Desc);
+
+		// Need to reset Runaway counter BEFORE throwing script exception, because the exception causes a modal dialog,
+		// and other scripts running will then erroneously think they are also "runaway".
+		Runaway = 0;
+
+		FBlueprintCoreDelegates::ThrowScriptException(Object, Stack, RunawayLoopExceptionInfo);
+		return true;
+	}
+	return false;
+}
+#endif
+
+/**
+ * Executes the statements of a decoded script from the current code offset up to the EX_Return, where the code is left.
+ * Stops early if the code ends up in the middle of a statement, the interpreter carries on from there.
+ *
+ * @return false if the execution was aborted
+ */
+static bool ProcessDecodedScript(UObject* Object, FFrame& Stack, const FDecodedScript& DecodedScript, uint8* Buffer, RESULT_DECL)
+{
+	uint8* const Script = Stack.Node->Script.GetData();
+	const FDecodedStatement* const Statements = DecodedScript.Statements.GetData();
+
+	int32 Index = DecodedScript.FindStatement(Stack.Code - Script);
+	while (Index != INDEX_NONE)
+	{
+		const FDecodedStatement& Statement = Statements[Index];
+		Stack.Code = Script + Statement.CodeOffset;
+		if (Statement.Type == EDecodedStatementType::Return)
+		{
+			return true;
+		}
+
+#if DO_GUARD
+		if (HandleRunawayLoop(Object, Stack, Result))
+		{
+			return false;
+		}
+#endif
+
+		switch (Statement.Type)
+		{
+			case EDecodedStatementType::Jump:
+			{
+				CHECK_RUNAWAY;
+				Index = Statement.JumpTarget;
+				continue;
+			}
+			case EDecodedStatementType::JumpIfNot:
+			{
+				CHECK_RUNAWAY;
+				bool Value = 0;
+				Stack.Code = Script + Statement.OperandOffset;
+				Stack.Step(Stack.Object, &Value);
+				Index = Value ? Index + 1 : Statement.JumpTarget;
+				continue;
+			}
+			case EDecodedStatementType::LetVariable:
+			{
+				Stack.MostRecentProperty = Statement.Property;
+				Stack.MostRecentPropertyAddress = Statement.Property->ContainerPtrToValuePtr<uint8>(Statement.bLocalProperty ? (void*)Stack.Locals : (void*)Stack.Object);
+				Stack.Code = Script + Statement.OperandOffset;
+				Stack.Step(Stack.Object, Stack.MostRecentPropertyAddress);
+				break;
+			}
+			case EDecodedStatementType::DispatchCurrentOpcode:
+			{
+				Stack.Step(Stack.Object, Buffer);
+				break;
+			}
+			default:
+			{
+				Stack.Code++;
+				(Stack.Object->*Statement.Handler)(Stack, Buffer);
+				break;
+			}
+		}
+
+		// statements such as EX_ComputedJump or EX_PopExecutionFlow branch to offsets only known at runtime
+		const int32 CodeOffset = Stack.Code - Script;
+		Index = (CodeOffset == Statement.NextOffset) ? Index + 1 : DecodedScript.FindStatement(CodeOffset);
+	}
+
+	return true;
+}
+
 void UObject::ProcessInternal( FFrame& Stack, RESULT_DECL )
 {
 	// remove later when stable
@@ -598,28 +1056,18 @@ void UObject::ProcessInternal( FFrame& Stack, RESULT_DECL )
 		FScopeCycleCounterUObject ContextScope(Stack.Object);
 		FScopeCycleCounterUObject FunctionScope((UFunction*)Stack.Node);
 
-		// Execute the bytecode
+		// Execute the bytecode, from its decoded form when there is one
+		const FDecodedScript* DecodedScript = GetDecodedScript((UFunction*)Stack.Node);
+		if (DecodedScript && !ProcessDecodedScript(this, Stack, *DecodedScript, Buffer, Result))
+		{
+			return;
+		}
+
 		while (*Stack.Code != EX_Return)
 		{
 #if DO_GUARD
-			if( Runaway > GMaximumScriptLoopIterations )
+			if (HandleRunawayLoop(this, Stack, Result))
 			{
-				// We've hit the recursion limit, so print out the stack, warn, and then continue with a zeroed return value.
-				UE_LOG(LogScriptCore, Log, TEXT("%s"), *Stack.GetStackTrace());
-
-				// If we have a return property, return a zeroed value in it, to try and save execution as much as possible
-				UProperty* ReturnProp = ((UFunction*)Stack.Node)->GetReturnProperty();
-				ClearReturnValue(ReturnProp, Result);
-
-				// Notify anyone who cares that we've had a fatal error, so we can shut down PIE, etc
-				const FString Desc = FString::Printf(TEXT("Runaway loop detected (over %i iterations)"), GMaximumScriptLoopIterations );
-				FBlueprintExceptionInfo RunawayLoopExceptionInfo(EBlueprintExceptionType::InfiniteLoop, Desc);
-
-				// Need to reset Runaway counter BEFORE throwing script exception, because the exception causes a modal dialog,
-				// and other scripts running will then erroneously think they are also "runaway".
-				Runaway = 0;
-
-				FBlueprintCoreDelegates::ThrowScriptException(this, Stack, RunawayLoopExceptionInfo);
 				return;
 			}
 #endif
@@ -1186,6 +1186,9 @@ public:
 	int32 EventGraphCallOffset;
 #endif
 
+	/** Decoded form of the script, built by the VM on the first call of the function. */
+	struct FDecodedScript* DecodedScript;
+
 private:
 	Native Func;
 
@@ -1226,6 +1229,7 @@ public:
 
 	// UObject interface.
 	virtual void Serialize( FArchive& Ar ) override;
+	virtual void FinishDestroy() override;
 
 	// UField interface.
 	virtual void Bind() override;
@@ -1234,6 +1238,12 @@ public:
 	virtual UStruct* GetInheritanceSuper() const override { return NULL;}
 	virtual void Link(FArchive& Ar, bool bRelinkExistingProperties) override;
 
+	/** Frees the decoded form of the script, which is built again on the next call. Must be called when the script changes. */
+	void ResetDecodedScript();
+
+	/** Makes the VM decode every script again on its next call. Must be called after bytecode is generated or patched in place. */
+	static void InvalidateDecodedScripts();
+
 	// UFunction interface.
 	UFunction* GetSuperFunction() const
 	{
@@ -243,6 +243,18 @@ public:
 	/** UObject serializer. */
 	virtual void Serialize( FArchive& Ar );
 
+	/**
+	 * Called during saving to determine whether the object can be serialized on a worker thread, into its own buffer, while
+	 * the other exports of its package are serialized. Serialize must then only read the object, its archetype and data
+	 * nothing modifies while the package saves, and only write to the archive it is given.
+	 *
+	 * @return	true if Serialize can run on any thread while saving
+	 */
+	virtual bool IsSerializationThreadSafe() const
+	{
+		return false;
+	}
+
 	virtual void ShutdownAfterError() {}
 
 	/** 
@@ -189,6 +189,19 @@ public:
 		return AnnotationCacheValue;
 	}
 
+	/**
+	 * Return the annotation associated with a uobject without going through the lookup cache. Unlike GetAnnotation, this
+	 * can be called from several threads at once, as long as no annotation is added or removed meanwhile.
+	 *
+	 * @param Object		Object to return the annotation for
+	 */
+	FORCEINLINE TAnnotation GetAnnotationUncached(const UObjectBase *Object) const
+	{
+		check(Object);
+		const TAnnotation* Entry = AnnotationMap.Find(Object);
+		return Entry ? *Entry : TAnnotation();
+	}
+
 	/**
 	 * Return the annotation map. Caution, this is for low level use 
 	 * @return A mapping from UObjectBase to annotation for non-default annotations
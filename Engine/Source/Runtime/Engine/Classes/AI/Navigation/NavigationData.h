@@ -851,9 +851,15 @@ struct FAsyncPathFindingQuery : public FPathFindingQuery
 	const FNavPathQueryDelegate OnDoneDelegate;
 	const TEnumAsByte<EPathFindingMode::Type> Mode;
 	FPathFindingResult Result;
+	/** queries with a higher priority are started first when there are more than the system processes in a tick */
+	float Priority;
+	/** time the query was made, in FPlatformTime::Seconds */
+	double QueryTime;
 
 	FAsyncPathFindingQuery()
 		: QueryID(INVALID_NAVQUERYID)
+		, Priority(0.0f)
+		, QueryTime(0.0)
 	{ }
 
 	FAsyncPathFindingQuery(const UObject* InOwner, const ANavigationData* InNavData, const FVector& Start, const FVector& End, const FNavPathQueryDelegate& Delegate, TSharedPtr<const FNavigationQueryFilter> SourceQueryFilter);
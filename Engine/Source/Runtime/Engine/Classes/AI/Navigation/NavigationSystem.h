@@ -197,6 +197,16 @@ public:
 	UPROPERTY(config, EditAnywhere, Category=NavigationSystem)
 	float DirtyAreasUpdateFreq;
 
+	/** Max number of async path finding queries started each tick, the ones with the highest priority go first
+	 *	and the others wait for the next tick. 0 means no limit. */
+	UPROPERTY(config, EditAnywhere, Category=NavigationSystem, meta=(ClampMin="0", UIMin="0"))
+	int32 MaxAsyncPathfindingQueriesPerTick;
+
+	/** Async path finding queries started in the same tick are split between worker threads,
+	 *	with at least that many queries per task */
+	UPROPERTY(config, EditAnywhere, Category=NavigationSystem, meta=(ClampMin="1", UIMin="1"))
+	int32 MinAsyncPathfindingQueriesPerTask;
+
 	UPROPERTY()
 	TArray<ANavigationData*> NavDataSet;
 
@@ -377,12 +387,16 @@ public:
 	 *	@param PathToFill if points to an actual navigation path instance than this instance will be filled with resulting path. Otherwise a new instance will be created and 
 	 *		used in call to ResultDelegate
 	 *  @param Mode switch between normal and hierarchical path finding algorithms
+	 *	@param Priority queries with a higher priority are started first when MaxAsyncPathfindingQueriesPerTick is exceeded
 	 *	@return request ID
 	 */
-	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular);
+	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular, float Priority = 0.0f);
 
 	/** Removes query indicated by given ID from queue of path finding requests to process. */
 	void AbortAsyncFindPathRequest(uint32 AsynPathQueryID);
+
+	/** Called on game thread for every finished async query, accumulates the async path finding stats */
+	void OnAsyncQueryDone(const FAsyncPathFindingQuery& Query);
 	
 	/** 
 	 *	Synchronously check if path between two points exists
@@ -736,6 +750,11 @@ protected:
 
 	TArray<FAsyncPathFindingQuery> AsyncPathFindingQueries;
 
+	/** number of async path finding queries done, and their summed latency, since the stats were last updated */
+	int32 NumAsyncQueriesDone;
+	double AsyncQueriesLatency;
+	double AsyncQueriesStatsTime;
+
 	FCriticalSection NavDataRegistration;
 
 	TMap<FNavAgentProperties, ANavigationData*> AgentToNavDataMap;
@@ -856,12 +875,15 @@ private:
 	/** Adds given request to requests queue. Note it's to be called only on game thread only */
 	void AddAsyncQuery(const FAsyncPathFindingQuery& Query);
 		 
-	/** spawns a non-game-thread task to process requests given in PathFindingQueries.
-	 *	In the process PathFindingQueries gets copied. */
+	/** spawns non-game-thread tasks to process requests given in PathFindingQueries, split between worker threads.
+	 *	Started requests are removed from PathFindingQueries, the ones over MaxAsyncPathfindingQueriesPerTick are left for later. */
 	void TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries);
 
-	/** Processes pathfinding requests given in PathFindingQueries.*/
-	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries);
+	/** Processes pathfinding requests given in PathFindingQueries, which are owned by the game thread and only filled in here.*/
+	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery>* PathFindingQueries);
+
+	/** Publishes async queries per second and average latency */
+	void UpdateAsyncQueriesStats();
 
 	/** */
 	void DestroyNavOctree();
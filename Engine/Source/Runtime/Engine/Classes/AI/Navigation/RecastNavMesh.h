@@ -565,6 +565,15 @@ class ENGINE_API ARecastNavMesh : public ANavigationData
 	UPROPERTY(config)
 	uint32 bUseVirtualFilters : 1;
 
+	/** If set, path corridors found between the same start and end polys with the same filter are reused
+	 *	by following path finding queries, for PathCorridorCacheLifetime seconds. Corridors crossing nav links are never reused. */
+	UPROPERTY(EditAnywhere, Category=Pathfinding, config, AdvancedDisplay)
+	uint32 bCachePathCorridors : 1;
+
+	/** How long, in seconds, a cached path corridor can be reused */
+	UPROPERTY(EditAnywhere, Category=Pathfinding, config, AdvancedDisplay, meta=(ClampMin = "0.0", EditCondition = "bCachePathCorridors"))
+	float PathCorridorCacheLifetime;
+
 private:
 	/** Cache rasterized voxels instead of just collision vertices/indices in navigation octree */
 	UPROPERTY(config)
@@ -902,6 +911,7 @@ private:
 	friend class FRecastNavMeshGenerator;
 	friend class FPImplRecastNavMesh;
 	friend class UCrowdManager;
+	friend class FRecastNavMeshAsyncQueriesTest;
 	// destroys FPImplRecastNavMesh instance if it has been created 
 	void DestroyRecastPImpl();
 	// @todo docuement
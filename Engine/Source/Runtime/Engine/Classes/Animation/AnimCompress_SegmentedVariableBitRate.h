@@ -0,0 +1,47 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Splits the sequence into segments and quantizes every animated channel of every segment to the fewest bits
+ * that keep it within a local tolerance. The tolerances are scaled up as far as the end effector error allows.
+ *
+ */
+
+#pragma once
+#include "Animation/AnimCompress.h"
+#include "AnimCompress_SegmentedVariableBitRate.generated.h"
+
+UCLASS(MinimalAPI)
+class UAnimCompress_SegmentedVariableBitRate : public UAnimCompress
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Maximum amount of error the compression can introduce in an end effector */
+	UPROPERTY(EditAnywhere, Category=SegmentedVariableBitRate)
+	float MaxEndEffectorError;
+
+	/** Number of frames in a segment, each segment picks its own bit rates */
+	UPROPERTY(EditAnywhere, Category=SegmentedVariableBitRate, meta=(ClampMin = "2", ClampMax = "256"))
+	int32 FramesPerSegment;
+
+	/** Starting local-space translation tolerance, per component */
+	UPROPERTY(EditAnywhere, Category=SegmentedVariableBitRate)
+	float MaxTranslationError;
+
+	/** Starting local-space rotation tolerance, in radians */
+	UPROPERTY(EditAnywhere, Category=SegmentedVariableBitRate)
+	float MaxRotationError;
+
+	/** Starting local-space scale tolerance, per component */
+	UPROPERTY(EditAnywhere, Category=SegmentedVariableBitRate)
+	float MaxScaleError;
+
+	/** Number of times the local tolerances are rescaled while searching for the smallest result within MaxEndEffectorError */
+	UPROPERTY(EditAnywhere, Category=SegmentedVariableBitRate, meta=(ClampMin = "1", ClampMax = "32"))
+	int32 ToleranceSearchIterations;
+
+
+protected:
+	// Begin UAnimCompress Interface
+	virtual void DoReduction(class UAnimSequence* AnimSeq, const TArray<class FBoneData>& BoneData) override;
+	// Begin UAnimCompress Interface
+};
@@ -260,6 +260,9 @@ public:
 	/** Used by the subtitle manager to prioritize subtitles wave instances spawned by this component. */
 	float SubtitlePriority;
 
+	/** Incremented every time the component starts playing, tells which playback the notifications sent by the audio thread are about. */
+	uint32 PlayID;
+
 	// Begin UObject interface.
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
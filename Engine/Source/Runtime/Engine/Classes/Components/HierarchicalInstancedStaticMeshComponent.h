@@ -121,6 +121,16 @@ public:
 		int32 MaxInstancesPerLeaf
 		);
 	void AcceptPrebuiltTree(TArray<FClusterNode>& InClusterTree);
+
+	/**
+	 * Shares the render data and cluster tree of a component built from a prebuilt instance buffer, so that another component can
+	 * render the same instances with AcceptPrebuiltRenderData.
+	 * @return false if the component was not prebuilt or has no render data yet
+	 */
+	bool GetPrebuiltRenderData(TSharedPtr<FPerInstanceRenderData, ESPMode::ThreadSafe>& OutRenderData, TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe>& OutClusterTree, int32& OutNumInstances) const;
+
+	/** Renders the instances of the render data and cluster tree of another prebuilt component, instead of a prebuilt instance buffer */
+	void AcceptPrebuiltRenderData(const TSharedPtr<FPerInstanceRenderData, ESPMode::ThreadSafe>& InRenderData, const TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe>& InClusterTree, int32 InNumInstances);
 	void BuildFlatTree(const TArray<int32>& LeafInstanceCounts);
 	bool IsAsyncBuilding() const { return bIsAsyncBuilding; }
 	bool IsTreeFullyBuilt() const { return NumBuiltInstances == PerInstanceSMData.Num() && RemovedInstances.Num() == 0; }
@@ -7,6 +7,7 @@
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
 #include "SkeletalMeshTypes.h"
 #include "Animation/AnimationAsset.h"
+#include "AnimationSharing.h"
 #include "SkeletalMeshComponent.generated.h"
 
 class UAnimInstance;
@@ -36,7 +37,22 @@ struct FAnimationEvaluationContext
 	// Are we storing data in cache bones this tick
 	bool bDuplicateToCacheBones;
 
+	// Is the pose shared with other components this tick, see USkeletalMeshComponent::bEnableAnimationSharing
+	bool bUseAnimationSharing;
+
+	// Are we publishing the evaluated pose for animation sharing this tick
+	bool bPublishSharedPose;
+
+	// Are we waiting for another component to publish our pose instead of evaluating it this tick
+	bool bFollowSharedPose;
+
+	// Key the shared pose is found or published under
+	FAnimationSharingKey SharedPoseKey;
+
 	FAnimationEvaluationContext()
+		: bUseAnimationSharing(false)
+		, bPublishSharedPose(false)
+		, bFollowSharedPose(false)
 	{
 		Clear();
 	}
@@ -453,6 +469,28 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=SkeletalMesh)
 	uint32 bNoSkeletonUpdate:1;
 
+	/**
+	 * Reuse the pose evaluated by another component with the same mesh, animation sequence and playback time step instead of evaluating it again.
+	 * Only used while playing a single animation sequence without montages (AnimationSingleNode mode).
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization)
+	uint32 bEnableAnimationSharing:1;
+
+	/** Components whose playback time falls in the same step of this size share a pose. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization, meta=(ClampMin="0.001", editcondition="bEnableAnimationSharing"))
+	float AnimationSharingTimeStep;
+
+	/** Optional additive sequence applied on top of the shared pose to give this component some variation. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization, meta=(editcondition="bEnableAnimationSharing"))
+	class UAnimSequence* AnimationSharingAdditive;
+
+	/** Weight of AnimationSharingAdditive. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization, meta=(ClampMin="0.0", ClampMax="1.0", editcondition="bEnableAnimationSharing"))
+	float AnimationSharingAdditiveWeight;
+
+	/** Playback time of AnimationSharingAdditive, advanced in TickAnimation. */
+	float AnimationSharingAdditiveTime;
+
 	/** pauses this component's animations (doesn't tick them, but still refreshes bones) */
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Animation)
 	uint32 bPauseAnims:1;
@@ -891,6 +929,9 @@ public:
 	void PerformAnimationEvaluation(const USkeletalMesh* InSkeletalMesh, UAnimInstance* InAnimInstance, TArray<FTransform>& OutSpaceBases, TArray<FTransform>& OutLocalAtoms, TArray<FActiveVertexAnim>& OutVertexAnims, FVector& OutRootBoneTranslation) const;
 	void PostAnimEvaluation( FAnimationEvaluationContext& EvaluationContext );
 
+	/** Fills OutKey with the animation state of this component and returns true if its pose can be shared, see bEnableAnimationSharing. */
+	bool GetAnimationSharingKey(FAnimationSharingKey& OutKey) const;
+
 	/**
 	 * Blend of Physics Bones with PhysicsWeight and Animated Bones with (1-PhysicsWeight)
 	 *
@@ -1161,6 +1202,15 @@ private:
 	*/
 	void FillSpaceBases(const USkeletalMesh* InSkeletalMesh, const TArray<FTransform>& SourceAtoms, TArray<FTransform>& DestSpaceBases) const;
 
+	/** Copies the shared pose published under AnimEvaluationContext.SharedPoseKey, returns false if there is no matching one. */
+	bool CopySharedPose();
+
+	/** Accepts the pose published by the leader this component waited for, or evaluates it if the leader failed to publish it. */
+	void CompleteFollowedSharedPose();
+
+	/** Applies AnimationSharingAdditive to InOutLocalAtoms, if set and valid. Returns true if the pose was changed. */
+	bool ApplyAnimationSharingAdditive(const UAnimInstance* InAnimInstance, TArray<FTransform>& InOutLocalAtoms) const;
+
 	void RenderAxisGizmo(const FTransform& Transform, class UCanvas* Canvas) const;
 
 	bool ShouldBlendPhysicsBones();	
@@ -1174,7 +1224,11 @@ public:
 	void ParallelAnimationEvaluation() { PerformAnimationEvaluation(AnimEvaluationContext.SkeletalMesh, AnimEvaluationContext.AnimInstance, AnimEvaluationContext.SpaceBases, AnimEvaluationContext.LocalAtoms, AnimEvaluationContext.VertexAnims, AnimEvaluationContext.RootBoneTranslation); }
 	void CompleteParallelAnimationEvaluation()
 	{
-		if ((AnimEvaluationContext.AnimInstance == AnimScriptInstance) && (AnimEvaluationContext.SkeletalMesh == SkeletalMesh) && (AnimEvaluationContext.SpaceBases.Num() == GetNumSpaceBases()))
+		if (AnimEvaluationContext.bFollowSharedPose)
+		{
+			CompleteFollowedSharedPose();
+		}
+		else if ((AnimEvaluationContext.AnimInstance == AnimScriptInstance) && (AnimEvaluationContext.SkeletalMesh == SkeletalMesh) && (AnimEvaluationContext.SpaceBases.Num() == GetNumSpaceBases()))
 		{
 			Exchange(AnimEvaluationContext.SpaceBases, AnimEvaluationContext.bDoInterpolation ? CachedSpaceBases : GetEditableSpaceBases() );
 			Exchange(AnimEvaluationContext.LocalAtoms, AnimEvaluationContext.bDoInterpolation ? CachedLocalAtoms : LocalAtoms);
@@ -47,5 +47,9 @@ class ENGINE_API UCurveFloat : public UCurveBase
 
 	/** Determine if Curve is the same */
 	bool operator == (const UCurveFloat& Curve) const;
+
+	// Begin UObject interface
+	virtual bool IsSerializationThreadSafe() const override;
+	// End UObject interface
 };
 
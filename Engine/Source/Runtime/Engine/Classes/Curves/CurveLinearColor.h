@@ -42,5 +42,9 @@ class ENGINE_API UCurveLinearColor : public UCurveBase
 
 	/** Determine if Curve is the same */
 	bool operator == (const UCurveLinearColor& Curve) const;
+
+	// Begin UObject interface
+	virtual bool IsSerializationThreadSafe() const override;
+	// End UObject interface
 };
 
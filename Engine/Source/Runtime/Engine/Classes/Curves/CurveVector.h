@@ -25,5 +25,9 @@ class UCurveVector : public UCurveBase
 	ENGINE_API bool operator == (const UCurveVector& Curve) const;
 
 	virtual bool IsValidCurve( FRichCurveEditInfo CurveInfo ) override;
+
+	// Begin UObject interface
+	ENGINE_API virtual bool IsSerializationThreadSafe() const override;
+	// End UObject interface
 };
 
@@ -35,6 +35,7 @@ class UCurveTable
 	// Begin UObject interface.
 	virtual void FinishDestroy() override;
 	virtual void Serialize( FArchive& Ar ) override;
+	virtual bool IsSerializationThreadSafe() const override;
 #if WITH_EDITORONLY_DATA
 	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const;
 #endif
@@ -160,6 +160,13 @@ public:
 	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
 	uint32 bRunOnAnyThread:1;
 
+	/**
+	 * The frequency in seconds at which this tick function will be executed. If less than or equal to 0 then it will tick every frame.
+	 * When a tick is skipped, the frame time is carried over to the next tick. Can be changed while the tick function is registered.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Tick", AdvancedDisplay, meta=(DisplayName="Tick Interval (secs)"))
+	float TickInterval;
+
 private:
 	/** If true, means that this tick function is in the master array of tick functions **/
 	uint32 bRegistered:1;
@@ -176,6 +183,12 @@ private:
 	/** Internal data to track if we have finshed visiting this tick function yet this frame **/
 	int32 TickQueuedGFrameCounter;
 
+	/** Internal data to track the frame time that was not ticked yet because of TickInterval **/
+	float TimeSinceLastTick;
+
+	/** Internal data that holds the delta time to tick with this frame, which includes the frames skipped because of TickInterval **/
+	float TickDeltaSeconds;
+
 protected:
 	/** Internal data that indicates the tick group we actually executed in (it may have been delayed due to prerequisites) **/
 	TEnumAsByte<enum ETickingGroup> ActualTickGroup;
@@ -277,6 +290,13 @@ private:
 	*/
 	void QueueTickFunctionParallel(const FTickContext& TickContext, TArray<FTickFunction*, TInlineAllocator<4> >& StackForCycleDetection);
 
+	/**
+	 * Accumulates the frame time and checks if this tick function is due this frame, according to TickInterval
+	 * @param DeltaSeconds - frame time to advance, in seconds
+	 * @return true if the tick function should tick this frame, in that case TickDeltaSeconds is the time to tick by
+	 */
+	bool UpdateTickInterval(float DeltaSeconds);
+
 	/** 
 	 * Abstract function actually execute the tick. 
 	 * @param DeltaTime - frame time to advance, in seconds
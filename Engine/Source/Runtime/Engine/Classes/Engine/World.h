@@ -737,6 +737,9 @@ private:
 	/** Gameplay timers. */
 	class FTimerManager* TimerManager;
 
+	/** Throttles the ticks of the registered actors by their significance to the players. */
+	class FSignificanceManager* SignificanceManager;
+
 	/** Latent action manager. */
 	struct FLatentActionManager LatentActionManager;
 
@@ -3041,6 +3044,12 @@ public:
 		return *TimerManager;
 	}
 
+	/** Returns SignificanceManager instance for this world. */
+	inline FSignificanceManager& GetSignificanceManager() const
+	{
+		return *SignificanceManager;
+	}
+
 	/** Returns LatentActionManager instance for this world. */
 	inline FLatentActionManager& GetLatentActionManager()
 	{
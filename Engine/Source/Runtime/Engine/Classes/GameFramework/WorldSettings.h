@@ -227,6 +227,37 @@ struct ENGINE_API FHierarchicalSimplification
 	}
 };
 
+/** Tick rates for the actors registered with the world's significance manager, used within a distance of the nearest player view. */
+USTRUCT()
+struct ENGINE_API FSignificanceBucket
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Actors closer than this to the nearest player view use the tick rates of this bucket */
+	UPROPERTY(EditAnywhere, Category=Significance, meta=(ClampMin="0"))
+	float MaxDistance;
+
+	/** Tick interval in seconds for the actors and the components that are not animated meshes or particle systems, 0 to tick every frame */
+	UPROPERTY(EditAnywhere, Category=Significance, meta=(ClampMin="0"))
+	float TickInterval;
+
+	/** Tick interval in seconds for skeletal mesh components, which update their animation when they tick */
+	UPROPERTY(EditAnywhere, Category=Significance, meta=(ClampMin="0"))
+	float AnimationTickInterval;
+
+	/** Tick interval in seconds for particle system components, which simulate their particles when they tick */
+	UPROPERTY(EditAnywhere, Category=Significance, meta=(ClampMin="0"))
+	float ParticleTickInterval;
+
+	FSignificanceBucket()
+		: MaxDistance(0.f)
+		, TickInterval(0.f)
+		, AnimationTickInterval(0.f)
+		, ParticleTickInterval(0.f)
+	{
+	}
+};
+
 /**
  * Actor containing all script accessible world properties.
  */
@@ -373,6 +404,20 @@ class ENGINE_API AWorldSettings : public AInfo, public IInterface_AssetUserData
 	UPROPERTY(Category=Lightmass, VisibleAnywhere)
 	TEnumAsByte<enum ELightingBuildQuality> LevelLightingQuality;
 
+	/************************************/
+	/** SIGNIFICANCE SETTINGS **/
+
+	/**
+	 * Tick rates for the actors registered with the significance manager, by distance to the nearest player view.
+	 * Sorted by increasing MaxDistance, actors beyond the last bucket use the last bucket. If empty, everything ticks at its own rate.
+	 */
+	UPROPERTY(EditAnywhere, config, Category=Significance, AdvancedDisplay)
+	TArray<struct FSignificanceBucket> SignificanceBuckets;
+
+	/** Registered actors that were not rendered recently count as this many times further away from the player views */
+	UPROPERTY(EditAnywhere, config, Category=Significance, AdvancedDisplay, meta=(ClampMin="1"))
+	float OffscreenSignificanceDistanceScale;
+
 	/************************************/
 	/** AUDIO SETTINGS **/
 	/** Default reverb settings used by audio volumes.													*/
@@ -22,6 +22,8 @@ class UParticleModuleAccelerationConstant : public UParticleModuleAccelerationBa
 	virtual void CompileModule( struct FParticleEmitterBuildInfo& EmitterInfo ) override;
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+	virtual bool CanUpdateSoA(FParticleEmitterInstance* Owner) const override;
+	virtual void UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime) override;
 	//End UParticleModule Interface
 };
 
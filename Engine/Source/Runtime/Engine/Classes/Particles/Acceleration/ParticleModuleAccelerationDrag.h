@@ -30,6 +30,8 @@ class UParticleModuleAccelerationDrag : public UParticleModuleAccelerationBase
 	//Begin UParticleModule Interface
 	virtual void CompileModule( struct FParticleEmitterBuildInfo& EmitterInfo ) override;
 	virtual void Update( FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime ) override;
+	virtual bool CanUpdateSoA( FParticleEmitterInstance* Owner ) const override;
+	virtual void UpdateSoA( FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime ) override;
 	//End UParticleModule Interface
 
 #if WITH_EDITOR
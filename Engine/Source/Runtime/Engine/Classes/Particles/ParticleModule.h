@@ -246,6 +246,23 @@ class UParticleModule : public UObject
 	 *	@param	DeltaTime	The time since the last update.
 	 */
 	virtual void	FinalUpdate(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime);
+	/**
+	 *	Returns true if the module can update the particles of the emitter with UpdateSoA instead of Update.
+	 *	The emitter only uses the structure-of-arrays update when all of its update modules support it.
+	 *
+	 *	@param	Owner		The FParticleEmitterInstance that 'owns' the particles.
+	 */
+	virtual bool	CanUpdateSoA(FParticleEmitterInstance* Owner) const	{	return false;	}
+	/**
+	 *	Structure-of-arrays version of Update, called on each chunk of the particles that are not frozen.
+	 *	Chunks of the same emitter may be updated at the same time on different threads.
+	 *
+	 *	@param	Owner		The FParticleEmitterInstance that 'owns' the particles.
+	 *	@param	Chunk		The particle streams to update.
+	 *	@param	Offset		The modules offset into the data payload of the particle.
+	 *	@param	DeltaTime	The time since the last update.
+	 */
+	virtual void	UpdateSoA(FParticleEmitterInstance* Owner, struct FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime) {}
 
 	/**
 	 *	Returns the number of bytes that the module requires in the particle payload block.
@@ -52,6 +52,8 @@ class UParticleModuleSizeMultiplyLife : public UParticleModuleSizeBase
 	virtual void CompileModule( struct FParticleEmitterBuildInfo& EmitterInfo ) override;
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void	Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+	virtual bool	CanUpdateSoA(FParticleEmitterInstance* Owner) const override;
+	virtual void	UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime) override;
 	virtual void SetToSensibleDefaults(UParticleEmitter* Owner) override;
 	virtual bool   IsSizeMultiplyLife() override { return true; };
 
@@ -37,6 +37,8 @@ class UParticleModuleVelocityOverLifetime : public UParticleModuleVelocityBase
 	// Begin UParticleModule Interface
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void	Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+	virtual bool	CanUpdateSoA(FParticleEmitterInstance* Owner) const override;
+	virtual void	UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime) override;
 	// Begin UParticleModule Interface
 };
 
@@ -65,6 +65,8 @@ FAsyncPathFindingQuery::FAsyncPathFindingQuery(const UObject* InOwner, const ANa
 : FPathFindingQuery(InOwner, InNavData, Start, End, SourceQueryFilter)
 , QueryID(GetUniqueID())
 , OnDoneDelegate(Delegate)
+, Priority(0.0f)
+, QueryTime(FPlatformTime::Seconds())
 {
 
 }
@@ -74,6 +76,8 @@ FAsyncPathFindingQuery::FAsyncPathFindingQuery(const FPathFindingQuery& Query, c
 , QueryID(GetUniqueID())
 , OnDoneDelegate(Delegate)
 , Mode(QueryMode)
+, Priority(0.0f)
+, QueryTime(FPlatformTime::Seconds())
 {
 
 }
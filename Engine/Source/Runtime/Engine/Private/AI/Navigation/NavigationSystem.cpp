@@ -48,6 +48,8 @@ DECLARE_CYCLE_STAT(TEXT("Nav Tick: mark dirty"), STAT_Navigation_TickMarkDirty,
 DECLARE_CYCLE_STAT(TEXT("Nav Tick: async build"), STAT_Navigation_TickAsyncBuild, STATGROUP_Navigation);
 DECLARE_CYCLE_STAT(TEXT("Nav Tick: async pathfinding"), STAT_Navigation_TickAsyncPathfinding, STATGROUP_Navigation);
 DECLARE_CYCLE_STAT(TEXT("Debug NavOctree Time"), STAT_DebugNavOctree, STATGROUP_Navigation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Async path queries per second"), STAT_Navigation_AsyncQueriesPerSecond, STATGROUP_Navigation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Async path query average latency (ms)"), STAT_Navigation_AsyncQueriesLatency, STATGROUP_Navigation);
 
 //----------------------------------------------------------------------//
 // Stats
@@ -230,6 +232,8 @@ UNavigationSystem::UNavigationSystem(const FObjectInitializer& ObjectInitializer
 	, bAddPlayersToGenerationSeeds(true)
 	, bSkipAgentHeightCheckWhenPickingNavData(false)
 	, DirtyAreasUpdateFreq(60)
+	, MaxAsyncPathfindingQueriesPerTick(0)
+	, MinAsyncPathfindingQueriesPerTask(16)
 	, OperationMode(FNavigationSystem::InvalidMode)
 	, NavOctree(NULL)
 	, bNavigationBuildingLocked(false)
@@ -238,6 +242,9 @@ UNavigationSystem::UNavigationSystem(const FObjectInitializer& ObjectInitializer
 	, bInitialLevelsAdded(false)
 	, CurrentlyDrawnNavDataIndex(0)
 	, DirtyAreasUpdateTime(0)
+	, NumAsyncQueriesDone(0)
+	, AsyncQueriesLatency(0)
+	, AsyncQueriesStatsTime(0)
 {
 #if WITH_EDITOR
 	NavUpdateLockFlags = 0;
@@ -757,9 +764,10 @@ void UNavigationSystem::Tick(float DeltaSeconds)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_Navigation_TickAsyncPathfinding);
 		TriggerAsyncQueries(AsyncPathFindingQueries);
-		AsyncPathFindingQueries.Reset();
 	}
 
+	UpdateAsyncQueriesStats();
+
 	if (CrowdManager.IsValid())
 	{
 		CrowdManager->Tick(DeltaSeconds);
@@ -887,7 +895,7 @@ void UNavigationSystem::AddAsyncQuery(const FAsyncPathFindingQuery& Query)
 	AsyncPathFindingQueries.Add(Query);
 }
 
-uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode)
+uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode, float Priority)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RequestingAsyncPathfinding);
 
@@ -899,6 +907,7 @@ uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperti
 	if (Query.NavData.IsValid())
 	{
 		FAsyncPathFindingQuery AsyncQuery(Query, ResultDelegate, Mode);
+		AsyncQuery.Priority = Priority;
 
 		if (AsyncQuery.QueryID != INVALID_NAVQUERYID)
 		{
@@ -925,33 +934,153 @@ void UNavigationSystem::AbortAsyncFindPathRequest(uint32 AsynPathQueryID)
 	}
 }
 
+static void AsyncQueriesDone(TArray<FAsyncPathFindingQuery>* PathFindingQueries, TWeakObjectPtr<UNavigationSystem> NavSys)
+{
+	check(IsInGameThread());
+	for (FAsyncPathFindingQuery& Query : *PathFindingQueries)
+	{
+		// paths found off the game thread get their filter here, see ARecastNavMesh::FindPath
+		if (Query.Result.Path.IsValid() && Query.QueryFilter.IsValid())
+		{
+			Query.Result.Path->SetFilter(Query.QueryFilter);
+		}
+		if (NavSys.IsValid())
+		{
+			NavSys->OnAsyncQueryDone(Query);
+		}
+		Query.OnDoneDelegate.ExecuteIfBound(Query.QueryID, Query.Result.Result, Query.Result.Path);
+	}
+	delete PathFindingQueries;
+}
+
 void UNavigationSystem::TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries)
 {
 	DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.NavigationSystem batched async queries"),
 		STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries,
 		STATGROUP_TaskGraphTasks);
 
-	FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-		FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, PathFindingQueries),
-		GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+	TArray<FAsyncPathFindingQuery> QueriesToRun;
+	const int32 NumQueries = PathFindingQueries.Num();
+	const int32 NumQueriesToRun = MaxAsyncPathfindingQueriesPerTick > 0 ? FMath::Min(MaxAsyncPathfindingQueriesPerTick, NumQueries) : NumQueries;
+	if (NumQueriesToRun < NumQueries)
+	{
+		// queries gain a point of priority for every second they wait, so low priority ones don't starve
+		const double CurrentTime = FPlatformTime::Seconds();
+		TArray<float> EffectivePriorities;
+		TArray<int32> SortedIndices;
+		EffectivePriorities.AddUninitialized(NumQueries);
+		SortedIndices.AddUninitialized(NumQueries);
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			const FAsyncPathFindingQuery& Query = PathFindingQueries[Index];
+			EffectivePriorities[Index] = Query.Priority + float(CurrentTime - Query.QueryTime);
+			SortedIndices[Index] = Index;
+		}
+
+		SortedIndices.Sort([&EffectivePriorities, &PathFindingQueries](int32 IndexA, int32 IndexB)
+		{
+			return EffectivePriorities[IndexA] != EffectivePriorities[IndexB] ? EffectivePriorities[IndexA] > EffectivePriorities[IndexB]
+				: PathFindingQueries[IndexA].QueryID < PathFindingQueries[IndexB].QueryID;
+		});
+
+		TBitArray<> IsQueryStarted(false, NumQueries);
+		QueriesToRun.Reserve(NumQueriesToRun);
+		for (int32 Index = 0; Index < NumQueriesToRun; ++Index)
+		{
+			QueriesToRun.Add(PathFindingQueries[SortedIndices[Index]]);
+			IsQueryStarted[SortedIndices[Index]] = true;
+		}
+
+		// the remaining queries keep their order
+		TArray<FAsyncPathFindingQuery> RemainingQueries;
+		RemainingQueries.Reserve(FMath::Max<int32>(NumQueries - NumQueriesToRun, INITIAL_ASYNC_QUERIES_SIZE));
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			if (!IsQueryStarted[Index])
+			{
+				RemainingQueries.Add(PathFindingQueries[Index]);
+			}
+		}
+		PathFindingQueries = MoveTemp(RemainingQueries);
+	}
+	else
+	{
+		QueriesToRun = MoveTemp(PathFindingQueries);
+		PathFindingQueries.Reserve(INITIAL_ASYNC_QUERIES_SIZE);
+	}
+
+	// every task gets its own detour query from the navmesh's pool, so the queries of a tick can run on all worker threads.
+	// The queries stay owned by the game thread: worker tasks only access them by pointer, since copying or releasing
+	// their shared query filters off the game thread would race on the filters' reference counts.
+	DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.Async nav query finished"),
+		STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished,
+		STATGROUP_TaskGraphTasks);
+
+	const int32 MaxTasks = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	const int32 NumTasks = FMath::Clamp(QueriesToRun.Num() / FMath::Max(MinAsyncPathfindingQueriesPerTask, 1), 1, MaxTasks);
+	const int32 QueriesPerTask = FMath::DivideAndRoundUp(QueriesToRun.Num(), NumTasks);
+	for (int32 FirstIndex = 0; FirstIndex < QueriesToRun.Num(); FirstIndex += QueriesPerTask)
+	{
+		const int32 LastIndex = FMath::Min(FirstIndex + QueriesPerTask, QueriesToRun.Num());
+		TArray<FAsyncPathFindingQuery>* TaskQueries = new TArray<FAsyncPathFindingQuery>();
+		TaskQueries->Reserve(LastIndex - FirstIndex);
+		for (int32 Index = FirstIndex; Index < LastIndex; ++Index)
+		{
+			TaskQueries->Add(QueriesToRun[Index]);
+		}
+
+		FGraphEventRef QueriesTaskEvent = FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, TaskQueries),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+
+		// call the delegates on main thread - otherwise it may depend too much on stuff being thread safe
+		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateStatic(AsyncQueriesDone, TaskQueries, TWeakObjectPtr<UNavigationSystem>(this)),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished), QueriesTaskEvent, ENamedThreads::GameThread);
+	}
 }
 
-static void AsyncQueryDone(FAsyncPathFindingQuery Query)
+void UNavigationSystem::OnAsyncQueryDone(const FAsyncPathFindingQuery& Query)
 {
-	Query.OnDoneDelegate.ExecuteIfBound(Query.QueryID, Query.Result.Result, Query.Result.Path);
+	check(IsInGameThread());
+	++NumAsyncQueriesDone;
+	AsyncQueriesLatency += FPlatformTime::Seconds() - Query.QueryTime;
 }
 
-void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries)
+void UNavigationSystem::UpdateAsyncQueriesStats()
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (AsyncQueriesStatsTime == 0)
+	{
+		AsyncQueriesStatsTime = CurrentTime;
+		return;
+	}
+
+	const double StatsInterval = CurrentTime - AsyncQueriesStatsTime;
+	if (StatsInterval < 1.0)
+	{
+		return;
+	}
+
+	SET_FLOAT_STAT(STAT_Navigation_AsyncQueriesPerSecond, float(NumAsyncQueriesDone / StatsInterval));
+	SET_FLOAT_STAT(STAT_Navigation_AsyncQueriesLatency, NumAsyncQueriesDone > 0 ? float(AsyncQueriesLatency * 1000.0 / NumAsyncQueriesDone) : 0.0f);
+
+	NumAsyncQueriesDone = 0;
+	AsyncQueriesLatency = 0;
+	AsyncQueriesStatsTime = CurrentTime;
+}
+
+void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery>* PathFindingQueries)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_PathfindingAsync);
 
-	if (PathFindingQueries.Num() == 0)
+	if (PathFindingQueries->Num() == 0)
 	{
 		return;
 	}
 	
-	const int32 QueriesCount = PathFindingQueries.Num();
-	FAsyncPathFindingQuery* Query = PathFindingQueries.GetData();
+	const int32 QueriesCount = PathFindingQueries->Num();
+	FAsyncPathFindingQuery* Query = PathFindingQueries->GetData();
 
 	for (int32 QueryIndex = 0; QueryIndex < QueriesCount; ++QueryIndex, ++Query)
 	{
@@ -975,16 +1104,7 @@ void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathF
 		{
 			Query->Result = ENavigationQueryResult::Error;
 		}
-
 		// @todo make it return more informative results (bResult == false)
-		// trigger calling delegate on main thread - otherwise it may depend too much on stuff being thread safe
-		DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.Async nav query finished"),
-			STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished,
-			STATGROUP_TaskGraphTasks);
-
-		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-			FSimpleDelegateGraphTask::FDelegate::CreateStatic(AsyncQueryDone, *Query),
-			GET_STATID(STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished), NULL, ENamedThreads::GameThread);
 	}
 }
 
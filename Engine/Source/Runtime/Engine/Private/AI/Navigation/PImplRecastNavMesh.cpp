@@ -34,15 +34,44 @@ static_assert(RECAST_UNWALKABLE_POLY_COST == DT_UNWALKABLE_POLY_COST, "Unwalkabl
 
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY_SIMPLE(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	FRecastNavQueryScope NavQueryVariable##Scope(*this);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.NavQuery; \
 	NavQueryVariable.init(DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	FRecastNavQueryScope NavQueryVariable##Scope(*this);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.NavQuery; \
 	NavQueryVariable.init(DetourNavMesh, NumNodes, &LinkFilter);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path corridor cache hits"), STAT_Navigation_PathCorridorCacheHits, STATGROUP_Navigation);
+
+/** Max number of path corridors cached by a navmesh, expired ones get purged when it's reached */
+static const int32 MaxCachedPathCorridors = 1024;
+
+/** Query result rebuilt from a cached path corridor */
+struct FRecastCachedPathResult : public dtQueryResult
+{
+	void AddPoly(dtPolyRef PolyRef, float Cost)
+	{
+		addItem(PolyRef, Cost, 0, 0);
+	}
+};
+
+/** Hash of the filter data that decides which corridor a search finds */
+static uint32 GetPathCorridorFilterHash(const dtQueryFilter& Filter)
+{
+	uint32 Hash = FCrc::MemCrc32(Filter.getAllAreaCosts(), sizeof(float) * DT_MAX_AREAS);
+#if WITH_FIXED_AREA_ENTERING_COST
+	Hash = FCrc::MemCrc32(Filter.getAllFixedAreaCosts(), sizeof(float) * DT_MAX_AREAS, Hash);
+#endif // WITH_FIXED_AREA_ENTERING_COST
+
+	const uint16 Flags[] = { Filter.getIncludeFlags(), Filter.getExcludeFlags(), uint16(Filter.getIsBacktracking() ? 1 : 0) };
+	Hash = FCrc::MemCrc32(Flags, sizeof(Flags), Hash);
+
+	const float HeuristicScale = Filter.getHeuristicScale();
+	return FCrc::MemCrc32(&HeuristicScale, sizeof(HeuristicScale), Hash);
+}
+
 static void* DetourMalloc(int Size, dtAllocHint)
 {
 	void* Result = FMemory::Malloc(uint32(Size));
@@ -250,6 +279,12 @@ FPImplRecastNavMesh::~FPImplRecastNavMesh()
 {
 	ReleaseDetourNavMesh();
 
+	for (dtNavMeshQuery* NavQuery : PooledNavQueries)
+	{
+		dtFreeNavMeshQuery(NavQuery);
+	}
+	PooledNavQueries.Empty();
+
 	DEC_DWORD_STAT_BY( STAT_NavigationMemory, sizeof(*this) );
 };
 
@@ -264,6 +299,121 @@ void FPImplRecastNavMesh::ReleaseDetourNavMesh()
 	
 	//
 	CompressedTileCacheLayers.Empty();
+
+	ClearPathCorridorCache();
+}
+
+dtNavMeshQuery* FPImplRecastNavMesh::AllocPooledNavQuery() const
+{
+	{
+		FScopeLock Lock(&PooledNavQueriesLock);
+		if (PooledNavQueries.Num() > 0)
+		{
+			return PooledNavQueries.Pop(false);
+		}
+	}
+
+	return dtAllocNavMeshQuery();
+}
+
+void FPImplRecastNavMesh::ReleasePooledNavQuery(dtNavMeshQuery* NavQuery) const
+{
+	FScopeLock Lock(&PooledNavQueriesLock);
+	PooledNavQueries.Add(NavQuery);
+}
+
+bool FPImplRecastNavMesh::FindCachedPathCorridor(const FRecastPathCorridorKey& Key, TArray<NavNodeRef>& OutPolys, TArray<float>& OutCosts) const
+{
+	FScopeLock Lock(&PathCorridorCacheLock);
+
+	const FCachedPathCorridor* CachedCorridor = PathCorridorCache.Find(Key);
+	if (CachedCorridor == NULL)
+	{
+		return false;
+	}
+
+	if (FPlatformTime::Seconds() - CachedCorridor->CacheTime > NavMeshOwner->PathCorridorCacheLifetime)
+	{
+		PathCorridorCache.Remove(Key);
+		return false;
+	}
+
+	OutPolys = CachedCorridor->Polys;
+	OutCosts = CachedCorridor->Costs;
+	return true;
+}
+
+void FPImplRecastNavMesh::CachePathCorridor(const FRecastPathCorridorKey& Key, const dtQueryResult& PathResult) const
+{
+	FCachedPathCorridor CachedCorridor;
+	CachedCorridor.Polys.Reserve(PathResult.size());
+	CachedCorridor.Costs.Reserve(PathResult.size());
+	for (int32 Index = 0; Index < PathResult.size(); ++Index)
+	{
+		// off-mesh links can be toggled at any time, paths using them always get searched again
+		if (DetourNavMesh->getOffMeshConnectionByRef(PathResult.getRef(Index)) != NULL)
+		{
+			return;
+		}
+
+		CachedCorridor.Polys.Add(PathResult.getRef(Index));
+		CachedCorridor.Costs.Add(PathResult.getCost(Index));
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	CachedCorridor.CacheTime = CurrentTime;
+
+	FScopeLock Lock(&PathCorridorCacheLock);
+	if (PathCorridorCache.Num() >= MaxCachedPathCorridors)
+	{
+		for (auto It = PathCorridorCache.CreateIterator(); It; ++It)
+		{
+			if (CurrentTime - It.Value().CacheTime > NavMeshOwner->PathCorridorCacheLifetime)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (PathCorridorCache.Num() >= MaxCachedPathCorridors)
+		{
+			PathCorridorCache.Empty();
+		}
+	}
+	PathCorridorCache.Add(Key, CachedCorridor);
+}
+
+void FPImplRecastNavMesh::ClearPathCorridorCache()
+{
+	FScopeLock Lock(&PathCorridorCacheLock);
+	PathCorridorCache.Empty();
+}
+
+void FPImplRecastNavMesh::RemoveCachedPathCorridors(const TArray<uint32>& ChangedTiles)
+{
+	FScopeLock Lock(&PathCorridorCacheLock);
+	for (auto It = PathCorridorCache.CreateIterator(); It; ++It)
+	{
+		for (const NavNodeRef PolyRef : It.Value().Polys)
+		{
+			if (ChangedTiles.Contains(GetTileIndexFromPolyRef(PolyRef)))
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
+}
+
+int32 FPImplRecastNavMesh::GetNumCachedPathCorridors() const
+{
+	FScopeLock Lock(&PathCorridorCacheLock);
+	return PathCorridorCache.Num();
+}
+
+int32 FPImplRecastNavMesh::GetNumPooledNavQueries() const
+{
+	FScopeLock Lock(&PooledNavQueriesLock);
+	return PooledNavQueries.Num();
 }
 
 /**
@@ -836,9 +986,50 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartL
 	// initialize output
 	Path.Reset();
 
-	// get path corridor
-	dtQueryResult PathResult;
-	const dtStatus FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, QueryFilter, PathResult, 0);
+	// get path corridor, reusing a recently found one if allowed
+	FRecastCachedPathResult PathResult;
+	dtStatus FindPathStatus = DT_FAILURE;
+	bool bUsedCachedCorridor = false;
+
+	const bool bUseCorridorCache = NavMeshOwner->bCachePathCorridors && StartPolyID != EndPolyID;
+	const FRecastPathCorridorKey CorridorKey(StartPolyID, EndPolyID, bUseCorridorCache ? GetPathCorridorFilterHash(*QueryFilter) : 0);
+	if (bUseCorridorCache)
+	{
+		TArray<NavNodeRef> CachedPolys;
+		TArray<float> CachedCosts;
+		if (FindCachedPathCorridor(CorridorKey, CachedPolys, CachedCosts))
+		{
+			// tiles could have been rebuilt since the corridor got cached
+			bUsedCachedCorridor = true;
+			for (int32 Index = 0; Index < CachedPolys.Num(); ++Index)
+			{
+				if (!NavQuery.isValidPolyRef(CachedPolys[Index], QueryFilter))
+				{
+					bUsedCachedCorridor = false;
+					break;
+				}
+			}
+
+			if (bUsedCachedCorridor)
+			{
+				for (int32 Index = 0; Index < CachedPolys.Num(); ++Index)
+				{
+					PathResult.AddPoly(CachedPolys[Index], CachedCosts[Index]);
+				}
+				FindPathStatus = DT_SUCCESS;
+				INC_DWORD_STAT(STAT_Navigation_PathCorridorCacheHits);
+			}
+		}
+	}
+
+	if (!bUsedCachedCorridor)
+	{
+		FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, QueryFilter, PathResult, 0);
+		if (bUseCorridorCache && dtStatusSucceed(FindPathStatus) && !dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT))
+		{
+			CachePathCorridor(CorridorKey, PathResult);
+		}
+	}
 
 	// check for special case, where path has not been found, and starting polygon
 	// was the one closest to the target
@@ -26,13 +26,13 @@
 #if WITH_RECAST
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	FRecastNavQueryScope NavQueryVariable##Scope(*RecastNavMeshImpl);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.NavQuery; \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY_WLINKFILTER(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	FRecastNavQueryScope NavQueryVariable##Scope(*RecastNavMeshImpl);	\
+	dtNavMeshQuery& NavQueryVariable = NavQueryVariable##Scope.NavQuery; \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes, &LinkFilter);
 
 #endif // WITH_RECAST
@@ -222,6 +222,8 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 	, bPerformVoxelFiltering(true)	
 	, bMarkLowHeightAreas(false)
 	, bUseVirtualFilters(true)
+	, bCachePathCorridors(false)
+	, PathCorridorCacheLifetime(1.0f)
 	, TileSetUpdateInterval(1.0f)
 	, NavMeshVersion(NAVMESHVER_LATEST)	
 	, RecastNavMeshImpl(NULL)
@@ -1331,7 +1333,18 @@ void ARecastNavMesh::InvalidateAffectedPaths(const TArray<uint32>& ChangedTiles)
 	const int32 PathsCount = ActivePaths.Num();
 	const int32 ChangedTilesCount = ChangedTiles.Num();
 	
-	if (ChangedTilesCount == 0 || PathsCount == 0)
+	if (ChangedTilesCount == 0)
+	{
+		return;
+	}
+
+	// polys of rebuilt tiles get new refs, corridors through them are worthless now
+	if (RecastNavMeshImpl)
+	{
+		RecastNavMeshImpl->RemoveCachedPathCorridors(ChangedTiles);
+	}
+
+	if (PathsCount == 0)
 	{
 		return;
 	}
@@ -1586,7 +1599,11 @@ FPathFindingResult ARecastNavMesh::FindPath(const FNavAgentProperties& AgentProp
 	Result.Path = Query.PathInstanceToFill.IsValid() ? Query.PathInstanceToFill : Self->CreatePathInstance<FNavMeshPath>(Query.Owner.Get());
 
 	FNavMeshPath* NavMeshPath = (FNavMeshPath*)Result.Path.Get();
-	NavMeshPath->SetFilter(Query.QueryFilter);
+	if (IsInGameThread())
+	{
+		// query filters are not thread safe shared pointers, async queries get theirs set on the game thread by the navigation system
+		NavMeshPath->SetFilter(Query.QueryFilter);
+	}
 	NavMeshPath->ApplyFlags(Query.NavDataFlags);
 
 	if ((Query.StartLocation - Query.EndLocation).IsNearlyZero() == true)
@@ -1649,7 +1666,8 @@ bool ARecastNavMesh::TestHierarchicalPath(const FNavAgentProperties& AgentProper
 		return false;
 	}
 
-	const bool bCanUseHierachicalPath = (Query.QueryFilter == RecastNavMesh->GetDefaultQueryFilter());
+	// compare implementations, copying the default filter's shared pointer is not safe off the game thread
+	const bool bCanUseHierachicalPath = Query.QueryFilter.IsValid() && (Query.QueryFilter->GetImplementation() == RecastNavMesh->GetDefaultQueryFilterImpl());
 	bool bPathExists = true;
 
 	if ((Query.StartLocation - Query.EndLocation).IsNearlyZero() == false)
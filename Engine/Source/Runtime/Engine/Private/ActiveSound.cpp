@@ -3,6 +3,7 @@
 #include "EnginePrivate.h"
 #include "ActiveSound.h"
 #include "AudioDevice.h"
+#include "AudioThread.h"
 #include "Sound/SoundCue.h"
 #include "Sound/SoundWave.h"
 #include "Sound/SoundNodeAttenuation.h"
@@ -12,6 +13,7 @@ FActiveSound::FActiveSound()
 	: Sound(NULL)
 	, World(NULL)
 	, AudioComponent(NULL)
+	, AudioComponentPlayID(0)
 	, SoundClassOverride(NULL)
 	, bOccluded(false)
 	, bAllowSpatialization(true)
@@ -238,9 +240,12 @@ void FActiveSound::Stop(FAudioDevice* AudioDevice)
 			Source->Stop();
 		}
 
-		// TODO - Audio Threading. This call would be a task back to game thread
 		// Dequeue subtitles for this sounds
-		FSubtitleManager::GetSubtitleManager()->KillSubtitles( ( PTRINT )WaveInstance );
+		const PTRINT SubtitleID = ( PTRINT )WaveInstance;
+		FAudioThread::RunCommandOnGameThread([SubtitleID]()
+		{
+			FSubtitleManager::GetSubtitleManager()->KillSubtitles( SubtitleID );
+		});
 
 		delete WaveInstance;
 
@@ -249,11 +254,16 @@ void FActiveSound::Stop(FAudioDevice* AudioDevice)
 	}
 	WaveInstances.Empty();
 
-	// TODO - Audio Threading. This call would be a task back to game thread
-	if (AudioComponent.IsValid())
+	// The component may have started playing again by the time the game thread gets this
+	TWeakObjectPtr<UAudioComponent> AudioComponentPtr = AudioComponent;
+	const uint32 PlayID = AudioComponentPlayID;
+	FAudioThread::RunCommandOnGameThread([AudioComponentPtr, PlayID]()
 	{
-		AudioComponent->PlaybackCompleted(false);
-	}
+		if (AudioComponentPtr.IsValid() && AudioComponentPtr->PlayID == PlayID)
+		{
+			AudioComponentPtr->PlaybackCompleted(false);
+		}
+	});
 
 	AudioDevice->RemoveActiveSound(this);
 }
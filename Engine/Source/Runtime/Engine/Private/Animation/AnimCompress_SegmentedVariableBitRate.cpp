@@ -0,0 +1,447 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimCompress_SegmentedVariableBitRate.cpp: Per segment, per channel quantization with an error bounded bit rate search.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Animation/AnimCompress_SegmentedVariableBitRate.h"
+#include "AnimationUtils.h"
+#include "AnimEncoding.h"
+#include "AnimationCompression.h"
+
+typedef FAnimationCompression_SegmentedUtils FSegmentedUtils;
+
+namespace SegmentedVariableBitRate
+{
+	enum EChannelType
+	{
+		Channel_Translation,
+		Channel_Rotation,
+		Channel_Scale,
+		Channel_MAX
+	};
+
+	/** Bit rates a segment can pick from, in increasing order */
+	static const int32 BitRates[] = { 0, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 20, FSegmentedUtils::MaxBitsPerComponent };
+
+	/** One translation, rotation or scale track prepared for quantization */
+	struct FSourceChannel
+	{
+		EChannelType Type;
+		int32 TrackIndex;
+		/** One value per frame for animated channels, a single value for constant ones. Rotations hold the XYZ of a quaternion with a positive W. */
+		TArray<FVector> Values;
+		/** Original rotation keys, normalized, used to measure the angle error */
+		TArray<FQuat> Rotations;
+		FVector SequenceMin;
+		FVector SequenceExtent;
+		int32 AnimatedChannelIndex;
+	};
+
+	/** The quantization chosen for one animated channel in one segment */
+	struct FSegmentChannelEncoding
+	{
+		uint16 RangeMin[3];
+		uint16 RangeExtent[3];
+		int32 NumBits;
+	};
+
+	static FQuat GetPositiveWRotation(const FQuat& Rotation)
+	{
+		FQuat Result = Rotation.GetNormalized();
+		return Result.W < 0.0f ? FQuat(-Result.X, -Result.Y, -Result.Z, -Result.W) : Result;
+	}
+
+	/** Quantizes a normalized component to NumBits within the given segment range */
+	static uint32 QuantizeComponent(float SequenceNormalized, uint16 RangeMin, uint16 RangeExtent, int32 NumBits)
+	{
+		if (NumBits == 0 || RangeExtent == 0)
+		{
+			return 0;
+		}
+		const float SegmentNormalized = FMath::Clamp((SequenceNormalized * FSegmentedUtils::SegmentRangeMax - RangeMin) / RangeExtent, 0.0f, 1.0f);
+		const uint32 MaxQuantized = (1u << NumBits) - 1;
+		return FMath::Min<uint32>((uint32)FMath::RoundToInt(SegmentNormalized * MaxQuantized), MaxQuantized);
+	}
+
+	static float GetSequenceNormalized(const FSourceChannel& Channel, int32 FrameIndex, int32 ComponentIndex)
+	{
+		const float Extent = Channel.SequenceExtent[ComponentIndex];
+		return Extent > 0.0f ? FMath::Clamp((Channel.Values[FrameIndex][ComponentIndex] - Channel.SequenceMin[ComponentIndex]) / Extent, 0.0f, 1.0f) : 0.0f;
+	}
+
+	static FVector DecodeFrame(const FSourceChannel& Channel, const FSegmentChannelEncoding& Encoding, int32 FrameIndex)
+	{
+		FVector Result;
+		for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+		{
+			const uint32 Quantized = QuantizeComponent(GetSequenceNormalized(Channel, FrameIndex, ComponentIndex), Encoding.RangeMin[ComponentIndex], Encoding.RangeExtent[ComponentIndex], Encoding.NumBits);
+			Result[ComponentIndex] = FSegmentedUtils::DecodeComponent(Quantized, Encoding.NumBits, Encoding.RangeMin[ComponentIndex], Encoding.RangeExtent[ComponentIndex], Channel.SequenceMin[ComponentIndex], Channel.SequenceExtent[ComponentIndex]);
+		}
+		return Result;
+	}
+
+	/** Local-space error of a decoded frame, per component for translation and scale, in radians for rotation */
+	static float GetFrameError(const FSourceChannel& Channel, const FVector& Decoded, int32 FrameIndex)
+	{
+		if (Channel.Type == Channel_Rotation)
+		{
+			const FQuat DecodedRotation = FSegmentedUtils::QuatFromXYZ(Decoded).GetNormalized();
+			const float Dot = FMath::Min(FMath::Abs(DecodedRotation | Channel.Rotations[FrameIndex]), 1.0f);
+			return 2.0f * FMath::Acos(Dot);
+		}
+		return (Decoded - Channel.Values[FrameIndex]).GetAbsMax();
+	}
+
+	/** Picks the segment range and the fewest bits that keep every frame of the segment within Tolerance */
+	static FSegmentChannelEncoding EncodeSegmentChannel(const FSourceChannel& Channel, int32 FirstFrame, int32 NumFrames, float Tolerance)
+	{
+		FSegmentChannelEncoding Encoding;
+		for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+		{
+			float MinNormalized = 1.0f;
+			float MaxNormalized = 0.0f;
+			for (int32 FrameIndex = FirstFrame; FrameIndex < FirstFrame + NumFrames; ++FrameIndex)
+			{
+				const float Normalized = GetSequenceNormalized(Channel, FrameIndex, ComponentIndex);
+				MinNormalized = FMath::Min(MinNormalized, Normalized);
+				MaxNormalized = FMath::Max(MaxNormalized, Normalized);
+			}
+			const int32 RangeMin = FMath::Clamp(FMath::FloorToInt(MinNormalized * FSegmentedUtils::SegmentRangeMax), 0, FSegmentedUtils::SegmentRangeMax);
+			const int32 RangeMax = FMath::Clamp(FMath::CeilToInt(MaxNormalized * FSegmentedUtils::SegmentRangeMax), RangeMin, FSegmentedUtils::SegmentRangeMax);
+			Encoding.RangeMin[ComponentIndex] = (uint16)RangeMin;
+			Encoding.RangeExtent[ComponentIndex] = (uint16)(RangeMax - RangeMin);
+		}
+
+		for (int32 RateIndex = 0; RateIndex < ARRAY_COUNT(BitRates); ++RateIndex)
+		{
+			Encoding.NumBits = BitRates[RateIndex];
+
+			float MaxError = 0.0f;
+			for (int32 FrameIndex = FirstFrame; FrameIndex < FirstFrame + NumFrames && MaxError <= Tolerance; ++FrameIndex)
+			{
+				MaxError = FMath::Max(MaxError, GetFrameError(Channel, DecodeFrame(Channel, Encoding, FrameIndex), FrameIndex));
+			}
+			if (MaxError <= Tolerance)
+			{
+				break;
+			}
+		}
+		return Encoding;
+	}
+
+	template<typename T>
+	static int32 AppendToStream(TArray<uint8>& Stream, const T& Value)
+	{
+		const int32 Offset = Stream.AddUninitialized(sizeof(T));
+		FMemory::Memcpy(Stream.GetData() + Offset, &Value, sizeof(T));
+		return Offset;
+	}
+
+	/**
+	 * Splits the raw animation into channels, ordered by track then type. Constant identity channels are dropped.
+	 * Animated channels are numbered translations first, then rotations, then scales.
+	 */
+	static void GatherChannels(const UAnimSequence* AnimSeq, const TArray<FTranslationTrack>& TranslationData, const TArray<FRotationTrack>& RotationData, const TArray<FScaleTrack>& ScaleData, TArray<FSourceChannel>& OutChannels, int32& OutNumAnimatedChannels)
+	{
+		const int32 NumTracks = TranslationData.Num();
+		const int32 NumFrames = AnimSeq->NumFrames;
+
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+		{
+			for (int32 ChannelType = 0; ChannelType < Channel_MAX; ++ChannelType)
+			{
+				if (ChannelType == Channel_Scale && ScaleData.Num() == 0)
+				{
+					continue;
+				}
+
+				FSourceChannel Channel;
+				Channel.Type = (EChannelType)ChannelType;
+				Channel.TrackIndex = TrackIndex;
+				Channel.AnimatedChannelIndex = INDEX_NONE;
+
+				int32 NumKeys = 0;
+				bool bIsIdentity = false;
+				if (ChannelType == Channel_Translation)
+				{
+					const TArray<FVector>& Keys = TranslationData[TrackIndex].PosKeys;
+					NumKeys = Keys.Num();
+					bIsIdentity = NumKeys == 1 && Keys[0].IsNearlyZero(TRANSLATION_ZEROING_THRESHOLD);
+					Channel.Values = Keys;
+				}
+				else if (ChannelType == Channel_Rotation)
+				{
+					const TArray<FQuat>& Keys = RotationData[TrackIndex].RotKeys;
+					NumKeys = Keys.Num();
+					bIsIdentity = NumKeys == 1 && Keys[0].Equals(FQuat::Identity, QUATERNION_ZEROING_THRESHOLD);
+					for (const FQuat& Key : Keys)
+					{
+						Channel.Rotations.Add(GetPositiveWRotation(Key));
+						Channel.Values.Add(FVector(Channel.Rotations.Last().X, Channel.Rotations.Last().Y, Channel.Rotations.Last().Z));
+					}
+				}
+				else
+				{
+					const TArray<FVector>& Keys = ScaleData[TrackIndex].ScaleKeys;
+					NumKeys = Keys.Num();
+					bIsIdentity = NumKeys == 1 && Keys[0].Equals(FVector(1.0f), SCALE_ZEROING_THRESHOLD);
+					Channel.Values = Keys;
+				}
+
+				if (NumKeys == 0 || bIsIdentity)
+				{
+					Channel.Values.Empty();
+				}
+				else if (NumKeys > 1)
+				{
+					// Key reduction is never applied before this compressor, so animated tracks carry one key per frame
+					check(NumKeys == NumFrames);
+					Channel.SequenceMin = Channel.Values[0];
+					FVector SequenceMax = Channel.Values[0];
+					for (const FVector& Value : Channel.Values)
+					{
+						Channel.SequenceMin = Channel.SequenceMin.ComponentMin(Value);
+						SequenceMax = SequenceMax.ComponentMax(Value);
+					}
+					Channel.SequenceExtent = SequenceMax - Channel.SequenceMin;
+				}
+				OutChannels.Add(Channel);
+			}
+		}
+
+		OutNumAnimatedChannels = 0;
+		for (int32 ChannelType = 0; ChannelType < Channel_MAX; ++ChannelType)
+		{
+			for (FSourceChannel& Channel : OutChannels)
+			{
+				if (Channel.Type == ChannelType && Channel.Values.Num() > 1)
+				{
+					Channel.AnimatedChannelIndex = OutNumAnimatedChannels++;
+				}
+			}
+		}
+	}
+
+	/** Writes the compressed stream and track offsets of AnimSeq, scaling every local tolerance by ToleranceScale */
+	static void EncodeSequence(UAnimSequence* AnimSeq, const TArray<FSourceChannel>& Channels, int32 NumTracks, bool bHasScale, int32 NumAnimatedChannels, int32 FramesPerSegment, const float (&Tolerances)[Channel_MAX], float ToleranceScale)
+	{
+		AnimSeq->CompressedTrackOffsets.Empty(NumTracks * 2);
+		AnimSeq->CompressedTrackOffsets.AddUninitialized(NumTracks * 2);
+		AnimSeq->CompressedScaleOffsets.Empty(0);
+		if (bHasScale)
+		{
+			AnimSeq->CompressedScaleOffsets.SetStripSize(1);
+			AnimSeq->CompressedScaleOffsets.AddUninitialized(NumTracks);
+		}
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+		{
+			AnimSeq->CompressedTrackOffsets[TrackIndex * 2 + 0] = INDEX_NONE;
+			AnimSeq->CompressedTrackOffsets[TrackIndex * 2 + 1] = INDEX_NONE;
+			if (bHasScale)
+			{
+				AnimSeq->CompressedScaleOffsets.SetOffsetData(TrackIndex, 0, INDEX_NONE);
+			}
+		}
+
+		TArray<uint8>& Stream = AnimSeq->CompressedByteStream;
+		Stream.Empty();
+
+		// Header, the segment offsets are filled in below
+		FSegmentedUtils::FStreamHeader Header;
+		Header.NumSegments = NumAnimatedChannels > 0 ? FSegmentedUtils::GetNumSegments(AnimSeq->NumFrames, FramesPerSegment) : 0;
+		Header.FramesPerSegment = FramesPerSegment;
+		Header.NumAnimatedChannels = NumAnimatedChannels;
+		AppendToStream(Stream, Header);
+		const int32 SegmentOffsetsOffset = Stream.AddZeroed(Header.NumSegments * sizeof(int32));
+
+		// Channel descriptors
+		TArray<const FSourceChannel*> AnimatedChannels;
+		AnimatedChannels.AddZeroed(NumAnimatedChannels);
+		for (const FSourceChannel& Channel : Channels)
+		{
+			if (Channel.Values.Num() == 0)
+			{
+				continue;
+			}
+
+			FSegmentedUtils::FChannelDescriptor Descriptor;
+			FMemory::Memzero(Descriptor);
+			Descriptor.AnimatedChannelIndex = Channel.AnimatedChannelIndex;
+			if (Channel.AnimatedChannelIndex == INDEX_NONE)
+			{
+				if (Channel.Type == Channel_Rotation)
+				{
+					const FQuat& Rotation = Channel.Rotations[0];
+					Descriptor.Values[0] = Rotation.X;
+					Descriptor.Values[1] = Rotation.Y;
+					Descriptor.Values[2] = Rotation.Z;
+					Descriptor.Values[3] = Rotation.W;
+				}
+				else
+				{
+					Descriptor.Values[0] = Channel.Values[0].X;
+					Descriptor.Values[1] = Channel.Values[0].Y;
+					Descriptor.Values[2] = Channel.Values[0].Z;
+				}
+			}
+			else
+			{
+				AnimatedChannels[Channel.AnimatedChannelIndex] = &Channel;
+				for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+				{
+					Descriptor.Values[ComponentIndex] = Channel.SequenceMin[ComponentIndex];
+					Descriptor.Values[ComponentIndex + 3] = Channel.SequenceExtent[ComponentIndex];
+				}
+			}
+
+			const int32 Offset = AppendToStream(Stream, Descriptor);
+			if (Channel.Type == Channel_Scale)
+			{
+				AnimSeq->CompressedScaleOffsets.SetOffsetData(Channel.TrackIndex, 0, Offset);
+			}
+			else
+			{
+				AnimSeq->CompressedTrackOffsets[Channel.TrackIndex * 2 + Channel.Type] = Offset;
+			}
+		}
+
+		// Segments
+		TArray<FSegmentChannelEncoding> Encodings;
+		Encodings.AddUninitialized(NumAnimatedChannels);
+		for (int32 SegmentIndex = 0; SegmentIndex < Header.NumSegments; ++SegmentIndex)
+		{
+			const int32 FirstFrame = SegmentIndex * FramesPerSegment;
+			const int32 NumFrames = FSegmentedUtils::GetNumFramesInSegment(AnimSeq->NumFrames, FramesPerSegment, SegmentIndex);
+
+			FSegmentedUtils::FSegmentHeader SegmentHeader;
+			SegmentHeader.FrameBits = 0;
+			for (int32 ChannelIndex = 0; ChannelIndex < NumAnimatedChannels; ++ChannelIndex)
+			{
+				const FSourceChannel& Channel = *AnimatedChannels[ChannelIndex];
+				Encodings[ChannelIndex] = EncodeSegmentChannel(Channel, FirstFrame, NumFrames, Tolerances[Channel.Type] * ToleranceScale);
+				SegmentHeader.FrameBits += 3 * Encodings[ChannelIndex].NumBits;
+			}
+
+			const int32 SegmentOffset = Stream.Num();
+			check(SegmentOffset % 4 == 0);
+			FMemory::Memcpy(Stream.GetData() + SegmentOffsetsOffset + SegmentIndex * sizeof(int32), &SegmentOffset, sizeof(int32));
+			AppendToStream(Stream, SegmentHeader);
+
+			uint32 ChannelBitOffset = 0;
+			for (int32 ChannelIndex = 0; ChannelIndex < NumAnimatedChannels; ++ChannelIndex)
+			{
+				const FSegmentChannelEncoding& Encoding = Encodings[ChannelIndex];
+				FSegmentedUtils::FSegmentChannel SegmentChannel;
+				for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+				{
+					SegmentChannel.RangeMin[ComponentIndex] = Encoding.RangeMin[ComponentIndex];
+					SegmentChannel.RangeExtent[ComponentIndex] = Encoding.RangeExtent[ComponentIndex];
+				}
+				SegmentChannel.BitOffsetAndRate = (ChannelBitOffset << 8) | (uint32)Encoding.NumBits;
+				AppendToStream(Stream, SegmentChannel);
+				ChannelBitOffset += 3 * Encoding.NumBits;
+			}
+
+			const int32 RowBytes = (int32)((NumFrames * SegmentHeader.FrameBits + 7) / 8);
+			const int32 RowsOffset = Stream.AddZeroed(Align(RowBytes, 4));
+			uint8* Rows = Stream.GetData() + RowsOffset;
+			uint32 BitOffset = 0;
+			for (int32 FrameIndex = FirstFrame; FrameIndex < FirstFrame + NumFrames; ++FrameIndex)
+			{
+				for (int32 ChannelIndex = 0; ChannelIndex < NumAnimatedChannels; ++ChannelIndex)
+				{
+					const FSourceChannel& Channel = *AnimatedChannels[ChannelIndex];
+					const FSegmentChannelEncoding& Encoding = Encodings[ChannelIndex];
+					for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+					{
+						const uint32 Quantized = QuantizeComponent(GetSequenceNormalized(Channel, FrameIndex, ComponentIndex), Encoding.RangeMin[ComponentIndex], Encoding.RangeExtent[ComponentIndex], Encoding.NumBits);
+						FSegmentedUtils::WriteBits(Rows, BitOffset, Quantized, Encoding.NumBits);
+						BitOffset += Encoding.NumBits;
+					}
+				}
+			}
+		}
+
+		Stream.AddZeroed(FSegmentedUtils::StreamTailPadding);
+	}
+}
+
+UAnimCompress_SegmentedVariableBitRate::UAnimCompress_SegmentedVariableBitRate(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Description = TEXT("Segmented Variable Bit Rate");
+	bNeedsSkeleton = true;
+	MaxEndEffectorError = 1.0f;
+	FramesPerSegment = 16;
+	MaxTranslationError = 0.01f;
+	MaxRotationError = 0.0005f;
+	MaxScaleError = 0.0001f;
+	ToleranceSearchIterations = 8;
+}
+
+void UAnimCompress_SegmentedVariableBitRate::DoReduction(UAnimSequence* AnimSeq, const TArray<FBoneData>& BoneData)
+{
+#if WITH_EDITORONLY_DATA
+	using namespace SegmentedVariableBitRate;
+
+	// split the raw data into tracks
+	TArray<FTranslationTrack> TranslationData;
+	TArray<FRotationTrack> RotationData;
+	TArray<FScaleTrack> ScaleData;
+	SeparateRawDataIntoTracks( AnimSeq->RawAnimationData, AnimSeq->SequenceLength, TranslationData, RotationData, ScaleData );
+
+	// Remove Translation Keys from tracks marked bAnimRotationOnly
+	FilterAnimRotationOnlyKeys(TranslationData, AnimSeq);
+
+	// remove obviously redundant keys from the source data
+	FilterTrivialKeys(TranslationData, RotationData, ScaleData, TRANSLATION_ZEROING_THRESHOLD, QUATERNION_ZEROING_THRESHOLD, SCALE_ZEROING_THRESHOLD);
+
+	// record the proper runtime decompressor to use
+	AnimSeq->KeyEncodingFormat = AKF_SegmentedVariableBitRate;
+	AnimSeq->RotationCompressionFormat = ACF_Identity;
+	AnimSeq->TranslationCompressionFormat = ACF_Identity;
+	AnimSeq->ScaleCompressionFormat = ACF_Identity;
+	AnimationFormat_SetInterfaceLinks(*AnimSeq);
+
+	check(TranslationData.Num() == RotationData.Num());
+	const int32 NumTracks = TranslationData.Num();
+	const bool bHasScale = ScaleData.Num() > 0;
+
+	TArray<FSourceChannel> Channels;
+	int32 NumAnimatedChannels = 0;
+	GatherChannels(AnimSeq, TranslationData, RotationData, ScaleData, Channels, NumAnimatedChannels);
+
+	const int32 SegmentSize = FMath::Clamp(FramesPerSegment, 2, 256);
+	const float Tolerances[Channel_MAX] = { MaxTranslationError, MaxRotationError, MaxScaleError };
+
+	// Search for the largest tolerance scale that keeps the end effectors within MaxEndEffectorError:
+	// grow it geometrically until the error bound is exceeded, then bisect between the last passing and failing scales
+	float PassingScale = 0.0f;
+	float FailingScale = 0.0f;
+	float ToleranceScale = 1.0f;
+	for (int32 Iteration = 0; Iteration < ToleranceSearchIterations && NumAnimatedChannels > 0; ++Iteration)
+	{
+		EncodeSequence(AnimSeq, Channels, NumTracks, bHasScale, NumAnimatedChannels, SegmentSize, Tolerances, ToleranceScale);
+
+		AnimationErrorStats ErrorStats;
+		FAnimationUtils::ComputeCompressionError(AnimSeq, BoneData, ErrorStats);
+		if (ErrorStats.MaxError <= MaxEndEffectorError)
+		{
+			PassingScale = ToleranceScale;
+			ToleranceScale = FailingScale > 0.0f ? FMath::Sqrt(PassingScale * FailingScale) : ToleranceScale * 2.0f;
+		}
+		else
+		{
+			FailingScale = ToleranceScale;
+			ToleranceScale = PassingScale > 0.0f ? FMath::Sqrt(PassingScale * FailingScale) : ToleranceScale * 0.5f;
+		}
+	}
+
+	// A scale of zero keeps every channel at the highest bit rate when nothing passed
+	EncodeSequence(AnimSeq, Channels, NumTracks, bHasScale, NumAnimatedChannels, SegmentSize, Tolerances, PassingScale);
+
+	AnimSeq->CompressionScheme = static_cast<UAnimCompress*>( StaticDuplicateObject( this, AnimSeq, TEXT("None")) );
+#endif // WITH_EDITORONLY_DATA
+}
@@ -14,6 +14,7 @@
 #include "AnimEncoding_ConstantKeyLerp.h"
 #include "AnimEncoding_VariableKeyLerp.h"
 #include "AnimEncoding_PerTrackCompression.h"
+#include "AnimEncoding_SegmentedVariableBitRate.h"
 
 /** Each CompresedTranslationData track's ByteStream will be byte swapped in chunks of this size. */
 const int32 CompressedTranslationStrides[ACF_MAX] =
@@ -461,7 +462,12 @@ void AnimationFormat_GetStats(
 	int32& NumRotTracksWithOneKey, 
 	int32& NumScaleTracksWithOneKey)
 {
-	if (Seq)
+	if (Seq && Seq->KeyEncodingFormat == AKF_SegmentedVariableBitRate)
+	{
+		AEFSegmentedVariableBitRateCodec::GetStats(*Seq, NumTransTracks, NumRotTracks, NumScaleTracks, TotalNumTransKeys, TotalNumRotKeys, TotalNumScaleKeys,
+			TranslationKeySize, RotationKeySize, ScaleKeySize, OverheadSize, NumTransTracksWithOneKey, NumRotTracksWithOneKey, NumScaleTracksWithOneKey);
+	}
+	else if (Seq)
 	{
 		OverheadSize = Seq->CompressedTrackOffsets.Num() * sizeof(int32);
 		const size_t KeyFrameLookupSize = (Seq->NumFrames > 0xFF) ? sizeof(uint16) : sizeof(uint8);
@@ -872,6 +878,18 @@ void AnimationFormat_SetInterfaceLinks(UAnimSequence& Seq)
 		// is called in Serialize where GetLinker is too early to call
 		//checkf(Seq.ScaleCompressionFormat == ACF_Identity);
 	}
+	else if (Seq.KeyEncodingFormat == AKF_SegmentedVariableBitRate)
+	{
+		static AEFSegmentedVariableBitRateCodec StaticCodec;
+
+		Seq.RotationCodec = &StaticCodec;
+		Seq.TranslationCodec = &StaticCodec;
+		Seq.ScaleCodec = &StaticCodec;
+
+		checkf(Seq.RotationCompressionFormat == ACF_Identity);
+		checkf(Seq.TranslationCompressionFormat == ACF_Identity);
+		checkf(Seq.ScaleCompressionFormat == ACF_Identity);
+	}
 	else
 	{
 		UE_LOG(LogAnimationCompression, Fatal, TEXT("%i: unknown or unsupported animation format"), (int32)Seq.KeyEncodingFormat );
@@ -0,0 +1,419 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimEncoding_SegmentedVariableBitRate.cpp: Segmented variable bit rate decompressor
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "AnimationCompression.h"
+#include "AnimEncoding_SegmentedVariableBitRate.h"
+
+typedef FAnimationCompression_SegmentedUtils FSegmentedUtils;
+
+/** Decompresses the three components of an animated channel for one frame */
+static FORCEINLINE FVector DecompressSegmentedChannelFrame(
+	const FSegmentedUtils::FChannelDescriptor& Descriptor,
+	const FSegmentedUtils::FSegmentChannel* RESTRICT Channels,
+	const uint8* RESTRICT FrameRows,
+	uint32 RowBitOffset)
+{
+	const FSegmentedUtils::FSegmentChannel& Channel = Channels[Descriptor.AnimatedChannelIndex];
+	const int32 NumBits = Channel.BitOffsetAndRate & 0xFF;
+	uint32 BitOffset = RowBitOffset + (Channel.BitOffsetAndRate >> 8);
+
+	FVector Result;
+	for (int32 ComponentIndex = 0; ComponentIndex < 3; ++ComponentIndex)
+	{
+		const uint32 Quantized = FSegmentedUtils::ReadBits(FrameRows, BitOffset, NumBits);
+		BitOffset += NumBits;
+		Result[ComponentIndex] = FSegmentedUtils::DecodeComponent(Quantized, NumBits, Channel.RangeMin[ComponentIndex], Channel.RangeExtent[ComponentIndex], Descriptor.Values[ComponentIndex], Descriptor.Values[ComponentIndex + 3]);
+	}
+	return Result;
+}
+
+/** Swaps one 32 bit value and returns it in native byte order */
+static int32 ByteSwapSegmentedInt32(FMemoryArchive& MemoryStream, uint8*& Data)
+{
+	int32 Value = 0;
+	if (!MemoryStream.IsLoading())
+	{
+		FMemory::Memcpy(&Value, Data, sizeof(int32));
+	}
+	AC_UnalignedSwap(MemoryStream, Data, sizeof(int32));
+	if (MemoryStream.IsLoading())
+	{
+		FMemory::Memcpy(&Value, Data - sizeof(int32), sizeof(int32));
+	}
+	return Value;
+}
+
+void AEFSegmentedVariableBitRateCodec::ByteSwapStream(UAnimSequence& Seq, FMemoryArchive& MemoryStream)
+{
+	uint8* StreamBase = Seq.CompressedByteStream.GetData();
+	uint8* Data = StreamBase;
+
+	// Stream header and segment table
+	const int32 NumSegments = ByteSwapSegmentedInt32(MemoryStream, Data);
+	const int32 FramesPerSegment = ByteSwapSegmentedInt32(MemoryStream, Data);
+	const int32 NumAnimatedChannels = ByteSwapSegmentedInt32(MemoryStream, Data);
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+	{
+		AC_UnalignedSwap(MemoryStream, Data, sizeof(int32));
+	}
+
+	// Channel descriptors, in the order the compressor wrote them
+	const int32 NumTracks = Seq.CompressedTrackOffsets.Num() / 2;
+	const bool bHasScaleData = Seq.CompressedScaleOffsets.IsValid();
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		const int32 Offsets[3] =
+		{
+			Seq.CompressedTrackOffsets[TrackIndex * 2 + 0],
+			Seq.CompressedTrackOffsets[TrackIndex * 2 + 1],
+			bHasScaleData ? Seq.CompressedScaleOffsets.GetOffsetData(TrackIndex, 0) : INDEX_NONE
+		};
+		for (int32 ChannelType = 0; ChannelType < 3; ++ChannelType)
+		{
+			if (Offsets[ChannelType] != INDEX_NONE)
+			{
+				checkSlow(Data == StreamBase + Offsets[ChannelType]);
+				AC_UnalignedSwap(MemoryStream, Data, sizeof(int32));
+				for (int32 ValueIndex = 0; ValueIndex < 6; ++ValueIndex)
+				{
+					AC_UnalignedSwap(MemoryStream, Data, sizeof(float));
+				}
+			}
+		}
+	}
+
+	// Segments
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+	{
+		const uint32 FrameBits = (uint32)ByteSwapSegmentedInt32(MemoryStream, Data);
+		for (int32 ChannelIndex = 0; ChannelIndex < NumAnimatedChannels; ++ChannelIndex)
+		{
+			for (int32 RangeIndex = 0; RangeIndex < 6; ++RangeIndex)
+			{
+				AC_UnalignedSwap(MemoryStream, Data, sizeof(uint16));
+			}
+			AC_UnalignedSwap(MemoryStream, Data, sizeof(uint32));
+		}
+
+		// The frame rows are a bit stream and have no byte order, followed by padding to keep the next segment aligned
+		const int32 NumFrames = FSegmentedUtils::GetNumFramesInSegment(Seq.NumFrames, FramesPerSegment, SegmentIndex);
+		const int32 RowBytes = (int32)((NumFrames * FrameBits + 7) / 8);
+		const int32 PadBytes = Align(RowBytes, 4) - RowBytes;
+		MemoryStream.Serialize(Data, RowBytes + PadBytes);
+		Data += RowBytes + PadBytes;
+	}
+
+	MemoryStream.Serialize(Data, FSegmentedUtils::StreamTailPadding);
+	Data += FSegmentedUtils::StreamTailPadding;
+	checkSlow(Data == StreamBase + Seq.CompressedByteStream.Num());
+}
+
+void AEFSegmentedVariableBitRateCodec::ByteSwapIn(UAnimSequence& Seq, FMemoryReader& MemoryReader)
+{
+	const int32 OriginalNumBytes = MemoryReader.TotalSize();
+	Seq.CompressedByteStream.Empty(OriginalNumBytes);
+	Seq.CompressedByteStream.AddUninitialized(OriginalNumBytes);
+
+	if (OriginalNumBytes > 0)
+	{
+		ByteSwapStream(Seq, MemoryReader);
+	}
+}
+
+void AEFSegmentedVariableBitRateCodec::ByteSwapOut(UAnimSequence& Seq, TArray<uint8>& SerializedData, bool ForceByteSwapping)
+{
+	FMemoryWriter MemoryWriter(SerializedData, true);
+	MemoryWriter.SetByteSwapping(ForceByteSwapping);
+
+	if (Seq.CompressedByteStream.Num() > 0)
+	{
+		ByteSwapStream(Seq, MemoryWriter);
+	}
+}
+
+void AEFSegmentedVariableBitRateCodec::GetFrameSample(const UAnimSequence& Seq, float Time, FFrameSample& OutSample)
+{
+	const uint8* Stream = Seq.CompressedByteStream.GetData();
+	const FSegmentedUtils::FStreamHeader& Header = *(const FSegmentedUtils::FStreamHeader*)Stream;
+
+	if (Header.NumSegments == 0)
+	{
+		// Only constant channels
+		FMemory::Memzero(OutSample);
+		return;
+	}
+
+	int32 FrameIndices[2];
+	OutSample.Alpha = TimeToIndex(Seq, Time / Seq.SequenceLength, Seq.NumFrames, FrameIndices[0], FrameIndices[1]);
+	OutSample.bInterpolate = FrameIndices[0] != FrameIndices[1];
+
+	const int32* SegmentOffsets = FSegmentedUtils::GetSegmentOffsets(Stream);
+	for (int32 SampleIndex = 0; SampleIndex < 2; ++SampleIndex)
+	{
+		const int32 SegmentIndex = FrameIndices[SampleIndex] / Header.FramesPerSegment;
+		const uint8* Segment = Stream + SegmentOffsets[SegmentIndex];
+		const uint32 FrameBits = ((const FSegmentedUtils::FSegmentHeader*)Segment)->FrameBits;
+
+		OutSample.Channels[SampleIndex] = FSegmentedUtils::GetSegmentChannels(Segment);
+		OutSample.FrameRows[SampleIndex] = FSegmentedUtils::GetSegmentFrameRows(Segment, Header.NumAnimatedChannels);
+		OutSample.RowBitOffset[SampleIndex] = (FrameIndices[SampleIndex] - SegmentIndex * Header.FramesPerSegment) * FrameBits;
+	}
+}
+
+FVector AEFSegmentedVariableBitRateCodec::DecompressVector(const uint8* RESTRICT Stream, int32 Offset, const FFrameSample& Sample)
+{
+	const FSegmentedUtils::FChannelDescriptor& Descriptor = *(const FSegmentedUtils::FChannelDescriptor*)(Stream + Offset);
+	if (Descriptor.AnimatedChannelIndex == INDEX_NONE)
+	{
+		return FVector(Descriptor.Values[0], Descriptor.Values[1], Descriptor.Values[2]);
+	}
+
+	const FVector V0 = DecompressSegmentedChannelFrame(Descriptor, Sample.Channels[0], Sample.FrameRows[0], Sample.RowBitOffset[0]);
+	if (!Sample.bInterpolate)
+	{
+		return V0;
+	}
+
+	const FVector V1 = DecompressSegmentedChannelFrame(Descriptor, Sample.Channels[1], Sample.FrameRows[1], Sample.RowBitOffset[1]);
+	return FMath::Lerp(V0, V1, Sample.Alpha);
+}
+
+FQuat AEFSegmentedVariableBitRateCodec::DecompressRotation(const uint8* RESTRICT Stream, int32 Offset, const FFrameSample& Sample)
+{
+	const FSegmentedUtils::FChannelDescriptor& Descriptor = *(const FSegmentedUtils::FChannelDescriptor*)(Stream + Offset);
+	if (Descriptor.AnimatedChannelIndex == INDEX_NONE)
+	{
+		return FQuat(Descriptor.Values[0], Descriptor.Values[1], Descriptor.Values[2], Descriptor.Values[3]);
+	}
+
+	FQuat R0 = FSegmentedUtils::QuatFromXYZ(DecompressSegmentedChannelFrame(Descriptor, Sample.Channels[0], Sample.FrameRows[0], Sample.RowBitOffset[0]));
+	if (Sample.bInterpolate)
+	{
+		const FQuat R1 = FSegmentedUtils::QuatFromXYZ(DecompressSegmentedChannelFrame(Descriptor, Sample.Channels[1], Sample.FrameRows[1], Sample.RowBitOffset[1]));
+
+		// Fast linear quaternion interpolation.
+		// To ensure the 'shortest route', we make sure the dot product between the two keys is positive.
+		const float DotResult = (R0 | R1);
+		const float Bias = FMath::FloatSelect(DotResult, 1.0f, -1.0f);
+		R0 = (R0 * (1.f - Sample.Alpha)) + (R1 * (Sample.Alpha * Bias));
+	}
+	R0.Normalize();
+	return R0;
+}
+
+/**
+ * Extracts a single BoneAtom from an Animation Sequence.
+ *
+ * @param	OutAtom			The BoneAtom to fill with the extracted result.
+ * @param	Seq				An Animation Sequence to extract the BoneAtom from.
+ * @param	TrackIndex		The index of the track desired in the Animation Sequence.
+ * @param	Time			The time (in seconds) to calculate the BoneAtom for.
+ */
+void AEFSegmentedVariableBitRateCodec::GetBoneAtom(
+	FTransform& OutAtom,
+	const UAnimSequence& Seq,
+	int32 TrackIndex,
+	float Time)
+{
+	// Initialize to identity to set the scale and in case of a missing rotation or translation channel
+	OutAtom.SetIdentity();
+
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const uint8* RESTRICT Stream = Seq.CompressedByteStream.GetData();
+	const int32 TransOffset = Seq.CompressedTrackOffsets[TrackIndex * 2 + 0];
+	const int32 RotOffset = Seq.CompressedTrackOffsets[TrackIndex * 2 + 1];
+
+	if (TransOffset != INDEX_NONE)
+	{
+		OutAtom.SetTranslation(DecompressVector(Stream, TransOffset, Sample));
+	}
+	if (RotOffset != INDEX_NONE)
+	{
+		OutAtom.SetRotation(DecompressRotation(Stream, RotOffset, Sample));
+	}
+	if (Seq.CompressedScaleOffsets.IsValid())
+	{
+		const int32 ScaleOffset = Seq.CompressedScaleOffsets.GetOffsetData(TrackIndex, 0);
+		if (ScaleOffset != INDEX_NONE)
+		{
+			OutAtom.SetScale3D(DecompressVector(Stream, ScaleOffset, Sample));
+		}
+	}
+}
+
+#if USE_ANIMATION_CODEC_BATCH_SOLVER
+
+/**
+ * Decompress all requested rotation components from an Animation Sequence
+ *
+ * @param	Atoms			The FTransform array to fill in.
+ * @param	DesiredPairs	Array of requested bone information
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @return					None.
+ */
+void AEFSegmentedVariableBitRateCodec::GetPoseRotations(
+	FTransformArray& Atoms,
+	const BoneTrackArray& DesiredPairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const uint8* RESTRICT Stream = Seq.CompressedByteStream.GetData();
+	const int32 PairCount = DesiredPairs.Num();
+	for (int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
+		const int32 RotOffset = Seq.CompressedTrackOffsets[Pair.TrackIndex * 2 + 1];
+		Atoms[Pair.AtomIndex].SetRotation(RotOffset != INDEX_NONE ? DecompressRotation(Stream, RotOffset, Sample) : FQuat::Identity);
+	}
+}
+
+/**
+ * Decompress all requested translation components from an Animation Sequence
+ *
+ * @param	Atoms			The FTransform array to fill in.
+ * @param	DesiredPairs	Array of requested bone information
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @return					None.
+ */
+void AEFSegmentedVariableBitRateCodec::GetPoseTranslations(
+	FTransformArray& Atoms,
+	const BoneTrackArray& DesiredPairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const uint8* RESTRICT Stream = Seq.CompressedByteStream.GetData();
+	const int32 PairCount = DesiredPairs.Num();
+	for (int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
+		const int32 TransOffset = Seq.CompressedTrackOffsets[Pair.TrackIndex * 2 + 0];
+		Atoms[Pair.AtomIndex].SetTranslation(TransOffset != INDEX_NONE ? DecompressVector(Stream, TransOffset, Sample) : FVector::ZeroVector);
+	}
+}
+
+/**
+ * Decompress all requested Scale components from an Animation Sequence
+ *
+ * @param	Atoms			The FTransform array to fill in.
+ * @param	DesiredPairs	Array of requested bone information
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @return					None.
+ */
+void AEFSegmentedVariableBitRateCodec::GetPoseScales(
+	FTransformArray& Atoms,
+	const BoneTrackArray& DesiredPairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	check(Seq.CompressedScaleOffsets.IsValid());
+
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const uint8* RESTRICT Stream = Seq.CompressedByteStream.GetData();
+	const int32 PairCount = DesiredPairs.Num();
+	for (int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
+		const int32 ScaleOffset = Seq.CompressedScaleOffsets.GetOffsetData(Pair.TrackIndex, 0);
+		Atoms[Pair.AtomIndex].SetScale3D(ScaleOffset != INDEX_NONE ? DecompressVector(Stream, ScaleOffset, Sample) : FVector(1.0f));
+	}
+}
+
+#endif // USE_ANIMATION_CODEC_BATCH_SOLVER
+
+void AEFSegmentedVariableBitRateCodec::GetStats(
+	const UAnimSequence& Seq,
+	int32& NumTransTracks,
+	int32& NumRotTracks,
+	int32& NumScaleTracks,
+	int32& TotalNumTransKeys,
+	int32& TotalNumRotKeys,
+	int32& TotalNumScaleKeys,
+	float& TranslationKeySize,
+	float& RotationKeySize,
+	float& ScaleKeySize,
+	int32& OverheadSize,
+	int32& NumTransTracksWithOneKey,
+	int32& NumRotTracksWithOneKey,
+	int32& NumScaleTracksWithOneKey)
+{
+	NumTransTracks = Seq.CompressedTrackOffsets.Num() / 2;
+	NumRotTracks = NumTransTracks;
+	NumScaleTracks = Seq.CompressedScaleOffsets.GetNumTracks();
+
+	int32* const TotalNumKeys[3] = { &TotalNumTransKeys, &TotalNumRotKeys, &TotalNumScaleKeys };
+	float* const KeySizes[3] = { &TranslationKeySize, &RotationKeySize, &ScaleKeySize };
+	int32* const NumTracksWithOneKey[3] = { &NumTransTracksWithOneKey, &NumRotTracksWithOneKey, &NumScaleTracksWithOneKey };
+	int32 NumTracks[3] = { NumTransTracks, NumRotTracks, NumScaleTracks };
+	int32 TotalBits[3] = { 0, 0, 0 };
+	int32 NumAnimatedKeys[3] = { 0, 0, 0 };
+
+	for (int32 ChannelType = 0; ChannelType < 3; ++ChannelType)
+	{
+		*TotalNumKeys[ChannelType] = 0;
+		*KeySizes[ChannelType] = 0.0f;
+		*NumTracksWithOneKey[ChannelType] = 0;
+	}
+
+	if (Seq.CompressedByteStream.Num() == 0)
+	{
+		OverheadSize = 0;
+		return;
+	}
+
+	const uint8* Stream = Seq.CompressedByteStream.GetData();
+	const FSegmentedUtils::FStreamHeader& Header = *(const FSegmentedUtils::FStreamHeader*)Stream;
+	const int32* SegmentOffsets = FSegmentedUtils::GetSegmentOffsets(Stream);
+
+	for (int32 ChannelType = 0; ChannelType < 3; ++ChannelType)
+	{
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks[ChannelType]; ++TrackIndex)
+		{
+			const int32 Offset = (ChannelType < 2) ? Seq.CompressedTrackOffsets[TrackIndex * 2 + ChannelType] : Seq.CompressedScaleOffsets.GetOffsetData(TrackIndex, 0);
+			const int32 AnimatedChannelIndex = (Offset != INDEX_NONE) ? ((const FSegmentedUtils::FChannelDescriptor*)(Stream + Offset))->AnimatedChannelIndex : INDEX_NONE;
+			if (AnimatedChannelIndex == INDEX_NONE)
+			{
+				++(*TotalNumKeys[ChannelType]);
+				++(*NumTracksWithOneKey[ChannelType]);
+				continue;
+			}
+
+			*TotalNumKeys[ChannelType] += Seq.NumFrames;
+			NumAnimatedKeys[ChannelType] += Seq.NumFrames;
+			for (int32 SegmentIndex = 0; SegmentIndex < Header.NumSegments; ++SegmentIndex)
+			{
+				const FSegmentedUtils::FSegmentChannel& Channel = FSegmentedUtils::GetSegmentChannels(Stream + SegmentOffsets[SegmentIndex])[AnimatedChannelIndex];
+				const int32 NumFrames = FSegmentedUtils::GetNumFramesInSegment(Seq.NumFrames, Header.FramesPerSegment, SegmentIndex);
+				TotalBits[ChannelType] += 3 * (Channel.BitOffsetAndRate & 0xFF) * NumFrames;
+			}
+		}
+	}
+
+	// Everything that is not key bits is overhead: descriptors, segment ranges, offsets and padding
+	OverheadSize = Seq.CompressedTrackOffsets.Num() * sizeof(int32) + Seq.CompressedScaleOffsets.GetMemorySize() + Seq.CompressedByteStream.Num();
+	for (int32 ChannelType = 0; ChannelType < 3; ++ChannelType)
+	{
+		const float KeyBytes = TotalBits[ChannelType] / 8.0f;
+		OverheadSize -= FMath::TruncToInt(KeyBytes);
+		if (NumAnimatedKeys[ChannelType] > 0)
+		{
+			*KeySizes[ChannelType] = KeyBytes / NumAnimatedKeys[ChannelType];
+		}
+	}
+}
@@ -0,0 +1,336 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimPoseSoA.cpp: Structure-of-arrays pose buffers and blending kernels
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "AnimPoseSoA.h"
+
+/** Four quaternions, one per lane */
+struct FQuat4
+{
+	VectorRegister X;
+	VectorRegister Y;
+	VectorRegister Z;
+	VectorRegister W;
+
+	FORCEINLINE void Load(const FAnimPoseSoA& Pose, int32 Lane)
+	{
+		X = VectorLoadAligned(Pose.GetStream(FAnimPoseSoA::RotationX) + Lane);
+		Y = VectorLoadAligned(Pose.GetStream(FAnimPoseSoA::RotationY) + Lane);
+		Z = VectorLoadAligned(Pose.GetStream(FAnimPoseSoA::RotationZ) + Lane);
+		W = VectorLoadAligned(Pose.GetStream(FAnimPoseSoA::RotationW) + Lane);
+	}
+
+	FORCEINLINE void Store(FAnimPoseSoA& Pose, int32 Lane) const
+	{
+		VectorStoreAligned(X, Pose.GetStream(FAnimPoseSoA::RotationX) + Lane);
+		VectorStoreAligned(Y, Pose.GetStream(FAnimPoseSoA::RotationY) + Lane);
+		VectorStoreAligned(Z, Pose.GetStream(FAnimPoseSoA::RotationZ) + Lane);
+		VectorStoreAligned(W, Pose.GetStream(FAnimPoseSoA::RotationW) + Lane);
+	}
+
+	FORCEINLINE VectorRegister Dot(const FQuat4& Other) const
+	{
+		return VectorMultiplyAdd(X, Other.X, VectorMultiplyAdd(Y, Other.Y, VectorMultiplyAdd(Z, Other.Z, VectorMultiply(W, Other.W))));
+	}
+
+	/** Same as VectorNormalizeQuaternion: (Q.Q >= 1e-8) ? (Q / |Q|) : (0,0,0,1) */
+	FORCEINLINE void NormalizeSafe()
+	{
+		const VectorRegister SquareSum = Dot(*this);
+		const VectorRegister NonZeroMask = VectorCompareGE(SquareSum, GlobalVectorConstants::SmallLengthThreshold);
+		const VectorRegister InvLength = VectorReciprocalSqrtAccurate(SquareSum);
+		X = VectorSelect(NonZeroMask, VectorMultiply(X, InvLength), VectorZero());
+		Y = VectorSelect(NonZeroMask, VectorMultiply(Y, InvLength), VectorZero());
+		Z = VectorSelect(NonZeroMask, VectorMultiply(Z, InvLength), VectorZero());
+		W = VectorSelect(NonZeroMask, VectorMultiply(W, InvLength), VectorOne());
+	}
+
+	/** Returns A * B, matching VectorQuaternionMultiply2 */
+	static FORCEINLINE FQuat4 Multiply(const FQuat4& A, const FQuat4& B)
+	{
+		FQuat4 Result;
+		Result.X = VectorSubtract(VectorMultiplyAdd(A.W, B.X, VectorMultiplyAdd(A.X, B.W, VectorMultiply(A.Y, B.Z))), VectorMultiply(A.Z, B.Y));
+		Result.Y = VectorSubtract(VectorMultiplyAdd(A.W, B.Y, VectorMultiplyAdd(A.Y, B.W, VectorMultiply(A.Z, B.X))), VectorMultiply(A.X, B.Z));
+		Result.Z = VectorSubtract(VectorMultiplyAdd(A.W, B.Z, VectorMultiplyAdd(A.X, B.Y, VectorMultiply(A.Z, B.W))), VectorMultiply(A.Y, B.X));
+		Result.W = VectorSubtract(VectorMultiply(A.W, B.W), VectorMultiplyAdd(A.X, B.X, VectorMultiplyAdd(A.Y, B.Y, VectorMultiply(A.Z, B.Z))));
+		return Result;
+	}
+};
+
+void FAnimPoseSoA::Init(float* InData, int32 InNumBones)
+{
+	check(((UPTRINT)InData & 15) == 0);
+	Data = InData;
+	NumBones = InNumBones;
+	NumPaddedBones = GetNumPaddedBones(InNumBones);
+
+	for (int32 BoneIndex = NumBones; BoneIndex < NumPaddedBones; ++BoneIndex)
+	{
+		GetStream(RotationX)[BoneIndex] = 0.f;
+		GetStream(RotationY)[BoneIndex] = 0.f;
+		GetStream(RotationZ)[BoneIndex] = 0.f;
+		GetStream(RotationW)[BoneIndex] = 1.f;
+		GetStream(TranslationX)[BoneIndex] = 0.f;
+		GetStream(TranslationY)[BoneIndex] = 0.f;
+		GetStream(TranslationZ)[BoneIndex] = 0.f;
+		GetStream(ScaleX)[BoneIndex] = 1.f;
+		GetStream(ScaleY)[BoneIndex] = 1.f;
+		GetStream(ScaleZ)[BoneIndex] = 1.f;
+	}
+}
+
+void FAnimPoseSoA::Gather(const FTransformArrayA2& Atoms, const TArray<FBoneIndexType>& RequiredBoneIndices)
+{
+	check(RequiredBoneIndices.Num() == NumBones);
+
+	float* RESTRICT RotX = GetStream(RotationX);
+	float* RESTRICT RotY = GetStream(RotationY);
+	float* RESTRICT RotZ = GetStream(RotationZ);
+	float* RESTRICT RotW = GetStream(RotationW);
+	float* RESTRICT TransX = GetStream(TranslationX);
+	float* RESTRICT TransY = GetStream(TranslationY);
+	float* RESTRICT TransZ = GetStream(TranslationZ);
+	float* RESTRICT ScaX = GetStream(ScaleX);
+	float* RESTRICT ScaY = GetStream(ScaleY);
+	float* RESTRICT ScaZ = GetStream(ScaleZ);
+
+	for (int32 Index = 0; Index < NumBones; ++Index)
+	{
+		const FTransform& Atom = Atoms[RequiredBoneIndices[Index]];
+		const FQuat Rotation = Atom.GetRotation();
+		const FVector Translation = Atom.GetTranslation();
+		const FVector Scale3D = Atom.GetScale3D();
+
+		RotX[Index] = Rotation.X;
+		RotY[Index] = Rotation.Y;
+		RotZ[Index] = Rotation.Z;
+		RotW[Index] = Rotation.W;
+		TransX[Index] = Translation.X;
+		TransY[Index] = Translation.Y;
+		TransZ[Index] = Translation.Z;
+		ScaX[Index] = Scale3D.X;
+		ScaY[Index] = Scale3D.Y;
+		ScaZ[Index] = Scale3D.Z;
+	}
+}
+
+void FAnimPoseSoA::Scatter(FTransformArrayA2& Atoms, const TArray<FBoneIndexType>& RequiredBoneIndices) const
+{
+	check(RequiredBoneIndices.Num() == NumBones);
+
+	const float* RotX = GetStream(RotationX);
+	const float* RotY = GetStream(RotationY);
+	const float* RotZ = GetStream(RotationZ);
+	const float* RotW = GetStream(RotationW);
+	const float* TransX = GetStream(TranslationX);
+	const float* TransY = GetStream(TranslationY);
+	const float* TransZ = GetStream(TranslationZ);
+	const float* ScaX = GetStream(ScaleX);
+	const float* ScaY = GetStream(ScaleY);
+	const float* ScaZ = GetStream(ScaleZ);
+
+	for (int32 Index = 0; Index < NumBones; ++Index)
+	{
+		Atoms[RequiredBoneIndices[Index]] = FTransform(
+			FQuat(RotX[Index], RotY[Index], RotZ[Index], RotW[Index]),
+			FVector(TransX[Index], TransY[Index], TransZ[Index]),
+			FVector(ScaX[Index], ScaY[Index], ScaZ[Index]));
+	}
+}
+
+void FAnimPoseSoA::NormalizeRotations()
+{
+	for (int32 Lane = 0; Lane < NumPaddedBones; Lane += 4)
+	{
+		FQuat4 Rotation;
+		Rotation.Load(*this, Lane);
+		Rotation.NormalizeSafe();
+		Rotation.Store(*this, Lane);
+	}
+}
+
+/**
+ * Shared body of the uniform and per bone weighted blends. Each group of four bones is fully accumulated
+ * in registers across all poses before being stored, so the result pose is written exactly once.
+ */
+template<bool bPerBoneWeights>
+static FORCEINLINE void BlendPosesSoAKernel(int32 NumPoses, const FAnimPoseSoA** SourcePoses, const float* SourceWeights, const float** PerBoneWeights, bool bNormalize, FAnimPoseSoA& ResultPose)
+{
+	check(NumPoses > 0);
+	const int32 NumPaddedBones = ResultPose.GetNumPaddedBones();
+
+	for (int32 Lane = 0; Lane < NumPaddedBones; Lane += 4)
+	{
+		FQuat4 Rotation;
+		VectorRegister Translation[3];
+		VectorRegister Scale[3];
+
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			const FAnimPoseSoA& SourcePose = *SourcePoses[PoseIndex];
+			checkSlow(SourcePose.GetNumPaddedBones() == NumPaddedBones);
+
+			const VectorRegister Weight = bPerBoneWeights ? VectorLoadAligned(PerBoneWeights[PoseIndex] + Lane) : VectorLoadFloat1(SourceWeights + PoseIndex);
+
+			FQuat4 SourceRotation;
+			SourceRotation.Load(SourcePose, Lane);
+
+			const VectorRegister SourceTranslationX = VectorLoadAligned(SourcePose.GetStream(FAnimPoseSoA::TranslationX) + Lane);
+			const VectorRegister SourceTranslationY = VectorLoadAligned(SourcePose.GetStream(FAnimPoseSoA::TranslationY) + Lane);
+			const VectorRegister SourceTranslationZ = VectorLoadAligned(SourcePose.GetStream(FAnimPoseSoA::TranslationZ) + Lane);
+			const VectorRegister SourceScaleX = VectorLoadAligned(SourcePose.GetStream(FAnimPoseSoA::ScaleX) + Lane);
+			const VectorRegister SourceScaleY = VectorLoadAligned(SourcePose.GetStream(FAnimPoseSoA::ScaleY) + Lane);
+			const VectorRegister SourceScaleZ = VectorLoadAligned(SourcePose.GetStream(FAnimPoseSoA::ScaleZ) + Lane);
+
+			if (PoseIndex == 0)
+			{
+				// First pose will just overwrite the destination
+				Rotation.X = VectorMultiply(SourceRotation.X, Weight);
+				Rotation.Y = VectorMultiply(SourceRotation.Y, Weight);
+				Rotation.Z = VectorMultiply(SourceRotation.Z, Weight);
+				Rotation.W = VectorMultiply(SourceRotation.W, Weight);
+				Translation[0] = VectorMultiply(SourceTranslationX, Weight);
+				Translation[1] = VectorMultiply(SourceTranslationY, Weight);
+				Translation[2] = VectorMultiply(SourceTranslationZ, Weight);
+				Scale[0] = VectorMultiply(SourceScaleX, Weight);
+				Scale[1] = VectorMultiply(SourceScaleY, Weight);
+				Scale[2] = VectorMultiply(SourceScaleZ, Weight);
+			}
+			else
+			{
+				// Subsequent poses need to be blended in, flipping the weighted rotation if it is on the other hemisphere,
+				// as FTransform::AccumulateWithShortestRotation does
+				FQuat4 BlendedRotation;
+				BlendedRotation.X = VectorMultiply(SourceRotation.X, Weight);
+				BlendedRotation.Y = VectorMultiply(SourceRotation.Y, Weight);
+				BlendedRotation.Z = VectorMultiply(SourceRotation.Z, Weight);
+				BlendedRotation.W = VectorMultiply(SourceRotation.W, Weight);
+
+				const VectorRegister RotationDirMask = VectorCompareGE(Rotation.Dot(BlendedRotation), VectorZero());
+				Rotation.X = VectorAdd(Rotation.X, VectorSelect(RotationDirMask, BlendedRotation.X, VectorNegate(BlendedRotation.X)));
+				Rotation.Y = VectorAdd(Rotation.Y, VectorSelect(RotationDirMask, BlendedRotation.Y, VectorNegate(BlendedRotation.Y)));
+				Rotation.Z = VectorAdd(Rotation.Z, VectorSelect(RotationDirMask, BlendedRotation.Z, VectorNegate(BlendedRotation.Z)));
+				Rotation.W = VectorAdd(Rotation.W, VectorSelect(RotationDirMask, BlendedRotation.W, VectorNegate(BlendedRotation.W)));
+
+				Translation[0] = VectorMultiplyAdd(SourceTranslationX, Weight, Translation[0]);
+				Translation[1] = VectorMultiplyAdd(SourceTranslationY, Weight, Translation[1]);
+				Translation[2] = VectorMultiplyAdd(SourceTranslationZ, Weight, Translation[2]);
+				Scale[0] = VectorMultiplyAdd(SourceScaleX, Weight, Scale[0]);
+				Scale[1] = VectorMultiplyAdd(SourceScaleY, Weight, Scale[1]);
+				Scale[2] = VectorMultiplyAdd(SourceScaleZ, Weight, Scale[2]);
+			}
+		}
+
+		if (bNormalize)
+		{
+			Rotation.NormalizeSafe();
+		}
+
+		Rotation.Store(ResultPose, Lane);
+		VectorStoreAligned(Translation[0], ResultPose.GetStream(FAnimPoseSoA::TranslationX) + Lane);
+		VectorStoreAligned(Translation[1], ResultPose.GetStream(FAnimPoseSoA::TranslationY) + Lane);
+		VectorStoreAligned(Translation[2], ResultPose.GetStream(FAnimPoseSoA::TranslationZ) + Lane);
+		VectorStoreAligned(Scale[0], ResultPose.GetStream(FAnimPoseSoA::ScaleX) + Lane);
+		VectorStoreAligned(Scale[1], ResultPose.GetStream(FAnimPoseSoA::ScaleY) + Lane);
+		VectorStoreAligned(Scale[2], ResultPose.GetStream(FAnimPoseSoA::ScaleZ) + Lane);
+	}
+}
+
+void FAnimPoseSoA::BlendPosesTogether(int32 NumPoses, const FAnimPoseSoA** SourcePoses, const float* SourceWeights, FAnimPoseSoA& ResultPose)
+{
+	// Ensure that all of the resulting rotations are normalized
+	BlendPosesSoAKernel<false>(NumPoses, SourcePoses, SourceWeights, nullptr, NumPoses > 1, ResultPose);
+}
+
+void FAnimPoseSoA::BlendPosesTogetherPerBone(int32 NumPoses, const FAnimPoseSoA** SourcePoses, const float** PerBoneWeights, FAnimPoseSoA& ResultPose)
+{
+	BlendPosesSoAKernel<true>(NumPoses, SourcePoses, nullptr, PerBoneWeights, true, ResultPose);
+}
+
+void FAnimPoseSoA::BlendAdditivePose(const FAnimPoseSoA& SourcePose, const FAnimPoseSoA& AdditivePose, float BlendWeight, FAnimPoseSoA& ResultPose)
+{
+	check(SourcePose.GetNumPaddedBones() == AdditivePose.GetNumPaddedBones() && SourcePose.GetNumPaddedBones() == ResultPose.GetNumPaddedBones());
+
+	const VectorRegister Weight = VectorLoadFloat1(&BlendWeight);
+	const VectorRegister OneMinusWeight = VectorSubtract(VectorOne(), Weight);
+	const VectorRegister NegativeOneMinusWeight = VectorNegate(OneMinusWeight);
+
+	for (int32 Lane = 0; Lane < ResultPose.GetNumPaddedBones(); Lane += 4)
+	{
+		// Blend the additive rotation from identity, see FTransform::BlendFromIdentityAndAccumulate.
+		// Identity only has a W component, so only the sign of the additive W matters for the shortest route.
+		FQuat4 AdditiveRotation;
+		AdditiveRotation.Load(AdditivePose, Lane);
+
+		const VectorRegister RotationDirMask = VectorCompareGE(AdditiveRotation.W, VectorZero());
+		FQuat4 BlendedRotation;
+		BlendedRotation.X = VectorMultiply(AdditiveRotation.X, Weight);
+		BlendedRotation.Y = VectorMultiply(AdditiveRotation.Y, Weight);
+		BlendedRotation.Z = VectorMultiply(AdditiveRotation.Z, Weight);
+		BlendedRotation.W = VectorMultiplyAdd(AdditiveRotation.W, Weight, VectorSelect(RotationDirMask, OneMinusWeight, NegativeOneMinusWeight));
+		BlendedRotation.NormalizeSafe();
+
+		FQuat4 SourceRotation;
+		SourceRotation.Load(SourcePose, Lane);
+
+		FQuat4 Rotation = FQuat4::Multiply(BlendedRotation, SourceRotation);
+		Rotation.NormalizeSafe();
+		Rotation.Store(ResultPose, Lane);
+
+		// Translation += Lerp(Zero, Additive.Translation, Weight), Scale *= Lerp(One, Additive.Scale, Weight)
+		for (int32 Stream = TranslationX; Stream <= TranslationZ; ++Stream)
+		{
+			const VectorRegister Source = VectorLoadAligned(SourcePose.GetStream((EStream)Stream) + Lane);
+			const VectorRegister Additive = VectorLoadAligned(AdditivePose.GetStream((EStream)Stream) + Lane);
+			VectorStoreAligned(VectorMultiplyAdd(Additive, Weight, Source), ResultPose.GetStream((EStream)Stream) + Lane);
+		}
+		for (int32 Stream = ScaleX; Stream <= ScaleZ; ++Stream)
+		{
+			const VectorRegister Source = VectorLoadAligned(SourcePose.GetStream((EStream)Stream) + Lane);
+			const VectorRegister Additive = VectorLoadAligned(AdditivePose.GetStream((EStream)Stream) + Lane);
+			const VectorRegister BlendedScale = VectorMultiplyAdd(VectorSubtract(Additive, VectorOne()), Weight, VectorOne());
+			VectorStoreAligned(VectorMultiply(Source, BlendedScale), ResultPose.GetStream((EStream)Stream) + Lane);
+		}
+	}
+}
+
+void FAnimPoseSoA::ConvertPoseToAdditive(FAnimPoseSoA& TargetPose, const FAnimPoseSoA& BasePose)
+{
+	check(TargetPose.GetNumPaddedBones() == BasePose.GetNumPaddedBones());
+
+	for (int32 Lane = 0; Lane < TargetPose.GetNumPaddedBones(); Lane += 4)
+	{
+		// Rotation = Target.Rotation * Base.Rotation.Inverse()
+		FQuat4 TargetRotation;
+		TargetRotation.Load(TargetPose, Lane);
+		FQuat4 InverseBaseRotation;
+		InverseBaseRotation.Load(BasePose, Lane);
+		InverseBaseRotation.X = VectorNegate(InverseBaseRotation.X);
+		InverseBaseRotation.Y = VectorNegate(InverseBaseRotation.Y);
+		InverseBaseRotation.Z = VectorNegate(InverseBaseRotation.Z);
+
+		FQuat4 Rotation = FQuat4::Multiply(TargetRotation, InverseBaseRotation);
+		Rotation.NormalizeSafe();
+		Rotation.Store(TargetPose, Lane);
+
+		for (int32 Stream = TranslationX; Stream <= TranslationZ; ++Stream)
+		{
+			float* Target = TargetPose.GetStream((EStream)Stream) + Lane;
+			const VectorRegister Base = VectorLoadAligned(BasePose.GetStream((EStream)Stream) + Lane);
+			VectorStoreAligned(VectorSubtract(VectorLoadAligned(Target), Base), Target);
+		}
+
+		// Scale *= Base.GetSafeScaleReciprocal(Base.Scale)
+		for (int32 Stream = ScaleX; Stream <= ScaleZ; ++Stream)
+		{
+			float* Target = TargetPose.GetStream((EStream)Stream) + Lane;
+			const VectorRegister Base = VectorLoadAligned(BasePose.GetStream((EStream)Stream) + Lane);
+			const VectorRegister ZeroScaleMask = VectorCompareGE(VectorZero(), VectorAbs(Base));
+			const VectorRegister SafeReciprocal = VectorSelect(ZeroScaleMask, VectorZero(), VectorReciprocalAccurate(Base));
+			VectorStoreAligned(VectorMultiply(VectorLoadAligned(Target), SafeReciprocal), Target);
+		}
+	}
+}
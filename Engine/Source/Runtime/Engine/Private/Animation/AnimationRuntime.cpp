@@ -8,6 +8,7 @@
 #include "BlueprintUtilities.h"
 #include "AnimEncoding.h"
 #include "AnimationRuntime.h"
+#include "AnimPoseSoA.h"
 #include "AnimationUtils.h"
 #include "Animation/AnimData/BoneMaskFilter.h"
 #include "Animation/BlendSpaceBase.h"
@@ -17,6 +18,50 @@
 DEFINE_LOG_CATEGORY(LogAnimation);
 DEFINE_LOG_CATEGORY(LogRootMotion);
 
+static TAutoConsoleVariable<int32> CVarSoAPoseBlending(
+	TEXT("a.SoAPoseBlending"),
+	0,
+	TEXT("If 1, pose blends, additive blends and additive conversion gather the required bones into structure-of-arrays buffers and run vectorized kernels, four bones at a time. If 0, they process one FTransform at a time."));
+
+//////////////////////////////////////////////////////////////////////////
+
+/** Points Pose at storage for NumBones from the thread's mem stack. The caller must hold an FMemMark. */
+static void AllocatePoseSoA(FAnimPoseSoA& Pose, int32 NumBones)
+{
+	Pose.Init(New<float>(FMemStack::Get(), FAnimPoseSoA::GetRequiredFloats(NumBones), 16), NumBones);
+}
+
+/** Blends the required bones of SourcePoses through SoA buffers, with either one weight per pose or, if PerBoneWeights is set, per bone weights in required bone order */
+static void BlendPosesTogetherSoA(int32 NumPoses, const FTransformArrayA2* const* SourcePoses, const float* SourceWeights, const float** PerBoneWeights, const FBoneContainer& RequiredBones, /*out*/ FTransformArrayA2& ResultAtoms)
+{
+	FMemMark Mark(FMemStack::Get());
+	const TArray<FBoneIndexType>& RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+	const int32 NumBones = RequiredBoneIndices.Num();
+
+	TArray<FAnimPoseSoA, TInlineAllocator<8> > SourcePosesSoA;
+	TArray<const FAnimPoseSoA*, TInlineAllocator<8> > SourcePosePtrs;
+	SourcePosesSoA.AddDefaulted(NumPoses);
+	SourcePosePtrs.AddUninitialized(NumPoses);
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		AllocatePoseSoA(SourcePosesSoA[PoseIndex], NumBones);
+		SourcePosesSoA[PoseIndex].Gather(*SourcePoses[PoseIndex], RequiredBoneIndices);
+		SourcePosePtrs[PoseIndex] = &SourcePosesSoA[PoseIndex];
+	}
+
+	FAnimPoseSoA ResultPose;
+	AllocatePoseSoA(ResultPose, NumBones);
+	if (PerBoneWeights)
+	{
+		FAnimPoseSoA::BlendPosesTogetherPerBone(NumPoses, SourcePosePtrs.GetData(), PerBoneWeights, ResultPose);
+	}
+	else
+	{
+		FAnimPoseSoA::BlendPosesTogether(NumPoses, SourcePosePtrs.GetData(), SourceWeights, ResultPose);
+	}
+	ResultPose.Scatter(ResultAtoms, RequiredBoneIndices);
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 void FAnimationRuntime::NormalizeRotations(const FBoneContainer& RequiredBones, /*inout*/ FTransformArrayA2 & Atoms)
@@ -67,6 +112,12 @@ void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const FTransformArray
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
 	if (ensure(SourcePoses && ResultAtoms.Num() >= RequiredBoneIndices.Num()))
 	{
+		if (CVarSoAPoseBlending.GetValueOnAnyThread() != 0)
+		{
+			BlendPosesTogetherSoA(NumPoses, SourcePoses, SourceWeights, nullptr, RequiredBones, ResultAtoms);
+			return;
+		}
+
 		// debug purpose for now, but this can cause 0 bone transform, so we'd like to catch it 
 		float WeightSum=0.f;
 		for (int32 i = 0; i < NumPoses; ++i)
@@ -121,6 +172,16 @@ void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const TArray<FTransfo
 {
 	check(NumPoses > 0);
 
+	if (CVarSoAPoseBlending.GetValueOnAnyThread() != 0)
+	{
+		TArray<const FTransformArrayA2*, TInlineAllocator<8> > SourcePosePtrs;
+		for (int32 i = 0; i < NumPoses; ++i)
+		{
+			SourcePosePtrs.Add(&SourcePoses[i]);
+		}
+		BlendPosesTogetherSoA(NumPoses, SourcePosePtrs.GetData(), SourceWeights.GetData(), nullptr, RequiredBones, ResultAtoms);
+		return;
+	}
 
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
 	for (int32 i = 0; i < NumPoses; ++i)
@@ -171,6 +232,30 @@ void FAnimationRuntime::BlendPosesTogetherPerBone(int32 NumPoses, const TArray<F
 	check(NumPoses > 0);
 
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+
+	if (CVarSoAPoseBlending.GetValueOnAnyThread() != 0)
+	{
+		FMemMark Mark(FMemStack::Get());
+		const int32 NumPaddedBones = FAnimPoseSoA::GetNumPaddedBones(RequiredBoneIndices.Num());
+
+		TArray<const FTransformArrayA2*, TInlineAllocator<8> > SourcePosePtrs;
+		TArray<const float*, TInlineAllocator<8> > PerBoneWeights;
+		for (int32 i = 0; i < NumPoses; ++i)
+		{
+			const FBlendSampleData& SampleData = BlendSampleDataCache[i];
+			float* Weights = NewZeroed<float>(FMemStack::Get(), NumPaddedBones, 16);
+			for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
+			{
+				const int32 PerBoneIndex = BlendSpace->GetPerBoneInterpolationIndex(RequiredBoneIndices[j], RequiredBones);
+				Weights[j] = SampleData.PerBoneBlendData.IsValidIndex(PerBoneIndex) ? FMath::Clamp<float>(SampleData.PerBoneBlendData[PerBoneIndex], 0.f, 1.f) : SampleData.GetWeight();
+			}
+			SourcePosePtrs.Add(&SourcePoses[i]);
+			PerBoneWeights.Add(Weights);
+		}
+		BlendPosesTogetherSoA(NumPoses, SourcePosePtrs.GetData(), nullptr, PerBoneWeights.GetData(), RequiredBones, ResultAtoms);
+		return;
+	}
+
 	for (int32 i = 0; i < NumPoses; ++i)
 	{
 		const ScalarRegister VBlendWeight(BlendSampleDataCache[i].GetWeight());
@@ -329,6 +414,20 @@ void FAnimationRuntime::BlendAdditivePose(const FTransformArrayA2& SourcePoses,
 	const ScalarRegister VBlendWeight(BlendWeight);
 	// Subsequent poses need to be blended in
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+
+	if (CVarSoAPoseBlending.GetValueOnAnyThread() != 0)
+	{
+		FMemMark Mark(FMemStack::Get());
+		FAnimPoseSoA SourcePose, AdditivePose;
+		AllocatePoseSoA(SourcePose, RequiredBoneIndices.Num());
+		AllocatePoseSoA(AdditivePose, RequiredBoneIndices.Num());
+		SourcePose.Gather(SourcePoses, RequiredBoneIndices);
+		AdditivePose.Gather(AdditiveBlendPoses, RequiredBoneIndices);
+		FAnimPoseSoA::BlendAdditivePose(SourcePose, AdditivePose, BlendWeight, SourcePose);
+		SourcePose.Scatter(ResultAtoms, RequiredBoneIndices);
+		return;
+	}
+
 	for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
 	{
 		const int32 BoneIndex = RequiredBoneIndices[j];
@@ -460,6 +559,19 @@ void FAnimationRuntime::ConvertPoseToAdditive(FTransformArrayA2 & TargetPose, co
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
 	const int32 NumRequiredBones = RequiredBoneIndices.Num();
 
+	if (CVarSoAPoseBlending.GetValueOnAnyThread() != 0)
+	{
+		FMemMark Mark(FMemStack::Get());
+		FAnimPoseSoA TargetPoseSoA, BasePoseSoA;
+		AllocatePoseSoA(TargetPoseSoA, NumRequiredBones);
+		AllocatePoseSoA(BasePoseSoA, NumRequiredBones);
+		TargetPoseSoA.Gather(TargetPose, RequiredBoneIndices);
+		BasePoseSoA.Gather(BasePose, RequiredBoneIndices);
+		FAnimPoseSoA::ConvertPoseToAdditive(TargetPoseSoA, BasePoseSoA);
+		TargetPoseSoA.Scatter(TargetPose, RequiredBoneIndices);
+		return;
+	}
+
 	for(int32 Index=0; Index<NumRequiredBones; Index++)
 	{
 		const int32 BoneIndex = RequiredBoneIndices[Index];
@@ -0,0 +1,104 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimationSharing.cpp: Sharing evaluated poses between skeletal mesh components
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "AnimationSharing.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Poses Published"), STAT_AnimSharedPosesPublished, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Poses Reused"), STAT_AnimSharedPosesReused, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Poses Waited For"), STAT_AnimSharedPosesFollowed, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Poses"), STAT_AnimSharedPoses, STATGROUP_Anim);
+
+FAnimationSharingManager& FAnimationSharingManager::Get()
+{
+	static FAnimationSharingManager Manager;
+	return Manager;
+}
+
+FAnimationSharingManager::FAnimationSharingManager()
+	: LastPurgeFrame(0)
+{
+}
+
+const FAnimationSharedPose* FAnimationSharingManager::FindPose(const FAnimationSharingKey& Key)
+{
+	check(IsInGameThread());
+	PurgeStalePoses();
+
+	FAnimationSharedPose* SharedPose = SharedPoses.Find(Key);
+	if (SharedPose && SharedPose->bEvaluated)
+	{
+		SharedPose->LastUsedFrame = GFrameCounter;
+		INC_DWORD_STAT(STAT_AnimSharedPosesReused);
+		return SharedPose;
+	}
+	return nullptr;
+}
+
+FGraphEventRef FAnimationSharingManager::FindPendingEvaluation(const FAnimationSharingKey& Key)
+{
+	check(IsInGameThread());
+	PurgeStalePoses();
+
+	FAnimationSharedPose* SharedPose = SharedPoses.Find(Key);
+	// a completed event without a published pose means the leader was destroyed or changed its mesh, the next component takes over
+	if (SharedPose && !SharedPose->bEvaluated && SharedPose->PendingEvaluation.IsValid() && !SharedPose->PendingEvaluation->IsComplete())
+	{
+		SharedPose->LastUsedFrame = GFrameCounter;
+		INC_DWORD_STAT(STAT_AnimSharedPosesFollowed);
+		return SharedPose->PendingEvaluation;
+	}
+	return FGraphEventRef();
+}
+
+void FAnimationSharingManager::BeginEvaluation(const FAnimationSharingKey& Key, const FGraphEventRef& CompletionEvent)
+{
+	check(IsInGameThread());
+	PurgeStalePoses();
+
+	FAnimationSharedPose& SharedPose = SharedPoses.FindOrAdd(Key);
+	SharedPose.PendingEvaluation = CompletionEvent;
+	SharedPose.LastUsedFrame = GFrameCounter;
+}
+
+void FAnimationSharingManager::PublishPose(const FAnimationSharingKey& Key, const TArray<FTransform>& LocalAtoms, const TArray<FTransform>& SpaceBases, const TArray<FActiveVertexAnim>& VertexAnims, const FVector& RootBoneTranslation)
+{
+	check(IsInGameThread());
+	PurgeStalePoses();
+
+	FAnimationSharedPose& SharedPose = SharedPoses.FindOrAdd(Key);
+	SharedPose.LocalAtoms = LocalAtoms;
+	SharedPose.SpaceBases = SpaceBases;
+	SharedPose.VertexAnims = VertexAnims;
+	SharedPose.RootBoneTranslation = RootBoneTranslation;
+	SharedPose.LastUsedFrame = GFrameCounter;
+	SharedPose.bEvaluated = true;
+	SharedPose.PendingEvaluation.SafeRelease();
+	INC_DWORD_STAT(STAT_AnimSharedPosesPublished);
+}
+
+void FAnimationSharingManager::Empty()
+{
+	SharedPoses.Empty();
+}
+
+void FAnimationSharingManager::PurgeStalePoses()
+{
+	if (LastPurgeFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastPurgeFrame = GFrameCounter;
+
+	for (auto It = SharedPoses.CreateIterator(); It; ++It)
+	{
+		if (It.Value().LastUsedFrame + 1 < GFrameCounter || !It.Key().SkeletalMesh.IsValid() || !It.Key().AnimationAsset.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	SET_DWORD_STAT(STAT_AnimSharedPoses, SharedPoses.Num());
+}
@@ -1460,6 +1460,8 @@ FString FAnimationUtils::GetAnimationKeyFormatString(AnimationKeyFormat InFormat
 		return FString(TEXT("AKF_VariableKeyLerp"));
 	case AKF_PerTrackCompression:
 		return FString(TEXT("AKF_PerTrackCompression"));
+	case AKF_SegmentedVariableBitRate:
+		return FString(TEXT("AKF_SegmentedVariableBitRate"));
 	default:
 		UE_LOG(LogAnimation, Warning, TEXT("AnimationKeyFormat was not found:  %i"), static_cast<int32>(InFormat) );
 	}
@@ -51,6 +51,8 @@ DEFINE_STAT(STAT_AudioStartSources);
 DEFINE_STAT(STAT_AudioGatherWaveInstances);
 DEFINE_STAT(STAT_AudioUpdateTime);
 DEFINE_STAT(STAT_AudioFindNearestLocation);
+DEFINE_STAT(STAT_AudioThreadQueuedCommands);
+DEFINE_STAT(STAT_AudioThreadFrameTime);
 
 /*-----------------------------------------------------------------------------
 	FSoundBuffer implementation.
@@ -5,6 +5,7 @@
 #include "Sound/SoundNodeAttenuation.h"
 #include "Sound/SoundCue.h"
 #include "SubtitleManager.h"
+#include "AudioThread.h"
 
 /*-----------------------------------------------------------------------------
 UAudioComponent implementation.
@@ -27,6 +28,7 @@ UAudioComponent::UAudioComponent(const FObjectInitializer& ObjectInitializer)
 	PitchModulationMin = 1.f;
 	PitchModulationMax = 1.f;
 	HighFrequencyGainMultiplier = 1.0f;
+	PlayID = 0;
 }
 
 FString UAudioComponent::GetDetailedInfoInternal( void ) const
@@ -93,16 +95,20 @@ void UAudioComponent::OnUpdateTransform(bool bSkipPhysicsMove)
 
 	if (bIsActive && !bPreviewComponent)
 	{
-		// TODO - Audio Threading. This call would be a task
 		FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 		if (AudioDevice != NULL)
 		{
-			FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-			if (ActiveSound)
+			const FTransform ComponentTransform = ComponentToWorld;
+			UAudioComponent* AudioComponent = this;
+			FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, ComponentTransform]()
 			{
-				FScopeCycleCounterUObject ComponentScope(ActiveSound->Sound);
-				ActiveSound->Transform = ComponentToWorld;
-			}
+				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+				if (ActiveSound)
+				{
+					FScopeCycleCounterUObject ComponentScope(ActiveSound->Sound);
+					ActiveSound->Transform = ComponentTransform;
+				}
+			});
 		}
 	}
 };
@@ -134,6 +140,7 @@ void UAudioComponent::PlayInternal(const float StartTime, const float FadeInDura
 		{
 			FActiveSound NewActiveSound;
 			NewActiveSound.AudioComponent = this;
+			NewActiveSound.AudioComponentPlayID = ++PlayID;
 			NewActiveSound.World = GetWorld();
 			NewActiveSound.Sound = Sound;
 			NewActiveSound.SoundClassOverride = SoundClassOverride;
@@ -184,7 +191,6 @@ void UAudioComponent::PlayInternal(const float StartTime, const float FadeInDura
 				NewActiveSound.CurrentAdjustVolumeMultiplier = FadeVolumeLevel;
 			}
 
-			// TODO - Audio Threading. This call would be a task call to dispatch to the audio thread
 			AudioDevice->AddNewActiveSound(NewActiveSound);
 
 			bIsActive = true;
@@ -203,17 +209,20 @@ void UAudioComponent::FadeOut( float FadeOutDuration, float FadeVolumeLevel )
 	{
 		if (FadeOutDuration > 0.0f)
 		{
-			// TODO - Audio Threading. This call would be a task
 			FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 			if (AudioDevice != NULL)
 			{
-				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-				if (ActiveSound)
+				UAudioComponent* AudioComponent = this;
+				FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, FadeOutDuration, FadeVolumeLevel]()
 				{
-					ActiveSound->TargetAdjustVolumeMultiplier = FadeVolumeLevel;
-					ActiveSound->TargetAdjustVolumeStopTime = ActiveSound->PlaybackTime + FadeOutDuration;
-					ActiveSound->bFadingOut = true;
-				}
+					FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+					if (ActiveSound)
+					{
+						ActiveSound->TargetAdjustVolumeMultiplier = FadeVolumeLevel;
+						ActiveSound->TargetAdjustVolumeStopTime = ActiveSound->PlaybackTime + FadeOutDuration;
+						ActiveSound->bFadingOut = true;
+					}
+				});
 			}
 		}
 		else
@@ -227,26 +236,29 @@ void UAudioComponent::AdjustVolume( float AdjustVolumeDuration, float AdjustVolu
 {
 	if (bIsActive)
 	{
-		// TODO - Audio Threading. This call would be a task
 		FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 		if (AudioDevice != NULL)
 		{
-			FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-			if (ActiveSound)
+			UAudioComponent* AudioComponent = this;
+			FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, AdjustVolumeDuration, AdjustVolumeLevel]()
 			{
-				ActiveSound->bFadingOut = false;
-				ActiveSound->TargetAdjustVolumeMultiplier = AdjustVolumeLevel;
-
-				if( AdjustVolumeDuration > 0.0f )
-				{
-					ActiveSound->TargetAdjustVolumeStopTime = ActiveSound->PlaybackTime + AdjustVolumeDuration;
-				}
-				else
+				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+				if (ActiveSound)
 				{
-					ActiveSound->CurrentAdjustVolumeMultiplier = AdjustVolumeLevel;
-					ActiveSound->TargetAdjustVolumeStopTime = -1.0f;
+					ActiveSound->bFadingOut = false;
+					ActiveSound->TargetAdjustVolumeMultiplier = AdjustVolumeLevel;
+
+					if( AdjustVolumeDuration > 0.0f )
+					{
+						ActiveSound->TargetAdjustVolumeStopTime = ActiveSound->PlaybackTime + AdjustVolumeDuration;
+					}
+					else
+					{
+						ActiveSound->CurrentAdjustVolumeMultiplier = AdjustVolumeLevel;
+						ActiveSound->TargetAdjustVolumeStopTime = -1.0f;
+					}
 				}
-			}
+			});
 		}
 	}
 }
@@ -257,7 +269,6 @@ void UAudioComponent::Stop()
 	{
 		UE_LOG(LogAudio, Verbose, TEXT( "%g: Stopping AudioComponent : '%s' with Sound: '%s'" ), GetWorld() ? GetWorld()->GetAudioTimeSeconds() : 0.0f, *GetFullName(), Sound ? *Sound->GetName() : TEXT( "NULL" ) );
 
-		// TODO - Audio Threading. This call would be a task
 		FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 		if (AudioDevice != NULL)
 		{
@@ -418,15 +429,18 @@ void UAudioComponent::SetFloatParameter( FName InName, float InFloat )
 		// If we're active we need to push this value to the ActiveSound
 		if (bIsActive)
 		{
-			// TODO - Audio Threading. This call would be a task
 			FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 			if (AudioDevice != NULL)
 			{
-				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-				if (ActiveSound)
+				UAudioComponent* AudioComponent = this;
+				FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, InName, InFloat]()
 				{
-					ActiveSound->SetFloatParameter(InName, InFloat);
-				}
+					FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+					if (ActiveSound)
+					{
+						ActiveSound->SetFloatParameter(InName, InFloat);
+					}
+				});
 			}
 		}
 	}
@@ -460,15 +474,18 @@ void UAudioComponent::SetWaveParameter( FName InName, USoundWave* InWave )
 		// If we're active we need to push this value to the ActiveSound
 		if (bIsActive)
 		{
-			// TODO - Audio Threading. This call would be a task
 			FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 			if (AudioDevice != NULL)
 			{
-				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-				if (ActiveSound)
+				UAudioComponent* AudioComponent = this;
+				FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, InName, InWave]()
 				{
-					ActiveSound->SetWaveParameter(InName, InWave);
-				}
+					FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+					if (ActiveSound)
+					{
+						ActiveSound->SetWaveParameter(InName, InWave);
+					}
+				});
 			}
 		}
 	}
@@ -502,15 +519,18 @@ void UAudioComponent::SetBoolParameter( FName InName, bool InBool )
 		// If we're active we need to push this value to the ActiveSound
 		if (bIsActive)
 		{
-			// TODO - Audio Threading. This call would be a task
 			FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 			if (AudioDevice != NULL)
 			{
-				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-				if (ActiveSound)
+				UAudioComponent* AudioComponent = this;
+				FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, InName, InBool]()
 				{
-					ActiveSound->SetBoolParameter(InName, InBool);
-				}
+					FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+					if (ActiveSound)
+					{
+						ActiveSound->SetBoolParameter(InName, InBool);
+					}
+				});
 			}
 		}
 	}
@@ -545,15 +565,18 @@ void UAudioComponent::SetIntParameter( FName InName, int32 InInt )
 		// If we're active we need to push this value to the ActiveSound
 		if (bIsActive)
 		{
-			// TODO - Audio Threading. This call would be a task
 			FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 			if (AudioDevice != NULL)
 			{
-				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-				if (ActiveSound)
+				UAudioComponent* AudioComponent = this;
+				FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, InName, InInt]()
 				{
-					ActiveSound->SetIntParameter(InName, InInt);
-				}
+					FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+					if (ActiveSound)
+					{
+						ActiveSound->SetIntParameter(InName, InInt);
+					}
+				});
 			}
 		}
 	}
@@ -564,15 +587,18 @@ void UAudioComponent::SetVolumeMultiplier(float NewVolumeMultiplier)
 	VolumeMultiplier = NewVolumeMultiplier;
 	VolumeModulationMin = VolumeModulationMax = 1.f;
 
-	// TODO - Audio Threading. This call would be a task
 	FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 	if (AudioDevice != NULL)
 	{
-		FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-		if (ActiveSound)
+		UAudioComponent* AudioComponent = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, NewVolumeMultiplier]()
 		{
-			ActiveSound->VolumeMultiplier = NewVolumeMultiplier;
-		}
+			FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+			if (ActiveSound)
+			{
+				ActiveSound->VolumeMultiplier = NewVolumeMultiplier;
+			}
+		});
 	}
 }
 
@@ -581,15 +607,18 @@ void UAudioComponent::SetPitchMultiplier(float NewPitchMultiplier)
 	PitchMultiplier = NewPitchMultiplier;
 	PitchModulationMin = PitchModulationMax = 1.f;
 
-	// TODO - Audio Threading. This call would be a task
 	FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 	if (AudioDevice != NULL)
 	{
-		FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-		if (ActiveSound)
+		UAudioComponent* AudioComponent = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, NewPitchMultiplier]()
 		{
-			ActiveSound->PitchMultiplier = NewPitchMultiplier;
-		}
+			FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+			if (ActiveSound)
+			{
+				ActiveSound->PitchMultiplier = NewPitchMultiplier;
+			}
+		});
 	}
 }
 
@@ -597,15 +626,18 @@ void UAudioComponent::SetUISound(bool bInIsUISound)
 {
 	bIsUISound = bInIsUISound;
 
-	// TODO - Audio Threading. This call would be a task
 	FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 	if (AudioDevice != NULL)
 	{
-		FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-		if (ActiveSound)
+		UAudioComponent* AudioComponent = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, bInIsUISound]()
 		{
-			ActiveSound->bIsUISound = bIsUISound;
-		}
+			FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+			if (ActiveSound)
+			{
+				ActiveSound->bIsUISound = bInIsUISound;
+			}
+		});
 	}
 }
 
@@ -614,14 +646,17 @@ void UAudioComponent::AdjustAttenuation(const FAttenuationSettings& InAttenuatio
 	bOverrideAttenuation = true;
 	AttenuationOverrides = InAttenuationSettings;
 
-	// TODO - Audio Threading. This call would be a task
 	FAudioDevice* AudioDevice = GEngine ? GEngine->GetAudioDevice() : NULL;
 	if (AudioDevice != NULL)
 	{
-		FActiveSound* ActiveSound = AudioDevice->FindActiveSound(this);
-		if (ActiveSound)
+		UAudioComponent* AudioComponent = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent, InAttenuationSettings]()
 		{
-			ActiveSound->AttenuationSettings = AttenuationOverrides;
-		}
+			FActiveSound* ActiveSound = AudioDevice->FindActiveSound(AudioComponent);
+			if (ActiveSound)
+			{
+				ActiveSound->AttenuationSettings = InAttenuationSettings;
+			}
+		});
 	}
 }
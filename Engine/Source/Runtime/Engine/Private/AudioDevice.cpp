@@ -4,6 +4,7 @@
 #include "ActiveSound.h"
 #include "Audio.h"
 #include "AudioDevice.h"
+#include "AudioThread.h"
 #include "AudioEffect.h"
 #include "AudioDecompress.h"
 #include "Sound/AudioSettings.h"
@@ -78,6 +79,7 @@ bool FAudioDevice::Init()
 	
 	// Make sure the Listeners array has at least one entry, so we don't have to check for Listeners.Num() == 0 all the time
 	Listeners.Add(FListener());
+	ListenerTransforms.Add(FTransform::Identity);
 
 	if (!bDeferStartupPrecache)
 	{
@@ -86,6 +88,9 @@ bool FAudioDevice::Init()
 
 	UE_LOG(LogInit, Log, TEXT("FAudioDevice initialized." ));
 
+	// From here on the audio thread owns the device state, if it is enabled
+	FAudioThread::StartAudioThread();
+
 	return true;
 }
 
@@ -122,6 +127,9 @@ void FAudioDevice::SetMaxChannels(int32 InMaxChannels)
 
 void FAudioDevice::Teardown()
 {
+	// Runs the commands still queued, the device is only used by the game thread from here on
+	FAudioThread::StopAudioThread();
+
 	// Flush stops all sources so sources can be safely deleted below.
 	Flush(NULL);
 
@@ -157,6 +165,8 @@ void FAudioDevice::Suspend(bool bGameTicking)
 
 void FAudioDevice::CountBytes(FArchive& Ar)
 {
+	FAudioThreadSuspendContext SuspendContext;
+
 	Sources.CountBytes(Ar);
 	Buffers.CountBytes(Ar);
 	FreeSources.CountBytes(Ar);
@@ -168,6 +178,9 @@ void FAudioDevice::CountBytes(FArchive& Ar)
 
 void FAudioDevice::AddReferencedObjects( FReferenceCollector& Collector )
 {	
+	// Garbage collection already suspends the audio thread, but the collector can be used on its own
+	FAudioThreadSuspendContext SuspendContext;
+
 	Collector.AddReferencedObject(DefaultBaseSoundMix);
 
 	for( TMap< USoundMix*, FSoundMixState >::TIterator It( SoundMixModifiers ); It; ++It )
@@ -688,6 +701,9 @@ EDebugState FAudioDevice::GetMixDebugState( void )
 
 bool FAudioDevice::Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar )
 {
+	// Commands read and change the device state directly
+	FAudioThreadSuspendContext SuspendContext;
+
 #if !UE_BUILD_SHIPPING
 	if( FParse::Command( &Cmd, TEXT( "DumpSoundInfo" ) ) )
 	{
@@ -1323,6 +1339,26 @@ void FAudioDevice::SetListener( const int32 InViewportIndex, const FTransform& I
 		ListenerTransform = FTransform::Identity;
 	}
 
+	if (IsInGameThread())
+	{
+		// Keep the copy the game thread reads without waiting for the audio thread
+		if( InViewportIndex >= ListenerTransforms.Num() )
+		{
+			ListenerTransforms.AddUninitialized( InViewportIndex - ListenerTransforms.Num() + 1 );
+		}
+		ListenerTransforms[ InViewportIndex ] = ListenerTransform;
+	}
+
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, InViewportIndex, ListenerTransform, InDeltaSeconds, Volume, InteriorSettings]()
+		{
+			AudioDevice->SetListener(InViewportIndex, ListenerTransform, InDeltaSeconds, Volume, InteriorSettings);
+		});
+		return;
+	}
+
 	if( InViewportIndex >= Listeners.Num() )
 	{
 		UE_LOG(LogAudio, Log, TEXT( "Resizing Listeners array: %d -> %d" ), Listeners.Num(), InViewportIndex );
@@ -1339,8 +1375,18 @@ void FAudioDevice::SetListener( const int32 InViewportIndex, const FTransform& I
 }
 
 
-bool FAudioDevice::SetBaseSoundMix( USoundMix* NewMix )
+void FAudioDevice::SetBaseSoundMix( USoundMix* NewMix )
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, NewMix]()
+		{
+			AudioDevice->SetBaseSoundMix(NewMix);
+		});
+		return;
+	}
+
 	if( NewMix && NewMix != BaseSoundMix )
 	{
 		USoundMix* OldBaseSoundMix = BaseSoundMix;
@@ -1369,15 +1415,21 @@ bool FAudioDevice::SetBaseSoundMix( USoundMix* NewMix )
 		}
 
 		ExistingState->IsBaseSoundMix = true;
-
-		return true;
 	}
-
-	return false;
 }
 
 void FAudioDevice::PushSoundMixModifier(USoundMix* SoundMix, bool bIsPassive)
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, SoundMix, bIsPassive]()
+		{
+			AudioDevice->PushSoundMixModifier(SoundMix, bIsPassive);
+		});
+		return;
+	}
+
 	if (SoundMix)
 	{
 		FSoundMixState* SoundMixState = SoundMixModifiers.Find(SoundMix);
@@ -1412,6 +1464,16 @@ void FAudioDevice::PushSoundMixModifier(USoundMix* SoundMix, bool bIsPassive)
 
 void FAudioDevice::PopSoundMixModifier(USoundMix* SoundMix, bool bIsPassive)
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, SoundMix, bIsPassive]()
+		{
+			AudioDevice->PopSoundMixModifier(SoundMix, bIsPassive);
+		});
+		return;
+	}
+
 	if (SoundMix)
 	{
 		FSoundMixState* SoundMixState = SoundMixModifiers.Find(SoundMix);
@@ -1443,6 +1505,16 @@ void FAudioDevice::PopSoundMixModifier(USoundMix* SoundMix, bool bIsPassive)
 
 void FAudioDevice::ClearSoundMixModifier(USoundMix* SoundMix)
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, SoundMix]()
+		{
+			AudioDevice->ClearSoundMixModifier(SoundMix);
+		});
+		return;
+	}
+
 	if (SoundMix)
 	{
 		FSoundMixState* SoundMixState = SoundMixModifiers.Find(SoundMix);
@@ -1458,6 +1530,16 @@ void FAudioDevice::ClearSoundMixModifier(USoundMix* SoundMix)
 
 void FAudioDevice::ClearSoundMixModifiers()
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice]()
+		{
+			AudioDevice->ClearSoundMixModifiers();
+		});
+		return;
+	}
+
 	// Clear all sound mix modifiers
 	for (TMap< USoundMix*, FSoundMixState >::TIterator It(SoundMixModifiers); It; ++It)
 	{
@@ -1467,6 +1549,16 @@ void FAudioDevice::ClearSoundMixModifiers()
 
 void FAudioDevice::ActivateReverbEffect(class UReverbEffect* ReverbEffect, FName TagName, float Priority, float Volume, float FadeTime)
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, ReverbEffect, TagName, Priority, Volume, FadeTime]()
+		{
+			AudioDevice->ActivateReverbEffect(ReverbEffect, TagName, Priority, Volume, FadeTime);
+		});
+		return;
+	}
+
 	FActivatedReverb* ExistingReverb = ActivatedReverbs.Find(TagName);
 
 	if (ExistingReverb)
@@ -1496,6 +1588,16 @@ void FAudioDevice::ActivateReverbEffect(class UReverbEffect* ReverbEffect, FName
 
 void FAudioDevice::DeactivateReverbEffect(FName TagName)
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, TagName]()
+		{
+			AudioDevice->DeactivateReverbEffect(TagName);
+		});
+		return;
+	}
+
 	FActivatedReverb* ExistingReverb = ActivatedReverbs.Find(TagName);
 	if (ExistingReverb)
 	{
@@ -1515,6 +1617,16 @@ void FAudioDevice::DeactivateReverbEffect(FName TagName)
 
 void FAudioDevice::SetReverbSettings( class AAudioVolume* Volume, const FReverbSettings& ReverbSettings )
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, Volume, ReverbSettings]()
+		{
+			AudioDevice->SetReverbSettings(Volume, ReverbSettings);
+		});
+		return;
+	}
+
 	const FReverbSettings* ActivatedReverb = &ReverbSettings;
 	if (HighestPriorityReverb && (!Volume || HighestPriorityReverb->Priority > Volume->Priority))
 	{
@@ -1774,8 +1886,32 @@ void FAudioDevice::StartSources( TArray<FWaveInstance*>& WaveInstances, int32 Fi
 
 void FAudioDevice::Update( bool bGameTicking )
 {
+	if (!IsInAudioThread())
+	{
+		// Notifications sent by the audio thread since the last frame, e.g. audio components that finished playing
+		FAudioThread::ProcessGameThreadCommands();
+
+		SET_DWORD_STAT( STAT_AudioThreadQueuedCommands, FAudioThread::GetNumQueuedCommands() );
+
+		// Don't let updates pile up when the audio thread falls behind, the next one catches up anyway
+		if (NumPendingUpdates.GetValue() == 0)
+		{
+			NumPendingUpdates.Increment();
+
+			FAudioDevice* AudioDevice = this;
+			FAudioThread::RunCommandOnAudioThread([AudioDevice, bGameTicking]()
+			{
+				AudioDevice->NumPendingUpdates.Decrement();
+				AudioDevice->Update(bGameTicking);
+			});
+		}
+		return;
+	}
+
 	SCOPE_CYCLE_COUNTER( STAT_AudioUpdateTime );
 
+	const double UpdateStartTime = FPlatformTime::Seconds();
+
 	// Start a new frame
 	CurrentTick++;
 
@@ -1828,6 +1964,8 @@ void FAudioDevice::Update( bool bGameTicking )
 	// now let the platform perform anything it needs to handle
 	UpdateHardware();
 
+	SET_FLOAT_STAT( STAT_AudioThreadFrameTime, (FPlatformTime::Seconds() - UpdateStartTime) * 1000.0 );
+
 #if !UE_BUILD_SHIPPING
 	// Print statistics for first non initial load allocation.
 	static bool bFirstTime = true;
@@ -1846,6 +1984,16 @@ void FAudioDevice::Update( bool bGameTicking )
 
 void FAudioDevice::StopAllSounds( bool bShouldStopUISounds )
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, bShouldStopUISounds]()
+		{
+			AudioDevice->StopAllSounds(bShouldStopUISounds);
+		});
+		return;
+	}
+
 	for (int32 SoundIndex=ActiveSounds.Num() - 1; SoundIndex >= 0; --SoundIndex)
 	{
 		FActiveSound* ActiveSound = ActiveSounds[SoundIndex];
@@ -1875,6 +2023,16 @@ void FAudioDevice::StopAllSounds( bool bShouldStopUISounds )
 
 void FAudioDevice::AddNewActiveSound( const FActiveSound& NewActiveSound )
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, NewActiveSound]()
+		{
+			AudioDevice->AddNewActiveSound(NewActiveSound);
+		});
+		return;
+	}
+
 	check(NewActiveSound.Sound);
 
 	// if we have gone over the MaxConcurrentPlay
@@ -1942,11 +2100,15 @@ void FAudioDevice::AddNewActiveSound( const FActiveSound& NewActiveSound )
 		}
 		else
 		{
-			// TODO - Audio Threading. This call would be a task back to game thread
-			if (NewActiveSound.AudioComponent.IsValid())
+			TWeakObjectPtr<UAudioComponent> AudioComponent = NewActiveSound.AudioComponent;
+			const uint32 PlayID = NewActiveSound.AudioComponentPlayID;
+			FAudioThread::RunCommandOnGameThread([AudioComponent, PlayID]()
 			{
-				NewActiveSound.AudioComponent->PlaybackCompleted(true);
-			}
+				if (AudioComponent.IsValid() && AudioComponent->PlayID == PlayID)
+				{
+					AudioComponent->PlaybackCompleted(true);
+				}
+			});
 			//UE_LOG(LogAudio, Verbose, TEXT( "   %g: MaxConcurrentPlayCount AudioComponent : '%s' with Sound: '%s' Max: %d   Curr: %d " ), NewActiveSound.World ? NewActiveSound.World->GetAudioTimeSeconds() : 0.0f, *GetFullName(), Sound ? *Sound->GetName() : TEXT( "NULL" ), Sound->MaxConcurrentPlayCount, Sound->CurrentPlayCount );
 			return;
 
@@ -1965,6 +2127,16 @@ void FAudioDevice::AddNewActiveSound( const FActiveSound& NewActiveSound )
 
 void FAudioDevice::StopActiveSound( UAudioComponent* AudioComponent )
 {
+	if (!IsInAudioThread())
+	{
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, AudioComponent]()
+		{
+			AudioDevice->StopActiveSound(AudioComponent);
+		});
+		return;
+	}
+
 	check( AudioComponent );
 
 	FActiveSound* ActiveSound = FindActiveSound(AudioComponent);
@@ -2011,11 +2183,25 @@ bool FAudioDevice::LocationIsAudible( FVector Location, float MaxDistance )
 	}
 
 	MaxDistance *= MaxDistance;
-	for( int32 i = 0; i < Listeners.Num(); i++ )
+	if (IsInGameThread())
+	{
+		// Called for every sound played by the game, read the game thread copy rather than waiting for the audio thread
+		for( int32 i = 0; i < ListenerTransforms.Num(); i++ )
+		{
+			if( ( ListenerTransforms[ i ].GetTranslation() - Location ).SizeSquared() < MaxDistance )
+			{
+				return( true );
+			}
+		}
+	}
+	else
 	{
-		if( ( Listeners[ i ].Transform.GetTranslation() - Location ).SizeSquared() < MaxDistance )
+		for( int32 i = 0; i < Listeners.Num(); i++ )
 		{
-			return( true );
+			if( ( Listeners[ i ].Transform.GetTranslation() - Location ).SizeSquared() < MaxDistance )
+			{
+				return( true );
+			}
 		}
 	}
 
@@ -2088,6 +2274,8 @@ UAudioComponent* FAudioDevice::CreateComponent( USoundBase* Sound, UWorld* World
 
 void FAudioDevice::Flush( UWorld* WorldToFlush, bool bClearActivatedReverb )
 {
+	FAudioThreadSuspendContext SuspendContext;
+
 	// Stop all audio components attached to the scene
 	bool bFoundIgnoredComponent = false;
 	for( int32 Index = ActiveSounds.Num() - 1; Index >= 0; --Index )
@@ -2110,6 +2298,11 @@ void FAudioDevice::Flush( UWorld* WorldToFlush, bool bClearActivatedReverb )
 	// Anytime we flush, make sure to clear all the listeners.  We'll get the right ones soon enough.
 	Listeners.Empty();
 	Listeners.Add(FListener());
+	if (IsInGameThread())
+	{
+		ListenerTransforms.Reset();
+		ListenerTransforms.Add(FTransform::Identity);
+	}
 
 	// Clear all the activated reverb effects
 	if (bClearActivatedReverb)
@@ -2156,6 +2349,21 @@ void FAudioDevice::Flush( UWorld* WorldToFlush, bool bClearActivatedReverb )
 
 void FAudioDevice::Precache(USoundWave* SoundWave, bool bSynchronous, bool bTrackMemory)
 {
+	if (!bSynchronous && !IsInAudioThread())
+	{
+		// Waves are precached as they load, nothing waits for it. Garbage collection runs the queued commands before
+		// collecting, so the wave is still around when the command runs.
+		FAudioDevice* AudioDevice = this;
+		FAudioThread::RunCommandOnAudioThread([AudioDevice, SoundWave, bTrackMemory]()
+		{
+			AudioDevice->Precache(SoundWave, false, bTrackMemory);
+		});
+		return;
+	}
+
+	// Sources may be using the buffers of the wave
+	FAudioThreadSuspendContext SuspendContext;
+
 	if( SoundWave == NULL )
 	{
 		return;
@@ -2272,6 +2480,8 @@ void FAudioDevice::TrackResource(USoundWave* Wave, FSoundBuffer* Buffer)
 
 void FAudioDevice::FreeResource(USoundWave* SoundWave)
 {
+	FAudioThreadSuspendContext SuspendContext;
+
 	// Find buffer for resident wavs
 	if (SoundWave->ResourceID)
 	{
@@ -2285,6 +2495,8 @@ void FAudioDevice::FreeResource(USoundWave* SoundWave)
 
 void FAudioDevice::FreeBufferResource(FSoundBuffer* Buffer)
 {
+	FAudioThreadSuspendContext SuspendContext;
+
 	if (Buffer)
 	{
 		// Remove from buffers array.
@@ -2310,6 +2522,8 @@ void FAudioDevice::FreeBufferResource(FSoundBuffer* Buffer)
 
 FSoundClassProperties* FAudioDevice::GetSoundClassCurrentProperties( USoundClass* InSoundClass )
 {
+	FAudioThreadSuspendContext SuspendContext;
+
 	FSoundClassProperties* Properties = NULL;
 	if (InSoundClass)
 	{
@@ -2396,6 +2610,8 @@ bool FAudioDevice::HandleListSoundsCommand(const TCHAR* Cmd, FOutputDevice& Ar)
 
 void FAudioDevice::StopSoundsUsingResource(USoundWave* SoundWave, TArray<UAudioComponent*>& StoppedComponents)
 {
+	FAudioThreadSuspendContext SuspendContext;
+
 	bool bStoppedSounds = false;
 
 	for (int32 ActiveSoundIndex = ActiveSounds.Num() - 1; ActiveSoundIndex >= 0; --ActiveSoundIndex)
@@ -0,0 +1,236 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AudioThread.cpp: Optional thread that updates the audio device.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Audio.h"
+#include "AudioThread.h"
+
+/** Whether the audio device is updated on its own thread. int32 instead of bool only for console variable system. */
+static TAutoConsoleVariable<int32> CVarEnableAudioThread(
+	TEXT("AudioThread.EnableAudioThread"),
+	0,
+	TEXT("Whether the audio device is updated on a dedicated thread, the game thread then only queues commands for it.\n")
+	TEXT("Only read when the audio device is initialized."),
+	ECVF_ReadOnly);
+
+/** Id of the audio thread while it runs */
+static uint32 GAudioThreadId = 0;
+
+TQueue<TFunction<void()>, EQueueMode::Mpsc> FAudioThread::AudioThreadCommands;
+TQueue<TFunction<void()>, EQueueMode::Mpsc> FAudioThread::GameThreadCommands;
+FThreadSafeCounter FAudioThread::NumQueuedCommands;
+FEvent* FAudioThread::SuspendedEvent = nullptr;
+FEvent* FAudioThread::ResumeEvent = nullptr;
+int32 FAudioThread::SuspendCount = 0;
+FAudioThread* FAudioThread::AudioThreadRunnable = nullptr;
+FRunnableThread* FAudioThread::AudioThread = nullptr;
+bool FAudioThread::bIsAudioThreadRunning = false;
+FDelegateHandle FAudioThread::PreGarbageCollectHandle;
+FDelegateHandle FAudioThread::PostGarbageCollectHandle;
+
+bool IsInAudioThread()
+{
+	// Without the audio thread, the audio device is used by its callers directly as it always was
+	return !FAudioThread::IsAudioThreadRunning() || FPlatformTLS::GetCurrentThreadId() == GAudioThreadId;
+}
+
+FAudioThread::FAudioThread()
+	: CommandsQueuedEvent(nullptr)
+{
+}
+
+FAudioThread::~FAudioThread()
+{
+	if (CommandsQueuedEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(CommandsQueuedEvent);
+		CommandsQueuedEvent = nullptr;
+	}
+}
+
+bool FAudioThread::Init()
+{
+	bKeepRunning.Set(1);
+	CommandsQueuedEvent = FPlatformProcess::GetSynchEventFromPool();
+	return true;
+}
+
+uint32 FAudioThread::Run()
+{
+	while (bKeepRunning.GetValue() != 0)
+	{
+		CommandsQueuedEvent->Wait();
+		ProcessCommands();
+	}
+
+	// Commands queued before the thread was asked to stop still have to run
+	ProcessCommands();
+	return 0;
+}
+
+void FAudioThread::Stop()
+{
+	bKeepRunning.Set(0);
+	CommandsQueuedEvent->Trigger();
+}
+
+void FAudioThread::ProcessCommands()
+{
+	TFunction<void()> Command;
+	while (AudioThreadCommands.Dequeue(Command))
+	{
+		NumQueuedCommands.Decrement();
+		Command();
+	}
+}
+
+void FAudioThread::StartAudioThread()
+{
+	check(IsInGameThread());
+
+	if (bIsAudioThreadRunning || CVarEnableAudioThread.GetValueOnGameThread() == 0 || !FPlatformProcess::SupportsMultithreading())
+	{
+		return;
+	}
+
+	SuspendedEvent = FPlatformProcess::GetSynchEventFromPool();
+	ResumeEvent = FPlatformProcess::GetSynchEventFromPool();
+
+	// Create() returns once Init() has run, the thread then waits for commands
+	AudioThreadRunnable = new FAudioThread();
+	AudioThread = FRunnableThread::Create(AudioThreadRunnable, TEXT("AudioThread"), 0, TPri_AboveNormal);
+	check(AudioThread);
+
+	GAudioThreadId = AudioThread->GetThreadID();
+	bIsAudioThreadRunning = true;
+
+	PreGarbageCollectHandle = FCoreUObjectDelegates::PreGarbageCollect.AddStatic(&FAudioThread::OnPreGarbageCollect);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::PostGarbageCollect.AddStatic(&FAudioThread::OnPostGarbageCollect);
+
+	UE_LOG(LogAudio, Log, TEXT("Audio thread started."));
+}
+
+void FAudioThread::StopAudioThread()
+{
+	check(IsInGameThread());
+
+	if (!bIsAudioThreadRunning)
+	{
+		return;
+	}
+
+	check(SuspendCount == 0);
+
+	FCoreUObjectDelegates::PreGarbageCollect.Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::PostGarbageCollect.Remove(PostGarbageCollectHandle);
+
+	AudioThreadRunnable->Stop();
+	AudioThread->WaitForCompletion();
+
+	// From here on commands run on the game thread
+	bIsAudioThreadRunning = false;
+	GAudioThreadId = 0;
+
+	delete AudioThread;
+	AudioThread = nullptr;
+	delete AudioThreadRunnable;
+	AudioThreadRunnable = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(SuspendedEvent);
+	SuspendedEvent = nullptr;
+	FPlatformProcess::ReturnSynchEventToPool(ResumeEvent);
+	ResumeEvent = nullptr;
+
+	// Notifications sent by the last commands
+	ProcessGameThreadCommands();
+
+	UE_LOG(LogAudio, Log, TEXT("Audio thread stopped."));
+}
+
+void FAudioThread::RunCommandOnAudioThread(TFunction<void()> InFunction)
+{
+	if (bIsAudioThreadRunning && !IsInAudioThread())
+	{
+		NumQueuedCommands.Increment();
+		AudioThreadCommands.Enqueue(InFunction);
+		AudioThreadRunnable->CommandsQueuedEvent->Trigger();
+	}
+	else
+	{
+		InFunction();
+	}
+}
+
+void FAudioThread::RunCommandOnGameThread(TFunction<void()> InFunction)
+{
+	if (bIsAudioThreadRunning && !IsInGameThread())
+	{
+		GameThreadCommands.Enqueue(InFunction);
+	}
+	else
+	{
+		InFunction();
+	}
+}
+
+void FAudioThread::ProcessGameThreadCommands()
+{
+	check(IsInGameThread());
+
+	TFunction<void()> Command;
+	while (GameThreadCommands.Dequeue(Command))
+	{
+		Command();
+	}
+}
+
+void FAudioThread::SuspendAudioThread()
+{
+	check(IsInGameThread());
+
+	if (!bIsAudioThreadRunning)
+	{
+		return;
+	}
+
+	if (SuspendCount++ == 0)
+	{
+		// The audio thread blocks in this command until it is resumed, once it reached it every earlier command has run
+		RunCommandOnAudioThread([]()
+		{
+			SuspendedEvent->Trigger();
+			ResumeEvent->Wait();
+		});
+
+		SuspendedEvent->Wait();
+	}
+}
+
+void FAudioThread::ResumeAudioThread()
+{
+	check(IsInGameThread());
+
+	if (!bIsAudioThreadRunning)
+	{
+		return;
+	}
+
+	check(SuspendCount > 0);
+	if (--SuspendCount == 0)
+	{
+		ResumeEvent->Trigger();
+	}
+}
+
+void FAudioThread::OnPreGarbageCollect()
+{
+	SuspendAudioThread();
+}
+
+void FAudioThread::OnPostGarbageCollect()
+{
+	ResumeAudioThread();
+}
@@ -69,3 +69,8 @@ bool UCurveFloat::operator==( const UCurveFloat& Curve ) const
 	return bIsEventCurve == Curve.bIsEventCurve && FloatCurve == Curve.FloatCurve;
 }
 
+bool UCurveFloat::IsSerializationThreadSafe() const
+{
+	// Only the keys are saved, subclasses may add data that can't be saved on any thread
+	return GetClass() == UCurveFloat::StaticClass();
+}
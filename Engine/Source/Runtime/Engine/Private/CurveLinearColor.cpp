@@ -91,3 +91,8 @@ bool UCurveLinearColor::IsValidCurve( FRichCurveEditInfo CurveInfo )
 		CurveInfo.CurveToEdit == &FloatCurves[2];
 }
 
+bool UCurveLinearColor::IsSerializationThreadSafe() const
+{
+	// Only the keys are saved, subclasses may add data that can't be saved on any thread
+	return GetClass() == UCurveLinearColor::StaticClass();
+}
@@ -84,6 +84,12 @@ void UCurveTable::Serialize( FArchive& Ar )
 	}
 }
 
+bool UCurveTable::IsSerializationThreadSafe() const
+{
+	// Only the rows are saved, subclasses may add data that can't be saved on any thread
+	return GetClass() == UCurveTable::StaticClass();
+}
+
 void UCurveTable::FinishDestroy()
 {
 	Super::FinishDestroy();
@@ -56,3 +56,8 @@ bool UCurveVector::IsValidCurve( FRichCurveEditInfo CurveInfo )
 		CurveInfo.CurveToEdit == &FloatCurves[2];
 }
 
+bool UCurveVector::IsSerializationThreadSafe() const
+{
+	// Only the keys are saved, subclasses may add data that can't be saved on any thread
+	return GetClass() == UCurveVector::StaticClass();
+}
@@ -170,6 +170,48 @@ void UDataTable::Serialize( FArchive& Ar )
 	}
 }
 
+static bool CanSerializeStructOnAnyThread(UStruct* Struct);
+
+/** @return true if saving a value of a property with tags only reads it and writes plain data */
+static bool CanSerializePropertyOnAnyThread(UProperty* Property)
+{
+	if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		return CanSerializePropertyOnAnyThread(ArrayProperty->Inner);
+	}
+	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		// Native serializers can run any code, like the editor fixups of string asset references
+		UScriptStruct::ICppStructOps* CppStructOps = StructProperty->Struct->GetCppStructOps();
+		return !(CppStructOps && CppStructOps->HasSerializer()) && CanSerializeStructOnAnyThread(StructProperty->Struct);
+	}
+	return Property->IsA<UNumericProperty>() || Property->IsA<UBoolProperty>() || Property->IsA<UNameProperty>() || Property->IsA<UStrProperty>() || Property->IsA<UObjectProperty>();
+}
+
+/** @return true if saving the properties of a struct or class with tags only reads them and writes plain data */
+static bool CanSerializeStructOnAnyThread(UStruct* Struct)
+{
+	// User defined structs build their default values from their editor data when saving
+	if (Struct->IsA<UUserDefinedStruct>())
+	{
+		return false;
+	}
+	for (TFieldIterator<UProperty> It(Struct); It; ++It)
+	{
+		if (!CanSerializePropertyOnAnyThread(*It))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UDataTable::IsSerializationThreadSafe() const
+{
+	// Subclasses can override Serialize, checking their properties is not enough
+	return GetClass() == UDataTable::StaticClass() && RowStruct != NULL && !RowStruct->HasAnyFlags(RF_NeedLoad) && CanSerializeStructOnAnyThread(GetClass()) && CanSerializeStructOnAnyThread(RowStruct);
+}
+
 void UDataTable::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {	
 	UDataTable* This = CastChecked<UDataTable>(InThis);
@@ -6,6 +6,7 @@
 #include "Sound/DialogueSoundWaveProxy.h"
 #include "Sound/SoundWave.h"
 #include "SubtitleManager.h"
+#include "AudioThread.h"
 
 bool operator==(const FDialogueContextMapping& LHS, const FDialogueContextMapping& RHS)
 {
@@ -74,21 +75,32 @@ void UDialogueSoundWaveProxy::Parse( class FAudioDevice* AudioDevice, const UPTR
 	// Add in the subtitle if they exist
 	if (ActiveSound.bHandleSubtitles && Subtitles.Num() > 0)
 	{
-		// TODO - Audio Threading. This would need to be a call back to the main thread.
-		if (ActiveSound.AudioComponent.IsValid() && ActiveSound.AudioComponent->OnQueueSubtitles.IsBound())
+		// Subtitles are shown by the game thread
+		TWeakObjectPtr<UAudioComponent> AudioComponentPtr = ActiveSound.AudioComponent;
+		TWeakObjectPtr<UWorld> WorldPtr = ActiveSound.World;
+		const PTRINT SubtitleID = ( PTRINT )WaveInstance;
+		const float SubtitlePriority = ActiveSound.SubtitlePriority;
+		const float SubtitleDuration = GetDuration();
+		const TArray<FSubtitleCue> SubtitleCues = Subtitles;
+
+		FAudioThread::RunCommandOnGameThread([AudioComponentPtr, WorldPtr, SubtitleID, SubtitlePriority, SubtitleDuration, SubtitleCues]()
 		{
-			// intercept the subtitles if the delegate is set
-			ActiveSound.AudioComponent->OnQueueSubtitles.ExecuteIfBound( Subtitles, GetDuration() );
-		}
-		else
-		{
-			// otherwise, pass them on to the subtitle manager for display
-			// Subtitles are hashed based on the associated sound (wave instance).
-			if( ActiveSound.World.IsValid() )
+			if (AudioComponentPtr.IsValid() && AudioComponentPtr->OnQueueSubtitles.IsBound())
 			{
-				FSubtitleManager::GetSubtitleManager()->QueueSubtitles( ( PTRINT )WaveInstance, ActiveSound.SubtitlePriority, false, false, GetDuration(), Subtitles, 0.0f );
+				// intercept the subtitles if the delegate is set
+				AudioComponentPtr->OnQueueSubtitles.ExecuteIfBound( SubtitleCues, SubtitleDuration );
 			}
-		}
+			else
+			{
+				// otherwise, pass them on to the subtitle manager for display
+				// Subtitles are hashed based on the associated sound (wave instance).
+				if( WorldPtr.IsValid() )
+				{
+					TArray<FSubtitleCue> QueuedCues = SubtitleCues;
+					FSubtitleManager::GetSubtitleManager()->QueueSubtitles( SubtitleID, SubtitlePriority, false, false, SubtitleDuration, QueuedCues, 0.0f );
+				}
+			}
+		});
 	}
 }
 
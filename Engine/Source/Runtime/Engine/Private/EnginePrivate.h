@@ -94,5 +94,6 @@ EnginePrivate.h: Unreal engine private header file.
 #include "CanvasTypes.h"							// Canvas.
 #include "EngineUtils.h"
 #include "TimerManager.h"					// Game play timers
+#include "SignificanceManager.h"			// Tick rates by significance
 #include "SlateCore.h"
 #include "SlateBasics.h"
@@ -640,7 +640,6 @@ void UGameplayStatics::PlaySound2D(UObject* WorldContextObject, class USoundBase
 
 	if ( GEngine && GEngine->UseSound() && ThisWorld->bAllowAudioPlayback && ThisWorld->GetNetMode() != NM_DedicatedServer )
 	{
-		// TODO - Audio Threading. This call would be a task call to dispatch to the audio thread
 		if ( FAudioDevice* AudioDevice = GEngine->GetAudioDevice() )
 		{
 			FActiveSound NewActiveSound;
@@ -701,7 +700,6 @@ void UGameplayStatics::PlaySoundAtLocation(UObject* WorldContextObject, class US
 				NewActiveSound.AttenuationSettings = *AttenuationSettingsToApply;
 			}
 
-			// TODO - Audio Threading. This call would be a task call to dispatch to the audio thread
 			GEngine->GetAudioDevice()->AddNewActiveSound(NewActiveSound);
 		}
 		else
@@ -756,7 +754,6 @@ void UGameplayStatics::PlayDialogueAtLocation(UObject* WorldContextObject, class
 				NewActiveSound.AttenuationSettings = *AttenuationSettingsToApply;
 			}
 
-			// TODO - Audio Threading. This call would be a task call to dispatch to the audio thread
 			GEngine->GetAudioDevice()->AddNewActiveSound(NewActiveSound);
 		}
 		else
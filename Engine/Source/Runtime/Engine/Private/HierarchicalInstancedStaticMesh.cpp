@@ -1655,6 +1655,38 @@ void UHierarchicalInstancedStaticMeshComponent::AcceptPrebuiltTree(TArray<FClust
 	MarkRenderStateDirty();
 }
 
+bool UHierarchicalInstancedStaticMeshComponent::GetPrebuiltRenderData(TSharedPtr<FPerInstanceRenderData, ESPMode::ThreadSafe>& OutRenderData, TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe>& OutClusterTree, int32& OutNumInstances) const
+{
+	if (!bPerInstanceRenderDataWasPrebuilt || !PerInstanceRenderData.IsValid() || !ClusterTreePtr.IsValid() || !NumBuiltInstances)
+	{
+		return false;
+	}
+	OutRenderData = PerInstanceRenderData;
+	OutClusterTree = ClusterTreePtr;
+	OutNumInstances = NumBuiltInstances;
+	return true;
+}
+
+void UHierarchicalInstancedStaticMeshComponent::AcceptPrebuiltRenderData(const TSharedPtr<FPerInstanceRenderData, ESPMode::ThreadSafe>& InRenderData, const TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe>& InClusterTree, int32 InNumInstances)
+{
+	// the render data and the cluster tree are never modified once prebuilt, so they can be shared with the proxies of other components
+	check(!PerInstanceSMData.Num() && !PerInstanceRenderData.IsValid());
+	check(InRenderData.IsValid() && InClusterTree.IsValid() && InNumInstances);
+	NumBuiltInstances = InNumInstances;
+	UnbuiltInstanceBounds.Init();
+	RemovedInstances.Empty();
+	InstanceReorderTable.Empty();
+	SortedInstances.Empty();
+	PerInstanceRenderData = InRenderData;
+	bPerInstanceRenderDataWasPrebuilt = true;
+	ClusterTreePtr = InClusterTree;
+	while( InstancingRandomSeed == 0 )
+	{
+		InstancingRandomSeed = FMath::Rand();
+	}
+	MarkRenderStateDirty();
+}
+
 void UHierarchicalInstancedStaticMeshComponent::BuildFlatTree(const TArray<int32>& LeafInstanceCounts)
 {
 	// Verify that the mesh is valid before using it.
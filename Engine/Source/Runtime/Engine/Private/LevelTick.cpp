@@ -1103,6 +1103,7 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		}
 		SetupPhysicsTickFunctions(DeltaSeconds);
 		TickGroup = TG_PrePhysics; // reset this to the start tick group
+		SignificanceManager->Update();
 		FTickTaskManagerInterface::Get().StartFrame(this, DeltaSeconds, TickType);
 
 		///////////////////
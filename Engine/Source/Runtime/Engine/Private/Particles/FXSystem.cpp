@@ -54,6 +54,9 @@ namespace FXConsoleVariables
 	float ParticleSlackGPU = 0.02f;
 	int32 MaxParticleTilePreAllocation = 100;
 	int32 MaxCPUParticlesPerEmitter = 1000;
+	int32 bAllowSoAUpdate = true;
+	int32 MinParticlesForSoAUpdate = 32;
+	int32 MinParticlesForParallelSoAUpdate = 512;
 	int32 MaxGPUParticlesSpawnedPerFrame = 1024 * 1024;
 	int32 GPUSpawnWarningThreshold = 20000;
 	float GPUCollisionDepthBounds = 500.0f;
@@ -111,6 +114,24 @@ namespace FXConsoleVariables
 		TEXT("Maximum number of CPU particles allowed per-emitter."),
 		ECVF_Cheat
 		);
+	FAutoConsoleVariableRef CVarAllowSoAUpdate(
+		TEXT("FX.AllowSoAUpdate"),
+		bAllowSoAUpdate,
+		TEXT("Allow CPU emitters to update their particles on structure-of-arrays streams when all their update modules support it."),
+		ECVF_Cheat
+		);
+	FAutoConsoleVariableRef CVarMinParticlesForSoAUpdate(
+		TEXT("FX.MinParticlesForSoAUpdate"),
+		MinParticlesForSoAUpdate,
+		TEXT("Minimum number of particles for a CPU emitter to use the structure-of-arrays update."),
+		ECVF_Cheat
+		);
+	FAutoConsoleVariableRef CVarMinParticlesForParallelSoAUpdate(
+		TEXT("FX.MinParticlesForParallelSoAUpdate"),
+		MinParticlesForParallelSoAUpdate,
+		TEXT("Minimum number of particles for the structure-of-arrays update of an emitter to be split across worker threads."),
+		ECVF_Cheat
+		);
 	FAutoConsoleVariableRef CVarMaxGPUParticlesSpawnedPerFrame(
 		TEXT("FX.MaxGPUParticlesSpawnedPerFrame"),
 		MaxGPUParticlesSpawnedPerFrame,
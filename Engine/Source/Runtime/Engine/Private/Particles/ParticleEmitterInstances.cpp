@@ -634,13 +634,24 @@ void FParticleEmitterInstance::Tick(float DeltaTime, bool bSuppressSpawning)
 	// Kill off any dead particles
 	KillParticles();
 
-	// Reset particle parameters.
-	ResetParticleParameters(DeltaTime);
+	// Reset particle parameters, the structure-of-arrays update does it along with the module updates.
+	const bool bUpdateSoA = CanUpdateSoA(LODLevel);
+	if (!bUpdateSoA)
+	{
+		ResetParticleParameters(DeltaTime);
+	}
 
 	// Update the particles
 	SCOPE_CYCLE_COUNTER(STAT_SpriteUpdateTime);
 	CurrentMaterial = LODLevel->RequiredModule->Material;
-	Tick_ModuleUpdate(DeltaTime, LODLevel);
+	if (bUpdateSoA)
+	{
+		Tick_ModuleUpdateSoA(DeltaTime, LODLevel);
+	}
+	else
+	{
+		Tick_ModuleUpdate(DeltaTime, LODLevel);
+	}
 
 	// Spawn new particles.
 	SpawnFraction = Tick_SpawnParticles(DeltaTime, LODLevel, bSuppressSpawning, bFirstTime);
@@ -833,6 +844,230 @@ void FParticleEmitterInstance::Tick_ModuleUpdate(float DeltaTime, UParticleLODLe
 	}
 }
 
+/*-----------------------------------------------------------------------------
+	Structure-of-arrays update.
+-----------------------------------------------------------------------------*/
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("SoA Updated Particles"), STAT_SoAUpdatedParticles, STATGROUP_Particles);
+
+/** The update modules of an emitter and their payload offsets, shared by all the chunks of its structure-of-arrays update. */
+struct FParticleSoAUpdateContext
+{
+	FParticleEmitterInstance* Instance;
+	float DeltaTime;
+	TArray<UParticleModule*, TInlineAllocator<8> > Modules;
+	TArray<int32, TInlineAllocator<8> > Offsets;
+};
+
+/**
+ *	Gathers the streams of a chunk of particles, resets them, runs the update modules on them and scatters them back.
+ *	Frozen particles are only reset, like ResetParticleParameters does, as the update modules skip them.
+ */
+static void UpdateSoAChunk(const FParticleSoAUpdateContext& Context, FParticleSoAChunk& Chunk, int32 FirstParticle, int32 NumParticles)
+{
+	FParticleEmitterInstance* Instance = Context.Instance;
+	const float DeltaTime = Context.DeltaTime;
+
+	Chunk.NumParticles = 0;
+	for (int32 ParticleIndex = FirstParticle; ParticleIndex < FirstParticle + NumParticles; ParticleIndex++)
+	{
+		DECLARE_PARTICLE_PTR(Particle, Instance->ParticleData + Instance->ParticleStride * Instance->ParticleIndices[ParticleIndex]);
+		Particle->RotationRate = Particle->BaseRotationRate;
+		if ((Particle->Flags & STATE_Particle_Freeze) != 0)
+		{
+			Particle->Velocity		= Particle->BaseVelocity;
+			Particle->Size			= GetParticleBaseSize(*Particle);
+			Particle->Color			= Particle->BaseColor;
+			Particle->RelativeTime	+= Particle->OneOverMaxLifetime * DeltaTime;
+			continue;
+		}
+
+		const int32 Index = Chunk.NumParticles++;
+		Chunk.Particles[Index] = Particle;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Chunk.GetStream(FParticleSoAChunk::Stream_VelocityX, Axis)[Index] = Particle->BaseVelocity[Axis];
+			Chunk.GetStream(FParticleSoAChunk::Stream_BaseVelocityX, Axis)[Index] = Particle->BaseVelocity[Axis];
+			Chunk.GetStream(FParticleSoAChunk::Stream_SizeX, Axis)[Index] = FMath::Abs(Particle->BaseSize[Axis]);
+		}
+		Chunk.Streams[FParticleSoAChunk::Stream_ColorR][Index] = Particle->BaseColor.R;
+		Chunk.Streams[FParticleSoAChunk::Stream_ColorG][Index] = Particle->BaseColor.G;
+		Chunk.Streams[FParticleSoAChunk::Stream_ColorB][Index] = Particle->BaseColor.B;
+		Chunk.Streams[FParticleSoAChunk::Stream_ColorA][Index] = Particle->BaseColor.A;
+		Chunk.Streams[FParticleSoAChunk::Stream_RelativeTime][Index] = Particle->RelativeTime;
+		Chunk.Streams[FParticleSoAChunk::Stream_OneOverMaxLifetime][Index] = Particle->OneOverMaxLifetime;
+	}
+	if (Chunk.NumParticles == 0)
+	{
+		return;
+	}
+
+	Chunk.NumPadded = Align(Chunk.NumParticles, 4);
+	for (int32 Stream = 0; Stream < FParticleSoAChunk::Stream_Num; Stream++)
+	{
+		for (int32 Index = Chunk.NumParticles; Index < Chunk.NumPadded; Index++)
+		{
+			Chunk.Streams[Stream][Index] = 0.0f;
+		}
+	}
+
+	// Advance the particles through their lifetime
+	const VectorRegister VectorDeltaTime = VectorSetFloat1(DeltaTime);
+	float* RESTRICT RelativeTime = Chunk.GetStream(FParticleSoAChunk::Stream_RelativeTime);
+	const float* RESTRICT OneOverMaxLifetime = Chunk.GetStream(FParticleSoAChunk::Stream_OneOverMaxLifetime);
+	for (int32 Index = 0; Index < Chunk.NumPadded; Index += 4)
+	{
+		VectorStoreAligned(VectorMultiplyAdd(VectorLoadAligned(OneOverMaxLifetime + Index), VectorDeltaTime, VectorLoadAligned(RelativeTime + Index)), RelativeTime + Index);
+	}
+
+	for (int32 ModuleIndex = 0; ModuleIndex < Context.Modules.Num(); ModuleIndex++)
+	{
+		Context.Modules[ModuleIndex]->UpdateSoA(Instance, Chunk, Context.Offsets[ModuleIndex], DeltaTime);
+	}
+
+	for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+	{
+		FBaseParticle* Particle = Chunk.Particles[Index];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Particle->Velocity[Axis] = Chunk.GetStream(FParticleSoAChunk::Stream_VelocityX, Axis)[Index];
+			Particle->BaseVelocity[Axis] = Chunk.GetStream(FParticleSoAChunk::Stream_BaseVelocityX, Axis)[Index];
+			Particle->Size[Axis] = Chunk.GetStream(FParticleSoAChunk::Stream_SizeX, Axis)[Index];
+		}
+		Particle->Color.R = Chunk.Streams[FParticleSoAChunk::Stream_ColorR][Index];
+		Particle->Color.G = Chunk.Streams[FParticleSoAChunk::Stream_ColorG][Index];
+		Particle->Color.B = Chunk.Streams[FParticleSoAChunk::Stream_ColorB][Index];
+		Particle->Color.A = Chunk.Streams[FParticleSoAChunk::Stream_ColorA][Index];
+		Particle->RelativeTime = RelativeTime[Index];
+	}
+}
+
+/** Updates a range of particles one chunk at a time, with a chunk allocated on the mem stack of the thread. */
+static void UpdateSoAParticles(const FParticleSoAUpdateContext& Context, int32 FirstParticle, int32 NumParticles)
+{
+	FMemMark Mark(FMemStack::Get());
+	FParticleSoAChunk& Chunk = *(FParticleSoAChunk*)FMemStack::Get().Alloc(sizeof(FParticleSoAChunk), 16);
+	for (int32 ChunkStart = FirstParticle; ChunkStart < FirstParticle + NumParticles; ChunkStart += PARTICLE_SOA_CHUNK_SIZE)
+	{
+		UpdateSoAChunk(Context, Chunk, ChunkStart, FMath::Min(PARTICLE_SOA_CHUNK_SIZE, FirstParticle + NumParticles - ChunkStart));
+	}
+}
+
+/** Task updating a range of the particles of an emitter on a worker thread. */
+class FParticleSoAUpdateTask
+{
+	const FParticleSoAUpdateContext& Context;
+	int32 FirstParticle;
+	int32 NumParticles;
+
+public:
+	FParticleSoAUpdateTask(const FParticleSoAUpdateContext& InContext, int32 InFirstParticle, int32 InNumParticles)
+		: Context(InContext)
+		, FirstParticle(InFirstParticle)
+		, NumParticles(InNumParticles)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FParticleSoAUpdateTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		UpdateSoAParticles(Context, FirstParticle, NumParticles);
+	}
+};
+
+/**
+ *	Returns true if the particles can be reset and updated on structure-of-arrays streams this tick
+ *
+ *	@param	CurrentLODLevel		The current LOD level for the instance
+ */
+bool FParticleEmitterInstance::CanUpdateSoA(UParticleLODLevel* InCurrentLODLevel)
+{
+	// Camera offsets and orbits are reset with the particles, but have no streams
+	if (!FXConsoleVariables::bAllowSoAUpdate || ActiveParticles < FXConsoleVariables::MinParticlesForSoAUpdate ||
+		CameraPayloadOffset > 0 || InCurrentLODLevel->OrbitModules.Num() > 0)
+	{
+		return false;
+	}
+
+	for (int32 ModuleIndex = 0; ModuleIndex < InCurrentLODLevel->UpdateModules.Num(); ModuleIndex++)
+	{
+		UParticleModule* CurrentModule = InCurrentLODLevel->UpdateModules[ModuleIndex];
+		if (CurrentModule && CurrentModule->bEnabled && CurrentModule->bUpdateModule && !CurrentModule->CanUpdateSoA(this))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ *	Tick sub-function that resets the particle parameters and handles module updates on structure-of-arrays streams
+ *
+ *	@param	DeltaTime			The current time slice
+ *	@param	CurrentLODLevel		The current LOD level for the instance
+ */
+void FParticleEmitterInstance::Tick_ModuleUpdateSoA(float DeltaTime, UParticleLODLevel* InCurrentLODLevel)
+{
+	UParticleLODLevel* HighestLODLevel = SpriteTemplate->LODLevels[0];
+	check(HighestLODLevel);
+
+	FParticleSoAUpdateContext Context;
+	Context.Instance = this;
+	Context.DeltaTime = DeltaTime;
+	for (int32 ModuleIndex = 0; ModuleIndex < InCurrentLODLevel->UpdateModules.Num(); ModuleIndex++)
+	{
+		UParticleModule* CurrentModule = InCurrentLODLevel->UpdateModules[ModuleIndex];
+		if (CurrentModule && CurrentModule->bEnabled && CurrentModule->bUpdateModule)
+		{
+			uint32* Offset = ModuleOffsetMap.Find(HighestLODLevel->UpdateModules[ModuleIndex]);
+			Context.Modules.Add(CurrentModule);
+			Context.Offsets.Add(Offset ? *Offset : 0);
+		}
+	}
+
+	// Only split the update from the game thread, emitters ticked on worker threads would block them waiting for their own tasks
+	int32 NumTasks = 1;
+	if (FXConsoleVariables::MinParticlesForParallelSoAUpdate > 0 && ActiveParticles >= FXConsoleVariables::MinParticlesForParallelSoAUpdate &&
+		IsInGameThread() && FApp::ShouldUseThreadingForPerformance())
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(ActiveParticles, PARTICLE_SOA_CHUNK_SIZE);
+		NumTasks = FMath::Min(NumChunks, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	}
+
+	if (NumTasks > 1)
+	{
+		// Each task gets whole chunks, the current thread updates the first ones
+		const int32 ParticlesPerTask = FMath::DivideAndRoundUp(FMath::DivideAndRoundUp(ActiveParticles, PARTICLE_SOA_CHUNK_SIZE), NumTasks) * PARTICLE_SOA_CHUNK_SIZE;
+		FGraphEventArray Tasks;
+		for (int32 FirstParticle = ParticlesPerTask; FirstParticle < ActiveParticles; FirstParticle += ParticlesPerTask)
+		{
+			Tasks.Add(TGraphTask<FParticleSoAUpdateTask>::CreateTask().ConstructAndDispatchWhenReady(Context, FirstParticle, FMath::Min(ParticlesPerTask, ActiveParticles - FirstParticle)));
+		}
+		UpdateSoAParticles(Context, 0, FMath::Min(ParticlesPerTask, ActiveParticles));
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks, ENamedThreads::GameThread);
+	}
+	else
+	{
+		UpdateSoAParticles(Context, 0, ActiveParticles);
+	}
+
+	INC_DWORD_STAT_BY(STAT_SoAUpdatedParticles, ActiveParticles);
+}
+
 /**
  *	Tick sub-function that handles module post updates
  *
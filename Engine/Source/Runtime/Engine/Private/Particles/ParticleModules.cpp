@@ -2274,6 +2274,39 @@ void UParticleModuleAccelerationConstant::Update(FParticleEmitterInstance* Owner
 	}
 }
 
+bool UParticleModuleAccelerationConstant::CanUpdateSoA(FParticleEmitterInstance* Owner) const
+{
+	return true;
+}
+
+void UParticleModuleAccelerationConstant::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime)
+{
+	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
+	check(LODLevel);
+	FVector LocalAcceleration = Acceleration;
+	if (bAlwaysInWorldSpace && LODLevel->RequiredModule->bUseLocalSpace)
+	{
+		LocalAcceleration = Owner->Component->ComponentToWorld.InverseTransformVector(Acceleration);
+	}
+	else if (LODLevel->RequiredModule->bUseLocalSpace)
+	{
+		LocalAcceleration = Owner->EmitterToSimulation.TransformVector(LocalAcceleration);
+	}
+	const FVector VelocityDelta = LocalAcceleration * DeltaTime;
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const VectorRegister Delta = VectorSetFloat1(VelocityDelta[Axis]);
+		float* RESTRICT Velocity = Chunk.GetStream(FParticleSoAChunk::Stream_VelocityX, Axis);
+		float* RESTRICT BaseVelocity = Chunk.GetStream(FParticleSoAChunk::Stream_BaseVelocityX, Axis);
+		for (int32 Index = 0; Index < Chunk.NumPadded; Index += 4)
+		{
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(Velocity + Index), Delta), Velocity + Index);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(BaseVelocity + Index), Delta), BaseVelocity + Index);
+		}
+	}
+}
+
 /*-----------------------------------------------------------------------------
 	ParticleModuleAccelerationDrag implementation.
 -----------------------------------------------------------------------------*/
@@ -2342,6 +2375,36 @@ void UParticleModuleAccelerationDrag::Update(FParticleEmitterInstance* Owner, in
 	END_UPDATE_LOOP;
 }
 
+bool UParticleModuleAccelerationDrag::CanUpdateSoA(FParticleEmitterInstance* Owner) const
+{
+	return true;
+}
+
+void UParticleModuleAccelerationDrag::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime)
+{
+	// The drag coefficients are evaluated one particle at a time, the velocities are updated 4 at a time
+	const float* RESTRICT RelativeTime = Chunk.GetStream(FParticleSoAChunk::Stream_RelativeTime);
+	float* RESTRICT DragScale = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0);
+	for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+	{
+		DragScale[Index] = -DragCoefficient->GetValue(RelativeTime[Index], Owner->Component);
+	}
+
+	const VectorRegister VectorDeltaTime = VectorSetFloat1(DeltaTime);
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		float* RESTRICT Velocity = Chunk.GetStream(FParticleSoAChunk::Stream_VelocityX, Axis);
+		float* RESTRICT BaseVelocity = Chunk.GetStream(FParticleSoAChunk::Stream_BaseVelocityX, Axis);
+		for (int32 Index = 0; Index < Chunk.NumPadded; Index += 4)
+		{
+			const VectorRegister Drag = VectorMultiply(VectorLoadAligned(Velocity + Index), VectorLoadAligned(DragScale + Index));
+			const VectorRegister Delta = VectorMultiply(Drag, VectorDeltaTime);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(Velocity + Index), Delta), Velocity + Index);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(BaseVelocity + Index), Delta), BaseVelocity + Index);
+		}
+	}
+}
+
 /*-----------------------------------------------------------------------------
 	ParticleModuleAccelerationDragScaleOverLife implementation.
 -----------------------------------------------------------------------------*/
@@ -2561,6 +2624,46 @@ void UParticleModuleAcceleration::Update(FParticleEmitterInstance* Owner, int32
 	}
 }
 
+bool UParticleModuleAcceleration::CanUpdateSoA(FParticleEmitterInstance* Owner) const
+{
+	return true;
+}
+
+void UParticleModuleAcceleration::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime)
+{
+	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
+	check(LODLevel);
+	const bool bTransformAcceleration = bAlwaysInWorldSpace && LODLevel->RequiredModule->bUseLocalSpace;
+	const FTransform& Mat = Owner->Component->ComponentToWorld;
+
+	// Gather the accelerations from the particle payloads
+	float* RESTRICT AccelerationX = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0);
+	float* RESTRICT AccelerationY = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch1);
+	float* RESTRICT AccelerationZ = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch2);
+	for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+	{
+		const FVector& UsedAcceleration = *((const FVector*)((const uint8*)Chunk.Particles[Index] + Offset));
+		const FVector ParticleAcceleration = bTransformAcceleration ? Mat.InverseTransformVector(UsedAcceleration) : UsedAcceleration;
+		AccelerationX[Index] = ParticleAcceleration.X;
+		AccelerationY[Index] = ParticleAcceleration.Y;
+		AccelerationZ[Index] = ParticleAcceleration.Z;
+	}
+
+	const VectorRegister VectorDeltaTime = VectorSetFloat1(DeltaTime);
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const float* RESTRICT ParticleAcceleration = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0, Axis);
+		float* RESTRICT Velocity = Chunk.GetStream(FParticleSoAChunk::Stream_VelocityX, Axis);
+		float* RESTRICT BaseVelocity = Chunk.GetStream(FParticleSoAChunk::Stream_BaseVelocityX, Axis);
+		for (int32 Index = 0; Index < Chunk.NumPadded; Index += 4)
+		{
+			const VectorRegister Delta = VectorMultiply(VectorLoadAligned(ParticleAcceleration + Index), VectorDeltaTime);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(Velocity + Index), Delta), Velocity + Index);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(BaseVelocity + Index), Delta), BaseVelocity + Index);
+		}
+	}
+}
+
 uint32 UParticleModuleAcceleration::RequiredBytes(FParticleEmitterInstance* Owner)
 {
 	// FVector UsedAcceleration
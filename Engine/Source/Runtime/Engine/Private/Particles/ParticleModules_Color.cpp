@@ -413,6 +413,46 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
 	}
 }
 
+bool UParticleModuleColorOverLife::CanUpdateSoA(FParticleEmitterInstance* Owner) const
+{
+	return true;
+}
+
+void UParticleModuleColorOverLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime)
+{
+	const FRawDistribution* FastColorOverLife = ColorOverLife.GetFastRawDistribution();
+	const FRawDistribution* FastAlphaOverLife = AlphaOverLife.GetFastRawDistribution();
+	const float* RESTRICT RelativeTime = Chunk.GetStream(FParticleSoAChunk::Stream_RelativeTime);
+	float* RESTRICT ColorR = Chunk.GetStream(FParticleSoAChunk::Stream_ColorR);
+	float* RESTRICT ColorG = Chunk.GetStream(FParticleSoAChunk::Stream_ColorG);
+	float* RESTRICT ColorB = Chunk.GetStream(FParticleSoAChunk::Stream_ColorB);
+	float* RESTRICT ColorA = Chunk.GetStream(FParticleSoAChunk::Stream_ColorA);
+	if( FastColorOverLife && FastAlphaOverLife )
+	{
+		// fast path
+		FVector ColorVec;
+		for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+		{
+			FastColorOverLife->GetValue3None(RelativeTime[Index], &ColorVec.X);
+			FastAlphaOverLife->GetValue1None(RelativeTime[Index], &ColorA[Index]);
+			ColorR[Index] = ColorVec.X;
+			ColorG[Index] = ColorVec.Y;
+			ColorB[Index] = ColorVec.Z;
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+		{
+			const FVector ColorVec = ColorOverLife.GetValue(RelativeTime[Index], Owner->Component);
+			ColorR[Index] = ColorVec.X;
+			ColorG[Index] = ColorVec.Y;
+			ColorB[Index] = ColorVec.Z;
+			ColorA[Index] = AlphaOverLife.GetValue(RelativeTime[Index], Owner->Component);
+		}
+	}
+}
+
 void UParticleModuleColorOverLife::SetToSensibleDefaults(UParticleEmitter* Owner)
 {
 	ColorOverLife.Distribution = NewObject<UDistributionVectorConstantCurve>(this);
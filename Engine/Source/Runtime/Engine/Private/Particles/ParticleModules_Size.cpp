@@ -299,6 +299,55 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 	}
 }
 
+bool UParticleModuleSizeMultiplyLife::CanUpdateSoA(FParticleEmitterInstance* Owner) const
+{
+	return true;
+}
+
+void UParticleModuleSizeMultiplyLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime)
+{
+	const bool bMultiply[3] = { !!MultiplyX, !!MultiplyY, !!MultiplyZ };
+	if (!bMultiply[0] && !bMultiply[1] && !bMultiply[2])
+	{
+		return;
+	}
+
+	// The scales are evaluated one particle at a time, the sizes are multiplied 4 at a time
+	const FRawDistribution* FastDistribution = (MultiplyX && MultiplyY && MultiplyZ) ? LifeMultiplier.GetFastRawDistribution() : NULL;
+	const float* RESTRICT RelativeTime = Chunk.GetStream(FParticleSoAChunk::Stream_RelativeTime);
+	float* RESTRICT ScaleX = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0);
+	float* RESTRICT ScaleY = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch1);
+	float* RESTRICT ScaleZ = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch2);
+	FVector SizeScale;
+	for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+	{
+		if (FastDistribution)
+		{
+			FastDistribution->GetValue3None(RelativeTime[Index], &SizeScale.X);
+		}
+		else
+		{
+			SizeScale = LifeMultiplier.GetValue(RelativeTime[Index], Owner->Component);
+		}
+		ScaleX[Index] = SizeScale.X;
+		ScaleY[Index] = SizeScale.Y;
+		ScaleZ[Index] = SizeScale.Z;
+	}
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (bMultiply[Axis])
+		{
+			const float* RESTRICT Scale = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0, Axis);
+			float* RESTRICT Size = Chunk.GetStream(FParticleSoAChunk::Stream_SizeX, Axis);
+			for (int32 Index = 0; Index < Chunk.NumPadded; Index += 4)
+			{
+				VectorStoreAligned(VectorMultiply(VectorLoadAligned(Size + Index), VectorLoadAligned(Scale + Index)), Size + Index);
+			}
+		}
+	}
+}
+
 void UParticleModuleSizeMultiplyLife::SetToSensibleDefaults(UParticleEmitter* Owner)
 {
 	LifeMultiplier.Distribution = NewObject<UDistributionVectorConstantCurve>(this);
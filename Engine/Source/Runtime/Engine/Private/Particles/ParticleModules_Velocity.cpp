@@ -372,6 +372,72 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 	}
 }
 
+bool UParticleModuleVelocityOverLifetime::CanUpdateSoA(FParticleEmitterInstance* Owner) const
+{
+	return true;
+}
+
+void UParticleModuleVelocityOverLifetime::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAChunk& Chunk, int32 Offset, float DeltaTime)
+{
+	check(Owner && Owner->Component);
+	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
+	check(LODLevel);
+	FVector OwnerScale(1.0f);
+	if (bApplyOwnerScale == true)
+	{
+		OwnerScale = Owner->Component->ComponentToWorld.GetScale3D();
+	}
+
+	// The distribution is in the space of the particles unless bInWorldSpace disagrees with bUseLocalSpace
+	bool bTransform = false;
+	FMatrix Transform = FMatrix::Identity;
+	if (LODLevel->RequiredModule->bUseLocalSpace == bInWorldSpace)
+	{
+		const FMatrix LocalToWorld = Owner->Component->ComponentToWorld.ToMatrixNoScale();
+		Transform = bInWorldSpace ? LocalToWorld.InverseFast() : LocalToWorld;
+		bTransform = true;
+	}
+
+	// The velocities are evaluated one particle at a time, then transformed and applied 4 at a time
+	const float* RESTRICT RelativeTime = Chunk.GetStream(FParticleSoAChunk::Stream_RelativeTime);
+	float* RESTRICT VelX = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0);
+	float* RESTRICT VelY = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch1);
+	float* RESTRICT VelZ = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch2);
+	for (int32 Index = 0; Index < Chunk.NumParticles; Index++)
+	{
+		const FVector Vel = VelOverLife.GetValue(RelativeTime[Index], Owner->Component);
+		VelX[Index] = Vel.X;
+		VelY[Index] = Vel.Y;
+		VelZ[Index] = Vel.Z;
+	}
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const VectorRegister RowX = VectorSetFloat1(Transform.M[0][Axis]);
+		const VectorRegister RowY = VectorSetFloat1(Transform.M[1][Axis]);
+		const VectorRegister RowZ = VectorSetFloat1(Transform.M[2][Axis]);
+		const VectorRegister Scale = VectorSetFloat1(OwnerScale[Axis]);
+		const float* RESTRICT AxisVel = Chunk.GetStream(FParticleSoAChunk::Stream_Scratch0, Axis);
+		float* RESTRICT Velocity = Chunk.GetStream(FParticleSoAChunk::Stream_VelocityX, Axis);
+		for (int32 Index = 0; Index < Chunk.NumPadded; Index += 4)
+		{
+			VectorRegister Vel;
+			if (bTransform)
+			{
+				Vel = VectorAdd(
+					VectorAdd(VectorMultiply(VectorLoadAligned(VelX + Index), RowX), VectorMultiply(VectorLoadAligned(VelY + Index), RowY)),
+					VectorMultiply(VectorLoadAligned(VelZ + Index), RowZ));
+			}
+			else
+			{
+				Vel = VectorLoadAligned(AxisVel + Index);
+			}
+			Vel = VectorMultiply(Vel, Scale);
+			VectorStoreAligned(Absolute ? Vel : VectorMultiply(VectorLoadAligned(Velocity + Index), Vel), Velocity + Index);
+		}
+	}
+}
+
 /*-----------------------------------------------------------------------------
 	UParticleModuleVelocityCone implementation.
 -----------------------------------------------------------------------------*/
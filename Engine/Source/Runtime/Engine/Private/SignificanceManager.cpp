@@ -0,0 +1,255 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SignificanceManager.cpp: Tick rates by significance to the players
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "SignificanceManager.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Manager Update"),STAT_SignificanceManagerUpdate,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Actors Updated"),STAT_SignificanceActorsUpdated,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Bucket Changes"),STAT_SignificanceBucketChanges,STATGROUP_Game);
+
+static TAutoConsoleVariable<int32> CVarSignificanceUpdatesPerFrame(
+	TEXT("SignificanceUpdatesPerFrame"),
+	256,
+	TEXT("Number of registered actors whose significance is updated each frame by the significance manager."));
+
+/** Actors rendered within this many seconds count as on screen. */
+static const float SignificanceRecentlyRenderedTime = 1.0f;
+
+void FSignificanceManager::RegisterActor(AActor* Actor, const FSignificanceDistanceDelegate& DistanceDelegate)
+{
+	check(IsInGameThread());
+	check(Actor);
+
+	if (ManagedActorIndices.Contains(Actor))
+	{
+		ManagedActors[ManagedActorIndices.FindChecked(Actor)].DistanceDelegate = DistanceDelegate;
+		return;
+	}
+
+	const int32 Index = ManagedActors.AddZeroed();
+	FManagedActor& ManagedActor = ManagedActors[Index];
+	ManagedActor.Actor = Actor;
+	ManagedActor.ActorKey = Actor;
+	ManagedActor.DistanceDelegate = DistanceDelegate;
+	ManagedActor.BaseTickInterval = Actor->PrimaryActorTick.TickInterval;
+	ManagedActor.BucketIndex = INDEX_NONE;
+	ManagedActorIndices.Add(Actor, Index);
+}
+
+void FSignificanceManager::UnregisterActor(AActor* Actor)
+{
+	check(IsInGameThread());
+
+	const int32* Index = ManagedActorIndices.Find(Actor);
+	if (Index)
+	{
+		const int32 ActorIndex = *Index;
+		// actors already pending kill, e.g. unregistered after Destroy() or from BeginDestroy, have nothing to restore
+		const AActor* ManagedActor = ManagedActors[ActorIndex].Actor.Get();
+		if (ManagedActor && !ManagedActor->IsPendingKill())
+		{
+			ApplyBucket(ManagedActors[ActorIndex], INDEX_NONE);
+		}
+		RemoveManagedActor(ActorIndex);
+	}
+}
+
+int32 FSignificanceManager::GetActorBucket(const AActor* Actor) const
+{
+	const int32* Index = ManagedActorIndices.Find(Actor);
+	return Index ? ManagedActors[*Index].BucketIndex : INDEX_NONE;
+}
+
+void FSignificanceManager::RemoveManagedActor(int32 Index)
+{
+	ManagedActorIndices.Remove(ManagedActors[Index].ActorKey);
+	ManagedActors.RemoveAtSwap(Index);
+	if (Index < ManagedActors.Num())
+	{
+		// the last actor moved in the hole
+		ManagedActorIndices.Add(ManagedActors[Index].ActorKey, Index);
+	}
+}
+
+void FSignificanceManager::GatherViewLocations()
+{
+	ViewLocations.Reset();
+	ViewLocations.Append(World->ViewLocationsRenderedLastFrame);
+
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = *Iterator;
+		if (PlayerController)
+		{
+			FVector Location;
+			FRotator Rotation;
+			PlayerController->GetPlayerViewPoint(Location, Rotation);
+			ViewLocations.Add(Location);
+		}
+	}
+}
+
+float FSignificanceManager::GetSignificanceDistance(const FManagedActor& ManagedActor, bool bHasRenderedViews) const
+{
+	const AActor* Actor = ManagedActor.Actor.Get();
+	if (ManagedActor.DistanceDelegate.IsBound())
+	{
+		return ManagedActor.DistanceDelegate.Execute(Actor, ViewLocations);
+	}
+
+	const FVector ActorLocation = Actor->GetActorLocation();
+	float MinDistanceSquared = MAX_FLT;
+	for (int32 ViewIndex = 0; ViewIndex < ViewLocations.Num(); ViewIndex++)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(ActorLocation, ViewLocations[ViewIndex]));
+	}
+	float Distance = FMath::Sqrt(MinDistanceSquared);
+
+	// render times are only meaningful when this world renders views, servers only have the players' view points
+	if (bHasRenderedViews && World->GetTimeSeconds() - Actor->GetLastRenderTime() > SignificanceRecentlyRenderedTime)
+	{
+		AWorldSettings* WorldSettings = World->GetWorldSettings();
+		Distance *= FMath::Max(WorldSettings->OffscreenSignificanceDistanceScale, 1.0f);
+	}
+	return Distance;
+}
+
+void FSignificanceManager::ApplyBucket(FManagedActor& ManagedActor, int32 BucketIndex)
+{
+	AActor* Actor = ManagedActor.Actor.Get();
+	check(Actor);
+
+	const FSignificanceBucket* Bucket = nullptr;
+	if (BucketIndex != INDEX_NONE)
+	{
+		Bucket = &World->GetWorldSettings()->SignificanceBuckets[BucketIndex];
+	}
+	ManagedActor.BucketIndex = BucketIndex;
+
+	Actor->PrimaryActorTick.TickInterval = Bucket ? FMath::Max(ManagedActor.BaseTickInterval, Bucket->TickInterval) : ManagedActor.BaseTickInterval;
+
+	// forget the components that went away
+	for (int32 Index = ManagedActor.Components.Num() - 1; Index >= 0; Index--)
+	{
+		if (!ManagedActor.Components[Index].Component.IsValid())
+		{
+			ManagedActor.Components.RemoveAtSwap(Index);
+		}
+	}
+
+	TInlineComponentArray<UActorComponent*> Components;
+	Actor->GetComponents(Components);
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		UActorComponent* Component = Components[ComponentIndex];
+		if (!Component->PrimaryComponentTick.bCanEverTick)
+		{
+			continue;
+		}
+
+		FManagedComponent* ManagedComponent = ManagedActor.Components.FindByPredicate([Component](const FManagedComponent& Managed){ return Managed.Component.Get() == Component; });
+		if (!ManagedComponent)
+		{
+			if (!Bucket)
+			{
+				// never throttled, nothing to restore
+				continue;
+			}
+
+			// components added after registration are picked up here
+			ManagedComponent = &ManagedActor.Components[ManagedActor.Components.AddZeroed()];
+			ManagedComponent->Component = Component;
+			ManagedComponent->BaseTickInterval = Component->PrimaryComponentTick.TickInterval;
+		}
+
+		float BucketTickInterval = 0.0f;
+		if (Bucket)
+		{
+			if (Component->IsA(USkeletalMeshComponent::StaticClass()))
+			{
+				BucketTickInterval = Bucket->AnimationTickInterval;
+			}
+			else if (Component->IsA(UParticleSystemComponent::StaticClass()))
+			{
+				BucketTickInterval = Bucket->ParticleTickInterval;
+			}
+			else
+			{
+				BucketTickInterval = Bucket->TickInterval;
+			}
+		}
+		Component->PrimaryComponentTick.TickInterval = FMath::Max(ManagedComponent->BaseTickInterval, BucketTickInterval);
+	}
+
+	if (!Bucket)
+	{
+		ManagedActor.Components.Reset();
+	}
+}
+
+void FSignificanceManager::Update()
+{
+	check(IsInGameThread());
+
+	if (!ManagedActors.Num())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SignificanceManagerUpdate);
+
+	AWorldSettings* WorldSettings = World->GetWorldSettings();
+	const int32 NumBuckets = WorldSettings ? WorldSettings->SignificanceBuckets.Num() : 0;
+
+	const bool bHasRenderedViews = World->ViewLocationsRenderedLastFrame.Num() > 0;
+	GatherViewLocations();
+
+	const int32 NumToUpdate = FMath::Min(FMath::Max(CVarSignificanceUpdatesPerFrame.GetValueOnGameThread(), 1), ManagedActors.Num());
+	for (int32 Count = 0; Count < NumToUpdate && ManagedActors.Num(); Count++)
+	{
+		if (NextUpdateIndex >= ManagedActors.Num())
+		{
+			NextUpdateIndex = 0;
+		}
+
+		FManagedActor& ManagedActor = ManagedActors[NextUpdateIndex];
+		AActor* Actor = ManagedActor.Actor.Get();
+		if (!Actor || Actor->IsPendingKill())
+		{
+			// destroyed without being unregistered, the last actor moves in this slot
+			RemoveManagedActor(NextUpdateIndex);
+			continue;
+		}
+
+		// without buckets or players, everything ticks at its own rate
+		int32 BucketIndex = INDEX_NONE;
+		if (NumBuckets && ViewLocations.Num())
+		{
+			const float Distance = GetSignificanceDistance(ManagedActor, bHasRenderedViews);
+			const TArray<FSignificanceBucket>& Buckets = WorldSettings->SignificanceBuckets;
+			for (BucketIndex = 0; BucketIndex < NumBuckets - 1; BucketIndex++)
+			{
+				if (Distance <= Buckets[BucketIndex].MaxDistance)
+				{
+					break;
+				}
+			}
+		}
+
+		// tick intervals are only touched on a bucket transition, components added since then are picked up on the next one
+		if (BucketIndex != ManagedActor.BucketIndex)
+		{
+			ApplyBucket(ManagedActor, BucketIndex);
+			INC_DWORD_STAT(STAT_SignificanceBucketChanges);
+		}
+		NextUpdateIndex++;
+	}
+
+	INC_DWORD_STAT_BY(STAT_SignificanceActorsUpdated, NumToUpdate);
+}
@@ -0,0 +1,71 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "SignificanceManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSignificanceManagerBucketTest, "Engine.SignificanceManager.Bucket Transitions", EAutomationTestFlags::ATF_Editor)
+
+bool FSignificanceManagerBucketTest::RunTest(const FString& Parameters)
+{
+	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext &WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	AWorldSettings* WorldSettings = World->GetWorldSettings();
+	WorldSettings->SignificanceBuckets.SetNum(2);
+	WorldSettings->SignificanceBuckets[0].MaxDistance = 1000.f;
+	WorldSettings->SignificanceBuckets[0].TickInterval = 0.f;
+	WorldSettings->SignificanceBuckets[1].MaxDistance = 5000.f;
+	WorldSettings->SignificanceBuckets[1].TickInterval = 0.5f;
+	World->ViewLocationsRenderedLastFrame.Add(FVector::ZeroVector);
+
+	AActor* Actor = World->SpawnActor<AActor>();
+	Actor->PrimaryActorTick.TickInterval = 0.f;
+
+	float Distance = 100.f;
+	FSignificanceManager& SignificanceManager = World->GetSignificanceManager();
+	SignificanceManager.RegisterActor(Actor, FSignificanceDistanceDelegate::CreateLambda([&Distance](const AActor*, const TArray<FVector>&) { return Distance; }));
+	TestEqual(TEXT("Bucket after registering"), SignificanceManager.GetActorBucket(Actor), (int32)INDEX_NONE);
+
+	SignificanceManager.Update();
+	TestEqual(TEXT("Bucket of a near actor"), SignificanceManager.GetActorBucket(Actor), 0);
+	TestEqual(TEXT("Tick interval of a near actor"), Actor->PrimaryActorTick.TickInterval, 0.f);
+
+	Distance = 3000.f;
+	SignificanceManager.Update();
+	TestEqual(TEXT("Bucket of a far actor"), SignificanceManager.GetActorBucket(Actor), 1);
+	TestEqual(TEXT("Tick interval of a far actor"), Actor->PrimaryActorTick.TickInterval, 0.5f);
+
+	// staying in the same bucket must not apply it again
+	Actor->PrimaryActorTick.TickInterval = 0.25f;
+	SignificanceManager.Update();
+	TestEqual(TEXT("Tick interval without a bucket transition"), Actor->PrimaryActorTick.TickInterval, 0.25f);
+
+	Distance = 100.f;
+	SignificanceManager.Update();
+	TestEqual(TEXT("Bucket of an actor back near"), SignificanceManager.GetActorBucket(Actor), 0);
+	TestEqual(TEXT("Tick interval of an actor back near"), Actor->PrimaryActorTick.TickInterval, 0.f);
+
+	Distance = 3000.f;
+	SignificanceManager.Update();
+	SignificanceManager.UnregisterActor(Actor);
+	TestEqual(TEXT("Tick interval after unregistering"), Actor->PrimaryActorTick.TickInterval, 0.f);
+
+	// destroyed actors can still be unregistered, their registration is dropped without touching them
+	AActor* DestroyedActor = World->SpawnActor<AActor>();
+	SignificanceManager.RegisterActor(DestroyedActor, FSignificanceDistanceDelegate::CreateLambda([&Distance](const AActor*, const TArray<FVector>&) { return Distance; }));
+	SignificanceManager.Update();
+	TestEqual(TEXT("Bucket of an actor before destroying it"), SignificanceManager.GetActorBucket(DestroyedActor), 1);
+	DestroyedActor->Destroy();
+	SignificanceManager.UnregisterActor(DestroyedActor);
+	TestEqual(TEXT("Bucket after unregistering a destroyed actor"), SignificanceManager.GetActorBucket(DestroyedActor), (int32)INDEX_NONE);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
@@ -105,6 +105,10 @@ USkeletalMeshComponent::USkeletalMeshComponent(const FObjectInitializer& ObjectI
 	bWantsInitializeComponent = true;
 	GlobalAnimRateScale = 1.0f;
 	bNoSkeletonUpdate = false;
+	bEnableAnimationSharing = false;
+	AnimationSharingTimeStep = 1.f / 30.f;
+	AnimationSharingAdditiveWeight = 1.f;
+	AnimationSharingAdditiveTime = 0.f;
 	MeshComponentUpdateFlag = EMeshComponentUpdateFlag::AlwaysTickPoseAndRefreshBones;
 	KinematicBonesUpdateType = EKinematicBonesUpdateToPhysics::SkipSimulatingBones;
 	bGenerateOverlapEvents = false;
@@ -489,6 +493,11 @@ void USkeletalMeshComponent::TickAnimation(float DeltaTime)
 				UpdateMaterialParameters();
 			}
 		}
+
+		if (bEnableAnimationSharing && AnimationSharingAdditive && AnimationSharingAdditive->SequenceLength > 0.f)
+		{
+			AnimationSharingAdditiveTime = FMath::Fmod(AnimationSharingAdditiveTime + DeltaTime * GlobalAnimRateScale, AnimationSharingAdditive->SequenceLength);
+		}
 	}
 }
 
@@ -940,6 +949,84 @@ void USkeletalMeshComponent::PerformAnimationEvaluation(const USkeletalMesh* InS
 	FillSpaceBases(InSkeletalMesh, OutLocalAtoms, OutSpaceBases);
 }
 
+bool USkeletalMeshComponent::GetAnimationSharingKey(FAnimationSharingKey& OutKey) const
+{
+	// Only a single sequence player has a pose that is fully described by its asset and time
+	const UAnimSingleNodeInstance* SingleNodeInstance = Cast<UAnimSingleNodeInstance>(AnimScriptInstance);
+	if (!bEnableAnimationSharing || bForceRefpose || AnimationSharingTimeStep <= 0.f || !SingleNodeInstance || SingleNodeInstance->MontageInstances.Num() > 0)
+	{
+		return false;
+	}
+
+	UAnimSequence* Sequence = Cast<UAnimSequence>(SingleNodeInstance->CurrentAsset);
+	if (!Sequence)
+	{
+		return false;
+	}
+
+	OutKey.SkeletalMesh = SkeletalMesh;
+	OutKey.AnimationAsset = Sequence;
+	OutKey.TimeIndex = FMath::FloorToInt(SingleNodeInstance->CurrentTime / AnimationSharingTimeStep);
+	OutKey.TimeStep = AnimationSharingTimeStep;
+	OutKey.LODLevel = PredictedLODLevel;
+	return true;
+}
+
+bool USkeletalMeshComponent::CopySharedPose()
+{
+	const FAnimationSharedPose* SharedPose = FAnimationSharingManager::Get().FindPose(AnimEvaluationContext.SharedPoseKey);
+	if (!SharedPose || SharedPose->LocalAtoms.Num() != LocalAtoms.Num() || SharedPose->SpaceBases.Num() != GetNumSpaceBases())
+	{
+		return false;
+	}
+
+	(AnimEvaluationContext.bDoInterpolation ? CachedLocalAtoms : LocalAtoms) = SharedPose->LocalAtoms;
+	(AnimEvaluationContext.bDoInterpolation ? CachedSpaceBases : GetEditableSpaceBases()) = SharedPose->SpaceBases;
+	ActiveVertexAnims = SharedPose->VertexAnims;
+	RootBoneTranslation = SharedPose->RootBoneTranslation;
+	return true;
+}
+
+void USkeletalMeshComponent::CompleteFollowedSharedPose()
+{
+	AnimEvaluationContext.bFollowSharedPose = false;
+	if ((AnimEvaluationContext.AnimInstance != AnimScriptInstance) || (AnimEvaluationContext.SkeletalMesh != SkeletalMesh))
+	{
+		AnimEvaluationContext.Clear();
+		return;
+	}
+
+	if (!CopySharedPose())
+	{
+		// The leader was destroyed or changed its mesh before publishing, evaluate and publish the pose here instead
+		if (AnimEvaluationContext.bDoInterpolation)
+		{
+			PerformAnimationEvaluation(SkeletalMesh, AnimScriptInstance, CachedSpaceBases, CachedLocalAtoms, ActiveVertexAnims, RootBoneTranslation);
+		}
+		else
+		{
+			PerformAnimationEvaluation(SkeletalMesh, AnimScriptInstance, GetEditableSpaceBases(), LocalAtoms, ActiveVertexAnims, RootBoneTranslation);
+		}
+		AnimEvaluationContext.bPublishSharedPose = true;
+	}
+
+	PostAnimEvaluation(AnimEvaluationContext);
+}
+
+bool USkeletalMeshComponent::ApplyAnimationSharingAdditive(const UAnimInstance* InAnimInstance, TArray<FTransform>& InOutLocalAtoms) const
+{
+	if (!AnimationSharingAdditive || !AnimationSharingAdditive->IsValidAdditive() || AnimationSharingAdditiveWeight <= ZERO_ANIMWEIGHT_THRESH || !InAnimInstance || !InAnimInstance->RequiredBones.IsValid())
+	{
+		return false;
+	}
+
+	FTransformArrayA2 AdditiveAtoms;
+	AdditiveAtoms.Init(FTransform::Identity, InOutLocalAtoms.Num());
+	FAnimationRuntime::GetPoseFromSequence(AnimationSharingAdditive, InAnimInstance->RequiredBones, AdditiveAtoms, FAnimExtractContext(AnimationSharingAdditiveTime));
+	FAnimationRuntime::BlendAdditivePose(InOutLocalAtoms, AdditiveAtoms, AnimationSharingAdditiveWeight, InAnimInstance->RequiredBones, InOutLocalAtoms);
+	return true;
+}
+
 const TCHAR* B(bool b)
 {
 	return b ? TEXT("true") : TEXT("false");
@@ -988,6 +1075,36 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 	}
 
 	const bool bDoPAE = !!CVarUseParallelAnimationEvaluation.GetValueOnGameThread() && FApp::ShouldUseThreadingForPerformance();
+
+	AnimEvaluationContext.bUseAnimationSharing = AnimEvaluationContext.bDoEvaluation && GetAnimationSharingKey(AnimEvaluationContext.SharedPoseKey);
+	AnimEvaluationContext.bPublishSharedPose = false;
+	AnimEvaluationContext.bFollowSharedPose = false;
+	if (AnimEvaluationContext.bUseAnimationSharing)
+	{
+		if (CopySharedPose())
+		{
+			// Another component already evaluated this pose, skip evaluation altogether
+			PostAnimEvaluation(AnimEvaluationContext);
+			return;
+		}
+
+		// Components are all dispatched before any of them completes, so with parallel evaluation the leader
+		// has usually not published the pose yet. Wait for it on the game thread rather than evaluating it again.
+		FGraphEventRef LeaderCompletionEvent = (TickFunction && bDoPAE) ? FAnimationSharingManager::Get().FindPendingEvaluation(AnimEvaluationContext.SharedPoseKey) : FGraphEventRef();
+		if (LeaderCompletionEvent.IsValid())
+		{
+			AnimEvaluationContext.bFollowSharedPose = true;
+
+			FGraphEventArray Prerequistes;
+			Prerequistes.Add(LeaderCompletionEvent);
+			FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this);
+
+			TickFunction->GetCompletionHandle()->DontCompleteUntil(TickCompletionEvent);
+			return;
+		}
+		AnimEvaluationContext.bPublishSharedPose = true;
+	}
+
 	if (AnimEvaluationContext.bDoEvaluation && TickFunction && bDoPAE)
 	{
 		if (SkeletalMesh->RefSkeleton.GetNum() != AnimEvaluationContext.LocalAtoms.Num())
@@ -1006,6 +1123,12 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 		Prerequistes.Add(EvaluationTickEvent);
 		FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this);
 
+		if (AnimEvaluationContext.bPublishSharedPose)
+		{
+			// The pose is published in PostAnimEvaluation, on completion
+			FAnimationSharingManager::Get().BeginEvaluation(AnimEvaluationContext.SharedPoseKey, TickCompletionEvent);
+		}
+
 		TickFunction->GetCompletionHandle()->DontCompleteUntil(TickCompletionEvent);
 	}
 	else
@@ -1042,6 +1165,24 @@ void USkeletalMeshComponent::PostAnimEvaluation(FAnimationEvaluationContext& Eva
 	AnimEvaluationContext.Clear();
 
 	SCOPE_CYCLE_COUNTER(STAT_PostAnimEvaluation);
+	if (EvaluationContext.bUseAnimationSharing)
+	{
+		TArray<FTransform>& EvaluatedLocalAtoms = EvaluationContext.bDoInterpolation ? CachedLocalAtoms : LocalAtoms;
+		TArray<FTransform>& EvaluatedSpaceBases = EvaluationContext.bDoInterpolation ? CachedSpaceBases : GetEditableSpaceBases();
+
+		// Publish before the per component additive so the shared pose stays the plain sequence pose
+		if (EvaluationContext.bPublishSharedPose)
+		{
+			FAnimationSharingManager::Get().PublishPose(EvaluationContext.SharedPoseKey, EvaluatedLocalAtoms, EvaluatedSpaceBases, ActiveVertexAnims, RootBoneTranslation);
+		}
+
+		if (ApplyAnimationSharingAdditive(AnimScriptInstance, EvaluatedLocalAtoms))
+		{
+			FillSpaceBases(SkeletalMesh, EvaluatedLocalAtoms, EvaluatedSpaceBases);
+			RootBoneTranslation = EvaluatedLocalAtoms[0].GetTranslation() - SkeletalMesh->RefSkeleton.GetRefBonePose()[0].GetTranslation();
+		}
+	}
+
 	if (EvaluationContext.bDuplicateToCacheBones)
 	{
 		CachedSpaceBases = GetEditableSpaceBases();
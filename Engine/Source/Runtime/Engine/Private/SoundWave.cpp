@@ -9,6 +9,7 @@
 #include "TargetPlatform.h"
 #include "AudioDerivedData.h"
 #include "SubtitleManager.h"
+#include "AudioThread.h"
 #include "DerivedDataCacheInterface.h"
 /*-----------------------------------------------------------------------------
 	FStreamedAudioChunk
@@ -483,20 +484,39 @@ FWaveInstance* USoundWave::HandleStart( FActiveSound& ActiveSound, const UPTRINT
 	// Add in the subtitle if they exist
 	if (ActiveSound.bHandleSubtitles && Subtitles.Num() > 0)
 	{
-		if (UAudioComponent* AudioComponent = ActiveSound.AudioComponent.Get())
+		if (ActiveSound.AudioComponent.IsValid())
 		{
-			// TODO - Audio Threading. This would need to be a call back to the main thread.
-			if (AudioComponent->OnQueueSubtitles.IsBound())
+			// Subtitles are shown by the game thread
+			TWeakObjectPtr<UAudioComponent> AudioComponentPtr = ActiveSound.AudioComponent;
+			TWeakObjectPtr<UWorld> WorldPtr = ActiveSound.World;
+			const PTRINT SubtitleID = ( PTRINT )WaveInstance;
+			const float SubtitlePriority = ActiveSound.SubtitlePriority;
+			const bool bWrap = bManualWordWrap;
+			const bool bSingle = bSingleLine;
+			const float SubtitleDuration = Duration;
+			const TArray<FSubtitleCue> SubtitleCues = Subtitles;
+
+			FAudioThread::RunCommandOnGameThread([AudioComponentPtr, WorldPtr, SubtitleID, SubtitlePriority, bWrap, bSingle, SubtitleDuration, SubtitleCues]()
 			{
-				// intercept the subtitles if the delegate is set
-				ActiveSound.AudioComponent->OnQueueSubtitles.ExecuteIfBound( Subtitles, Duration );
-			}
-			else
-			{
-				// otherwise, pass them on to the subtitle manager for display
-				// Subtitles are hashed based on the associated sound (wave instance).
-				FSubtitleManager::GetSubtitleManager()->QueueSubtitles( ( PTRINT )WaveInstance, ActiveSound.SubtitlePriority, bManualWordWrap, bSingleLine, Duration, Subtitles, ActiveSound.World->GetAudioTimeSeconds() );
-			}
+				UAudioComponent* AudioComponent = AudioComponentPtr.Get();
+				if (AudioComponent == nullptr)
+				{
+					return;
+				}
+
+				if (AudioComponent->OnQueueSubtitles.IsBound())
+				{
+					// intercept the subtitles if the delegate is set
+					AudioComponent->OnQueueSubtitles.ExecuteIfBound( SubtitleCues, SubtitleDuration );
+				}
+				else if (WorldPtr.IsValid())
+				{
+					// otherwise, pass them on to the subtitle manager for display
+					// Subtitles are hashed based on the associated sound (wave instance).
+					TArray<FSubtitleCue> QueuedCues = SubtitleCues;
+					FSubtitleManager::GetSubtitleManager()->QueueSubtitles( SubtitleID, SubtitlePriority, bWrap, bSingle, SubtitleDuration, QueuedCues, WorldPtr->GetAudioTimeSeconds() );
+				}
+			});
 		}
 	}
 
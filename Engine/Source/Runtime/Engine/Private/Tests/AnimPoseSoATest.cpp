@@ -0,0 +1,196 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "AnimPoseSoA.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnimPoseSoATest, "Engine.Animation.SoA Pose Blending", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Game)
+
+namespace AnimPoseSoATest
+{
+	const int32 NumBones = 150;
+	const int32 NumPoses = 3;
+	const int32 NumIterations = 2000;
+	const float Tolerance = 1.e-4f;
+
+	FTransform MakeRandomTransform(FRandomStream& Random)
+	{
+		const FRotator Rotation(Random.FRandRange(-180.f, 180.f), Random.FRandRange(-180.f, 180.f), Random.FRandRange(-180.f, 180.f));
+		const FVector Translation = Random.GetUnitVector() * Random.FRandRange(0.f, 100.f);
+		const FVector Scale3D(Random.FRandRange(0.5f, 2.f), Random.FRandRange(0.5f, 2.f), Random.FRandRange(0.5f, 2.f));
+		return FTransform(Rotation.Quaternion(), Translation, Scale3D);
+	}
+
+	/** Largest difference of any component, treating q and -q as the same rotation */
+	float GetMaxError(const FTransformArrayA2& A, const FTransformArrayA2& B)
+	{
+		float MaxError = 0.f;
+		for (int32 BoneIndex = 0; BoneIndex < A.Num(); ++BoneIndex)
+		{
+			const FQuat RotationA = A[BoneIndex].GetRotation();
+			const FQuat RotationB = B[BoneIndex].GetRotation();
+			const float RotationError = FMath::Min((RotationA - RotationB).Size(), (RotationA + RotationB).Size());
+			const float TranslationError = (A[BoneIndex].GetTranslation() - B[BoneIndex].GetTranslation()).GetAbsMax();
+			const float ScaleError = (A[BoneIndex].GetScale3D() - B[BoneIndex].GetScale3D()).GetAbsMax();
+			MaxError = FMath::Max(MaxError, FMath::Max3(RotationError, TranslationError, ScaleError));
+		}
+		return MaxError;
+	}
+
+	/** Holds the storage for a SoA pose */
+	struct FPoseSoAStorage
+	{
+		TArray<float, TAlignedHeapAllocator<16> > Data;
+		FAnimPoseSoA Pose;
+
+		void Init(const FTransformArrayA2& Atoms, const TArray<FBoneIndexType>& RequiredBoneIndices)
+		{
+			Data.SetNumUninitialized(FAnimPoseSoA::GetRequiredFloats(RequiredBoneIndices.Num()));
+			Pose.Init(Data.GetData(), RequiredBoneIndices.Num());
+			Pose.Gather(Atoms, RequiredBoneIndices);
+		}
+	};
+}
+
+bool FAnimPoseSoATest::RunTest(const FString& Parameters)
+{
+	using namespace AnimPoseSoATest;
+
+	FRandomStream Random(0x5A05E);
+
+	TArray<FBoneIndexType> RequiredBoneIndices;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		RequiredBoneIndices.Add(BoneIndex);
+	}
+
+	TArray<FTransformArrayA2> SourcePoses;
+	SourcePoses.SetNum(NumPoses);
+	for (FTransformArrayA2& SourcePose : SourcePoses)
+	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			SourcePose.Add(MakeRandomTransform(Random));
+		}
+	}
+	const float SourceWeights[NumPoses] = { 0.5f, 0.3f, 0.2f };
+
+	FPoseSoAStorage SourcePosesSoA[NumPoses];
+	const FAnimPoseSoA* SourcePosePtrs[NumPoses];
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		SourcePosesSoA[PoseIndex].Init(SourcePoses[PoseIndex], RequiredBoneIndices);
+		SourcePosePtrs[PoseIndex] = &SourcePosesSoA[PoseIndex].Pose;
+	}
+	FPoseSoAStorage ResultSoA;
+	ResultSoA.Init(SourcePoses[0], RequiredBoneIndices);
+
+	// Blend: reference is the per FTransform loop of FAnimationRuntime::BlendPosesTogether
+	{
+		FTransformArrayA2 Expected;
+		Expected.SetNum(NumBones);
+		double ScalarTime = -FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+			{
+				Expected[BoneIndex] = SourcePoses[0][BoneIndex] * ScalarRegister(SourceWeights[0]);
+			}
+			for (int32 PoseIndex = 1; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				const ScalarRegister VBlendWeight(SourceWeights[PoseIndex]);
+				for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+				{
+					Expected[BoneIndex].AccumulateWithShortestRotation(SourcePoses[PoseIndex][BoneIndex], VBlendWeight);
+				}
+			}
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+			{
+				Expected[BoneIndex].NormalizeRotation();
+			}
+		}
+		ScalarTime += FPlatformTime::Seconds();
+
+		double SoATime = -FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			FAnimPoseSoA::BlendPosesTogether(NumPoses, SourcePosePtrs, SourceWeights, ResultSoA.Pose);
+		}
+		SoATime += FPlatformTime::Seconds();
+
+		FTransformArrayA2 Result = SourcePoses[0];
+		ResultSoA.Pose.Scatter(Result, RequiredBoneIndices);
+		const float MaxError = GetMaxError(Expected, Result);
+		TestTrue(FString::Printf(TEXT("BlendPosesTogether max error %f"), MaxError), MaxError <= Tolerance);
+		AddLogItem(FString::Printf(TEXT("BlendPosesTogether, %d poses of %d bones: FTransform %.2f us, SoA %.2f us"), NumPoses, NumBones, ScalarTime * 1.e6 / NumIterations, SoATime * 1.e6 / NumIterations));
+	}
+
+	// Additive: reference is FAnimationRuntime::BlendAdditivePose
+	{
+		const float BlendWeight = 0.7f;
+		FTransformArrayA2 Expected;
+		Expected.SetNum(NumBones);
+		double ScalarTime = -FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const ScalarRegister VBlendWeight(BlendWeight);
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+			{
+				FTransform Additive = SourcePoses[1][BoneIndex];
+				Expected[BoneIndex] = SourcePoses[0][BoneIndex];
+				FTransform::BlendFromIdentityAndAccumulate(Expected[BoneIndex], Additive, VBlendWeight);
+				Expected[BoneIndex].NormalizeRotation();
+			}
+		}
+		ScalarTime += FPlatformTime::Seconds();
+
+		double SoATime = -FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			FAnimPoseSoA::BlendAdditivePose(*SourcePosePtrs[0], *SourcePosePtrs[1], BlendWeight, ResultSoA.Pose);
+		}
+		SoATime += FPlatformTime::Seconds();
+
+		FTransformArrayA2 Result = SourcePoses[0];
+		ResultSoA.Pose.Scatter(Result, RequiredBoneIndices);
+		const float MaxError = GetMaxError(Expected, Result);
+		TestTrue(FString::Printf(TEXT("BlendAdditivePose max error %f"), MaxError), MaxError <= Tolerance);
+		AddLogItem(FString::Printf(TEXT("BlendAdditivePose, %d bones: FTransform %.2f us, SoA %.2f us"), NumBones, ScalarTime * 1.e6 / NumIterations, SoATime * 1.e6 / NumIterations));
+	}
+
+	// Conversion to additive: reference is FAnimationRuntime::ConvertPoseToAdditive
+	{
+		FTransformArrayA2 Expected = SourcePoses[0];
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			FTransform& TargetTransform = Expected[BoneIndex];
+			const FTransform& BaseTransform = SourcePoses[1][BoneIndex];
+			TargetTransform.SetRotation(TargetTransform.GetRotation() * BaseTransform.GetRotation().Inverse());
+			TargetTransform.SetTranslation(TargetTransform.GetTranslation() - BaseTransform.GetTranslation());
+			TargetTransform.SetScale3D(TargetTransform.GetScale3D() * BaseTransform.GetSafeScaleReciprocal(BaseTransform.GetScale3D()));
+			TargetTransform.NormalizeRotation();
+		}
+
+		ResultSoA.Pose.Gather(SourcePoses[0], RequiredBoneIndices);
+		FAnimPoseSoA::ConvertPoseToAdditive(ResultSoA.Pose, *SourcePosePtrs[1]);
+
+		FTransformArrayA2 Result = SourcePoses[0];
+		ResultSoA.Pose.Scatter(Result, RequiredBoneIndices);
+		const float MaxError = GetMaxError(Expected, Result);
+		TestTrue(FString::Printf(TEXT("ConvertPoseToAdditive max error %f"), MaxError), MaxError <= Tolerance);
+	}
+
+	// Conversion cost at the node boundary
+	{
+		FTransformArrayA2 Result = SourcePoses[0];
+		double ConversionTime = -FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			ResultSoA.Pose.Gather(SourcePoses[0], RequiredBoneIndices);
+			ResultSoA.Pose.Scatter(Result, RequiredBoneIndices);
+		}
+		ConversionTime += FPlatformTime::Seconds();
+		AddLogItem(FString::Printf(TEXT("Gather + Scatter, %d bones: %.2f us"), NumBones, ConversionTime * 1.e6 / NumIterations));
+	}
+
+	return true;
+}
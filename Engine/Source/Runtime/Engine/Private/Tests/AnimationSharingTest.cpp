@@ -0,0 +1,77 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "AnimationSharing.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnimationSharingFollowerTest, "Engine.Animation.Sharing Followers Skip Evaluation", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Game)
+
+/**
+ * Replays what USkeletalMeshComponent::RefreshBoneTransforms does with parallel evaluation: every component is dispatched
+ * before the leader publishes, and only the leader may end up evaluating the pose.
+ */
+bool FAnimationSharingFollowerTest::RunTest(const FString& Parameters)
+{
+	const int32 NumComponents = 8;
+	const int32 NumBones = 4;
+
+	FAnimationSharingManager& Manager = FAnimationSharingManager::Get();
+	Manager.Empty();
+
+	FAnimationSharingKey Key;
+	Key.SkeletalMesh = NewObject<USkeletalMesh>(GetTransientPackage());
+	Key.AnimationAsset = NewObject<UAnimSequence>(GetTransientPackage());
+	Key.TimeIndex = 3;
+	Key.TimeStep = 1.f / 30.f;
+
+	// dispatch: the first component becomes the leader, the others must wait for it
+	int32 NumEvaluations = 0;
+	int32 NumFollowers = 0;
+	FGraphEventRef LeaderCompletionEvent = FGraphEvent::CreateGraphEvent();
+	for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+	{
+		if (Manager.FindPose(Key))
+		{
+			AddError(TEXT("A pose was found before the leader published it"));
+		}
+		else if (Manager.FindPendingEvaluation(Key).IsValid())
+		{
+			++NumFollowers;
+		}
+		else
+		{
+			++NumEvaluations;
+			Manager.BeginEvaluation(Key, LeaderCompletionEvent);
+		}
+	}
+	TestEqual(TEXT("Components evaluating the shared pose"), NumEvaluations, 1);
+	TestEqual(TEXT("Components waiting for the leader"), NumFollowers, NumComponents - 1);
+
+	// completion: the leader publishes, then the followers accept its pose
+	TArray<FTransform> LocalAtoms;
+	LocalAtoms.Init(FTransform(FVector(1.f, 2.f, 3.f)), NumBones);
+	Manager.PublishPose(Key, LocalAtoms, LocalAtoms, TArray<FActiveVertexAnim>(), FVector::ZeroVector);
+	LeaderCompletionEvent->DispatchSubsequents();
+
+	for (int32 FollowerIndex = 0; FollowerIndex < NumFollowers; ++FollowerIndex)
+	{
+		const FAnimationSharedPose* SharedPose = Manager.FindPose(Key);
+		if (!SharedPose || SharedPose->LocalAtoms.Num() != NumBones)
+		{
+			AddError(TEXT("A follower did not find the pose published by its leader"));
+			break;
+		}
+	}
+	TestFalse(TEXT("Pending evaluation after publishing"), Manager.FindPendingEvaluation(Key).IsValid());
+
+	// a leader that completes without publishing hands over to the next component
+	FAnimationSharingKey AbandonedKey = Key;
+	AbandonedKey.TimeIndex = 4;
+	FGraphEventRef AbandonedCompletionEvent = FGraphEvent::CreateGraphEvent();
+	Manager.BeginEvaluation(AbandonedKey, AbandonedCompletionEvent);
+	TestTrue(TEXT("Followers wait for a leader still evaluating"), Manager.FindPendingEvaluation(AbandonedKey).IsValid());
+	AbandonedCompletionEvent->DispatchSubsequents();
+	TestFalse(TEXT("Followers wait for a leader that failed to publish"), Manager.FindPendingEvaluation(AbandonedKey).IsValid());
+
+	Manager.Empty();
+	return true;
+}
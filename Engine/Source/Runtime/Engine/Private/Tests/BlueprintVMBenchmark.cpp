@@ -0,0 +1,406 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "Kismet/KismetMathLibrary.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintVMBenchmark, "Engine.Blueprint.VM Benchmark", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Game)
+
+namespace BlueprintVMBenchmark
+{
+	const int32 LoopCount = 1000;
+	const int32 NumCalls = 200;
+
+	/** Writes bytecode the way the blueprint compiler backend does */
+	struct FScriptWriter
+	{
+		TArray<uint8>& Script;
+
+		FScriptWriter(TArray<uint8>& InScript)
+			: Script(InScript)
+		{}
+
+		int32 GetOffset() const
+		{
+			return Script.Num();
+		}
+
+		void Op(EExprToken Token)
+		{
+			Script.Add(Token);
+		}
+
+		template<typename T>
+		void Value(const T& InValue)
+		{
+			const int32 Offset = Script.AddUninitialized(sizeof(T));
+			FMemory::Memcpy(&Script[Offset], &InValue, sizeof(T));
+		}
+
+		void Pointer(const void* InPointer)
+		{
+			Value((ScriptPointerType)(UPTRINT)InPointer);
+		}
+
+		void Local(UProperty* Property)
+		{
+			Op(EX_LocalVariable);
+			Pointer(Property);
+		}
+
+		void LocalOut(UProperty* Property)
+		{
+			Op(EX_LocalOutVariable);
+			Pointer(Property);
+		}
+
+		void Call(UFunction* Function)
+		{
+			Op(EX_FinalFunction);
+			Pointer(Function);
+		}
+
+		/** Writes a jump offset to be patched, returns where it is */
+		int32 JumpOffset()
+		{
+			const int32 Offset = Script.Num();
+			Value((CodeSkipSizeType)0);
+			return Offset;
+		}
+
+		void PatchJumpOffset(int32 Offset, int32 Target)
+		{
+			const CodeSkipSizeType TargetOffset = Target;
+			FMemory::Memcpy(&Script[Offset], &TargetOffset, sizeof(CodeSkipSizeType));
+		}
+
+		void Return()
+		{
+			Op(EX_Return);
+			Op(EX_Nothing);
+			Op(EX_EndOfScript);
+		}
+	};
+
+	/** Builds a transient script function, properties are added in order, parameters first */
+	struct FFunctionBuilder
+	{
+		UFunction* Function;
+		UField** NextProperty;
+
+		FFunctionBuilder(const TCHAR* Name)
+		{
+			UClass* OuterClass = UKismetMathLibrary::StaticClass();
+			Function = NewObject<UFunction>(OuterClass, MakeUniqueObjectName(OuterClass, UFunction::StaticClass(), Name), RF_Transient);
+			Function->AddToRoot();
+			Function->FunctionFlags = FUNC_Public;
+			NextProperty = &Function->Children;
+		}
+
+		template<typename TProperty>
+		TProperty* AddProperty(const TCHAR* Name, uint64 Flags = 0)
+		{
+			TProperty* Property = NewObject<TProperty>(Function, Name, RF_Transient);
+			Property->PropertyFlags |= Flags;
+			if (Flags & CPF_OutParm)
+			{
+				Function->FunctionFlags |= FUNC_HasOutParms;
+			}
+			*NextProperty = Property;
+			NextProperty = &Property->Next;
+			return Property;
+		}
+
+		UStructProperty* AddVectorProperty(const TCHAR* Name, uint64 Flags = 0)
+		{
+			UStructProperty* Property = AddProperty<UStructProperty>(Name, Flags);
+			Property->Struct = GetBaseStructure(TEXT("Vector"));
+			return Property;
+		}
+
+		/** Links the properties, the script can be written after this */
+		UFunction* Link()
+		{
+			Function->StaticLink(true);
+			Function->Bind();
+			return Function;
+		}
+	};
+
+	/** A loop over the iteration count, as the ForLoop macro compiles to */
+	struct FLoop
+	{
+		FScriptWriter& Writer;
+		UProperty* Index;
+		int32 LoopStart;
+		int32 EndJumpOffset;
+
+		FLoop(FScriptWriter& InWriter, UProperty* InIndex, UProperty* Count)
+			: Writer(InWriter)
+			, Index(InIndex)
+		{
+			Writer.Op(EX_Let);
+			Writer.Local(Index);
+			Writer.Op(EX_IntZero);
+
+			LoopStart = Writer.GetOffset();
+			Writer.Op(EX_JumpIfNot);
+			EndJumpOffset = Writer.JumpOffset();
+			Writer.Call(FindMathFunction(TEXT("Less_IntInt")));
+			Writer.Local(Index);
+			Writer.Local(Count);
+			Writer.Op(EX_EndFunctionParms);
+		}
+
+		void End()
+		{
+			Writer.Op(EX_Let);
+			Writer.Local(Index);
+			Writer.Call(FindMathFunction(TEXT("Add_IntInt")));
+			Writer.Local(Index);
+			Writer.Op(EX_IntOne);
+			Writer.Op(EX_EndFunctionParms);
+
+			Writer.Op(EX_Jump);
+			Writer.PatchJumpOffset(Writer.JumpOffset(), LoopStart);
+			Writer.PatchJumpOffset(EndJumpOffset, Writer.GetOffset());
+		}
+
+		static UFunction* FindMathFunction(const TCHAR* Name)
+		{
+			return UKismetMathLibrary::StaticClass()->FindFunctionByName(Name);
+		}
+	};
+
+	/** int32 IntegerLoop(int32 Count): sums the loop indices */
+	UFunction* CreateIntegerLoop()
+	{
+		FFunctionBuilder Builder(TEXT("IntegerLoop"));
+		UProperty* Count = Builder.AddProperty<UIntProperty>(TEXT("Count"), CPF_Parm);
+		UProperty* Result = Builder.AddProperty<UIntProperty>(TEXT("Result"), CPF_Parm | CPF_OutParm);
+		UProperty* Index = Builder.AddProperty<UIntProperty>(TEXT("Index"));
+		UProperty* Sum = Builder.AddProperty<UIntProperty>(TEXT("Sum"));
+		UFunction* Function = Builder.Link();
+
+		FScriptWriter Writer(Function->Script);
+		Writer.Op(EX_Let);
+		Writer.Local(Sum);
+		Writer.Op(EX_IntZero);
+
+		FLoop Loop(Writer, Index, Count);
+		Writer.Op(EX_Let);
+		Writer.Local(Sum);
+		Writer.Call(FLoop::FindMathFunction(TEXT("Add_IntInt")));
+		Writer.Local(Sum);
+		Writer.Local(Index);
+		Writer.Op(EX_EndFunctionParms);
+		Loop.End();
+
+		Writer.Op(EX_Let);
+		Writer.LocalOut(Result);
+		Writer.Local(Sum);
+		Writer.Return();
+		return Function;
+	}
+
+	/** float VectorMath(int32 Count): accumulates the length of a growing vector */
+	UFunction* CreateVectorMath()
+	{
+		FFunctionBuilder Builder(TEXT("VectorMath"));
+		UProperty* Count = Builder.AddProperty<UIntProperty>(TEXT("Count"), CPF_Parm);
+		UProperty* Result = Builder.AddProperty<UFloatProperty>(TEXT("Result"), CPF_Parm | CPF_OutParm);
+		UProperty* Index = Builder.AddProperty<UIntProperty>(TEXT("Index"));
+		UProperty* Vector = Builder.AddVectorProperty(TEXT("Vector"));
+		UProperty* Total = Builder.AddProperty<UFloatProperty>(TEXT("Total"));
+		UFunction* Function = Builder.Link();
+
+		FScriptWriter Writer(Function->Script);
+		Writer.Op(EX_Let);
+		Writer.Local(Total);
+		Writer.Op(EX_FloatConst);
+		Writer.Value(0.f);
+
+		Writer.Op(EX_Let);
+		Writer.Local(Vector);
+		Writer.Op(EX_VectorConst);
+		Writer.Value(FVector::ZeroVector);
+
+		FLoop Loop(Writer, Index, Count);
+		Writer.Op(EX_Let);
+		Writer.Local(Vector);
+		Writer.Call(FLoop::FindMathFunction(TEXT("Add_VectorVector")));
+		Writer.Local(Vector);
+		Writer.Op(EX_VectorConst);
+		Writer.Value(FVector(1.f, 2.f, 2.f));
+		Writer.Op(EX_EndFunctionParms);
+
+		Writer.Op(EX_Let);
+		Writer.Local(Total);
+		Writer.Call(FLoop::FindMathFunction(TEXT("Add_FloatFloat")));
+		Writer.Local(Total);
+		Writer.Call(FLoop::FindMathFunction(TEXT("VSize")));
+		Writer.Local(Vector);
+		Writer.Op(EX_EndFunctionParms);
+		Writer.Op(EX_EndFunctionParms);
+		Loop.End();
+
+		Writer.Op(EX_Let);
+		Writer.LocalOut(Result);
+		Writer.Local(Total);
+		Writer.Return();
+		return Function;
+	}
+
+	/** void Callee(int32 Value, FVector Offset, FString Label, int32& Result): Result = Value + 1 */
+	UFunction* CreateCallee()
+	{
+		FFunctionBuilder Builder(TEXT("Callee"));
+		UProperty* Value = Builder.AddProperty<UIntProperty>(TEXT("Value"), CPF_Parm);
+		Builder.AddVectorProperty(TEXT("Offset"), CPF_Parm);
+		Builder.AddProperty<UStrProperty>(TEXT("Label"), CPF_Parm);
+		UProperty* Result = Builder.AddProperty<UIntProperty>(TEXT("Result"), CPF_Parm | CPF_OutParm);
+		UFunction* Function = Builder.Link();
+
+		FScriptWriter Writer(Function->Script);
+		Writer.Op(EX_Let);
+		Writer.LocalOut(Result);
+		Writer.Call(FLoop::FindMathFunction(TEXT("Add_IntInt")));
+		Writer.Local(Value);
+		Writer.Op(EX_IntOne);
+		Writer.Op(EX_EndFunctionParms);
+		Writer.Return();
+		return Function;
+	}
+
+	/** int32 FunctionCalls(int32 Count): sums the results of a script function taking parameters that need to be constructed */
+	UFunction* CreateFunctionCalls(UFunction* Callee)
+	{
+		FFunctionBuilder Builder(TEXT("FunctionCalls"));
+		UProperty* Count = Builder.AddProperty<UIntProperty>(TEXT("Count"), CPF_Parm);
+		UProperty* Result = Builder.AddProperty<UIntProperty>(TEXT("Result"), CPF_Parm | CPF_OutParm);
+		UProperty* Index = Builder.AddProperty<UIntProperty>(TEXT("Index"));
+		UProperty* Sum = Builder.AddProperty<UIntProperty>(TEXT("Sum"));
+		UProperty* CallResult = Builder.AddProperty<UIntProperty>(TEXT("CallResult"));
+		UFunction* Function = Builder.Link();
+
+		FScriptWriter Writer(Function->Script);
+		Writer.Op(EX_Let);
+		Writer.Local(Sum);
+		Writer.Op(EX_IntZero);
+
+		FLoop Loop(Writer, Index, Count);
+		Writer.Call(Callee);
+		Writer.Local(Index);
+		Writer.Op(EX_VectorConst);
+		Writer.Value(FVector(1.f, 2.f, 3.f));
+		Writer.Op(EX_StringConst);
+		const ANSICHAR Label[] = "Label";
+		for (int32 CharIndex = 0; CharIndex < ARRAY_COUNT(Label); CharIndex++)
+		{
+			Writer.Value(Label[CharIndex]);
+		}
+		Writer.Local(CallResult);
+		Writer.Op(EX_EndFunctionParms);
+
+		Writer.Op(EX_Let);
+		Writer.Local(Sum);
+		Writer.Call(FLoop::FindMathFunction(TEXT("Add_IntInt")));
+		Writer.Local(Sum);
+		Writer.Local(CallResult);
+		Writer.Op(EX_EndFunctionParms);
+		Loop.End();
+
+		Writer.Op(EX_Let);
+		Writer.LocalOut(Result);
+		Writer.Local(Sum);
+		Writer.Return();
+		return Function;
+	}
+
+	/**
+	 * Calls a benchmark function repeatedly with the decoded script on or off.
+	 *
+	 * @return The seconds the calls took
+	 */
+	template<typename TResult>
+	double RunBenchmark(UFunction* Function, bool bUseDecodedScript, TResult& OutResult)
+	{
+		IConsoleManager::Get().FindConsoleVariable(TEXT("bp.UseDecodedScript"))->Set(bUseDecodedScript ? TEXT("1") : TEXT("0"));
+
+		UObject* Object = UKismetMathLibrary::StaticClass()->GetDefaultObject();
+		UProperty* CountProperty = FindField<UProperty>(Function, TEXT("Count"));
+		UProperty* ResultProperty = FindField<UProperty>(Function, TEXT("Result"));
+
+		TArray<uint8> Parms;
+		Parms.AddZeroed(Function->ParmsSize);
+		*CountProperty->ContainerPtrToValuePtr<int32>(Parms.GetData()) = LoopCount;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 CallIndex = 0; CallIndex < NumCalls; CallIndex++)
+		{
+			// the benchmark loops would trip the runaway loop detection, which is otherwise reset every frame
+			GInitRunaway();
+			Object->ProcessEvent(Function, Parms.GetData());
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		OutResult = *ResultProperty->ContainerPtrToValuePtr<TResult>(Parms.GetData());
+		return Seconds;
+	}
+}
+
+bool FBlueprintVMBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace BlueprintVMBenchmark;
+
+	IConsoleVariable* UseDecodedScript = IConsoleManager::Get().FindConsoleVariable(TEXT("bp.UseDecodedScript"));
+	if (!TestTrue(TEXT("bp.UseDecodedScript exists"), UseDecodedScript != NULL))
+	{
+		return false;
+	}
+	const FString PreviousValue = UseDecodedScript->GetString();
+
+	UFunction* Callee = CreateCallee();
+	UFunction* IntegerLoop = CreateIntegerLoop();
+	UFunction* VectorMath = CreateVectorMath();
+	UFunction* FunctionCalls = CreateFunctionCalls(Callee);
+
+	{
+		int32 InterpretedResult = 0;
+		int32 DecodedResult = 0;
+		const double InterpretedTime = RunBenchmark(IntegerLoop, false, InterpretedResult);
+		const double DecodedTime = RunBenchmark(IntegerLoop, true, DecodedResult);
+		TestEqual(TEXT("Integer loop result"), InterpretedResult, LoopCount * (LoopCount - 1) / 2);
+		TestEqual(TEXT("Integer loop decoded result"), DecodedResult, InterpretedResult);
+		AddLogItem(FString::Printf(TEXT("Integer loop: interpreted %.2f ms, decoded %.2f ms"), InterpretedTime * 1000.0, DecodedTime * 1000.0));
+	}
+
+	{
+		float InterpretedResult = 0.f;
+		float DecodedResult = 0.f;
+		const double InterpretedTime = RunBenchmark(VectorMath, false, InterpretedResult);
+		const double DecodedTime = RunBenchmark(VectorMath, true, DecodedResult);
+		const float ExpectedResult = 3.f * LoopCount * (LoopCount + 1) / 2;
+		TestTrue(TEXT("Vector math result"), FMath::IsNearlyEqual(InterpretedResult, ExpectedResult, ExpectedResult * 1.e-4f));
+		TestEqual(TEXT("Vector math decoded result"), DecodedResult, InterpretedResult);
+		AddLogItem(FString::Printf(TEXT("Vector math: interpreted %.2f ms, decoded %.2f ms"), InterpretedTime * 1000.0, DecodedTime * 1000.0));
+	}
+
+	{
+		int32 InterpretedResult = 0;
+		int32 DecodedResult = 0;
+		const double InterpretedTime = RunBenchmark(FunctionCalls, false, InterpretedResult);
+		const double DecodedTime = RunBenchmark(FunctionCalls, true, DecodedResult);
+		TestEqual(TEXT("Function calls result"), InterpretedResult, LoopCount * (LoopCount + 1) / 2);
+		TestEqual(TEXT("Function calls decoded result"), DecodedResult, InterpretedResult);
+		AddLogItem(FString::Printf(TEXT("Function calls: interpreted %.2f ms, decoded %.2f ms"), InterpretedTime * 1000.0, DecodedTime * 1000.0));
+	}
+
+	UseDecodedScript->Set(*PreviousValue);
+
+	Callee->RemoveFromRoot();
+	IntegerLoop->RemoveFromRoot();
+	VectorMath->RemoveFromRoot();
+	FunctionCalls->RemoveFromRoot();
+
+	return true;
+}
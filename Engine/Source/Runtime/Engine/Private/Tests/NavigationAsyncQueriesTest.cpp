@@ -0,0 +1,358 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "AI/Navigation/NavigationSystem.h"
+#include "AI/Navigation/AbstractNavData.h"
+#if WITH_RECAST
+#include "AI/Navigation/RecastNavMesh.h"
+#include "AI/Navigation/PImplRecastNavMesh.h"
+#include "AI/Navigation/RecastHelpers.h"
+#include "Detour/DetourNavMeshBuilder.h"
+#endif // WITH_RECAST
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNavigationAsyncQueriesTest, "Engine.Navigation.Concurrent Async Path Queries", EAutomationTestFlags::ATF_Editor)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRecastNavMeshAsyncQueriesTest, "Engine.Navigation.Recast Async Path Queries", EAutomationTestFlags::ATF_Editor)
+
+/**
+ * Runs a tick worth of async path queries sharing one filter, split between as many worker tasks as possible.
+ * Every query must complete on the game thread with its filter set, and the filter's reference count must not drift.
+ */
+bool FNavigationAsyncQueriesTest::RunTest(const FString& Parameters)
+{
+	const int32 NumQueries = 256;
+	const double TimeoutSeconds = 10.0;
+
+	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext &WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	UNavigationSystem::InitializeForWorld(World, FNavigationSystem::GameMode);
+	UNavigationSystem* NavSys = World->GetNavigationSystem();
+	AAbstractNavData* NavData = World->SpawnActor<AAbstractNavData>();
+	if (NavSys == nullptr || NavData == nullptr)
+	{
+		AddError(TEXT("Failed to create the navigation system"));
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	NavSys->MaxAsyncPathfindingQueriesPerTick = 0;
+	NavSys->MinAsyncPathfindingQueriesPerTask = 1;
+
+	TSharedPtr<const FNavigationQueryFilter> QueryFilter = NavData->GetDefaultQueryFilter();
+	const int32 InitialFilterReferences = QueryFilter.GetSharedReferenceCount();
+
+	TArray<FNavPathSharedPtr> Paths;
+	int32 NumSucceeded = 0;
+	bool bCalledOffGameThread = false;
+	FNavPathQueryDelegate ResultDelegate = FNavPathQueryDelegate::CreateLambda(
+		[&Paths, &NumSucceeded, &bCalledOffGameThread](uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+		{
+			bCalledOffGameThread |= !IsInGameThread();
+			NumSucceeded += (Result == ENavigationQueryResult::Success) ? 1 : 0;
+			Paths.Add(Path);
+		});
+
+	for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+	{
+		const FVector Start(0.f, QueryIndex * 100.f, 0.f);
+		FPathFindingQuery Query(nullptr, NavData, Start, Start + FVector(1000.f, 0.f, 0.f), QueryFilter);
+		NavSys->FindPathAsync(FNavAgentProperties(), Query, ResultDelegate);
+	}
+
+	NavSys->Tick(0.f);
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (Paths.Num() < NumQueries && FPlatformTime::Seconds() - StartTime < TimeoutSeconds)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+	TestEqual(TEXT("Completed async queries"), Paths.Num(), NumQueries);
+	TestEqual(TEXT("Successful async queries"), NumSucceeded, NumQueries);
+	TestFalse(TEXT("Result delegates called off the game thread"), bCalledOffGameThread);
+	for (const FNavPathSharedPtr& Path : Paths)
+	{
+		if (!Path.IsValid() || Path->GetFilter() != QueryFilter)
+		{
+			AddError(TEXT("An async path was not given the filter of its query"));
+			break;
+		}
+	}
+
+	Paths.Empty();
+	TestEqual(TEXT("Filter references after releasing the paths"), QueryFilter.GetSharedReferenceCount(), InitialFilterReferences);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#if WITH_RECAST
+namespace RecastNavMeshAsyncQueriesTest
+{
+	const int32 NumStripPolys = 8;
+	const int32 StripPolyVoxels = 10;
+	const float StripCellSize = 10.f;
+
+	/** Builds the data of a single tile holding a row of square polys along recast's X axis, each connected to the next one */
+	bool BuildStripTileData(unsigned char*& OutData, int32& OutDataSize)
+	{
+		const int32 NumVertsPerRow = NumStripPolys + 1;
+		const uint16 NoNeighbour = 0xffff;
+
+		TArray<uint16> Verts;
+		for (int32 Row = 0; Row < 2; ++Row)
+		{
+			for (int32 VertIndex = 0; VertIndex < NumVertsPerRow; ++VertIndex)
+			{
+				Verts.Add((uint16)(VertIndex * StripPolyVoxels));
+				Verts.Add(0);
+				Verts.Add((uint16)(Row * StripPolyVoxels));
+			}
+		}
+
+		// each poly lists its vertices followed by the neighbours across the edges starting at them
+		TArray<uint16> Polys;
+		TArray<uint16> PolyFlags;
+		TArray<uint8> PolyAreas;
+		for (int32 PolyIndex = 0; PolyIndex < NumStripPolys; ++PolyIndex)
+		{
+			Polys.Add((uint16)PolyIndex);
+			Polys.Add((uint16)(PolyIndex + 1));
+			Polys.Add((uint16)(NumVertsPerRow + PolyIndex + 1));
+			Polys.Add((uint16)(NumVertsPerRow + PolyIndex));
+			Polys.Add(NoNeighbour);
+			Polys.Add(PolyIndex + 1 < NumStripPolys ? (uint16)(PolyIndex + 1) : NoNeighbour);
+			Polys.Add(NoNeighbour);
+			Polys.Add(PolyIndex > 0 ? (uint16)(PolyIndex - 1) : NoNeighbour);
+			PolyFlags.Add(1);
+			PolyAreas.Add(RECAST_DEFAULT_AREA);
+		}
+
+		dtNavMeshCreateParams Params;
+		memset(&Params, 0, sizeof(Params));
+		Params.verts = Verts.GetData();
+		Params.vertCount = Verts.Num() / 3;
+		Params.polys = Polys.GetData();
+		Params.polyFlags = PolyFlags.GetData();
+		Params.polyAreas = PolyAreas.GetData();
+		Params.polyCount = NumStripPolys;
+		Params.nvp = 4;
+		Params.walkableHeight = 144.f;
+		Params.walkableRadius = 35.f;
+		Params.walkableClimb = 35.f;
+		Params.bmax[0] = NumStripPolys * StripPolyVoxels * StripCellSize;
+		Params.bmax[1] = StripCellSize;
+		Params.bmax[2] = StripPolyVoxels * StripCellSize;
+		Params.cs = StripCellSize;
+		Params.ch = StripCellSize;
+		Params.buildBvTree = true;
+
+		return dtCreateNavMeshData(&Params, &OutData, &OutDataSize);
+	}
+
+	FVector GetStripPolyCenter(int32 PolyIndex)
+	{
+		const float PolySize = StripPolyVoxels * StripCellSize;
+		return Recast2UnrealPoint(FVector((PolyIndex + 0.5f) * PolySize, 0.f, 0.5f * PolySize));
+	}
+
+	NavNodeRef GetStripPolyRef(const dtNavMesh& DetourMesh, int32 PolyIndex)
+	{
+		return DetourMesh.getPolyRefBase(DetourMesh.getTileAt(0, 0, 0)) | (NavNodeRef)PolyIndex;
+	}
+
+	struct FStripQuery
+	{
+		int32 StartPoly;
+		int32 EndPoly;
+		bool bSucceeded;
+		FNavPathSharedPtr Path;
+
+		FStripQuery(int32 InStartPoly, int32 InEndPoly) : StartPoly(InStartPoly), EndPoly(InEndPoly), bSucceeded(false) {}
+	};
+
+	/** Runs a tick worth of async path queries on the navmesh and waits for all of them to complete */
+	bool RunStripQueries(UNavigationSystem* NavSys, ARecastNavMesh* NavMesh, TArray<FStripQuery>& Queries)
+	{
+		const double TimeoutSeconds = 10.0;
+
+		TMap<uint32, int32> QueryIndices;
+		int32 NumCompleted = 0;
+		FNavPathQueryDelegate ResultDelegate = FNavPathQueryDelegate::CreateLambda(
+			[&Queries, &QueryIndices, &NumCompleted](uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+			{
+				FStripQuery& Query = Queries[QueryIndices.FindChecked(QueryID)];
+				Query.bSucceeded = (Result == ENavigationQueryResult::Success);
+				Query.Path = Path;
+				NumCompleted++;
+			});
+
+		for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); ++QueryIndex)
+		{
+			FStripQuery& Query = Queries[QueryIndex];
+			Query.bSucceeded = false;
+			Query.Path.Reset();
+
+			FPathFindingQuery PathQuery(nullptr, NavMesh, GetStripPolyCenter(Query.StartPoly), GetStripPolyCenter(Query.EndPoly), NavMesh->GetDefaultQueryFilter());
+			QueryIndices.Add(NavSys->FindPathAsync(FNavAgentProperties(), PathQuery, ResultDelegate), QueryIndex);
+		}
+
+		NavSys->Tick(0.f);
+
+		const double StartTime = FPlatformTime::Seconds();
+		while (NumCompleted < Queries.Num() && FPlatformTime::Seconds() - StartTime < TimeoutSeconds)
+		{
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		}
+
+		return NumCompleted == Queries.Num();
+	}
+
+	/** @return true if the path goes from the center of its start poly to the center of its end poly through every poly between them */
+	bool IsStripPathValid(const FStripQuery& Query, const dtNavMesh& DetourMesh)
+	{
+		FNavMeshPath* Path = Query.Path.IsValid() ? Query.Path->CastPath<FNavMeshPath>() : nullptr;
+		if (!Query.bSucceeded || Path == nullptr || Path->GetPathPoints().Num() < 2)
+		{
+			return false;
+		}
+
+		if (!Path->GetPathPoints()[0].Location.Equals(GetStripPolyCenter(Query.StartPoly), 1.f)
+			|| !Path->GetPathPoints().Last().Location.Equals(GetStripPolyCenter(Query.EndPoly), 1.f))
+		{
+			return false;
+		}
+
+		const int32 Step = Query.EndPoly > Query.StartPoly ? 1 : -1;
+		if (Path->PathCorridor.Num() != FMath::Abs(Query.EndPoly - Query.StartPoly) + 1)
+		{
+			return false;
+		}
+		for (int32 CorridorIndex = 0; CorridorIndex < Path->PathCorridor.Num(); ++CorridorIndex)
+		{
+			if (Path->PathCorridor[CorridorIndex] != GetStripPolyRef(DetourMesh, Query.StartPoly + CorridorIndex * Step))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+#endif // WITH_RECAST
+
+/**
+ * Runs async path queries on a small hand built recast navmesh, with path corridor caching enabled.
+ * Worker tasks share a few pooled detour queries, every path must still be the one of its own query.
+ * Rebuilding the tile must drop the corridors cached through it.
+ */
+bool FRecastNavMeshAsyncQueriesTest::RunTest(const FString& Parameters)
+{
+#if WITH_RECAST
+	using namespace RecastNavMeshAsyncQueriesTest;
+
+	const int32 NumQueries = 256;
+
+	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext &WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	UNavigationSystem::InitializeForWorld(World, FNavigationSystem::GameMode);
+	UNavigationSystem* NavSys = World->GetNavigationSystem();
+	ARecastNavMesh* NavMesh = World->SpawnActor<ARecastNavMesh>();
+	dtNavMesh* DetourMesh = dtAllocNavMesh();
+	unsigned char* TileData = nullptr;
+	int32 TileDataSize = 0;
+	if (NavSys == nullptr || NavMesh == nullptr || NavMesh->GetRecastNavMeshImpl() == nullptr || DetourMesh == nullptr
+		|| !BuildStripTileData(TileData, TileDataSize) || dtStatusFailed(DetourMesh->init(TileData, TileDataSize, DT_TILE_FREE_DATA)))
+	{
+		AddError(TEXT("Failed to create the navigation system and the navmesh"));
+		dtFreeNavMesh(DetourMesh);
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	FPImplRecastNavMesh* NavMeshImpl = NavMesh->GetRecastNavMeshImpl();
+	NavMeshImpl->SetRecastMesh(DetourMesh);
+	NavMesh->bCachePathCorridors = true;
+	NavMesh->PathCorridorCacheLifetime = 60.f;
+
+	NavSys->MaxAsyncPathfindingQueriesPerTick = 0;
+	NavSys->MinAsyncPathfindingQueriesPerTask = 1;
+	const int32 MaxTasks = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+
+	TArray<FStripQuery> Queries;
+	TSet<FIntPoint> PolyPairs;
+	for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+	{
+		const int32 StartPoly = QueryIndex % NumStripPolys;
+		const int32 EndPoly = (StartPoly + 1 + (QueryIndex / NumStripPolys) % (NumStripPolys - 1)) % NumStripPolys;
+		Queries.Add(FStripQuery(StartPoly, EndPoly));
+		PolyPairs.Add(FIntPoint(StartPoly, EndPoly));
+	}
+
+	// the second run finds its corridors in the cache
+	for (int32 RunIndex = 0; RunIndex < 2; ++RunIndex)
+	{
+		if (!TestTrue(TEXT("Completed async queries"), RunStripQueries(NavSys, NavMesh, Queries)))
+		{
+			break;
+		}
+
+		for (const FStripQuery& Query : Queries)
+		{
+			if (!IsStripPathValid(Query, *DetourMesh))
+			{
+				AddError(FString::Printf(TEXT("Async path from poly %d to poly %d is not the path of its query"), Query.StartPoly, Query.EndPoly));
+				break;
+			}
+		}
+
+		TestTrue(TEXT("Pooled queries are reused between tasks"), NavMeshImpl->GetNumPooledNavQueries() <= MaxTasks);
+		TestEqual(TEXT("Cached path corridors"), NavMeshImpl->GetNumCachedPathCorridors(), PolyPairs.Num());
+	}
+
+	// rebuild the tile, the way the generator does it
+	const uint32 TileIndex = NavMeshImpl->GetTileIndexFromPolyRef(GetStripPolyRef(*DetourMesh, 0));
+	DetourMesh->removeTile(DetourMesh->getTileRefAt(0, 0, 0), nullptr, nullptr);
+	if (BuildStripTileData(TileData, TileDataSize) && dtStatusSucceed(DetourMesh->addTile(TileData, TileDataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+	{
+		TArray<uint32> ChangedTiles;
+		ChangedTiles.Add(TileIndex);
+		NavMesh->InvalidateAffectedPaths(ChangedTiles);
+		TestEqual(TEXT("Cached path corridors after rebuilding the tile"), NavMeshImpl->GetNumCachedPathCorridors(), 0);
+
+		FStripQuery Query(0, NumStripPolys - 1);
+		FPathFindingQuery PathQuery(nullptr, NavMesh, GetStripPolyCenter(Query.StartPoly), GetStripPolyCenter(Query.EndPoly), NavMesh->GetDefaultQueryFilter());
+		FPathFindingResult Result = NavSys->FindPathSync(FNavAgentProperties(), PathQuery);
+		Query.bSucceeded = Result.IsSuccessful();
+		Query.Path = Result.Path;
+		TestTrue(TEXT("Path through the rebuilt tile"), IsStripPathValid(Query, *DetourMesh));
+		TestEqual(TEXT("Cached path corridors after searching the rebuilt tile"), NavMeshImpl->GetNumCachedPathCorridors(), 1);
+	}
+	else
+	{
+		AddError(TEXT("Failed to rebuild the navmesh tile"));
+	}
+
+	Queries.Empty();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+#else
+	return true;
+#endif // WITH_RECAST
+}
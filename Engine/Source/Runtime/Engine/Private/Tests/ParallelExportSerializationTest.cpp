@@ -0,0 +1,103 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelExportSerializationTest, "Engine.Save.Parallel Export Serialization", EAutomationTestFlags::ATF_Editor)
+
+namespace ParallelExportSerializationTest
+{
+	const int32 NumRows = 64;
+	const int32 NumKeys = 256;
+
+	/** Fills a package with a data table and curves, which all allow saving on worker threads */
+	void FillPackage(UPackage* Package)
+	{
+		UDataTable* DataTable = NewObject<UDataTable>(Package, TEXT("DataTable"), RF_Public | RF_Standalone);
+		DataTable->RowStruct = FTableRowBase::StaticStruct();
+		for (int32 RowIndex = 0; RowIndex < NumRows; RowIndex++)
+		{
+			uint8* RowData = (uint8*)FMemory::Malloc(DataTable->RowStruct->PropertiesSize);
+			DataTable->RowStruct->InitializeStruct(RowData);
+			DataTable->RowMap.Add(*FString::Printf(TEXT("Row%d"), RowIndex), RowData);
+		}
+
+		UCurveFloat* CurveFloat = NewObject<UCurveFloat>(Package, TEXT("CurveFloat"), RF_Public | RF_Standalone);
+		UCurveVector* CurveVector = NewObject<UCurveVector>(Package, TEXT("CurveVector"), RF_Public | RF_Standalone);
+		UCurveLinearColor* CurveLinearColor = NewObject<UCurveLinearColor>(Package, TEXT("CurveLinearColor"), RF_Public | RF_Standalone);
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++)
+		{
+			const float Time = KeyIndex * 0.1f;
+			CurveFloat->FloatCurve.AddKey(Time, FMath::Sin(Time));
+			for (int32 CurveIndex = 0; CurveIndex < 3; CurveIndex++)
+			{
+				CurveVector->FloatCurves[CurveIndex].AddKey(Time, FMath::Cos(Time * (CurveIndex + 1)));
+			}
+			for (int32 CurveIndex = 0; CurveIndex < 4; CurveIndex++)
+			{
+				CurveLinearColor->FloatCurves[CurveIndex].AddKey(Time, FMath::Frac(Time * (CurveIndex + 1)));
+			}
+		}
+	}
+
+	/** Saves the package with serializing exports on worker threads allowed or not, and reads the file back */
+	bool SavePackageBytes(UPackage* Package, bool bAllowParallel, TArray<uint8>& OutBytes)
+	{
+		IConsoleManager::Get().FindConsoleVariable(TEXT("AllowParallelExportSerialization"))->Set(bAllowParallel ? TEXT("1") : TEXT("0"));
+
+		// the package GUID is kept, otherwise every save writes a new one
+		const FString Filename = FPaths::AutomationTransientDir() / FString::Printf(TEXT("ParallelExportSerialization%d"), bAllowParallel ? 1 : 0) + FPackageName::GetAssetPackageExtension();
+		const bool bSaved = UPackage::SavePackage(Package, NULL, RF_Standalone, *Filename, GError, nullptr, false, true, SAVE_NoError | SAVE_KeepGUID);
+		const bool bLoaded = bSaved && FFileHelper::LoadFileToArray(OutBytes, *Filename);
+		IFileManager::Get().Delete(*Filename);
+		return bLoaded;
+	}
+}
+
+/**
+ * Saves a package holding a data table and curves with AllowParallelExportSerialization 0 and 1.
+ * Serializing the exports on worker threads must write exactly the bytes the linker writes on its own.
+ */
+bool FParallelExportSerializationTest::RunTest(const FString& Parameters)
+{
+	using namespace ParallelExportSerializationTest;
+
+	IConsoleVariable* AllowParallel = IConsoleManager::Get().FindConsoleVariable(TEXT("AllowParallelExportSerialization"));
+	if (!TestTrue(TEXT("AllowParallelExportSerialization exists"), AllowParallel != NULL))
+	{
+		return false;
+	}
+	const FString PreviousValue = AllowParallel->GetString();
+
+	if (!FApp::ShouldUseThreadingForPerformance() || !FPlatformProcess::SupportsMultithreading())
+	{
+		AddLogItem(TEXT("Exports are never serialized on worker threads in this process, both saves are single threaded."));
+	}
+
+	UPackage* Package = CreatePackage(NULL, TEXT("/Temp/ParallelExportSerializationTest"));
+	FillPackage(Package);
+
+	TArray<uint8> SerialBytes;
+	TArray<uint8> ParallelBytes;
+	const bool bSavedSerial = SavePackageBytes(Package, false, SerialBytes);
+	const bool bSavedParallel = SavePackageBytes(Package, true, ParallelBytes);
+	AllowParallel->Set(*PreviousValue);
+
+	if (TestTrue(TEXT("Saved with AllowParallelExportSerialization 0"), bSavedSerial) && TestTrue(TEXT("Saved with AllowParallelExportSerialization 1"), bSavedParallel))
+	{
+		TestEqual(TEXT("Package size"), ParallelBytes.Num(), SerialBytes.Num());
+		TestTrue(TEXT("Package bytes are identical"), ParallelBytes == SerialBytes);
+	}
+
+	// let the garbage collector free the package, the data table frees its rows
+	TArray<UObject*> Objects;
+	GetObjectsWithOuter(Package, Objects);
+	for (UObject* Object : Objects)
+	{
+		Object->ClearFlags(RF_Standalone);
+		Object->MarkPendingKill();
+	}
+	Package->MarkPendingKill();
+
+	return true;
+}
@@ -147,6 +147,12 @@ static void SerializeForKey(FArchive& Ar, const FTextureBuildSettings& Settings)
 	TempByte = Settings.bChromaKeyTexture; Ar << TempByte;
 	TempColor = Settings.ChromaKeyColor; Ar << TempColor;
 	TempFloat = Settings.ChromaKeyThreshold; Ar << TempFloat;
+
+	// Only written when set so the keys of cooked and existing data don't change
+	if (Settings.bFastEditorPreview)
+	{
+		TempByte = Settings.bFastEditorPreview; Ar << TempByte;
+	}
 }
 
 /**
@@ -356,6 +362,15 @@ static void GetTextureBuildSettings(
 	OutBuildSettings.ChromaKeyThreshold = Texture.ChromaKeyThreshold;
 }
 
+static TAutoConsoleVariable<int32> CVarFastEditorTexturePreview(
+	TEXT("Tex.FastEditorPreview"),
+	1,
+	TEXT("Whether textures displayed in the editor are compressed with faster, lower quality encoders where the texture format has one,\n")
+	TEXT("e.g. DXT1, DXT5, BC4 and BC5. Cooks and builds for other target platforms always compress at full quality.\n")
+	TEXT("0: full quality\n")
+	TEXT("1: fast encoders (default)"),
+	ECVF_ReadOnly);
+
 /**
  * Sets build settings for a texture on the current running platform
  * @param Texture - The texture for which to build compressor settings.
@@ -395,6 +410,9 @@ static void GetBuildSettingsForRunningPlatform(
 		check(PlatformFormats.Num());
 		GetTextureBuildSettings(Texture, GSystemSettings.TextureLODSettings, OutBuildSettings);
 		OutBuildSettings.TextureFormatName = PlatformFormats[0];
+
+		// The data built for the running platform is only displayed, never cooked, unless a commandlet runs
+		OutBuildSettings.bFastEditorPreview = GIsEditor && !IsRunningCommandlet() && CVarFastEditorTexturePreview.GetValueOnAnyThread() != 0;
 	}
 }
 
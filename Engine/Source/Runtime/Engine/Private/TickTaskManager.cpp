@@ -14,6 +14,9 @@ DECLARE_CYCLE_STAT(TEXT("Queue Ticks Wait"),STAT_QueueTicksWait,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Queue Tick Task"),STAT_QueueTickTask,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Post Queue Tick Task"),STAT_PostTickTask,STATGROUP_Game);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Queued"),STAT_TicksQueued,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Batched"),STAT_TicksBatched,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tick Batches"),STAT_TickBatches,STATGROUP_Game);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Queue Ticks Per Tick (us)"),STAT_QueueTicksPerTick,STATGROUP_Game);
 
 static TAutoConsoleVariable<int32> CVarLogTicks(
 	TEXT("LogTicks"),0,
@@ -24,6 +27,16 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncComponentTicks(
 	0,
 	TEXT("Used to control async component ticks."));
 
+static TAutoConsoleVariable<int32> CVarAllowBatchedTicks(
+	TEXT("AllowBatchedTicks"),
+	1,
+	TEXT("If true, tick functions without prerequisites are run together in one task per tick group and thread, instead of one task each."));
+
+static TAutoConsoleVariable<int32> CVarMaxTicksPerBatch(
+	TEXT("MaxTicksPerBatch"),
+	64,
+	TEXT("Maximum number of tick functions run by one batched tick task."));
+
 struct FTickContext
 {
 	/** Delta time to tick **/
@@ -70,9 +83,32 @@ class FTickTaskSequencer
 	/** Start event for each phase of ticks */
 	FGraphEventRef		TickGroupStartEvents[TG_MAX];
 
+	/** Tick functions without prerequisites waiting to be run by one task. **/
+	struct FTickBatch
+	{
+		/** Event shared by the tick functions of the batch, completed by the batch task **/
+		FGraphEventRef			CompletionEvent;
+		/** Tick functions to run, in order **/
+		TArray<FTickFunction*>	TickFunctions;
+		/** tick context, here thread is desired execution thread **/
+		FTickContext			Context;
+	};
+
+	/** Batch being filled for each phase of ticks, for the game thread and for any thread **/
+	FTickBatch			OpenTickBatches[TG_MAX][2];
+
+	/** Number of tick functions that go in a batch before it is dispatched, sized from the previous frame **/
+	int32				TickBatchSizes[TG_MAX][2];
+
+	/** Number of tick functions batched this frame **/
+	int32				NumBatchedTicks[TG_MAX][2];
+
 	/** If true, allow concurrent ticks **/
 	bool				bAllowConcurrentTicks; 
 
+	/** If true, batch the tick functions that have no prerequisites **/
+	bool				bAllowBatchedTicks;
+
 	/** If true, log each tick **/
 	bool				bLogTicks; 
 
@@ -121,6 +157,66 @@ public:
 		TickFunction->CompletionHandle = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndDispatchWhenReady(TickFunction, &UseContext, bLogTicks);
 	}
 
+	/**
+	 * Add a tick function without prerequisites to the batch of its tick group, it will run once the tick group starts.
+	 * The tick function gets the batch completion event as its completion handle.
+	 *
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 */
+	void QueueBatchedTickTask(FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		const ETickingGroup TickGroup = TickFunction->ActualTickGroup;
+		checkSlow(TickGroup >=0 && TickGroup < TG_MAX);
+
+		if (!bAllowBatchedTicks)
+		{
+			FGraphEventArray TaskPrerequisites;
+			TaskPrerequisites.Add(GetTickGroupStartEvent(TickGroup));
+			QueueTickTask(&TaskPrerequisites, TickFunction, TickContext);
+			return;
+		}
+
+		const bool bIsOriginalTickGroup = (TickGroup == TickFunction->TickGroup);
+		const int32 ThreadIndex = (TickFunction->bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup) ? 1 : 0;
+
+		FTickBatch& Batch = OpenTickBatches[TickGroup][ThreadIndex];
+		if (!Batch.CompletionEvent.GetReference())
+		{
+			Batch.CompletionEvent = FGraphEvent::CreateGraphEvent();
+			Batch.Context = TickContext;
+			Batch.Context.Thread = ThreadIndex ? ENamedThreads::AnyThread : ENamedThreads::GameThread;
+			AddTickTaskCompletion(TickGroup, Batch.CompletionEvent);
+		}
+		Batch.TickFunctions.Add(TickFunction);
+		TickFunction->CompletionHandle = Batch.CompletionEvent;
+		NumBatchedTicks[TickGroup][ThreadIndex]++;
+
+		if (Batch.TickFunctions.Num() >= TickBatchSizes[TickGroup][ThreadIndex])
+		{
+			DispatchTickBatch(TickGroup, ThreadIndex, TickContext.Thread);
+		}
+	}
+
+	/**
+	 * Dispatch the batches that are still being filled, this must be done before their tick group is released.
+	 * @param	CurrentThread - the thread we are running on
+	 */
+	void FlushTickBatches(ENamedThreads::Type CurrentThread)
+	{
+		for (int32 TickGroup = 0; TickGroup < TG_MAX; TickGroup++)
+		{
+			for (int32 ThreadIndex = 0; ThreadIndex < 2; ThreadIndex++)
+			{
+				if (OpenTickBatches[TickGroup][ThreadIndex].TickFunctions.Num())
+				{
+					DispatchTickBatch(ETickingGroup(TickGroup), ThreadIndex, CurrentThread);
+				}
+			}
+		}
+	}
+
 	/** Add a completion handle to a tick group **/
 	FORCEINLINE void AddTickTaskCompletion(ETickingGroup TickGroup, const FGraphEventRef& CompletionHandle)
 	{
@@ -167,6 +263,7 @@ public:
 		}
 		checkSlow(WorldTickGroup >=0 && WorldTickGroup < TG_MAX);
 		check(TickGroupStartEvents[WorldTickGroup].GetReference()); // the start event should exist
+		check(!OpenTickBatches[WorldTickGroup][0].TickFunctions.Num() && !OpenTickBatches[WorldTickGroup][1].TickFunctions.Num()); // batches must be flushed before their tick group starts
 
 		if (SingleThreadedMode())
 		{
@@ -232,6 +329,20 @@ public:
 		{
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
+		bAllowBatchedTicks = !!CVarAllowBatchedTicks.GetValueOnGameThread();
+
+		// game thread ticks run one after another anyway, so their batches only need to be small enough to interleave with other game thread tasks.
+		// any thread ticks are split so each worker gets a few batches, with some slack in case other things are using the workers.
+		const int32 MaxTicksPerBatch = FMath::Max(CVarMaxTicksPerBatch.GetValueOnGameThread(), 1);
+		const int32 NumAnyThreadBatches = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1) * 4;
+		for (int32 Index = 0; Index < TG_MAX; Index++)
+		{
+			TickBatchSizes[Index][0] = MaxTicksPerBatch;
+			TickBatchSizes[Index][1] = FMath::Clamp(NumBatchedTicks[Index][1] / NumAnyThreadBatches, 1, MaxTicksPerBatch);
+			NumBatchedTicks[Index][0] = 0;
+			NumBatchedTicks[Index][1] = 0;
+		}
+
 		for (int32 Index = 0; Index < TG_MAX; Index++)
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
@@ -254,14 +365,35 @@ public:
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
 			check(!TickGroupStartEvents[Index].GetReference()); // this should have been NULL'ed out after it was released
+			check(!OpenTickBatches[Index][0].TickFunctions.Num() && !OpenTickBatches[Index][1].TickFunctions.Num()); // batches were flushed when their tick group was released
+		}
+		for (int32 Index = 0; Index < TG_MAX; Index++)
+		{
+			INC_DWORD_STAT_BY(STAT_TicksBatched, NumBatchedTicks[Index][0] + NumBatchedTicks[Index][1]);
 		}
 	}
 private:
 
 	FTickTaskSequencer()
 		: bAllowConcurrentTicks(false)
+		, bAllowBatchedTicks(false)
 		, bLogTicks(false)
 	{
+		FMemory::Memzero(NumBatchedTicks);
+		FMemory::Memzero(TickBatchSizes);
+	}
+
+	/** Start the task running a batch, and start a new batch for the tick group and thread. **/
+	void DispatchTickBatch(ETickingGroup TickGroup, int32 ThreadIndex, ENamedThreads::Type CurrentThread)
+	{
+		FTickBatch& Batch = OpenTickBatches[TickGroup][ThreadIndex];
+		check(Batch.CompletionEvent.GetReference() && Batch.TickFunctions.Num());
+
+		FGraphEventArray TaskPrerequisites;
+		TaskPrerequisites.Add(GetTickGroupStartEvent(TickGroup));
+		TGraphTask<FTickFunctionBatchTask>::CreateTask(&TaskPrerequisites, CurrentThread).ConstructAndDispatchWhenReady(Batch, bLogTicks);
+		check(!Batch.TickFunctions.Num() && !Batch.CompletionEvent.GetReference());
+		INC_DWORD_STAT(STAT_TickBatches);
 	}
 
 	void DispatchTickGroup(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent,ETickingGroup WorldTickGroup)
@@ -318,10 +450,63 @@ private:
 			{
 				UE_LOG(LogTick, Log, TEXT("tick %6d %2d %s"),GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
 			}
-			Target->ExecuteTick(Context.DeltaSeconds, Context.TickType, CurrentThread, MyCompletionGraphEvent);
+			Target->ExecuteTick(Target->TickDeltaSeconds, Context.TickType, CurrentThread, MyCompletionGraphEvent);
 			Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
 		}
 	};
+
+	/** Helper class define the task of ticking a batch of tick functions that have no prerequisites. The batch has its own completion event, shared by the tick functions. **/
+	class FTickFunctionBatchTask
+	{
+		/** Functions to tick **/
+		TArray<FTickFunction*>	Targets;
+		/** Completion event of the tick functions **/
+		FGraphEventRef			CompletionEvent;
+		/** tick context, here thread is desired execution thread **/
+		FTickContext			Context;
+		/** If true, log each tick **/
+		bool					bLogTick; 
+	public:
+		/** Constructor
+		 * @param InBatch - Batch to tick, the tick functions and completion event are moved out of it
+		 * @param InbLogTick - If true, log each tick
+		**/
+		FTickFunctionBatchTask(FTickBatch& InBatch, bool InbLogTick)
+			: Context(InBatch.Context)
+			, bLogTick(InbLogTick)
+		{
+			Exchange(Targets, InBatch.TickFunctions);
+			CompletionEvent.Swap(InBatch.CompletionEvent);
+		}
+		FORCEINLINE TStatId GetStatId() const
+		{
+			RETURN_QUICK_DECLARE_CYCLE_STAT(FTickFunctionBatchTask, STATGROUP_TaskGraphTasks);
+		}
+		/** return the thread for this task **/
+		ENamedThreads::Type GetDesiredThread()
+		{
+			return Context.Thread;
+		}
+		static ESubsequentsMode::Type GetSubsequentsMode() 
+		{ 
+			// the tick functions' completion event is completed by hand once they are all ticked
+			return ESubsequentsMode::FireAndForget; 
+		}
+		void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+		{
+			for (int32 Index = 0; Index < Targets.Num(); Index++)
+			{
+				FTickFunction* Target = Targets[Index];
+				if (bLogTick)
+				{
+					UE_LOG(LogTick, Log, TEXT("tick %6d %2d %s (batched)"),GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
+				}
+				Target->ExecuteTick(Target->TickDeltaSeconds, Context.TickType, CurrentThread, CompletionEvent);
+				Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
+			}
+			CompletionEvent->DispatchSubsequents(CurrentThread);
+		}
+	};
 };
 
 
@@ -617,10 +802,16 @@ public:
 		if (!bConcurrentQueue)
 		{
 			// single threaded case
+			const uint32 StartCycles = FPlatformTime::Cycles();
 			for( int32 LevelIndex = 0; LevelIndex < LevelList.Num(); LevelIndex++ )
 			{
 				LevelList[LevelIndex]->QueueAllTicks();
 			}
+			TickTaskSequencer.FlushTickBatches(ENamedThreads::GameThread);
+			if (TotalTickFunctions)
+			{
+				SET_FLOAT_STAT(STAT_QueueTicksPerTick, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - StartCycles) * 1000.0f / TotalTickFunctions);
+			}
 		}
 		else
 		{
@@ -732,6 +923,7 @@ public:
 				{
 					Num += LevelList[LevelIndex]->QueueNewlySpawned(Context.TickGroup);
 				}
+				TickTaskSequencer.FlushTickBatches(ENamedThreads::GameThread);
 				if (Num && Context.TickGroup == TG_NewlySpawned)
 				{
 					TickTaskSequencer.ReleaseTickGroup(TG_NewlySpawned, true);
@@ -949,10 +1141,13 @@ FTickFunction::FTickFunction()
 	, bCanEverTick(false)
 	, bAllowTickOnDedicatedServer(true)
 	, bRunOnAnyThread(false)
+	, TickInterval(0.0f)
 	, bRegistered(false)
 	, bTickEnabled(true)
 	, TickVisitedGFrameCounter(0)
 	, TickQueuedGFrameCounter(0)
+	, TimeSinceLastTick(0.0f)
+	, TickDeltaSeconds(0.0f)
 	, ActualTickGroup(TG_PrePhysics)
 	, EnableParent(NULL)
 	, TickTaskLevel(NULL)
@@ -1039,6 +1234,30 @@ void FTickFunction::RemovePrerequisite(UObject* TargetObject, struct FTickFuncti
 	Prerequisites.RemoveSwap(FTickPrerequisite(TargetObject, TargetTickFunction));
 }
 
+/**
+	* Accumulates the frame time and checks if this tick function is due this frame, according to TickInterval
+	* @param DeltaSeconds - frame time to advance, in seconds
+*/
+bool FTickFunction::UpdateTickInterval(float DeltaSeconds)
+{
+	if (TickInterval <= 0.0f)
+	{
+		TickDeltaSeconds = TimeSinceLastTick + DeltaSeconds;
+		TimeSinceLastTick = 0.0f;
+		return true;
+	}
+
+	TimeSinceLastTick += DeltaSeconds;
+	if (TimeSinceLastTick < TickInterval)
+	{
+		// not due yet; without a completion handle, the ticks that depend on this one won't wait for it
+		return false;
+	}
+	TickDeltaSeconds = TimeSinceLastTick;
+	TimeSinceLastTick = 0.0f;
+	return true;
+}
+
 /**
 	* Queues a tick function for execution from the game thread
 	* @param TickContext - context to tick in
@@ -1051,7 +1270,7 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 	if (TickVisitedGFrameCounter != GFrameCounter)
 	{
 		TickVisitedGFrameCounter = GFrameCounter;
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled) && UpdateTickInterval(TickContext.DeltaSeconds))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
@@ -1093,12 +1312,20 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 			}
 			ActualTickGroup = MyActualTickGroup;
 
-			// we don't need to add a tick group prerequisite if we already have a prerequisite in the correct tick group (in that case, the delay until the correct tick group is implicit)
-			if (!TaskPrerequisites.Num() || MaxPrerequisiteTickGroup < MyActualTickGroup)
+			if (!TaskPrerequisites.Num())
 			{
-				TaskPrerequisites.Add(FTickTaskSequencer::Get().GetTickGroupStartEvent(MyActualTickGroup));
+				// nothing to wait for but the tick group, so this can run along with the other ticks of the group
+				FTickTaskSequencer::Get().QueueBatchedTickTask(this, TickContext);
+			}
+			else
+			{
+				// we don't need to add a tick group prerequisite if we already have a prerequisite in the correct tick group (in that case, the delay until the correct tick group is implicit)
+				if (MaxPrerequisiteTickGroup < MyActualTickGroup)
+				{
+					TaskPrerequisites.Add(FTickTaskSequencer::Get().GetTickGroupStartEvent(MyActualTickGroup));
+				}
+				FTickTaskSequencer::Get().QueueTickTask(&TaskPrerequisites, this, TickContext);
 			}
-			FTickTaskSequencer::Get().QueueTickTask(&TaskPrerequisites, this, TickContext);
 		}
 		TickQueuedGFrameCounter = GFrameCounter;
 	}
@@ -1124,7 +1351,7 @@ void FTickFunction::QueueTickFunctionParallel(const FTickContext& TickContext, T
 	if (bProcessTick)
 	{
 		check(bRegistered);
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled) && UpdateTickInterval(TickContext.DeltaSeconds))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
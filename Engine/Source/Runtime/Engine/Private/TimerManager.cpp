@@ -1,19 +1,25 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 
 /*=============================================================================
-	TickTaskManager.cpp: Manager for ticking tasks
+	TimerManager.cpp: Global gameplay timer facility
 =============================================================================*/
 
 #include "EnginePrivate.h"
 
-void FTimerHandle::MakeValid()
+/** Serial numbers are shared by all timer managers, so handles are unique even across worlds. */
+static uint64 LastAssignedSerialNumber = 0;
+
+static uint64 GetNextTimerSerialNumber()
 {
-	static int LastAssignedHandle = -1;
+	return ++LastAssignedSerialNumber;
+}
 
+void FTimerHandle::MakeValid()
+{
 	if (!IsValid())
 	{
-		++LastAssignedHandle;
-		Handle = LastAssignedHandle;
+		// No timer manager uses this handle, so it can point to any index
+		SetIndexAndSerialNumber(0, GetNextTimerSerialNumber());
 	}
 
 	check(IsValid());
@@ -32,136 +38,166 @@ inline bool DEPRECATED_CompareUnifiedDelegates(const FTimerUnifiedDelegate& Lhs,
 /** Will find and return a timer if it exists, regardless whether it is paused. */ 
 FTimerData const* FTimerManager::DEPRECATED_FindTimer(FTimerUnifiedDelegate const& InDelegate, int32* OutTimerIndex) const
 {
-	int32 ActiveTimerIdx = DEPRECATED_FindTimerInList(ActiveTimerHeap, InDelegate);
-	if (ActiveTimerIdx != INDEX_NONE)
+	for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 	{
-		// found it in the active heap
-		if (OutTimerIndex)
+		FTimerData const& Timer = *It;
+		if (Timer.bSetWithoutHandle && Timer.Status != ETimerStatus::Executing && DEPRECATED_CompareUnifiedDelegates(Timer.TimerDelegate, InDelegate))
 		{
-			*OutTimerIndex = ActiveTimerIdx;
+			if (OutTimerIndex)
+			{
+				*OutTimerIndex = It.GetIndex();
+			}
+			return &Timer;
 		}
-		return &ActiveTimerHeap[ActiveTimerIdx];
 	}
 
-	int32 PausedTimerIdx = DEPRECATED_FindTimerInList(PausedTimerList, InDelegate);
-	if (PausedTimerIdx != INDEX_NONE)
+	return nullptr;
+}
+
+FTimerData const* FTimerManager::FindTimer(FTimerHandle const& InHandle, int32* OutTimerIndex) const
+{
+	if (!InHandle.IsValid())
 	{
-		// found it in the paused list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PausedTimerIdx;
-		}
-		return &PausedTimerList[PausedTimerIdx];
+		return nullptr;
 	}
 
-	int32 PendingTimerIdx = DEPRECATED_FindTimerInList(PendingTimerList, InDelegate);
-	if (PendingTimerIdx != INDEX_NONE)
+	const int32 TimerIdx = InHandle.GetIndex();
+	if (TimerIdx >= Timers.GetMaxIndex() || !Timers.IsAllocated(TimerIdx))
 	{
-		// found it in the pending list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PendingTimerIdx;
-		}
-		return &PendingTimerList[PendingTimerIdx];
+		return nullptr;
 	}
 
-	return nullptr;
-}
-
-FTimerData const* FTimerManager::FindTimer(FTimerHandle const& InHandle, int32* OutTimerIndex) const
-{
-	int32 ActiveTimerIdx = FindTimerInList(ActiveTimerHeap, InHandle);
-	if (ActiveTimerIdx != INDEX_NONE)
+	// The serial number tells apart the timer the handle was given for and a later timer reusing the slot
+	FTimerData const& Timer = Timers[TimerIdx];
+	if (Timer.TimerHandle != InHandle || Timer.Status == ETimerStatus::Executing)
 	{
-		// found it in the active heap
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = ActiveTimerIdx;
-		}
-		return &ActiveTimerHeap[ActiveTimerIdx];
+		return nullptr;
 	}
 
-	int32 PausedTimerIdx = FindTimerInList(PausedTimerList, InHandle);
-	if (PausedTimerIdx != INDEX_NONE)
+	if (OutTimerIndex)
 	{
-		// found it in the paused list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PausedTimerIdx;
-		}
-		return &PausedTimerList[PausedTimerIdx];
+		*OutTimerIndex = TimerIdx;
 	}
+	return &Timer;
+}
 
-	int32 PendingTimerIdx = FindTimerInList(PendingTimerList, InHandle);
-	if (PendingTimerIdx != INDEX_NONE)
+/** Finds a handle to a dynamic timer bound to a particular pointer and function name. */
+FTimerHandle FTimerManager::K2_FindDynamicTimerHandle(FTimerDynamicDelegate InDynamicDelegate) const
+{
+	for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 	{
-		// found it in the pending list
-		if (OutTimerIndex)
+		if (It->TimerDelegate.FuncDynDelegate == InDynamicDelegate)
 		{
-			*OutTimerIndex = PendingTimerIdx;
+			return It->TimerHandle;
 		}
-		return &PendingTimerList[PendingTimerIdx];
 	}
 
-	return nullptr;
+	return FTimerHandle();
+}
+
+
+int32 FTimerManager::AddTimer(FTimerData const& TimerData)
+{
+	const int32 TimerIdx = Timers.Add(TimerData);
+	Timers[TimerIdx].TimerHandle.SetIndexAndSerialNumber(TimerIdx, GetNextTimerSerialNumber());
+	return TimerIdx;
 }
 
+void FTimerManager::RemoveTimer(int32 TimerIdx)
+{
+	checkSlow(Timers[TimerIdx].HeapIndex == INDEX_NONE);
+	Timers.RemoveAt(TimerIdx);
+}
+
+void FTimerManager::AddToActiveHeap(int32 TimerIdx)
+{
+	FTimerData& Timer = Timers[TimerIdx];
+	Timer.Status = ETimerStatus::Active;
+	const int32 HeapIdx = ActiveTimerHeap.Add(FTimerHeapEntry(Timer.ExpireTime, TimerIdx));
+	Timer.HeapIndex = HeapIdx;
+	ActiveHeapSiftUp(HeapIdx);
+}
 
-/** Will find the given timer in the given TArray and return its index. */ 
-int32 FTimerManager::DEPRECATED_FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerUnifiedDelegate const& InDelegate) const
+void FTimerManager::RemoveFromActiveHeap(int32 TimerIdx)
 {
-	for (int32 Idx=0; Idx<SearchArray.Num(); ++Idx)
+	FTimerData& Timer = Timers[TimerIdx];
+	const int32 HeapIdx = Timer.HeapIndex;
+	check(ActiveTimerHeap.IsValidIndex(HeapIdx) && ActiveTimerHeap[HeapIdx].TimerIndex == TimerIdx);
+	Timer.HeapIndex = INDEX_NONE;
+
+	// move the last entry in the hole and let it find its place, up or down
+	const int32 LastHeapIdx = ActiveTimerHeap.Num() - 1;
+	if (HeapIdx != LastHeapIdx)
 	{
-		if (!SearchArray[Idx].TimerHandle.IsValid() && DEPRECATED_CompareUnifiedDelegates(SearchArray[Idx].TimerDelegate, InDelegate))
+		ActiveTimerHeap[HeapIdx] = ActiveTimerHeap[LastHeapIdx];
+		Timers[ActiveTimerHeap[HeapIdx].TimerIndex].HeapIndex = HeapIdx;
+		ActiveTimerHeap.RemoveAt(LastHeapIdx, 1, false);
+
+		if (HeapIdx > 0 && ActiveTimerHeap[HeapIdx].ExpireTime < ActiveTimerHeap[(HeapIdx - 1) / 2].ExpireTime)
+		{
+			ActiveHeapSiftUp(HeapIdx);
+		}
+		else
 		{
-			return Idx;
+			ActiveHeapSiftDown(HeapIdx);
 		}
 	}
-
-	return INDEX_NONE;
+	else
+	{
+		ActiveTimerHeap.RemoveAt(LastHeapIdx, 1, false);
+	}
 }
 
-/** Will find the given timer in the given TArray and return its index. */
-int32 FTimerManager::FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle) const
+void FTimerManager::ActiveHeapSiftUp(int32 HeapIdx)
 {
-	if (InHandle.IsValid())
+	const FTimerHeapEntry Entry = ActiveTimerHeap[HeapIdx];
+	while (HeapIdx > 0)
 	{
-		for (int32 Idx = 0; Idx < SearchArray.Num(); ++Idx)
+		const int32 ParentIdx = (HeapIdx - 1) / 2;
+		if (!(Entry.ExpireTime < ActiveTimerHeap[ParentIdx].ExpireTime))
 		{
-			if (SearchArray[Idx].TimerHandle == InHandle)
-			{
-				return Idx;
-			}
+			break;
 		}
+
+		ActiveTimerHeap[HeapIdx] = ActiveTimerHeap[ParentIdx];
+		Timers[ActiveTimerHeap[HeapIdx].TimerIndex].HeapIndex = HeapIdx;
+		HeapIdx = ParentIdx;
 	}
 
-	return INDEX_NONE;
+	ActiveTimerHeap[HeapIdx] = Entry;
+	Timers[Entry.TimerIndex].HeapIndex = HeapIdx;
 }
 
-/** Finds a handle to a dynamic timer bound to a particular pointer and function name. */
-FTimerHandle FTimerManager::K2_FindDynamicTimerHandle(FTimerDynamicDelegate InDynamicDelegate) const
+void FTimerManager::ActiveHeapSiftDown(int32 HeapIdx)
 {
-	if (CurrentlyExecutingTimer.TimerDelegate.FuncDynDelegate == InDynamicDelegate)
+	const FTimerHeapEntry Entry = ActiveTimerHeap[HeapIdx];
+	const int32 HeapSize = ActiveTimerHeap.Num();
+	for (;;)
 	{
-		return CurrentlyExecutingTimer.TimerHandle;
-	}
+		int32 ChildIdx = HeapIdx * 2 + 1;
+		if (ChildIdx >= HeapSize)
+		{
+			break;
+		}
 
-	if (auto* Timer = ActiveTimerHeap.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
-	}
+		// pick the child that expires first
+		if (ChildIdx + 1 < HeapSize && ActiveTimerHeap[ChildIdx + 1].ExpireTime < ActiveTimerHeap[ChildIdx].ExpireTime)
+		{
+			++ChildIdx;
+		}
 
-	if (auto* Timer = PausedTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
-	}
+		if (!(ActiveTimerHeap[ChildIdx].ExpireTime < Entry.ExpireTime))
+		{
+			break;
+		}
 
-	if (auto* Timer = PendingTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
+		ActiveTimerHeap[HeapIdx] = ActiveTimerHeap[ChildIdx];
+		Timers[ActiveTimerHeap[HeapIdx].TimerIndex].HeapIndex = HeapIdx;
+		HeapIdx = ChildIdx;
 	}
 
-	return FTimerHandle();
+	ActiveTimerHeap[HeapIdx] = Entry;
+	Timers[Entry.TimerIndex].HeapIndex = HeapIdx;
 }
 
 
@@ -179,6 +215,7 @@ void FTimerManager::DEPRECATED_InternalSetTimer(FTimerUnifiedDelegate const& InD
 		// set up the new timer
 		FTimerData NewTimerData;
 		NewTimerData.TimerDelegate = InDelegate;
+		NewTimerData.bSetWithoutHandle = true;
 
 		InternalSetTimer(NewTimerData, InRate, InbLoop, InFirstDelay);
 	}
@@ -198,39 +235,44 @@ void FTimerManager::InternalSetTimer(FTimerHandle& InOutHandle, FTimerUnifiedDel
 
 	if (InRate > 0.f)
 	{
-		InOutHandle.MakeValid();
-
 		// set up the new timer
 		FTimerData NewTimerData;
-		NewTimerData.TimerHandle = InOutHandle;
 		NewTimerData.TimerDelegate = InDelegate;
 
 		InternalSetTimer(NewTimerData, InRate, InbLoop, InFirstDelay);
+
+		// the handle is made of the new timer's index, so it changes every time the timer is set
+		InOutHandle = NewTimerData.TimerHandle;
 	}
 }
 
 void FTimerManager::InternalSetTimer(FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay)
 {
-	if (NewTimerData.TimerHandle.IsValid() || NewTimerData.TimerDelegate.IsBound())
+	// timers set without a handle can only be found through their delegate, so they need one
+	if (!NewTimerData.bSetWithoutHandle || NewTimerData.TimerDelegate.IsBound())
 	{
 		NewTimerData.Rate = InRate;
 		NewTimerData.bLoop = InbLoop;
 
 		const float FirstDelay = (InFirstDelay >= 0.f) ? InFirstDelay : InRate;
 
+		int32 TimerIdx;
 		if (HasBeenTickedThisFrame())
 		{
 			NewTimerData.ExpireTime = InternalTime + FirstDelay;
-			NewTimerData.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(NewTimerData);
+			TimerIdx = AddTimer(NewTimerData);
+			AddToActiveHeap(TimerIdx);
 		}
 		else
 		{
 			// Store time remaining in ExpireTime while pending
 			NewTimerData.ExpireTime = FirstDelay;
 			NewTimerData.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(NewTimerData);
+			TimerIdx = AddTimer(NewTimerData);
+			PendingTimerSet.Add(TimerIdx);
 		}
+
+		NewTimerData.TimerHandle = Timers[TimerIdx].TimerHandle;
 	}
 }
 
@@ -242,10 +284,10 @@ void FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate const& InD
 	FTimerData NewTimerData;
 	NewTimerData.Rate = 0.f;
 	NewTimerData.bLoop = false;
+	NewTimerData.bSetWithoutHandle = true;
 	NewTimerData.TimerDelegate = InDelegate;
 	NewTimerData.ExpireTime = InternalTime;
-	NewTimerData.Status = ETimerStatus::Active;
-	ActiveTimerHeap.HeapPush(NewTimerData);
+	AddToActiveHeap(AddTimer(NewTimerData));
 }
 
 void FTimerManager::DEPRECATED_InternalClearTimer(FTimerUnifiedDelegate const& InDelegate)
@@ -257,15 +299,18 @@ void FTimerManager::DEPRECATED_InternalClearTimer(FTimerUnifiedDelegate const& I
 	FTimerData const* const TimerData = DEPRECATED_FindTimer(InDelegate, &TimerIdx);
 	if (TimerData)
 	{
-		InternalClearTimer(TimerIdx, TimerData->Status);
+		InternalClearTimer(TimerIdx);
 	}
-	else
+	else if (CurrentlyExecutingTimer.IsValid())
 	{
-		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
+		// Edge case. We're currently handling this timer when it got cleared.  Remove it to prevent it firing again
 		// in case it was scheduled to fire multiple times.
-		if (!CurrentlyExecutingTimer.TimerHandle.IsValid() && DEPRECATED_CompareUnifiedDelegates(CurrentlyExecutingTimer.TimerDelegate, InDelegate))
+		const int32 ExecutingTimerIdx = CurrentlyExecutingTimer.GetIndex();
+		FTimerData const& ExecutingTimer = Timers[ExecutingTimerIdx];
+		if (ExecutingTimer.bSetWithoutHandle && DEPRECATED_CompareUnifiedDelegates(ExecutingTimer.TimerDelegate, InDelegate))
 		{
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
+			RemoveTimer(ExecutingTimerIdx);
+			CurrentlyExecutingTimer.Invalidate();
 		}
 	}
 }
@@ -275,7 +320,7 @@ void FTimerManager::InternalClearTimer(FTimerHandle const& InHandle)
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	// Skip if the handle is invalid as it  would not be found by FindTimer and unbind the current handler if it also used INDEX_NONE. 
+	// Skip if the handle is invalid as it would not be found by FindTimer and would match an invalid currently executing handle.
 	if (!InHandle.IsValid())
 	{
 		return;
@@ -285,39 +330,45 @@ void FTimerManager::InternalClearTimer(FTimerHandle const& InHandle)
 	FTimerData const* const TimerData = FindTimer(InHandle, &TimerIdx);
 	if (TimerData)
 	{
-		InternalClearTimer(TimerIdx, TimerData->Status);
+		InternalClearTimer(TimerIdx);
 	}
 	else
 	{
-		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
+		// Edge case. We're currently handling this timer when it got cleared.  Remove it to prevent it firing again
 		// in case it was scheduled to fire multiple times.
-		if (CurrentlyExecutingTimer.TimerHandle == InHandle)
+		if (CurrentlyExecutingTimer == InHandle)
 		{
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
-			CurrentlyExecutingTimer.TimerHandle.Invalidate();
+			RemoveTimer(InHandle.GetIndex());
+			CurrentlyExecutingTimer.Invalidate();
 		}
 	}
 }
 
-void FTimerManager::InternalClearTimer(int32 TimerIdx, ETimerStatus::Type TimerStatus)
+void FTimerManager::InternalClearTimer(int32 TimerIdx)
 {
-	switch (TimerStatus)
+	switch (Timers[TimerIdx].Status)
 	{
 		case ETimerStatus::Pending:
-			PendingTimerList.RemoveAtSwap(TimerIdx);
+			PendingTimerSet.Remove(TimerIdx);
 			break;
 
 		case ETimerStatus::Active:
-			ActiveTimerHeap.HeapRemoveAt(TimerIdx);
+			RemoveFromActiveHeap(TimerIdx);
 			break;
 
 		case ETimerStatus::Paused:
-			PausedTimerList.RemoveAtSwap(TimerIdx);
+			break;
+
+		case ETimerStatus::Executing:
+			check(CurrentlyExecutingTimer == Timers[TimerIdx].TimerHandle);
+			CurrentlyExecutingTimer.Invalidate();
 			break;
 
 		default:
 			check(false);
 	}
+
+	RemoveTimer(TimerIdx);
 }
 
 
@@ -325,48 +376,15 @@ void FTimerManager::InternalClearAllTimers(void const* Object)
 {
 	if (Object)
 	{
-		// search active timer heap for timers using this object and remove them
-		int32 const OldActiveHeapSize = ActiveTimerHeap.Num();
-
-		for (int32 Idx=0; Idx<ActiveTimerHeap.Num(); ++Idx)
-		{
-			if ( ActiveTimerHeap[Idx].TimerDelegate.IsBoundToObject(Object) )
-			{
-				// remove this item
-				// this will break the heap property, but we will re-heapify afterward
-				ActiveTimerHeap.RemoveAtSwap(Idx--);
-			}
-		}
-		if (OldActiveHeapSize != ActiveTimerHeap.Num())
-		{
-			// need to heapify
-			ActiveTimerHeap.Heapify();
-		}
-
-		// search paused timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PausedTimerList.Num(); ++Idx)
-		{
-			if (PausedTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
-			{
-				PausedTimerList.RemoveAtSwap(Idx--);
-			}
-		}
-
-		// search pending timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PendingTimerList.Num(); ++Idx)
+		// search all timers, including the one currently executing, for timers using this object and remove them.
+		// removing from the sparse array doesn't move the other timers so we can keep going.
+		for (int32 TimerIdx = 0; TimerIdx < Timers.GetMaxIndex(); ++TimerIdx)
 		{
-			if (PendingTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
+			if (Timers.IsAllocated(TimerIdx) && Timers[TimerIdx].TimerDelegate.IsBoundToObject(Object))
 			{
-				PendingTimerList.RemoveAtSwap(Idx--);
+				InternalClearTimer(TimerIdx);
 			}
 		}
-
-		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
-		// in case it was scheduled to fire multiple times.
-		if (CurrentlyExecutingTimer.TimerDelegate.IsBoundToObject(Object))
-		{
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
-		}
 	}
 }
 
@@ -424,59 +442,50 @@ void FTimerManager::InternalPauseTimer( FTimerData const* TimerToPause, int32 Ti
 
 	if( TimerToPause && (TimerToPause->Status != ETimerStatus::Paused) )
 	{
-		ETimerStatus::Type PreviousStatus = TimerToPause->Status;
-
-		// Add to Paused list
-		int32 NewIndex = PausedTimerList.Add(*TimerToPause);
+		FTimerData& Timer = Timers[TimerIdx];
 
-		// Set new status
-		FTimerData &NewTimer = PausedTimerList[NewIndex];
-		NewTimer.Status = ETimerStatus::Paused;
-
-		// Remove from previous TArray
-		switch( PreviousStatus )
+		// Remove from previous container
+		switch( Timer.Status )
 		{
 			case ETimerStatus::Active : 
 				// Store time remaining in ExpireTime while paused
-				NewTimer.ExpireTime = NewTimer.ExpireTime - InternalTime;
-				ActiveTimerHeap.HeapRemoveAt(TimerIdx); 
+				RemoveFromActiveHeap(TimerIdx);
+				Timer.ExpireTime = Timer.ExpireTime - InternalTime;
 				break;
 			
 			case ETimerStatus::Pending : 
-				PendingTimerList.RemoveAtSwap(TimerIdx); 
+				PendingTimerSet.Remove(TimerIdx);
 				break;
 
 			default : check(false);
 		}
+
+		// Set new status
+		Timer.Status = ETimerStatus::Paused;
 	}
 }
 
-void FTimerManager::InternalUnPauseTimer(int32 PausedTimerIdx)
+void FTimerManager::InternalUnPauseTimer( FTimerData const* TimerToUnPause, int32 TimerIdx )
 {
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	if (PausedTimerIdx != INDEX_NONE)
+	if( TimerToUnPause && (TimerToUnPause->Status == ETimerStatus::Paused) )
 	{
-		FTimerData& TimerToUnPause = PausedTimerList[PausedTimerIdx];
-		check(TimerToUnPause.Status == ETimerStatus::Paused);
+		FTimerData& Timer = Timers[TimerIdx];
 
-		// Move it out of paused list and into proper TArray
+		// Move it out of paused state and into the proper container
 		if( HasBeenTickedThisFrame() )
 		{
 			// Convert from time remaining back to a valid ExpireTime
-			TimerToUnPause.ExpireTime += InternalTime;
-			TimerToUnPause.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(TimerToUnPause);
+			Timer.ExpireTime += InternalTime;
+			AddToActiveHeap(TimerIdx);
 		}
 		else
 		{
-			TimerToUnPause.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(TimerToUnPause);
+			Timer.Status = ETimerStatus::Pending;
+			PendingTimerSet.Add(TimerIdx);
 		}
-
-		// remove from paused list
-		PausedTimerList.RemoveAtSwap(PausedTimerIdx);
 	}
 }
 
@@ -493,45 +502,56 @@ void FTimerManager::Tick(float DeltaTime)
 
 	while (ActiveTimerHeap.Num() > 0)
 	{
-		FTimerData& Top = ActiveTimerHeap.HeapTop();
+		FTimerHeapEntry const& Top = ActiveTimerHeap[0];
 		if (InternalTime > Top.ExpireTime)
 		{
 			// Timer has expired! Fire the delegate, then handle potential looping.
 
-			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer); 
+			// Remove it from the heap and flag it while we're executing
+			const int32 TimerIdx = Top.TimerIndex;
+			RemoveFromActiveHeap(TimerIdx);
+
+			FTimerData& Timer = Timers[TimerIdx];
+			Timer.Status = ETimerStatus::Executing;
+			CurrentlyExecutingTimer = Timer.TimerHandle;
 
 			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
-			int32 const CallCount = CurrentlyExecutingTimer.bLoop ? 
-				FMath::TruncToInt( (InternalTime - CurrentlyExecutingTimer.ExpireTime) / CurrentlyExecutingTimer.Rate ) + 1
+			int32 const CallCount = Timer.bLoop ? 
+				FMath::TruncToInt( (InternalTime - Timer.ExpireTime) / Timer.Rate ) + 1
 				: 1;
 
+			// Copy the delegate, the delegate can add timers which may move the timer data
+			FTimerUnifiedDelegate TimerDelegate = Timer.TimerDelegate;
+
 			// Now call the function
 			for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
 			{ 
-				CurrentlyExecutingTimer.TimerDelegate.Execute();
+				TimerDelegate.Execute();
 
 				// If timer was cleared in the delegate execution, don't execute further 
-				if( !CurrentlyExecutingTimer.TimerHandle.IsValid() && !CurrentlyExecutingTimer.TimerDelegate.IsBound() )
+				if( !CurrentlyExecutingTimer.IsValid() )
 				{
 					break;
 				}
 			}
 
-			if( CurrentlyExecutingTimer.bLoop && 
-				(CurrentlyExecutingTimer.TimerHandle.IsValid() ||
-				 CurrentlyExecutingTimer.TimerDelegate.IsBound()) && 							// did not get cleared during execution
-				(CurrentlyExecutingTimer.TimerHandle.IsValid() ? 
-					(FindTimer(CurrentlyExecutingTimer.TimerHandle) == nullptr) : 
-					(DEPRECATED_FindTimer(CurrentlyExecutingTimer.TimerDelegate) == nullptr)) // did not get manually re-added during execution			  
-				)
+			// A timer that got cleared during execution is already gone, this includes timers that were re-added during execution
+			if( CurrentlyExecutingTimer.IsValid() )
 			{
-				// Put this timer back on the heap
-				CurrentlyExecutingTimer.ExpireTime += CallCount * CurrentlyExecutingTimer.Rate;
-				ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer);
-			}
+				FTimerData& ExecutedTimer = Timers[TimerIdx];
+				if( ExecutedTimer.bLoop )
+				{
+					// Put this timer back on the heap
+					ExecutedTimer.ExpireTime += CallCount * ExecutedTimer.Rate;
+					AddToActiveHeap(TimerIdx);
+				}
+				else
+				{
+					RemoveTimer(TimerIdx);
+				}
 
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
+				CurrentlyExecutingTimer.Invalidate();
+			}
 		}
 		else
 		{
@@ -544,17 +564,16 @@ void FTimerManager::Tick(float DeltaTime)
 	LastTickedFrame = GFrameCounter;
 
 	// If we have any Pending Timers, add them to the Active Queue.
-	if( PendingTimerList.Num() > 0 )
+	if( PendingTimerSet.Num() > 0 )
 	{
-		for(int32 Index=0; Index<PendingTimerList.Num(); Index++)
+		for (TSet<int32>::TConstIterator It(PendingTimerSet); It; ++It)
 		{
-			FTimerData& TimerToActivate = PendingTimerList[Index];
+			const int32 TimerIdx = *It;
 			// Convert from time remaining back to a valid ExpireTime
-			TimerToActivate.ExpireTime += InternalTime;
-			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( TimerToActivate );
+			Timers[TimerIdx].ExpireTime += InternalTime;
+			AddToActiveHeap(TimerIdx);
 		}
-		PendingTimerList.Empty();
+		PendingTimerSet.Empty();
 	}
 }
 
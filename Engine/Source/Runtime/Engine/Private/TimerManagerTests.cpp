@@ -4,6 +4,7 @@
 #include "TimerManager.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerTest, "Engine.TimerManager", EAutomationTestFlags::ATF_Editor)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerPerformanceTest, "Engine.TimerManager.Performance", EAutomationTestFlags::ATF_Editor)
 
 #define TIMER_TEST_TEXT( Format, ... ) FString::Printf(TEXT("%s - %d: %s"), TEXT(__FILE__) , __LINE__ , *FString::Printf(TEXT(Format), ##__VA_ARGS__) )
 
@@ -287,3 +288,95 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 }
 
 
+
+struct FTimerPerformanceCounter
+{
+	FTimerPerformanceCounter() : Count(0) {}
+
+	void Callback() { ++Count; }
+
+	int32 Count;
+};
+
+// Times the handle based timer operations with a large number of timers, each of them used to search the timer lists
+bool FTimerManagerPerformanceTest::RunTest(const FString& Parameters)
+{
+	const int32 NumTimers = 100000;
+
+	FTimerManager TimerManager;
+	FTimerPerformanceCounter Counter;
+	FRandomStream RandomStream(0x5eed);
+
+	TArray<FTimerHandle> Handles;
+	Handles.AddZeroed(NumTimers);
+
+	const FTimerDelegate Delegate = FTimerDelegate::CreateRaw(&Counter, &FTimerPerformanceCounter::Callback);
+
+	// get the timers out of the pending list, so they go straight to the active heap
+	TimerManager.Tick(0.f);
+
+	double Time = -FPlatformTime::Seconds();
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; ++TimerIdx)
+	{
+		TimerManager.SetTimer(Handles[TimerIdx], Delegate, RandomStream.FRandRange(1.f, 100.f), (TimerIdx & 1) != 0);
+	}
+	Time += FPlatformTime::Seconds();
+	AddLogItem(FString::Printf(TEXT("SetTimer: %.2f ms for %d timers"), Time * 1000.0, NumTimers));
+
+	int32 NumActive = 0;
+	Time = -FPlatformTime::Seconds();
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; ++TimerIdx)
+	{
+		NumActive += TimerManager.IsTimerActive(Handles[TimerIdx]) ? 1 : 0;
+	}
+	Time += FPlatformTime::Seconds();
+	AddLogItem(FString::Printf(TEXT("IsTimerActive: %.2f ms for %d timers"), Time * 1000.0, NumTimers));
+	TestEqual(TEXT("All timers are active"), NumActive, NumTimers);
+
+	float TotalRemaining = 0.f;
+	Time = -FPlatformTime::Seconds();
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; ++TimerIdx)
+	{
+		TotalRemaining += TimerManager.GetTimerRemaining(Handles[TimerIdx]);
+	}
+	Time += FPlatformTime::Seconds();
+	AddLogItem(FString::Printf(TEXT("GetTimerRemaining: %.2f ms for %d timers (total %.0f s)"), Time * 1000.0, NumTimers, TotalRemaining));
+
+	Time = -FPlatformTime::Seconds();
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; TimerIdx += 2)
+	{
+		TimerManager.PauseTimer(Handles[TimerIdx]);
+	}
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; TimerIdx += 2)
+	{
+		TimerManager.UnPauseTimer(Handles[TimerIdx]);
+	}
+	Time += FPlatformTime::Seconds();
+	AddLogItem(FString::Printf(TEXT("PauseTimer and UnPauseTimer: %.2f ms for %d timers"), Time * 1000.0, NumTimers / 2));
+
+	Time = -FPlatformTime::Seconds();
+	for (int32 TickIdx = 0; TickIdx < 100; ++TickIdx)
+	{
+		TimerManager.Tick(0.5f);
+	}
+	Time += FPlatformTime::Seconds();
+	AddLogItem(FString::Printf(TEXT("Tick: %.2f ms for 100 ticks, %d timers fired"), Time * 1000.0, Counter.Count));
+	TestTrue(TEXT("Timers fired"), Counter.Count > 0);
+
+	Time = -FPlatformTime::Seconds();
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; ++TimerIdx)
+	{
+		TimerManager.ClearTimer(Handles[TimerIdx]);
+	}
+	Time += FPlatformTime::Seconds();
+	AddLogItem(FString::Printf(TEXT("ClearTimer: %.2f ms for %d timers"), Time * 1000.0, NumTimers));
+
+	int32 NumRemaining = 0;
+	for (int32 TimerIdx = 0; TimerIdx < NumTimers; ++TimerIdx)
+	{
+		NumRemaining += TimerManager.TimerExists(Handles[TimerIdx]) ? 1 : 0;
+	}
+	TestEqual(TEXT("All timers are cleared"), NumRemaining, 0);
+
+	return true;
+}
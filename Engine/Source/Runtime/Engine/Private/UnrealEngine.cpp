@@ -43,6 +43,7 @@
 #include "ScreenRendering.h"
 #include "RHIStaticStates.h"
 #include "AudioDevice.h"
+#include "AudioThread.h"
 #include "ActiveSound.h"
 #include "DeviceProfiles/DeviceProfileManager.h"
 #include "Animation/SkeletalMeshActor.h"
@@ -1615,6 +1616,9 @@ bool UEngine::InitializeAudioDevice()
 			FString AudioDeviceModuleName;
 			GConfig->GetString(TEXT("Audio"), TEXT("AudioDeviceModuleName"), AudioDeviceModuleName, GEngineIni);
 
+			// e.g. -AudioDeviceModule=SoftwareAudio to mix without audio hardware
+			FParse::Value(FCommandLine::Get(), TEXT("AudioDeviceModule="), AudioDeviceModuleName);
+
 			if (AudioDeviceModuleName.Len() > 0)
 			{
 				// load the module by name from the .ini
@@ -11671,6 +11675,9 @@ int32 UEngine::RenderStatSounds(UWorld* World, FViewport* Viewport, FCanvas* Can
 
 	if (AudioDevice)
 	{
+		// The active sounds belong to the audio thread
+		FAudioThreadSuspendContext SuspendContext;
+
 		// Refresh the wave instances inside audio components.
 		static TArray<FWaveInstance*> WaveInstances;
 		WaveInstances.Reset();
@@ -115,6 +115,7 @@ UWorld::UWorld( const FObjectInitializer& ObjectInitializer )
 ,	NextTravelType(TRAVEL_Relative)
 {
 	TimerManager = new FTimerManager();
+	SignificanceManager = new FSignificanceManager(this);
 #if WITH_EDITOR
 	bBroadcastSelectionChange = true; //Ed Only
 #endif // WITH_EDITOR
@@ -454,6 +455,11 @@ void UWorld::FinishDestroy()
 		delete TimerManager;
 	}
 
+	if (SignificanceManager)
+	{
+		delete SignificanceManager;
+	}
+
 	// Remove the PKG_ContainsMap flag from packages that no longer contain a world
 	{
 		UPackage* WorldPackage = GetOutermost();
@@ -59,6 +59,8 @@ AWorldSettings::AWorldSettings(const FObjectInitializer& ObjectInitializer)
 
 	DefaultColorScale = FVector(1.0f, 1.0f, 1.0f);
 
+	OffscreenSignificanceDistanceScale = 2.0f;
+
 	bPlaceCellsOnlyAlongCameraTracks = false;
 	VisibilityCellSize = 200;
 	VisibilityAggressiveness = VIS_LeastAggressive;
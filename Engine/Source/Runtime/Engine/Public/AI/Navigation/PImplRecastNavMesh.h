@@ -56,6 +56,29 @@ struct ENGINE_API FRecastSpeciaLinkFilter : public dtQuerySpecialLinkFilter
 	const UObject* SearchOwner;
 };
 
+/** Identifies path corridors that can be shared between path finding queries */
+struct FRecastPathCorridorKey
+{
+	NavNodeRef StartPoly;
+	NavNodeRef EndPoly;
+	/** CRC of the query filter's data */
+	uint32 FilterHash;
+
+	FRecastPathCorridorKey(NavNodeRef InStartPoly, NavNodeRef InEndPoly, uint32 InFilterHash)
+		: StartPoly(InStartPoly), EndPoly(InEndPoly), FilterHash(InFilterHash)
+	{}
+
+	bool operator==(const FRecastPathCorridorKey& Other) const
+	{
+		return StartPoly == Other.StartPoly && EndPoly == Other.EndPoly && FilterHash == Other.FilterHash;
+	}
+
+	friend uint32 GetTypeHash(const FRecastPathCorridorKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.StartPoly), GetTypeHash(Key.EndPoly)), Key.FilterHash);
+	}
+};
+
 /** Engine Private! - Private Implementation details of ARecastNavMesh */
 class ENGINE_API FPImplRecastNavMesh
 {
@@ -226,6 +249,31 @@ public:
 	/** query used for searching data on game thread */
 	mutable dtNavMeshQuery SharedNavQuery;
 
+	/** Takes a query for searching data off the game thread from the pool, allocating one if the pool is empty.
+	 *	Pooled queries keep their node pools between searches. */
+	dtNavMeshQuery* AllocPooledNavQuery() const;
+
+	/** Gives back a query taken with AllocPooledNavQuery */
+	void ReleasePooledNavQuery(dtNavMeshQuery* NavQuery) const;
+
+	/** Copies the path corridor cached for given key, returns false if there is none or if it's older than ARecastNavMesh::PathCorridorCacheLifetime */
+	bool FindCachedPathCorridor(const FRecastPathCorridorKey& Key, TArray<NavNodeRef>& OutPolys, TArray<float>& OutCosts) const;
+
+	/** Caches the path corridor found by a complete path finding search, corridors using off-mesh links are not cached */
+	void CachePathCorridor(const FRecastPathCorridorKey& Key, const dtQueryResult& PathResult) const;
+
+	/** Forgets all cached path corridors */
+	void ClearPathCorridorCache();
+
+	/** Forgets cached path corridors going through any of given tiles, called when the tiles get rebuilt */
+	void RemoveCachedPathCorridors(const TArray<uint32>& ChangedTiles);
+
+	/** @return number of path corridors currently cached */
+	int32 GetNumCachedPathCorridors() const;
+
+	/** @return number of queries waiting in the pool, see AllocPooledNavQuery */
+	int32 GetNumPooledNavQueries() const;
+
 	/** Helper function to serialize a single Recast tile. */
 	static void SerializeRecastMeshTile(FArchive& Ar, int32 NavMeshVersion, unsigned char*& TileData, int32& TileDataSize);
 
@@ -250,6 +298,45 @@ public:
 
 	/** workhorse function finding portal edges between corridor polys */
 	void GetEdgesForPathCorridorImpl(const TArray<NavNodeRef>* PathCorridor, TArray<FNavigationPortalEdge>* PathCorridorEdges, const dtNavMeshQuery& NavQuery) const;
+
+private:
+
+	struct FCachedPathCorridor
+	{
+		TArray<NavNodeRef> Polys;
+		TArray<float> Costs;
+		double CacheTime;
+	};
+
+	/** queries used for searching data off the game thread, see AllocPooledNavQuery */
+	mutable TArray<dtNavMeshQuery*> PooledNavQueries;
+	mutable FCriticalSection PooledNavQueriesLock;
+
+	/** path corridors found by recent path finding queries, see ARecastNavMesh::bCachePathCorridors */
+	mutable TMap<FRecastPathCorridorKey, FCachedPathCorridor> PathCorridorCache;
+	mutable FCriticalSection PathCorridorCacheLock;
+};
+
+/** Gives the query to use for searching the navmesh: the shared one on game thread, a pooled one on other threads */
+struct FRecastNavQueryScope
+{
+	FRecastNavQueryScope(const FPImplRecastNavMesh& InNavMeshImpl)
+		: NavMeshImpl(InNavMeshImpl)
+		, PooledNavQuery(IsInGameThread() ? nullptr : InNavMeshImpl.AllocPooledNavQuery())
+		, NavQuery(PooledNavQuery ? *PooledNavQuery : InNavMeshImpl.SharedNavQuery)
+	{}
+
+	~FRecastNavQueryScope()
+	{
+		if (PooledNavQuery)
+		{
+			NavMeshImpl.ReleasePooledNavQuery(PooledNavQuery);
+		}
+	}
+
+	const FPImplRecastNavMesh& NavMeshImpl;
+	dtNavMeshQuery* PooledNavQuery;
+	dtNavMeshQuery& NavQuery;
 };
 
 #endif	// WITH_RECAST
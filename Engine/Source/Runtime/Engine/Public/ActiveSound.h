@@ -67,6 +67,9 @@ public:
 	TWeakObjectPtr<class UWorld> World;
 	TWeakObjectPtr<class UAudioComponent> AudioComponent;
 
+	/** UAudioComponent::PlayID of the playback this sound was started for */
+	uint32 AudioComponentPlayID;
+
 	/** Optional SoundClass to override Sound */
 	USoundClass* SoundClassOverride;
 
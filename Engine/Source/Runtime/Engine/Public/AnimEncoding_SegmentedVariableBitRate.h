@@ -0,0 +1,166 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimEncoding_SegmentedVariableBitRate.h: Segmented variable bit rate decompressor.
+=============================================================================*/
+
+#pragma once
+
+#include "AnimEncoding.h"
+#include "AnimationCompression.h"
+
+/**
+ * Decompression codec for the segmented variable bit rate compressor, see FAnimationCompression_SegmentedUtils for the layout.
+ */
+class AEFSegmentedVariableBitRateCodec : public AnimEncoding
+{
+public:
+	/**
+	 * Handles Byte-swapping incoming animation data from a MemoryReader
+	 *
+	 * @param	Seq					An Animation Sequence to contain the read data.
+	 * @param	MemoryReader		The MemoryReader object to read from.
+	 */
+	virtual void ByteSwapIn(UAnimSequence& Seq, FMemoryReader& MemoryReader) override;
+
+	/**
+	 * Handles Byte-swapping outgoing animation data to an array of BYTEs
+	 *
+	 * @param	Seq					An Animation Sequence to write.
+	 * @param	SerializedData		The output buffer.
+	 * @param	ForceByteSwapping	true is byte swapping is not optional.
+	 */
+	virtual void ByteSwapOut(
+		UAnimSequence& Seq,
+		TArray<uint8>& SerializedData,
+		bool ForceByteSwapping) override;
+
+	/**
+	 * Extracts a single BoneAtom from an Animation Sequence.
+	 *
+	 * @param	OutAtom			The BoneAtom to fill with the extracted result.
+	 * @param	Seq				An Animation Sequence to extract the BoneAtom from.
+	 * @param	TrackIndex		The index of the track desired in the Animation Sequence.
+	 * @param	Time			The time (in seconds) to calculate the BoneAtom for.
+	 */
+	virtual void GetBoneAtom(
+		FTransform& OutAtom,
+		const UAnimSequence& Seq,
+		int32 TrackIndex,
+		float Time) override;
+
+#if USE_ANIMATION_CODEC_BATCH_SOLVER
+
+	/**
+	 * Decompress all requested rotation components from an Animation Sequence
+	 *
+	 * @param	Atoms			The FTransform array to fill in.
+	 * @param	DesiredPairs	Array of requested bone information
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @return					None.
+	 */
+	virtual void GetPoseRotations(
+		FTransformArray& Atoms,
+		const BoneTrackArray& DesiredPairs,
+		const UAnimSequence& Seq,
+		float Time) override;
+
+	/**
+	 * Decompress all requested translation components from an Animation Sequence
+	 *
+	 * @param	Atoms			The FTransform array to fill in.
+	 * @param	DesiredPairs	Array of requested bone information
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @return					None.
+	 */
+	virtual void GetPoseTranslations(
+		FTransformArray& Atoms,
+		const BoneTrackArray& DesiredPairs,
+		const UAnimSequence& Seq,
+		float Time) override;
+
+	/**
+	 * Decompress all requested Scale components from an Animation Sequence
+	 *
+	 * @param	Atoms			The FTransform array to fill in.
+	 * @param	DesiredPairs	Array of requested bone information
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @return					None.
+	 */
+	virtual void GetPoseScales(
+		FTransformArray& Atoms,
+		const BoneTrackArray& DesiredPairs,
+		const UAnimSequence& Seq,
+		float Time) override;
+#endif
+
+	/**
+	 * Extracts statistics about a sequence compressed with this codec, see AnimationFormat_GetStats.
+	 */
+	static void GetStats(
+		const UAnimSequence& Seq,
+		int32& NumTransTracks,
+		int32& NumRotTracks,
+		int32& NumScaleTracks,
+		int32& TotalNumTransKeys,
+		int32& TotalNumRotKeys,
+		int32& TotalNumScaleKeys,
+		float& TranslationKeySize,
+		float& RotationKeySize,
+		float& ScaleKeySize,
+		int32& OverheadSize,
+		int32& NumTransTracksWithOneKey,
+		int32& NumRotTracksWithOneKey,
+		int32& NumScaleTracksWithOneKey);
+
+protected:
+	/** The two frames to interpolate for a given time, located within their segments */
+	struct FFrameSample
+	{
+		const FAnimationCompression_SegmentedUtils::FSegmentChannel* Channels[2];
+		const uint8* FrameRows[2];
+		uint32 RowBitOffset[2];
+		float Alpha;
+		bool bInterpolate;
+	};
+
+	/**
+	 * Locates the frames to decompress for Time
+	 *
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @param	OutSample		Filled with the frame locations.
+	 */
+	static void GetFrameSample(const UAnimSequence& Seq, float Time, FFrameSample& OutSample);
+
+	/**
+	 * Decompresses a translation or scale channel
+	 *
+	 * @param	Stream			The compressed byte stream.
+	 * @param	Offset			Offset of the channel descriptor in Stream, must not be INDEX_NONE.
+	 * @param	Sample			The frames to decompress.
+	 * @return					The decompressed and interpolated vector.
+	 */
+	static FVector DecompressVector(const uint8* RESTRICT Stream, int32 Offset, const FFrameSample& Sample);
+
+	/**
+	 * Decompresses a rotation channel
+	 *
+	 * @param	Stream			The compressed byte stream.
+	 * @param	Offset			Offset of the channel descriptor in Stream, must not be INDEX_NONE.
+	 * @param	Sample			The frames to decompress.
+	 * @return					The decompressed and interpolated rotation.
+	 */
+	static FQuat DecompressRotation(const uint8* RESTRICT Stream, int32 Offset, const FFrameSample& Sample);
+
+	/**
+	 * Handles Byte-swapping the whole stream from a MemoryReader or to a MemoryWriter
+	 *
+	 * @param	Seq					The Animation Sequence being operated on.
+	 * @param	MemoryStream		The MemoryReader or MemoryWriter object to read from/write to.
+	 */
+	static void ByteSwapStream(UAnimSequence& Seq, FMemoryArchive& MemoryStream);
+};
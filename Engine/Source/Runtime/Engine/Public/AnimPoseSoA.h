@@ -0,0 +1,107 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimPoseSoA.h: Structure-of-arrays pose buffers and blending kernels
+=============================================================================*/
+
+#pragma once
+
+typedef TArray<FTransform> FTransformArrayA2;
+
+/**
+ * A local space pose stored as one float stream per transform component (rotation XYZW, translation XYZ, scale XYZ)
+ * rather than as an array of FTransforms, so that the blending kernels below process four bones per vector instruction.
+ *
+ * Bones are stored in required bone order (index into FBoneContainer::GetBoneIndicesArray), not skeleton bone order,
+ * and the bone count is padded to a multiple of four with identity transforms.
+ *
+ * The pose does not own its memory; callers provide GetRequiredFloats() aligned floats, typically from FMemStack.
+ */
+struct ENGINE_API FAnimPoseSoA
+{
+	enum EStream
+	{
+		RotationX,
+		RotationY,
+		RotationZ,
+		RotationW,
+		TranslationX,
+		TranslationY,
+		TranslationZ,
+		ScaleX,
+		ScaleY,
+		ScaleZ,
+		NumStreams
+	};
+
+	FAnimPoseSoA()
+		: Data(nullptr)
+		, NumBones(0)
+		, NumPaddedBones(0)
+	{
+	}
+
+	/** Number of bones rounded up to a whole number of vector registers */
+	static int32 GetNumPaddedBones(int32 InNumBones)
+	{
+		return Align(InNumBones, 4);
+	}
+
+	/** Number of floats of storage needed for a pose of InNumBones */
+	static int32 GetRequiredFloats(int32 InNumBones)
+	{
+		return GetNumPaddedBones(InNumBones) * NumStreams;
+	}
+
+	/** Points this pose at InData, which must be 16 byte aligned and hold GetRequiredFloats(InNumBones) floats. Padding bones are set to identity. */
+	void Init(float* InData, int32 InNumBones);
+
+	FORCEINLINE float* GetStream(EStream Stream)
+	{
+		return Data + Stream * NumPaddedBones;
+	}
+
+	FORCEINLINE const float* GetStream(EStream Stream) const
+	{
+		return Data + Stream * NumPaddedBones;
+	}
+
+	FORCEINLINE int32 GetNumBones() const
+	{
+		return NumBones;
+	}
+
+	FORCEINLINE int32 GetNumPaddedBones() const
+	{
+		return NumPaddedBones;
+	}
+
+	/** Copies the required bones of Atoms into this pose. */
+	void Gather(const FTransformArrayA2& Atoms, const TArray<FBoneIndexType>& RequiredBoneIndices);
+
+	/** Writes this pose back to the required bones of Atoms. Other bones are left untouched. */
+	void Scatter(FTransformArrayA2& Atoms, const TArray<FBoneIndexType>& RequiredBoneIndices) const;
+
+	/** Normalizes every rotation, replacing degenerate ones by identity, as FTransform::NormalizeRotation does. */
+	void NormalizeRotations();
+
+	/** SoA version of FAnimationRuntime::BlendPosesTogether: weighted sum of the poses with shortest path rotation accumulation. */
+	static void BlendPosesTogether(int32 NumPoses, const FAnimPoseSoA** SourcePoses, const float* SourceWeights, FAnimPoseSoA& ResultPose);
+
+	/**
+	 * SoA version of FAnimationRuntime::BlendPosesTogetherPerBone.
+	 * @param	PerBoneWeights	For each pose, an aligned array of GetNumPaddedBones() weights in required bone order.
+	 */
+	static void BlendPosesTogetherPerBone(int32 NumPoses, const FAnimPoseSoA** SourcePoses, const float** PerBoneWeights, FAnimPoseSoA& ResultPose);
+
+	/** SoA version of FAnimationRuntime::BlendAdditivePose. ResultPose may alias SourcePose. */
+	static void BlendAdditivePose(const FAnimPoseSoA& SourcePose, const FAnimPoseSoA& AdditivePose, float BlendWeight, FAnimPoseSoA& ResultPose);
+
+	/** SoA version of FAnimationRuntime::ConvertPoseToAdditive. */
+	static void ConvertPoseToAdditive(FAnimPoseSoA& TargetPose, const FAnimPoseSoA& BasePose);
+
+private:
+	float* Data;
+	int32 NumBones;
+	int32 NumPaddedBones;
+};
@@ -1058,4 +1058,127 @@ inline float FAnimationCompression_PerTrackUtils::DecompressFixed16<0>(uint16 Va
 	return ((int32)Value - 32767) * 3.0518509475997192297128208258309e-5f;
 }
 
+/**
+ * Layout shared by the segmented variable bit rate compressor and codec (AKF_SegmentedVariableBitRate).
+ *
+ * The frames of the sequence are split into segments of FramesPerSegment frames. Every translation, rotation
+ * and scale channel is either absent (identity), constant, or animated. Animated channels are range reduced twice:
+ * once over the whole sequence (float min/extent in the channel descriptor) and once per segment (16 bit min/extent
+ * within the sequence range), then each segment quantizes a channel to its own number of bits per component.
+ * Inside a segment the bits of all animated channels for one frame are stored contiguously, so sampling a pose
+ * reads two rows of bits instead of one key per track scattered through the stream.
+ *
+ * CompressedByteStream:
+ *		FStreamHeader, int32 SegmentOffsets[NumSegments]
+ *		FChannelDescriptor for each non identity channel, referenced by CompressedTrackOffsets / CompressedScaleOffsets
+ *		For each segment: FSegmentHeader, FSegmentChannel[NumAnimatedChannels], frame rows
+ *		StreamTailPadding bytes
+ *
+ * Rotations are stored as the XYZ of the quaternion with a positive W.
+ */
+class FAnimationCompression_SegmentedUtils
+{
+public:
+	/** Highest number of bits a component can be quantized to */
+	static const int32 MaxBitsPerComponent = 24;
+
+	/** Zero bytes at the end of the stream, so reading 64 bits at the last bit offset stays in bounds */
+	static const int32 StreamTailPadding = 8;
+
+	/** Resolution of the per segment range, relative to the sequence range */
+	static const int32 SegmentRangeMax = 0xFFFF;
+
+	struct FStreamHeader
+	{
+		int32 NumSegments;
+		int32 FramesPerSegment;
+		int32 NumAnimatedChannels;
+	};
+
+	struct FChannelDescriptor
+	{
+		/** Index of the channel within a segment, or INDEX_NONE for a constant channel */
+		int32 AnimatedChannelIndex;
+		/** Constant channels: value in [0..2], or XYZW in [0..3] for rotations. Animated channels: sequence minimum in [0..2] and extent in [3..5] */
+		float Values[6];
+	};
+
+	struct FSegmentHeader
+	{
+		/** Size of one frame row in bits */
+		uint32 FrameBits;
+	};
+
+	struct FSegmentChannel
+	{
+		uint16 RangeMin[3];
+		uint16 RangeExtent[3];
+		/** Bits per component in the low 8 bits, bit offset of the channel within a frame row above them */
+		uint32 BitOffsetAndRate;
+	};
+
+	static int32 GetNumSegments(int32 NumFrames, int32 FramesPerSegment)
+	{
+		return (NumFrames + FramesPerSegment - 1) / FramesPerSegment;
+	}
+
+	static int32 GetNumFramesInSegment(int32 NumFrames, int32 FramesPerSegment, int32 SegmentIndex)
+	{
+		return FMath::Min(FramesPerSegment, NumFrames - SegmentIndex * FramesPerSegment);
+	}
+
+	static FORCEINLINE const int32* GetSegmentOffsets(const uint8* Stream)
+	{
+		return (const int32*)(Stream + sizeof(FStreamHeader));
+	}
+
+	static FORCEINLINE const FSegmentChannel* GetSegmentChannels(const uint8* Segment)
+	{
+		return (const FSegmentChannel*)(Segment + sizeof(FSegmentHeader));
+	}
+
+	static FORCEINLINE const uint8* GetSegmentFrameRows(const uint8* Segment, int32 NumAnimatedChannels)
+	{
+		return Segment + sizeof(FSegmentHeader) + NumAnimatedChannels * sizeof(FSegmentChannel);
+	}
+
+	/** Reads NumBits (at most MaxBitsPerComponent) starting at BitOffset, least significant bit first */
+	static FORCEINLINE uint32 ReadBits(const uint8* RESTRICT Data, uint32 BitOffset, int32 NumBits)
+	{
+		uint64 Word;
+		FMemory::Memcpy(&Word, Data + (BitOffset >> 3), sizeof(uint64));
+#if !PLATFORM_LITTLE_ENDIAN
+		Word = BYTESWAP_ORDER64(Word);
+#endif
+		return (uint32)(Word >> (BitOffset & 7)) & ((1u << NumBits) - 1);
+	}
+
+	/** Writes the low NumBits of Value starting at BitOffset, Data must be zeroed and large enough */
+	static void WriteBits(uint8* Data, uint32 BitOffset, uint32 Value, int32 NumBits)
+	{
+		for (int32 BitIndex = 0; BitIndex < NumBits; ++BitIndex, ++BitOffset)
+		{
+			if (Value & (1u << BitIndex))
+			{
+				Data[BitOffset >> 3] |= (uint8)(1 << (BitOffset & 7));
+			}
+		}
+	}
+
+	/** Converts a quantized component back to its value */
+	static FORCEINLINE float DecodeComponent(uint32 Quantized, int32 NumBits, uint16 SegmentRangeMin, uint16 SegmentRangeExtent, float SequenceMin, float SequenceExtent)
+	{
+		const float Normalized = NumBits > 0 ? (float)Quantized / (float)((1u << NumBits) - 1) : 0.0f;
+		const float SegmentNormalized = ((float)SegmentRangeMin + (float)SegmentRangeExtent * Normalized) * (1.0f / (float)SegmentRangeMax);
+		return SequenceMin + SequenceExtent * SegmentNormalized;
+	}
+
+	/** Rebuilds a quaternion from its XYZ with a positive W. Quantization error means the result still needs normalizing. */
+	static FORCEINLINE FQuat QuatFromXYZ(const FVector& XYZ)
+	{
+		const float WSquared = 1.0f - XYZ.SizeSquared();
+		return FQuat(XYZ.X, XYZ.Y, XYZ.Z, WSquared > 0.0f ? FMath::Sqrt(WSquared) : 0.0f);
+	}
+};
+
 #endif // __ANIMATIONCOMPRESSION_H__
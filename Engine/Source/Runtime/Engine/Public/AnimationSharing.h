@@ -0,0 +1,105 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimationSharing.h: Sharing evaluated poses between skeletal mesh components
+=============================================================================*/
+
+#pragma once
+
+class USkeletalMesh;
+class UAnimationAsset;
+struct FActiveVertexAnim;
+
+/**
+ * Identifies the animation state of a skeletal mesh component for pose sharing:
+ * components with equal keys produce the same pose, so only one of them needs to evaluate it.
+ */
+struct FAnimationSharingKey
+{
+	TWeakObjectPtr<USkeletalMesh> SkeletalMesh;
+	TWeakObjectPtr<UAnimationAsset> AnimationAsset;
+	/** Playback time divided by TimeStep, rounded down */
+	int32 TimeIndex;
+	float TimeStep;
+	/** Required bones differ per LOD */
+	int32 LODLevel;
+
+	FAnimationSharingKey()
+		: TimeIndex(0)
+		, TimeStep(0.f)
+		, LODLevel(0)
+	{
+	}
+
+	bool operator==(const FAnimationSharingKey& Other) const
+	{
+		return TimeIndex == Other.TimeIndex
+			&& TimeStep == Other.TimeStep
+			&& LODLevel == Other.LODLevel
+			&& SkeletalMesh == Other.SkeletalMesh
+			&& AnimationAsset == Other.AnimationAsset;
+	}
+
+	friend uint32 GetTypeHash(const FAnimationSharingKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.SkeletalMesh), GetTypeHash(Key.AnimationAsset)), HashCombine(Key.TimeIndex, Key.LODLevel));
+	}
+};
+
+/** The evaluation results of one component, reused by every other component with the same key */
+struct FAnimationSharedPose
+{
+	TArray<FTransform> LocalAtoms;
+	TArray<FTransform> SpaceBases;
+	TArray<FActiveVertexAnim> VertexAnims;
+	FVector RootBoneTranslation;
+	/** Last frame this pose was published or reused */
+	uint64 LastUsedFrame;
+	/** Whether the arrays above hold a published pose */
+	bool bEvaluated;
+	/** Completion of the parallel evaluation of the component that will publish this pose, other components wait for it instead of evaluating */
+	FGraphEventRef PendingEvaluation;
+
+	FAnimationSharedPose()
+		: RootBoneTranslation(FVector::ZeroVector)
+		, LastUsedFrame(0)
+		, bEvaluated(false)
+	{
+	}
+};
+
+/**
+ * Game thread registry of recently evaluated poses, see USkeletalMeshComponent::bEnableAnimationSharing.
+ * The first component to need a pose in a frame becomes its leader: it evaluates and publishes the pose, and with parallel
+ * evaluation registers its completion event so that followers dispatched before it publishes wait for the pose instead of evaluating it.
+ * Poses that have not been used for a couple of frames are discarded.
+ */
+class ENGINE_API FAnimationSharingManager
+{
+public:
+	static FAnimationSharingManager& Get();
+
+	/** Returns the pose published under Key, or nullptr if no component in that state evaluated recently */
+	const FAnimationSharedPose* FindPose(const FAnimationSharingKey& Key);
+
+	/** Returns the completion event of the leader still evaluating the pose for Key, or an invalid event if there is none */
+	FGraphEventRef FindPendingEvaluation(const FAnimationSharingKey& Key);
+
+	/** Makes the caller the leader for Key until it publishes the pose, CompletionEvent fires once it did (or failed to) */
+	void BeginEvaluation(const FAnimationSharingKey& Key, const FGraphEventRef& CompletionEvent);
+
+	/** Makes a freshly evaluated pose available to other components with the same key */
+	void PublishPose(const FAnimationSharingKey& Key, const TArray<FTransform>& LocalAtoms, const TArray<FTransform>& SpaceBases, const TArray<FActiveVertexAnim>& VertexAnims, const FVector& RootBoneTranslation);
+
+	/** Forgets every shared pose */
+	void Empty();
+
+private:
+	FAnimationSharingManager();
+
+	/** Discards poses that nobody used in the last couple of frames, at most once per frame */
+	void PurgeStalePoses();
+
+	TMap<FAnimationSharingKey, FAnimationSharedPose> SharedPoses;
+	uint64 LastPurgeFrame;
+};
@@ -118,7 +118,7 @@ public:
 												const TArray<FTransform>& LocalAtoms,
 												const TArray<FBoneData>& BoneData);
 
-	static void BuildSkeletonMetaData(USkeleton* Skeleton, TArray<FBoneData>& OutBoneData);
+	ENGINE_API static void BuildSkeletonMetaData(USkeleton* Skeleton, TArray<FBoneData>& OutBoneData);
 
 
 	/**
@@ -130,7 +130,7 @@ public:
 	 * @param	ErrorStats	Output structure containing the final compression error values
 	 * @return				None.
 	 */
-	static void ComputeCompressionError(const UAnimSequence* AnimSeq, const TArray<FBoneData>& BoneData, AnimationErrorStats& ErrorStats);
+	ENGINE_API static void ComputeCompressionError(const UAnimSequence* AnimSeq, const TArray<FBoneData>& BoneData, AnimationErrorStats& ErrorStats);
 
 	/**
 	 * Utility function to compress an animation. If the animation is currently associated with a codec, it will be used to 
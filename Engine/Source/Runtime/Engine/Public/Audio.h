@@ -77,6 +77,8 @@ DECLARE_CYCLE_STAT_EXTERN( TEXT( "Prepare Audio Decompression" ), STAT_AudioPrep
 DECLARE_CYCLE_STAT_EXTERN( TEXT( "Prepare Vorbis Decompression" ), STAT_VorbisPrepareDecompressionTime, STATGROUP_Audio , );
 DECLARE_CYCLE_STAT_EXTERN( TEXT( "Finding Nearest Location" ), STAT_AudioFindNearestLocation, STATGROUP_Audio , );
 DECLARE_CYCLE_STAT_EXTERN( TEXT( "Decompress Opus" ), STAT_OpusDecompressTime, STATGROUP_Audio , );
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Audio Thread Queued Commands" ), STAT_AudioThreadQueuedCommands, STATGROUP_Audio , );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN( TEXT( "Audio Thread Frame Time (ms)" ), STAT_AudioThreadFrameTime, STATGROUP_Audio , );
 
 /**
  * Channel definitions for multistream waves
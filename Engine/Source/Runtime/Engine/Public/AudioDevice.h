@@ -227,7 +227,8 @@ public:
 	void Teardown();
 
 	/**
-	 * The audio system's main "Tick" function
+	 * The audio system's main "Tick" function. When the audio thread runs, the game thread only queues the update for it
+	 * and runs the notifications the audio thread sent back.
 	 */
 	void Update(bool bGameTicking);
 
@@ -424,7 +425,7 @@ public:
 	/**
 	 * Sets a new sound mix and applies it to all appropriate sound classes
 	 */
-	bool SetBaseSoundMix( class USoundMix* SoundMix );
+	void SetBaseSoundMix( class USoundMix* SoundMix );
 
 	/**
 	 * Push a SoundMix onto the Audio Device's list.
@@ -726,6 +727,9 @@ public:
 
 	TArray<struct FListener> Listeners;
 
+	/** Transforms of the listeners as last set by the game thread, so it can read them while the audio thread updates Listeners */
+	TArray<FTransform> ListenerTransforms;
+
 	uint64 CurrentTick;
 
 	/** An AudioComponent to play test sounds on */
@@ -783,6 +787,9 @@ private:
 
 	/** List of passive SoundMixes active last frame */
 	TArray<class USoundMix*> PrevPassiveSoundMixModifiers;
+
+	/** Number of updates queued for the audio thread that didn't run yet */
+	FThreadSafeCounter NumPendingUpdates;
 };
 
 
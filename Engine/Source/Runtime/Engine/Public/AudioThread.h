@@ -0,0 +1,139 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AudioThread.h: Optional thread that updates the audio device.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * The audio thread owns the state of the audio device while it runs: active sounds, wave instances, sound mixes and
+ * sources are only touched by it. The game thread sends it commands (play, stop, parameter changes, listener updates...)
+ * through a lock free queue, and the audio thread sends back the notifications that have to run on the game thread,
+ * like the audio components finishing.
+ *
+ * The audio thread is opt-in (AudioThread.EnableAudioThread). When it is not running every command runs right away on
+ * the calling thread, which is the game thread, so the audio device behaves exactly as before.
+ */
+class ENGINE_API FAudioThread : public FRunnable
+{
+public:
+
+	FAudioThread();
+	virtual ~FAudioThread();
+
+	// FRunnable interface
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// End of FRunnable interface
+
+	/** Starts the audio thread if it is enabled. */
+	static void StartAudioThread();
+
+	/** Runs the commands still queued and stops the audio thread. */
+	static void StopAudioThread();
+
+	/** @return true if the audio thread is running */
+	static bool IsAudioThreadRunning()
+	{
+		return bIsAudioThreadRunning;
+	}
+
+	/**
+	 * Runs a command on the audio thread, commands run in the order they were queued.
+	 * When the audio thread is not running, or when called from the audio thread, the command runs right away.
+	 */
+	static void RunCommandOnAudioThread(TFunction<void()> InFunction);
+
+	/**
+	 * Runs a command on the game thread the next time it processes the commands sent by the audio thread.
+	 * When called from the game thread the command runs right away.
+	 */
+	static void RunCommandOnGameThread(TFunction<void()> InFunction);
+
+	/** Runs the commands the audio thread sent to the game thread. Called by the game thread once per frame. */
+	static void ProcessGameThreadCommands();
+
+	/**
+	 * Waits for the audio thread to run every command queued so far, then keeps it from running any further command until
+	 * ResumeAudioThread() is called. This lets the game thread access the audio device directly. Calls can be nested.
+	 */
+	static void SuspendAudioThread();
+
+	/** Lets the audio thread run commands again after SuspendAudioThread(). */
+	static void ResumeAudioThread();
+
+	/** @return the number of commands waiting to run on the audio thread */
+	static int32 GetNumQueuedCommands()
+	{
+		return NumQueuedCommands.GetValue();
+	}
+
+private:
+
+	/** Runs the queued commands until the thread is stopped */
+	void ProcessCommands();
+
+	/** Suspends the audio thread during garbage collection, the audio device references the objects being collected */
+	static void OnPreGarbageCollect();
+	static void OnPostGarbageCollect();
+
+	/** Set while the thread should keep running */
+	FThreadSafeCounter bKeepRunning;
+
+	/** Triggered when commands are queued or the thread should stop */
+	FEvent* CommandsQueuedEvent;
+
+	/** Commands queued for the audio thread and for the game thread */
+	static TQueue<TFunction<void()>, EQueueMode::Mpsc> AudioThreadCommands;
+	static TQueue<TFunction<void()>, EQueueMode::Mpsc> GameThreadCommands;
+
+	/** Number of commands waiting to run on the audio thread */
+	static FThreadSafeCounter NumQueuedCommands;
+
+	/** Triggered by the audio thread once it has suspended itself, and by the game thread to resume it */
+	static FEvent* SuspendedEvent;
+	static FEvent* ResumeEvent;
+
+	/** Number of nested SuspendAudioThread() calls, only used by the game thread */
+	static int32 SuspendCount;
+
+	static FAudioThread* AudioThreadRunnable;
+	static FRunnableThread* AudioThread;
+	static bool bIsAudioThreadRunning;
+
+	/** Handles of the garbage collection delegates */
+	static FDelegateHandle PreGarbageCollectHandle;
+	static FDelegateHandle PostGarbageCollectHandle;
+};
+
+/** @return true if called from the audio thread, or always when the audio thread isn't running */
+extern ENGINE_API bool IsInAudioThread();
+
+/** Suspends the audio thread for the lifetime of the object, see FAudioThread::SuspendAudioThread(). Only the game thread suspends it. */
+class FAudioThreadSuspendContext
+{
+public:
+
+	FAudioThreadSuspendContext()
+		: bSuspended(FAudioThread::IsAudioThreadRunning() && IsInGameThread())
+	{
+		if (bSuspended)
+		{
+			FAudioThread::SuspendAudioThread();
+		}
+	}
+
+	~FAudioThreadSuspendContext()
+	{
+		if (bSuspended)
+		{
+			FAudioThread::ResumeAudioThread();
+		}
+	}
+
+private:
+
+	bool bSuspended;
+};
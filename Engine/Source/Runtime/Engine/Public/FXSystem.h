@@ -60,6 +60,12 @@ namespace FXConsoleVariables
 	extern int32 MaxParticleTilePreAllocation;
 	/** Maximum number of CPU particles to allow per-emitter. */
 	extern int32 MaxCPUParticlesPerEmitter;
+	/** true if CPU emitters can update their particles on structure-of-arrays streams. */
+	extern int32 bAllowSoAUpdate;
+	/** Minimum number of particles for a CPU emitter to use the structure-of-arrays update. */
+	extern int32 MinParticlesForSoAUpdate;
+	/** Minimum number of particles for the structure-of-arrays update to be split across worker threads. */
+	extern int32 MinParticlesForParallelSoAUpdate;
 	/** Maximum number of GPU particles to spawn per-frame. */
 	extern int32 MaxGPUParticlesSpawnedPerFrame;
 	/** Warning threshold for spawning of GPU particles. */
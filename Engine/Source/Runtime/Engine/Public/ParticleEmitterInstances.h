@@ -358,6 +358,21 @@ public:
 	 *	@param	CurrentLODLevel		The current LOD level for the instance
 	 */
 	virtual void Tick_ModuleUpdate(float DeltaTime, UParticleLODLevel* CurrentLODLevel);
+	/**
+	 *	Returns true if the particles can be reset and updated on structure-of-arrays streams this tick,
+	 *	which requires all the enabled update modules to support it.
+	 *
+	 *	@param	CurrentLODLevel		The current LOD level for the instance
+	 */
+	virtual bool CanUpdateSoA(UParticleLODLevel* CurrentLODLevel);
+	/**
+	 *	Tick sub-function that resets the particle parameters and handles module updates on structure-of-arrays
+	 *	streams, instead of ResetParticleParameters and Tick_ModuleUpdate. Large emitters are split across worker threads.
+	 *
+	 *	@param	DeltaTime			The current time slice
+	 *	@param	CurrentLODLevel		The current LOD level for the instance
+	 */
+	virtual void Tick_ModuleUpdateSoA(float DeltaTime, UParticleLODLevel* CurrentLODLevel);
 	/**
 	 *	Tick sub-function that handles module post updates
 	 *
@@ -205,6 +205,68 @@ enum EParticleStates
 	STATE_CounterMask = (~STATE_Mask)
 };
 
+/*-----------------------------------------------------------------------------
+	Structure-of-arrays particle update
+-----------------------------------------------------------------------------*/
+
+/** Number of particles in a FParticleSoAChunk, must be a multiple of 4. */
+#define PARTICLE_SOA_CHUNK_SIZE 128
+
+/**
+ *	A slice of the particles of an emitter copied into one stream per component, so update modules can process
+ *	4 particles at a time with vector registers. The particles stay in the payload block of the emitter, which
+ *	spawning, rendering and the other modules use: the streams are gathered before the update modules run and
+ *	scattered back after. Frozen particles are not part of the streams. The streams are padded with zeros
+ *	to NumPadded, the padding is never scattered back.
+ */
+struct FParticleSoAChunk
+{
+	enum EStream
+	{
+		Stream_VelocityX,
+		Stream_VelocityY,
+		Stream_VelocityZ,
+		Stream_BaseVelocityX,
+		Stream_BaseVelocityY,
+		Stream_BaseVelocityZ,
+		Stream_SizeX,
+		Stream_SizeY,
+		Stream_SizeZ,
+		Stream_ColorR,
+		Stream_ColorG,
+		Stream_ColorB,
+		Stream_ColorA,
+		Stream_RelativeTime,
+		Stream_OneOverMaxLifetime,
+		/** Streams modules can evaluate their per particle values into. Modules only write the first NumParticles, the padding stays zero. */
+		Stream_Scratch0,
+		Stream_Scratch1,
+		Stream_Scratch2,
+
+		Stream_Num
+	};
+
+	/** The streams, aligned for vector loads and stores. */
+	MS_ALIGN(16) float Streams[Stream_Num][PARTICLE_SOA_CHUNK_SIZE] GCC_ALIGN(16);
+	/** The particles the streams were gathered from, used to read module payloads. */
+	FBaseParticle* Particles[PARTICLE_SOA_CHUNK_SIZE];
+	/** Number of particles in the streams. */
+	int32 NumParticles;
+	/** NumParticles rounded up to a multiple of 4. */
+	int32 NumPadded;
+
+	FORCEINLINE float* GetStream(EStream Stream)
+	{
+		return Streams[Stream];
+	}
+
+	/** Returns the stream of a component of a vector, eg GetStream(Stream_VelocityX, 2) returns the Z velocity stream. */
+	FORCEINLINE float* GetStream(EStream FirstStream, int32 Axis)
+	{
+		return Streams[FirstStream + Axis];
+	}
+};
+
 /*-----------------------------------------------------------------------------
 	FParticlesStatGroup
 -----------------------------------------------------------------------------*/
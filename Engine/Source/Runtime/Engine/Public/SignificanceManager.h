@@ -0,0 +1,103 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SignificanceManager.h: Tick rates by significance to the players
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Returns the distance used to pick the significance bucket of an actor, given the locations of the player views.
+ * Used instead of the distance to the nearest view for actors that need a custom significance.
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(float, FSignificanceDistanceDelegate, const AActor*, const TArray<FVector>&);
+
+/**
+ * Scores the registered actors by their distance to the player views and throttles their tick functions, and those of their components,
+ * with the tick intervals of the AWorldSettings::SignificanceBuckets they fall in. Tick functions are rescheduled through
+ * FTickFunction::TickInterval, so they don't need to be registered again when their bucket changes.
+ * The tick interval a tick function had when it was first seen is kept as a minimum and restored when its actor is unregistered.
+ */
+class ENGINE_API FSignificanceManager : public FNoncopyable
+{
+public:
+
+	FSignificanceManager(UWorld* InWorld)
+		: World(InWorld)
+		, NextUpdateIndex(0)
+	{}
+
+	/**
+	 * Registers an actor, its tick rates and the ones of its components will follow its significance.
+	 *
+	 * @param Actor					Actor to register.
+	 * @param DistanceDelegate		Optional custom significance distance for the actor.
+	 */
+	void RegisterActor(AActor* Actor, const FSignificanceDistanceDelegate& DistanceDelegate = FSignificanceDistanceDelegate());
+
+	/** Unregisters an actor and restores the tick intervals of its tick functions. */
+	void UnregisterActor(AActor* Actor);
+
+	/** Returns true if the actor is registered. */
+	bool IsActorRegistered(const AActor* Actor) const
+	{
+		return ManagedActorIndices.Contains(Actor);
+	}
+
+	/** Returns the index of the significance bucket the actor is in, or INDEX_NONE if it is not registered or is ticking at its own rate. */
+	int32 GetActorBucket(const AActor* Actor) const;
+
+	/** Updates the significance of a slice of the registered actors. Called by the world before queueing the ticks. */
+	void Update();
+
+private:
+
+	/** Tick function of a component of a registered actor. */
+	struct FManagedComponent
+	{
+		TWeakObjectPtr<UActorComponent> Component;
+		/** Tick interval the component had before it was managed. */
+		float BaseTickInterval;
+	};
+
+	/** A registered actor. */
+	struct FManagedActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		/** Key of the actor in ManagedActorIndices, which stays valid after the actor is gone. */
+		const AActor* ActorKey;
+		FSignificanceDistanceDelegate DistanceDelegate;
+		/** Tick interval the actor had before it was registered. */
+		float BaseTickInterval;
+		/** Last significance bucket applied to the tick functions, INDEX_NONE if the actor ticks at its own rate. */
+		int32 BucketIndex;
+		TArray<FManagedComponent> Components;
+	};
+
+	/** Collects the locations of the local player views and of the players' view points, which covers the players of a server. */
+	void GatherViewLocations();
+
+	/** Returns the distance used to pick the bucket of an actor. */
+	float GetSignificanceDistance(const FManagedActor& ManagedActor, bool bHasRenderedViews) const;
+
+	/** Sets the tick intervals of an actor and its components from a bucket, or back to their own with INDEX_NONE. */
+	void ApplyBucket(FManagedActor& ManagedActor, int32 BucketIndex);
+
+	/** Removes a registered actor, without touching its tick functions. */
+	void RemoveManagedActor(int32 Index);
+
+	/** World whose actors are managed. */
+	UWorld* World;
+
+	/** All registered actors. */
+	TArray<FManagedActor> ManagedActors;
+
+	/** Index of each registered actor in ManagedActors. */
+	TMap<const AActor*, int32> ManagedActorIndices;
+
+	/** Actors are updated round robin, this is the next one to update. */
+	int32 NextUpdateIndex;
+
+	/** Locations of the player views this frame. */
+	TArray<FVector> ViewLocations;
+};
@@ -70,22 +70,26 @@ struct FTimerUnifiedDelegate
 };
 
 // Unique handle that can be used to distinguish timers that have identical delegates.
+// The handle stores the index of the timer in the timer manager along with a serial number, so a timer
+// can be found without searching for it and handles to cleared timers never match a timer that reuses their slot.
 struct FTimerHandle
 {
+	friend class FTimerManager;
+
 	FTimerHandle()
-	: Handle(INDEX_NONE)
+	: Handle(0)
 	{
 
 	}
 
 	bool IsValid() const
 	{
-		return Handle != INDEX_NONE;
+		return Handle != 0;
 	}
 
 	void Invalidate()
 	{
-		Handle = INDEX_NONE;
+		Handle = 0;
 	}
 
 	void MakeValid();
@@ -102,11 +106,36 @@ struct FTimerHandle
 
 	FString ToString() const
 	{
-		return FString::Printf(TEXT("%d"), Handle);
+		return FString::Printf(TEXT("%llu"), Handle);
 	}
 
 private:
-	int32 Handle;
+	static const uint32 IndexBits = 24;
+	static const uint32 SerialNumberBits = 40;
+
+	static_assert(IndexBits + SerialNumberBits == 64, "The timer handle index and serial number should fill the handle");
+
+	static const int32 MaxIndex = (int32)1 << IndexBits;
+	static const uint64 MaxSerialNumber = (uint64)1 << SerialNumberBits;
+
+	void SetIndexAndSerialNumber(int32 Index, uint64 SerialNumber)
+	{
+		check(Index >= 0 && Index < MaxIndex);
+		check(SerialNumber > 0 && SerialNumber < MaxSerialNumber);
+		Handle = (SerialNumber << IndexBits) | (uint64)(uint32)Index;
+	}
+
+	FORCEINLINE int32 GetIndex() const
+	{
+		return (int32)(Handle & (uint64)(MaxIndex - 1));
+	}
+
+	FORCEINLINE uint64 GetSerialNumber() const
+	{
+		return Handle >> IndexBits;
+	}
+
+	uint64 Handle;
 };
 
 namespace ETimerStatus
@@ -115,7 +144,8 @@ namespace ETimerStatus
 	{
 		Pending,
 		Active,
-		Paused
+		Paused,
+		Executing
 	};
 }
 
@@ -124,12 +154,18 @@ struct FTimerData
 	/** If true, this timer will loop indefinitely.  Otherwise, it will be destroyed when it expires. */
 	bool bLoop;
 
+	/** If true, this timer was set without a handle (deprecated API or SetTimerForNextTick) and is looked up by its delegate. */
+	bool bSetWithoutHandle;
+
 	/** Timer Status */
 	ETimerStatus::Type Status;
 	
 	/** Time between set and fire, or repeat frequency if looping. */
 	float Rate;
 
+	/** Position of this timer in the FTimerManager's active heap, or INDEX_NONE if the timer is not active. */
+	int32 HeapIndex;
+
 	/** 
 	 * Time (on the FTimerManager's clock) that this timer should expire and fire its delegate. 
 	 * Note when a timer is paused, we re-base ExpireTime to be relative to 0 instead of the running clock, 
@@ -140,18 +176,27 @@ struct FTimerData
 	/** Holds the delegate to call. */
 	FTimerUnifiedDelegate TimerDelegate;
 
+	/** Handle of this timer, its index is the timer's index in the FTimerManager. */
 	FTimerHandle TimerHandle;
 
 	FTimerData()
-		: bLoop(false), Status(ETimerStatus::Active)
-		, Rate(0), ExpireTime(0)
+		: bLoop(false), bSetWithoutHandle(false), Status(ETimerStatus::Active)
+		, Rate(0), HeapIndex(INDEX_NONE), ExpireTime(0)
 	{}
+};
 
-	/** Operator less, used to sort the heap based on time until execution. **/
-	bool operator<(const FTimerData& Other) const
-	{
-		return ExpireTime < Other.ExpireTime;
-	}
+/** Entry of the FTimerManager's active heap, holds just what is needed to order the timers. */
+struct FTimerHeapEntry
+{
+	/** Copy of the timer's ExpireTime. */
+	double ExpireTime;
+
+	/** Index of the timer in the FTimerManager. */
+	int32 TimerIndex;
+
+	FTimerHeapEntry(double InExpireTime, int32 InTimerIndex)
+		: ExpireTime(InExpireTime), TimerIndex(InTimerIndex)
+	{}
 };
 
 
@@ -387,36 +432,41 @@ public:
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(UserClass* inObj, typename FTimerDelegate::TUObjectMethodDelegate< UserClass >::FMethodPtr inTimerMethod)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ) );
-		InternalUnPauseTimer(TimerIdx);
+		int32 TimerIdx;
+		FTimerData const* TimerToUnPause = DEPRECATED_FindTimer(FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ), &TimerIdx);
+		InternalUnPauseTimer(TimerToUnPause, TimerIdx);
 	}
 	template< class UserClass >
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(UserClass* inObj, typename FTimerDelegate::TUObjectMethodDelegate_Const< UserClass >::FMethodPtr inTimerMethod)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ) );
-		InternalUnPauseTimer(TimerIdx);
+		int32 TimerIdx;
+		FTimerData const* TimerToUnPause = DEPRECATED_FindTimer(FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ), &TimerIdx);
+		InternalUnPauseTimer(TimerToUnPause, TimerIdx);
 	}
 
 	/** Version that takes any generic delegate. */
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(FTimerDelegate const& InDelegate)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate(InDelegate) );
-		InternalUnPauseTimer(TimerIdx);
+		int32 TimerIdx;
+		FTimerData const* TimerToUnPause = DEPRECATED_FindTimer(FTimerUnifiedDelegate(InDelegate), &TimerIdx);
+		InternalUnPauseTimer(TimerToUnPause, TimerIdx);
 	}
 	/** Version that takes a dynamic delegate (e.g. for UFunctions). */
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(FTimerDynamicDelegate const& InDynDelegate)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate(InDynDelegate) );
-		InternalUnPauseTimer(TimerIdx);
+		int32 TimerIdx;
+		FTimerData const* TimerToUnPause = DEPRECATED_FindTimer(FTimerUnifiedDelegate(InDynDelegate), &TimerIdx);
+		InternalUnPauseTimer(TimerToUnPause, TimerIdx);
 	}
 	/** Version that takes a handle */
 	FORCEINLINE void UnPauseTimer(FTimerHandle InHandle)
 	{
-		int32 TimerIdx = FindTimerInList(PausedTimerList, InHandle);
-		InternalUnPauseTimer(TimerIdx);
+		int32 TimerIdx;
+		FTimerData const* TimerToUnPause = FindTimer(InHandle, &TimerIdx);
+		InternalUnPauseTimer(TimerToUnPause, TimerIdx);
 	}
 
 	/**
@@ -754,36 +804,45 @@ private:
 	void InternalSetTimerForNextTick( FTimerUnifiedDelegate const& InDelegate );
 	void DEPRECATED_InternalClearTimer( FTimerUnifiedDelegate const& InDelegate );
 	void InternalClearTimer( FTimerHandle const& InDelegate );
-	void InternalClearTimer( int32 TimerIdx, ETimerStatus::Type TimerStatus );
+	void InternalClearTimer( int32 TimerIdx );
 	void InternalClearAllTimers( void const* Object );
 
-	/** Will find a timer in the active, paused, or pending list. */
+	/** Will find a timer that is active, paused or pending. OutTimerIndex receives the index of the timer in Timers. */
 	FTimerData const* DEPRECATED_FindTimer( FTimerUnifiedDelegate const& InDelegate, int32* OutTimerIndex=nullptr ) const;
 	FTimerData const* FindTimer( FTimerHandle const& InHandle, int32* OutTimerIndex = nullptr ) const;
 
 	void InternalPauseTimer( FTimerData const* TimerToPause, int32 TimerIdx );
-	void InternalUnPauseTimer( int32 PausedTimerIdx );
+	void InternalUnPauseTimer( FTimerData const* TimerToUnPause, int32 TimerIdx );
 	
 	float InternalGetTimerRate( FTimerData const* const TimerData ) const;
 	float InternalGetTimerElapsed( FTimerData const* const TimerData ) const;
 	float InternalGetTimerRemaining( FTimerData const* const TimerData ) const;
 
-	/** Will find the given timer in the given TArray and return its index. */ 
-	int32 DEPRECATED_FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerUnifiedDelegate const& InDelegate ) const;
-	int32 FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle ) const;
-
+	/** Stores a new timer and gives it a handle. Returns the index of the timer in Timers. */
+	int32 AddTimer( FTimerData const& TimerData );
+	/** Removes a timer from Timers, the timer must not be in the active heap or the pending set anymore. */
+	void RemoveTimer( int32 TimerIdx );
+
+	/** Pushes a timer onto the active heap, using its current ExpireTime. */
+	void AddToActiveHeap( int32 TimerIdx );
+	/** Removes an active timer from the active heap. */
+	void RemoveFromActiveHeap( int32 TimerIdx );
+	/** Restore the heap property after the entry at the given position changed, keeping the timers' HeapIndex up to date. */
+	void ActiveHeapSiftUp( int32 HeapIdx );
+	void ActiveHeapSiftDown( int32 HeapIdx );
+
+	/** All timers, whatever their status. The index part of a timer's handle is its index in this array. */
+	TSparseArray<FTimerData> Timers;
 	/** Heap of actively running timers. */
-	TArray<FTimerData> ActiveTimerHeap;
-	/** Unordered list of paused timers. */
-	TArray<FTimerData> PausedTimerList;
-	/** List of timers added this frame, to be added after timer has been ticked */
-	TArray<FTimerData> PendingTimerList;
+	TArray<FTimerHeapEntry> ActiveTimerHeap;
+	/** Set of timers added this frame, to be added after timer has been ticked */
+	TSet<int32> PendingTimerSet;
 
 	/** An internally consistent clock, independent of World.  Advances during ticking. */
 	double InternalTime;
 
-	/** Timer delegate currently being executed.  Used to handle "timer delegates that manipulating timers" cases. */
-	FTimerData CurrentlyExecutingTimer;
+	/** Timer currently being executed.  Used to handle "timer delegates that manipulating timers" cases, invalidated when the timer gets cleared. */
+	FTimerHandle CurrentlyExecutingTimer;
 
 	/** Set this to GFrameCounter when Timer is ticked. To figure out if Timer has been already ticked or not this frame. */
 	uint64 LastTickedFrame;
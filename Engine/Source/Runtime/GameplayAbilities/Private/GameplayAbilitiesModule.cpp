@@ -2,15 +2,25 @@
 
 #include "AbilitySystemPrivatePCH.h"
 #include "AbilitySystemGlobals.h"
+#include "GameplayEffectAggregator.h"
+#include "Tickable.h"
 
 
-class FGameplayAbilitiesModule : public IGameplayAbilitiesModule
+class FGameplayAbilitiesModule : public IGameplayAbilitiesModule, public FTickableGameObject
 {
 	// Begin IModuleInterface
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 	// End IModuleInterface
 
+	// Begin FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual bool IsTickableInEditor() const override { return true; }
+	virtual TStatId GetStatId() const override;
+	// End FTickableGameObject
+
 	virtual UAbilitySystemGlobals* GetAbilitySystemGlobals()
 	{
 		// Defer loading of globals to the first time it is requested
@@ -50,3 +60,19 @@ void FGameplayAbilitiesModule::ShutdownModule()
 
 	AbilitySystemGlobals = NULL;
 }
+
+void FGameplayAbilitiesModule::Tick(float DeltaTime)
+{
+	// Aggregator OnDirty calls deferred by AbilitySystem.Aggregator.DeferDirtyBroadcasts go out once per frame
+	FScopedAggregatorOnDirtyBatch::FlushDeferredDirtyAggregators();
+}
+
+bool FGameplayAbilitiesModule::IsTickable() const
+{
+	return FScopedAggregatorOnDirtyBatch::HasDeferredDirtyAggregators();
+}
+
+TStatId FGameplayAbilitiesModule::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FGameplayAbilitiesModule, STATGROUP_Tickables);
+}
@@ -4,6 +4,53 @@
 #include "GameplayEffectAggregator.h"
 #include "AbilitySystemComponent.h"
 
+int32 AggregatorCacheEvaluations = 1;
+static FAutoConsoleVariableRef CVarAggregatorCacheEvaluations(
+	TEXT("AbilitySystem.Aggregator.CacheEvaluations"),
+	AggregatorCacheEvaluations,
+	TEXT("Caches the mod sums of aggregators for the tags they are evaluated with, until their mods change"),
+	ECVF_Default
+	);
+
+int32 AggregatorDeferDirtyBroadcasts = 0;
+static FAutoConsoleVariableRef CVarAggregatorDeferDirtyBroadcasts(
+	TEXT("AbilitySystem.Aggregator.DeferDirtyBroadcasts"),
+	AggregatorDeferDirtyBroadcasts,
+	TEXT("Delays aggregator OnDirty calls made outside of network updates to the end of the frame, so attributes are re-evaluated at most once per frame. Attribute values lag their mods until then."),
+	ECVF_Default
+	);
+
+/** Number of tag states each aggregator keeps mod sums for */
+static const int32 MaxAggregatorEvaluationCacheEntries = 4;
+
+static bool AreTagsIdentical(const TArray<FGameplayTag>& CachedTags, const FGameplayTagContainer& Tags)
+{
+	if (CachedTags.Num() != Tags.Num())
+	{
+		return false;
+	}
+
+	int32 TagIdx = 0;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (CachedTags[TagIdx++] != Tag)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void CopyTags(TArray<FGameplayTag>& CachedTags, const FGameplayTagContainer& Tags)
+{
+	CachedTags.Reset(Tags.Num());
+	for (const FGameplayTag& Tag : Tags)
+	{
+		CachedTags.Add(Tag);
+	}
+}
+
 bool FAggregatorMod::Qualifies(const FAggregatorEvaluateParameters& Parameters) const
 {
 	bool bSourceMet = (!SourceTagReqs || SourceTagReqs->IsEmpty()) || (Parameters.SourceTags && SourceTagReqs->RequirementsMet(*Parameters.SourceTags));
@@ -36,6 +83,43 @@ bool FAggregatorMod::Qualifies(const FAggregatorEvaluateParameters& Parameters)
 	return bSourceMet && bTargetMet && bSourceFilterMet && bTargetFilterMet;
 }
 
+bool FAggregatorEvaluationCacheEntry::Matches(const FAggregatorEvaluateParameters& Parameters) const
+{
+	if (IncludePredictiveMods != Parameters.IncludePredictiveMods || HasSourceTags != (Parameters.SourceTags != nullptr) || HasTargetTags != (Parameters.TargetTags != nullptr))
+	{
+		return false;
+	}
+
+	return (!HasSourceTags || AreTagsIdentical(SourceTags, *Parameters.SourceTags)) && (!HasTargetTags || AreTagsIdentical(TargetTags, *Parameters.TargetTags));
+}
+
+void FAggregatorEvaluationCacheEntry::SetKey(const FAggregatorEvaluateParameters& Parameters)
+{
+	HasSourceTags = (Parameters.SourceTags != nullptr);
+	HasTargetTags = (Parameters.TargetTags != nullptr);
+	IncludePredictiveMods = Parameters.IncludePredictiveMods;
+
+	SourceTags.Reset();
+	TargetTags.Reset();
+	if (HasSourceTags)
+	{
+		CopyTags(SourceTags, *Parameters.SourceTags);
+	}
+	if (HasTargetTags)
+	{
+		CopyTags(TargetTags, *Parameters.TargetTags);
+	}
+}
+
+FAggregator::~FAggregator()
+{
+	if (HasPendingDirtyBroadcast)
+	{
+		FScopedAggregatorOnDirtyBatch::DirtyAggregators.Remove(this);
+		FScopedAggregatorOnDirtyBatch::DeferredDirtyAggregators.Remove(this);
+	}
+}
+
 float FAggregator::Evaluate(const FAggregatorEvaluateParameters& Parameters) const
 {
 	return EvaluateWithBase(BaseValue, Parameters);
@@ -43,41 +127,40 @@ float FAggregator::Evaluate(const FAggregatorEvaluateParameters& Parameters) con
 
 float FAggregator::EvaluateWithBase(float InlineBaseValue, const FAggregatorEvaluateParameters& Parameters) const
 {
-	for (const FAggregatorMod& Mod : Mods[EGameplayModOp::Override])
+	SCOPE_CYCLE_COUNTER(STAT_AggregatorEvaluate);
+
+	FAggregatorModSums TempSums;
+	const FAggregatorModSums& Sums = GetModSums(Parameters, TempSums);
+
+	if (Sums.HasOverride)
 	{
-		if (Mod.Qualifies(Parameters))
-		{
-			return Mod.EvaluatedMagnitude;
-		}
+		return Sums.Override;
 	}
 
-	float Additive = SumMods(Mods[EGameplayModOp::Additive], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Additive), Parameters);
-	float Multiplicitive = SumMods(Mods[EGameplayModOp::Multiplicitive], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Multiplicitive), Parameters);
-	float Division = SumMods(Mods[EGameplayModOp::Division], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Division), Parameters);
-
+	float Division = Sums.Division;
 	if (FMath::IsNearlyZero(Division))
 	{
 		ABILITY_LOG(Warning, TEXT("Division summation was 0.0f in FAggregator."));
 		Division = 1.f;
 	}
 
-	return ((InlineBaseValue + Additive) * Multiplicitive) / Division;
+	return ((InlineBaseValue + Sums.Additive) * Sums.Multiplicitive) / Division;
 }
 
 float FAggregator::ReverseEvaluate(float FinalValue, const FAggregatorEvaluateParameters& Parameters) const
 {
-	for (const FAggregatorMod& Mod : Mods[EGameplayModOp::Override])
+	FAggregatorModSums TempSums;
+	const FAggregatorModSums& Sums = GetModSums(Parameters, TempSums);
+
+	if (Sums.HasOverride)
 	{
-		if (Mod.Qualifies(Parameters))
-		{
-			// This is the case we can't really handle due to lack of information.
-			return FinalValue;
-		}
+		// This is the case we can't really handle due to lack of information.
+		return FinalValue;
 	}
 
-	float Additive = SumMods(Mods[EGameplayModOp::Additive], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Additive), Parameters);
-	float Multiplicitive = SumMods(Mods[EGameplayModOp::Multiplicitive], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Multiplicitive), Parameters);
-	float Division = SumMods(Mods[EGameplayModOp::Division], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Division), Parameters);
+	float Additive = Sums.Additive;
+	float Multiplicitive = Sums.Multiplicitive;
+	float Division = Sums.Division;
 
 	if (FMath::IsNearlyZero(Division))
 	{
@@ -166,6 +249,64 @@ float FAggregator::SumMods(const TArray<FAggregatorMod> &Mods, float Bias, const
 	return Sum;
 }
 
+void FAggregator::SumAllMods(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& OutSums) const
+{
+	OutSums.HasOverride = false;
+	for (const FAggregatorMod& Mod : Mods[EGameplayModOp::Override])
+	{
+		if (Mod.Qualifies(Parameters))
+		{
+			OutSums.Override = Mod.EvaluatedMagnitude;
+			OutSums.HasOverride = true;
+			return;
+		}
+	}
+
+	OutSums.Additive = SumMods(Mods[EGameplayModOp::Additive], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Additive), Parameters);
+	OutSums.Multiplicitive = SumMods(Mods[EGameplayModOp::Multiplicitive], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Multiplicitive), Parameters);
+	OutSums.Division = SumMods(Mods[EGameplayModOp::Division], GameplayEffectUtilities::GetModifierBiasByModifierOp(EGameplayModOp::Division), Parameters);
+}
+
+const FAggregatorModSums& FAggregator::GetModSums(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& TempSums) const
+{
+	// Applied tag filters are checked against the tags of the active effects that own the mods, which can change without us knowing about it
+	const bool bCanCache = AggregatorCacheEvaluations && IsInGameThread() && Parameters.AppliedSourceTagFilter.Num() == 0 && Parameters.AppliedTargetTagFilter.Num() == 0;
+	if (!bCanCache)
+	{
+		SumAllMods(Parameters, TempSums);
+		return TempSums;
+	}
+
+	for (const FAggregatorEvaluationCacheEntry& Entry : EvaluationCache)
+	{
+		if (Entry.Matches(Parameters))
+		{
+			return Entry.Sums;
+		}
+	}
+
+	int32 EntryIdx = NextEvaluationCacheEntry;
+	if (EvaluationCache.Num() < MaxAggregatorEvaluationCacheEntries)
+	{
+		EntryIdx = EvaluationCache.Add(FAggregatorEvaluationCacheEntry());
+	}
+	else
+	{
+		NextEvaluationCacheEntry = (NextEvaluationCacheEntry + 1) % MaxAggregatorEvaluationCacheEntries;
+	}
+
+	FAggregatorEvaluationCacheEntry& Entry = EvaluationCache[EntryIdx];
+	Entry.SetKey(Parameters);
+	SumAllMods(Parameters, Entry.Sums);
+	return Entry.Sums;
+}
+
+void FAggregator::InvalidateEvaluationCache()
+{
+	EvaluationCache.Reset();
+	NextEvaluationCacheEntry = 0;
+}
+
 void FAggregator::AddAggregatorMod(float EvaluatedMagnitude, TEnumAsByte<EGameplayModOp::Type> ModifierOp, const FGameplayTagRequirements* SourceTagReqs, const FGameplayTagRequirements* TargetTagReqs, bool IsPredicted, FActiveGameplayEffectHandle ActiveHandle)
 {
 	TArray<FAggregatorMod> &ModList = Mods[ModifierOp];
@@ -184,6 +325,7 @@ void FAggregator::AddAggregatorMod(float EvaluatedMagnitude, TEnumAsByte<EGamepl
 		NumPredictiveMods++;
 	}
 
+	InvalidateEvaluationCache();
 	BroadcastOnDirty();
 }
 
@@ -195,6 +337,7 @@ void FAggregator::RemoveAggregatorMod(FActiveGameplayEffectHandle ActiveHandle)
 		RemoveModsWithActiveHandle(Mods[EGameplayModOp::Multiplicitive], ActiveHandle);
 		RemoveModsWithActiveHandle(Mods[EGameplayModOp::Division], ActiveHandle);
 		RemoveModsWithActiveHandle(Mods[EGameplayModOp::Override], ActiveHandle);
+		InvalidateEvaluationCache();
 	}
 
 	BroadcastOnDirty();
@@ -206,6 +349,8 @@ void FAggregator::AddModsFrom(const FAggregator& SourceAggregator)
 	{
 		Mods[idx].Append(SourceAggregator.Mods[idx]);
 	}
+
+	InvalidateEvaluationCache();
 }
 
 void FAggregator::AddDependent(FActiveGameplayEffectHandle Handle)
@@ -248,6 +393,8 @@ void FAggregator::TakeSnapshotOf(const FAggregator& AggToSnapshot)
 	{
 		Mods[idx] = AggToSnapshot.Mods[idx];
 	}
+
+	InvalidateEvaluationCache();
 }
 
 void FAggregator::BroadcastOnDirty()
@@ -256,9 +403,26 @@ void FAggregator::BroadcastOnDirty()
 	if (FScopedAggregatorOnDirtyBatch::GlobalBatchCount > 0 && (Dependents.Num() > 0 || OnDirty.IsBound()))
 	{
 		FScopedAggregatorOnDirtyBatch::DirtyAggregators.Add(this);
+		HasPendingDirtyBroadcast = true;
 		return;
 	}
 
+	// Network updates are not deferred: clients must reverse evaluate their base values while GlobalFromNetworkUpdate is set.
+	// Dirty calls made while flushing go out right away, so cascades through dependent effects settle within the same frame.
+	if (AggregatorDeferDirtyBroadcasts && IsInGameThread() && !FScopedAggregatorOnDirtyBatch::GlobalFromNetworkUpdate && !FScopedAggregatorOnDirtyBatch::IsFlushingDeferredDirtyAggregators && (Dependents.Num() > 0 || OnDirty.IsBound()))
+	{
+		FScopedAggregatorOnDirtyBatch::DeferredDirtyAggregators.Add(this);
+		HasPendingDirtyBroadcast = true;
+		return;
+	}
+
+	if (HasPendingDirtyBroadcast)
+	{
+		// We are broadcasting now, so a deferred call would be redundant
+		FScopedAggregatorOnDirtyBatch::DeferredDirtyAggregators.Remove(this);
+		HasPendingDirtyBroadcast = false;
+	}
+
 	if (IsBroadcastingDirty)
 	{
 		// Apologies for the vague warning but its very hard from this spot to call out what data has caused this. If this frequently happens we should improve this.
@@ -304,6 +468,8 @@ int32 FScopedAggregatorOnDirtyBatch::GlobalBatchCount = 0;
 TSet<FAggregator*> FScopedAggregatorOnDirtyBatch::DirtyAggregators;
 bool FScopedAggregatorOnDirtyBatch::GlobalFromNetworkUpdate = false;
 int32 FScopedAggregatorOnDirtyBatch::NetUpdateID = 1;
+TSet<FAggregator*> FScopedAggregatorOnDirtyBatch::DeferredDirtyAggregators;
+bool FScopedAggregatorOnDirtyBatch::IsFlushingDeferredDirtyAggregators = false;
 
 FScopedAggregatorOnDirtyBatch::FScopedAggregatorOnDirtyBatch()
 {
@@ -351,3 +517,30 @@ void FScopedAggregatorOnDirtyBatch::EndNetReceiveLock()
 		GlobalFromNetworkUpdate = false;
 	}
 }
+
+void FScopedAggregatorOnDirtyBatch::FlushDeferredDirtyAggregators()
+{
+	check(IsInGameThread());
+	if (GlobalBatchCount > 0 || IsFlushingDeferredDirtyAggregators)
+	{
+		return;
+	}
+
+	TGuardValue<bool> Guard(IsFlushingDeferredDirtyAggregators, true);
+
+	// Take the aggregators out one at a time: broadcasting can delete aggregators that are still pending, which removes them from the set.
+	while (DeferredDirtyAggregators.Num() > 0)
+	{
+		TSet<FAggregator*>::TIterator It = DeferredDirtyAggregators.CreateIterator();
+		FAggregator* Agg = *It;
+		It.RemoveCurrent();
+
+		Agg->HasPendingDirtyBroadcast = false;
+		Agg->BroadcastOnDirty();
+	}
+}
+
+bool FScopedAggregatorOnDirtyBatch::HasDeferredDirtyAggregators()
+{
+	return DeferredDirtyAggregators.Num() > 0;
+}
@@ -34,12 +34,43 @@ struct GAMEPLAYABILITIES_API FAggregatorMod
 	bool Qualifies(const FAggregatorEvaluateParameters& Parameters) const;
 };
 
+/** Sums of the mods of an aggregator that qualify for a set of evaluation parameters */
+struct GAMEPLAYABILITIES_API FAggregatorModSums
+{
+	FAggregatorModSums() : Additive(0.f), Multiplicitive(1.f), Division(1.f), Override(0.f), HasOverride(false) { }
+
+	float Additive;
+	float Multiplicitive;
+	float Division;
+
+	/** Magnitude of the first qualifying override mod, only meaningful if HasOverride is set */
+	float Override;
+	bool HasOverride;
+};
+
+/** Mod sums of an aggregator cached for the tag state of the evaluation parameters they were summed with */
+struct GAMEPLAYABILITIES_API FAggregatorEvaluationCacheEntry
+{
+	bool Matches(const FAggregatorEvaluateParameters& Parameters) const;
+	void SetKey(const FAggregatorEvaluateParameters& Parameters);
+
+	/** Copies of the source and target tags, the containers themselves are owned by the caller of Evaluate */
+	TArray<FGameplayTag> SourceTags;
+	TArray<FGameplayTag> TargetTags;
+	bool HasSourceTags;
+	bool HasTargetTags;
+	bool IncludePredictiveMods;
+
+	FAggregatorModSums Sums;
+};
+
 
 struct GAMEPLAYABILITIES_API FAggregator : public TSharedFromThis<FAggregator>
 {
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnAggregatorDirty, FAggregator*);
 
-	FAggregator(float InBaseValue=0.f) : NetUpdateID(0), BaseValue(InBaseValue), IsBroadcastingDirty(false), NumPredictiveMods(0) { }
+	FAggregator(float InBaseValue=0.f) : NetUpdateID(0), BaseValue(InBaseValue), NextEvaluationCacheEntry(0), IsBroadcastingDirty(false), HasPendingDirtyBroadcast(false), NumPredictiveMods(0) { }
+	~FAggregator();
 
 	/** Simple accessor to base value */
 	float GetBaseValue() const;
@@ -81,14 +112,30 @@ private:
 
 	void BroadcastOnDirty();
 	float SumMods(const TArray<FAggregatorMod> &Mods, float Bias, const FAggregatorEvaluateParameters& Parameters) const;
+	void SumAllMods(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& OutSums) const;
 	void RemoveModsWithActiveHandle(TArray<FAggregatorMod>& Mods, FActiveGameplayEffectHandle ActiveHandle);
 
+	/** Returns the mod sums for these parameters, from the evaluation cache when possible. TempSums is used when the parameters can't be cached. */
+	const FAggregatorModSums& GetModSums(const FAggregatorEvaluateParameters& Parameters, FAggregatorModSums& TempSums) const;
+
+	/** Must be called whenever Mods changes */
+	void InvalidateEvaluationCache();
+
 	float	BaseValue;
 	TArray<FAggregatorMod>	Mods[EGameplayModOp::Max];
 
+	/** Mod sums of recent evaluations. Only depends on Mods, so changing the base value keeps it valid. */
+	mutable TArray<FAggregatorEvaluationCacheEntry>	EvaluationCache;
+
+	/** Next entry of EvaluationCache to replace once it is full */
+	mutable int32	NextEvaluationCacheEntry;
+
 	/** ActiveGE handles that we need to notify if we change. NOT copied over during snapshots. */
 	TArray<FActiveGameplayEffectHandle>	Dependents;
 	bool	IsBroadcastingDirty;
+
+	/** Set while we are in one of the FScopedAggregatorOnDirtyBatch sets, so we can take ourselves out of them if we get deleted */
+	bool	HasPendingDirtyBroadcast;
 	int32	NumPredictiveMods;
 
 	friend struct FAggregator;
@@ -114,6 +161,9 @@ struct GAMEPLAYABILITIES_API FAggregatorRef
  *	
  *	The only catch is that we store raw FAggregator*. This should only be used in scopes where aggreagtors
  *	are not deleted. There is currently no place that does. If we find to, we could add additional safety checks.
+ *
+ *	With AbilitySystem.Aggregator.DeferDirtyBroadcasts, OnDirty calls made outside of network updates are also
+ *	delayed to the end of the frame, so an aggregator that changes several times in a frame is only re-evaluated once.
  */
 struct GAMEPLAYABILITIES_API FScopedAggregatorOnDirtyBatch
 {
@@ -131,4 +181,13 @@ struct GAMEPLAYABILITIES_API FScopedAggregatorOnDirtyBatch
 
 	static bool		GlobalFromNetworkUpdate;
 	static int32	NetUpdateID;
+
+	/** Broadcasts the OnDirty calls that were deferred to the end of the frame. Called once per frame by the GameplayAbilities module. */
+	static void FlushDeferredDirtyAggregators();
+
+	/** Returns true if there are deferred OnDirty calls waiting for FlushDeferredDirtyAggregators() */
+	static bool HasDeferredDirtyAggregators();
+
+	static TSet<FAggregator*>	DeferredDirtyAggregators;
+	static bool		IsFlushingDeferredDirtyAggregators;
 };
\ No newline at end of file
@@ -113,6 +113,102 @@ struct TStructOpsTypeTraits< FGameplayTag > : public TStructOpsTypeTraitsBase
 	};
 };
 
+/** Helpers for sets of tags encoded as bits, indexed by UGameplayTagsManager::GetTagBitIndex. Words past the end of an array are zero. */
+struct FGameplayTagBits
+{
+	/** Sets the bit of a tag, growing the array as needed */
+	static FORCEINLINE void SetBit(TArray<uint32>& Bits, int32 BitIndex)
+	{
+		const int32 WordIndex = BitIndex >> 5;
+		if (WordIndex >= Bits.Num())
+		{
+			Bits.AddZeroed(WordIndex + 1 - Bits.Num());
+		}
+		Bits[WordIndex] |= 1u << (BitIndex & 31);
+	}
+
+	/** Returns true if the bit of a tag is set */
+	static FORCEINLINE bool HasBit(const TArray<uint32>& Bits, int32 BitIndex)
+	{
+		const int32 WordIndex = BitIndex >> 5;
+		return WordIndex < Bits.Num() && (Bits[WordIndex] & (1u << (BitIndex & 31))) != 0;
+	}
+
+	/** Adds all bits of Other to Bits */
+	static FORCEINLINE void Append(TArray<uint32>& Bits, const TArray<uint32>& Other)
+	{
+		if (Other.Num() > Bits.Num())
+		{
+			Bits.AddZeroed(Other.Num() - Bits.Num());
+		}
+		for (int32 WordIndex = 0; WordIndex < Other.Num(); WordIndex++)
+		{
+			Bits[WordIndex] |= Other[WordIndex];
+		}
+	}
+
+	/** Returns true if any bit is set in both A and B */
+	static FORCEINLINE bool Intersects(const TArray<uint32>& A, const TArray<uint32>& B)
+	{
+		const int32 NumWords = FMath::Min(A.Num(), B.Num());
+		for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+		{
+			if (A[WordIndex] & B[WordIndex])
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Returns true if all bits of Subset are set in Bits */
+	static FORCEINLINE bool Contains(const TArray<uint32>& Bits, const TArray<uint32>& Subset)
+	{
+		for (int32 WordIndex = 0; WordIndex < Subset.Num(); WordIndex++)
+		{
+			const uint32 Word = WordIndex < Bits.Num() ? Bits[WordIndex] : 0;
+			if ((Subset[WordIndex] & ~Word) != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+/** Bits of the tags of a container, kept up to date by the container's mutators */
+struct FGameplayTagContainerBits
+{
+	/** Bits of the tags */
+	TArray<uint32> ExplicitBits;
+
+	/** Bits of the tags and all of their parents */
+	TArray<uint32> ParentBits;
+
+	/** Number of tags the bits were built from */
+	int32 NumTags;
+
+	/** Hash of the tags the bits were built from, in order, catches tags the property system replaced without changing their count */
+	uint32 TagsHash;
+
+	/** Generation of the tag tree the bits were built with */
+	int32 TagTreeGeneration;
+
+	/** Set when the tags changed and the bits have to be rebuilt */
+	bool bDirty;
+
+	/** False if some of the tags are not in the tag tree, so they have no bits */
+	bool bAllTagsHaveBits;
+
+	FGameplayTagContainerBits()
+		: NumTags(0)
+		, TagsHash(0)
+		, TagTreeGeneration(INDEX_NONE)
+		, bDirty(false)
+		, bAllTagsHaveBits(true)
+	{}
+};
+
 /** Simple struct for a gameplay tag container */
 USTRUCT(BlueprintType)
 struct GAMEPLAYTAGS_API FGameplayTagContainer
@@ -222,6 +318,9 @@ struct GAMEPLAYTAGS_API FGameplayTagContainer
 	 */
 	bool Serialize(FArchive& Ar);
 
+	/** Rebuilds the bits of the tags after they were loaded */
+	void PostSerialize(const FArchive& Ar);
+
 	/**
 	 * Returns the Tag Count
 	 *
@@ -287,8 +386,29 @@ protected:
 	// access to others without exposing everything the Container has privately to everyone.
 	friend class FGameplayTagRedirectHelper;
 
+	/**
+	 * Returns the bits of the tags. They are rebuilt by every mutator, so matching only falls back to building them
+	 * in TempBits if the tag tree changed or the tags were written directly by the property system (replication,
+	 * Blueprint, text import).
+	 *
+	 * @param TempBits	Bits to build when the container's ones are stale
+	 */
+	const FGameplayTagContainerBits& GetTagBits(FGameplayTagContainerBits& TempBits) const;
+
+	/** Returns true if Bits were built from the first NumTags tags of the container, with the current tag tree */
+	bool AreTagBitsUpToDate(const FGameplayTagContainerBits& Bits, int32 NumTags) const;
+
+	/** Builds Bits from the tags of the container */
+	void BuildTagBits(FGameplayTagContainerBits& Bits) const;
+
+	/** Rebuilds the bits of the container if its tags changed */
+	void UpdateTagBits();
+
 private:
 
+	/** Bits of GameplayTags for word-wise matching, rebuilt eagerly when the tags change */
+	FGameplayTagContainerBits TagBits;
+
 	/** Array of gameplay tags */
 	UPROPERTY()
 	TArray<FName> Tags_DEPRECATED;
@@ -318,6 +438,7 @@ struct TStructOpsTypeTraits<FGameplayTagContainer> : public TStructOpsTypeTraits
 	enum
 	{
 		WithSerializer = true,
+		WithPostSerialize = true,
 		WithIdenticalViaEquality = true,
 		WithCopy = true
 	};
@@ -34,7 +34,7 @@ USTRUCT()
 struct FGameplayTagNode
 {
 	GENERATED_USTRUCT_BODY()
-	FGameplayTagNode(){};
+	FGameplayTagNode() : BitIndex(INDEX_NONE) {};
 
 	/** Simple constructor */
 	FGameplayTagNode(FName InTag, TWeakPtr<FGameplayTagNode> InParentNode, FText InCategoryDescription = FText());
@@ -88,6 +88,13 @@ struct FGameplayTagNode
 	*/
 	GAMEPLAYTAGS_API FGameplayTagNetIndex GetNetIndex() const;
 
+	/**
+	* Get the bit index of this node
+	*
+	* @return The dense index of this node's tag in tag bit sets, INDEX_NONE if not assigned
+	*/
+	GAMEPLAYTAGS_API int32 GetBitIndex() const;
+
 	/** Reset the node of all of its values */
 	GAMEPLAYTAGS_API void ResetNode();
 
@@ -110,6 +117,12 @@ private:
 	/** Net Index of this node */
 	FGameplayTagNetIndex NetIndex;
 
+	/** Dense index of this node's tag in tag bit sets, parents always have lower indices than their children */
+	int32 BitIndex;
+
+	/** Bits of this node's tag and all of its parents */
+	TArray<uint32> ParentBits;
+
 	friend class UGameplayTagsManager;
 };
 
@@ -262,6 +275,19 @@ class GAMEPLAYTAGS_API UGameplayTagsManager : public UObject
 	FName GetTagNameFromNetIndex(FGameplayTagNetIndex Index);
 	FGameplayTagNetIndex GetNetIndexFromTag(const FGameplayTag &InTag);
 
+	/**
+	 * Gets the dense index of a tag in tag bit sets (see FGameplayTagBits)
+	 *
+	 * @param Tag				The tag to look for
+	 * @param OutParentBits		If set, receives the bits of the tag and all of its parents
+	 *
+	 * @return The bit index of the tag, INDEX_NONE if it is not in the tag tree
+	 */
+	int32 GetTagBitIndex(const FGameplayTag& Tag, const TArray<uint32>** OutParentBits = nullptr) const;
+
+	/** Changes whenever tags are added to or removed from the tag tree, so bits built before are no longer valid */
+	int32 GetTagTreeGeneration() const { return TagTreeGeneration; }
+
 private:
 
 	friend class FGameplayTagTest;
@@ -282,15 +308,6 @@ private:
 
 	void AddChildrenTags(FGameplayTagContainer& TagContainer, const FGameplayTag& GameplayTag, bool RecurseAll=true) const;
 
-	/**
-	 * Helper function for GameplayTagsMatch to get all parents when doing a parent match,
-	 * NOTE: Must never be made public as it uses the FNames which should never be exposed
-	 * 
-	 * @param NameList		The list we are adding all parent complete names too
-	 * @param GameplayTag	The current Tag we are adding to the list
-	 */
-	void GetAllParentNodeNames(TSet<FName>& NamesList, const TSharedPtr<FGameplayTagNode> GameplayTag) const;
-
 	/** Constructs the net indices for each tag */
 	void ConstructNetIndex();
 
@@ -306,6 +323,12 @@ private:
 	/** Sorted list of nodes, used for network replication */
 	TArray<TSharedPtr<FGameplayTagNode>> NetworkGameplayTagNodeIndex;
 
+	/** Bit index of the next node added to the tag tree */
+	int32 NextTagBitIndex;
+
+	/** Incremented whenever the tag tree changes */
+	int32 TagTreeGeneration;
+
 	/** Holds all of the valid gameplay-related tags that can be applied to assets */
 	UPROPERTY()
 	TArray<UDataTable*> GameplayTagTables;
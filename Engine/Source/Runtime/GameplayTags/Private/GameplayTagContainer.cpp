@@ -19,6 +19,7 @@ FGameplayTagContainer::FGameplayTagContainer(const FGameplayTag& Tag)
 
 FGameplayTagContainer::FGameplayTagContainer(FGameplayTagContainer&& Other)
 	: GameplayTags(MoveTemp(Other.GameplayTags))
+	, TagBits(MoveTemp(Other.TagBits))
 {
 	
 }
@@ -32,6 +33,7 @@ FGameplayTagContainer& FGameplayTagContainer::operator=(FGameplayTagContainer co
 	}
 	GameplayTags.Empty(Other.GameplayTags.Num());
 	GameplayTags.Append(Other.GameplayTags);
+	TagBits = Other.TagBits;
 
 	return *this;
 }
@@ -39,6 +41,7 @@ FGameplayTagContainer& FGameplayTagContainer::operator=(FGameplayTagContainer co
 FGameplayTagContainer& FGameplayTagContainer::operator=(FGameplayTagContainer&& Other)
 {
 	GameplayTags = MoveTemp(Other.GameplayTags);
+	TagBits = MoveTemp(Other.TagBits);
 	return *this;
 }
 
@@ -60,17 +63,102 @@ bool FGameplayTagContainer::operator!=(FGameplayTagContainer const& Other) const
 	return Filter(Other, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit).Num() != this->Num();
 }
 
-bool FGameplayTagContainer::HasTag(FGameplayTag const& TagToCheck, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> TagToCheckMatchType) const
+namespace GameplayTagContainerBits
+{
+	/** Hashes the first NumTags tags in order, so that replacing a tag changes the hash even when the count stays the same */
+	static uint32 HashTags(const TArray<FGameplayTag>& Tags, int32 NumTags)
+	{
+		uint32 Hash = 0;
+		for (int32 TagIndex = 0; TagIndex < NumTags; TagIndex++)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Tags[TagIndex]));
+		}
+		return Hash;
+	}
+}
+
+bool FGameplayTagContainer::AreTagBitsUpToDate(const FGameplayTagContainerBits& Bits, int32 NumTags) const
+{
+	// the property system writes GameplayTags directly (replication, Blueprint, text import) and skips the mutators,
+	// so the bits are checked against the tags themselves and not only the dirty flag
+	if (Bits.bDirty || Bits.NumTags != NumTags)
+	{
+		return false;
+	}
+	if (NumTags == 0)
+	{
+		return true;
+	}
+	return Bits.TagTreeGeneration == IGameplayTagsModule::Get().GetGameplayTagsManager().GetTagTreeGeneration() &&
+		Bits.TagsHash == GameplayTagContainerBits::HashTags(GameplayTags, NumTags);
+}
+
+const FGameplayTagContainerBits& FGameplayTagContainer::GetTagBits(FGameplayTagContainerBits& TempBits) const
+{
+	if (AreTagBitsUpToDate(TagBits, GameplayTags.Num()))
+	{
+		return TagBits;
+	}
+
+	BuildTagBits(TempBits);
+	return TempBits;
+}
+
+void FGameplayTagContainer::BuildTagBits(FGameplayTagContainerBits& Bits) const
 {
 	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
-	for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
+	Bits.ExplicitBits.Reset();
+	Bits.ParentBits.Reset();
+	Bits.NumTags = GameplayTags.Num();
+	Bits.TagsHash = GameplayTagContainerBits::HashTags(GameplayTags, GameplayTags.Num());
+	Bits.TagTreeGeneration = TagManager.GetTagTreeGeneration();
+	Bits.bDirty = false;
+	Bits.bAllTagsHaveBits = true;
+
+	for (const FGameplayTag& Tag : GameplayTags)
 	{
-		if (TagManager.GameplayTagsMatch(*It, TagMatchType, TagToCheck, TagToCheckMatchType) == true)
+		const TArray<uint32>* TagParentBits = nullptr;
+		const int32 BitIndex = TagManager.GetTagBitIndex(Tag, &TagParentBits);
+		if (BitIndex != INDEX_NONE)
 		{
-			return true;
+			FGameplayTagBits::SetBit(Bits.ExplicitBits, BitIndex);
+			FGameplayTagBits::Append(Bits.ParentBits, *TagParentBits);
+		}
+		else
+		{
+			Bits.bAllTagsHaveBits = false;
 		}
 	}
-	return false;
+}
+
+void FGameplayTagContainer::UpdateTagBits()
+{
+	if (TagBits.bDirty)
+	{
+		BuildTagBits(TagBits);
+	}
+}
+
+bool FGameplayTagContainer::HasTag(FGameplayTag const& TagToCheck, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> TagToCheckMatchType) const
+{
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	const TArray<uint32>* TagToCheckParentBits = nullptr;
+	const int32 TagToCheckBitIndex = TagManager.GetTagBitIndex(TagToCheck, &TagToCheckParentBits);
+	if (TagToCheckBitIndex == INDEX_NONE)
+	{
+		// tags missing from the tag tree never match
+		return false;
+	}
+
+	FGameplayTagContainerBits TempBits;
+	const FGameplayTagContainerBits& Bits = GetTagBits(TempBits);
+	const TArray<uint32>& ContainerBits = (TagMatchType == EGameplayTagMatchType::Explicit) ? Bits.ExplicitBits : Bits.ParentBits;
+
+	if (TagToCheckMatchType == EGameplayTagMatchType::Explicit)
+	{
+		return FGameplayTagBits::HasBit(ContainerBits, TagToCheckBitIndex);
+	}
+	return FGameplayTagBits::Intersects(ContainerBits, *TagToCheckParentBits);
 }
 
 bool FGameplayTagContainer::RemoveTagByExplicitName(const FName& TagName)
@@ -108,15 +196,27 @@ FGameplayTagContainer FGameplayTagContainer::Filter(const FGameplayTagContainer&
 	FGameplayTagContainer ResultContainer;
 	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
 
-	
-	for (TArray<FGameplayTag>::TConstIterator OtherIt(OtherContainer.GameplayTags); OtherIt; ++OtherIt)
+	FGameplayTagContainerBits OtherTempBits;
+	const FGameplayTagContainerBits& OtherBits = OtherContainer.GetTagBits(OtherTempBits);
+	const TArray<uint32>& OtherContainerBits = (OtherTagMatchType == EGameplayTagMatchType::Explicit) ? OtherBits.ExplicitBits : OtherBits.ParentBits;
+
+	// a tag passes if it matches any tag of the other container, so it's checked against the bits of all of them at once
+	for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
 	{
-		for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
+		const TArray<uint32>* TagParentBits = nullptr;
+		const int32 BitIndex = TagManager.GetTagBitIndex(*It, &TagParentBits);
+		if (BitIndex == INDEX_NONE)
 		{
-			if (TagManager.GameplayTagsMatch(*It, TagMatchType, *OtherIt, OtherTagMatchType) == true)
-			{
-				ResultContainer.AddTag(*It);
-			}
+			continue;
+		}
+
+		const bool bMatches = (TagMatchType == EGameplayTagMatchType::Explicit) ?
+			FGameplayTagBits::HasBit(OtherContainerBits, BitIndex) :
+			FGameplayTagBits::Intersects(*TagParentBits, OtherContainerBits);
+
+		if (bMatches)
+		{
+			ResultContainer.AddTag(*It);
 		}
 	}
 
@@ -125,37 +225,47 @@ FGameplayTagContainer FGameplayTagContainer::Filter(const FGameplayTagContainer&
 
 bool FGameplayTagContainer::DoesTagContainerMatch(const FGameplayTagContainer& OtherContainer, TEnumAsByte<EGameplayTagMatchType::Type> TagMatchType, TEnumAsByte<EGameplayTagMatchType::Type> OtherTagMatchType, EGameplayContainerMatchType ContainerMatchType) const
 {
-	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	check(ContainerMatchType == EGameplayContainerMatchType::All || ContainerMatchType == EGameplayContainerMatchType::Any);
 
-	for (TArray<FGameplayTag>::TConstIterator OtherIt(OtherContainer.GameplayTags); OtherIt; ++OtherIt)
-	{
-		bool bTagFound = false;
+	FGameplayTagContainerBits TempBits;
+	FGameplayTagContainerBits OtherTempBits;
+	const FGameplayTagContainerBits& Bits = GetTagBits(TempBits);
+	const FGameplayTagContainerBits& OtherBits = OtherContainer.GetTagBits(OtherTempBits);
+	const TArray<uint32>& ContainerBits = (TagMatchType == EGameplayTagMatchType::Explicit) ? Bits.ExplicitBits : Bits.ParentBits;
 
-		for (TArray<FGameplayTag>::TConstIterator It(this->GameplayTags); It; ++It)
+	if (OtherTagMatchType == EGameplayTagMatchType::Explicit)
+	{
+		// each tag of OtherContainer matches when its own bit is set
+		if (ContainerMatchType == EGameplayContainerMatchType::Any)
 		{
-			if (TagManager.GameplayTagsMatch(*It, TagMatchType, *OtherIt, OtherTagMatchType) == true)
-			{
-				if (ContainerMatchType == EGameplayContainerMatchType::Any)
-				{
-					return true;
-				}
+			return FGameplayTagBits::Intersects(ContainerBits, OtherBits.ExplicitBits);
+		}
+		return OtherBits.bAllTagsHaveBits && FGameplayTagBits::Contains(ContainerBits, OtherBits.ExplicitBits);
+	}
 
-				bTagFound = true;
+	// each tag of OtherContainer matches when any of its parents is set
+	if (ContainerMatchType == EGameplayContainerMatchType::Any)
+	{
+		return FGameplayTagBits::Intersects(ContainerBits, OtherBits.ParentBits);
+	}
 
-				// we only need one match per tag in OtherContainer, so don't bother looking for more
-				break;
-			}
-		}
+	if (!OtherBits.bAllTagsHaveBits)
+	{
+		return false;
+	}
 
-		if (ContainerMatchType == EGameplayContainerMatchType::All && bTagFound == false)
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	for (TArray<FGameplayTag>::TConstIterator OtherIt(OtherContainer.GameplayTags); OtherIt; ++OtherIt)
+	{
+		const TArray<uint32>* OtherTagParentBits = nullptr;
+		TagManager.GetTagBitIndex(*OtherIt, &OtherTagParentBits);
+		if (OtherTagParentBits == nullptr || !FGameplayTagBits::Intersects(ContainerBits, *OtherTagParentBits))
 		{
 			return false;
 		}
 	}
 
-	// if we've reached this far then either we are looking for any match and didn't find one (return false) or we're looking for all matches and didn't miss one (return true).
-	check(ContainerMatchType == EGameplayContainerMatchType::All || ContainerMatchType == EGameplayContainerMatchType::Any);
-	return ContainerMatchType == EGameplayContainerMatchType::All;
+	return true;
 }
 
 
@@ -184,8 +294,13 @@ void FGameplayTagContainer::AppendTags(FGameplayTagContainer const& Other)
 	//add all the tags
 	for(TArray<FGameplayTag>::TConstIterator It(Other.GameplayTags); It; ++It)
 	{
-		AddTag(*It);
+		if (It->IsValid() && !GameplayTags.Contains(*It))
+		{
+			GameplayTags.Add(*It);
+			TagBits.bDirty = true;
+		}
 	}
+	UpdateTagBits();
 }
 
 void FGameplayTagContainer::AddTag(const FGameplayTag& TagToAdd)
@@ -193,23 +308,57 @@ void FGameplayTagContainer::AddTag(const FGameplayTag& TagToAdd)
 	if (TagToAdd.IsValid())
 	{
 		// Don't want duplicate tags
-		GameplayTags.AddUnique(TagToAdd);
+		if (!GameplayTags.Contains(TagToAdd))
+		{
+			AddTagFast(TagToAdd);
+		}
 	}
 }
 
 void FGameplayTagContainer::AddTagFast(const FGameplayTag& TagToAdd)
 {
 	GameplayTags.Add(TagToAdd);
+
+	// bits of the other tags stay valid, so the new tag is only added to them
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	const TArray<uint32>* TagParentBits = nullptr;
+	const int32 BitIndex = TagManager.GetTagBitIndex(TagToAdd, &TagParentBits);
+	const bool bCanAddBits = AreTagBitsUpToDate(TagBits, GameplayTags.Num() - 1);
+
+	if (!bCanAddBits)
+	{
+		TagBits.bDirty = true;
+		UpdateTagBits();
+		return;
+	}
+
+	if (BitIndex != INDEX_NONE)
+	{
+		FGameplayTagBits::SetBit(TagBits.ExplicitBits, BitIndex);
+		FGameplayTagBits::Append(TagBits.ParentBits, *TagParentBits);
+	}
+	else
+	{
+		TagBits.bAllTagsHaveBits = false;
+	}
+	TagBits.NumTags = GameplayTags.Num();
+	TagBits.TagsHash = HashCombine(TagBits.TagsHash, GetTypeHash(TagToAdd));
+	TagBits.TagTreeGeneration = TagManager.GetTagTreeGeneration();
 }
 
 void FGameplayTagContainer::RemoveTag(FGameplayTag TagToRemove)
 {
-	GameplayTags.Remove(TagToRemove);
+	if (GameplayTags.Remove(TagToRemove) > 0)
+	{
+		TagBits.bDirty = true;
+		UpdateTagBits();
+	}
 }
 
 void FGameplayTagContainer::RemoveAllTags(int32 Slack)
 {
 	GameplayTags.Empty(Slack);
+	TagBits = FGameplayTagContainerBits();
 }
 
 bool FGameplayTagContainer::Serialize(FArchive& Ar)
@@ -260,6 +409,15 @@ bool FGameplayTagContainer::Serialize(FArchive& Ar)
 	return true;
 }
 
+void FGameplayTagContainer::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		TagBits.bDirty = true;
+		UpdateTagBits();
+	}
+}
+
 int32 FGameplayTagContainer::Num() const
 {
 	return GameplayTags.Num();
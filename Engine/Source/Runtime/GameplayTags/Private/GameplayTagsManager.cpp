@@ -11,6 +11,8 @@
 
 UGameplayTagsManager::UGameplayTagsManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer),
+	NextTagBitIndex(0),
+	TagTreeGeneration(0),
 	bHasHandledRedirectors(false)
 {
 #if WITH_EDITOR
@@ -205,6 +207,22 @@ FGameplayTagNetIndex UGameplayTagsManager::GetNetIndexFromTag(const FGameplayTag
 	return INVALID_TAGNETINDEX;
 }
 
+int32 UGameplayTagsManager::GetTagBitIndex(const FGameplayTag& Tag, const TArray<uint32>** OutParentBits) const
+{
+	const TSharedPtr<FGameplayTagNode>* GameplayTagNode = GameplayTagNodeMap.Find(Tag);
+
+	// nodes of a destroyed tree are reset and have no bit index anymore
+	if (GameplayTagNode && GameplayTagNode->IsValid() && (*GameplayTagNode)->BitIndex != INDEX_NONE)
+	{
+		if (OutParentBits)
+		{
+			*OutParentBits = &(*GameplayTagNode)->ParentBits;
+		}
+		return (*GameplayTagNode)->BitIndex;
+	}
+	return INDEX_NONE;
+}
+
 bool UGameplayTagsManager::ShouldImportTagsFromINI()
 {
 	bool ImportFromINI = false;
@@ -358,6 +376,9 @@ void UGameplayTagsManager::DestroyGameplayTagTree()
 		GameplayRootTag->ResetNode();
 		GameplayRootTag.Reset();
 	}
+
+	NextTagBitIndex = 0;
+	TagTreeGeneration++;
 }
 
 int32 UGameplayTagsManager::InsertTagIntoNodeArray(FName Tag, TWeakPtr<FGameplayTagNode> ParentNode, TArray< TSharedPtr<FGameplayTagNode> >& NodeArray, FText CategoryDescription)
@@ -380,6 +401,16 @@ int32 UGameplayTagsManager::InsertTagIntoNodeArray(FName Tag, TWeakPtr<FGameplay
 		TSharedPtr<FGameplayTagNode> TagNode = MakeShareable(new FGameplayTagNode(Tag, ParentNode, CategoryDescription));
 		InsertionIdx = NodeArray.Add(TagNode);
 
+		// Parents are inserted before their children, so the parent bits only need to be extended with this node's bit
+		TSharedPtr<FGameplayTagNode> ParentTagNode = ParentNode.Pin();
+		if (ParentTagNode.IsValid())
+		{
+			TagNode->ParentBits = ParentTagNode->ParentBits;
+		}
+		TagNode->BitIndex = NextTagBitIndex++;
+		FGameplayTagBits::SetBit(TagNode->ParentBits, TagNode->BitIndex);
+		TagTreeGeneration++;
+
 		FGameplayTag GameplayTag = FGameplayTag(TagNode->GetCompleteTag());
 		GameplayTagMap.Add(TagNode->GetCompleteTag(), GameplayTag);
 		GameplayTagNodeMap.Add(GameplayTag, TagNode);
@@ -597,51 +628,28 @@ void UGameplayTagsManager::AddChildrenTags(FGameplayTagContainer& TagContainer,
 
 bool UGameplayTagsManager::GameplayTagsMatch(const FGameplayTag& GameplayTagOne, TEnumAsByte<EGameplayTagMatchType::Type> MatchTypeOne, const FGameplayTag& GameplayTagTwo, TEnumAsByte<EGameplayTagMatchType::Type> MatchTypeTwo) const
 {
-	TSet<FName> Tags1;
-	TSet<FName> Tags2;
-	if (MatchTypeOne == EGameplayTagMatchType::Explicit)
+	const TArray<uint32>* ParentBitsOne = nullptr;
+	const TArray<uint32>* ParentBitsTwo = nullptr;
+	const int32 BitIndexOne = GetTagBitIndex(GameplayTagOne, &ParentBitsOne);
+	const int32 BitIndexTwo = GetTagBitIndex(GameplayTagTwo, &ParentBitsTwo);
+	if (BitIndexOne == INDEX_NONE || BitIndexTwo == INDEX_NONE)
 	{
-		const TSharedPtr<FGameplayTagNode>* TagNode = GameplayTagNodeMap.Find(GameplayTagOne);
-		if (TagNode)
-		{
-			Tags1.Add((*TagNode)->GetCompleteTag());
-		}
+		return false;
 	}
-	if (MatchTypeTwo == EGameplayTagMatchType::Explicit)
-	{
-		const TSharedPtr<FGameplayTagNode>* TagNode = GameplayTagNodeMap.Find(GameplayTagTwo);
-		if (TagNode)
-		{
-			Tags2.Add((*TagNode)->GetCompleteTag());
-		}
-	}
-	if (MatchTypeOne == EGameplayTagMatchType::IncludeParentTags)
+
+	if (MatchTypeOne == EGameplayTagMatchType::Explicit && MatchTypeTwo == EGameplayTagMatchType::Explicit)
 	{
-		const TSharedPtr<FGameplayTagNode>* TagNode = GameplayTagNodeMap.Find(GameplayTagOne);
-		if (TagNode)
-		{
-			GetAllParentNodeNames(Tags1, *TagNode);
-		}
+		return BitIndexOne == BitIndexTwo;
 	}
-	if (MatchTypeTwo == EGameplayTagMatchType::IncludeParentTags)
+	if (MatchTypeOne == EGameplayTagMatchType::Explicit)
 	{
-		const TSharedPtr<FGameplayTagNode>* TagNode = GameplayTagNodeMap.Find(GameplayTagTwo);
-		if (TagNode)
-		{
-			GetAllParentNodeNames(Tags2, *TagNode);
-		}
+		return FGameplayTagBits::HasBit(*ParentBitsTwo, BitIndexOne);
 	}
-	return Tags1.Intersect(Tags2).Num() > 0;
-}
-
-void UGameplayTagsManager::GetAllParentNodeNames(TSet<FName>& NamesList, const TSharedPtr<FGameplayTagNode> GameplayTag) const
-{
-	NamesList.Add(GameplayTag->GetCompleteTag());
-	const TSharedPtr<FGameplayTagNode> Parent = GameplayTag->GetParentTagNode().Pin();
-	if (Parent.IsValid())
+	if (MatchTypeTwo == EGameplayTagMatchType::Explicit)
 	{
-		GetAllParentNodeNames(NamesList, Parent);
+		return FGameplayTagBits::HasBit(*ParentBitsOne, BitIndexTwo);
 	}
+	return FGameplayTagBits::Intersects(*ParentBitsOne, *ParentBitsTwo);
 }
 
 bool UGameplayTagsManager::ValidateTagCreation(FName TagName) const
@@ -703,6 +711,7 @@ FGameplayTagNode::FGameplayTagNode(FName InTag, TWeakPtr<FGameplayTagNode> InPar
 	, CategoryDescription(InCategoryDescription)
 	, ParentNode(InParentNode)
 	, NetIndex(INVALID_TAGNETINDEX)
+	, BitIndex(INDEX_NONE)
 {
 	TArray<FName> Tags;
 
@@ -763,11 +772,18 @@ FGameplayTagNetIndex FGameplayTagNode::GetNetIndex() const
 	return NetIndex;
 }
 
+int32 FGameplayTagNode::GetBitIndex() const
+{
+	return BitIndex;
+}
+
 void FGameplayTagNode::ResetNode()
 {
 	Tag = NAME_None;
 	CompleteTag = NAME_None;
 	NetIndex = INVALID_TAGNETINDEX;
+	BitIndex = INDEX_NONE;
+	ParentBits.Empty();
 
 	for (int32 ChildIdx = 0; ChildIdx < ChildTags.Num(); ++ChildIdx)
 	{
@@ -29,6 +29,61 @@ bool GameplayTagTest_SimpleTest()
 	return Tag.GetTagName() == TagName;
 }
 
+bool GameplayTagTest_ContainerMatchTest()
+{
+	UGameplayTagsManager& TagManager = IGameplayTagsModule::Get().GetGameplayTagsManager();
+	FGameplayTag ParentTag = TagManager.RequestGameplayTag(FName(TEXT("GameplayTagTest")));
+	FGameplayTag Tag1 = TagManager.RequestGameplayTag(FName(TEXT("GameplayTagTest.Test1")));
+	FGameplayTag Tag2 = TagManager.RequestGameplayTag(FName(TEXT("GameplayTagTest.Test2")));
+
+	FGameplayTagContainer Container(Tag1);
+	FGameplayTagContainer ParentContainer(ParentTag);
+
+	bool bSuccess = true;
+	bSuccess &= Container.HasTag(Tag1, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= !Container.HasTag(ParentTag, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container.HasTag(ParentTag, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::Explicit);
+	bSuccess &= !Container.HasTag(Tag2, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container.HasTag(Tag2, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::IncludeParentTags);
+	bSuccess &= Container.MatchesAll(ParentContainer, false);
+	bSuccess &= !ParentContainer.MatchesAny(Container, false);
+	bSuccess &= Container.Filter(ParentContainer, EGameplayTagMatchType::IncludeParentTags, EGameplayTagMatchType::Explicit).Num() == 1;
+	bSuccess &= Container.Filter(ParentContainer, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit).Num() == 0;
+	bSuccess &= TagManager.GameplayTagsMatch(Tag1, EGameplayTagMatchType::IncludeParentTags, ParentTag, EGameplayTagMatchType::Explicit);
+	bSuccess &= !TagManager.GameplayTagsMatch(Tag1, EGameplayTagMatchType::Explicit, Tag2, EGameplayTagMatchType::IncludeParentTags);
+
+	// matches must follow changes to the container
+	Container.AddTag(Tag2);
+	Container.RemoveTag(Tag1);
+	bSuccess &= Container.HasTag(Tag2, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= !Container.HasTag(Tag1, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= Container.MatchesAny(ParentContainer, false);
+
+	ParentContainer.AppendTags(Container);
+	bSuccess &= ParentContainer.HasTag(Tag2, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+
+	FGameplayTagContainer CopiedContainer = ParentContainer;
+	ParentContainer.RemoveAllTags();
+	bSuccess &= !ParentContainer.HasTag(ParentTag, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= CopiedContainer.MatchesAll(Container, false);
+
+	// the property system (replication, Blueprint, text import) writes the tags without the mutators, a tag replaced
+	// with another keeps the count the same
+	FGameplayTagContainer SwappedContainer(Tag1);
+	bSuccess &= SwappedContainer.HasTag(Tag1, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	UProperty* TagsProperty = FindField<UProperty>(FGameplayTagContainer::StaticStruct(), TEXT("GameplayTags"));
+	TArray<FGameplayTag>* Tags = TagsProperty->ContainerPtrToValuePtr<TArray<FGameplayTag>>(&SwappedContainer);
+	(*Tags)[0] = Tag2;
+	bSuccess &= SwappedContainer.HasTag(Tag2, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= !SwappedContainer.HasTag(Tag1, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= SwappedContainer.Filter(FGameplayTagContainer(Tag1), EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit).Num() == 0;
+	SwappedContainer.AddTag(Tag1);
+	bSuccess &= SwappedContainer.HasTag(Tag1, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+	bSuccess &= SwappedContainer.HasTag(Tag2, EGameplayTagMatchType::Explicit, EGameplayTagMatchType::Explicit);
+
+	return bSuccess;
+}
+
 bool FGameplayTagTest::RunTest(const FString& Parameters)
 {
 #if WITH_EDITOR
@@ -40,6 +95,7 @@ bool FGameplayTagTest::RunTest(const FString& Parameters)
 	// Run Tests
 	bool bSuccess = true;
 	bSuccess &= GameplayTagTest_SimpleTest();
+	bSuccess &= GameplayTagTest_ContainerMatchTest();
 	// Add more tests here... 
 
 	return bSuccess;
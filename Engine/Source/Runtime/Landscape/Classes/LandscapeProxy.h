@@ -234,6 +234,24 @@ struct FCachedLandscapeFoliage
 
 	};
 
+	/** The render data and cluster tree of a discarded grass component, kept so the component can be recreated without rebuilding it */
+	struct FGrassBuiltData
+	{
+		TSharedPtr<FPerInstanceRenderData, ESPMode::ThreadSafe> RenderData;
+		TSharedPtr<TArray<FClusterNode>, ESPMode::ThreadSafe> ClusterTree;
+		int32 NumInstances;
+		uint32 LastUsedFrameNumber;
+
+		FGrassBuiltData()
+			: NumInstances(0)
+			, LastUsedFrameNumber(0)
+		{
+		}
+
+		/** Releases the render data on the rendering thread, unless it was handed to a new component */
+		~FGrassBuiltData();
+	};
+
 	struct FGrassComp
 	{
 		FGrassCompKey Key;
@@ -275,9 +293,51 @@ struct FCachedLandscapeFoliage
 	typedef TSet<FGrassComp, FGrassCompKeyFuncs> TGrassSet;
 	TSet<FGrassComp, FGrassCompKeyFuncs> CachedGrassComps;
 
+	/** Built data of recently discarded grass components, least recently used entries are dropped first */
+	TMap<FGrassCompKey, TSharedPtr<FGrassBuiltData> > EvictedGrass;
+
 	void ClearCache()
 	{
 		CachedGrassComps.Empty();
+		EvictedGrass.Empty();
+	}
+
+	/** Keeps the render data of a discarded prebuilt component, dropping the least recently used entries beyond MaxEntries */
+	void AddEvicted(const FGrassCompKey& Key, UHierarchicalInstancedStaticMeshComponent* Foliage, int32 MaxEntries)
+	{
+		if (MaxEntries <= 0 || !Foliage)
+		{
+			return;
+		}
+		TSharedPtr<FGrassBuiltData> BuiltData = MakeShareable(new FGrassBuiltData);
+		if (!Foliage->GetPrebuiltRenderData(BuiltData->RenderData, BuiltData->ClusterTree, BuiltData->NumInstances))
+		{
+			return;
+		}
+		BuiltData->LastUsedFrameNumber = GFrameNumber;
+		EvictedGrass.Add(Key, BuiltData);
+		while (EvictedGrass.Num() > MaxEntries)
+		{
+			FGrassCompKey OldestKey;
+			uint32 OldestFrameNumber = MAX_uint32;
+			for (const auto& Pair : EvictedGrass)
+			{
+				if (Pair.Value->LastUsedFrameNumber <= OldestFrameNumber)
+				{
+					OldestKey = Pair.Key;
+					OldestFrameNumber = Pair.Value->LastUsedFrameNumber;
+				}
+			}
+			EvictedGrass.Remove(OldestKey);
+		}
+	}
+
+	/** Returns and forgets the built data of a recently discarded component, if we still have it */
+	TSharedPtr<FGrassBuiltData> FindAndRemoveEvicted(const FGrassCompKey& Key)
+	{
+		TSharedPtr<FGrassBuiltData> Result;
+		EvictedGrass.RemoveAndCopyValue(Key, Result);
+		return Result;
 	}
 };
 
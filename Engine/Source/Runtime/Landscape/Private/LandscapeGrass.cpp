@@ -60,6 +60,21 @@ static TAutoConsoleVariable<int32> CVarMaxAsyncTasks(
 	4,
 	TEXT("Used to control the number of hierarchical components created at a time."));
 
+static TAutoConsoleVariable<int32> CVarMaxCreatePerFrame(
+	TEXT("grass.MaxCreatePerFrame"),
+	8,
+	TEXT("Maximum number of grass components created per landscape per frame. Creation also stops once grass.GameThreadBudgetMS is used up."));
+
+static TAutoConsoleVariable<float> CVarGameThreadBudgetMS(
+	TEXT("grass.GameThreadBudgetMS"),
+	1.0f,
+	TEXT("Game thread time, in milliseconds, that all landscapes may spend per frame creating, registering and finishing grass components. At least one component is always processed."));
+
+static TAutoConsoleVariable<int32> CVarEvictedCacheSize(
+	TEXT("grass.EvictedCacheSize"),
+	32,
+	TEXT("Number of recently discarded grass components per landscape whose instance buffers are kept on the GPU, so revisiting an area doesn't rebuild them. 0 disables the cache."));
+
 static TAutoConsoleVariable<int32> CVarGrassEnable(
 	TEXT("grass.Enable"),
 	1,
@@ -90,6 +105,40 @@ DECLARE_CYCLE_STAT(TEXT("Grass Start Comp"), STAT_FoliageGrassStartComp, STATGRO
 DECLARE_CYCLE_STAT(TEXT("Grass End Comp"), STAT_FoliageGrassEndComp, STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Grass Destroy Comps"), STAT_FoliageGrassDestoryComp, STATGROUP_Foliage);
 DECLARE_CYCLE_STAT(TEXT("Grass Update"), STAT_GrassUpdate, STATGROUP_Foliage);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Grass Async Build Time (ms)"), STAT_FoliageGrassBuildTimeMS, STATGROUP_Foliage);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Grass Game Thread Time (ms)"), STAT_FoliageGrassGameThreadTimeMS, STATGROUP_Foliage);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grass Comps Created"), STAT_FoliageGrassCompsCreated, STATGROUP_Foliage);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grass Cache Hits"), STAT_FoliageGrassCacheHits, STATGROUP_Foliage);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grass Cache Misses"), STAT_FoliageGrassCacheMisses, STATGROUP_Foliage);
+
+/** Tracks game thread time spent on grass components this frame, shared by all landscape proxies */
+struct FGrassGameThreadBudget
+{
+	static uint32 FrameNumber;
+	static double SecondsUsed;
+
+	static void BeginFrame()
+	{
+		if (FrameNumber != GFrameNumber)
+		{
+			FrameNumber = GFrameNumber;
+			SecondsUsed = 0.0;
+		}
+	}
+
+	static bool IsExhausted()
+	{
+		return SecondsUsed * 1000.0 >= CVarGameThreadBudgetMS.GetValueOnGameThread();
+	}
+
+	static void Consume(double Seconds)
+	{
+		SecondsUsed += Seconds;
+		INC_FLOAT_STAT_BY(STAT_FoliageGrassGameThreadTimeMS, float(Seconds * 1000.0));
+	}
+};
+uint32 FGrassGameThreadBudget::FrameNumber = 0;
+double FGrassGameThreadBudget::SecondsUsed = 0.0;
 
 //
 // Grass weightmap rendering
@@ -1173,6 +1222,14 @@ void ALandscapeProxy::FlushGrassComponents(const TSet<ULandscapeComponent*>* Onl
 				Iter.RemoveCurrent();
 			}
 		}
+		for (auto Iter = FoliageCache.EvictedGrass.CreateIterator(); Iter; ++Iter)
+		{
+			ULandscapeComponent* Component = Iter.Key().BasedOn.Get();
+			if (Component == nullptr || OnlyForComponents->Contains(Component))
+			{
+				Iter.RemoveCurrent();
+			}
+		}
 #if WITH_EDITOR
 		if (GIsEditor && bFlushGrassMaps)
 		{
@@ -1252,10 +1309,32 @@ int32 ALandscapeProxy::TotalTexturesToStreamForVisibleGrassMapRender = 0;
 int32 ALandscapeProxy::TotalComponentsNeedingTextureBaking = 0;
 #endif
 
+FCachedLandscapeFoliage::FGrassBuiltData::~FGrassBuiltData()
+{
+	if (RenderData.IsValid())
+	{
+		typedef TSharedPtr<FPerInstanceRenderData, ESPMode::ThreadSafe> FPerInstanceRenderDataPtr;
+
+		// same as UInstancedStaticMeshComponent::ReleasePerInstanceRenderData, the buffers must be released on the rendering thread
+		FPerInstanceRenderDataPtr* CleanupRenderDataPtr = new FPerInstanceRenderDataPtr(RenderData);
+		RenderData.Reset();
+
+		ENQUEUE_UNIQUE_RENDER_COMMAND_ONEPARAMETER(
+			FReleaseEvictedGrassRenderData,
+			FPerInstanceRenderDataPtr*, InCleanupRenderDataPtr, CleanupRenderDataPtr,
+		{
+			delete InCleanupRenderDataPtr;
+		});
+	}
+}
+
 void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSync)
 {
 	SCOPE_CYCLE_COUNTER(STAT_GrassUpdate);
 
+	FGrassGameThreadBudget::BeginFrame();
+	const int32 EvictedCacheSize = CVarEvictedCacheSize.GetValueOnGameThread();
+
 	if (CVarGrassEnable.GetValueOnAnyThread() > 0)
 	{
 		TArray<ULandscapeGrassType*> GrassTypes = GetGrassTypes();
@@ -1266,6 +1345,7 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 		bool bDisableGPUCull = CVarDisableGPUCull.GetValueOnAnyThread() > 0;
 		int32 MaxInstancesPerComponent = FMath::Max<int32>(1024, CVarMaxInstancesPerComponent.GetValueOnAnyThread());
 		int32 MaxTasks = CVarMaxAsyncTasks.GetValueOnAnyThread();
+		int32 MaxCreatePerFrame = FMath::Max<int32>(1, CVarMaxCreatePerFrame.GetValueOnGameThread());
 
 		UWorld* World = GetWorld();
 		if (World)
@@ -1427,9 +1507,16 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 											}
 										}
 
-										if (NumCompsCreated || (!bForceSync && AsyncFoliageTasks.Num() >= MaxTasks))
+										if (NumCompsCreated >= MaxCreatePerFrame || (NumCompsCreated && !bForceSync && FGrassGameThreadBudget::IsExhausted()))
+										{
+											continue; // out of budget for this frame, but we still want to touch the existing ones
+										}
+
+										// recently discarded grass can be recreated without an async build
+										const bool bHaveEvictedData = FoliageCache.EvictedGrass.Contains(NewComp.Key);
+										if (!bHaveEvictedData && !bForceSync && AsyncFoliageTasks.Num() >= MaxTasks)
 										{
-											continue; // one per frame, but we still want to touch the existing ones
+											continue;
 										}
 
 #if WITH_EDITOR
@@ -1461,8 +1548,23 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 #endif
 
 										NumCompsCreated++;
+										INC_DWORD_STAT(STAT_FoliageGrassCompsCreated);
 
 										SCOPE_CYCLE_COUNTER(STAT_FoliageGrassStartComp);
+										const double StartCompTime = FPlatformTime::Seconds();
+
+										TSharedPtr<FCachedLandscapeFoliage::FGrassBuiltData> BuiltData;
+										if (bHaveEvictedData)
+										{
+											BuiltData = FoliageCache.FindAndRemoveEvicted(NewComp.Key);
+											NewComp.Pending = false;
+											INC_DWORD_STAT(STAT_FoliageGrassCacheHits);
+										}
+										else
+										{
+											INC_DWORD_STAT(STAT_FoliageGrassCacheMisses);
+										}
+
 										int32 FolSeed = FCrc::StrCrc32((GrassType->GetName() + Component->GetName() + FString::Printf(TEXT("%d %d %d"), SubX, SubY, GrassVarietyIndex)).GetCharArray().GetData());
 										if (FolSeed == 0)
 										{
@@ -1514,29 +1616,41 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 											FoliageComponents.Add(HierarchicalInstancedStaticMeshComponent);
 										}
 
-										FAsyncGrassBuilder* Builder;
-
+										if (BuiltData.IsValid())
 										{
-											QUICK_SCOPE_CYCLE_COUNTER(STAT_GrassCreateBuilder);
-											Builder = new FAsyncGrassBuilder(this, Component, GrassType, GrassVariety, HierarchicalInstancedStaticMeshComponent, SqrtSubsections, SubX, SubY);
+											QUICK_SCOPE_CYCLE_COUNTER(STAT_GrassAcceptCachedData);
+											// the new component takes over the render data of the evicted one, nothing is copied or uploaded again
+											HierarchicalInstancedStaticMeshComponent->AcceptPrebuiltRenderData(BuiltData->RenderData, BuiltData->ClusterTree, BuiltData->NumInstances);
+											BuiltData->RenderData.Reset();
+											BuiltData->ClusterTree.Reset();
 										}
-
-										if (Builder->bHaveValidData)
+										else
 										{
-											FAsyncTask<FAsyncGrassTask>* Task = new FAsyncTask<FAsyncGrassTask>(Builder, NewComp.Key, HierarchicalInstancedStaticMeshComponent);
+											FAsyncGrassBuilder* Builder;
 
-											Task->StartBackgroundTask();
+											{
+												QUICK_SCOPE_CYCLE_COUNTER(STAT_GrassCreateBuilder);
+												Builder = new FAsyncGrassBuilder(this, Component, GrassType, GrassVariety, HierarchicalInstancedStaticMeshComponent, SqrtSubsections, SubX, SubY);
+											}
 
-											AsyncFoliageTasks.Add(Task);
-										}
-										else
-										{
-											delete Builder;
+											if (Builder->bHaveValidData)
+											{
+												FAsyncTask<FAsyncGrassTask>* Task = new FAsyncTask<FAsyncGrassTask>(Builder, NewComp.Key, HierarchicalInstancedStaticMeshComponent);
+
+												Task->StartBackgroundTask();
+
+												AsyncFoliageTasks.Add(Task);
+											}
+											else
+											{
+												delete Builder;
+											}
 										}
 										{
 											QUICK_SCOPE_CYCLE_COUNTER(STAT_GrassRegisterComp);
 											HierarchicalInstancedStaticMeshComponent->RegisterComponent();
 										}
+										FGrassGameThreadBudget::Consume(FPlatformTime::Seconds() - StartCompTime);
 									}
 								}
 							}
@@ -1634,6 +1748,10 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 				);
 			if (bOld)
 			{
+				if (GrassItem.Key.BasedOn.IsValid() && GrassItem.Key.GrassType.IsValid())
+				{
+					FoliageCache.AddEvicted(GrassItem.Key, Used, EvictedCacheSize);
+				}
 				Iter.RemoveCurrent();
 			}
 			else if (Used)
@@ -1644,26 +1762,31 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 	}
 	{
 		// delete components that are no longer used
+		bool bDestroyedAny = false;
 		for (UActorComponent* ActorComponent : GetComponents())
 		{
 			UHierarchicalInstancedStaticMeshComponent* HComponent = Cast<UHierarchicalInstancedStaticMeshComponent>(ActorComponent);
 			if (HComponent && !StillUsed.Contains(HComponent))
 			{
+				if (bDestroyedAny && !bForceSync && FGrassGameThreadBudget::IsExhausted())
+				{
+					break; // at least one per frame, the rest when we have time
+				}
 				{
 					SCOPE_CYCLE_COUNTER(STAT_FoliageGrassDestoryComp);
+					const double StartDestroyTime = FPlatformTime::Seconds();
 					HComponent->ClearInstances();
 					HComponent->DestroyComponent();
 					FoliageComponents.Remove(HComponent);
+					FGrassGameThreadBudget::Consume(FPlatformTime::Seconds() - StartDestroyTime);
 				}
-				if (!bForceSync)
-				{
-					break; // one per frame is fine
-				}
+				bDestroyedAny = true;
 			}
 		}
 	}
 	{
 		// finish async tasks
+		bool bFinishedAny = false;
 		for (int32 Index = 0; Index < AsyncFoliageTasks.Num(); Index++)
 		{
 			FAsyncTask<FAsyncGrassTask>* Task = AsyncFoliageTasks[Index];
@@ -1673,8 +1796,15 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 			}
 			if (Task->IsDone())
 			{
+				if (bFinishedAny && !bForceSync && FGrassGameThreadBudget::IsExhausted())
+				{
+					break; // at least one per frame, the rest when we have time
+				}
+				bFinishedAny = true;
 				SCOPE_CYCLE_COUNTER(STAT_FoliageGrassEndComp);
+				const double StartEndTime = FPlatformTime::Seconds();
 				FAsyncGrassTask& Inner = Task->GetTask();
+				INC_FLOAT_STAT_BY(STAT_FoliageGrassBuildTimeMS, float((Inner.Builder->RasterTime + Inner.Builder->InstanceTime + Inner.Builder->BuildTime) * 1000.0));
 				AsyncFoliageTasks.RemoveAtSwap(Index--);
 				UHierarchicalInstancedStaticMeshComponent* HierarchicalInstancedStaticMeshComponent = Inner.Foliage.Get();
 				if (HierarchicalInstancedStaticMeshComponent && StillUsed.Contains(HierarchicalInstancedStaticMeshComponent))
@@ -1696,10 +1826,7 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 					Existing->Touch();
 				}
 				delete Task;
-				if (!bForceSync)
-				{
-					break; // one per frame is fine
-				}
+				FGrassGameThreadBudget::Consume(FPlatformTime::Seconds() - StartEndTime);
 			}
 		}
 	}
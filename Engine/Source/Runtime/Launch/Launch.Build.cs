@@ -62,6 +62,15 @@ public class Launch : ModuleRules
 				DynamicallyLoadedModuleNames.Add("ALAudio");
 			}
 
+			// Opt-in CPU mixing audio device, see [Audio] AudioDeviceModuleName
+			if ((Target.Platform == UnrealTargetPlatform.Win32) ||
+				(Target.Platform == UnrealTargetPlatform.Win64) ||
+				(Target.Platform == UnrealTargetPlatform.Mac) ||
+				(Target.Platform == UnrealTargetPlatform.Linux))
+			{
+				DynamicallyLoadedModuleNames.Add("SoftwareAudio");
+			}
+
 			PrivateIncludePathModuleNames.AddRange(
                 new string[] {
 			        "SlateRHIRenderer",
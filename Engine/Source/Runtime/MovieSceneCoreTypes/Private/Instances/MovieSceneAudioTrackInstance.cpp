@@ -6,6 +6,7 @@
 #include "SoundDefinitions.h"
 #include "Runtime/Engine/Classes/Kismet/GameplayStatics.h"
 #include "Runtime/Engine/Public/AudioDecompress.h"
+#include "Runtime/Engine/Public/AudioThread.h"
 #include "MovieSceneAudioTrack.h"
 
 FMovieSceneAudioTrackInstance::FMovieSceneAudioTrackInstance( UMovieSceneAudioTrack& InAudioTrack )
@@ -108,9 +109,18 @@ void FMovieSceneAudioTrackInstance::Update( float Position, float LastPosition,
 				UAudioComponent* Component = GetAudioComponent(Actors[ActorIndex], RowIndex);
 				if (Component->IsPlaying())
 				{
-					FActiveSound* ActiveSound = GEngine->GetAudioDevice()->FindActiveSound(Component);
-					ActiveSound->bLocationDefined = true;
-					ActiveSound->Transform = Actors[ActorIndex]->GetTransform();
+					// The active sound belongs to the audio thread, it may not have been added yet
+					FAudioDevice* AudioDevice = GEngine->GetAudioDevice();
+					const FTransform ActorTransform = Actors[ActorIndex]->GetTransform();
+					FAudioThread::RunCommandOnAudioThread([AudioDevice, Component, ActorTransform]()
+					{
+						FActiveSound* ActiveSound = AudioDevice->FindActiveSound(Component);
+						if (ActiveSound)
+						{
+							ActiveSound->bLocationDefined = true;
+							ActiveSound->Transform = ActorTransform;
+						}
+					});
 				}
 			}
 		}
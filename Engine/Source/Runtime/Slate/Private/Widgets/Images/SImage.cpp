@@ -66,19 +66,27 @@ FVector2D SImage::ComputeDesiredSize( float ) const
 	return FVector2D::ZeroVector;
 }
 
+bool SImage::ComputeVolatility() const
+{
+	return SLeafWidget::ComputeVolatility() || Image.IsBound() || ColorAndOpacity.IsBound();
+}
+
 void SImage::SetColorAndOpacity( const TAttribute<FSlateColor>& InColorAndOpacity )
 {
 	ColorAndOpacity = InColorAndOpacity;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SImage::SetColorAndOpacity( FLinearColor InColorAndOpacity )
 {
 	ColorAndOpacity = InColorAndOpacity;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SImage::SetImage(TAttribute<const FSlateBrush*> InImage)
 {
 	Image = InImage;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SImage::SetOnMouseButtonDown(FPointerEventHandler EventHandler)
@@ -337,6 +337,7 @@ FVector2D SButton::ComputeDesiredSize(float LayoutScaleMultiplier) const
 void SButton::SetContentPadding(const TAttribute<FMargin>& InContentPadding)
 {
 	ContentPadding = InContentPadding;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SButton::SetHoveredSound(TOptional<FSlateSound> InHoveredSound)
@@ -365,4 +366,5 @@ void SButton::SetButtonStyle(const FButtonStyle* ButtonStyle)
 
 	BorderPadding = Style->NormalPadding;
 	PressedBorderPadding = Style->PressedPadding;
+	Invalidate(EInvalidateWidget::Layout);
 }
@@ -338,6 +338,7 @@ void SCheckBox::ToggleCheckedState()
 void SCheckBox::SetIsChecked(TAttribute<ECheckBoxState> InIsChecked)
 {
 	IsCheckboxChecked = InIsChecked;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::PlayCheckedSound() const
@@ -358,56 +359,67 @@ void SCheckBox::PlayHoverSound() const
 void SCheckBox::SetContent(const TSharedRef< SWidget >& InContent)
 {
 	ContentContainer->SetContent(InContent);
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SCheckBox::SetStyle(const FCheckBoxStyle* InStyle)
 {
 	Style = InStyle;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SCheckBox::SetUncheckedImage(const FSlateBrush* Brush)
 {
 	UncheckedImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetUncheckedHoveredImage(const FSlateBrush* Brush)
 {
 	UncheckedHoveredImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetUncheckedPressedImage(const FSlateBrush* Brush)
 {
 	UncheckedPressedImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetCheckedImage(const FSlateBrush* Brush)
 {
 	CheckedImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetCheckedHoveredImage(const FSlateBrush* Brush)
 {
 	CheckedHoveredImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetCheckedPressedImage(const FSlateBrush* Brush)
 {
 	CheckedPressedImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetUndeterminedImage(const FSlateBrush* Brush)
 {
 	UndeterminedImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetUndeterminedHoveredImage(const FSlateBrush* Brush)
 {
 	UndeterminedHoveredImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SCheckBox::SetUndeterminedPressedImage(const FSlateBrush* Brush)
 {
 	UndeterminedPressedImage = Brush;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 const FSlateBrush* SCheckBox::GetUncheckedImage() const
@@ -272,11 +272,13 @@ void SMenuAnchor::SetContent(TSharedRef<SWidget> InContent)
 	[
 		InContent
 	];
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SMenuAnchor::SetMenuContent(TSharedRef<SWidget> InMenuContent)
 {
 	MenuContent = InMenuContent;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 EPopupMethod QueryPopupMethod(const FWidgetPath& PathToQuery)
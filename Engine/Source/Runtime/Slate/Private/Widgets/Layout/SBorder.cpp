@@ -51,6 +51,7 @@ void SBorder::SetContent( TSharedRef< SWidget > InContent )
 	[
 		InContent
 	];
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 const TSharedRef< SWidget >& SBorder::GetContent() const
@@ -62,6 +63,7 @@ const TSharedRef< SWidget >& SBorder::GetContent() const
 void SBorder::ClearContent()
 {
 	ChildSlot.DetachWidget();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 int32 SBorder::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
@@ -188,39 +190,55 @@ FVector2D SBorder::ComputeDesiredSize(float LayoutScaleMultiplier) const
 	return DesiredSizeScale.Get() * SCompoundWidget::ComputeDesiredSize(LayoutScaleMultiplier);
 }
 
+bool SBorder::ComputeVolatility() const
+{
+	return SCompoundWidget::ComputeVolatility()
+		|| BorderImage.IsBound()
+		|| BorderBackgroundColor.IsBound()
+		|| DesiredSizeScale.IsBound()
+		|| ShowDisabledEffect.IsBound();
+}
+
 void SBorder::SetBorderBackgroundColor(const TAttribute<FSlateColor>& InColorAndOpacity)
 {
 	BorderBackgroundColor = InColorAndOpacity;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SBorder::SetDesiredSizeScale(const TAttribute<FVector2D>& InDesiredSizeScale)
 {
 	DesiredSizeScale = InDesiredSizeScale;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBorder::SetHAlign(EHorizontalAlignment HAlign)
 {
 	ChildSlot.HAlignment = HAlign;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBorder::SetVAlign(EVerticalAlignment VAlign)
 {
 	ChildSlot.VAlignment = VAlign;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBorder::SetPadding(const TAttribute<FMargin>& InPadding)
 {
 	ChildSlot.SlotPadding = InPadding;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBorder::SetShowEffectWhenDisabled(const TAttribute<bool>& InShowEffectWhenDisabled)
 {
 	ShowDisabledEffect = InShowEffectWhenDisabled;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SBorder::SetBorderImage(const TAttribute<const FSlateBrush*>& InBorderImage)
 {
 	BorderImage = InBorderImage;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SBorder::SetOnMouseButtonDown(FPointerEventHandler EventHandler)
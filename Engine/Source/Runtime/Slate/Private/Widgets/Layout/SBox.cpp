@@ -33,51 +33,61 @@ void SBox::SetContent(const TSharedRef< SWidget >& InContent)
 	[
 		InContent
 	];
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetHAlign(EHorizontalAlignment HAlign)
 {
 	ChildSlot.HAlignment = HAlign;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetVAlign(EVerticalAlignment VAlign)
 {
 	ChildSlot.VAlignment = VAlign;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetPadding(const TAttribute<FMargin>& InPadding)
 {
 	ChildSlot.SlotPadding = InPadding;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetWidthOverride(TAttribute<FOptionalSize> InWidthOverride)
 {
 	WidthOverride = InWidthOverride;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetHeightOverride(TAttribute<FOptionalSize> InHeightOverride)
 {
 	HeightOverride = InHeightOverride;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetMinDesiredWidth(TAttribute<FOptionalSize> InMinDesiredWidth)
 {
 	MinDesiredWidth = InMinDesiredWidth;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetMinDesiredHeight(TAttribute<FOptionalSize> InMinDesiredHeight)
 {
 	MinDesiredHeight = InMinDesiredHeight;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetMaxDesiredWidth(TAttribute<FOptionalSize> InMaxDesiredWidth)
 {
 	MaxDesiredWidth = InMaxDesiredWidth;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SBox::SetMaxDesiredHeight(TAttribute<FOptionalSize> InMaxDesiredHeight)
 {
 	MaxDesiredHeight = InMaxDesiredHeight;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 FVector2D SBox::ComputeDesiredSize( float ) const
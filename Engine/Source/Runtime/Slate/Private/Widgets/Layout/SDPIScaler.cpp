@@ -51,11 +51,13 @@ void SDPIScaler::SetContent(TSharedRef<SWidget> InContent)
 	[
 		InContent
 	];
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SDPIScaler::SetDPIScale(TAttribute<float> InDPIScale)
 {
 	DPIScale = InDPIScale;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 float SDPIScaler::GetRelativeLayoutScale(const FSlotBase& Child) const
@@ -14,6 +14,7 @@ SGridPanel::FSlot& SGridPanel::AddSlot( int32 Column, int32 Row, SGridPanel::Lay
 
 bool SGridPanel::RemoveSlot(const TSharedRef<SWidget>& SlotWidget)
 {
+	Invalidate(EInvalidateWidget::Layout);
 	for ( int32 SlotIdx = 0; SlotIdx < Slots.Num(); ++SlotIdx )
 	{
 		if ( SlotWidget == Slots[SlotIdx].GetWidget() )
@@ -31,6 +32,7 @@ void SGridPanel::ClearChildren()
 	Columns.Empty();
 	Rows.Empty();
 	Slots.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SGridPanel::Construct( const FArguments& InArgs )
@@ -313,6 +315,7 @@ void SGridPanel::DistributeSizeContributions( float SizeContribution, TArray<flo
 
 SGridPanel::FSlot& SGridPanel::InsertSlot( SGridPanel::FSlot* InSlot )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	bool bInserted = false;
 
 	InSlot->Panel = SharedThis(this);
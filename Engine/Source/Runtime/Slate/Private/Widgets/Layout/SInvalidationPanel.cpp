@@ -0,0 +1,128 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "SlatePrivatePCH.h"
+#include "SInvalidationPanel.h"
+#include "LayoutCache.h"
+
+/** Whether invalidation panels cache their content. int32 instead of bool only for console variable system. */
+static TAutoConsoleVariable<int32> EnableInvalidationPanels(
+	TEXT("Slate.EnableInvalidationPanels"),
+	1,
+	TEXT("Whether invalidation panels draw their content from a cache when it did not change, instead of painting it every frame."));
+
+
+SInvalidationPanel::SInvalidationPanel()
+	: LayoutCache( MakeShareable( new FLayoutCache() ) )
+	, CachedLayoutScaleMultiplier( 0.0f )
+	, bCacheContent( true )
+{
+}
+
+void SInvalidationPanel::Construct( const FArguments& InArgs )
+{
+	ChildSlot
+	[
+		InArgs._Content.Widget
+	];
+
+	bCacheContent = InArgs._CacheContent;
+}
+
+void SInvalidationPanel::SetContent( const TSharedRef< SWidget >& InContent )
+{
+	ChildSlot
+	[
+		InContent
+	];
+
+	InvalidateCache();
+}
+
+bool SInvalidationPanel::GetCacheContent() const
+{
+	return bCacheContent;
+}
+
+void SInvalidationPanel::SetCacheContent( bool bInCacheContent )
+{
+	bCacheContent = bInCacheContent;
+	InvalidateCache();
+}
+
+void SInvalidationPanel::InvalidateCache()
+{
+	LayoutCache->Invalidate( EInvalidateWidget::Layout );
+}
+
+bool SInvalidationPanel::IsCaching() const
+{
+	return bCacheContent && EnableInvalidationPanels.GetValueOnGameThread() != 0;
+}
+
+bool SInvalidationPanel::ShouldPrepassChildren() const
+{
+	return !IsCaching() || LayoutCache->NeedsPrepass();
+}
+
+void SInvalidationPanel::CacheDesiredSize( float LayoutScaleMultiplier )
+{
+	if ( !ShouldPrepassChildren() && CachedLayoutScaleMultiplier == LayoutScaleMultiplier && LayoutCache->PrepassVolatileWidgets( LayoutScaleMultiplier ) )
+	{
+		// A volatile widget changed size, the desired sizes of the content have to be computed again before it is recorded
+		InvalidateCache();
+
+		FChildren* MyChildren = GetChildren();
+		for ( int32 ChildIndex = 0; ChildIndex < MyChildren->Num(); ++ChildIndex )
+		{
+			const TSharedRef<SWidget>& Child = MyChildren->GetChildAt( ChildIndex );
+			if ( Child->GetVisibility() != EVisibility::Collapsed )
+			{
+				Child->SlatePrepass( LayoutScaleMultiplier * GetRelativeLayoutScale( MyChildren->GetSlotAt( ChildIndex ) ) );
+			}
+		}
+	}
+
+	if ( ShouldPrepassChildren() )
+	{
+		CachedLayoutScaleMultiplier = LayoutScaleMultiplier;
+		LayoutCache->OnPrepassed();
+	}
+	else if ( CachedLayoutScaleMultiplier != LayoutScaleMultiplier )
+	{
+		// The desired sizes of the content depend on the layout scale, compute them again next frame
+		InvalidateCache();
+	}
+
+	SCompoundWidget::CacheDesiredSize( LayoutScaleMultiplier );
+}
+
+int32 SInvalidationPanel::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
+{
+	// Inside of another panel that is recording, the content gets recorded along with that panel's content.
+	if ( !IsCaching() || Args.GetLayoutCache() != nullptr )
+	{
+		return SCompoundWidget::OnPaint( Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled );
+	}
+
+	// Widgets being interacted with change in ways they don't report, paint them as they are until the interaction is over.
+	if ( IsHovered() || HasFocusedDescendants() )
+	{
+		LayoutCache->Invalidate( EInvalidateWidget::Layout );
+		return SCompoundWidget::OnPaint( Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled );
+	}
+
+	if ( LayoutCache->CanDraw( AllottedGeometry, MyClippingRect ) )
+	{
+		return LayoutCache->Draw( Args, OutDrawElements, LayerId );
+	}
+
+	LayoutCache->BeginCaching( OutDrawElements, AllottedGeometry, MyClippingRect, LayerId );
+	// Volatile widgets are painted in place while recording, but their elements are left out of the recording
+	const int32 MaxLayerId = SCompoundWidget::OnPaint( Args.EnableCaching( &LayoutCache.Get() ), AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled );
+	LayoutCache->EndCaching( OutDrawElements, MaxLayerId );
+
+	// The content may not have been painted, e.g. while collapsed, it still has to record again once it is shown
+	const_cast<SInvalidationPanel*>(this)->SetChildrenLayoutCache( LayoutCache );
+
+	return MaxLayerId;
+}
@@ -97,24 +97,29 @@ void SScaleBox::SetContent(TSharedRef<SWidget> InContent)
 	[
 		InContent
 	];
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SScaleBox::SetHAlign(EHorizontalAlignment HAlign)
 {
 	ChildSlot.HAlignment = HAlign;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SScaleBox::SetVAlign(EVerticalAlignment VAlign)
 {
 	ChildSlot.VAlignment = VAlign;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SScaleBox::SetStretchDirection(EStretchDirection::Type InStretchDirection)
 {
 	StretchDirection = InStretchDirection;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SScaleBox::SetStretch(EStretch::Type InStretch)
 {
 	Stretch = InStretch;
+	Invalidate(EInvalidateWidget::Layout);
 }
@@ -314,6 +314,7 @@ void SScrollBox::ConstructHorizontalLayout()
 /** Adds a slot to SScrollBox */
 SScrollBox::FSlot& SScrollBox::AddSlot()
 {
+	Invalidate(EInvalidateWidget::Layout);
 	SScrollBox::FSlot& NewSlot = *new SScrollBox::FSlot();
 	ScrollPanel->Children.Add( &NewSlot );
 
@@ -323,6 +324,7 @@ SScrollBox::FSlot& SScrollBox::AddSlot()
 /** Removes a slot at the specified location */
 void SScrollBox::RemoveSlot( const TSharedRef<SWidget>& WidgetToRemove )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	TPanelChildren<SScrollBox::FSlot>& Children = ScrollPanel->Children;
 	for( int32 SlotIndex=0; SlotIndex < Children.Num(); ++SlotIndex )
 	{
@@ -337,6 +339,7 @@ void SScrollBox::RemoveSlot( const TSharedRef<SWidget>& WidgetToRemove )
 void SScrollBox::ClearChildren()
 {
 	ScrollPanel->Children.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 bool SScrollBox::IsRightClickScrolling() const
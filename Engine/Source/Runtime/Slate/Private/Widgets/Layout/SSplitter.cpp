@@ -14,6 +14,7 @@ SSplitter::FSlot& SSplitter::Slot()
 
 SSplitter::FSlot& SSplitter::AddSlot( int32 AtIndex )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	FSlot& NewSlot = *new FSlot();
 	if ( AtIndex == INDEX_NONE )
 	{
@@ -108,6 +108,7 @@ void SUniformGridPanel::SetMinDesiredSlotHeight(TAttribute<float> InMinDesiredSl
 
 SUniformGridPanel::FSlot& SUniformGridPanel::AddSlot( int32 Column, int32 Row )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	FSlot& NewSlot = *(new FSlot( Column, Row ));
 
 	Children.Add( &NewSlot );
@@ -117,6 +118,7 @@ SUniformGridPanel::FSlot& SUniformGridPanel::AddSlot( int32 Column, int32 Row )
 
 bool SUniformGridPanel::RemoveSlot( const TSharedRef<SWidget>& SlotWidget )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	for (int32 SlotIdx = 0; SlotIdx < Children.Num(); ++SlotIdx)
 	{
 		if ( SlotWidget == Children[SlotIdx].GetWidget() )
@@ -134,4 +136,5 @@ void SUniformGridPanel::ClearChildren()
 	NumColumns = 0;
 	NumRows = 0;
 	Children.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
\ No newline at end of file
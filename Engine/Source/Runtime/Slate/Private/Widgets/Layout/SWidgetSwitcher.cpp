@@ -21,6 +21,7 @@ SWidgetSwitcher::SWidgetSwitcher()
 
 SWidgetSwitcher::FSlot& SWidgetSwitcher::AddSlot( int32 SlotIndex )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	FSlot* NewSlot = new FSlot();
 
 	if (!AllChildren.IsValidIndex(SlotIndex))
@@ -90,6 +91,7 @@ int32 SWidgetSwitcher::GetWidgetIndex( TSharedRef<SWidget> Widget ) const
 
 int32 SWidgetSwitcher::RemoveSlot( TSharedRef<SWidget> WidgetToRemove )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	for (int32 SlotIndex=0; SlotIndex < AllChildren.Num(); ++SlotIndex)
 	{
 		if (AllChildren[SlotIndex].GetWidget() == WidgetToRemove)
@@ -106,6 +108,7 @@ int32 SWidgetSwitcher::RemoveSlot( TSharedRef<SWidget> WidgetToRemove )
 void SWidgetSwitcher::SetActiveWidgetIndex( int32 Index )
 {
 	WidgetIndex = Index;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 
@@ -131,3 +134,9 @@ FChildren* SWidgetSwitcher::GetChildren( )
 {
 	return &OneDynamicChild;
 }
+
+
+bool SWidgetSwitcher::ComputeVolatility( ) const
+{
+	return SCompoundWidget::ComputeVolatility() || WidgetIndex.IsBound();
+}
@@ -15,6 +15,7 @@ SWrapBox::FSlot& SWrapBox::Slot()
 
 SWrapBox::FSlot& SWrapBox::AddSlot()
 {
+	Invalidate(EInvalidateWidget::Layout);
 	SWrapBox::FSlot* NewSlot = new SWrapBox::FSlot();
 	Slots.Add(NewSlot);
 	return *NewSlot;
@@ -22,6 +23,7 @@ SWrapBox::FSlot& SWrapBox::AddSlot()
 
 int32 SWrapBox::RemoveSlot( const TSharedRef<SWidget>& SlotWidget )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	for (int32 SlotIdx = 0; SlotIdx < Slots.Num(); ++SlotIdx)
 	{
 		if ( SlotWidget == Slots[SlotIdx].GetWidget() )
@@ -170,6 +172,7 @@ void SWrapBox::OnArrangeChildren( const FGeometry& AllottedGeometry, FArrangedCh
 void SWrapBox::ClearChildren()
 {
 	Slots.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 FVector2D SWrapBox::ComputeDesiredSize( float ) const
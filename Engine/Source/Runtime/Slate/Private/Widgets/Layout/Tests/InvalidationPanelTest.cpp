@@ -0,0 +1,139 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "SlatePrivatePCH.h"
+#include "AutomationTest.h"
+#include "SInvalidationPanel.h"
+#include "HittestGrid.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInvalidationPanelTest, "Slate.InvalidationPanel.Caching", EAutomationTestFlags::ATF_Editor)
+
+namespace InvalidationPanelTest
+{
+	/** Prepasses and paints the panel the way a window would for one frame, returns the number of elements it added. */
+	int32 PaintFrame( const TSharedRef<SInvalidationPanel>& Panel )
+	{
+		const FVector2D PanelSize( 400.f, 400.f );
+		const FSlateRect ClippingRect( FVector2D::ZeroVector, PanelSize );
+
+		FHittestGrid HittestGrid;
+		HittestGrid.ClearGridForNewFrame( ClippingRect );
+		FSlateWindowElementList DrawElements;
+
+		Panel->SlatePrepass( 1.0f );
+		const FPaintArgs Args( Panel, HittestGrid, FVector2D::ZeroVector, FPlatformTime::Seconds(), 0.0f );
+		Panel->Paint( Args, FGeometry::MakeRoot( PanelSize, FSlateLayoutTransform() ), ClippingRect, DrawElements, 0, FWidgetStyle(), true );
+
+		return DrawElements.GetDrawElements().Num();
+	}
+}
+
+/**
+ * Paints an invalidation panel holding a static and a volatile image over several frames.
+ * The volatile image must be painted exactly once a frame, and changing the content must record it again.
+ * Showing a child that was collapsed while recording, and a volatile text growing, must record it again as well.
+ */
+bool FInvalidationPanelTest::RunTest( const FString& Parameters )
+{
+	using namespace InvalidationPanelTest;
+
+	const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush( "WhiteBrush" );
+
+	int32 NumVolatilePaints = 0;
+	TAttribute<FSlateColor> VolatileColor = TAttribute<FSlateColor>::Create( TAttribute<FSlateColor>::FGetter::CreateLambda( [&NumVolatilePaints]()
+	{
+		++NumVolatilePaints;
+		return FSlateColor( FLinearColor::White );
+	} ) );
+
+	TSharedRef<SImage> StaticImage = SNew( SImage ).Image( WhiteBrush );
+	TSharedRef<SVerticalBox> Box = SNew( SVerticalBox )
+		+ SVerticalBox::Slot().AutoHeight()
+		[
+			StaticImage
+		]
+		+ SVerticalBox::Slot().AutoHeight()
+		[
+			SNew( SImage ).Image( WhiteBrush ).ColorAndOpacity( VolatileColor )
+		];
+
+	TSharedRef<SInvalidationPanel> Panel = SNew( SInvalidationPanel )
+	[
+		Box
+	];
+
+	// Recording frame: everything is painted once
+	const int32 NumRecordedElements = PaintFrame( Panel );
+	TestEqual( TEXT("Elements of the recording frame"), NumRecordedElements, 2 );
+	TestEqual( TEXT("Volatile paints in the recording frame"), NumVolatilePaints, 1 );
+
+	// Cached frame: the recording is drawn and the volatile image painted again
+	NumVolatilePaints = 0;
+	TestEqual( TEXT("Elements of a cached frame"), PaintFrame( Panel ), NumRecordedElements );
+	TestEqual( TEXT("Volatile paints in a cached frame"), NumVolatilePaints, 1 );
+
+	// Adding a slot has to record the content again
+	Box->AddSlot().AutoHeight()
+	[
+		SNew( SImage ).Image( WhiteBrush )
+	];
+	TestEqual( TEXT("Elements after adding a slot"), PaintFrame( Panel ), NumRecordedElements + 1 );
+
+	Box->RemoveSlot( StaticImage );
+	TestEqual( TEXT("Elements after removing a slot"), PaintFrame( Panel ), NumRecordedElements );
+
+	// Style changes of recorded widgets invalidate the recording as well
+	Box->SetVisibility( EVisibility::Collapsed );
+	TestEqual( TEXT("Elements after collapsing the content"), PaintFrame( Panel ), 0 );
+	TestEqual( TEXT("Elements of a cached frame with collapsed content"), PaintFrame( Panel ), 0 );
+	Box->SetVisibility( EVisibility::Visible );
+	TestEqual( TEXT("Elements after showing the content again"), PaintFrame( Panel ), NumRecordedElements );
+
+	Panel->SetContent( SNew( SImage ).Image( WhiteBrush ) );
+	NumVolatilePaints = 0;
+	TestEqual( TEXT("Elements after setting the content"), PaintFrame( Panel ), 1 );
+	TestEqual( TEXT("Volatile paints once the volatile image is gone"), NumVolatilePaints, 0 );
+
+	// Without caching the panel paints like any other panel
+	Panel->SetCacheContent( false );
+	TestEqual( TEXT("Elements without caching"), PaintFrame( Panel ), 1 );
+
+	// A child collapsed while the content is recorded was never painted, showing it still has to record the content again
+	Panel->SetCacheContent( true );
+	TSharedRef<SImage> CollapsedImage = SNew( SImage ).Image( WhiteBrush ).Visibility( EVisibility::Collapsed );
+	Panel->SetContent( SNew( SVerticalBox )
+		+ SVerticalBox::Slot().AutoHeight()
+		[
+			SNew( SImage ).Image( WhiteBrush )
+		]
+		+ SVerticalBox::Slot().AutoHeight()
+		[
+			CollapsedImage
+		] );
+	TestEqual( TEXT("Elements with a collapsed child"), PaintFrame( Panel ), 1 );
+	TestEqual( TEXT("Elements of a cached frame with a collapsed child"), PaintFrame( Panel ), 1 );
+	CollapsedImage->SetVisibility( EVisibility::Visible );
+	TestEqual( TEXT("Elements after showing the collapsed child"), PaintFrame( Panel ), 2 );
+
+	// Volatile widgets are drawn with their recorded geometry, growing one has to arrange the content again
+	FString BoundText = TEXT("Short");
+	TAttribute<FText> VolatileText = TAttribute<FText>::Create( TAttribute<FText>::FGetter::CreateLambda( [&BoundText]()
+	{
+		return FText::FromString( BoundText );
+	} ) );
+	TSharedRef<SHorizontalBox> TextBox = SNew( SHorizontalBox )
+		+ SHorizontalBox::Slot().AutoWidth()
+		[
+			SNew( STextBlock ).Text( VolatileText )
+		];
+	Panel->SetContent( TextBox );
+	PaintFrame( Panel );
+	const float ShortWidth = TextBox->GetDesiredSize().X;
+	PaintFrame( Panel );
+	TestEqual( TEXT("Width of the content while the text stays the same"), TextBox->GetDesiredSize().X, ShortWidth );
+
+	BoundText = TEXT("A much longer text than before");
+	PaintFrame( Panel );
+	TestTrue( TEXT("Width of the content after the volatile text grew"), TextBox->GetDesiredSize().X > ShortWidth );
+
+	return true;
+}
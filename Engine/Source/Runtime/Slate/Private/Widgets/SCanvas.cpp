@@ -28,11 +28,13 @@ void SCanvas::Construct( const SCanvas::FArguments& InArgs )
 void SCanvas::ClearChildren( )
 {
 	Children.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 
 int32 SCanvas::RemoveSlot( const TSharedRef<SWidget>& SlotWidget )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	for (int32 SlotIdx = 0; SlotIdx < Children.Num(); ++SlotIdx)
 	{
 		if (SlotWidget == Children[SlotIdx].GetWidget())
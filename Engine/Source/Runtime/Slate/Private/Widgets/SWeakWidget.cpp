@@ -77,6 +77,7 @@ int32 SWeakWidget::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeo
 void SWeakWidget::SetContent(const TSharedRef<SWidget>& InWidget)
 {
 	WeakChild.AttachWidget( InWidget );
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 
@@ -76,21 +76,25 @@ void STextBlock::SetText( const TAttribute< FString >& InText )
 	};
 
 	BoundText = TAttribute< FText >::Create(TAttribute<FText>::FGetter::CreateStatic( &Local::PassThroughAttribute, InText) );
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetText( const FString& InText )
 {
 	BoundText = FText::FromString( InText );
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetText( const TAttribute< FText >& InText )
 {
 	BoundText = InText;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetText( const FText& InText )
 {
 	BoundText = InText;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 int32 STextBlock::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const
@@ -186,59 +190,87 @@ FVector2D STextBlock::ComputeDesiredSize(float LayoutScaleMultiplier) const
 	return FVector2D(FMath::Max(MinDesiredWidth.Get(0.0f), TextSize.X), TextSize.Y);
 }
 
+bool STextBlock::ComputeVolatility() const
+{
+	return SLeafWidget::ComputeVolatility()
+		|| BoundText.IsBound()
+		|| Font.IsBound()
+		|| ColorAndOpacity.IsBound()
+		|| ShadowOffset.IsBound()
+		|| ShadowColorAndOpacity.IsBound()
+		|| HighlightText.IsBound()
+		|| WrapTextAt.IsBound()
+		|| AutoWrapText.IsBound()
+		|| Margin.IsBound()
+		|| Justification.IsBound()
+		|| LineHeightPercentage.IsBound()
+		|| MinDesiredWidth.IsBound();
+}
+
 void STextBlock::SetFont(const TAttribute< FSlateFontInfo >& InFont)
 {
 	Font = InFont;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetColorAndOpacity(const TAttribute<FSlateColor>& InColorAndOpacity)
 {
 	ColorAndOpacity = InColorAndOpacity;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void STextBlock::SetTextStyle(const FTextBlockStyle* InTextStyle)
 {
 	TextStyle = InTextStyle;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetWrapTextAt(const TAttribute<float>& InWrapTextAt)
 {
 	WrapTextAt = InWrapTextAt;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetAutoWrapText(const TAttribute<bool>& InAutoWrapText)
 {
 	AutoWrapText = InAutoWrapText;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetShadowOffset(const TAttribute<FVector2D>& InShadowOffset)
 {
 	ShadowOffset = InShadowOffset;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void STextBlock::SetShadowColorAndOpacity(const TAttribute<FLinearColor>& InShadowColorAndOpacity)
 {
 	ShadowColorAndOpacity = InShadowColorAndOpacity;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void STextBlock::SetMinDesiredWidth(const TAttribute<float>& InMinDesiredWidth)
 {
 	MinDesiredWidth = InMinDesiredWidth;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetLineHeightPercentage(const TAttribute<float>& InLineHeightPercentage)
 {
 	LineHeightPercentage = InLineHeightPercentage;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetMargin(const TAttribute<FMargin>& InMargin)
 {
 	Margin = InMargin;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void STextBlock::SetJustification(const TAttribute<ETextJustify::Type>& InJustification)
 {
 	Justification = InJustification;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 FTextBlockStyle STextBlock::GetComputedTextStyle() const
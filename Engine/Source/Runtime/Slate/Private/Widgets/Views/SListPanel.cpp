@@ -46,6 +46,7 @@ SListPanel::FSlot& SListPanel::AddSlot(int32 InsertAtIndex)
 	{
 		this->Children.Insert( &NewSlot, InsertAtIndex );
 	}
+	Invalidate(EInvalidateWidget::Layout);
 	
 	return NewSlot;
 }
@@ -206,18 +207,27 @@ FChildren* SListPanel::GetChildren()
 /** Set the offset of the view area from the top of the list. */
 void SListPanel::SmoothScrollOffset(float InOffsetInItems)
 {
-	SmoothScrollOffsetInItems = InOffsetInItems;
+	if ( SmoothScrollOffsetInItems != InOffsetInItems )
+	{
+		SmoothScrollOffsetInItems = InOffsetInItems;
+		Invalidate(EInvalidateWidget::Paint);
+	}
 }
 
 void SListPanel::SetOverscrollAmount( float InOverscrollAmount )
 {
-	OverscrollAmount = InOverscrollAmount;
+	if ( OverscrollAmount != InOverscrollAmount )
+	{
+		OverscrollAmount = InOverscrollAmount;
+		Invalidate(EInvalidateWidget::Paint);
+	}
 }
 
 /** Remove all the children from this panel */
 void SListPanel::ClearItems()
 {
 	Children.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 float SListPanel::GetDesiredItemWidth() const
@@ -315,9 +325,11 @@ bool SListPanel::ShouldArrangeHorizontally() const
 void SListPanel::SetItemHeight(TAttribute<float> Height)
 {
 	ItemHeight = Height;
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 void SListPanel::SetItemWidth(TAttribute<float> Width)
 {
 	ItemWidth = Width;
+	Invalidate(EInvalidateWidget::Layout);
 }
@@ -562,6 +562,7 @@ void STableViewBase::RequestListRefresh()
 		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &STableViewBase::EnsureTickToRefresh));
 	}
 	ItemsPanel->SetRefreshPending(true);
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 bool STableViewBase::IsPendingRefresh() const
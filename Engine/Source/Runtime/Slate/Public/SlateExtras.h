@@ -48,6 +48,7 @@
 #include "SVirtualKeyboardEntry.h"
 #include "ScrollyZoomy.h"
 #include "SSafeZone.h"
+#include "SInvalidationPanel.h"
 #include "MarqueeRect.h"
 #include "SRotatorInputBox.h"
 #include "SVectorInputBox.h"
@@ -0,0 +1,68 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * An InvalidationPanel records what its content paints into an FLayoutCache and draws the recording every frame instead
+ * of painting the content, until something in the content invalidates it (see SWidget::Invalidate()). The desired sizes
+ * of the content are only computed again when it is invalidated for layout.
+ *
+ * Volatile widgets of the content (see SWidget::IsVolatile()) are painted every frame.
+ * While the content is hovered or has focus, it is painted every frame as well, since interacting with widgets changes
+ * them in ways they don't report. Use it around content that is mostly static, like HUD elements or panels that are
+ * not being edited.
+ */
+class SLATE_API SInvalidationPanel : public SCompoundWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SInvalidationPanel)
+		: _CacheContent(true)
+	{
+		_Visibility = EVisibility::SelfHitTestInvisible;
+	}
+		SLATE_DEFAULT_SLOT(FArguments, Content)
+
+		/** Whether to cache the content. When false the panel paints its content every frame like any other panel. */
+		SLATE_ARGUMENT(bool, CacheContent)
+	SLATE_END_ARGS()
+
+	SInvalidationPanel();
+
+	void Construct( const FArguments& InArgs );
+
+	/**
+	 * See the Content slot.
+	 */
+	void SetContent( const TSharedRef< SWidget >& InContent );
+
+	/** @return true if the content is cached */
+	bool GetCacheContent() const;
+
+	/** Sets whether the content is cached */
+	void SetCacheContent( bool bInCacheContent );
+
+	/** Records the content again the next time it is painted. */
+	void InvalidateCache();
+
+protected:
+
+	// SWidget interface
+	virtual bool ShouldPrepassChildren() const override;
+	virtual void CacheDesiredSize( float LayoutScaleMultiplier ) override;
+	virtual int32 OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const override;
+	// End of SWidget interface
+
+private:
+
+	/** @return true if the content should be drawn from the cache, when it is up to date */
+	bool IsCaching() const;
+
+	/** The recording of the content */
+	TSharedRef<FLayoutCache> LayoutCache;
+
+	/** Layout scale the desired sizes of the content were last computed with */
+	float CachedLayoutScaleMultiplier;
+
+	bool bCacheContent;
+};
@@ -115,6 +115,8 @@ public:
 	 */
 	FSlot& AddSlot()
 	{
+		Invalidate(EInvalidateWidget::Layout);
+
 		SCanvas::FSlot& NewSlot = *new FSlot();
 		this->Children.Add( &NewSlot );
 		return NewSlot;
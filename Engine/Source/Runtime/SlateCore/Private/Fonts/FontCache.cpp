@@ -5,6 +5,7 @@
 
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num Font Atlases"), STAT_SlateNumFontAtlases, STATGROUP_SlateMemory);
 DECLARE_MEMORY_STAT(TEXT("Font Kerning Table Memory"), STAT_SlateFontKerningTableMemory, STATGROUP_SlateMemory);
+DECLARE_MEMORY_STAT(TEXT("Font Character List Memory"), STAT_SlateFontCharacterListMemory, STATGROUP_SlateMemory);
 DEFINE_STAT(STAT_SlateFontMeasureCacheMemory);
 
 #ifndef WITH_FREETYPE
@@ -33,9 +34,18 @@ namespace FontCacheConstants
 	/** The vertical dpi we render at */
 	const uint32 VerticalDPI = 96;
 
-	/** Number of characters that can be indexed directly in the cache */
+	/** Number of characters that can be indexed directly in the kerning table */
 	const int32 DirectAccessSize = 256;
 
+	/** Number of characters in each page of directly indexed characters */
+	const int32 DirectIndexPageSize = 128;
+
+	/** Number of pages needed to directly index every character of the basic multilingual plane, characters past it are always mapped */
+	const int32 MaxDirectIndexPageIndex = 0x10000 / DirectIndexPageSize;
+
+	/** Number of pages of directly indexed characters that can be allocated per character list */
+	const int32 MaxDirectIndexPages = 32;
+
 	/** Number of possible elements in each measurement cache */
 	const uint32 MeasureCacheSize = 500;
 }
@@ -935,11 +945,11 @@ void FKerningTable::CreateDirectTable()
 }
 
 FCharacterList::FCharacterList( const FSlateFontKey& InFontKey, const FSlateFontCache& InFontCache )
-	: KerningTable( InFontCache )
+	: NumDirectIndexPages( 0 )
+	, KerningTable( InFontCache )
 	, FontKey( InFontKey )
 	, FontCache( InFontCache )
 	, CompositeFontHistoryRevision( 0 )
-	, MaxDirectIndexedEntries( FontCacheConstants::DirectAccessSize )
 	, MaxHeight( 0 )
 	, Baseline( 0 )
 {
@@ -950,6 +960,17 @@ FCharacterList::FCharacterList( const FSlateFontKey& InFontKey, const FSlateFont
 	}
 }
 
+FCharacterList::~FCharacterList()
+{
+	DEC_MEMORY_STAT_BY( STAT_SlateFontCharacterListMemory, NumDirectIndexPages*FontCacheConstants::DirectIndexPageSize*sizeof(FCharacterEntry) );
+}
+
+bool FCharacterList::IsValidIndex( TCHAR Character ) const
+{
+	const FCharacterEntry* DirectEntry = FindDirectEntry( Character );
+	return ( DirectEntry && DirectEntry->IsValidEntry() ) || MappedEntries.Contains( Character );
+}
+
 bool FCharacterList::IsStale() const
 {
 	const FCompositeFont* const CompositeFont = FontKey.GetFontInfo().GetCompositeFont();
@@ -1005,26 +1026,17 @@ int16 FCharacterList::GetBaseline() const
 
 const FCharacterEntry& FCharacterList::GetCharacter( TCHAR Character )
 {
-	if( Character < MaxDirectIndexedEntries )
+	FCharacterEntry* DirectEntry = FindOrAddDirectEntry( Character );
+	if( DirectEntry )
 	{
 		// The character can be indexed directly
-
-		int32 NumToAdd = (Character - DirectIndexEntries.Num()) + 1;
-		if( NumToAdd > 0 )
-		{
-			// The character doesn't exist yet in the index and there is not enough space
-			// Resize the array now
-			DirectIndexEntries.AddZeroed( NumToAdd );
-		}
-			
-		FCharacterEntry& CharacterEntry = DirectIndexEntries[ Character ];
-		if( !CharacterEntry.IsValidEntry() )
+		if( !DirectEntry->IsValidEntry() )
 		{
 			// Character has not been cached yet
-			CharacterEntry = CacheCharacter( Character );
+			*DirectEntry = CacheCharacter( Character );
 		}
 
-		return CharacterEntry;
+		return *DirectEntry;
 	}
 	else
 	{
@@ -1046,10 +1058,11 @@ FCharacterEntry& FCharacterList::CacheCharacter( TCHAR Character )
 
 	check( bSuccess );
 
-	if( Character < MaxDirectIndexedEntries && NewEntry.IsValidEntry() )
+	FCharacterEntry* DirectEntry = NewEntry.IsValidEntry() ? FindOrAddDirectEntry( Character ) : nullptr;
+	if( DirectEntry )
 	{
-		DirectIndexEntries[ Character ] = NewEntry;
-		return DirectIndexEntries[ Character ];
+		*DirectEntry = NewEntry;
+		return *DirectEntry;
 	}
 	else
 	{
@@ -1057,6 +1070,49 @@ FCharacterEntry& FCharacterList::CacheCharacter( TCHAR Character )
 	}
 }
 
+FCharacterEntry* FCharacterList::FindOrAddDirectEntry( TCHAR Character )
+{
+	const uint32 CharacterIndex = (uint32)Character;
+	const int32 PageIndex = CharacterIndex / FontCacheConstants::DirectIndexPageSize;
+	if( PageIndex >= FontCacheConstants::MaxDirectIndexPageIndex )
+	{
+		return nullptr;
+	}
+
+	if( !DirectIndexPages.IsValidIndex( PageIndex ) || DirectIndexPages[PageIndex].Num() == 0 )
+	{
+		if( NumDirectIndexPages >= FontCacheConstants::MaxDirectIndexPages )
+		{
+			// Out of pages, the character will be mapped
+			return nullptr;
+		}
+
+		if( PageIndex >= DirectIndexPages.Num() )
+		{
+			DirectIndexPages.AddZeroed( PageIndex - DirectIndexPages.Num() + 1 );
+		}
+
+		// Pages are never resized once allocated so references to their entries stay valid when other characters are cached
+		DirectIndexPages[PageIndex].AddZeroed( FontCacheConstants::DirectIndexPageSize );
+		++NumDirectIndexPages;
+		INC_MEMORY_STAT_BY( STAT_SlateFontCharacterListMemory, FontCacheConstants::DirectIndexPageSize*sizeof(FCharacterEntry) );
+	}
+
+	return &DirectIndexPages[PageIndex][ CharacterIndex % FontCacheConstants::DirectIndexPageSize ];
+}
+
+const FCharacterEntry* FCharacterList::FindDirectEntry( TCHAR Character ) const
+{
+	const uint32 CharacterIndex = (uint32)Character;
+	const int32 PageIndex = CharacterIndex / FontCacheConstants::DirectIndexPageSize;
+	if( DirectIndexPages.IsValidIndex( PageIndex ) && DirectIndexPages[PageIndex].Num() > 0 )
+	{
+		return &DirectIndexPages[PageIndex][ CharacterIndex % FontCacheConstants::DirectIndexPageSize ];
+	}
+
+	return nullptr;
+}
+
 FSlateFontCache::FSlateFontCache( TSharedRef<ISlateFontAtlasFactory> InFontAtlasFactory )
 	: FTInterface( new FFreeTypeInterface )
 	, FontAtlasFactory( InFontAtlasFactory )
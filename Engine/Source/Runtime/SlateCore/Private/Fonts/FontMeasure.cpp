@@ -11,12 +11,19 @@ namespace FontMeasureConstants
 {
 	/** Number of possible elements in each measurement cache */
 	const uint32 MeasureCacheSize = 500;
+
+	/** Number of possible elements in each cache of ranges measured along with the kerning of their preceding character */
+	const uint32 RangeMeasureCacheSize = 1000;
+
+	/** Strings and ranges shorter than this are measured faster than they are looked up */
+	const int32 MinCachedMeasureLength = 6;
 }
 
 struct FSlateFontMeasureCache
 {
 	FSlateFontMeasureCache( const FCompositeFont* const InCompositeFont )
 		: MeasureCache( FontMeasureConstants::MeasureCacheSize )
+		, RangeMeasureCache( FontMeasureConstants::RangeMeasureCacheSize )
 		, CompositeFontHistoryRevision( 0 )
 	{
 		if( InCompositeFont )
@@ -31,9 +38,15 @@ struct FSlateFontMeasureCache
 		return !InCompositeFont || CompositeFontHistoryRevision != InCompositeFont->HistoryRevision;
 	}
 
-	/** Internal measure cache */
+	/** Internal measure cache, for strings and for ranges measured without the kerning of their preceding character */
 	FMeasureCache MeasureCache;
 
+	/**
+	 * Measure cache for ranges measured along with the kerning of their preceding character, as text layouts measure their runs.
+	 * Keyed by the range including the preceding character.
+	 */
+	FMeasureCache RangeMeasureCache;
+
 	/** The history revision of the cached composite font */
 	int32 CompositeFontHistoryRevision;
 };
@@ -146,14 +159,34 @@ FVector2D FSlateFontMeasure::MeasureStringInternal( const FString& Text, int32 S
 
 #if USE_MEASURE_CACHING
 	FMeasureCache* CurrentMeasureCache = nullptr;
+	FString MeasureCacheRangeKey;
+	const FString* MeasureCacheKey = &Text;
 	// Do not cache strings which have small sizes or which have complicated measure requirements
-	if( DoesStartAtBeginning && DoesFinishAtEnd && !IncludeKerningWithPrecedingChar && TextRangeLength > 5 && StopAfterHorizontalOffset == INDEX_NONE )
+	if( TextRangeLength >= FontMeasureConstants::MinCachedMeasureLength && StopAfterHorizontalOffset == INDEX_NONE )
 	{
-		CurrentMeasureCache = FindOrAddMeasureCache(InFontInfo, FontScale);
+		FSlateFontMeasureCache* FontMeasureCache = FindOrAddMeasureCache(InFontInfo, FontScale);
 
-		if ( CurrentMeasureCache )
+		if ( FontMeasureCache )
 		{
-			const FVector2D* CachedMeasurement = CurrentMeasureCache->AccessItem( Text );
+			// The size of a range only depends on its characters, and on the character preceding it when its kerning is included,
+			// so the same words measured by different text layouts share their entries
+			if( !DoesStartAtBeginning && IncludeKerningWithPrecedingChar )
+			{
+				CurrentMeasureCache = &FontMeasureCache->RangeMeasureCache;
+				MeasureCacheRangeKey = Text.Mid( StartIndex - 1, TextRangeLength + 1 );
+				MeasureCacheKey = &MeasureCacheRangeKey;
+			}
+			else
+			{
+				CurrentMeasureCache = &FontMeasureCache->MeasureCache;
+				if( !DoesStartAtBeginning || !DoesFinishAtEnd )
+				{
+					MeasureCacheRangeKey = Text.Mid( StartIndex, TextRangeLength );
+					MeasureCacheKey = &MeasureCacheRangeKey;
+				}
+			}
+
+			const FVector2D* CachedMeasurement = CurrentMeasureCache->AccessItem( *MeasureCacheKey );
 			if( CachedMeasurement )
 			{
 				return *CachedMeasurement;
@@ -267,13 +300,13 @@ FVector2D FSlateFontMeasure::MeasureStringInternal( const FString& Text, int32 S
 #if USE_MEASURE_CACHING
 	if( StopAfterHorizontalOffset == INDEX_NONE && CurrentMeasureCache )
 	{
-		CurrentMeasureCache->Add( Text, Size );
+		CurrentMeasureCache->Add( *MeasureCacheKey, Size );
 	}
 #endif
 	return Size;
 }
 
-FMeasureCache* FSlateFontMeasure::FindOrAddMeasureCache( const FSlateFontInfo& InFontInfo, const float InFontScale ) const
+FSlateFontMeasureCache* FSlateFontMeasure::FindOrAddMeasureCache( const FSlateFontInfo& InFontInfo, const float InFontScale ) const
 {
 #if USE_MEASURE_CACHING
 	FSlateFontKey FontKey(InFontInfo, InFontScale);
@@ -290,13 +323,13 @@ FMeasureCache* FSlateFontMeasure::FindOrAddMeasureCache( const FSlateFontInfo& I
 		}
 		else
 		{
-			return &FoundMeasureCache->MeasureCache;
+			return FoundMeasureCache.Get();
 		}
 	}
 	
 	FoundMeasureCache = MakeShareable( new FSlateFontMeasureCache( CompositeFont ) );
 	FontToMeasureCache.Add( FontKey, FoundMeasureCache );
-	return &FoundMeasureCache->MeasureCache;
+	return FoundMeasureCache.Get();
 #endif
 
 	return nullptr;
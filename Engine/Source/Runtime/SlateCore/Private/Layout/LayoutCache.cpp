@@ -0,0 +1,238 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "SlateCorePrivatePCH.h"
+#include "LayoutCache.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Cached Widgets"), STAT_SlateNumCachedWidgets, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Volatile Widgets"), STAT_SlateNumVolatileWidgets, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Layout Cache Recordings"), STAT_SlateNumLayoutCacheRecordings, STATGROUP_Slate);
+
+
+FLayoutCache::FLayoutCache()
+	: CachedLayerId(0)
+	, CachedMaxLayerId(0)
+	, FirstCachingElement(0)
+	, bNeedsCaching(true)
+	, bNeedsPrepass(true)
+	, bIsCaching(false)
+	, bIsUncacheable(false)
+{
+}
+
+
+void FLayoutCache::Invalidate( EInvalidateWidget InvalidateReason )
+{
+	bNeedsCaching = true;
+
+	if ( InvalidateReason == EInvalidateWidget::Layout )
+	{
+		bNeedsPrepass = true;
+	}
+}
+
+
+bool FLayoutCache::CanDraw( const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect ) const
+{
+	// Elements are recorded in window space, they can only be drawn again exactly where they were painted
+	return !bNeedsCaching
+		&& AllottedGeometry == CachedGeometry
+		&& AllottedGeometry.GetAccumulatedRenderTransform() == CachedGeometry.GetAccumulatedRenderTransform()
+		&& MyClippingRect == CachedClippingRect;
+}
+
+
+void FLayoutCache::BeginCaching( const FSlateWindowElementList& ElementList, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, int32 LayerId )
+{
+	check( !bIsCaching );
+	INC_DWORD_STAT(STAT_SlateNumLayoutCacheRecordings);
+
+	CachedElements.Reset();
+	HittestNodes.Reset();
+	VolatileWidgets.Reset();
+	VolatileElementRanges.Reset();
+
+	CachedGeometry = AllottedGeometry;
+	CachedClippingRect = MyClippingRect;
+	CachedLayerId = LayerId;
+	CachedMaxLayerId = LayerId;
+	FirstCachingElement = ElementList.GetDrawElements().Num();
+
+	// Anything invalidating the cache while it records makes it record again next time
+	bNeedsCaching = false;
+	bIsUncacheable = false;
+	bIsCaching = true;
+}
+
+
+void FLayoutCache::EndCaching( const FSlateWindowElementList& ElementList, int32 MaxLayerId )
+{
+	check( bIsCaching );
+	bIsCaching = false;
+
+	CachedMaxLayerId = MaxLayerId;
+
+	// Keep everything painted since BeginCaching() except what the volatile widgets painted, ranges are in painting order
+	const TArray<FSlateDrawElement>& DrawElements = ElementList.GetDrawElements();
+	CachedElements.Reserve( DrawElements.Num() - FirstCachingElement );
+	int32 ElementIndex = FirstCachingElement;
+	for ( const FElementRange& VolatileElements : VolatileElementRanges )
+	{
+		for ( ; ElementIndex < VolatileElements.First; ++ElementIndex )
+		{
+			CachedElements.Add( DrawElements[ElementIndex] );
+		}
+		ElementIndex = FMath::Max( ElementIndex, VolatileElements.End );
+	}
+	for ( ; ElementIndex < DrawElements.Num(); ++ElementIndex )
+	{
+		CachedElements.Add( DrawElements[ElementIndex] );
+	}
+	VolatileElementRanges.Reset();
+
+	if ( bIsUncacheable )
+	{
+		// Keep the hittest nodes and volatile widgets for this frame, but record again next time
+		bNeedsCaching = true;
+	}
+}
+
+
+int32 FLayoutCache::Draw( const FPaintArgs& Args, FSlateWindowElementList& OutDrawElements, int32 LayerId )
+{
+	check( !bIsCaching );
+
+	const int32 LayerOffset = LayerId - CachedLayerId;
+	OutDrawElements.AppendCachedElements( CachedElements, LayerOffset );
+
+	// Put the widgets back into the hittest grid, parents are always recorded before their children
+	for ( FHittestNode& Node : HittestNodes )
+	{
+		const FPaintArgs ParentArgs = ( Node.ParentIndex == INDEX_NONE )
+			? Args
+			: Args.WithHittestParent( HittestNodes[Node.ParentIndex].HittestIndex, HittestNodes[Node.ParentIndex].RecordedVisibility );
+
+		TSharedPtr<SWidget> Widget = Node.Widget.Pin();
+		if ( Widget.IsValid() )
+		{
+			const FPaintArgs NodeArgs = ParentArgs.RecordHittestGeometry( Widget.Get(), Node.Geometry, Node.ClippingRect );
+			Node.HittestIndex = NodeArgs.GetLastHitTestIndex();
+			Node.RecordedVisibility = NodeArgs.GetLastRecordedVisibility();
+		}
+		else
+		{
+			// The widget is gone, its children go under its parent until the subtree is recorded again
+			Node.HittestIndex = ParentArgs.GetLastHitTestIndex();
+			Node.RecordedVisibility = ParentArgs.GetLastRecordedVisibility();
+			bNeedsCaching = true;
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_SlateNumCachedWidgets, HittestNodes.Num());
+
+	const int32 MaxVolatileLayerId = PaintVolatileWidgets( Args, OutDrawElements, LayerId );
+	return FMath::Max( CachedMaxLayerId + LayerOffset, MaxVolatileLayerId );
+}
+
+
+int32 FLayoutCache::PaintVolatileWidgets( const FPaintArgs& Args, FSlateWindowElementList& OutDrawElements, int32 LayerId ) const
+{
+	const int32 LayerOffset = LayerId - CachedLayerId;
+	int32 MaxLayerId = LayerId;
+
+	for ( const FVolatileWidget& VolatileWidget : VolatileWidgets )
+	{
+		TSharedPtr<SWidget> Widget = VolatileWidget.Widget.Pin();
+		if ( Widget.IsValid() )
+		{
+			INC_DWORD_STAT(STAT_SlateNumVolatileWidgets);
+
+			const FPaintArgs VolatileArgs = ( VolatileWidget.ParentIndex == INDEX_NONE )
+				? Args
+				: Args.WithHittestParent( HittestNodes[VolatileWidget.ParentIndex].HittestIndex, HittestNodes[VolatileWidget.ParentIndex].RecordedVisibility );
+
+			const int32 VolatileLayerId = Widget->Paint( VolatileArgs, VolatileWidget.Geometry, VolatileWidget.ClippingRect, OutDrawElements, VolatileWidget.LayerId + LayerOffset, VolatileWidget.WidgetStyle, VolatileWidget.bParentEnabled );
+			MaxLayerId = FMath::Max( MaxLayerId, VolatileLayerId );
+		}
+	}
+
+	return MaxLayerId;
+}
+
+
+int32 FLayoutCache::RecordHittestGeometry( int32 ParentCacheIndex, const SWidget* Widget, const FGeometry& WidgetGeometry, const FSlateRect& MyClippingRect, int32 HittestIndex, EVisibility RecordedVisibility )
+{
+	check( bIsCaching );
+
+	const int32 NodeIndex = HittestNodes.AddUninitialized();
+	FHittestNode& Node = *new( HittestNodes.GetData() + NodeIndex ) FHittestNode();
+	Node.Widget = const_cast<SWidget*>(Widget)->AsShared();
+	Node.Geometry = WidgetGeometry;
+	Node.ClippingRect = MyClippingRect;
+	Node.ParentIndex = ParentCacheIndex;
+	Node.HittestIndex = HittestIndex;
+	Node.RecordedVisibility = RecordedVisibility;
+
+	return NodeIndex;
+}
+
+
+void FLayoutCache::RecordVolatileWidget( const FPaintArgs& Args, const SWidget* Widget, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled )
+{
+	check( bIsCaching );
+
+	const int32 VolatileIndex = VolatileWidgets.AddUninitialized();
+	FVolatileWidget& VolatileWidget = *new( VolatileWidgets.GetData() + VolatileIndex ) FVolatileWidget();
+	VolatileWidget.Widget = const_cast<SWidget*>(Widget)->AsShared();
+	VolatileWidget.Geometry = AllottedGeometry;
+	VolatileWidget.ClippingRect = MyClippingRect;
+	VolatileWidget.WidgetStyle = InWidgetStyle;
+	VolatileWidget.DesiredSize = Widget->GetDesiredSize();
+	VolatileWidget.ParentIndex = Args.GetLastCacheIndex();
+	VolatileWidget.LayerId = LayerId;
+	VolatileWidget.bParentEnabled = bParentEnabled;
+}
+
+
+void FLayoutCache::SkipVolatileElements( int32 FirstElement, int32 EndElement )
+{
+	check( bIsCaching );
+
+	if ( EndElement > FirstElement )
+	{
+		VolatileElementRanges.Add( FElementRange( FirstElement, EndElement ) );
+	}
+}
+
+
+bool FLayoutCache::PrepassVolatileWidgets( float LayoutScaleMultiplier )
+{
+	check( !bIsCaching );
+
+	bool bResized = false;
+	for ( const FVolatileWidget& VolatileWidget : VolatileWidgets )
+	{
+		TSharedPtr<SWidget> Widget = VolatileWidget.Widget.Pin();
+		if ( Widget.IsValid() )
+		{
+			if ( Widget->GetVisibility() == EVisibility::Collapsed )
+			{
+				// Collapsed widgets take no room, the subtree has to be arranged without it
+				bResized = true;
+				continue;
+			}
+
+			// Layout scales below the owner of the cache are part of the recorded geometry
+			const float RelativeLayoutScale = CachedGeometry.Scale > 0.0f ? VolatileWidget.Geometry.Scale / CachedGeometry.Scale : 1.0f;
+			Widget->SlatePrepass( LayoutScaleMultiplier * RelativeLayoutScale );
+			bResized |= Widget->GetDesiredSize() != VolatileWidget.DesiredSize;
+		}
+	}
+
+	return bResized;
+}
+
+
+void FLayoutCache::MarkUncacheable()
+{
+	bIsUncacheable = true;
+}
@@ -174,14 +174,34 @@ FVector2D FSlateDrawElement::GetRotationPoint(const FPaintGeometry& PaintGeometr
 	return RotationPoint;
 }
 
+void FSlateWindowElementList::AppendCachedElements( const TArray<FSlateDrawElement>& CachedElements, int32 LayerOffset )
+{
+	const int32 FirstElement = DrawElements.Num();
+	DrawElements.Append( CachedElements );
+
+	if ( LayerOffset != 0 )
+	{
+		for ( int32 ElementIndex = FirstElement; ElementIndex < DrawElements.Num(); ++ElementIndex )
+		{
+			DrawElements[ElementIndex].Layer += LayerOffset;
+		}
+	}
+}
+
+
 FSlateWindowElementList::FDeferredPaint::FDeferredPaint( const TSharedRef<SWidget>& InWidgetToPaint, const FPaintArgs& InArgs, const FGeometry InAllottedGeometry, const FSlateRect InMyClippingRect, const FWidgetStyle& InWidgetStyle, bool InParentEnabled )
 : WidgetToPaintPtr( InWidgetToPaint )
-, Args( InArgs )
+, Args( InArgs.EnableCaching( nullptr ) )
 , AllottedGeometry( InAllottedGeometry )
 , MyClippingRect( InMyClippingRect )
 , WidgetStyle( InWidgetStyle )
 , bParentEnabled( InParentEnabled )
 {
+	if ( InArgs.GetLayoutCache() != nullptr )
+	{
+		// Deferred painting happens after the layout cache is done recording, so it can't be drawn from the cache.
+		InArgs.GetLayoutCache()->MarkUncacheable();
+	}
 }
 
 
@@ -2,12 +2,15 @@
 
 #include "SlateCorePrivatePCH.h"
 #include "HittestGrid.h"
+#include "LayoutCache.h"
 
 FPaintArgs::FPaintArgs( const TSharedRef<SWidget>& Parent, FHittestGrid& InHittestGrid, FVector2D InWindowOffset, double InCurrentTime, float InDeltaTime )
 : ParentPtr(Parent)
 , Grid(InHittestGrid)
 , LastHittestIndex(INDEX_NONE)
 , LastRecordedVisibility( EVisibility::Visible )
+, LayoutCache(nullptr)
+, LastCacheIndex(INDEX_NONE)
 , WindowOffset(InWindowOffset)
 , CurrentTime(InCurrentTime)
 , DeltaTime(InDeltaTime)
@@ -20,6 +23,8 @@ FPaintArgs FPaintArgs::WithNewParent( const SWidget* Parent ) const
 	FPaintArgs Args = FPaintArgs( const_cast<SWidget*>(Parent)->AsShared(), this->Grid, this->WindowOffset, this->CurrentTime, this->DeltaTime );
 	Args.LastHittestIndex = this->LastHittestIndex;
 	Args.LastRecordedVisibility = this->LastRecordedVisibility;
+	Args.LayoutCache = this->LayoutCache;
+	Args.LastCacheIndex = this->LastCacheIndex;
 	return Args;
 }
 
@@ -35,11 +40,36 @@ FPaintArgs FPaintArgs::RecordHittestGeometry(const SWidget* Widget, const FGeome
 	FPaintArgs UpdatedArgs(*this);
 	UpdatedArgs.LastHittestIndex = RecordedHittestIndex;
 	UpdatedArgs.LastRecordedVisibility = RecordedVisibility;
+	if ( LayoutCache != nullptr )
+	{
+		UpdatedArgs.LastCacheIndex = LayoutCache->RecordHittestGeometry( LastCacheIndex, Widget, WidgetGeometry, InClippingRect, RecordedHittestIndex, RecordedVisibility );
+	}
 	return UpdatedArgs;
 }
 
 FPaintArgs FPaintArgs::InsertCustomHitTestPath( TSharedRef<ICustomHitTestPath> CustomHitTestPath, int32 InLastHittestIndex ) const
 {
 	const_cast<FHittestGrid&>(Grid).InsertCustomHitTestPath( CustomHitTestPath, InLastHittestIndex );
+	if ( LayoutCache != nullptr )
+	{
+		// Custom hittest paths are not replayed, the subtree has to be painted for them to be registered again.
+		LayoutCache->MarkUncacheable();
+	}
 	return *this;
+}
+
+FPaintArgs FPaintArgs::EnableCaching( FLayoutCache* InLayoutCache ) const
+{
+	FPaintArgs UpdatedArgs(*this);
+	UpdatedArgs.LayoutCache = InLayoutCache;
+	UpdatedArgs.LastCacheIndex = INDEX_NONE;
+	return UpdatedArgs;
+}
+
+FPaintArgs FPaintArgs::WithHittestParent( int32 InLastHittestIndex, EVisibility InLastRecordedVisibility ) const
+{
+	FPaintArgs UpdatedArgs(*this);
+	UpdatedArgs.LastHittestIndex = InLastHittestIndex;
+	UpdatedArgs.LastRecordedVisibility = InLastRecordedVisibility;
+	return UpdatedArgs;
 }
\ No newline at end of file
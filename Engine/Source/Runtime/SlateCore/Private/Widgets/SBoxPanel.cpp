@@ -248,6 +248,7 @@ FChildren* SBoxPanel::GetChildren()
 
 int32 SBoxPanel::RemoveSlot( const TSharedRef<SWidget>& SlotWidget )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	for (int32 SlotIdx = 0; SlotIdx < Children.Num(); ++SlotIdx)
 	{
 		if ( SlotWidget == Children[SlotIdx].GetWidget() )
@@ -263,6 +264,7 @@ int32 SBoxPanel::RemoveSlot( const TSharedRef<SWidget>& SlotWidget )
 void SBoxPanel::ClearChildren()
 {
 	Children.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 /**
@@ -54,6 +54,11 @@ FSlateColor SCompoundWidget::GetForegroundColor() const
 	return ForegroundColor.Get();
 }
 
+bool SCompoundWidget::ComputeVolatility() const
+{
+	return SWidget::ComputeVolatility() || ContentScale.IsBound() || ColorAndOpacity.IsBound() || ForegroundColor.IsBound();
+}
+
 SCompoundWidget::SCompoundWidget()
 	: ChildSlot()
 	, ContentScale( FVector2D(1.0f,1.0f) )
@@ -102,6 +102,7 @@ int32 SOverlay::OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeomet
 
 SOverlay::FOverlaySlot& SOverlay::AddSlot( int32 ZOrder )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	FOverlaySlot& NewSlot = *new FOverlaySlot();
 	if ( ZOrder == INDEX_NONE )
 	{
@@ -139,6 +140,7 @@ SOverlay::FOverlaySlot& SOverlay::AddSlot( int32 ZOrder )
 
 void SOverlay::RemoveSlot( int32 ZOrder )
 {
+	Invalidate(EInvalidateWidget::Layout);
 	if (ZOrder != INDEX_NONE)
 	{
 		for( int32 ChildIndex=0; ChildIndex < Children.Num(); ++ChildIndex )
@@ -165,6 +167,7 @@ void SOverlay::RemoveSlot( int32 ZOrder )
 void SOverlay::ClearChildren()
 {
 	Children.Empty();
+	Invalidate(EInvalidateWidget::Layout);
 }
 
 /** Returns the number of child widgets */
@@ -186,4 +189,5 @@ void SOverlay::RemoveSlot( TSharedRef< SWidget > Widget )
 			break;
 		}
 	}
+	Invalidate(EInvalidateWidget::Layout);
 }
@@ -5,6 +5,7 @@
 #include "Input/Events.h"
 #include "ActiveTimerHandle.h"
 #include "SlateStats.h"
+#include "LayoutCache.h"
 
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Painted Widgets"), STAT_SlateNumPaintedWidgets, STATGROUP_Slate);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Ticked Widgets"), STAT_SlateNumTickedWidgets, STATGROUP_Slate);
@@ -27,6 +28,7 @@ SWidget::SWidget()
 	, DesiredSize(FVector2D::ZeroVector)
 	, ToolTip()
 	, bToolTipForceFieldEnabled( false )
+	, bForceVolatile( false )
 {
 
 }
@@ -180,12 +182,14 @@ FReply SWidget::OnMouseMove( const FGeometry& MyGeometry, const FPointerEvent& M
 void SWidget::OnMouseEnter( const FGeometry& MyGeometry, const FPointerEvent& MouseEvent )
 {
 	bIsHovered = true;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 
 void SWidget::OnMouseLeave( const FPointerEvent& MouseEvent )
 {
 	bIsHovered = false;
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 
@@ -383,16 +387,19 @@ void SWidget::SlatePrepass(float LayoutScaleMultiplier)
 	SLATE_CYCLE_COUNTER_SCOPE_CUSTOM_DETAILED(SLATE_STATS_DETAIL_LEVEL_MED, GSlatePrepass, GetType());
 	// Cache child desired sizes first. This widget's desired size is
 	// a function of its children's sizes.
-	FChildren* MyChildren = this->GetChildren();
-	int32 NumChildren = MyChildren->Num();
-	for(int32 ChildIndex=0; ChildIndex < NumChildren; ++ChildIndex)
+	if ( ShouldPrepassChildren() )
 	{
-		const TSharedRef<SWidget>& Child = MyChildren->GetChildAt(ChildIndex);
-		if ( Child->Visibility.Get() != EVisibility::Collapsed )
+		FChildren* MyChildren = this->GetChildren();
+		int32 NumChildren = MyChildren->Num();
+		for(int32 ChildIndex=0; ChildIndex < NumChildren; ++ChildIndex)
 		{
-			const float ChildLayoutScaleMultiplier = GetRelativeLayoutScale( MyChildren->GetSlotAt(ChildIndex) );
-			// Recur: Descend down the widget tree.
-			Child->SlatePrepass(LayoutScaleMultiplier*ChildLayoutScaleMultiplier);
+			const TSharedRef<SWidget>& Child = MyChildren->GetChildAt(ChildIndex);
+			if ( Child->Visibility.Get() != EVisibility::Collapsed )
+			{
+				const float ChildLayoutScaleMultiplier = GetRelativeLayoutScale( MyChildren->GetSlotAt(ChildIndex) );
+				// Recur: Descend down the widget tree.
+				Child->SlatePrepass(LayoutScaleMultiplier*ChildLayoutScaleMultiplier);
+			}
 		}
 	}
 
@@ -644,7 +651,24 @@ int32 SWidget::Paint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
 		MutableThis->Tick( TickGeometry, Args.GetCurrentTime(), Args.GetDeltaTime() );
 	}
 
-	const FPaintArgs UpdatedArgs = Args.RecordHittestGeometry( this, AllottedGeometry, MyClippingRect );
+	FLayoutCache* RecordingLayoutCache = Args.GetLayoutCache();
+	int32 FirstVolatileElement = INDEX_NONE;
+	if ( RecordingLayoutCache != nullptr )
+	{
+		SWidget* MutableThis = const_cast<SWidget*>(this);
+		MutableThis->LayoutCache = RecordingLayoutCache->AsShared();
+
+		if ( IsVolatile() )
+		{
+			// The layout cache paints volatile widgets every time it is drawn, they are not part of the recording.
+			// This one is painted in place, the cache leaves out the elements it adds.
+			RecordingLayoutCache->RecordVolatileWidget( Args, this, AllottedGeometry, MyClippingRect, LayerId, InWidgetStyle, bParentEnabled );
+			FirstVolatileElement = OutDrawElements.GetDrawElements().Num();
+		}
+	}
+
+	const FPaintArgs PaintArgs = ( FirstVolatileElement != INDEX_NONE ) ? Args.EnableCaching( nullptr ) : Args;
+	const FPaintArgs UpdatedArgs = PaintArgs.RecordHittestGeometry( this, AllottedGeometry, MyClippingRect );
 	int32 NewLayerID = OnPaint(UpdatedArgs, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
 
 	if (SupportsKeyboardFocus())
@@ -669,9 +693,52 @@ int32 SWidget::Paint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
 		}
 	}
 
+	if ( FirstVolatileElement != INDEX_NONE )
+	{
+		RecordingLayoutCache->SkipVolatileElements( FirstVolatileElement, OutDrawElements.GetDrawElements().Num() );
+	}
+	else if ( RecordingLayoutCache != nullptr )
+	{
+		const_cast<SWidget*>(this)->SetChildrenLayoutCache( RecordingLayoutCache->AsShared() );
+	}
+
 	return NewLayerID;
 }
 
+void SWidget::Invalidate(EInvalidateWidget InvalidateReason)
+{
+	TSharedPtr<FLayoutCache> LayoutCachePin = LayoutCache.Pin();
+	if ( LayoutCachePin.IsValid() )
+	{
+		LayoutCachePin->Invalidate(InvalidateReason);
+	}
+}
+
+void SWidget::SetChildrenLayoutCache(const TSharedRef<FLayoutCache>& InLayoutCache)
+{
+	// Children that were not painted, e.g. collapsed or hidden ones, are not in the recording either.
+	// They still have to invalidate it, becoming visible is a change the recording can't show.
+	FChildren* MyChildren = GetChildren();
+	for ( int32 ChildIndex = 0; ChildIndex < MyChildren->Num(); ++ChildIndex )
+	{
+		MyChildren->GetChildAt( ChildIndex )->LayoutCache = InLayoutCache;
+	}
+}
+
+void SWidget::ForceVolatile(bool bForce)
+{
+	if ( bForceVolatile != bForce )
+	{
+		bForceVolatile = bForce;
+		Invalidate(EInvalidateWidget::Paint);
+	}
+}
+
+bool SWidget::ComputeVolatility() const
+{
+	return EnabledState.IsBound() || Visibility.IsBound() || RenderTransform.IsBound() || RenderTransformPivot.IsBound();
+}
+
 float SWidget::GetRelativeLayoutScale(const FSlotBase& Child) const
 {
 	return 1.0f;
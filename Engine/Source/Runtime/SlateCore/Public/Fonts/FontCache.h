@@ -72,7 +72,8 @@ struct SLATECORE_API FKerningPair
 
 	friend inline uint32 GetTypeHash( const FKerningPair& Key )
 	{
-		return FCrc::MemCrc32( &Key, sizeof(Key) );
+		// Called for every kerning lookup outside of the direct table, keep it cheap
+		return HashCombine( (uint32)Key.First, (uint32)Key.Second );
 	}
 };
 
@@ -114,20 +115,18 @@ private:
 
 /**
  * Manages a potentially large list of font characters
- * Uses a directly indexed by TCHAR array until space runs out and then maps the rest to conserve memory
- * Every character indexed by TCHAR could potentially cost a lot of memory of a lot of empty entries are created
- * because characters being used are far apart
+ * Characters are directly indexed through fixed size pages of entries, which are only allocated once a character in their range is used.
+ * Only a limited number of pages is allocated per list, so that text using characters that are far apart doesn't cost a lot of memory,
+ * the characters that don't fit in a page are mapped.
  */
 class SLATECORE_API FCharacterList
 {
 public:
 	FCharacterList( const FSlateFontKey& InFontKey, const FSlateFontCache& InFontCache );
+	~FCharacterList();
 
 	/* @return Is the character in this list */
-	bool IsValidIndex( TCHAR Character ) const
-	{
-		return DirectIndexEntries.IsValidIndex( Character ) || ( Character >= MaxDirectIndexedEntries && MappedEntries.Contains( Character ) );
-	}
+	bool IsValidIndex( TCHAR Character ) const;
 
 	/**
 	 * Gets data about how to render and measure a character 
@@ -192,13 +191,26 @@ private:
 	 */
 	FCharacterEntry& CacheCharacter( TCHAR Character );
 
+	/**
+	 * Finds the directly indexed entry for a character, allocating its page if there is room for it
+	 *
+	 * @param Character	The character to find the entry for
+	 * @return The entry for the character (which may not be cached yet), or null if the character is mapped
+	 */
+	FCharacterEntry* FindOrAddDirectEntry( TCHAR Character );
+
+	/** @return The directly indexed entry for a character, or null if its page isn't allocated */
+	const FCharacterEntry* FindDirectEntry( TCHAR Character ) const;
+
 
 private:
 
-	/** Entries for larger character sets to conserve memory */
+	/** Entries for characters outside of the allocated pages, to conserve memory */
 	TMap<TCHAR, FCharacterEntry> MappedEntries; 
-	/** Directly indexed entries for fast lookup */
-	TArray<FCharacterEntry> DirectIndexEntries;
+	/** Pages of directly indexed entries for fast lookup, indexed by Character / page size. Unallocated pages are empty. */
+	TArray< TArray<FCharacterEntry> > DirectIndexPages;
+	/** Number of pages allocated in DirectIndexPages */
+	int32 NumDirectIndexPages;
 	/** Table of kerning values for this font */
 	FKerningTable KerningTable;
 	/** Font for this character list */
@@ -207,8 +219,6 @@ private:
 	const class FSlateFontCache& FontCache;
 	/** The history revision of the cached composite font */
 	int32 CompositeFontHistoryRevision;
-	/** Number of directly indexed entries */
-	int32 MaxDirectIndexedEntries;
 	/** The global max height for any character in this font */
 	mutable uint16 MaxHeight;
 	/** The offset from the bottom of the max character height to the baseline. */
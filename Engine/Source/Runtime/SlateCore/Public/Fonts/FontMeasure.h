@@ -226,7 +226,7 @@ private:
 	/**
 	 * Check to see if there's an existing cached measurement, or failing that, add a new entry so that we can cache a new measurement
 	 */
-	FMeasureCache* FindOrAddMeasureCache( const FSlateFontInfo& InFontInfo, const float InFontScale ) const;
+	FSlateFontMeasureCache* FindOrAddMeasureCache( const FSlateFontInfo& InFontInfo, const float InFontScale ) const;
 
 private:
 
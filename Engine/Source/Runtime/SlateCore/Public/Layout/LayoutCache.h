@@ -0,0 +1,187 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+
+class FSlateWindowElementList;
+
+/**
+ * Records what a widget subtree painted: its draw elements, the hittest geometry of its widgets and where its
+ * volatile widgets go. As long as nothing in the subtree changes, the recording is drawn in place of painting it.
+ * Used by SInvalidationPanel.
+ *
+ * Widgets painted during a recording remember the cache they went into, SWidget::Invalidate() tells that cache to record again.
+ * Volatile widgets (see SWidget::IsVolatile()) are left out of the recording and painted every time it is drawn.
+ */
+class SLATECORE_API FLayoutCache : public TSharedFromThis<FLayoutCache>
+{
+public:
+
+	FLayoutCache();
+
+	/** Marks the recording as out of date, the subtree will be painted and recorded again the next time it is drawn. */
+	void Invalidate( EInvalidateWidget InvalidateReason );
+
+	/** @return true if the subtree must be painted and recorded again */
+	bool NeedsCaching() const
+	{
+		return bNeedsCaching;
+	}
+
+	/** @return true if the desired sizes of the subtree must be computed again */
+	bool NeedsPrepass() const
+	{
+		return bNeedsPrepass;
+	}
+
+	/** Called once the desired sizes of the subtree have been computed. */
+	void OnPrepassed()
+	{
+		bNeedsPrepass = false;
+	}
+
+	/** @return true if the recording is up to date and was made with the same geometry and clipping rect */
+	bool CanDraw( const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect ) const;
+
+	/**
+	 * Starts recording. Paint the subtree with Args.EnableCaching(this) until EndCaching() is called.
+	 *
+	 * @param ElementList       The list the subtree is painted into.
+	 * @param AllottedGeometry  The geometry of the widget owning the cache.
+	 * @param MyClippingRect    The clipping rect of the widget owning the cache.
+	 * @param LayerId           The layer the subtree is painted on.
+	 */
+	void BeginCaching( const FSlateWindowElementList& ElementList, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, int32 LayerId );
+
+	/**
+	 * Stops recording and keeps the elements painted since BeginCaching().
+	 *
+	 * @param ElementList  The list the subtree was painted into.
+	 * @param MaxLayerId   The maximum layer the subtree was painted on.
+	 */
+	void EndCaching( const FSlateWindowElementList& ElementList, int32 MaxLayerId );
+
+	/**
+	 * Adds the recorded elements and hittest geometry in place of painting the subtree, then paints the volatile widgets.
+	 *
+	 * @param Args             The args the widget owning the cache was painted with.
+	 * @param OutDrawElements  The list to add the elements to.
+	 * @param LayerId          The layer the subtree should be drawn on.
+	 * @return The maximum layer ID attained by the subtree.
+	 */
+	int32 Draw( const FPaintArgs& Args, FSlateWindowElementList& OutDrawElements, int32 LayerId );
+
+	/**
+	 * Called through FPaintArgs::RecordHittestGeometry() when a widget of the subtree is painted.
+	 *
+	 * @return The index of the widget in the recording, that its children are recorded under.
+	 */
+	int32 RecordHittestGeometry( int32 ParentCacheIndex, const SWidget* Widget, const FGeometry& WidgetGeometry, const FSlateRect& MyClippingRect, int32 HittestIndex, EVisibility RecordedVisibility );
+
+	/** Called by SWidget::Paint() before it paints a volatile widget of the subtree, so that Draw() paints it as well. */
+	void RecordVolatileWidget( const FPaintArgs& Args, const SWidget* Widget, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled );
+
+	/**
+	 * Called by SWidget::Paint() after it painted a volatile widget of the subtree during the recording.
+	 * The elements it added are left out of the recording, they are painted again every time it is drawn.
+	 *
+	 * @param FirstElement  Index of the first element the volatile widget added to the element list.
+	 * @param EndElement    Number of elements in the element list once the volatile widget was painted.
+	 */
+	void SkipVolatileElements( int32 FirstElement, int32 EndElement );
+
+	/**
+	 * Computes the desired sizes of the volatile widgets again. They are painted with their recorded geometry, so the
+	 * subtree has to be arranged and recorded again when one of them changes size, e.g. a text block with bound text.
+	 *
+	 * @param LayoutScaleMultiplier  The layout scale the widget owning the cache is prepassed with.
+	 * @return true if a volatile widget changed size since the recording.
+	 */
+	bool PrepassVolatileWidgets( float LayoutScaleMultiplier );
+
+	/** Called when something was painted that can't be recorded, e.g. deferred painting. The subtree is painted normally until it stops doing that. */
+	void MarkUncacheable();
+
+	/** @return the number of widgets drawn from the recording */
+	int32 GetNumCachedWidgets() const
+	{
+		return HittestNodes.Num();
+	}
+
+	/** @return the number of volatile widgets painted every time the recording is drawn */
+	int32 GetNumVolatileWidgets() const
+	{
+		return VolatileWidgets.Num();
+	}
+
+private:
+
+	/** Paints the volatile widgets of the subtree, returns the maximum layer ID they attained or LayerId. */
+	int32 PaintVolatileWidgets( const FPaintArgs& Args, FSlateWindowElementList& OutDrawElements, int32 LayerId ) const;
+
+	/** A widget that was painted during the recording */
+	struct FHittestNode
+	{
+		TWeakPtr<SWidget> Widget;
+		FGeometry Geometry;
+		FSlateRect ClippingRect;
+		/** Node this one was recorded under, INDEX_NONE for the children of the widget owning the cache */
+		int32 ParentIndex;
+		/** Entry of the hittest grid this node has this frame, and the visibility it was recorded with */
+		int32 HittestIndex;
+		EVisibility RecordedVisibility;
+	};
+
+	/** A volatile widget that was left out of the recording */
+	struct FVolatileWidget
+	{
+		TWeakPtr<SWidget> Widget;
+		FGeometry Geometry;
+		FSlateRect ClippingRect;
+		FWidgetStyle WidgetStyle;
+		/** Desired size of the widget during the recording */
+		FVector2D DesiredSize;
+		int32 ParentIndex;
+		/** Layer the widget was painted on during the recording */
+		int32 LayerId;
+		bool bParentEnabled;
+	};
+
+	/** Elements painted by the subtree, on the layers they had during the recording */
+	TArray<FSlateDrawElement> CachedElements;
+
+	/** Widgets painted during the recording, parents first */
+	TArray<FHittestNode> HittestNodes;
+
+	TArray<FVolatileWidget> VolatileWidgets;
+
+	/** Elements of the element list painted by a volatile widget during the recording in progress */
+	struct FElementRange
+	{
+		FElementRange( int32 InFirst, int32 InEnd )
+			: First( InFirst )
+			, End( InEnd )
+		{
+		}
+
+		int32 First;
+		int32 End;
+	};
+	TArray<FElementRange> VolatileElementRanges;
+
+	/** Geometry and clipping rect of the widget owning the cache during the recording */
+	FGeometry CachedGeometry;
+	FSlateRect CachedClippingRect;
+
+	/** Layer passed to BeginCaching() and the maximum layer reached during the recording */
+	int32 CachedLayerId;
+	int32 CachedMaxLayerId;
+
+	/** First element of the element list that belongs to the recording in progress */
+	int32 FirstCachingElement;
+
+	bool bNeedsCaching;
+	bool bNeedsPrepass;
+	bool bIsCaching;
+	bool bIsUncacheable;
+};
@@ -326,6 +326,8 @@ public:
 	const TOptional<FShortRect>& GetScissorRect() const { return ScissorRect; }
 
 private:
+	friend class FSlateWindowElementList;
+
 	void Init(uint32 InLayer, const FPaintGeometry& PaintGeometry, const FSlateRect& InClippingRect, ESlateDrawEffect::Type InDrawEffects);
 
 
@@ -597,6 +599,14 @@ public:
 		return *(new(DrawElements.GetData() + InsertIdx) FSlateDrawElement());
 	}
 
+	/**
+	 * Adds elements that were painted in an earlier frame, e.g. by a widget subtree recorded in an FLayoutCache.
+	 *
+	 * @param CachedElements  The elements to add
+	 * @param LayerOffset     How many layers to move the elements by
+	 */
+	SLATECORE_API void AppendCachedElements( const TArray<FSlateDrawElement>& CachedElements, int32 LayerOffset );
+
 	/**
 	* Some widgets may want to paint their children after after another, loosely-related widget finished painting.
 	* Or they may want to paint "after everyone".
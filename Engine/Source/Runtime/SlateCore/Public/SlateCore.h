@@ -113,6 +113,7 @@ DECLARE_DELEGATE_RetVal_TwoParams(EActiveTimerReturnType, FWidgetActiveTimerDele
 #include "RenderingPolicy.h"
 #include "SlateDrawBuffer.h"
 #include "SlateRenderer.h"
+#include "LayoutCache.h"
 
 // Application
 #include "IToolTip.h"
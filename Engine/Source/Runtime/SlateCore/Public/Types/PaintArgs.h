@@ -9,6 +9,7 @@ struct FGeometry;
 class FHittestGrid;
 class FSlateRect;
 class ICustomHitTestPath;
+class FLayoutCache;
 
 /**
  * SWidget::OnPaint and SWidget::Paint use FPaintArgs as their
@@ -22,7 +23,17 @@ public:
 	FPaintArgs WithNewParent( const SWidget* Parent ) const;
 	FPaintArgs RecordHittestGeometry(const SWidget* Widget, const FGeometry& WidgetGeometry, const FSlateRect& InClippingRect) const;
 	FPaintArgs InsertCustomHitTestPath( TSharedRef<ICustomHitTestPath> CustomHitTestPath, int32 HitTestIndex ) const;
+
+	/** @return args that record everything painted with them into InLayoutCache (see SInvalidationPanel) */
+	FPaintArgs EnableCaching( FLayoutCache* InLayoutCache ) const;
+
+	/** @return args whose hittest geometry goes under an earlier entry of the hittest grid. Used to replay a layout cache. */
+	FPaintArgs WithHittestParent( int32 InLastHittestIndex, EVisibility InLastRecordedVisibility ) const;
+
 	int32 GetLastHitTestIndex() const { return LastHittestIndex; }
+	EVisibility GetLastRecordedVisibility() const { return LastRecordedVisibility; }
+	FLayoutCache* GetLayoutCache() const { return LayoutCache; }
+	int32 GetLastCacheIndex() const { return LastCacheIndex; }
 	FVector2D GetWindowToDesktopTransform() const { return WindowOffset; }
 	double GetCurrentTime() const { return CurrentTime; }
 	float GetDeltaTime() const { return DeltaTime; }
@@ -32,6 +43,10 @@ private:
 	FHittestGrid& Grid;
 	int32 LastHittestIndex;
 	EVisibility LastRecordedVisibility;
+	/** Layout cache recording this paint, if any */
+	FLayoutCache* LayoutCache;
+	/** Hittest entry of LayoutCache the next recorded geometry goes under */
+	int32 LastCacheIndex;
 	FVector2D WindowOffset;
 	double CurrentTime;
 	float DeltaTime;
@@ -252,4 +252,16 @@ enum class EActiveTimerReturnType : uint8
 	Stop,
 	/** If this value is returned, the widget will continue to have its timer delegate called on it. */
 	Continue,
-};
\ No newline at end of file
+};
+
+/**
+ * What changed about a widget when it asks the layout cache it was painted into to be refreshed.
+ * See SWidget::Invalidate().
+ */
+enum class EInvalidateWidget : uint8
+{
+	/** The widget looks different, but its desired size did not change. Only painting needs to happen again. */
+	Paint,
+	/** The desired size of the widget may have changed, so its layout needs to be computed again before it is painted. */
+	Layout,
+};
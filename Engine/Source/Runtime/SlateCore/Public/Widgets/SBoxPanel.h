@@ -195,6 +195,8 @@ public:
 
 	FSlot& AddSlot()
 	{
+		Invalidate(EInvalidateWidget::Layout);
+
 		SHorizontalBox::FSlot& NewSlot = *new SHorizontalBox::FSlot();
 		this->Children.Add( &NewSlot );
 		return NewSlot;
@@ -206,6 +208,8 @@ public:
 		{
 			return AddSlot();
 		}
+		Invalidate(EInvalidateWidget::Layout);
+
 		SHorizontalBox::FSlot& NewSlot = *new SHorizontalBox::FSlot();
 		this->Children.Insert(&NewSlot, Index);
 		return NewSlot;
@@ -338,6 +342,8 @@ public:
 
 	FSlot& AddSlot()
 	{
+		Invalidate(EInvalidateWidget::Layout);
+
 		SVerticalBox::FSlot& NewSlot = *new SVerticalBox::FSlot();
 		this->Children.Add( &NewSlot );
 		return NewSlot;
@@ -349,6 +355,8 @@ public:
 		{
 			return AddSlot();
 		}
+		Invalidate(EInvalidateWidget::Layout);
+
 		SVerticalBox::FSlot& NewSlot = *new SVerticalBox::FSlot();
 		this->Children.Insert(&NewSlot, Index);
 		return NewSlot;
@@ -29,6 +29,7 @@ public:
 	void SetContentScale( const TAttribute< FVector2D >& InContentScale )
 	{
 		ContentScale = InContentScale;
+		Invalidate(EInvalidateWidget::Layout);
 	}
 
 	/**
@@ -47,6 +48,7 @@ public:
 	void SetColorAndOpacity( const TAttribute<FLinearColor>& InColorAndOpacity )
 	{
 		ColorAndOpacity = InColorAndOpacity;
+		Invalidate(EInvalidateWidget::Paint);
 	}
 
 	/**
@@ -57,6 +59,7 @@ public:
 	void SetForegroundColor( const TAttribute<FSlateColor>& InForegroundColor )
 	{
 		ForegroundColor = InForegroundColor;
+		Invalidate(EInvalidateWidget::Paint);
 	}
 
 public:
@@ -74,6 +77,11 @@ public:
 
 protected:
 
+	// SWidget interface
+	virtual bool ComputeVolatility() const override;
+	// End of SWidget interface
+
+
 	/** Disallow public construction */
 	SCompoundWidget();
 
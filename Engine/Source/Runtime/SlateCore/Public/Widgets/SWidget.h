@@ -36,6 +36,7 @@ public:
 };
 
 class IToolTip;
+class FLayoutCache;
 
 /**
  * Abstract base class for Slate widgets.
@@ -119,6 +120,31 @@ public:
 	DEPRECATED(4.4, "Paint() now requires an extra FPaintArgs parameter. When calling paint on a child widget, use Args.WithNewParent(this).")
 	int32 Paint(const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const { return 0; }
 
+	/**
+	 * Tells the layout cache this widget was last recorded into (see SInvalidationPanel) that it has to paint it again.
+	 * Widgets should call this when they change in a way that is not visible to the cache, e.g. when their content is set.
+	 *
+	 * @param InvalidateReason  Whether only the look of the widget changed, or its desired size as well.
+	 */
+	void Invalidate(EInvalidateWidget InvalidateReason);
+
+	/**
+	 * Volatile widgets are painted every frame, even inside of a layout cache that is up to date.
+	 *
+	 * @return true if this widget is forced to be volatile or computes that it is.
+	 */
+	bool IsVolatile() const
+	{
+		return bForceVolatile || ComputeVolatility();
+	}
+
+	/**
+	 * Forces this widget to be volatile, e.g. because it animates without any of its attributes being bound.
+	 *
+	 * @param bForce  true to always paint this widget, false to let ComputeVolatility() decide.
+	 */
+	void ForceVolatile(bool bForce);
+
 	/**
 	 * Ticks this widget with Geometry.  Override in derived classes, but always call the parent implementation.
 	 *
@@ -490,6 +516,12 @@ public:
 	 */
 	void SlatePrepass(float LayoutScaleMultiplier);
 
+	/**
+	 * Widgets that cache their content, such as SInvalidationPanel, return false while the desired sizes of their children
+	 * are still valid. SlatePrepass() does not descend into their children then.
+	 */
+	protected: virtual bool ShouldPrepassChildren() const { return true; }
+
 	/** @return the DesiredSize that was computed the last time CacheDesiredSize() was called. */
 	public:  const FVector2D& GetDesiredSize() const;
 
@@ -604,6 +636,7 @@ public:
 	void SetEnabled( const TAttribute<bool>& InEnabledState )
 	{
 		EnabledState = InEnabledState;
+		Invalidate(EInvalidateWidget::Paint);
 	}
 
 	/** @return Whether or not this widget is enabled */
@@ -651,6 +684,7 @@ public:
 	virtual void SetVisibility( TAttribute<EVisibility> InVisibility )
 	{
 		Visibility = InVisibility;
+		Invalidate(EInvalidateWidget::Layout);
 	}
 
 	/** @return the render transform of the widget. */
@@ -663,6 +697,7 @@ public:
 	void SetRenderTransform( TAttribute<TOptional<FSlateRenderTransform>> InTransform )
 	{
 		RenderTransform = InTransform;
+		Invalidate(EInvalidateWidget::Paint);
 	}
 
 	/** @return the pivot point of the render transform. */
@@ -675,6 +710,7 @@ public:
 	void SetRenderTransformPivot( TAttribute<FVector2D> InTransformPivot )
 	{
 		RenderTransformPivot = InTransformPivot;
+		Invalidate(EInvalidateWidget::Paint);
 	}
 
 	/**
@@ -834,6 +870,14 @@ protected:
 	/** @return a brush to draw focus, nullptr if no focus drawing is desired */
 	virtual const FSlateBrush* GetFocusBrush() const;
 
+	/**
+	 * Layout caches can't tell when bound attributes change, so widgets that look different depending on them are volatile.
+	 * Override to account for the attributes of derived widgets, and call the parent implementation.
+	 *
+	 * @return true if this widget has to be painted every frame
+	 */
+	virtual bool ComputeVolatility() const;
+
 private:
 
 	/**
@@ -952,4 +996,18 @@ private:
 	// Whether this widget is a "tool tip force field".  That is, tool-tips should never spawn over the area
 	// occupied by this widget, and will instead be repelled to an outside edge
 	bool bToolTipForceFieldEnabled;
+
+	/** Whether this widget is painted every frame regardless of ComputeVolatility(), see ForceVolatile() */
+	bool bForceVolatile;
+
+	/** The layout cache this widget was last recorded into, see Invalidate() */
+	TWeakPtr<FLayoutCache> LayoutCache;
+
+protected:
+
+	/**
+	 * Makes every child invalidate a layout cache this widget is being recorded into, including the children that are
+	 * not painted, so that showing them records the cache again.
+	 */
+	void SetChildrenLayoutCache(const TSharedRef<FLayoutCache>& InLayoutCache);
 };
@@ -0,0 +1,333 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioBuffer.cpp: Wave data played by the software mixer.
+=============================================================================*/
+
+#include "SoftwareAudioDevice.h"
+#include "SoftwareAudioMixer.h"
+
+/*------------------------------------------------------------------------------------
+	FSoftwareSoundBuffer.
+------------------------------------------------------------------------------------*/
+
+FSoftwareSoundBuffer::FSoftwareSoundBuffer(FSoftwareAudioDevice* InAudioDevice, ESoftwareSoundFormat InSoundFormat)
+	: AudioDevice(InAudioDevice)
+	, SoundFormat(InSoundFormat)
+	, PCMData(nullptr)
+	, PCMDataSize(0)
+	, SampleRate(0)
+	, DecompressionState(nullptr)
+	, bDynamicResource(false)
+{
+}
+
+FSoftwareSoundBuffer::~FSoftwareSoundBuffer()
+{
+	if (bAllocationInPermanentPool)
+	{
+		UE_LOG(LogSoftwareAudio, Fatal, TEXT("Can't free resource '%s' as it was allocated in permanent pool."), *ResourceName);
+	}
+
+	// The sources playing the buffer were stopped, the mixer may still be reading it until their commands ran. Transient
+	// buffers are deleted by those commands.
+	if (ResourceID != 0 && AudioDevice && AudioDevice->GetMixer())
+	{
+		AudioDevice->GetMixer()->FlushCommands();
+	}
+
+	if (DecompressionState)
+	{
+		delete DecompressionState;
+	}
+
+	switch (SoundFormat)
+	{
+	case ESoftwareSoundFormat::PCM:
+		if (PCMData)
+		{
+			FMemory::Free((void*)PCMData);
+		}
+		break;
+
+	case ESoftwareSoundFormat::PCMPreview:
+		if (bDynamicResource && PCMData)
+		{
+			FMemory::Free((void*)PCMData);
+		}
+		break;
+
+	case ESoftwareSoundFormat::PCMRealTime:
+	case ESoftwareSoundFormat::Procedural:
+	case ESoftwareSoundFormat::Streaming:
+		break;
+	}
+}
+
+int32 FSoftwareSoundBuffer::GetSize()
+{
+	switch (SoundFormat)
+	{
+	case ESoftwareSoundFormat::PCM:
+	case ESoftwareSoundFormat::PCMPreview:
+		return PCMDataSize;
+
+	case ESoftwareSoundFormat::PCMRealTime:
+		return (DecompressionState ? DecompressionState->GetSourceBufferSize() : 0) + MONO_PCM_BUFFER_SIZE * NumChannels;
+
+	case ESoftwareSoundFormat::Procedural:
+	case ESoftwareSoundFormat::Streaming:
+		return MONO_PCM_BUFFER_SIZE * NumChannels;
+	}
+
+	return 0;
+}
+
+int32 FSoftwareSoundBuffer::GetCurrentChunkIndex() const
+{
+	return DecompressionState ? DecompressionState->GetCurrentChunkIndex() : -1;
+}
+
+int32 FSoftwareSoundBuffer::GetCurrentChunkOffset() const
+{
+	return DecompressionState ? DecompressionState->GetCurrentChunkOffset() : -1;
+}
+
+bool FSoftwareSoundBuffer::ReadCompressedData(uint8* Destination, bool bLooping)
+{
+	const uint32 PCMBufferSize = MONO_PCM_BUFFER_SIZE * NumChannels;
+	if (SoundFormat == ESoftwareSoundFormat::Streaming)
+	{
+		return DecompressionState->StreamCompressedData(Destination, bLooping, PCMBufferSize);
+	}
+	else
+	{
+		return DecompressionState->ReadCompressedData(Destination, bLooping, PCMBufferSize);
+	}
+}
+
+void FSoftwareSoundBuffer::Seek(float SeekTime)
+{
+	if (ensure(DecompressionState))
+	{
+		DecompressionState->SeekToTime(SeekTime);
+	}
+}
+
+FSoftwareSoundBuffer* FSoftwareSoundBuffer::CreateQueuedBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave)
+{
+	FSoftwareSoundBuffer* Buffer = new FSoftwareSoundBuffer(AudioDevice, ESoftwareSoundFormat::PCMRealTime);
+
+	FSoundQualityInfo QualityInfo = { 0 };
+
+	Buffer->DecompressionState = AudioDevice->CreateCompressedAudioInfo(Wave);
+
+	Wave->InitAudioResource(AudioDevice->GetRuntimeFormat(Wave));
+
+	if (Buffer->DecompressionState && Buffer->DecompressionState->ReadCompressedInfo(Wave->ResourceData, Wave->ResourceSize, &QualityInfo))
+	{
+		Wave->SampleRate = QualityInfo.SampleRate;
+		Wave->NumChannels = QualityInfo.NumChannels;
+		Wave->RawPCMDataSize = QualityInfo.SampleDataSize;
+		Wave->Duration = QualityInfo.Duration;
+
+		Buffer->NumChannels = Wave->NumChannels;
+		Buffer->SampleRate = Wave->SampleRate;
+	}
+	else
+	{
+		Wave->DecompressionType = DTYPE_Invalid;
+		Wave->NumChannels = 0;
+
+		Wave->RemoveAudioResource();
+	}
+
+	return Buffer;
+}
+
+FSoftwareSoundBuffer* FSoftwareSoundBuffer::CreateProceduralBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave)
+{
+	FSoftwareSoundBuffer* Buffer = new FSoftwareSoundBuffer(AudioDevice, ESoftwareSoundFormat::Procedural);
+
+	Buffer->NumChannels = Wave->NumChannels;
+	Buffer->SampleRate = Wave->SampleRate;
+
+	// No tracking of this resource as it's temporary
+	Buffer->ResourceID = 0;
+	Wave->ResourceID = 0;
+
+	return Buffer;
+}
+
+FSoftwareSoundBuffer* FSoftwareSoundBuffer::CreatePreviewBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave, FSoftwareSoundBuffer* Buffer)
+{
+	if (Buffer)
+	{
+		AudioDevice->FreeBufferResource(Buffer);
+	}
+
+	// Create new buffer.
+	Buffer = new FSoftwareSoundBuffer(AudioDevice, ESoftwareSoundFormat::PCMPreview);
+
+	// Take ownership the PCM data
+	Buffer->PCMData = Wave->RawPCMData;
+	Buffer->PCMDataSize = Wave->RawPCMDataSize;
+
+	Wave->RawPCMData = nullptr;
+
+	// Copy over whether this data should be freed on delete
+	Buffer->bDynamicResource = Wave->bDynamicResource;
+
+	Buffer->NumChannels = Buffer->PCMData && Buffer->PCMDataSize > 0 ? Wave->NumChannels : 0;
+	Buffer->SampleRate = Wave->SampleRate;
+
+	AudioDevice->TrackResource(Wave, Buffer);
+
+	return Buffer;
+}
+
+FSoftwareSoundBuffer* FSoftwareSoundBuffer::CreateNativeBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave)
+{
+	// Check to see if thread has finished decompressing on the other thread
+	if (Wave->AudioDecompressor != nullptr)
+	{
+		Wave->AudioDecompressor->EnsureCompletion();
+
+		// Remove the decompressor
+		delete Wave->AudioDecompressor;
+		Wave->AudioDecompressor = nullptr;
+	}
+
+	// Create new buffer.
+	FSoftwareSoundBuffer* Buffer = new FSoftwareSoundBuffer(AudioDevice, ESoftwareSoundFormat::PCM);
+
+	// Take ownership the PCM data
+	Buffer->PCMData = Wave->RawPCMData;
+	Buffer->PCMDataSize = Wave->RawPCMDataSize;
+
+	Wave->RawPCMData = nullptr;
+
+	if (Buffer->PCMData == nullptr || Buffer->PCMDataSize == 0)
+	{
+		UE_LOG(LogSoftwareAudio, Warning, TEXT("Failed to create audio buffer for '%s'"), *Wave->GetFullName());
+	}
+
+	Buffer->NumChannels = Buffer->PCMData && Buffer->PCMDataSize > 0 ? Wave->NumChannels : 0;
+	Buffer->SampleRate = Wave->SampleRate;
+
+	AudioDevice->TrackResource(Wave, Buffer);
+
+	Wave->RemoveAudioResource();
+
+	return Buffer;
+}
+
+FSoftwareSoundBuffer* FSoftwareSoundBuffer::CreateStreamingBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave)
+{
+	// Always create a new buffer for streaming sounds
+	FSoftwareSoundBuffer* Buffer = new FSoftwareSoundBuffer(AudioDevice, ESoftwareSoundFormat::Streaming);
+
+	FSoundQualityInfo QualityInfo = { 0 };
+
+	Buffer->DecompressionState = AudioDevice->CreateCompressedAudioInfo(Wave);
+
+	if (Buffer->DecompressionState && Buffer->DecompressionState->StreamCompressedInfo(Wave, &QualityInfo))
+	{
+		// Refresh the wave data
+		Wave->SampleRate = QualityInfo.SampleRate;
+		Wave->NumChannels = QualityInfo.NumChannels;
+		Wave->RawPCMDataSize = QualityInfo.SampleDataSize;
+		Wave->Duration = QualityInfo.Duration;
+
+		Buffer->NumChannels = Wave->NumChannels;
+		Buffer->SampleRate = Wave->SampleRate;
+	}
+	else
+	{
+		Wave->DecompressionType = DTYPE_Invalid;
+		Wave->NumChannels = 0;
+
+		Wave->RemoveAudioResource();
+	}
+
+	return Buffer;
+}
+
+FSoftwareSoundBuffer* FSoftwareSoundBuffer::Init(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave, bool bForceRealTime)
+{
+	// Can't create a buffer without any source data
+	if (Wave == nullptr || Wave->NumChannels == 0)
+	{
+		return nullptr;
+	}
+
+	FSoftwareSoundBuffer* Buffer = nullptr;
+
+	// Allow the precache to happen if necessary
+	EDecompressionType DecompressionType = Wave->DecompressionType;
+	if (bForceRealTime && DecompressionType != DTYPE_Setup && DecompressionType != DTYPE_Streaming)
+	{
+		DecompressionType = DTYPE_RealTime;
+	}
+
+	switch (DecompressionType)
+	{
+	case DTYPE_Setup:
+		// Has circumvented precache mechanism - precache now
+		AudioDevice->Precache(Wave, true, false);
+
+		// if it didn't change, we will recurse forever
+		check(Wave->DecompressionType != DTYPE_Setup);
+
+		// Recall this function with new decompression type
+		return Init(AudioDevice, Wave, bForceRealTime);
+
+	case DTYPE_Preview:
+		// Find the existing buffer if any
+		if (Wave->ResourceID)
+		{
+			Buffer = (FSoftwareSoundBuffer*)AudioDevice->WaveBufferMap.FindRef(Wave->ResourceID);
+		}
+
+		// Override with any new PCM data even if some already exists.
+		if (Wave->RawPCMData)
+		{
+			Buffer = CreatePreviewBuffer(AudioDevice, Wave, Buffer);
+		}
+		break;
+
+	case DTYPE_Procedural:
+		// Always create a new buffer for streaming procedural data
+		Buffer = CreateProceduralBuffer(AudioDevice, Wave);
+		break;
+
+	case DTYPE_RealTime:
+		// Always create a new buffer for real time decompressed data
+		Buffer = CreateQueuedBuffer(AudioDevice, Wave);
+		break;
+
+	case DTYPE_Native:
+		if (Wave->ResourceID)
+		{
+			Buffer = (FSoftwareSoundBuffer*)AudioDevice->WaveBufferMap.FindRef(Wave->ResourceID);
+		}
+
+		if (Buffer == nullptr)
+		{
+			Buffer = CreateNativeBuffer(AudioDevice, Wave);
+		}
+		break;
+
+	case DTYPE_Streaming:
+		// Always create a new buffer for streaming sounds
+		Buffer = CreateStreamingBuffer(AudioDevice, Wave);
+		break;
+
+	case DTYPE_Invalid:
+	default:
+		// Invalid will be set if the wave cannot be played
+		break;
+	}
+
+	return Buffer;
+}
@@ -0,0 +1,104 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioDevice.cpp: Audio device mixing every source in software.
+=============================================================================*/
+
+#include "SoftwareAudioDevice.h"
+#include "SoftwareAudioMixer.h"
+#include "SoftwareAudioOutput.h"
+#include "VorbisAudioInfo.h"
+
+DEFINE_LOG_CATEGORY(LogSoftwareAudio);
+
+class FSoftwareAudioDeviceModule : public IAudioDeviceModule
+{
+public:
+
+	/** Creates a new instance of the audio device implemented by the module. */
+	virtual FAudioDevice* CreateAudioDevice() override
+	{
+		return new FSoftwareAudioDevice;
+	}
+};
+
+IMPLEMENT_MODULE(FSoftwareAudioDeviceModule, SoftwareAudio);
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioDevice.
+------------------------------------------------------------------------------------*/
+
+FSoftwareAudioDevice::FSoftwareAudioDevice()
+	: Mixer(nullptr)
+{
+}
+
+FSoftwareAudioDevice::~FSoftwareAudioDevice()
+{
+	// Sources destroy their voices, the mixer outlives them
+	delete Mixer;
+	Mixer = nullptr;
+}
+
+bool FSoftwareAudioDevice::InitializeHardware()
+{
+	FString OutputName = TEXT("Null");
+	int32 SampleRate = 48000;
+	int32 BlockFrames = 256;
+	GConfig->GetString(TEXT("SoftwareAudio"), TEXT("OutputName"), OutputName, GEngineIni);
+	GConfig->GetInt(TEXT("SoftwareAudio"), TEXT("SampleRate"), SampleRate, GEngineIni);
+	GConfig->GetInt(TEXT("SoftwareAudio"), TEXT("BlockFrames"), BlockFrames, GEngineIni);
+	FParse::Value(FCommandLine::Get(), TEXT("SoftwareAudioOutput="), OutputName);
+
+	ISoftwareAudioOutput* Output = FSoftwareAudioOutputRegistry::CreateOutput(*OutputName);
+	if (!Output)
+	{
+		UE_LOG(LogSoftwareAudio, Warning, TEXT("No software audio output named '%s', using the null output."), *OutputName);
+		OutputName = TEXT("Null");
+		Output = FSoftwareAudioOutputRegistry::CreateOutput(*OutputName);
+	}
+
+	Mixer = new FSoftwareAudioMixer(Output, SampleRate, BlockFrames);
+	if (!Mixer->StartThread())
+	{
+		UE_LOG(LogSoftwareAudio, Warning, TEXT("Failed to start the software mixer with the '%s' output."), *OutputName);
+		delete Mixer;
+		Mixer = nullptr;
+		return false;
+	}
+
+	UE_LOG(LogSoftwareAudio, Log, TEXT("Software mixer started: '%s' output, %d Hz, %d frames per block."), *OutputName, Mixer->GetSampleRate(), Mixer->GetBlockFrames());
+	return true;
+}
+
+void FSoftwareAudioDevice::TeardownHardware()
+{
+	// The sources are stopped and deleted after this, only with the mixer thread stopped
+	if (Mixer)
+	{
+		Mixer->StopThread();
+	}
+}
+
+FSoundSource* FSoftwareAudioDevice::CreateSoundSource()
+{
+	return new FSoftwareSoundSource(this);
+}
+
+bool FSoftwareAudioDevice::HasCompressedAudioInfoClass(USoundWave* SoundWave)
+{
+#if WITH_OGGVORBIS
+	return true;
+#else
+	return false;
+#endif
+}
+
+class ICompressedAudioInfo* FSoftwareAudioDevice::CreateCompressedAudioInfo(USoundWave* SoundWave)
+{
+#if WITH_OGGVORBIS
+	return new FVorbisAudioInfo();
+#else
+	return nullptr;
+#endif
+}
@@ -0,0 +1,713 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioMixer.cpp: Mixes the voices of the software audio device.
+=============================================================================*/
+
+#include "SoftwareAudioDevice.h"
+#include "SoftwareAudioMixer.h"
+#include "SoftwareAudioOutput.h"
+
+DECLARE_CYCLE_STAT(TEXT("Software Mixer Block"), STAT_SoftwareMixerBlock, STATGROUP_Audio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Software Mixer Voices"), STAT_SoftwareMixerVoices, STATGROUP_Audio);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Software Mixer Voices Per ms"), STAT_SoftwareMixerVoicesPerMs, STATGROUP_Audio);
+
+static TAutoConsoleVariable<int32> CVarSoftwareMixerVoicesPerTask(
+	TEXT("au.SoftwareMixer.VoicesPerTask"),
+	8,
+	TEXT("Minimum number of voices the software mixer gives to each worker thread.\n")
+	TEXT("0 mixes every voice on the mixer thread."));
+
+/*------------------------------------------------------------------------------------
+	Vectorized helpers, every buffer is 16 byte aligned and holds a multiple of 4 samples.
+------------------------------------------------------------------------------------*/
+
+/** Adds Src scaled by a gain ramping linearly from StartGain to EndGain to Dest */
+static void MixChannel(const float* RESTRICT Src, float* RESTRICT Dest, int32 NumSamples, float StartGain, float EndGain)
+{
+	checkSlow(NumSamples % 4 == 0);
+
+	const float Step = (EndGain - StartGain) / NumSamples;
+	VectorRegister Gain = VectorSet(StartGain, StartGain + Step, StartGain + 2.0f * Step, StartGain + 3.0f * Step);
+	const VectorRegister GainStep = VectorSetFloat1(4.0f * Step);
+
+	for (int32 Index = 0; Index < NumSamples; Index += 4)
+	{
+		VectorStoreAligned(VectorMultiplyAdd(VectorLoadAligned(Src + Index), Gain, VectorLoadAligned(Dest + Index)), Dest + Index);
+		Gain = VectorAdd(Gain, GainStep);
+	}
+}
+
+/** Adds Src to Dest */
+static void AddChannel(const float* RESTRICT Src, float* RESTRICT Dest, int32 NumSamples)
+{
+	checkSlow(NumSamples % 4 == 0);
+
+	for (int32 Index = 0; Index < NumSamples; Index += 4)
+	{
+		VectorStoreAligned(VectorAdd(VectorLoadAligned(Src + Index), VectorLoadAligned(Dest + Index)), Dest + Index);
+	}
+}
+
+/** Clamps the samples to [-1, 1] */
+static void ClampChannel(float* Samples, int32 NumSamples)
+{
+	checkSlow(NumSamples % 4 == 0);
+
+	const VectorRegister MinSample = VectorSetFloat1(-1.0f);
+	const VectorRegister MaxSample = VectorSetFloat1(1.0f);
+	for (int32 Index = 0; Index < NumSamples; Index += 4)
+	{
+		VectorStoreAligned(VectorMax(VectorMin(VectorLoadAligned(Samples + Index), MaxSample), MinSample), Samples + Index);
+	}
+}
+
+/** Grows a scratch array to hold at least NumElements, scratch arrays never shrink so mixing doesn't allocate */
+template<typename ElementType>
+static FORCEINLINE void GrowScratch(TArray<ElementType>& Scratch, int32 NumElements)
+{
+	if (Scratch.Num() < NumElements)
+	{
+		Scratch.SetNumUninitialized(NumElements);
+	}
+}
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioVoice.
+------------------------------------------------------------------------------------*/
+
+FSoftwareAudioVoiceParams::FSoftwareAudioVoiceParams()
+	: ResampleRatio(1.0f)
+	, FilterCoefficient(1.0f)
+{
+	FMemory::Memzero(TargetGains);
+}
+
+FSoftwareAudioVoiceStatus::FSoftwareAudioVoiceStatus()
+	: PlaybackSerial(0)
+	, NumLoops(0)
+	, bFinished(false)
+	, NumQueuedBytesRead(0)
+{
+}
+
+FSoftwareAudioVoice::FSoftwareAudioVoice()
+	: Buffer(nullptr)
+	, bPlaying(false)
+	, bLooping(false)
+	, PlaybackSerial(0)
+{
+	ResetPlayback();
+}
+
+void FSoftwareAudioVoice::ResetPlayback()
+{
+	QueuedData.Reset();
+	bQueuedDataEnds = false;
+	FMemory::Memzero(CurrentGains);
+	bGainsInitialized = false;
+	FMemory::Memzero(CarriedFrames);
+	bPrimed = false;
+	Phase = 0.0f;
+	FMemory::Memzero(FilterState);
+	ReadFrame = 0;
+	DecompressedData.Reset();
+	DecompressedOffset = 0;
+	bDecompressedLast = false;
+	NumLoops = 0;
+	bFinished = false;
+	NumQueuedBytesRead = 0;
+}
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioMixTask.
+------------------------------------------------------------------------------------*/
+
+/** Task mixing a range of the voices on a worker thread. */
+class FSoftwareAudioMixTask
+{
+	FSoftwareAudioMixer& Mixer;
+	FSoftwareAudioMixer::FMixContext& Context;
+	int32 FirstVoice;
+	int32 NumVoices;
+
+public:
+	FSoftwareAudioMixTask(FSoftwareAudioMixer& InMixer, FSoftwareAudioMixer::FMixContext& InContext, int32 InFirstVoice, int32 InNumVoices)
+		: Mixer(InMixer)
+		, Context(InContext)
+		, FirstVoice(InFirstVoice)
+		, NumVoices(InNumVoices)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSoftwareAudioMixTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Mixer.MixVoices(Context, FirstVoice, NumVoices);
+	}
+};
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioMixer.
+------------------------------------------------------------------------------------*/
+
+FSoftwareAudioMixer::FSoftwareAudioMixer(ISoftwareAudioOutput* InOutput, int32 InSampleRate, int32 InBlockFrames)
+	: Output(InOutput)
+	, SampleRate(FMath::Max(InSampleRate, 8000))
+	, BlockFrames(Align(FMath::Max(InBlockFrames, 4), 4))
+	, Thread(nullptr)
+{
+	OutputBlock.SetNumZeroed(BlockFrames * SOFTWARE_AUDIO_OUTPUT_CHANNELS);
+	GetContext(0);
+}
+
+FSoftwareAudioMixer::~FSoftwareAudioMixer()
+{
+	StopThread();
+
+	delete Output;
+	Output = nullptr;
+
+	// Voices destroyed after the thread stopped are deleted by their commands
+	ProcessCommands();
+
+	for (int32 VoiceIndex = 0; VoiceIndex < Voices.Num(); VoiceIndex++)
+	{
+		delete Voices[VoiceIndex];
+	}
+	Voices.Empty();
+}
+
+bool FSoftwareAudioMixer::Init()
+{
+	bKeepRunning.Set(1);
+	return true;
+}
+
+uint32 FSoftwareAudioMixer::Run()
+{
+	const double BlockSeconds = (double)BlockFrames / SampleRate;
+	double NextBlockTime = FPlatformTime::Seconds();
+
+	while (bKeepRunning.GetValue() != 0)
+	{
+		MixBlock(OutputBlock.GetData());
+		Output->Write(OutputBlock.GetData(), BlockFrames);
+
+		if (!Output->IsPacedByHardware())
+		{
+			// Keep mixing in real time so sounds finish when they would on hardware
+			NextBlockTime += BlockSeconds;
+			const double CurrentTime = FPlatformTime::Seconds();
+			if (NextBlockTime > CurrentTime)
+			{
+				FPlatformProcess::Sleep((float)(NextBlockTime - CurrentTime));
+			}
+			else if (CurrentTime - NextBlockTime > 4.0 * BlockSeconds)
+			{
+				// Don't try to catch up after a hitch
+				NextBlockTime = CurrentTime;
+			}
+		}
+	}
+
+	return 0;
+}
+
+void FSoftwareAudioMixer::Stop()
+{
+	bKeepRunning.Set(0);
+}
+
+bool FSoftwareAudioMixer::StartThread()
+{
+	check(Output && !Thread);
+
+	if (!Output->Open(SampleRate, SOFTWARE_AUDIO_OUTPUT_CHANNELS))
+	{
+		return false;
+	}
+
+	Thread = FRunnableThread::Create(this, TEXT("SoftwareAudioMixer"), 0, TPri_AboveNormal);
+	if (!Thread)
+	{
+		Output->Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FSoftwareAudioMixer::StopThread()
+{
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+
+		Output->Close();
+	}
+}
+
+FSoftwareAudioVoice* FSoftwareAudioMixer::CreateVoice()
+{
+	FSoftwareAudioVoice* Voice = new FSoftwareAudioVoice();
+
+	RunCommand([this, Voice]()
+	{
+		Voices.Add(Voice);
+	});
+	return Voice;
+}
+
+void FSoftwareAudioMixer::DestroyVoice(FSoftwareAudioVoice* Voice)
+{
+	RunCommand([this, Voice]()
+	{
+		Voices.RemoveSingleSwap(Voice);
+		delete Voice;
+	});
+}
+
+void FSoftwareAudioMixer::RunCommand(TFunction<void()> Command)
+{
+	Commands.Enqueue(Command);
+	NumCommandsQueued.Increment();
+}
+
+void FSoftwareAudioMixer::FlushCommands()
+{
+	if (!Thread)
+	{
+		ProcessCommands();
+		return;
+	}
+
+	const int32 NumQueued = NumCommandsQueued.GetValue();
+	while (NumCommandsRun.GetValue() - NumQueued < 0)
+	{
+		FPlatformProcess::Sleep(0.0f);
+	}
+}
+
+FSoftwareAudioVoiceStatus FSoftwareAudioMixer::GetVoiceStatus(const FSoftwareAudioVoice* Voice)
+{
+	FScopeLock Lock(&StatusLock);
+	return Voice->Status;
+}
+
+void FSoftwareAudioMixer::ProcessCommands()
+{
+	TFunction<void()> Command;
+	while (Commands.Dequeue(Command))
+	{
+		Command();
+		NumCommandsRun.Increment();
+	}
+}
+
+FSoftwareAudioMixer::FMixContext& FSoftwareAudioMixer::GetContext(int32 Index)
+{
+	while (Contexts.Num() <= Index)
+	{
+		FMixContext* Context = new FMixContext();
+		for (int32 Channel = 0; Channel < SOFTWARE_AUDIO_OUTPUT_CHANNELS; Channel++)
+		{
+			Context->Buses[Channel].SetNumZeroed(BlockFrames);
+		}
+		Context->Resampled.SetNumZeroed(BlockFrames);
+		Contexts.Add(Context);
+	}
+
+	return Contexts[Index];
+}
+
+void FSoftwareAudioMixer::MixBlock(float* OutSamples)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoftwareMixerBlock);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Nothing else changes the voices while the block is mixed
+	ProcessCommands();
+
+	PlayingVoices.Reset();
+	for (int32 VoiceIndex = 0; VoiceIndex < Voices.Num(); VoiceIndex++)
+	{
+		FSoftwareAudioVoice* Voice = Voices[VoiceIndex];
+		if (Voice->bPlaying && Voice->Buffer && !Voice->bFinished)
+		{
+			PlayingVoices.Add(Voice);
+		}
+	}
+
+	const int32 NumVoices = PlayingVoices.Num();
+	const int32 VoicesPerTask = CVarSoftwareMixerVoicesPerTask.GetValueOnAnyThread();
+
+	int32 NumTasks = 1;
+	if (VoicesPerTask > 0 && NumVoices > VoicesPerTask && FApp::ShouldUseThreadingForPerformance())
+	{
+		NumTasks = FMath::Min(FMath::DivideAndRoundUp(NumVoices, VoicesPerTask), FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	}
+
+	// Contexts are created up front, the tasks reference them while they run
+	GetContext(NumTasks - 1);
+
+	int32 NumContexts = 1;
+	if (NumTasks > 1)
+	{
+		// The mixer thread mixes the first range
+		const int32 VoicesPerRange = FMath::DivideAndRoundUp(NumVoices, NumTasks);
+		FGraphEventArray Tasks;
+		for (int32 FirstVoice = VoicesPerRange; FirstVoice < NumVoices; FirstVoice += VoicesPerRange)
+		{
+			Tasks.Add(TGraphTask<FSoftwareAudioMixTask>::CreateTask().ConstructAndDispatchWhenReady(*this, Contexts[NumContexts++], FirstVoice, FMath::Min(VoicesPerRange, NumVoices - FirstVoice)));
+		}
+		MixVoices(Contexts[0], 0, FMath::Min(VoicesPerRange, NumVoices));
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks);
+	}
+	else
+	{
+		MixVoices(Contexts[0], 0, NumVoices);
+	}
+
+	float* Buses[SOFTWARE_AUDIO_OUTPUT_CHANNELS];
+	for (int32 Channel = 0; Channel < SOFTWARE_AUDIO_OUTPUT_CHANNELS; Channel++)
+	{
+		Buses[Channel] = Contexts[0].Buses[Channel].GetData();
+		for (int32 ContextIndex = 1; ContextIndex < NumContexts; ContextIndex++)
+		{
+			AddChannel(Contexts[ContextIndex].Buses[Channel].GetData(), Buses[Channel], BlockFrames);
+		}
+		ClampChannel(Buses[Channel], BlockFrames);
+	}
+
+	for (int32 Frame = 0; Frame < BlockFrames; Frame++)
+	{
+		for (int32 Channel = 0; Channel < SOFTWARE_AUDIO_OUTPUT_CHANNELS; Channel++)
+		{
+			*OutSamples++ = Buses[Channel][Frame];
+		}
+	}
+
+	{
+		FScopeLock Lock(&StatusLock);
+		for (int32 VoiceIndex = 0; VoiceIndex < NumVoices; VoiceIndex++)
+		{
+			FSoftwareAudioVoice* Voice = PlayingVoices[VoiceIndex];
+			Voice->Status.PlaybackSerial = Voice->PlaybackSerial;
+			Voice->Status.NumLoops = Voice->NumLoops;
+			Voice->Status.bFinished = Voice->bFinished;
+			Voice->Status.NumQueuedBytesRead = Voice->NumQueuedBytesRead;
+		}
+	}
+
+	const float MixTimeMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	SET_DWORD_STAT(STAT_SoftwareMixerVoices, NumVoices);
+	SET_FLOAT_STAT(STAT_SoftwareMixerVoicesPerMs, MixTimeMs > 0.0f ? NumVoices / MixTimeMs : 0.0f);
+}
+
+void FSoftwareAudioMixer::MixVoices(FMixContext& Context, int32 FirstVoice, int32 NumVoices)
+{
+	for (int32 Channel = 0; Channel < SOFTWARE_AUDIO_OUTPUT_CHANNELS; Channel++)
+	{
+		FMemory::Memzero(Context.Buses[Channel].GetData(), BlockFrames * sizeof(float));
+	}
+
+	for (int32 VoiceIndex = FirstVoice; VoiceIndex < FirstVoice + NumVoices; VoiceIndex++)
+	{
+		MixVoice(Context, *PlayingVoices[VoiceIndex]);
+	}
+}
+
+void FSoftwareAudioMixer::MixVoice(FMixContext& Context, FSoftwareAudioVoice& Voice)
+{
+	const int32 BufferChannels = Voice.Buffer->NumChannels;
+	const int32 NumChannels = FMath::Min(BufferChannels, SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS);
+	const float Ratio = FMath::Clamp(Voice.Params.ResampleRatio, 0.01f, SOFTWARE_AUDIO_MAX_RESAMPLE_RATIO);
+
+	// The first two frames are read ahead of the first block, the resampler always interpolates between read frames
+	if (!Voice.bPrimed)
+	{
+		GrowScratch(Context.ReadFrames, 2 * BufferChannels);
+		ReadVoiceFrames(Voice, Context.ReadFrames.GetData(), 2);
+		for (int32 Channel = 0; Channel < NumChannels; Channel++)
+		{
+			Voice.CarriedFrames[Channel][0] = Context.ReadFrames[Channel] / 32768.0f;
+			Voice.CarriedFrames[Channel][1] = Context.ReadFrames[BufferChannels + Channel] / 32768.0f;
+		}
+		Voice.Phase = 0.0f;
+		Voice.bPrimed = true;
+	}
+
+	// Output frame i is at Phase + i * Ratio frames after the first carried frame. The frames up to the one the next block
+	// starts from are read, and the last two are carried to the next block.
+	const float EndPosition = Voice.Phase + BlockFrames * Ratio;
+	const int32 NumNewFrames = FMath::FloorToInt(EndPosition);
+	const int32 NumSourceFrames = NumNewFrames + 2;
+
+	GrowScratch(Context.ReadFrames, FMath::Max(NumNewFrames, 1) * BufferChannels);
+	if (NumNewFrames > 0)
+	{
+		ReadVoiceFrames(Voice, Context.ReadFrames.GetData(), NumNewFrames);
+	}
+	GrowScratch(Context.SourceFrames, NumSourceFrames);
+
+	const int16* ReadFrames = Context.ReadFrames.GetData();
+	float* SourceFrames = Context.SourceFrames.GetData();
+	float* Resampled = Context.Resampled.GetData();
+
+	for (int32 Channel = 0; Channel < NumChannels; Channel++)
+	{
+		SourceFrames[0] = Voice.CarriedFrames[Channel][0];
+		SourceFrames[1] = Voice.CarriedFrames[Channel][1];
+		for (int32 Frame = 0; Frame < NumNewFrames; Frame++)
+		{
+			SourceFrames[Frame + 2] = ReadFrames[Frame * BufferChannels + Channel] / 32768.0f;
+		}
+		Voice.CarriedFrames[Channel][0] = SourceFrames[NumNewFrames];
+		Voice.CarriedFrames[Channel][1] = SourceFrames[NumNewFrames + 1];
+
+		// Linear interpolation, positions are computed from the start of the block so they never pass EndPosition
+		for (int32 Frame = 0; Frame < BlockFrames; Frame++)
+		{
+			const float Position = Voice.Phase + Frame * Ratio;
+			const int32 Index = FMath::TruncToInt(Position);
+			const float Alpha = Position - Index;
+			Resampled[Frame] = SourceFrames[Index] + Alpha * (SourceFrames[Index + 1] - SourceFrames[Index]);
+		}
+
+		if (Voice.Params.FilterCoefficient < 1.0f)
+		{
+			float FilterState = Voice.FilterState[Channel];
+			for (int32 Frame = 0; Frame < BlockFrames; Frame++)
+			{
+				FilterState += Voice.Params.FilterCoefficient * (Resampled[Frame] - FilterState);
+				Resampled[Frame] = FilterState;
+			}
+			Voice.FilterState[Channel] = FilterState;
+		}
+
+		for (int32 OutputChannel = 0; OutputChannel < SOFTWARE_AUDIO_OUTPUT_CHANNELS; OutputChannel++)
+		{
+			const float EndGain = Voice.Params.TargetGains[Channel][OutputChannel];
+			const float StartGain = Voice.bGainsInitialized ? Voice.CurrentGains[Channel][OutputChannel] : EndGain;
+			if (StartGain != 0.0f || EndGain != 0.0f)
+			{
+				MixChannel(Resampled, Context.Buses[OutputChannel].GetData(), BlockFrames, StartGain, EndGain);
+			}
+			Voice.CurrentGains[Channel][OutputChannel] = EndGain;
+		}
+	}
+
+	Voice.Phase = EndPosition - NumNewFrames;
+	Voice.bGainsInitialized = true;
+}
+
+void FSoftwareAudioMixer::ReadVoiceFrames(FSoftwareAudioVoice& Voice, int16* Dest, int32 NumFrames)
+{
+	FSoftwareSoundBuffer* Buffer = Voice.Buffer;
+	const int32 NumChannels = Buffer->NumChannels;
+	const int32 FrameSize = NumChannels * sizeof(int16);
+
+	switch (Buffer->SoundFormat)
+	{
+	case ESoftwareSoundFormat::PCM:
+	case ESoftwareSoundFormat::PCMPreview:
+		{
+			const int32 NumBufferFrames = Buffer->GetNumFrames();
+			const int16* BufferFrames = (const int16*)Buffer->PCMData;
+			while (NumFrames > 0)
+			{
+				if (Voice.ReadFrame >= NumBufferFrames)
+				{
+					if (!Voice.bLooping || NumBufferFrames == 0)
+					{
+						Voice.bFinished = true;
+						break;
+					}
+					Voice.ReadFrame = 0;
+					Voice.NumLoops++;
+				}
+
+				const int32 NumCopied = FMath::Min(NumFrames, NumBufferFrames - Voice.ReadFrame);
+				FMemory::Memcpy(Dest, BufferFrames + Voice.ReadFrame * NumChannels, NumCopied * FrameSize);
+				Dest += NumCopied * NumChannels;
+				NumFrames -= NumCopied;
+				Voice.ReadFrame += NumCopied;
+			}
+		}
+		break;
+
+	case ESoftwareSoundFormat::PCMRealTime:
+		while (NumFrames > 0)
+		{
+			if (Voice.DecompressedOffset >= Voice.DecompressedData.Num())
+			{
+				if (Voice.bDecompressedLast)
+				{
+					Voice.bFinished = true;
+					break;
+				}
+
+				// Looping sounds are decompressed seamlessly, the end of the data is reached once per loop
+				GrowScratch(Voice.DecompressedData, MONO_PCM_BUFFER_SIZE * NumChannels);
+				Voice.DecompressedOffset = 0;
+				if (Buffer->ReadCompressedData(Voice.DecompressedData.GetData(), Voice.bLooping))
+				{
+					if (Voice.bLooping)
+					{
+						Voice.NumLoops++;
+					}
+					else
+					{
+						Voice.bDecompressedLast = true;
+					}
+				}
+			}
+
+			const int32 NumCopied = FMath::Min(NumFrames, (Voice.DecompressedData.Num() - Voice.DecompressedOffset) / FrameSize);
+			FMemory::Memcpy(Dest, Voice.DecompressedData.GetData() + Voice.DecompressedOffset, NumCopied * FrameSize);
+			Dest += NumCopied * NumChannels;
+			NumFrames -= NumCopied;
+			Voice.DecompressedOffset += NumCopied * FrameSize;
+		}
+		break;
+
+	case ESoftwareSoundFormat::Procedural:
+	case ESoftwareSoundFormat::Streaming:
+		{
+			// The source queues the data on the thread updating the audio device, streamed chunks can't be accessed from
+			// other threads. Silence is played when the source is late.
+			const int32 NumCopied = FMath::Min(NumFrames, Voice.QueuedData.Num() / FrameSize);
+			FMemory::Memcpy(Dest, Voice.QueuedData.GetData(), NumCopied * FrameSize);
+			Voice.QueuedData.RemoveAt(0, NumCopied * FrameSize, false);
+			Voice.NumQueuedBytesRead += NumCopied * FrameSize;
+			Dest += NumCopied * NumChannels;
+			NumFrames -= NumCopied;
+
+			if (NumFrames > 0 && Voice.bQueuedDataEnds)
+			{
+				Voice.bFinished = true;
+			}
+		}
+		break;
+	}
+
+	// Pad with silence at the end of the buffer
+	if (NumFrames > 0)
+	{
+		FMemory::Memzero(Dest, NumFrames * FrameSize);
+	}
+}
+
+/*------------------------------------------------------------------------------------
+	Benchmark.
+------------------------------------------------------------------------------------*/
+
+/**
+ * Mixes looping sine waves synchronously, without an output, and logs the time each block takes and how many voices the
+ * mixer can mix in real time.
+ */
+static void BenchmarkSoftwareMixer(const TArray<FString>& Args)
+{
+	const int32 NumVoices = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 128;
+	const int32 NumBlocks = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000;
+
+	int32 SampleRate = 48000;
+	int32 BlockFrames = 256;
+	GConfig->GetInt(TEXT("SoftwareAudio"), TEXT("SampleRate"), SampleRate, GEngineIni);
+	GConfig->GetInt(TEXT("SoftwareAudio"), TEXT("BlockFrames"), BlockFrames, GEngineIni);
+
+	FSoftwareAudioMixer Mixer(nullptr, SampleRate, BlockFrames);
+
+	// Mono and stereo waves of different rates and lengths, so the voices resample at different ratios and loop at different times
+	const int32 WaveSampleRates[] = { 44100, 22050, 48000, 32000 };
+	const int32 WaveChannels[] = { 1, 2, 1, 2 };
+	TArray<FSoftwareSoundBuffer*> Buffers;
+	for (int32 WaveIndex = 0; WaveIndex < ARRAY_COUNT(WaveSampleRates); WaveIndex++)
+	{
+		FSoftwareSoundBuffer* Buffer = new FSoftwareSoundBuffer(nullptr, ESoftwareSoundFormat::PCM);
+		Buffer->NumChannels = WaveChannels[WaveIndex];
+		Buffer->SampleRate = WaveSampleRates[WaveIndex];
+
+		const int32 NumFrames = Buffer->SampleRate / (WaveIndex + 1);
+		Buffer->PCMDataSize = NumFrames * Buffer->NumChannels * sizeof(int16);
+		int16* Samples = (int16*)FMemory::Malloc(Buffer->PCMDataSize);
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (int32 Channel = 0; Channel < Buffer->NumChannels; Channel++)
+			{
+				const float Frequency = 220.0f * (WaveIndex + 1) * (Channel + 1);
+				Samples[Frame * Buffer->NumChannels + Channel] = (int16)(16000.0f * FMath::Sin(2.0f * PI * Frequency * Frame / Buffer->SampleRate));
+			}
+		}
+		Buffer->PCMData = (const uint8*)Samples;
+		Buffers.Add(Buffer);
+	}
+
+	// The mixer has no thread, the voices can be set up directly before the first block
+	TArray<FSoftwareAudioVoice*> Voices;
+	for (int32 VoiceIndex = 0; VoiceIndex < NumVoices; VoiceIndex++)
+	{
+		FSoftwareAudioVoice* Voice = Mixer.CreateVoice();
+		Voice->Buffer = Buffers[VoiceIndex % Buffers.Num()];
+		Voice->bPlaying = true;
+		Voice->bLooping = true;
+		Voice->Params.ResampleRatio = (0.5f + (VoiceIndex % 7) / 6.0f) * Voice->Buffer->SampleRate / Mixer.GetSampleRate();
+		Voice->Params.FilterCoefficient = VoiceIndex % 4 == 0 ? 0.3f : 1.0f;
+		const float Pan = (VoiceIndex % 9) / 8.0f;
+		for (int32 Channel = 0; Channel < Voice->Buffer->NumChannels; Channel++)
+		{
+			Voice->Params.TargetGains[Channel][0] = FMath::Cos(Pan * HALF_PI) / NumVoices;
+			Voice->Params.TargetGains[Channel][1] = FMath::Sin(Pan * HALF_PI) / NumVoices;
+		}
+		Voices.Add(Voice);
+	}
+
+	TArray<float> Block;
+	Block.SetNumUninitialized(Mixer.GetBlockFrames() * SOFTWARE_AUDIO_OUTPUT_CHANNELS);
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex++)
+	{
+		Mixer.MixBlock(Block.GetData());
+	}
+	const double MsPerBlock = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumBlocks;
+	const double BlockMs = 1000.0 * Mixer.GetBlockFrames() / Mixer.GetSampleRate();
+
+	UE_LOG(LogSoftwareAudio, Display, TEXT("Mixed %d voices in %d blocks of %d frames at %d Hz: %.3f ms per block of %.3f ms, %.1f voices per ms, about %d voices in real time."),
+		NumVoices, NumBlocks, Mixer.GetBlockFrames(), Mixer.GetSampleRate(), MsPerBlock, BlockMs, NumVoices / FMath::Max(MsPerBlock, 0.000001),
+		FMath::FloorToInt((float)(NumVoices * BlockMs / FMath::Max(MsPerBlock, 0.000001))));
+
+	for (int32 VoiceIndex = 0; VoiceIndex < Voices.Num(); VoiceIndex++)
+	{
+		Mixer.DestroyVoice(Voices[VoiceIndex]);
+	}
+	Mixer.FlushCommands();
+	for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); BufferIndex++)
+	{
+		delete Buffers[BufferIndex];
+	}
+}
+
+static FAutoConsoleCommand SoftwareMixerBenchmarkCommand(
+	TEXT("au.SoftwareMixer.Benchmark"),
+	TEXT("Mixes looping sine waves with the software mixer and logs its throughput. Arguments: [NumVoices] [NumBlocks]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSoftwareMixer));
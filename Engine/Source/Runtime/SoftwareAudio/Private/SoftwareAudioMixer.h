@@ -0,0 +1,244 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioMixer.h: Mixes the voices of the software audio device.
+=============================================================================*/
+
+#pragma once
+
+class ISoftwareAudioOutput;
+class FSoftwareSoundBuffer;
+
+/** Channels of the mixed blocks, sources with more channels are folded down to them */
+#define SOFTWARE_AUDIO_OUTPUT_CHANNELS	2
+/** Channels of the sources the mixer plays */
+#define SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS	8
+/** Highest rate at which a voice reads its buffer, in source frames per output frame */
+#define SOFTWARE_AUDIO_MAX_RESAMPLE_RATIO	4.0f
+
+/** Float array the vector intrinsics can load and store */
+typedef TArray<float, TAlignedHeapAllocator<16> > FSoftwareAudioSampleArray;
+
+/** Parameters of a voice the source updates every frame */
+struct FSoftwareAudioVoiceParams
+{
+	FSoftwareAudioVoiceParams();
+
+	/** Source frames read per output frame */
+	float ResampleRatio;
+	/** Coefficient of the one pole low pass filter, 1 when the voice isn't filtered */
+	float FilterCoefficient;
+	/** Gains of each channel of the buffer to the left and right outputs */
+	float TargetGains[SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS][SOFTWARE_AUDIO_OUTPUT_CHANNELS];
+};
+
+/** Playback state of a voice the mixer publishes after each block, read by the source */
+struct FSoftwareAudioVoiceStatus
+{
+	FSoftwareAudioVoiceStatus();
+
+	/** Playback the state belongs to, the state of a previous playback of the voice is stale */
+	int32 PlaybackSerial;
+	/** Number of times the buffer looped */
+	int32 NumLoops;
+	/** Whether every frame of a non looping buffer was played */
+	bool bFinished;
+	/** Bytes of the queued data the mixer read */
+	int32 NumQueuedBytesRead;
+};
+
+/**
+ * State of a source while the mixer plays it. Only the mixer thread touches a voice: the source changes it with commands
+ * the mixer runs at the start of a block (see FSoftwareAudioMixer::RunCommand), and reads back the status the mixer
+ * publishes after the block (see FSoftwareAudioMixer::GetVoiceStatus).
+ */
+struct FSoftwareAudioVoice
+{
+	FSoftwareAudioVoice();
+
+	// Parameters set by the source
+
+	/** Buffer being played, nullptr when the voice is free */
+	FSoftwareSoundBuffer* Buffer;
+	/** Whether the voice is mixed */
+	bool bPlaying;
+	/** Whether the buffer restarts when it reaches its end */
+	bool bLooping;
+	/** Resampling, filtering and gains */
+	FSoftwareAudioVoiceParams Params;
+	/** Interleaved 16 bit PCM data queued by the source for procedural and streaming buffers, consumed by the mixer */
+	TArray<uint8> QueuedData;
+	/** Whether the end of a streaming buffer was queued */
+	bool bQueuedDataEnds;
+	/** Playback started by the source, increased each time it plays a new wave instance */
+	int32 PlaybackSerial;
+
+	// Playback state updated by the mixer
+
+	/** Gains the last block ended with, the next block ramps from them to the target gains */
+	float CurrentGains[SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS][SOFTWARE_AUDIO_OUTPUT_CHANNELS];
+	/** Whether CurrentGains were set, the first block starts at the target gains */
+	bool bGainsInitialized;
+	/** Last two source frames read, the resampler interpolates between them and the next ones */
+	float CarriedFrames[SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS][2];
+	/** Whether CarriedFrames were read */
+	bool bPrimed;
+	/** Position of the next output frame between the two carried frames */
+	float Phase;
+	/** State of the low pass filter for each channel */
+	float FilterState[SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS];
+	/** Next frame read from a PCM buffer */
+	int32 ReadFrame;
+	/** Decompressed data of a real time buffer */
+	TArray<uint8> DecompressedData;
+	/** Bytes of DecompressedData already read */
+	int32 DecompressedOffset;
+	/** Whether the last decompressed data reached the end of a real time buffer */
+	bool bDecompressedLast;
+	/** Number of times the buffer looped */
+	int32 NumLoops;
+	/** Whether every frame of a non looping buffer was played */
+	bool bFinished;
+	/** Bytes of QueuedData read so far */
+	int32 NumQueuedBytesRead;
+
+	/** Playback state published after the last block, guarded by the status lock of the mixer */
+	FSoftwareAudioVoiceStatus Status;
+
+	/** Clears the playback state, before the voice starts playing a buffer */
+	void ResetPlayback();
+};
+
+/**
+ * Mixes the playing voices into blocks of stereo frames and writes them to an output, on its own thread. Voices are
+ * split across task graph workers, which mix them into their own buses; the buses are then summed, clamped and
+ * interleaved.
+ */
+class FSoftwareAudioMixer : public FRunnable
+{
+public:
+
+	/**
+	 * Constructor
+	 *
+	 * @param	InOutput		output the blocks are written to, owned by the mixer. nullptr to only mix blocks with MixBlock()
+	 * @param	InSampleRate	frames per second of the output
+	 * @param	InBlockFrames	frames mixed at once, rounded up to a multiple of 4
+	 */
+	FSoftwareAudioMixer(ISoftwareAudioOutput* InOutput, int32 InSampleRate, int32 InBlockFrames);
+	virtual ~FSoftwareAudioMixer();
+
+	// FRunnable interface
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// End of FRunnable interface
+
+	/** Starts the mixer thread, which writes the blocks to the output */
+	bool StartThread();
+
+	/** Stops the mixer thread and closes the output */
+	void StopThread();
+
+	/** Creates a voice mixed along with the other voices, from the next block on */
+	FSoftwareAudioVoice* CreateVoice();
+
+	/** Destroys a voice created with CreateVoice(), once the block being mixed is done */
+	void DestroyVoice(FSoftwareAudioVoice* Voice);
+
+	/**
+	 * Queues a command changing voices. Commands run in order on the mixer thread, at the start of the next block, so
+	 * they never change a voice while it is mixed. Without a mixer thread they run when the next block is mixed.
+	 */
+	void RunCommand(TFunction<void()> Command);
+
+	/** Waits until the commands queued so far ran, e.g. before freeing a buffer the stopped voices were playing */
+	void FlushCommands();
+
+	/** @return the playback state of a voice published after the last block it was mixed in */
+	FSoftwareAudioVoiceStatus GetVoiceStatus(const FSoftwareAudioVoice* Voice);
+
+	/**
+	 * Mixes a block of the playing voices.
+	 *
+	 * @param	OutSamples	receives GetBlockFrames() interleaved stereo frames
+	 */
+	void MixBlock(float* OutSamples);
+
+	int32 GetSampleRate() const
+	{
+		return SampleRate;
+	}
+
+	int32 GetBlockFrames() const
+	{
+		return BlockFrames;
+	}
+
+private:
+
+	/** Buffers a range of voices is mixed with */
+	struct FMixContext
+	{
+		/** Planar left and right buses the voices are summed into */
+		FSoftwareAudioSampleArray Buses[SOFTWARE_AUDIO_OUTPUT_CHANNELS];
+		/** One channel of the resampled voice */
+		FSoftwareAudioSampleArray Resampled;
+		/** Planar source frames of each channel, after the carried frames */
+		TArray<float> SourceFrames;
+		/** Interleaved 16 bit frames read from the buffer */
+		TArray<int16> ReadFrames;
+	};
+
+	/** Task mixing a range of voices on a worker thread */
+	friend class FSoftwareAudioMixTask;
+
+	/** Runs the queued commands */
+	void ProcessCommands();
+
+	/** Mixes a range of the voices playing this block into the buses of a context */
+	void MixVoices(FMixContext& Context, int32 FirstVoice, int32 NumVoices);
+
+	/** Mixes one voice into the buses of a context */
+	void MixVoice(FMixContext& Context, FSoftwareAudioVoice& Voice);
+
+	/**
+	 * Reads source frames of a voice, looping or padding with silence at the end of the buffer.
+	 *
+	 * @param	Voice		voice to read
+	 * @param	Dest		receives NumFrames interleaved 16 bit frames
+	 * @param	NumFrames	frames to read
+	 */
+	void ReadVoiceFrames(FSoftwareAudioVoice& Voice, int16* Dest, int32 NumFrames);
+
+	/** @return the context of a range of voices, created on demand */
+	FMixContext& GetContext(int32 Index);
+
+	/** Output the blocks are written to */
+	ISoftwareAudioOutput* Output;
+	/** Frames per second of the output */
+	int32 SampleRate;
+	/** Frames mixed at once */
+	int32 BlockFrames;
+
+	/** Every voice created */
+	TArray<FSoftwareAudioVoice*> Voices;
+	/** Voices playing in the block being mixed */
+	TArray<FSoftwareAudioVoice*> PlayingVoices;
+	/** Buffers of the ranges of voices, the first one is used by the mixer thread */
+	TIndirectArray<FMixContext> Contexts;
+	/** Commands changing the voices, run at the start of each block */
+	TQueue<TFunction<void()>, EQueueMode::Mpsc> Commands;
+	/** Number of commands queued and run so far, FlushCommands() waits until they match */
+	FThreadSafeCounter NumCommandsQueued;
+	FThreadSafeCounter NumCommandsRun;
+	/** Guards the status of the voices, only held while it is published or read */
+	FCriticalSection StatusLock;
+
+	/** Interleaved block written to the output */
+	TArray<float> OutputBlock;
+	/** Set while the thread should keep running */
+	FThreadSafeCounter bKeepRunning;
+	/** Thread writing the blocks to the output */
+	FRunnableThread* Thread;
+};
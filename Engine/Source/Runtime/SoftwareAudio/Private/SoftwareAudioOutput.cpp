@@ -0,0 +1,192 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioOutput.cpp: Outputs the software mixer writes its blocks to.
+=============================================================================*/
+
+#include "SoftwareAudioDevice.h"
+#include "SoftwareAudioOutput.h"
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioNullOutput.
+------------------------------------------------------------------------------------*/
+
+/** Discards the mixed blocks */
+class FSoftwareAudioNullOutput : public ISoftwareAudioOutput
+{
+public:
+
+	virtual bool Open(int32 SampleRate, int32 NumChannels) override
+	{
+		return true;
+	}
+
+	virtual void Close() override
+	{
+	}
+
+	virtual void Write(const float* Samples, int32 NumFrames) override
+	{
+	}
+
+	static ISoftwareAudioOutput* Create()
+	{
+		return new FSoftwareAudioNullOutput();
+	}
+};
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioWaveFileOutput.
+------------------------------------------------------------------------------------*/
+
+/** Writes the mixed blocks to a 16 bit PCM wave file, [SoftwareAudio] CaptureFile or -SoftwareAudioCapture= */
+class FSoftwareAudioWaveFileOutput : public ISoftwareAudioOutput
+{
+public:
+
+	FSoftwareAudioWaveFileOutput()
+		: FileWriter(nullptr)
+		, DataSize(0)
+		, NumOutputChannels(0)
+	{
+	}
+
+	virtual ~FSoftwareAudioWaveFileOutput()
+	{
+		Close();
+	}
+
+	virtual bool Open(int32 SampleRate, int32 NumChannels) override
+	{
+		FString Filename;
+		GConfig->GetString(TEXT("SoftwareAudio"), TEXT("CaptureFile"), Filename, GEngineIni);
+		FParse::Value(FCommandLine::Get(), TEXT("SoftwareAudioCapture="), Filename);
+		if (Filename.IsEmpty())
+		{
+			Filename = FPaths::GameSavedDir() / TEXT("Audio") / TEXT("SoftwareAudioCapture.wav");
+		}
+
+		FileWriter = IFileManager::Get().CreateFileWriter(*Filename);
+		if (!FileWriter)
+		{
+			UE_LOG(LogSoftwareAudio, Warning, TEXT("Failed to open '%s' to capture the software mixer output."), *Filename);
+			return false;
+		}
+
+		UE_LOG(LogSoftwareAudio, Log, TEXT("Capturing the software mixer output to '%s'."), *Filename);
+
+		// The sizes are written when the file is closed
+		const uint16 BlockAlign = NumChannels * sizeof(int16);
+		WriteTag("RIFF");
+		WriteValue<uint32>(0);
+		WriteTag("WAVE");
+		WriteTag("fmt ");
+		WriteValue<uint32>(16);
+		WriteValue<uint16>(1);
+		WriteValue<uint16>(NumChannels);
+		WriteValue<uint32>(SampleRate);
+		WriteValue<uint32>(SampleRate * BlockAlign);
+		WriteValue<uint16>(BlockAlign);
+		WriteValue<uint16>(16);
+		WriteTag("data");
+		WriteValue<uint32>(0);
+
+		DataSize = 0;
+		NumOutputChannels = NumChannels;
+		return true;
+	}
+
+	virtual void Close() override
+	{
+		if (FileWriter)
+		{
+			FileWriter->Seek(RiffSizeOffset);
+			WriteValue<uint32>(DataSize + DataOffset - RiffSizeOffset - sizeof(uint32));
+			FileWriter->Seek(DataSizeOffset);
+			WriteValue<uint32>(DataSize);
+
+			FileWriter->Close();
+			delete FileWriter;
+			FileWriter = nullptr;
+		}
+	}
+
+	virtual void Write(const float* Samples, int32 NumFrames) override
+	{
+		const int32 NumSamples = NumFrames * NumOutputChannels;
+		ConvertedSamples.SetNumUninitialized(NumSamples);
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+		{
+			ConvertedSamples[SampleIndex] = (int16)(FMath::Clamp(Samples[SampleIndex], -1.0f, 1.0f) * 32767.0f);
+		}
+
+		FileWriter->Serialize(ConvertedSamples.GetData(), NumSamples * sizeof(int16));
+		DataSize += NumSamples * sizeof(int16);
+	}
+
+	static ISoftwareAudioOutput* Create()
+	{
+		return new FSoftwareAudioWaveFileOutput();
+	}
+
+private:
+
+	/** Offsets of the sizes in the header */
+	enum
+	{
+		RiffSizeOffset = 4,
+		DataSizeOffset = 40,
+		DataOffset = 44,
+	};
+
+	void WriteTag(const ANSICHAR* Tag)
+	{
+		FileWriter->Serialize((void*)Tag, 4);
+	}
+
+	template<typename ValueType>
+	void WriteValue(ValueType Value)
+	{
+		FileWriter->Serialize(&Value, sizeof(ValueType));
+	}
+
+	FArchive* FileWriter;
+	/** Bytes of samples written so far */
+	uint32 DataSize;
+	int32 NumOutputChannels;
+	/** Block converted to 16 bit samples */
+	TArray<int16> ConvertedSamples;
+};
+
+/*------------------------------------------------------------------------------------
+	FSoftwareAudioOutputRegistry.
+------------------------------------------------------------------------------------*/
+
+TMap<FName, FSoftwareAudioOutputFactory>& FSoftwareAudioOutputRegistry::GetFactories()
+{
+	static TMap<FName, FSoftwareAudioOutputFactory> Factories;
+	static bool bAddedBuiltInOutputs = false;
+	if (!bAddedBuiltInOutputs)
+	{
+		Factories.Add(TEXT("Null"), &FSoftwareAudioNullOutput::Create);
+		Factories.Add(TEXT("WaveFile"), &FSoftwareAudioWaveFileOutput::Create);
+		bAddedBuiltInOutputs = true;
+	}
+	return Factories;
+}
+
+void FSoftwareAudioOutputRegistry::RegisterOutput(FName OutputName, FSoftwareAudioOutputFactory Factory)
+{
+	GetFactories().Add(OutputName, Factory);
+}
+
+void FSoftwareAudioOutputRegistry::UnregisterOutput(FName OutputName)
+{
+	GetFactories().Remove(OutputName);
+}
+
+ISoftwareAudioOutput* FSoftwareAudioOutputRegistry::CreateOutput(FName OutputName)
+{
+	FSoftwareAudioOutputFactory* Factory = GetFactories().Find(OutputName);
+	return Factory ? (*Factory)() : nullptr;
+}
@@ -0,0 +1,334 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioSource.cpp: Sources played by the software mixer.
+=============================================================================*/
+
+#include "SoftwareAudioDevice.h"
+#include "SoftwareAudioMixer.h"
+
+/*------------------------------------------------------------------------------------
+	FSoftwareSoundSource.
+------------------------------------------------------------------------------------*/
+
+FSoftwareSoundSource::FSoftwareSoundSource(FSoftwareAudioDevice* InAudioDevice)
+	: FSoundSource(InAudioDevice)
+	, SoftwareDevice(InAudioDevice)
+	, SoftwareBuffer(nullptr)
+	, Voice(InAudioDevice->GetMixer()->CreateVoice())
+	, PlaybackSerial(0)
+	, NumLoopsNotified(0)
+	, NumQueuedLoops(0)
+	, NumQueuedBytes(0)
+	, bQueuedDataEnds(false)
+{
+}
+
+FSoftwareSoundSource::~FSoftwareSoundSource()
+{
+	SoftwareDevice->GetMixer()->DestroyVoice(Voice);
+	Voice = nullptr;
+}
+
+bool FSoftwareSoundSource::Init(FWaveInstance* InWaveInstance)
+{
+	if (InWaveInstance->OutputTarget != EAudioOutputTarget::Controller)
+	{
+		// Find matching buffer.
+		SoftwareBuffer = FSoftwareSoundBuffer::Init(SoftwareDevice, InWaveInstance->WaveData, InWaveInstance->StartTime > 0.f);
+		Buffer = SoftwareBuffer;
+
+		// Buffer failed to be created, or there was an error with the compressed data
+		if (SoftwareBuffer && SoftwareBuffer->NumChannels > 0)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_AudioSourceInitTime);
+
+			WaveInstance = InWaveInstance;
+
+			// The software mixer has no reverb
+			SetReverbApplied(false);
+
+			if (WaveInstance->StartTime > 0.f)
+			{
+				SoftwareBuffer->Seek(WaveInstance->StartTime);
+			}
+
+			NumLoopsNotified = 0;
+			NumQueuedLoops = 0;
+			NumQueuedBytes = 0;
+			bQueuedDataEnds = false;
+			PlaybackSerial++;
+
+			FSoftwareAudioVoice* InVoice = Voice;
+			FSoftwareSoundBuffer* InBuffer = SoftwareBuffer;
+			const int32 InPlaybackSerial = PlaybackSerial;
+			const bool bLooping = WaveInstance->LoopingMode != LOOP_Never;
+			SoftwareDevice->GetMixer()->RunCommand([InVoice, InBuffer, InPlaybackSerial, bLooping]()
+			{
+				InVoice->PlaybackSerial = InPlaybackSerial;
+				InVoice->ResetPlayback();
+				InVoice->Buffer = InBuffer;
+				InVoice->bPlaying = false;
+				InVoice->bLooping = bLooping;
+			});
+
+			HandleQueuedSource();
+
+			// Updates the source which e.g. sets the pitch and volume.
+			Update();
+
+			// Initialization succeeded.
+			return true;
+		}
+
+		// Buffers without a valid resource ID are transient and need to be deleted.
+		if (SoftwareBuffer && SoftwareBuffer->ResourceID == 0)
+		{
+			delete SoftwareBuffer;
+		}
+		SoftwareBuffer = nullptr;
+		Buffer = nullptr;
+	}
+
+	// Initialization failed.
+	return false;
+}
+
+void FSoftwareSoundSource::GetChannelGains(float ChannelGains[][SOFTWARE_AUDIO_OUTPUT_CHANNELS])
+{
+	FMemory::Memzero(ChannelGains, sizeof(float) * SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS * SOFTWARE_AUDIO_OUTPUT_CHANNELS);
+
+	const float Volume = FMath::Clamp(WaveInstance->GetActualVolume() * FApp::GetVolumeMultiplier(), 0.0f, MAX_VOLUME);
+	if (Volume <= 0.0f)
+	{
+		return;
+	}
+
+	const int32 NumChannels = FMath::Min(SoftwareBuffer->NumChannels, SOFTWARE_AUDIO_MAX_SOURCE_CHANNELS);
+	if (NumChannels == 1)
+	{
+		// Equal power panning between the left and right outputs, by how far to the right of the listener the sound is
+		float Pan = 0.0f;
+		if (WaveInstance->bUseSpatialization && SoftwareDevice->Listeners.Num() > 0)
+		{
+			const FListener& Listener = SoftwareDevice->Listeners[0];
+			const FVector ListenerToSound = WaveInstance->Location - Listener.Transform.GetTranslation();
+			const float Distance = ListenerToSound.Size();
+			if (Distance > KINDA_SMALL_NUMBER)
+			{
+				Pan = FVector::DotProduct(ListenerToSound / Distance, Listener.GetRight());
+
+				// Sounds get less directional as the listener gets inside their omni radius
+				if (WaveInstance->OmniRadius > 0.0f && Distance < WaveInstance->OmniRadius)
+				{
+					Pan *= Distance / WaveInstance->OmniRadius;
+				}
+			}
+		}
+
+		const float Angle = (FMath::Clamp(Pan, -1.0f, 1.0f) + 1.0f) * 0.25f * PI;
+		ChannelGains[0][0] = Volume * FMath::Cos(Angle);
+		ChannelGains[0][1] = Volume * FMath::Sin(Angle);
+	}
+	else
+	{
+		// Even channels are folded to the left output and odd ones to the right, which keeps stereo sounds as they are
+		const float FoldGain = Volume / FMath::Sqrt(NumChannels / 2.0f);
+		for (int32 Channel = 0; Channel < NumChannels; Channel++)
+		{
+			ChannelGains[Channel][Channel & 1] = FoldGain;
+		}
+	}
+}
+
+void FSoftwareSoundSource::Update()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AudioUpdateSources);
+
+	if (!WaveInstance || !SoftwareBuffer || Paused)
+	{
+		return;
+	}
+
+	FSoftwareAudioMixer* Mixer = SoftwareDevice->GetMixer();
+
+	const float Pitch = FMath::Clamp<float>(WaveInstance->Pitch, MIN_PITCH, MAX_PITCH);
+	const float ResampleRatio = Pitch * SoftwareBuffer->SampleRate / Mixer->GetSampleRate();
+
+	// Set the HighFrequencyGain value (aka low pass filter setting)
+	SetHighFrequencyGain();
+
+	float FilterCoefficient = 1.0f;
+	if (HighFrequencyGain < 1.0f - KINDA_SMALL_NUMBER)
+	{
+		FilterCoefficient = FMath::Clamp(2.0f * FMath::Sin(PI * 6000.0f * HighFrequencyGain / Mixer->GetSampleRate()), 0.0f, 1.0f);
+	}
+
+	FSoftwareAudioVoiceParams Params;
+	Params.ResampleRatio = ResampleRatio;
+	Params.FilterCoefficient = FilterCoefficient;
+	GetChannelGains(Params.TargetGains);
+
+	FSoftwareAudioVoice* InVoice = Voice;
+	Mixer->RunCommand([InVoice, Params]()
+	{
+		InVoice->Params = Params;
+	});
+}
+
+void FSoftwareSoundSource::Play()
+{
+	if (WaveInstance)
+	{
+		FSoftwareAudioVoice* InVoice = Voice;
+		SoftwareDevice->GetMixer()->RunCommand([InVoice]()
+		{
+			InVoice->bPlaying = true;
+		});
+
+		Paused = false;
+		Playing = true;
+	}
+}
+
+void FSoftwareSoundSource::Stop()
+{
+	if (WaveInstance)
+	{
+		// Buffers without a valid resource ID are transient and need to be deleted, once the mixer stopped reading them.
+		FSoftwareSoundBuffer* TransientBuffer = (SoftwareBuffer && SoftwareBuffer->ResourceID == 0) ? SoftwareBuffer : nullptr;
+		FSoftwareAudioVoice* InVoice = Voice;
+		SoftwareDevice->GetMixer()->RunCommand([InVoice, TransientBuffer]()
+		{
+			InVoice->bPlaying = false;
+			InVoice->Buffer = nullptr;
+			InVoice->ResetPlayback();
+			delete TransientBuffer;
+		});
+
+		SoftwareBuffer = nullptr;
+		Buffer = nullptr;
+		Paused = false;
+		Playing = false;
+	}
+
+	FSoundSource::Stop();
+}
+
+void FSoftwareSoundSource::Pause()
+{
+	if (WaveInstance)
+	{
+		FSoftwareAudioVoice* InVoice = Voice;
+		SoftwareDevice->GetMixer()->RunCommand([InVoice]()
+		{
+			InVoice->bPlaying = false;
+		});
+
+		Paused = true;
+	}
+}
+
+bool FSoftwareSoundSource::IsFinished()
+{
+	// A paused source is not finished.
+	if (Paused)
+	{
+		return false;
+	}
+
+	if (WaveInstance && SoftwareBuffer)
+	{
+		// Until the mixer played this wave instance, the voice reports the state of the previous one
+		const FSoftwareAudioVoiceStatus Status = SoftwareDevice->GetMixer()->GetVoiceStatus(Voice);
+		const bool bStatusCurrent = Status.PlaybackSerial == PlaybackSerial;
+		const int32 NumLoops = (bStatusCurrent ? Status.NumLoops : 0) + NumQueuedLoops;
+
+		if (bStatusCurrent && Status.bFinished)
+		{
+			// ... notify the wave instance that it has finished playing.
+			WaveInstance->NotifyFinished();
+			return true;
+		}
+
+		// If we have just looped, and we are programmatically looping, send notification
+		while (NumLoopsNotified < NumLoops)
+		{
+			NumLoopsNotified++;
+			if (WaveInstance->LoopingMode == LOOP_WithNotification)
+			{
+				WaveInstance->NotifyFinished();
+			}
+		}
+
+		HandleQueuedSource();
+
+		return false;
+	}
+
+	return true;
+}
+
+bool FSoftwareSoundSource::UsesCPUDecompression()
+{
+	return SoftwareBuffer && SoftwareBuffer->IsRealTime();
+}
+
+void FSoftwareSoundSource::HandleQueuedSource()
+{
+	const bool bProcedural = SoftwareBuffer->SoundFormat == ESoftwareSoundFormat::Procedural;
+	if (!bProcedural && SoftwareBuffer->SoundFormat != ESoftwareSoundFormat::Streaming)
+	{
+		return;
+	}
+
+	// Keep about MONO_PCM_BUFFER_SAMPLES frames ahead of the mixer, the device is updated once per frame
+	const int32 MaxBytes = MONO_PCM_BUFFER_SIZE * SoftwareBuffer->NumChannels;
+
+	if (bQueuedDataEnds)
+	{
+		return;
+	}
+
+	const FSoftwareAudioVoiceStatus Status = SoftwareDevice->GetMixer()->GetVoiceStatus(Voice);
+	const int32 NumQueuedBytesRead = Status.PlaybackSerial == PlaybackSerial ? Status.NumQueuedBytesRead : 0;
+
+	if (NumQueuedBytes - NumQueuedBytesRead < MaxBytes)
+	{
+		TArray<uint8> QueuedData;
+		QueuedData.SetNumUninitialized(MaxBytes);
+
+		int32 BytesWritten = MaxBytes;
+		bool bReachedEnd = false;
+		if (bProcedural)
+		{
+			BytesWritten = WaveInstance->WaveData->GeneratePCMData(QueuedData.GetData(), MaxBytes / sizeof(int16));
+		}
+		else
+		{
+			bReachedEnd = SoftwareBuffer->ReadCompressedData(QueuedData.GetData(), WaveInstance->LoopingMode != LOOP_Never);
+		}
+
+		QueuedData.SetNum(FMath::Max(BytesWritten, 0), false);
+		NumQueuedBytes += QueuedData.Num();
+		if (bReachedEnd)
+		{
+			if (WaveInstance->LoopingMode != LOOP_Never)
+			{
+				NumQueuedLoops++;
+			}
+			else
+			{
+				bQueuedDataEnds = true;
+			}
+		}
+
+		FSoftwareAudioVoice* InVoice = Voice;
+		const bool bInQueuedDataEnds = bQueuedDataEnds;
+		SoftwareDevice->GetMixer()->RunCommand([InVoice, QueuedData, bInQueuedDataEnds]()
+		{
+			InVoice->QueuedData.Append(QueuedData);
+			InVoice->bQueuedDataEnds = bInQueuedDataEnds;
+		});
+	}
+}
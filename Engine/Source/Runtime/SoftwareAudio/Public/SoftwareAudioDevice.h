@@ -0,0 +1,232 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioDevice.h: Audio device mixing every source in software.
+=============================================================================*/
+
+#pragma once
+
+/*------------------------------------------------------------------------------------
+	Dependencies, helpers & forward declarations.
+------------------------------------------------------------------------------------*/
+
+class FSoftwareAudioDevice;
+class FSoftwareAudioMixer;
+struct FSoftwareAudioVoice;
+
+#include "Engine.h"
+#include "SoundDefinitions.h"
+#include "AudioDecompress.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSoftwareAudio, Log, All);
+
+/** How the data of a buffer is read by the mixer */
+enum class ESoftwareSoundFormat
+{
+	/** 16 bit PCM decompressed when the wave was precached */
+	PCM,
+	/** 16 bit PCM created at runtime, e.g. for editor previews */
+	PCMPreview,
+	/** Compressed data decompressed while mixing */
+	PCMRealTime,
+	/** 16 bit PCM generated by the wave while playing */
+	Procedural,
+	/** Compressed data streamed in chunks, decompressed by the source ahead of the mixer */
+	Streaming,
+};
+
+/**
+ * Software implementation of FSoundBuffer, containing the wave data and format information.
+ */
+class FSoftwareSoundBuffer : public FSoundBuffer
+{
+public:
+
+	/**
+	 * Constructor
+	 *
+	 * @param	InAudioDevice	audio device this sound buffer is going to be attached to
+	 * @param	InSoundFormat	how the mixer reads the data of the buffer
+	 */
+	FSoftwareSoundBuffer(FSoftwareAudioDevice* InAudioDevice, ESoftwareSoundFormat InSoundFormat);
+
+	/**
+	 * Destructor
+	 *
+	 * Frees wave data and detaches itself from audio device.
+	 */
+	virtual ~FSoftwareSoundBuffer();
+
+	// FSoundBuffer interface
+	virtual int32 GetSize() override;
+	virtual int32 GetCurrentChunkIndex() const override;
+	virtual int32 GetCurrentChunkOffset() const override;
+	// End of FSoundBuffer interface
+
+	/**
+	 * Static function used to create a buffer.
+	 *
+	 * @param	AudioDevice		audio device to attach created buffer to
+	 * @param	Wave			USoundWave to use as template and wave source
+	 * @param	bForceRealTime	whether to decompress the wave while mixing, used to start playing from a given time
+	 * @return	FSoftwareSoundBuffer pointer if buffer creation succeeded, nullptr otherwise
+	 */
+	static FSoftwareSoundBuffer* Init(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave, bool bForceRealTime);
+
+	/** Creates a buffer decompressing the compressed data of the wave while mixing */
+	static FSoftwareSoundBuffer* CreateQueuedBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave);
+
+	/** Creates a buffer for the data generated by a procedural wave */
+	static FSoftwareSoundBuffer* CreateProceduralBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave);
+
+	/** Creates a buffer taking over the PCM data created at runtime, replacing any existing buffer of the wave */
+	static FSoftwareSoundBuffer* CreatePreviewBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave, FSoftwareSoundBuffer* Buffer);
+
+	/** Creates a buffer taking over the PCM data the wave was decompressed to when it was precached */
+	static FSoftwareSoundBuffer* CreateNativeBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave);
+
+	/** Creates a buffer decompressing the streamed chunks of the wave while it plays */
+	static FSoftwareSoundBuffer* CreateStreamingBuffer(FSoftwareAudioDevice* AudioDevice, USoundWave* Wave);
+
+	/**
+	 * Decompresses MONO_PCM_BUFFER_SAMPLES frames of a real time or streaming buffer.
+	 *
+	 * @param	Destination		memory to decompress to, MONO_PCM_BUFFER_SIZE * NumChannels bytes
+	 * @param	bLooping		whether to loop the sound seamlessly, or pad with zeroes
+	 * @return	true if the end of the data was reached
+	 */
+	bool ReadCompressedData(uint8* Destination, bool bLooping);
+
+	/** Seeks a real time or streaming buffer to the given time */
+	void Seek(float SeekTime);
+
+	/** @return true if the data is decompressed while mixing */
+	bool IsRealTime() const
+	{
+		return SoundFormat == ESoftwareSoundFormat::PCMRealTime || SoundFormat == ESoftwareSoundFormat::Streaming;
+	}
+
+	/** @return the number of frames of a PCM buffer */
+	int32 GetNumFrames() const
+	{
+		return NumChannels > 0 ? PCMDataSize / (NumChannels * sizeof(int16)) : 0;
+	}
+
+	/** Audio device this buffer is attached to */
+	FSoftwareAudioDevice* AudioDevice;
+	/** How the mixer reads the data of the buffer */
+	ESoftwareSoundFormat SoundFormat;
+	/** 16 bit interleaved PCM data of PCM and preview buffers */
+	const uint8* PCMData;
+	/** Size of PCMData in bytes */
+	int32 PCMDataSize;
+	/** Frames per second of the data */
+	int32 SampleRate;
+	/** Decompresses real time and streaming buffers */
+	ICompressedAudioInfo* DecompressionState;
+	/** Whether the PCM data of a preview buffer is owned by the buffer */
+	bool bDynamicResource;
+};
+
+/**
+ * Software implementation of FSoundSource. Each source owns a voice of the mixer; the source sets its parameters on the
+ * thread updating the audio device and the mixer thread plays it.
+ */
+class FSoftwareSoundSource : public FSoundSource
+{
+public:
+
+	/**
+	 * Constructor
+	 *
+	 * @param	InAudioDevice	audio device this source is attached to
+	 */
+	FSoftwareSoundSource(FSoftwareAudioDevice* InAudioDevice);
+
+	/**
+	 * Destructor
+	 */
+	virtual ~FSoftwareSoundSource();
+
+	// FSoundSource interface
+	virtual bool Init(FWaveInstance* InWaveInstance) override;
+	virtual void Update() override;
+	virtual void Play() override;
+	virtual void Stop() override;
+	virtual void Pause() override;
+	virtual bool IsFinished() override;
+	virtual bool UsesCPUDecompression() override;
+	// End of FSoundSource interface
+
+private:
+
+	/** Computes the gains of each channel of the buffer to the left and right outputs */
+	void GetChannelGains(float ChannelGains[][2]);
+
+	/** Generates or decompresses the data of a procedural or streaming buffer the mixer is about to run out of */
+	void HandleQueuedSource();
+
+	/** Software device the source is attached to */
+	FSoftwareAudioDevice* SoftwareDevice;
+	/** Cached sound buffer associated with currently bound wave instance */
+	FSoftwareSoundBuffer* SoftwareBuffer;
+	/** Voice of the mixer playing the source */
+	FSoftwareAudioVoice* Voice;
+	/** Increased for each wave instance played, tells the status the voice reports for it from stale ones */
+	int32 PlaybackSerial;
+	/** Number of loops the mixer reported so far */
+	int32 NumLoopsNotified;
+	/** Number of times the data queued to the voice looped */
+	int32 NumQueuedLoops;
+	/** Bytes of generated or decompressed data queued to the voice */
+	int32 NumQueuedBytes;
+	/** Whether the end of a streaming buffer was queued to the voice */
+	bool bQueuedDataEnds;
+};
+
+/**
+ * Audio device decoding, resampling, spatializing and mixing every source on the CPU. The mixed blocks are written to an
+ * ISoftwareAudioOutput. With the null output the device runs without audio hardware, e.g. on servers and build machines,
+ * and the throughput of the mixer can be measured (see au.SoftwareMixer.Benchmark).
+ */
+class FSoftwareAudioDevice : public FAudioDevice
+{
+public:
+
+	FSoftwareAudioDevice();
+	virtual ~FSoftwareAudioDevice();
+
+	virtual FName GetRuntimeFormat(USoundWave* SoundWave) override
+	{
+		static FName NAME_OGG(TEXT("OGG"));
+		return NAME_OGG;
+	}
+
+	virtual bool HasCompressedAudioInfoClass(USoundWave* SoundWave) override;
+
+	virtual bool SupportsRealtimeDecompression() const override
+	{
+		return true;
+	}
+
+	virtual class ICompressedAudioInfo* CreateCompressedAudioInfo(USoundWave* SoundWave) override;
+
+	/** @return the mixer playing the sources */
+	FSoftwareAudioMixer* GetMixer() const
+	{
+		return Mixer;
+	}
+
+protected:
+
+	// FAudioDevice interface
+	virtual bool InitializeHardware() override;
+	virtual void TeardownHardware() override;
+	virtual FSoundSource* CreateSoundSource() override;
+	// End of FAudioDevice interface
+
+private:
+
+	/** Mixes the sources on its own thread */
+	FSoftwareAudioMixer* Mixer;
+};
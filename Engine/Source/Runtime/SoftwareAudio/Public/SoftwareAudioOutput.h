@@ -0,0 +1,74 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SoftwareAudioOutput.h: Outputs the software mixer writes its blocks to.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Receives the blocks mixed by the software mixer. Outputs are only used by the mixer thread.
+ */
+class ISoftwareAudioOutput
+{
+public:
+
+	virtual ~ISoftwareAudioOutput()
+	{
+	}
+
+	/**
+	 * Opens the output.
+	 *
+	 * @param	SampleRate		frames per second of the blocks that will be written
+	 * @param	NumChannels		channels of the interleaved blocks
+	 * @return	true if the output can be written to
+	 */
+	virtual bool Open(int32 SampleRate, int32 NumChannels) = 0;
+
+	/** Closes the output, no more blocks are written after this. */
+	virtual void Close() = 0;
+
+	/**
+	 * Writes a mixed block.
+	 *
+	 * @param	Samples		interleaved samples in [-1, 1]
+	 * @param	NumFrames	number of frames in the block
+	 */
+	virtual void Write(const float* Samples, int32 NumFrames) = 0;
+
+	/**
+	 * @return true if Write() blocks until the hardware needs more data. Otherwise the mixer sleeps between blocks to
+	 * keep mixing in real time.
+	 */
+	virtual bool IsPacedByHardware() const
+	{
+		return false;
+	}
+};
+
+/** Creates an output */
+typedef ISoftwareAudioOutput* (*FSoftwareAudioOutputFactory)();
+
+/**
+ * Outputs known to the software audio device, picked by name from [SoftwareAudio] OutputName or -SoftwareAudioOutput=.
+ * "Null" discards the blocks and "WaveFile" writes them to [SoftwareAudio] CaptureFile; platform modules can register
+ * outputs playing the blocks on their hardware.
+ */
+class SOFTWAREAUDIO_API FSoftwareAudioOutputRegistry
+{
+public:
+
+	/** Registers an output, replacing any output registered with the same name */
+	static void RegisterOutput(FName OutputName, FSoftwareAudioOutputFactory Factory);
+
+	/** Unregisters an output */
+	static void UnregisterOutput(FName OutputName);
+
+	/** @return a new output, or nullptr if no output is registered with this name */
+	static ISoftwareAudioOutput* CreateOutput(FName OutputName);
+
+private:
+
+	static TMap<FName, FSoftwareAudioOutputFactory>& GetFactories();
+};
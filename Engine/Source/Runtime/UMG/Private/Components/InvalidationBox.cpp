@@ -0,0 +1,109 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "UMGPrivatePCH.h"
+
+#define LOCTEXT_NAMESPACE "UMG"
+
+/////////////////////////////////////////////////////
+// UInvalidationBox
+
+UInvalidationBox::UInvalidationBox(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bIsVariable = true;
+	Visibility = ESlateVisibility::SelfHitTestInvisible;
+	bCanCache = true;
+}
+
+void UInvalidationBox::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyInvalidationPanel.Reset();
+}
+
+TSharedRef<SWidget> UInvalidationBox::RebuildWidget()
+{
+	MyInvalidationPanel = SNew(SInvalidationPanel)
+		.CacheContent(bCanCache);
+
+	if ( GetChildrenCount() > 0 )
+	{
+		MyInvalidationPanel->SetContent(GetContentSlot()->Content ? GetContentSlot()->Content->TakeWidget() : SNullWidget::NullWidget);
+	}
+
+	return BuildDesignTimeWidget(MyInvalidationPanel.ToSharedRef());
+}
+
+void UInvalidationBox::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if ( MyInvalidationPanel.IsValid() )
+	{
+		MyInvalidationPanel->SetCacheContent(bCanCache);
+	}
+}
+
+void UInvalidationBox::OnSlotAdded(UPanelSlot* Slot)
+{
+	// Add the child to the live slot if it already exists
+	if ( MyInvalidationPanel.IsValid() )
+	{
+		MyInvalidationPanel->SetContent(Slot->Content ? Slot->Content->TakeWidget() : SNullWidget::NullWidget);
+	}
+}
+
+void UInvalidationBox::OnSlotRemoved(UPanelSlot* Slot)
+{
+	// Remove the widget from the live slot if it exists.
+	if ( MyInvalidationPanel.IsValid() )
+	{
+		MyInvalidationPanel->SetContent(SNullWidget::NullWidget);
+	}
+}
+
+void UInvalidationBox::InvalidateCache()
+{
+	if ( MyInvalidationPanel.IsValid() )
+	{
+		MyInvalidationPanel->InvalidateCache();
+	}
+}
+
+bool UInvalidationBox::GetCanCache() const
+{
+	if ( MyInvalidationPanel.IsValid() )
+	{
+		return MyInvalidationPanel->GetCacheContent();
+	}
+
+	return bCanCache;
+}
+
+void UInvalidationBox::SetCanCache(bool CanCache)
+{
+	bCanCache = CanCache;
+	if ( MyInvalidationPanel.IsValid() )
+	{
+		MyInvalidationPanel->SetCacheContent(bCanCache);
+	}
+}
+
+#if WITH_EDITOR
+
+const FSlateBrush* UInvalidationBox::GetEditorIcon()
+{
+	return FUMGStyle::Get().GetBrush("Widget");
+}
+
+const FText UInvalidationBox::GetPaletteCategory()
+{
+	return LOCTEXT("Optimization", "Optimization");
+}
+
+#endif
+
+/////////////////////////////////////////////////////
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,65 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "InvalidationBox.generated.h"
+
+/**
+ * Caches the layout and drawing of its content, and only paints it again when something in the content changes.
+ * Widgets with bound properties are painted every frame. Use it around parts of the UI that rarely change, like HUD frames.
+ *
+ * ● Single Child
+ * ● Caching
+ */
+UCLASS()
+class UMG_API UInvalidationBox : public UContentWidget
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** Whether the content is cached. When false the content is painted every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Caching")
+	bool bCanCache;
+
+public:
+
+	/** Paints and caches the content again the next frame, for changes the content does not report. */
+	UFUNCTION(BlueprintCallable, Category="Invalidation Box")
+	void InvalidateCache();
+
+	/** @return true if the content is cached */
+	UFUNCTION(BlueprintCallable, Category="Invalidation Box")
+	bool GetCanCache() const;
+
+	/** Sets whether the content is cached */
+	UFUNCTION(BlueprintCallable, Category="Invalidation Box")
+	void SetCanCache(bool CanCache);
+
+	// UWidget interface
+	virtual void SynchronizeProperties() override;
+	// End of UWidget interface
+
+	// UVisual interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	// End of UVisual interface
+
+#if WITH_EDITOR
+	virtual const FSlateBrush* GetEditorIcon() override;
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+
+	// UPanelWidget
+	virtual void OnSlotAdded(UPanelSlot* Slot) override;
+	virtual void OnSlotRemoved(UPanelSlot* Slot) override;
+	// End UPanelWidget
+
+	// UWidget interface
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	// End of UWidget interface
+
+protected:
+	TSharedPtr<SInvalidationPanel> MyInvalidationPanel;
+};
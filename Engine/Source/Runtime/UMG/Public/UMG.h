@@ -44,6 +44,9 @@
 #include "NamedSlot.h"
 #include "NamedSlotInterface.h"
 
+#include "SInvalidationPanel.h"
+#include "InvalidationBox.h"
+
 #include "CanvasPanelSlot.h"
 #include "CanvasPanel.h"
 